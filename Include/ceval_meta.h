@@ -175,6 +175,7 @@ PyObject *PyEval2_EvalGen(PyGenObject *gen, PyObject *opt_value);
 // Used by pstate.c
 _PyThreadStack *vm_new_threadstate(PyThreadState *tstate);
 void vm_free_threadstate(_PyThreadStack *ts);
+int vm_reset_threadstate(_PyThreadStack *ts);
 _PyThreadStack *vm_active(PyThreadState *tstate);
 
 void vm_push_thread_stack(PyThreadState *tstate, _PyThreadStack *ts);
@@ -266,6 +267,7 @@ int vm_kwargs_to_dict(PyThreadState *ts, Py_ssize_t idx);
 PyObject *vm_call_cfunction(PyThreadState *ts, Register acc);
 PyObject *vm_call_function(PyThreadState *ts, Register acc);
 PyObject *vm_tpcall_function(PyThreadState *ts, Register acc);
+void vm_specialize_builtins(PyObject *builtins);
 
 Register
 vm_make_function(PyThreadState *ts, PyCodeObject *code);
@@ -278,6 +280,7 @@ void too_many_positional(PyThreadState *ts, Register acc);
 int vm_setup_ex(PyThreadState *ts, PyCodeObject *co, Register acc);
 int vm_setup_varargs(PyThreadState *ts, PyCodeObject *co, Register acc);
 int vm_setup_kwargs(PyThreadState *ts, PyCodeObject *co, Register acc, PyObject **kwnames);
+void vm_kwmap_add(PyCodeObject *co, PyObject *kwnames);
 int vm_setup_kwdefaults(PyThreadState *ts, Py_ssize_t idx);
 int vm_setup_cells(PyThreadState *ts, PyCodeObject *code);
 void vm_setup_err(PyThreadState *ts, Register acc);
@@ -306,7 +309,16 @@ int vm_eval_breaker(PyThreadState *ts, const uint8_t *last_pc);
 int vm_trace_handler(PyThreadState *ts, const uint8_t *last_pc, Register acc);
 PyObject *vm_trace_cfunc(PyThreadState *ts, Register acc);
 int vm_trace_return(PyThreadState *ts, PyObject *return_value);
-void vm_trace_stop_iteration(PyThreadState *ts);
+PyObject *vm_trace_stop_iteration(PyThreadState *ts, PyObject *value);
+
+#ifdef Py_VM_STATS
+// --with-vm-stats (see sys._vm_stats())
+void vm_stats_cache_site(PyThreadState *ts, PyCodeObject *code,
+                         const uint8_t *pc, int hit);
+void vm_stats_merge(PyThreadState *tstate);
+void vm_stats_clear(PyInterpreterState *interp);
+PyObject *vm_stats_get(PyObject *self, PyObject *unused);
+#endif
 
 
 #ifdef __cplusplus
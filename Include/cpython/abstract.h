@@ -335,6 +335,14 @@ PyAPI_FUNC(void) PyBuffer_Release(Py_buffer *view);
     (Py_TYPE(obj)->tp_iternext != NULL && \
      Py_TYPE(obj)->tp_iternext != &_PyObject_NextNotImplemented)
 
+/* Sends 'arg' into a generator, coroutine or iterator. Returns
+   PYGEN_NEXT with the yielded value in *result, PYGEN_RETURN with the
+   return value in *result, or PYGEN_ERROR with an exception set and
+   *result NULL. Uses am_send when the type has it, so a finished
+   generator or coroutine does not raise StopIteration. */
+PyAPI_FUNC(PySendResult) PyIter_Send(PyObject *iter, PyObject *arg,
+                                     PyObject **result);
+
 /* === Sequence protocol ================================================ */
 
 /* Assume tp_as_sequence and sq_item exist and that 'i' does not
@@ -14,6 +14,10 @@ typedef uint16_t _Py_CODEUNIT;
 
 struct _PyHandlerTable;
 struct _PyJumpSideTable;
+struct _PyKwMap;
+
+/* Number of keyword argument layouts cached per code object */
+#define _PyCode_NKWMAPS 4
 
 struct PyCodeObject {
     PyObject_HEAD
@@ -39,6 +43,8 @@ struct PyCodeObject {
 
     struct _PyHandlerTable *co_exc_handlers;
     struct _PyJumpSideTable *co_jump_table;
+    /* keyword argument layouts of calls to this code, filled in order */
+    struct _PyKwMap *co_kwmaps[_PyCode_NKWMAPS];
 
     PyObject *co_weakreflist;
     /* Scratch space for extra data relating to the code object.
@@ -176,10 +176,21 @@ typedef struct {
     objobjargproc mp_ass_subscript;
 } PyMappingMethods;
 
+/* Result of am_send and PyIter_Send() */
+typedef enum {
+    PYGEN_RETURN = 0,
+    PYGEN_ERROR = -1,
+    PYGEN_NEXT = 1,
+} PySendResult;
+
+typedef PySendResult (*sendfunc)(PyObject *iter, PyObject *value,
+                                 PyObject **result);
+
 typedef struct {
     unaryfunc am_await;
     unaryfunc am_aiter;
     unaryfunc am_anext;
+    sendfunc am_send;
 } PyAsyncMethods;
 
 typedef struct {
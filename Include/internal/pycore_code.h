@@ -81,6 +81,31 @@ struct _PyJumpSideTable {
     JumpEntry entries[];
 };
 
+/* The registers that the keyword arguments of a call go to, for calls that
+   pass kwnames. kwnames is an interned (immortal) constant tuple, so that
+   its address identifies the keywords. Added by vm_kwmap_add(). */
+struct _PyKwMap {
+    PyObject *kwnames;
+    Py_ssize_t regs[];
+};
+
+/* Return the registers of the keywords in kwnames, or NULL if calls to co
+   with these keywords haven't been cached */
+static inline const Py_ssize_t *
+_PyCode_FindKwMap(PyCodeObject *co, PyObject *kwnames)
+{
+    for (int i = 0; i < _PyCode_NKWMAPS; i++) {
+        struct _PyKwMap *map = _Py_atomic_load_ptr(&co->co_kwmaps[i]);
+        if (map == NULL) {
+            break;
+        }
+        if (map->kwnames == kwnames) {
+            return map->regs;
+        }
+    }
+    return NULL;
+}
+
 PyCodeObject *
 PyCode_NewInternal(
         int, int, int, int, int, int, int, int, PyObject *, PyObject *,
@@ -89,6 +114,7 @@ PyCode_NewInternal(
 
 void _PyCode_UpdateFlags(PyCodeObject *);
 int _PyCode_InternConstants(PyCodeObject *);
+int _PyCode_InternConstant(PyObject **);
 
 
 #ifdef __cplusplus
@@ -0,0 +1,55 @@
+/* Instruction set extensions detected at run time.
+
+   HAVE_SSE2 and HAVE_NEON (pyport.h) tell what the compiler may use
+   everywhere.  Code for newer extensions is compiled for them with
+   _Py_TARGET() and must only run if _Py_cpu_features says that the CPU
+   (and the OS) support them:
+
+       _Py_TARGET("avx2") static void f_avx2(...) { ... }
+
+       if (_Py_cpu_features & _Py_CPU_AVX2) {
+           f_avx2(...);
+       }
+*/
+
+#ifndef Py_INTERNAL_CPUINFO_H
+#define Py_INTERNAL_CPUINFO_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef Py_BUILD_CORE
+#  error "this header requires Py_BUILD_CORE define"
+#endif
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#  define _Py_HAVE_X86_SIMD 1
+#  define _Py_TARGET(features) __attribute__((target(features)))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#  define _Py_HAVE_X86_SIMD 1
+   /* MSVC compiles intrinsics of any extension in any function */
+#  define _Py_TARGET(features)
+#endif
+
+#ifdef _Py_HAVE_X86_SIMD
+#  include <immintrin.h>
+#endif
+
+/* SSSE3 and SSE4.1, for _Py_TARGET("ssse3,sse4.1") */
+#define _Py_CPU_SSE41 (1 << 0)
+/* AVX2 (and _Py_CPU_SSE41), for _Py_TARGET("avx2") */
+#define _Py_CPU_AVX2 (1 << 1)
+/* SSE2, which every x86-64 CPU has: code checks it only so that tests can
+   clear it to run the portable code */
+#define _Py_CPU_SSE2 (1 << 2)
+
+/* Set at startup by _Py_InitCpuFeatures(), zero before.  Tests may clear
+   bits to exercise the code for older CPUs. */
+PyAPI_DATA(int) _Py_cpu_features;
+
+extern void _Py_InitCpuFeatures(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* !Py_INTERNAL_CPUINFO_H */
@@ -132,6 +132,23 @@ struct gc_generation_stats {
     Py_ssize_t uncollectable;
 };
 
+/* Time-to-safepoint statistics of stop-the-world requests. Updated by the
+   requesting thread while the other threads are stopped. */
+struct _gc_stw_stats {
+    /* number of stop-the-world requests */
+    Py_ssize_t stops;
+    /* total, longest and most recent time until all threads stopped */
+    _PyTime_t total_time;
+    _PyTime_t max_time;
+    _PyTime_t last_time;
+    /* The thread that stopped last in the most recent request, or 0 if no
+       thread had to be waited for, and the code object (strong reference)
+       and line number it was executing, if known. */
+    unsigned long last_thread_id;
+    PyObject *last_code;
+    int last_lineno;
+};
+
 struct _gc_runtime_state {
     /* List of objects that still need to be cleaned up, singly linked
      * via their gc headers' gc_prev pointers.  */
@@ -163,6 +180,14 @@ struct _gc_runtime_state {
     Py_ssize_t gc_thread_countdown;
     /* Signalled when all threads stops thesmelves for GC */
     _PyRawEvent gc_stop_event;
+    /* The thread that brought gc_thread_countdown to zero (NULL if it was
+       exiting) and its id. Protected by HEAD_LOCK(runtime). */
+    PyThreadState *gc_stop_last;
+    unsigned long gc_stop_last_id;
+    /* Code object replaced in stw_stats.last_code, released once the world
+       is restarted. */
+    PyObject *gc_stop_stale_code;
+    struct _gc_stw_stats stw_stats;
     /* This is the number of objects that survived the last full
        collection. It approximates the number of long lived objects
        tracked by the GC.
@@ -63,8 +63,8 @@ typedef struct {
 PyGenObject *
 PyGen_NewWithCode(PyThreadState *ts, PyCodeObject *co);
 
-PyAPI_FUNC(PyObject *) _PyGen_FetchStopIterationValue2(void);
-PyAPI_FUNC(PyObject *) _PyGen_YieldFrom(PyGenObject *gen, PyObject *awaitable, PyObject *arg);
+PyAPI_FUNC(PySendResult) _PyGen_YieldFrom(PyGenObject *gen, PyObject *awaitable,
+                                          PyObject *arg, PyObject **presult);
 void _PyGen_Finalize(PyObject *self);
 
 PyObject *_PyCoro_GetAwaitableIter(PyObject *o);
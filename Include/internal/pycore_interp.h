@@ -57,6 +57,30 @@ struct _Py_unicode_state {
 };
 
 
+#ifdef Py_VM_STATS
+/* Paths taken by calls in the interpreter loop */
+enum _Py_vm_call_kind {
+    _Py_VM_CALL_FUNCTION,       /* entering a Python function (FUNC_HEADER) */
+    _Py_VM_CALL_METHOD,         /* bound method unpacked (METHOD_HEADER) */
+    _Py_VM_CALL_CFUNCTION,      /* builtin function (CFUNC_HEADER) */
+    _Py_VM_CALL_OBJECT,         /* other callables, via vm_call_function() */
+    _Py_VM_CALL_OBJECT_EX,      /* f(*args, **kwargs) on other callables */
+    _Py_VM_CALL_KINDS
+};
+
+/* Interpreter event counters of a --with-vm-stats build. Each thread
+   counts into its own copy, which is merged into the interpreter's copy
+   when the thread state is cleared (see sys._vm_stats()). */
+struct _Py_vm_stats {
+    uint64_t opcodes[256];
+    uint64_t calls[_Py_VM_CALL_KINDS];
+    uint64_t resize_stack;
+    /* LOAD_GLOBAL, LOAD_ATTR and LOAD_METHOD hits and misses of the
+       metadata cache: pc -> struct _Py_vm_cache_site */
+    struct _Py_hashtable_t *cache_sites;
+};
+#endif
+
 /* interpreter state */
 
 #define _PY_NSMALLPOSINTS           257
@@ -67,6 +91,10 @@ struct _is {
 
     struct _is *next;
     struct _ts *tstate_head;
+    /* Deleted thread states kept for reuse by new threads, linked by their
+       next field (see new_threadstate()). Protected by HEAD_LOCK. */
+    struct _ts *tstate_pool;
+    Py_ssize_t tstate_pool_size;
 
     /* Reference to the _PyRuntime global variable. This field exists
        to not have to pass runtime in addition to tstate to a function.
@@ -119,6 +147,12 @@ struct _is {
     _PyRecursiveMutex consts_mutex;
     struct _Py_hashtable_t *consts;
 
+#ifdef Py_VM_STATS
+    /* counters of exited threads, protected by vm_stats_mutex */
+    _PyMutex vm_stats_mutex;
+    struct _Py_vm_stats vm_stats;
+#endif
+
     Py_ssize_t co_extra_user_count;
     freefunc co_extra_freefuncs[MAX_CO_EXTRA_USERS];
 
@@ -8,6 +8,7 @@ extern "C" {
 #  error "this header requires Py_BUILD_CORE define"
 #endif
 
+#include "pycore_interp.h"    /* struct _Py_vm_stats */
 #include "pycore_llist.h"     /* llist_data */
 #include "pycore_runtime.h"   /* PyRuntimeState */
 
@@ -23,7 +24,8 @@ enum {
     EVAL_PENDING_CALLS = 1U << 2,
     EVAL_DROP_GIL = 1U << 3,
     EVAL_ASYNC_EXC = 1U << 4,
-    EVAL_EXPLICIT_MERGE = 1U << 5
+    EVAL_EXPLICIT_MERGE = 1U << 5,
+    EVAL_HANDSHAKE = 1U << 6
 };
 
 #define for_each_thread(t)                                                      \
@@ -158,6 +160,16 @@ struct brc_state {
 
 struct qsbr;
 
+typedef void (*_PyHandshakeFunc)(PyThreadState *tstate, void *arg);
+
+/* A request to run func(tstate, arg) on behalf of another thread
+   (see _PyRuntimeState_Handshake) */
+struct _Py_handshake {
+    _PyHandshakeFunc func;
+    void *arg;
+    int32_t state;
+};
+
 typedef struct PyThreadStateImpl {
     // semi-public fields are in PyThreadState
     PyThreadState tstate;
@@ -165,6 +177,13 @@ typedef struct PyThreadStateImpl {
     struct brc_state brc;
 
     struct qsbr *qsbr;
+
+    /* pending handshake, set and cleared with HEAD_LOCK held */
+    struct _Py_handshake *handshake;
+
+#ifdef Py_VM_STATS
+    struct _Py_vm_stats vm_stats;
+#endif
 } PyThreadStateImpl;
 
 PyAPI_FUNC(void) _PyThreadState_Init(
@@ -178,6 +197,24 @@ PyAPI_FUNC(void) _PyThreadState_GC_Park(PyThreadState *tstate);
 PyAPI_FUNC(void) _PyThreadState_GC_Stop(PyThreadState *tstate);
 PyAPI_FUNC(void) _PyThreadState_Signal(PyThreadState *tstate, uintptr_t bit);
 PyAPI_FUNC(void) _PyThreadState_Unsignal(PyThreadState *tstate, uintptr_t bit);
+PyAPI_FUNC(void) _PyThreadState_HandleHandshake(PyThreadState *tstate);
+
+/* Return the ids of all threads as a PyMem_RawMalloc()'ed array and set
+   *count. Return NULL with an exception set on memory error. */
+PyAPI_FUNC(unsigned long *) _PyRuntimeState_GetThreadIds(
+    _PyRuntimeState *runtime,
+    Py_ssize_t *count);
+
+/* Run func(tstate, arg) for the thread with the given id while that thread
+   is not running Python code: at its next eval breaker check, or in the
+   calling thread on its behalf if it is detached. Unlike a stop-the-world,
+   only the target thread is paused. Returns 1 once func has run, or 0 if
+   there is no such thread or it exited first. */
+PyAPI_FUNC(int) _PyRuntimeState_Handshake(
+    _PyRuntimeState *runtime,
+    unsigned long thread_id,
+    _PyHandshakeFunc func,
+    void *arg);
 
 PyAPI_FUNC(PyThreadState *) _PyThreadState_Swap(
     struct _gilstate_runtime_state *gilstate,
@@ -125,6 +125,9 @@ typedef struct pyruntimestate {
 
     _PyMutex stoptheworld_mutex;
 
+    /* Serializes _PyRuntimeState_Handshake() calls */
+    _PyMutex handshake_mutex;
+
     Py_ssize_t ref_total;
 
     PyTypeIdPool typeids;
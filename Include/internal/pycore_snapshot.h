@@ -0,0 +1,37 @@
+#ifndef Py_INTERNAL_SNAPSHOT_H
+#define Py_INTERNAL_SNAPSHOT_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef Py_BUILD_CORE
+#  error "this header requires Py_BUILD_CORE define"
+#endif
+
+/* Bytecode snapshots: the code objects of a set of modules, stored in a
+   file that is mapped into memory and relocated in place.  See
+   Python/snapshot.c. */
+
+typedef struct _PySnapshot _PySnapshot;
+
+/* Return the contents of a snapshot file for a sequence of
+   (source path, mtime, size, code) tuples. */
+extern PyObject* _PySnapshot_Dumps(PyObject *entries, long magic,
+                                    int optimize);
+
+/* Map a snapshot file.  Return NULL without an exception set if the file
+   can't be read or was written for another build; *reason is then set to
+   a static description of the problem. */
+extern _PySnapshot* _PySnapshot_Open(const char *path, long magic,
+                                     int optimize, const char **reason);
+extern void _PySnapshot_Close(_PySnapshot *snapshot);
+
+/* Return a new reference to the code object of the source file, or None
+   if the snapshot has no code for that file or the file changed since. */
+extern PyObject* _PySnapshot_GetCode(_PySnapshot *snapshot, PyObject *path,
+                                     long long mtime, long long size);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* !Py_INTERNAL_SNAPSHOT_H */
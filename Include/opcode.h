@@ -127,7 +127,15 @@ extern "C" {
     _(DICT_UPDATE,              116,     2,      6) \
     _(SETUP_ANNOTATIONS,        117,     1,      2) \
     _(SET_FUNC_ANNOTATIONS,     118,     2,      6) \
-    _(WIDE,                     119,     1,      2)
+    _(WIDE,                     119,     1,      2) \
+    _(STORE_FAST__LOAD_FAST,    120,     2,      6) \
+    _(STORE_FAST__LOAD_CONST,   121,     2,      6) \
+    _(LOAD_CONST__STORE_FAST,   122,     2,      6) \
+    _(COMPARE__POP_JUMP_IF_FALSE,  123,     3,     10) \
+    _(COMPARE__POP_JUMP_IF_TRUE,  124,     3,     10) \
+    _(CMETHOD_LIST_APPEND,      125,     1,      2) \
+    _(CMETHOD_DICT_GET,         126,     1,      2) \
+    _(CFUNC_LEN,                127,     1,      2)
 
 #define INTRINSIC_LIST(_) \
     _(PyObject_Str,                   1) \
@@ -66,6 +66,12 @@ _HAS_IPv6 = hasattr(socket, 'AF_INET6')
 # Maximum timeout passed to select to avoid OS limitations
 MAXIMUM_SELECT_TIMEOUT = 24 * 3600
 
+try:
+    # The C implementation of _run_once() is used outside of debug mode.
+    from _asyncio import _run_once as _c_run_once
+except ImportError:
+    _c_run_once = None
+
 # Used for deprecation and removal of `loop.create_datagram_endpoint()`'s
 # *reuse_address* parameter
 _unset = object()
@@ -412,6 +418,8 @@ class BaseEventLoop(events.AbstractEventLoop):
         self._asyncgens_shutdown_called = False
         # Set to True when `loop.shutdown_default_executor` is called.
         self._executor_shutdown_called = False
+        # The _asyncio.Worker of the loop when it is run by a Runtime.
+        self._worker = None
 
     def __repr__(self):
         return (
@@ -1819,6 +1827,13 @@ class BaseEventLoop(events.AbstractEventLoop):
         schedules the resulting callbacks, and finally schedules
         'call_later' callbacks.
         """
+        if self._worker is not None and not self._ready:
+            # Nothing to run: take runnable tasks from the other workers.
+            self._worker.steal()
+
+        if _c_run_once is not None and not self._debug:
+            _c_run_once(self)
+            return
 
         sched_count = len(self._scheduled)
         if (sched_count > _MIN_SCHEDULED_TIMER_HANDLES and
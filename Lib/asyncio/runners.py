@@ -1,7 +1,13 @@
-__all__ = 'run',
+__all__ = 'run', 'Runtime'
+
+import functools
+import os
+import threading
 
 from . import coroutines
 from . import events
+from . import exceptions
+from . import futures
 from . import tasks
 
 
@@ -72,3 +78,197 @@ def _cancel_all_tasks(loop):
                 'exception': task.exception(),
                 'task': task,
             })
+
+
+class Runtime:
+    """Run asyncio code on several event loops, one per worker thread.
+
+    Tasks started with spawn() are not bound to the loop that created
+    them: a worker with nothing to run takes runnable tasks from the
+    others, so independent coroutines are spread over all the workers.
+    Such tasks are moved between two of their steps; they must not keep
+    objects that belong to a loop, like futures, streams or transports,
+    across an await.  Code that needs a specific loop, like a server, can
+    be pinned to a worker.
+
+    Without the _asyncio extension module the workers don't share tasks.
+
+    Example:
+
+        async def main(runtime):
+            return await asyncio.gather(
+                *[runtime.spawn(compute(i)) for i in range(100)])
+
+        runtime = asyncio.Runtime(workers=4)
+        results = runtime.run(main(runtime))
+    """
+
+    def __init__(self, workers=None, *, debug=None):
+        if workers is None:
+            workers = os.cpu_count() or 1
+        if workers < 1:
+            raise ValueError('workers must be at least 1')
+        self._nworkers = workers
+        self._debug = debug
+        self._loops = None
+
+    @property
+    def workers(self):
+        """Number of worker threads, each running an event loop."""
+        return self._nworkers
+
+    def run(self, main):
+        """Execute the coroutine on the first worker and return the result.
+
+        The first worker is the calling thread.  The other workers are
+        started before the coroutine runs and stopped when it is done;
+        then the tasks still pending on any worker are cancelled and the
+        event loops are closed.
+        """
+        if events._get_running_loop() is not None:
+            raise RuntimeError(
+                "Runtime.run() cannot be called from a running event loop")
+        if not coroutines.iscoroutine(main):
+            raise ValueError("a coroutine was expected, got {!r}".format(main))
+        if self._loops is not None:
+            raise RuntimeError('this runtime is already running')
+
+        loops = [events.new_event_loop() for _ in range(self._nworkers)]
+        group = None
+        if _WorkerGroup is not None:
+            group = _WorkerGroup(loops)
+            for loop, worker in zip(loops, group.workers):
+                loop._worker = worker
+        if self._debug is not None:
+            for loop in loops:
+                loop.set_debug(self._debug)
+        self._loops = loops
+
+        threads = []
+        try:
+            events.set_event_loop(loops[0])
+            for i, loop in enumerate(loops[1:], 1):
+                thread = threading.Thread(target=loop.run_forever,
+                                          name=f'asyncio-worker-{i}')
+                thread.start()
+                threads.append(thread)
+            return loops[0].run_until_complete(main)
+        finally:
+            for loop, thread in zip(loops[1:], threads):
+                loop.call_soon_threadsafe(loop.stop)
+                thread.join()
+            if group is not None:
+                group.close()
+            try:
+                for loop in loops:
+                    _cancel_all_tasks(loop)
+                for loop in loops:
+                    loop.run_until_complete(loop.shutdown_asyncgens())
+                    loop.run_until_complete(loop.shutdown_default_executor())
+            finally:
+                events.set_event_loop(None)
+                for loop in loops:
+                    loop.close()
+                self._loops = None
+
+    def spawn(self, coro, *, name=None, worker=None):
+        """Run a coroutine in the runtime and return a future for its result.
+
+        Must be called from a loop of the runtime; the returned future
+        belongs to that loop.  Cancelling it cancels the coroutine.
+
+        The coroutine starts on the calling loop and may be moved to other
+        workers whenever it is suspended.  If *worker* is given, the
+        coroutine instead runs on the loop of that worker until it is done.
+        """
+        loop = events.get_running_loop()
+        if self._loops is None or loop not in self._loops:
+            raise RuntimeError('spawn() must be called from a loop '
+                               'of the runtime')
+        if not coroutines.iscoroutine(coro):
+            raise TypeError("a coroutine was expected, got {!r}".format(coro))
+
+        if worker is not None:
+            target = self._loops[worker]
+            if target is loop:
+                return loop.create_task(coro, name=name)
+            return futures.wrap_future(
+                tasks.run_coroutine_threadsafe(coro, target), loop=loop)
+
+        outer = loop.create_future()
+        coro = _run_spawned(coro, outer)
+        if loop._worker is not None:
+            task = loop._worker.create_task(coro, name=name)
+        else:
+            task = loop.create_task(coro, name=name)
+        outer.add_done_callback(functools.partial(_cancel_spawned, task))
+        return outer
+
+
+async def _run_spawned(coro, outer):
+    # The task running this coroutine may be on another thread than the
+    # loop of the outer future by the time it completes.
+    try:
+        result = await coro
+    except exceptions.CancelledError:
+        _call_in_loop(outer, _cancel)
+        raise
+    except (SystemExit, KeyboardInterrupt) as exc:
+        _call_in_loop(outer, _set_exception, exc)
+        raise
+    except BaseException as exc:
+        _call_in_loop(outer, _set_exception, exc)
+    else:
+        _call_in_loop(outer, _set_result, result)
+
+
+def _call_in_loop(fut, func, *args):
+    loop = fut.get_loop()
+    if events._get_running_loop() is loop:
+        func(fut, *args)
+    else:
+        try:
+            loop.call_soon_threadsafe(func, fut, *args)
+        except RuntimeError:
+            # The loop is closed
+            pass
+
+
+def _set_result(fut, result):
+    if not fut.done():
+        fut.set_result(result)
+
+
+def _set_exception(fut, exc):
+    if not fut.done():
+        fut.set_exception(exc)
+
+
+def _cancel(fut):
+    fut.cancel()
+
+
+def _cancel_spawned(task, outer):
+    if not outer.cancelled():
+        return
+    # Once pinned, the task stays on its loop and can be cancelled there.
+    loop = _pin_task(task)
+    if events._get_running_loop() is loop:
+        task.cancel()
+    else:
+        try:
+            loop.call_soon_threadsafe(task.cancel)
+        except RuntimeError:
+            # The loop is closed
+            pass
+
+
+def _py_pin_task(task):
+    return task.get_loop()
+
+
+try:
+    from _asyncio import WorkerGroup as _WorkerGroup, _pin_task
+except ImportError:
+    _WorkerGroup = None
+    _pin_task = _py_pin_task
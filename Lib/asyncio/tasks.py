@@ -42,23 +42,7 @@ def all_tasks(loop=None):
     """Return a set of all tasks for the loop."""
     if loop is None:
         loop = events.get_running_loop()
-    # Looping over a WeakSet (_all_tasks) isn't safe as it can be updated from another
-    # thread while we do so. Therefore we cast it to list prior to filtering. The list
-    # cast itself requires iteration, so we repeat it several times ignoring
-    # RuntimeErrors (which are not very likely to occur). See issues 34970 and 36607 for
-    # details.
-    i = 0
-    while True:
-        try:
-            tasks = list(_all_tasks)
-        except RuntimeError:
-            i += 1
-            if i >= 1000:
-                raise
-        else:
-            break
-    return {t for t in tasks
-            if futures._get_loop(t) is loop and not t.done()}
+    return {t for t in _registered_tasks(loop) if not t.done()}
 
 
 def _all_tasks_compat(loop=None):
@@ -67,6 +51,10 @@ def _all_tasks_compat(loop=None):
     # method.
     if loop is None:
         loop = events.get_event_loop()
+    return set(_registered_tasks(loop))
+
+
+def _registered_tasks(loop):
     # Looping over a WeakSet (_all_tasks) isn't safe as it can be updated from another
     # thread while we do so. Therefore we cast it to list prior to filtering. The list
     # cast itself requires iteration, so we repeat it several times ignoring
@@ -82,7 +70,11 @@ def _all_tasks_compat(loop=None):
                 raise
         else:
             break
-    return {t for t in tasks if futures._get_loop(t) is loop}
+    tasks = [t for t in tasks if futures._get_loop(t) is loop]
+    if _linked_tasks is not None:
+        # C tasks are kept by the _asyncio module, not in _all_tasks.
+        tasks.extend(_linked_tasks(loop))
+    return tasks
 
 
 def _set_task_name(task, name):
@@ -938,6 +930,9 @@ def run_coroutine_threadsafe(coro, loop):
 # WeakSet containing all alive tasks.
 _all_tasks = weakref.WeakSet()
 
+# Returns the C tasks of a loop, see _registered_tasks().
+_linked_tasks = None
+
 # Dictionary containing tasks that are currently active in
 # all running event loops.  {EventLoop: Task}
 _current_tasks = {}
@@ -978,7 +973,7 @@ _py_leave_task = _leave_task
 try:
     from _asyncio import (_register_task, _unregister_task,
                           _enter_task, _leave_task,
-                          _all_tasks, _current_tasks)
+                          _all_tasks, _current_tasks, _linked_tasks)
 except ImportError:
     pass
 else:
@@ -390,6 +390,9 @@ def _get_instructions_bytes(code, varnames=None, constants=None,
             if starts_line is not None:
                 starts_line += line_offset
         is_jump_target = offset in labels
+        if op in superinstructions:
+            # Show the first instruction of the pair; the second one follows
+            op = superinstructions[op][0]
         bytecode = opcodes[op]
         argval, argrepr = get_repr(bytecode, *imm)
         yield Instruction(opname[op], op,
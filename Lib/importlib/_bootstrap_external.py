@@ -338,6 +338,7 @@ _code_type = type(_write_atomic.__code__)
 #     Python 3.9a2  3424 (simplify bytecodes for *value unpacking)
 #     Python 3.9a2  3425 (simplify bytecodes for **value unpacking)
 #     Python 3.9    9001 (nogil Python - new bytecode format)
+#     Python 3.9    9003 (superinstructions)
 
 #
 # MAGIC must change whenever the bytecode emitted by the compiler may no
@@ -347,9 +348,14 @@ _code_type = type(_write_atomic.__code__)
 # Whenever MAGIC_NUMBER is changed, the ranges in the magic_values array
 # in PC/launcher.c must also be updated.
 
-MAGIC_NUMBER = (9002).to_bytes(2, 'little') + b'\r\n'
+MAGIC_NUMBER = (9003).to_bytes(2, 'little') + b'\r\n'
 _RAW_MAGIC_NUMBER = int.from_bytes(MAGIC_NUMBER, 'little')  # For import.c
 
+# Code objects that importlib.util.prefetch() read while looking for the
+# imports of modules, by source path, with the mtime of the source.  It is
+# about to import these modules.
+_prefetched_code = {}
+
 _PYCACHE = '__pycache__'
 _OPT = 'opt-'
 
@@ -938,6 +944,17 @@ class SourceLoader(_LoaderBasics):
                 pass
             else:
                 source_mtime = int(st['mtime'])
+                prefetched = _prefetched_code.pop(source_path, None)
+                if prefetched is not None and prefetched[0] == source_mtime:
+                    _bootstrap._verbose_message('code object prefetched for '
+                                                '{!r}', source_path)
+                    return prefetched[1]
+                code_object = _imp._snapshot_code(source_path, source_mtime,
+                                                  st.get('size', -1))
+                if code_object is not None:
+                    _bootstrap._verbose_message('code object from snapshot '
+                                                'for {!r}', source_path)
+                    return code_object
                 try:
                     data = self.get_data(bytecode_path)
                 except OSError:
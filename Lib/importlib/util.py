@@ -1,5 +1,7 @@
 """Utility code for constructing importers, etc."""
 from . import abc
+from . import _bootstrap
+from . import _bootstrap_external
 from ._bootstrap import module_from_spec
 from ._bootstrap import _resolve_name
 from ._bootstrap import spec_from_loader
@@ -13,12 +15,15 @@ from ._bootstrap_external import spec_from_file_location
 
 from contextlib import contextmanager
 import _imp
+import _thread
 import functools
 import sys
 import types
 import warnings
 
 
+_CO_OPTIMIZED = 0x0001
+
 def source_hash(source_bytes):
     "Return the hash of *source_bytes* as used in hash-based pyc files."
     return _imp.source_hash(_RAW_MAGIC_NUMBER, source_bytes)
@@ -115,6 +120,290 @@ def find_spec(name, package=None):
             return spec
 
 
+def _find_spec_unimported(name, specs):
+    """Return the spec of a module without importing its parent packages,
+    or None.  specs caches the specs found so far."""
+    try:
+        return specs[name]
+    except KeyError:
+        pass
+    parent_name = name.rpartition('.')[0]
+    path = None
+    if parent_name:
+        parent = _find_spec_unimported(parent_name, specs)
+        path = parent and parent.submodule_search_locations
+    spec = None
+    if path is not None or not parent_name:
+        try:
+            spec = _find_spec_from_path(name, path)
+        except (ImportError, ValueError):
+            pass
+    specs[name] = spec
+    return spec
+
+
+def _code_imports(spec, prefetched):
+    """Return the names of the modules that the code of a module imports
+    when it is executed, outside of functions.  The code of source modules
+    is kept for their import, and their paths are added to prefetched."""
+    loader = spec.loader
+    try:
+        if isinstance(loader, _bootstrap_external.SourceLoader):
+            mtime = int(loader.path_stats(spec.origin)['mtime'])
+        code = loader.get_code(spec.name)
+    except Exception:
+        return []
+    if isinstance(loader, _bootstrap_external.SourceLoader):
+        _bootstrap_external._prefetched_code[spec.origin] = (mtime, code)
+        prefetched.append(spec.origin)
+    if spec.submodule_search_locations is not None:
+        package = spec.name
+    else:
+        package = spec.parent
+    names = []
+    codes = [code]
+    for code in codes:
+        if code is None:
+            continue
+        for const in code.co_consts:
+            if isinstance(const, types.CodeType):
+                # Class bodies run at import time, function bodies don't
+                if not const.co_flags & _CO_OPTIMIZED:
+                    codes.append(const)
+                continue
+            # The (name, fromlist, level) operand of IMPORT_NAME
+            if not (type(const) is tuple and len(const) == 3 and
+                    type(const[0]) is str and
+                    (const[1] is None or type(const[1]) is tuple) and
+                    type(const[2]) is int):
+                continue
+            base, fromlist, level = const
+            if level:
+                try:
+                    base = _resolve_name(base, package, level)
+                except (ImportError, ValueError):
+                    continue
+            names.append(base)
+            # "from package import submodule"
+            names.extend(base + '.' + name for name in fromlist or ()
+                         if type(name) is str and name != '*')
+    return names
+
+
+def _read_import_trace(path):
+    """Return {module: [modules imported while executing it]} for the
+    standard error output of "python -X importtime"."""
+    graph = {}
+    children = {}
+    with open(path, encoding='utf-8') as file:
+        for line in file:
+            fields = line.rstrip('\n').split('|')
+            if len(fields) != 3 or not fields[0].startswith('import time:'):
+                continue
+            if not fields[1].strip().isdigit():
+                # The header line
+                continue
+            name = fields[2].strip()
+            depth = len(fields[2]) - len(fields[2].lstrip(' '))
+            # A module is listed after the ones imported while it runs,
+            # which are nested one level deeper
+            graph[name] = children.pop(depth + 2, [])
+            children.setdefault(depth, []).append(name)
+    return graph
+
+
+def _strongly_connected(graph):
+    """Return the strongly connected components of a dependency graph,
+    dependencies first, each in the order of the graph."""
+    index = {}
+    low = {}
+    stack = []
+    on_stack = set()
+    components = []
+    for root in graph:
+        if root in index:
+            continue
+        index[root] = low[root] = len(index)
+        stack.append(root)
+        on_stack.add(root)
+        work = [(root, iter(graph[root]))]
+        while work:
+            node, deps = work[-1]
+            for dep in deps:
+                if dep not in graph:
+                    continue
+                if dep not in index:
+                    index[dep] = low[dep] = len(index)
+                    stack.append(dep)
+                    on_stack.add(dep)
+                    work.append((dep, iter(graph[dep])))
+                    break
+                if dep in on_stack:
+                    low[node] = min(low[node], index[dep])
+            else:
+                work.pop()
+                if work:
+                    parent = work[-1][0]
+                    low[parent] = min(low[parent], low[node])
+                if low[node] == index[node]:
+                    component = []
+                    while True:
+                        member = stack.pop()
+                        on_stack.discard(member)
+                        component.append(member)
+                        if member == node:
+                            break
+                    component.sort(key=index.__getitem__)
+                    components.append(component)
+    return components
+
+
+class _WorkerPool:
+    """Threads running functions that may submit more functions."""
+
+    def __init__(self, max_workers):
+        import threading
+        self._threading = threading
+        self._max_workers = max_workers
+        self._cond = threading.Condition()
+        self._work = []
+        self._pending = 0
+
+    def submit(self, func, *args):
+        with self._cond:
+            self._work.append((func, args))
+            self._pending += 1
+            self._cond.notify()
+
+    def _worker(self):
+        while True:
+            with self._cond:
+                while not self._work and self._pending:
+                    self._cond.wait()
+                if not self._pending:
+                    return
+                func, args = self._work.pop()
+            try:
+                func(*args)
+            finally:
+                with self._cond:
+                    self._pending -= 1
+                    if not self._pending:
+                        self._cond.notify_all()
+
+    def run(self):
+        """Run the functions submitted until there are none left."""
+        threads = [self._threading.Thread(target=self._worker)
+                   for _ in range(min(self._max_workers, self._pending))]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+
+def prefetch(names=(), *, trace=None, max_workers=None):
+    """Import modules and the modules they import on a pool of threads.
+
+    The modules that the modules named in *names* import, recursively, are
+    found by looking at their code, and *trace* is the name of a file with
+    the standard error output of "python -X importtime", whose nesting tells
+    which module imported which.  Every module is imported after the modules
+    it imports, so that independent modules load at the same time.  A module
+    that fails to import is left to the program to import.
+
+    """
+    if max_workers is None:
+        import os
+        max_workers = os.cpu_count() or 1
+    if max_workers <= 0:
+        raise ValueError('max_workers must be greater than 0')
+
+    graph = {}
+    prefetched = []
+    if trace is not None:
+        graph.update(_read_import_trace(trace))
+    if names:
+        specs = {}
+        lock = _thread.allocate_lock()
+        pool = _WorkerPool(max_workers)
+        seen = set(names)
+
+        def scan(name):
+            spec = _find_spec_unimported(name, specs)
+            if spec is None:
+                return
+            deps = []
+            if spec.has_location and name not in sys.modules:
+                deps = [dep for dep in _code_imports(spec, prefetched)
+                        if dep not in sys.modules and
+                        _find_spec_unimported(dep, specs) is not None]
+            with lock:
+                graph.setdefault(name, []).extend(deps)
+                for dep in deps:
+                    if dep not in seen:
+                        seen.add(dep)
+                        pool.submit(scan, dep)
+
+        for name in dict.fromkeys(names):
+            pool.submit(scan, name)
+        pool.run()
+
+    # The parent packages of a module are imported before it
+    names = list(graph)
+    for name in names:
+        parent = name.rpartition('.')[0]
+        if parent:
+            graph[name].append(parent)
+            if parent not in graph:
+                graph[parent] = []
+                names.append(parent)
+    graph = {name: deps for name, deps in graph.items()
+             if name not in sys.modules}
+
+    components = _strongly_connected(graph)
+    component_of = {}
+    for component in components:
+        for name in component:
+            component_of[name] = component
+    waiting = {}
+    dependents = {}
+    for component in components:
+        deps = {id(component_of[dep]) for name in component
+                for dep in graph[name] if dep in component_of}
+        deps.discard(id(component))
+        waiting[id(component)] = len(deps)
+        for dep in deps:
+            dependents.setdefault(dep, []).append(component)
+    lock = _thread.allocate_lock()
+    pool = _WorkerPool(max_workers)
+
+    def load(component):
+        for name in component:
+            try:
+                _bootstrap._gcd_import(name)
+            except Exception as exc:
+                _bootstrap._verbose_message('prefetch of {} failed: {!r}',
+                                            name, exc)
+        ready = []
+        with lock:
+            for dependent in dependents.get(id(component), ()):
+                waiting[id(dependent)] -= 1
+                if not waiting[id(dependent)]:
+                    ready.append(dependent)
+        for dependent in ready:
+            pool.submit(load, dependent)
+
+    for component in components:
+        if not waiting[id(component)]:
+            pool.submit(load, component)
+    try:
+        pool.run()
+    finally:
+        # Drop the code of the modules that failed to import
+        for path in prefetched:
+            _bootstrap_external._prefetched_code.pop(path, None)
+
+
 @contextmanager
 def _module_to_load(name):
     is_reload = name in sys.modules
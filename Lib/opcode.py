@@ -5,10 +5,11 @@ bytecodes = []
 opcodes = [None] * 256
 intrinsics = [None] * 256
 intrinsic_map = {}
+superinstructions = {}
 
 __all__ = [
     "cmp_op", "opname", "opmap", "opcodes", "bytecodes", "intrinsics",
-    "intrinsic_map",
+    "intrinsic_map", "superinstructions",
 ]
 
 class Bytecode:
@@ -33,7 +34,9 @@ class Bytecode:
 
     @property
     def has_wide(self):
-        return len(self.imm) > 0 and self.name not in ('WIDE', 'JUMP_SIDE_TABLE')
+        return (len(self.imm) > 0 and
+                self.name not in ('WIDE', 'JUMP_SIDE_TABLE') and
+                self.opcode not in superinstructions)
 
     @property
     def wide_size(self):
@@ -55,6 +58,12 @@ def def_op(name, opcode, *imm):
     opname[opcode] = name
     opcodes[opcode] = bytecode
 
+def def_super_op(name, opcode, first, second):
+    # A superinstruction replaces the opcode of the first instruction of a
+    # pair and keeps its immediates; the second instruction is left as is.
+    superinstructions[opcode] = (opmap[first], opmap[second])
+    def_op(name, opcode, *opcodes[opmap[first]].imm)
+
 def def_intrinsic(name, code, nargs=1):
     assert nargs == 'N' or isinstance(nargs, int)
     intrinsic = Intrinsic(name, code, nargs)
@@ -199,6 +208,22 @@ def_op('SETUP_ANNOTATIONS', 117)
 def_op('SET_FUNC_ANNOTATIONS', 118, 'reg')
 def_op('WIDE', 119)
 
+# Superinstructions, substituted by the compiler for the most frequently
+# executed pairs (see Tools/vmbench/vmbench.py --pairs). They have no wide
+# forms.
+def_super_op('STORE_FAST__LOAD_FAST', 120, 'STORE_FAST', 'LOAD_FAST')
+def_super_op('STORE_FAST__LOAD_CONST', 121, 'STORE_FAST', 'LOAD_CONST')
+def_super_op('LOAD_CONST__STORE_FAST', 122, 'LOAD_CONST', 'STORE_FAST')
+def_super_op('COMPARE__POP_JUMP_IF_FALSE', 123, 'COMPARE_OP', 'POP_JUMP_IF_FALSE')
+def_super_op('COMPARE__POP_JUMP_IF_TRUE', 124, 'COMPARE_OP', 'POP_JUMP_IF_TRUE')
+
+# Headers of hot builtins that are run inline in the interpreter loop. They
+# are only installed as the first_instr of the builtin's function object (see
+# vm_specialize_builtins) and never appear in code objects.
+def_op('CMETHOD_LIST_APPEND', 125)
+def_op('CMETHOD_DICT_GET', 126)
+def_op('CFUNC_LEN', 127)
+
 def_intrinsic('PyObject_Str', 1)
 def_intrinsic('PyObject_Repr', 2)
 def_intrinsic('PyObject_ASCII', 3)
@@ -211,4 +236,4 @@ def_intrinsic('vm_exc_set_cause', 9, nargs=2)
 def_intrinsic('vm_print', 10)
 def_intrinsic('_PyAsyncGenValueWrapperNew', 11)
 
-del def_op, def_intrinsic
+del def_op, def_super_op, def_intrinsic
@@ -407,7 +407,7 @@ def decode_long(data):
 class _Pickler:
 
     def __init__(self, file, protocol=None, *, fix_imports=True,
-                 buffer_callback=None):
+                 buffer_callback=None, threads=1):
         """This takes a binary file for writing a pickle data stream.
 
         The optional *protocol* argument tells the pickler to use the
@@ -440,6 +440,10 @@ class _Pickler:
 
         It is an error if *buffer_callback* is not None and *protocol*
         is None or smaller than 5.
+
+        If *threads* is greater than 1, the C implementation pickles
+        the items of large lists and dicts on several threads.  This
+        implementation accepts the argument but always pickles serially.
         """
         if protocol is None:
             protocol = DEFAULT_PROTOCOL
@@ -449,6 +453,8 @@ class _Pickler:
             raise ValueError("pickle protocol must be <= %d" % HIGHEST_PROTOCOL)
         if buffer_callback is not None and protocol < 5:
             raise ValueError("buffer_callback needs protocol >= 5")
+        if threads < 1:
+            raise ValueError("threads must be at least 1")
         self._buffer_callback = buffer_callback
         try:
             self._file_write = file.write
@@ -1136,7 +1142,8 @@ class _Pickler:
 class _Unpickler:
 
     def __init__(self, file, *, fix_imports=True,
-                 encoding="ASCII", errors="strict", buffers=None):
+                 encoding="ASCII", errors="strict", buffers=None,
+                 zero_copy=False):
         """This takes a binary file for reading a pickle data stream.
 
         The protocol version of the pickle is detected automatically, so
@@ -1165,6 +1172,12 @@ class _Unpickler:
         It is an error for *buffers* to be None if the pickle stream
         was produced with a non-None *buffer_callback*.
 
+        If *zero_copy* is true, bytes and bytearray objects serialized
+        with protocol 3 or higher are returned as memoryviews.  The C
+        implementation makes these views borrow directly from the data
+        passed to loads() instead of copying it; this implementation
+        always copies.
+
         Other optional arguments are *fix_imports*, *encoding* and
         *errors*, which are used to control compatibility support for
         pickle stream generated by Python 2.  If *fix_imports* is True,
@@ -1175,6 +1188,7 @@ class _Unpickler:
         'bytes' to read these 8-bit string instances as bytes objects.
         """
         self._buffers = iter(buffers) if buffers is not None else None
+        self._zero_copy = zero_copy
         self._file_readline = file.readline
         self._file_read = file.read
         self.memo = {}
@@ -1351,7 +1365,7 @@ class _Unpickler:
         if len > maxsize:
             raise UnpicklingError("BINBYTES exceeds system's maximum size "
                                   "of %d bytes" % maxsize)
-        self.append(self.read(len))
+        self._append_bytes(self.read(len))
     dispatch[BINBYTES[0]] = load_binbytes
 
     def load_unicode(self):
@@ -1379,7 +1393,7 @@ class _Unpickler:
         if len > maxsize:
             raise UnpicklingError("BINBYTES8 exceeds system's maximum size "
                                   "of %d bytes" % maxsize)
-        self.append(self.read(len))
+        self._append_bytes(self.read(len))
     dispatch[BINBYTES8[0]] = load_binbytes8
 
     def load_bytearray8(self):
@@ -1389,7 +1403,7 @@ class _Unpickler:
                                   "of %d bytes" % maxsize)
         b = bytearray(len)
         self.readinto(b)
-        self.append(b)
+        self._append_bytes(b)
     dispatch[BYTEARRAY8[0]] = load_bytearray8
 
     def load_next_buffer(self):
@@ -1418,9 +1432,14 @@ class _Unpickler:
 
     def load_short_binbytes(self):
         len = self.read(1)[0]
-        self.append(self.read(len))
+        self._append_bytes(self.read(len))
     dispatch[SHORT_BINBYTES[0]] = load_short_binbytes
 
+    def _append_bytes(self, b):
+        if self._zero_copy:
+            b = memoryview(b)
+        self.append(b)
+
     def load_short_binunicode(self):
         len = self.read(1)[0]
         self.append(str(self.read(len), 'utf-8', 'surrogatepass'))
@@ -1746,30 +1765,34 @@ class _Unpickler:
 
 # Shorthands
 
-def _dump(obj, file, protocol=None, *, fix_imports=True, buffer_callback=None):
+def _dump(obj, file, protocol=None, *, fix_imports=True, buffer_callback=None,
+          threads=1):
     _Pickler(file, protocol, fix_imports=fix_imports,
-             buffer_callback=buffer_callback).dump(obj)
+             buffer_callback=buffer_callback, threads=threads).dump(obj)
 
-def _dumps(obj, protocol=None, *, fix_imports=True, buffer_callback=None):
+def _dumps(obj, protocol=None, *, fix_imports=True, buffer_callback=None,
+           threads=1):
     f = io.BytesIO()
     _Pickler(f, protocol, fix_imports=fix_imports,
-             buffer_callback=buffer_callback).dump(obj)
+             buffer_callback=buffer_callback, threads=threads).dump(obj)
     res = f.getvalue()
     assert isinstance(res, bytes_types)
     return res
 
 def _load(file, *, fix_imports=True, encoding="ASCII", errors="strict",
-          buffers=None):
+          buffers=None, zero_copy=False):
     return _Unpickler(file, fix_imports=fix_imports, buffers=buffers,
-                     encoding=encoding, errors=errors).load()
+                     encoding=encoding, errors=errors,
+                     zero_copy=zero_copy).load()
 
 def _loads(s, /, *, fix_imports=True, encoding="ASCII", errors="strict",
-           buffers=None):
+           buffers=None, zero_copy=False):
     if isinstance(s, str):
         raise TypeError("Can't load pickle from unicode string")
     file = io.BytesIO(s)
     return _Unpickler(file, fix_imports=fix_imports, buffers=buffers,
-                      encoding=encoding, errors=errors).load()
+                      encoding=encoding, errors=errors,
+                      zero_copy=zero_copy).load()
 
 # Use the faster _pickle if possible
 try:
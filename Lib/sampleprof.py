@@ -0,0 +1,182 @@
+"""Statistical profiler sampling the Python stacks of all threads.
+
+A background thread periodically pauses each thread in turn, just long
+enough to walk its stack, and counts identical stacks. Unlike cProfile, the
+profiled code runs at full speed between samples.
+
+    with sampleprof.Profile(hz=100) as prof:
+        work()
+    prof.write_collapsed('work.folded')
+
+The collapsed stack format is read by flamegraph.pl, speedscope and most
+other flame graph tools.
+"""
+
+__all__ = ["Profile", "run", "runctx"]
+
+import _sampleprof
+import sys
+import threading
+
+
+class Profile:
+    """Profile(hz=100)
+
+    Sample the stacks of all threads *hz* times per second between start()
+    and stop(). Only one Profile can run at a time.
+    """
+
+    _running = None
+    _running_lock = threading.Lock()
+
+    def __init__(self, hz=100):
+        if hz <= 0:
+            raise ValueError("hz must be positive")
+        self.hz = hz
+        self.stacks = {}
+        self._stop = None
+        self._thread = None
+
+    def start(self):
+        with Profile._running_lock:
+            if Profile._running is not None:
+                raise RuntimeError("another profile is already running")
+            Profile._running = self
+        _sampleprof.clear()
+        self._stop = threading.Event()
+        self._thread = threading.Thread(target=self._sample_loop,
+                                        name='sampleprof', daemon=True)
+        self._thread.start()
+
+    def stop(self):
+        if self._thread is None:
+            raise RuntimeError("the profile is not running")
+        self._stop.set()
+        self._thread.join()
+        self._thread = None
+        stacks = _sampleprof.get_stacks()
+        _sampleprof.clear()
+        with Profile._running_lock:
+            Profile._running = None
+        for stack, count in stacks.items():
+            self.stacks[stack] = self.stacks.get(stack, 0) + count
+
+    def __enter__(self):
+        self.start()
+        return self
+
+    def __exit__(self, *exc_info):
+        self.stop()
+
+    def _sample_loop(self):
+        interval = 1.0 / self.hz
+        while not self._stop.wait(interval):
+            _sampleprof.sample()
+
+    def collapsed(self):
+        """Return the samples in the collapsed stack format.
+
+        One line per distinct stack: the frames, outermost first, separated
+        by semicolons, then a space and the number of samples.
+        """
+        lines = []
+        for stack, count in self.stacks.items():
+            frames = ';'.join('%s (%s:%d)' % (name, filename, lineno)
+                              for filename, name, lineno in stack)
+            lines.append('%s %d\n' % (frames, count))
+        lines.sort()
+        return ''.join(lines)
+
+    def write_collapsed(self, file):
+        """Write the samples in the collapsed stack format to *file*."""
+        with open(file, 'w', encoding='utf-8') as f:
+            f.write(self.collapsed())
+
+    def run(self, cmd):
+        import __main__
+        dict = __main__.__dict__
+        return self.runctx(cmd, dict, dict)
+
+    def runctx(self, cmd, globals, locals):
+        with self:
+            exec(cmd, globals, locals)
+        return self
+
+
+def run(statement, filename=None, hz=100):
+    """Run *statement* under the sampling profiler.
+
+    Write the collapsed stacks to *filename*, or to stdout if it is None.
+    """
+    import __main__
+    dict = __main__.__dict__
+    return runctx(statement, dict, dict, filename, hz)
+
+def runctx(statement, globals, locals, filename=None, hz=100):
+    """Like run(), with explicit globals and locals."""
+    prof = Profile(hz)
+    try:
+        prof.runctx(statement, globals, locals)
+    except SystemExit:
+        pass
+    finally:
+        if filename is not None:
+            prof.write_collapsed(filename)
+        else:
+            sys.stdout.write(prof.collapsed())
+    return prof
+
+
+def main():
+    import os
+    import runpy
+    from optparse import OptionParser
+    usage = ("sampleprof.py [-o output_file_path] [-r hz] "
+             "[-m module | scriptfile] [arg] ...")
+    parser = OptionParser(usage=usage)
+    parser.allow_interspersed_args = False
+    parser.add_option('-o', '--outfile', dest="outfile",
+        help="Save collapsed stacks to <outfile>", default=None)
+    parser.add_option('-r', '--rate', dest="hz", type="float",
+        help="Samples per second (default: 100)", default=100)
+    parser.add_option('-m', dest="module", action="store_true",
+        help="Profile a library module", default=False)
+
+    if not sys.argv[1:]:
+        parser.print_usage()
+        sys.exit(2)
+
+    (options, args) = parser.parse_args()
+    sys.argv[:] = args
+
+    # The script that we're profiling may chdir, so capture the absolute path
+    # to the output file at startup.
+    if options.outfile is not None:
+        options.outfile = os.path.abspath(options.outfile)
+
+    if len(args) > 0:
+        if options.module:
+            code = "run_module(modname, run_name='__main__')"
+            globs = {
+                'run_module': runpy.run_module,
+                'modname': args[0]
+            }
+        else:
+            progname = args[0]
+            sys.path.insert(0, os.path.dirname(progname))
+            with open(progname, 'rb') as fp:
+                code = compile(fp.read(), progname, 'exec')
+            globs = {
+                '__file__': progname,
+                '__name__': '__main__',
+                '__package__': None,
+                '__cached__': None,
+            }
+        runctx(code, globs, None, options.outfile, options.hz)
+    else:
+        parser.print_usage()
+    return parser
+
+# When invoked as main program, invoke the profiler on a script
+if __name__ == '__main__':
+    main()
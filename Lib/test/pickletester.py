@@ -1830,6 +1830,55 @@ class AbstractPickleTests:
                 p = self.dumps(s, proto)
                 self.assert_is_copy(s, self.loads(p))
 
+    def test_parallel_containers(self):
+        records = [{'id': i, 'name': 'x%d' % i, 'tags': ('a', 'b')}
+                   for i in range(10000)]
+        table = {'k%d' % i: [i, float(i)] for i in range(10000)}
+        for proto in protocols:
+            for obj in records, table:
+                for threads in 1, 4:
+                    s = self.dumps(obj, proto, threads=threads)
+                    self.assert_is_copy(obj, self.loads(s))
+        with self.assertRaises(ValueError):
+            self.dumps([], threads=0)
+
+    def test_parallel_shared_references(self):
+        shared = [0]
+        before = ['before']
+        items = [[before, shared if i % 3000 == 0 else i]
+                 for i in range(10000)]
+        # Only shared between items after the first batch
+        items[2000] = items[8000] = [1]
+        items.append(items)
+        obj = [before, items, items[-2]]
+        for proto in protocols:
+            s = self.dumps(obj, proto, threads=4)
+            before2, items2, last2 = self.loads(s)
+            self.assertEqual(items2[:-1], items[:-1])
+            self.assertIs(items2[-1], items2)
+            self.assertIs(items2[0][0], before2)
+            self.assertIs(items2[3000][1], items2[9000][1])
+            self.assertIs(items2[2000], items2[8000])
+            self.assertIs(items2[-2], last2)
+
+    def test_bytes_zero_copy(self):
+        for proto in range(3, pickle.HIGHEST_PROTOCOL + 1):
+            for s in b'', b'xyz', b'xyz'*100:
+                p = self.dumps(s, proto)
+                v = self.loads(p, zero_copy=True)
+                self.assertIsInstance(v, memoryview)
+                self.assertTrue(v.readonly)
+                self.assertEqual(v, s)
+            # Only BINBYTES payloads are affected
+            t = self.loads(self.dumps((b'abc', 'abc', b'abc'), proto),
+                           zero_copy=True)
+            self.assertEqual([type(x) for x in t], [memoryview, str, memoryview])
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            b = bytearray(b'xyz'*100)
+            v = self.loads(self.dumps(b, proto), zero_copy=True)
+            self.assertIsInstance(v, memoryview)
+            self.assertEqual(v, b)
+
     def test_bytearray(self):
         for proto in protocols:
             for s in b'', b'xyz', b'xyz'*100:
@@ -993,6 +993,17 @@ class BaseEventLoopTests(test_utils.TestCase):
             self.assertTrue(status['finalized'])
 
 
+class PyRunOnceBaseEventLoopTests(BaseEventLoopTests):
+    # BaseEventLoopTests exercise the C _run_once() when it is available;
+    # run them again against the pure Python implementation.
+
+    def setUp(self):
+        super().setUp()
+        patcher = mock.patch('asyncio.base_events._c_run_once', None)
+        patcher.start()
+        self.addCleanup(patcher.stop)
+
+
 class MyProto(asyncio.Protocol):
     done = None
 
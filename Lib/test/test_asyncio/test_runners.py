@@ -1,9 +1,16 @@
 import asyncio
+import threading
+import time
 import unittest
 
 from unittest import mock
 from . import utils as test_utils
 
+try:
+    import _asyncio
+except ImportError:
+    _asyncio = None
+
 
 class TestPolicy(asyncio.AbstractEventLoopPolicy):
 
@@ -180,3 +187,222 @@ class RunTests(BaseTest):
 
         self.assertIsNone(spinner.ag_frame)
         self.assertFalse(spinner.ag_running)
+
+
+class RuntimeTests(unittest.TestCase):
+
+    def tearDown(self):
+        asyncio.set_event_loop_policy(None)
+        super().tearDown()
+
+    def test_runtime_run_return(self):
+        async def main():
+            await asyncio.sleep(0)
+            return 42
+
+        self.assertEqual(asyncio.Runtime(2).run(main()), 42)
+
+    def test_runtime_run_raises(self):
+        async def main():
+            await asyncio.sleep(0)
+            raise ValueError('spam')
+
+        with self.assertRaisesRegex(ValueError, 'spam'):
+            asyncio.Runtime(2).run(main())
+
+    def test_runtime_invalid_arguments(self):
+        with self.assertRaises(ValueError):
+            asyncio.Runtime(0)
+        with self.assertRaisesRegex(ValueError, 'a coroutine was expected'):
+            asyncio.Runtime(2).run(None)
+
+    def test_runtime_run_from_running_loop(self):
+        async def main():
+            coro = main()
+            try:
+                asyncio.Runtime(2).run(coro)
+            finally:
+                coro.close()  # Suppress ResourceWarning
+
+        with self.assertRaisesRegex(RuntimeError,
+                                    'cannot be called from a running'):
+            asyncio.run(main())
+
+    def test_spawn_results(self):
+        async def square(i):
+            await asyncio.sleep(0)
+            if i == 3:
+                raise ValueError(i)
+            return i * i
+
+        async def main(runtime):
+            return await asyncio.gather(
+                *[runtime.spawn(square(i)) for i in range(5)],
+                return_exceptions=True)
+
+        runtime = asyncio.Runtime(3)
+        results = runtime.run(main(runtime))
+        self.assertEqual(results[:3], [0, 1, 4])
+        self.assertIsInstance(results[3], ValueError)
+        self.assertEqual(results[4], 16)
+
+    def test_spawn_outside_runtime(self):
+        async def main(runtime):
+            coro = asyncio.sleep(0)
+            try:
+                runtime.spawn(coro)
+            finally:
+                coro.close()
+
+        with self.assertRaisesRegex(RuntimeError, 'loop of the runtime'):
+            asyncio.run(main(asyncio.Runtime(2)))
+
+    @unittest.skipIf(_asyncio is None, 'requires the C _asyncio module')
+    def test_spawn_moves_tasks(self):
+        threads = set()
+
+        async def work():
+            for _ in range(20):
+                threads.add(threading.get_ident())
+                # Keep this worker busy so that the others take tasks
+                time.sleep(0.001)
+                await asyncio.sleep(0)
+
+        async def main(runtime):
+            await asyncio.gather(*[runtime.spawn(work()) for _ in range(40)])
+
+        runtime = asyncio.Runtime(4)
+        runtime.run(main(runtime))
+        self.assertGreater(len(threads), 1)
+
+    def test_spawn_cancel(self):
+        started = threading.Event()
+        cancelled = threading.Event()
+
+        async def forever():
+            started.set()
+            try:
+                while True:
+                    await asyncio.sleep(0)
+            except asyncio.CancelledError:
+                cancelled.set()
+                raise
+
+        async def main(runtime):
+            fut = runtime.spawn(forever())
+            while not started.is_set():
+                await asyncio.sleep(0)
+            fut.cancel()
+            with self.assertRaises(asyncio.CancelledError):
+                await fut
+            while not cancelled.is_set():
+                await asyncio.sleep(0.001)
+
+        runtime = asyncio.Runtime(2)
+        runtime.run(main(runtime))
+        self.assertTrue(cancelled.is_set())
+
+    def test_spawn_on_worker(self):
+        async def running_loop():
+            return asyncio.get_running_loop(), threading.get_ident()
+
+        async def main(runtime):
+            return await asyncio.gather(
+                *[runtime.spawn(running_loop(), worker=i)
+                  for i in range(runtime.workers)])
+
+        runtime = asyncio.Runtime(3)
+        results = runtime.run(main(runtime))
+        self.assertEqual(len({id(loop) for loop, _ in results}), 3)
+        self.assertEqual(len({ident for _, ident in results}), 3)
+        self.assertEqual(results[0][1], threading.get_ident())
+
+    def test_runtime_cancels_pending_tasks(self):
+        cancelled = threading.Event()
+
+        async def forever():
+            try:
+                await asyncio.sleep(3600)
+            except asyncio.CancelledError:
+                cancelled.set()
+                raise
+
+        async def main(runtime):
+            runtime.spawn(forever())
+            runtime.spawn(forever(), worker=1)
+            await asyncio.sleep(0)
+
+        runtime = asyncio.Runtime(2)
+        runtime.run(main(runtime))
+        self.assertTrue(cancelled.is_set())
+
+
+@unittest.skipIf(_asyncio is None, 'requires the C _asyncio module')
+class WorkerGroupTests(unittest.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.loops = [asyncio.new_event_loop() for _ in range(2)]
+        for loop in self.loops:
+            self.addCleanup(loop.close)
+        self.group = _asyncio.WorkerGroup(self.loops)
+
+    def tearDown(self):
+        asyncio.set_event_loop_policy(None)
+        super().tearDown()
+
+    def run_tasks(self, tasks):
+        for loop in self.loops:
+            loop_tasks = [t for t in tasks if t.get_loop() is loop]
+            if loop_tasks:
+                loop.run_until_complete(asyncio.gather(*loop_tasks))
+
+    async def coro(self, steps):
+        for _ in range(steps):
+            await asyncio.sleep(0)
+        return asyncio.get_running_loop()
+
+    def test_workers(self):
+        workers = self.group.workers
+        self.assertEqual(len(workers), 2)
+        for i, worker in enumerate(workers):
+            self.assertIs(worker.loop, self.loops[i])
+            self.assertEqual(worker.index, i)
+        with self.assertRaises(ValueError):
+            _asyncio.WorkerGroup([])
+
+    def test_steal(self):
+        w0, w1 = self.group.workers
+        tasks = [w0.create_task(self.coro(3)) for _ in range(4)]
+        self.assertEqual(w0.steal(), 0)
+        self.assertEqual(w1.steal(), 2)
+        moved = [t for t in tasks if t.get_loop() is self.loops[1]]
+        self.assertEqual(len(moved), 2)
+
+        self.run_tasks(tasks)
+        for t in tasks:
+            self.assertIs(t.result(), t.get_loop())
+
+    def test_steal_needs_spare_tasks(self):
+        w0, w1 = self.group.workers
+        task = w0.create_task(self.coro(1))
+        self.assertEqual(w1.steal(), 0)
+        self.run_tasks([task])
+        self.assertIs(task.result(), self.loops[0])
+
+    def test_pin_task(self):
+        w0, w1 = self.group.workers
+        tasks = [w0.create_task(self.coro(1)) for _ in range(4)]
+        for t in tasks:
+            self.assertIs(_asyncio._pin_task(t), self.loops[0])
+        self.assertEqual(w1.steal(), 0)
+        self.run_tasks(tasks)
+
+    def test_close(self):
+        w0, w1 = self.group.workers
+        tasks = [w0.create_task(self.coro(1)) for _ in range(4)]
+        self.group.close()
+        self.assertEqual(w1.steal(), 0)
+        self.run_tasks(tasks)
+        for t in tasks:
+            self.assertIs(t.result(), self.loops[0])
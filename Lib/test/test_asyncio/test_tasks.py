@@ -10,6 +10,7 @@ import random
 import re
 import sys
 import textwrap
+import threading
 import traceback
 import types
 import unittest
@@ -3129,6 +3130,60 @@ class CIntrospectionTests(test_utils.TestCase, BaseTaskIntrospectionTests):
     else:
         _register_task = _unregister_task = _enter_task = _leave_task = None
 
+    def new_task(self, loop):
+        async def coro():
+            pass
+        return tasks._CTask(coro(), loop=loop)
+
+    def test_task_not_in_weakset(self):
+        loop = asyncio.new_event_loop()
+        self.addCleanup(loop.close)
+        task = self.new_task(loop)
+        self.assertNotIn(task, tasks._all_tasks)
+        self.assertEqual(asyncio.all_tasks(loop), {task})
+        loop.run_until_complete(task)
+        self.assertEqual(asyncio.all_tasks(loop), set())
+        self.assertEqual(tasks._all_tasks_compat(loop), {task})
+
+    def test_unregister_c_task(self):
+        loop = asyncio.new_event_loop()
+        self.addCleanup(loop.close)
+        task = self.new_task(loop)
+        self._unregister_task(task)
+        self.assertEqual(asyncio.all_tasks(loop), set())
+        self._unregister_task(task)
+        self._register_task(task)
+        self._register_task(task)
+        self.assertEqual(tasks._linked_tasks(loop), [task])
+        loop.run_until_complete(task)
+
+    def test_collected_task_unregistered(self):
+        loop = asyncio.new_event_loop()
+        self.addCleanup(loop.close)
+        task = self.new_task(loop)
+        loop.run_until_complete(task)
+        del task
+        support.gc_collect()
+        self.assertEqual(tasks._all_tasks_compat(loop), set())
+
+    def test_tasks_of_other_threads(self):
+        loops = [asyncio.new_event_loop() for _ in range(4)]
+        created = {}
+
+        def create(loop):
+            created[loop] = {self.new_task(loop) for _ in range(10)}
+
+        threads = [threading.Thread(target=create, args=(loop,))
+                   for loop in loops]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        for loop in loops:
+            self.assertEqual(asyncio.all_tasks(loop), created[loop])
+            loop.run_until_complete(asyncio.gather(*created[loop]))
+            loop.close()
+
 
 class BaseCurrentLoopTests:
 
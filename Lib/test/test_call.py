@@ -26,6 +26,65 @@ class FunctionCalls(unittest.TestCase):
         self.assertEqual(list(res.items()), expected)
 
 
+class InlinedBuiltinCalls(unittest.TestCase):
+    # list.append, dict.get and len are run inline by the interpreter.
+    # Check that they behave like the generic calls, including fallbacks.
+
+    def test_list_append(self):
+        l = []
+        for i in range(100):
+            self.assertIsNone(l.append(i))
+        self.assertEqual(l, list(range(100)))
+        self.assertIsNone(list.append(l, 'x'))
+        self.assertEqual(l[-1], 'x')
+
+        class MyList(list):
+            pass
+        m = MyList()
+        m.append(1)
+        list.append(m, 2)
+        self.assertEqual(m, [1, 2])
+        self.assertRaises(TypeError, l.append)
+        self.assertRaises(TypeError, l.append, 1, 2)
+        self.assertRaises(TypeError, list.append, (), 1)
+
+    def test_dict_get(self):
+        d = {'a': 1, 2: 'b'}
+        self.assertEqual(d.get('a'), 1)
+        self.assertEqual(d.get(2), 'b')
+        self.assertIsNone(d.get('c'))
+        self.assertEqual(d.get('c', 3), 3)
+        self.assertEqual(dict.get(d, 'a'), 1)
+        self.assertRaises(TypeError, d.get, [])
+        self.assertRaises(TypeError, d.get)
+        self.assertRaises(TypeError, d.get, 1, 2, 3)
+        self.assertRaises(TypeError, d.get, key='a')
+
+        class MyDict(dict):
+            def __missing__(self, key):
+                return 0
+        self.assertIsNone(MyDict().get('a'))
+
+        class Key:
+            def __hash__(self):
+                raise ZeroDivisionError
+        self.assertRaises(ZeroDivisionError, d.get, Key())
+
+    def test_len(self):
+        self.assertEqual(len([1, 2]), 2)
+        self.assertEqual(len((1, 2, 3)), 3)
+        self.assertEqual(len('abcd'), 4)
+        self.assertEqual(len({}), 0)
+
+        class Sized:
+            def __len__(self):
+                return 7
+        self.assertEqual(len(Sized()), 7)
+        self.assertRaises(TypeError, len, 1)
+        self.assertRaises(TypeError, len)
+        self.assertRaises(TypeError, len, [], [])
+
+
 @cpython_only
 class CFunctionCallsErrorMessages(unittest.TestCase):
 
@@ -2,6 +2,7 @@ import codecs
 import contextlib
 import io
 import locale
+import random
 import sys
 import unittest
 import encodings
@@ -898,6 +899,52 @@ class UTF8Test(ReadTest, unittest.TestCase):
                 dec = codecs.getincrementaldecoder(self.encoding)()
                 self.assertRaises(UnicodeDecodeError, dec.decode, data)
 
+    @support.cpython_only
+    def test_vectorized_decoder(self):
+        # Compare the vectorized decoders of long strings (used for valid
+        # input) with the scalar one on sequences of all lengths at all
+        # offsets, followed by errors
+        _testinternalcapi = support.import_module('_testinternalcapi')
+        all_features = _testinternalcapi.CPU_SSE41 | _testinternalcapi.CPU_AVX2
+        features = (all_features, _testinternalcapi.CPU_SSE41, 0)
+        alphabets = ('a\xe9', '\xe9\xff', 'a Жя', '中。',
+                     'a\xe9Ж中￿\U0001f600\U0010ffff')
+        errors = (b'', b'\x80', b'\xc0\xaf', b'\xc3', b'\xe2\x82',
+                  b'\xe0\x80\x80', b'\xed\xa0\x80', b'\xf0\x8f\xbf\xbf',
+                  b'\xf4\x90\x80\x80', b'\xf8\x88\x80\x80\x80', b'\xff')
+        rng = random.Random(1)
+        cases = []
+        for alphabet in alphabets:
+            for length in (1, 8, 16, 31, 32, 33, 63, 64, 100, 1000):
+                text = 'x' * rng.randrange(40) + ''.join(
+                    rng.choice(alphabet) for _ in range(length))
+                data = text.encode(self.encoding)
+                for error in errors:
+                    pos = rng.randrange(len(data) + 1)
+                    while pos < len(data) and 0x80 <= data[pos] < 0xC0:
+                        pos += 1
+                    cases.append(data[:pos] + error + data[pos:])
+                    cases.append(data + error)
+        old_features = _testinternalcapi.set_cpu_features(all_features)
+        try:
+            for data in cases:
+                results = []
+                for cpu in features:
+                    _testinternalcapi.set_cpu_features(cpu)
+                    try:
+                        strict = data.decode(self.encoding)
+                    except UnicodeDecodeError as exc:
+                        strict = (exc.start, exc.end, exc.reason)
+                    results.append((
+                        strict,
+                        data.decode(self.encoding, 'surrogateescape'),
+                        codecs.utf_8_decode(data, 'replace', False)))
+                with self.subTest(data=data):
+                    self.assertEqual(results[0], results[2])
+                    self.assertEqual(results[1], results[2])
+        finally:
+            _testinternalcapi.set_cpu_features(old_features)
+
 
 class UTF7Test(ReadTest, unittest.TestCase):
     encoding = "utf-7"
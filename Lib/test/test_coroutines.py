@@ -1158,6 +1158,37 @@ class CoroutineTest(unittest.TestCase):
         _, result = run_async(g())
         self.assertIsNone(result.__context__)
 
+    def test_await_17(self):
+        # Return values travel through the send side channel without
+        # a StopIteration; make sure every kind of value arrives intact.
+        @types.coroutine
+        def gen(value):
+            yield 'y'
+            return value
+
+        class Wrapped:
+            def __await__(self):
+                return (yield from gen((1, 2)))
+
+        async def inner(value):
+            return await gen(value)
+
+        async def outer():
+            exc = StopIteration('stop')
+            results = [await inner(None), await inner(exc),
+                       await inner((exc,)), await Wrapped()]
+            try:
+                raise KeyError
+            except KeyError:
+                results.append(await inner(42))
+            return results
+
+        yielded, result = run_async(outer())
+        self.assertEqual(yielded, ['y'] * 5)
+        self.assertIsNone(result[0])
+        self.assertIsInstance(result[1], StopIteration)
+        self.assertEqual(result[2:], [(result[1],), (1, 2), 42])
+
     def test_with_1(self):
         class Manager:
             def __init__(self, name):
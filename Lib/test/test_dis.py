@@ -564,6 +564,25 @@ class DisTests(unittest.TestCase):
                 width += 1 + dis._OPARG_WIDTH
                 self.assertLessEqual(len(opname), width)
 
+    def test_superinstructions(self):
+        def f(a, b):
+            x = a
+            y = 1
+            if a < b:
+                return x
+            return y
+        ops = {op for offset, op, *imm in dis._unpack_opargs(f.__code__.co_code)}
+        self.assertIn(dis.opmap['LOAD_CONST__STORE_FAST'], ops)
+        self.assertIn(dis.opmap['COMPARE__POP_JUMP_IF_FALSE'], ops)
+        # they are shown as the first instruction of the pair
+        opnames = [instr.opname for instr in dis.get_instructions(f)]
+        self.assertEqual(opnames[:5], ['FUNC_HEADER', 'LOAD_FAST', 'STORE_FAST',
+                                       'LOAD_CONST', 'STORE_FAST'])
+        for opname in opnames:
+            self.assertNotIn('__', opname)
+        self.assertEqual(f(1, 2), 1)
+        self.assertEqual(f(2, 1), 1)
+
     def test_dis(self):
         self.do_disassembly_test(_f, dis_f)
 
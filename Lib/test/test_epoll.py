@@ -21,6 +21,7 @@
 """
 Tests for epoll wrapper.
 """
+import array
 import errno
 import os
 import select
@@ -206,6 +207,32 @@ class TestEPoll(unittest.TestCase):
         expected = [(server.fileno(), select.EPOLLOUT)]
         self.assertEqual(events, expected)
 
+    def test_poll_into(self):
+        client, server = self._connected_pair()
+        ep = select.epoll(16)
+        self.addCleanup(ep.close)
+        ep.register(server.fileno(), select.EPOLLIN | select.EPOLLOUT)
+        ep.register(client.fileno(), select.EPOLLIN | select.EPOLLOUT)
+        client.sendall(b"Hello!")
+
+        buf = array.array('I', [0] * 8)
+        expected = ep.poll(1.0)
+        n = ep.poll_into(buf, 1.0)
+        self.assertEqual(n, 2)
+        self.assertEqual(sorted(zip(buf[0:2*n:2], buf[1:2*n:2])),
+                         sorted(expected))
+        self.assertEqual(buf[4:], array.array('I', [0] * 4))
+
+        # Only as many events as fit in the buffer are returned
+        self.assertEqual(ep.poll_into(bytearray(8), 1.0), 1)
+        self.assertEqual(ep.poll_into(memoryview(bytearray(15)), 1.0), 1)
+
+        self.assertRaises(ValueError, ep.poll_into, bytearray(7))
+        self.assertRaises(TypeError, ep.poll_into, b"\0" * 8)
+        self.assertRaises(TypeError, ep.poll_into, buf, "1")
+        ep.close()
+        self.assertRaises(ValueError, ep.poll_into, buf)
+
     def test_errors(self):
         self.assertRaises(ValueError, select.epoll, -2)
         self.assertRaises(ValueError, select.epoll().register, -1,
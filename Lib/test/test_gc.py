@@ -768,6 +768,61 @@ class GCTests(unittest.TestCase):
         new = gc.get_stats()
         self.assertEqual(new[0]["collections"], old[0]["collections"] + 1)
 
+    def test_get_safepoint_stats(self):
+        stats = gc.get_safepoint_stats()
+        self.assertEqual(set(stats),
+                         {"stops", "total_time", "max_time", "last_time",
+                          "last_thread_id", "last_location"})
+        old_stops = stats["stops"]
+        gc.collect()
+        stats = gc.get_safepoint_stats()
+        self.assertGreater(stats["stops"], old_stops)
+        self.assertGreaterEqual(stats["total_time"], stats["max_time"])
+        self.assertGreaterEqual(stats["max_time"], stats["last_time"])
+        self.assertGreaterEqual(stats["last_time"], 0.0)
+
+    @unittest.skipUnless(threading, "requires threading")
+    def test_safepoint_last_thread(self):
+        # A thread busy in Python code is the last to stop, and the stats
+        # name it and its location.
+        started = threading.Event()
+        done = False
+        def spin():
+            started.set()
+            while not done:
+                pass
+        t = threading.Thread(target=spin)
+        t.start()
+        try:
+            started.wait()
+            gc.collect()
+            stats = gc.get_safepoint_stats()
+        finally:
+            done = True
+            t.join()
+        self.assertEqual(stats["last_thread_id"], t.ident)
+        filename, lineno, name = stats["last_location"]
+        self.assertEqual(filename, __file__)
+        self.assertEqual(name, "spin")
+        self.assertIsInstance(lineno, int)
+
+    @unittest.skipUnless(threading, "requires threading")
+    def test_safepoint_blocked_thread(self):
+        # Threads that block in a call releasing the thread state don't
+        # hold up a stop-the-world request.
+        def sleeper():
+            for _ in range(20):
+                time.sleep(0.001)
+        threads = [threading.Thread(target=sleeper) for _ in range(4)]
+        for t in threads:
+            t.start()
+        try:
+            for _ in range(20):
+                gc.collect()
+        finally:
+            for t in threads:
+                t.join()
+
     def test_freeze(self):
         # freeze no longer does anything, so count is always zero :(
         gc.freeze()
@@ -1070,6 +1125,7 @@ class GCCallbackTests(unittest.TestCase):
             self.assertTrue("generation" in info)
             self.assertTrue("collected" in info)
             self.assertTrue("uncollectable" in info)
+            self.assertGreaterEqual(info["time_to_safepoint"], 0.0)
 
     def test_collect_generation(self):
         self.preclean()
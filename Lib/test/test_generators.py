@@ -341,6 +341,22 @@ class ExceptionTest(unittest.TestCase):
         self.assertIsInstance(cm.exception.value, StopIteration)
         self.assertEqual(cm.exception.value.value, 2)
 
+    def test_next_return_value(self):
+        def g(value):
+            yield 1
+            return value
+
+        # A generator returning None may end without setting StopIteration
+        # internally; next() must still raise it.
+        for value in (None, 5):
+            gen = g(value)
+            self.assertEqual(next(gen), 1)
+            with self.assertRaises(StopIteration) as cm:
+                next(gen)
+            self.assertEqual(cm.exception.value, value)
+        self.assertEqual(list(g(None)), [1])
+        self.assertEqual(next(g(None), 'x'), 1)
+
 
 class GeneratorThrowTest(unittest.TestCase):
 
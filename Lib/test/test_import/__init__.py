@@ -1,7 +1,9 @@
 import builtins
 import contextlib
+import _imp
 import errno
 import glob
+import importlib.machinery
 import importlib.util
 from importlib._bootstrap_external import _get_sourcefile
 import marshal
@@ -1362,6 +1364,111 @@ class CircularImportTests(unittest.TestCase):
             unwritable.x = 42
 
 
+@cpython_only
+class SnapshotTests(unittest.TestCase):
+    module_source = textwrap.dedent("""\
+        import sys
+        big = 2 ** 100
+        values = (-1, 256, 257, big, 1.5, 2j, b'', b'bytes', '', 'caf\\xe9',
+                  '\\udc80', None, True, False, ..., (), ((1, 'a'), (2.0,)))
+        def outer(x=(1, 2)):
+            y = 3
+            def inner(*, z=4):
+                return x, y, z
+            return inner
+        def gen():
+            yield from range(3)
+        class C:
+            def method(self, a, b=2):
+                try:
+                    return a // b
+                except ZeroDivisionError:
+                    return None
+        def member(x):
+            return x in {'a', 'b', 42}
+        def check():
+            assert values[3] == 2 ** 100, values
+            assert outer()(z=5) == ((1, 2), 3, 5)
+            assert list(gen()) == [0, 1, 2]
+            assert C().method(7, b=2) == 3
+            assert C().method(7, 0) is None
+            assert member('b') and not member('c')
+            assert check.__code__.co_filename == __file__
+            return values
+        """)
+
+    def setUp(self):
+        self.dir = os.path.abspath(TESTFN)
+        os.mkdir(self.dir)
+        self.addCleanup(rmtree, self.dir)
+        self.name = 'snapshot_module'
+        self.source = os.path.join(self.dir, self.name + '.py')
+        with open(self.source, 'w', encoding='utf-8') as f:
+            f.write(self.module_source)
+        self.snapshot = os.path.join(self.dir, 'test.snapshot')
+
+    def write_snapshot(self):
+        loader = importlib.machinery.SourceFileLoader(self.name, self.source)
+        code = loader.get_code(self.name)
+        st = os.stat(self.source)
+        entries = [(self.source, int(st.st_mtime), st.st_size, code)]
+        with open(self.snapshot, 'wb') as f:
+            f.write(_imp._snapshot_dumps(entries))
+        return code
+
+    def run_module(self, *args):
+        code = ('import sys; sys.path.insert(0, %r); sys.dont_write_bytecode '
+                '= True; import %s as m; print(ascii(m.check()))'
+                % (self.dir, self.name))
+        return script_helper.assert_python_ok(
+            '-v', '-X', 'snapshot=' + self.snapshot, *args, '-c', code)
+
+    def test_import(self):
+        self.write_snapshot()
+        rc, out, err = self.run_module()
+        self.assertIn(b'code object from snapshot', err)
+        ns = {'__file__': self.source}
+        exec(compile(self.module_source, self.source, 'exec'), ns)
+        self.assertEqual(out.decode().strip(), ascii(ns['check']()))
+
+    def test_source_changed(self):
+        self.write_snapshot()
+        with open(self.source, 'a', encoding='utf-8') as f:
+            f.write('def check(): return 42\n')
+        rc, out, err = self.run_module()
+        self.assertNotIn(b'code object from snapshot', err)
+        self.assertEqual(out.strip(), b'42')
+
+    def test_optimization_level(self):
+        self.write_snapshot()
+        rc, out, err = self.run_module('-O')
+        self.assertNotIn(b'code object from snapshot', err)
+        self.assertIn(b'ignoring snapshot', err)
+
+    def test_invalid_snapshot(self):
+        for data in (b'', b'PySnap01' + b'\0' * 100, b'garbage' * 100):
+            with self.subTest(data=data[:8]):
+                with open(self.snapshot, 'wb') as f:
+                    f.write(data)
+                rc, out, err = self.run_module()
+                self.assertIn(b'ignoring snapshot', err)
+                self.assertNotIn(b'code object from snapshot', err)
+
+    def test_dumps_errors(self):
+        code = compile('pass', self.source, 'exec')
+        with self.assertRaises(TypeError):
+            _imp._snapshot_dumps([(self.source, 0, 0, 'not code')])
+        with self.assertRaises(TypeError):
+            _imp._snapshot_dumps([(self.source, 0, 0)])
+        with self.assertRaises(ValueError):
+            _imp._snapshot_dumps([(self.source, 0, 0, code)] * 2)
+        self.assertIsInstance(_imp._snapshot_dumps([]), bytes)
+
+    def test_snapshot_code(self):
+        # This process has no snapshot
+        self.assertIsNone(_imp._snapshot_code(self.source, 0, 0))
+
+
 if __name__ == '__main__':
     # Test needs to be a package, so we can do relative imports.
     unittest.main()
@@ -14,6 +14,7 @@ import types
 import unittest
 import unittest.mock
 import warnings
+from test.support import script_helper
 
 
 class DecodeSourceBytesTests:
@@ -861,7 +862,7 @@ class MagicNumberTests(unittest.TestCase):
         in advance. Such exceptional releases will then require an
         adjustment to this test case.
         """
-        EXPECTED_MAGIC_NUMBER = 9002
+        EXPECTED_MAGIC_NUMBER = 9003
         actual = int.from_bytes(importlib.util.MAGIC_NUMBER[:2], 'little')
 
         msg = (
@@ -879,5 +880,93 @@ class MagicNumberTests(unittest.TestCase):
         self.assertEqual(EXPECTED_MAGIC_NUMBER, actual, msg)
 
 
+class PrefetchTests(unittest.TestCase):
+
+    package = 'prefetch_pkg'
+    modules = {
+        '__init__': 'from . import a',
+        # a -> b -> c -> a is an import cycle
+        'a': 'import prefetch_pkg.b',
+        'b': 'from prefetch_pkg import c',
+        'c': 'import prefetch_pkg.a',
+        'lazy': 'def f():\n    import prefetch_pkg.never',
+        'klass': 'class K:\n    from .sub import e',
+        'broken': 'import prefetch_pkg.a\nraise RuntimeError("broken")',
+        'never': '',
+        'sub/__init__': '',
+        'sub/e': 'import prefetch_pkg.sub',
+    }
+
+    def setUp(self):
+        cm = support.temp_dir()
+        self.dir = cm.__enter__()
+        self.addCleanup(cm.__exit__, None, None, None)
+        for name, source in self.modules.items():
+            path = os.path.join(self.dir, self.package, *name.split('/'))
+            os.makedirs(os.path.dirname(path), exist_ok=True)
+            with open(path + '.py', 'w', encoding='utf-8') as f:
+                f.write(source + '\n')
+        sys.path.insert(0, self.dir)
+        self.addCleanup(sys.path.remove, self.dir)
+        self.addCleanup(self.unload)
+        importlib.invalidate_caches()
+
+    def unload(self):
+        for name in list(sys.modules):
+            if name.partition('.')[0] == self.package:
+                del sys.modules[name]
+
+    def imported(self):
+        return {name.partition('.')[2] for name in sys.modules
+                if name.partition('.')[0] == self.package}
+
+    def test_static(self):
+        importlib.util.prefetch(['prefetch_pkg.lazy', 'prefetch_pkg.klass'],
+                                max_workers=4)
+        self.assertEqual(self.imported(),
+                         {'', 'a', 'b', 'c', 'lazy', 'klass', 'sub', 'sub.e'})
+        import prefetch_pkg.klass
+        self.assertIs(prefetch_pkg.klass.K.e, sys.modules['prefetch_pkg.sub.e'])
+        self.assertIs(prefetch_pkg.a, sys.modules['prefetch_pkg.a'])
+
+    def test_failure(self):
+        importlib.util.prefetch(['prefetch_pkg.broken'])
+        self.assertNotIn('prefetch_pkg.broken', sys.modules)
+        self.assertIn('prefetch_pkg.a', sys.modules)
+        with self.assertRaisesRegex(RuntimeError, 'broken'):
+            import prefetch_pkg.broken
+
+    def test_trace(self):
+        rc, out, err = script_helper.assert_python_ok(
+            '-X', 'importtime', '-c', 'import prefetch_pkg.klass',
+            __cwd=self.dir, __isolated=False)
+        trace = os.path.join(self.dir, 'trace.txt')
+        with open(trace, 'wb') as f:
+            f.write(err)
+        graph = importlib.util._read_import_trace(trace)
+        # The parent package is imported while the module is
+        self.assertEqual(graph['prefetch_pkg.klass'],
+                         ['prefetch_pkg', 'prefetch_pkg.sub',
+                          'prefetch_pkg.sub.e'])
+        self.assertEqual(graph['prefetch_pkg.sub'], [])
+
+        importlib.util.prefetch(trace=trace, max_workers=2)
+        self.assertEqual(self.imported(),
+                         {'', 'a', 'b', 'c', 'klass', 'sub', 'sub.e'})
+
+    def test_already_imported(self):
+        import prefetch_pkg
+        importlib.util.prefetch(['prefetch_pkg', 'prefetch_pkg.never'])
+        self.assertEqual(self.imported(), {'', 'a', 'b', 'c', 'never'})
+
+    def test_not_found(self):
+        importlib.util.prefetch(['prefetch_pkg.missing', 'prefetch_missing'])
+        self.assertEqual(self.imported(), set())
+
+    def test_max_workers(self):
+        with self.assertRaises(ValueError):
+            importlib.util.prefetch(['prefetch_pkg'], max_workers=0)
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -37,6 +37,19 @@ class TestEncodeBasestringAscii:
         s = self.dumps(dict(items), sort_keys=True)
         self.assertEqual(s, '{"five": 5, "four": 4, "one": 1, "three": 3, "two": 2}')
 
+    def test_special_char_offsets(self):
+        # Characters that need escaping must be found at any offset,
+        # including inside and at the edges of machine words.
+        encoder = self.json.encoder
+        for ch in '"\\\n\x1f\x7f\xe9\u0100\U0001d120':
+            for n in range(20):
+                s = 'abcdefghijklmnopqrstuvwxyz'[:n] + ch + 'x' * (n % 9)
+                self.assertEqual(self.dumps([s]),
+                                 '[%s]' % encoder.encode_basestring_ascii(s))
+                self.assertEqual(self.dumps({s: s}, ensure_ascii=False),
+                                 '{%s: %s}' % ((encoder.encode_basestring(s),) * 2))
+                self.assertEqual(self.loads(self.dumps([s])), [s])
+
 
 class TestPyEncodeBasestringAscii(TestEncodeBasestringAscii, PyTest): pass
 class TestCEncodeBasestringAscii(TestEncodeBasestringAscii, CTest):
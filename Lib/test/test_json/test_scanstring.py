@@ -132,6 +132,23 @@ class TestScanstring:
             with self.assertRaises(self.JSONDecodeError, msg=s):
                 scanstring(s, 1, True)
 
+    def test_special_char_offsets(self):
+        # The end quote, escapes and control characters must be found at
+        # any offset, including inside and at the edges of machine words.
+        scanstring = self.json.decoder.scanstring
+        for n in range(20):
+            prefix = 'abcdefghijklmnopqrstuvwxyz\xe9'[:n]
+            self.assertEqual(scanstring('"%s"xyz' % prefix, 1, True),
+                             (prefix, n + 2))
+            self.assertEqual(scanstring('"%s\\n%s"' % (prefix, prefix), 1, True),
+                             (prefix + '\n' + prefix, 2 * n + 4))
+            self.assertEqual(scanstring('"%s\t%s"' % (prefix, prefix), 1, False),
+                             (prefix + '\t' + prefix, 2 * n + 3))
+            with self.assertRaises(self.JSONDecodeError):
+                scanstring('"%s\x1f%s"' % (prefix, prefix), 1, True)
+            with self.assertRaises(self.JSONDecodeError):
+                scanstring('"%s' % prefix, 1, True)
+
     def test_overflow(self):
         with self.assertRaises(OverflowError):
             self.json.decoder.scanstring(b"xxx", sys.maxsize+1)
@@ -12,6 +12,9 @@ SHIFT = sys.int_info.bits_per_digit
 BASE = 2 ** SHIFT
 MASK = BASE - 1
 KARATSUBA_CUTOFF = 70   # from longobject.c
+BZ_DIV_CUTOFF = 60      # from longobject.c
+TO_DECIMAL_CUTOFF = 200     # from longobject.c
+FROM_STRING_CUTOFF = 2000   # from longobject.c
 
 # Max number of base BASE digits to use in test cases.  Doubling
 # this will more than double the runtime.
@@ -229,6 +232,28 @@ class LongTest(unittest.TestCase):
                          1)
                     self.assertEqual(x, y)
 
+    def test_recursive_division(self):
+        # Divisors and quotients of more than BZ_DIV_CUTOFF digits
+        digits = [BZ_DIV_CUTOFF + 1, BZ_DIV_CUTOFF * 2 + 3,
+                  BZ_DIV_CUTOFF * 5, BZ_DIV_CUTOFF * 16 + 1]
+        for leny in digits:
+            for lenq in digits:
+                y = self.getran(leny)
+                self.check_division(self.getran(leny + lenq), y)
+                self.check_division(y * self.getran(lenq), y)
+                self.check_division(y * self.getran(lenq) - 1, y)
+
+        # Long strings of 1 bits give quotient digits of BASE - 1, and
+        # remainders which need the correction step
+        for n in BZ_DIV_CUTOFF + 1, BZ_DIV_CUTOFF * 4, BZ_DIV_CUTOFF * 9:
+            y = (1 << (n * SHIFT)) - 1
+            for x in y * y, y * y - 1, y * (y + 2), (y << (n * SHIFT)) - 1:
+                self.check_division(x, y)
+                self.check_division(x, y >> SHIFT)
+            y = (1 << (n * SHIFT - 1)) + 1
+            self.check_division(y ** 3 - 1, y)
+            self.check_division((y - 2) ** 3, y)
+
     def check_bitop_identities_1(self, x):
         eq = self.assertEqual
         with self.subTest(x=x):
@@ -321,6 +346,57 @@ class LongTest(unittest.TestCase):
                 x = self.getran(lenx)
                 self.check_format_1(x)
 
+    def test_huge_decimal_conversion(self):
+        # Ints of more than TO_DECIMAL_CUTOFF digits and strings of more
+        # than FROM_STRING_CUTOFF digits are converted by divide and conquer
+        decimal = support.import_module('_decimal')
+        ctx = decimal.Context(prec=decimal.MAX_PREC, Emax=decimal.MAX_EMAX)
+        ndigits = [TO_DECIMAL_CUTOFF - 1, TO_DECIMAL_CUTOFF + 1,
+                   TO_DECIMAL_CUTOFF * 3, TO_DECIMAL_CUTOFF * 20]
+        for n in ndigits:
+            for x in (self.getran(n), 1 << (n * SHIFT), (1 << (n * SHIFT)) - 1,
+                      10 ** (n * 9), 10 ** (n * 9) - 1):
+                with self.subTest(n=n, bits=x.bit_length()):
+                    s = str(x)
+                    self.assertEqual(s, ctx.to_sci_string(decimal.Decimal(x)))
+                    self.assertEqual(int(s), x)
+                    self.assertEqual(repr(x), s)
+                    self.assertEqual(format(x, ','),
+                                     format(decimal.Decimal(x), ','))
+
+        rng = random.Random(FROM_STRING_CUTOFF)
+        for n in (FROM_STRING_CUTOFF - 1, FROM_STRING_CUTOFF + 1,
+                  FROM_STRING_CUTOFF * 3, FROM_STRING_CUTOFF * 20 + 7):
+            for s in (''.join(rng.choice('0123456789') for i in range(n)),
+                      '1' + '0' * n, '9' * n, '0' * n + '7'):
+                with self.subTest(n=n, s=s[:20]):
+                    x = int(ctx.create_decimal(s))
+                    self.assertEqual(int(s), x)
+                    self.assertEqual(int('-' + s), -x)
+                    self.assertEqual(int(' +%s\n' % s), x)
+                    self.assertEqual(int(s, 0 if s[0] != '0' else 10), x)
+        s = '1_234_567_890' * FROM_STRING_CUTOFF
+        self.assertEqual(int(s), int(s.replace('_', '')))
+        self.assertEqual(int('0' * FROM_STRING_CUTOFF * 2, 0), 0)
+        self.assertRaises(ValueError, int,
+                          '0' * FROM_STRING_CUTOFF * 2 + '1', 0)
+        self.assertRaises(ValueError, int, '1' * FROM_STRING_CUTOFF * 2 + 'a')
+        self.assertRaises(ValueError, int, '1__2' * FROM_STRING_CUTOFF)
+        self.assertRaises(ValueError, int, '12_' * FROM_STRING_CUTOFF)
+
+        # other bases which are not a power of 2
+        for base in 3, 7, 36:
+            n = FROM_STRING_CUTOFF * 5 + 1
+            chars = '0123456789abcdefghijklmnopqrstuvwxyz'[:base]
+            s = ''.join(rng.choice(chars) for i in range(n))
+            x = 0
+            for i in range(0, n, 100):
+                chunk = s[i:i+100]
+                x = x * base ** len(chunk) + int(chunk, base)
+            with self.subTest(base=base):
+                self.assertEqual(int(s, base), x)
+                self.assertEqual(int(s.upper(), base), x)
+
     def test_long(self):
         # Check conversions from string
         LL = [
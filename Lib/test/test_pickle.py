@@ -216,6 +216,29 @@ if has_c_implementation:
     class CPickleTests(AbstractPickleModuleTests, unittest.TestCase):
         from _pickle import dump, dumps, load, loads, Pickler, Unpickler
 
+        def test_loads_zero_copy_borrows_input(self):
+            for proto in range(3, pickle.HIGHEST_PROTOCOL + 1):
+                data = bytearray(self.dumps(b'abcdefgh' * 1000, proto))
+                view = self.loads(data, zero_copy=True)
+                self.assertTrue(view.readonly)
+                data[data.index(b'abcdefgh')] = ord('X')
+                self.assertEqual(view[0], ord('X'))
+                # The view keeps the input's buffer exported
+                with self.assertRaises(BufferError):
+                    data.extend(b'x')
+                del view
+                data.extend(b'x')
+
+        def test_loads_zero_copy_bytearray8(self):
+            obj = bytearray(b'abcdefgh' * 1000)
+            data = bytearray(self.dumps(obj, 5))
+            view = self.loads(data, zero_copy=True)
+            self.assertFalse(view.readonly)
+            view[0] = ord('X')
+            self.assertIn(b'Xbcdefgh', data)
+            view = self.loads(bytes(data), zero_copy=True)
+            self.assertTrue(view.readonly)
+
     class CUnpicklerTests(PyUnpicklerTests):
         unpickler = _pickle.Unpickler
         bad_stack_errors = (pickle.UnpicklingError,)
@@ -274,10 +297,10 @@ if has_c_implementation:
         check_sizeof = support.check_sizeof
 
         def test_pickler(self):
-            basesize = support.calcobjsize('7P2n3i2n3i2P')
+            basesize = support.calcobjsize('7P2n3i2n3i3Pi')
             p = _pickle.Pickler(io.BytesIO())
             self.assertEqual(object.__sizeof__(p), basesize)
-            MT_size = struct.calcsize('3nP0n')
+            MT_size = struct.calcsize('4nP0n')
             ME_size = struct.calcsize('Pn0P')
             check = self.check_sizeof
             check(p, basesize +
@@ -291,7 +314,7 @@ if has_c_implementation:
                 0)  # Write buffer is cleared after every dump().
 
         def test_unpickler(self):
-            basesize = support.calcobjsize('2P2n2P 2P2n2i5P 2P3n8P2n2i')
+            basesize = support.calcobjsize('2P2n2P 2P2n2i5P 2P3n9P2n3i')
             unpickler = _pickle.Unpickler
             P = struct.calcsize('P')  # Size of memo table entry.
             n = struct.calcsize('n')  # Size of mark table entry.
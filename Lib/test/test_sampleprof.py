@@ -0,0 +1,148 @@
+import threading
+import time
+import unittest
+from test import support
+from test.support.script_helper import assert_python_ok
+
+_sampleprof = support.import_module('_sampleprof')
+import sampleprof
+
+
+def spin(done, started):
+    started.append(True)
+    # No calls: the innermost frame is always spin()
+    while not done:
+        pass
+
+def block(event, started):
+    started.append(True)
+    event.wait()
+
+
+class SampleTests(unittest.TestCase):
+
+    def setUp(self):
+        _sampleprof.clear()
+
+    def tearDown(self):
+        _sampleprof.clear()
+
+    def start_threads(self, spinning=1, blocked=0):
+        done = []
+        started = []
+        event = threading.Event()
+        threads = ([threading.Thread(target=spin, args=(done, started))
+                    for _ in range(spinning)] +
+                   [threading.Thread(target=block, args=(event, started))
+                    for _ in range(blocked)])
+        for t in threads:
+            t.start()
+            self.addCleanup(t.join)
+        self.addCleanup(event.set)
+        self.addCleanup(done.append, True)
+        while len(started) < len(threads):
+            time.sleep(0.001)
+
+    def test_sample(self):
+        self.start_threads(spinning=1, blocked=1)
+        for _ in range(20):
+            self.assertGreaterEqual(_sampleprof.sample(), 2)
+
+        stacks = _sampleprof.get_stacks()
+        spinning = blocked = 0
+        for stack, count in stacks.items():
+            self.assertIsInstance(stack, tuple)
+            for filename, name, lineno in stack:
+                self.assertIsInstance(filename, str)
+                self.assertIsInstance(name, str)
+                self.assertIsInstance(lineno, int)
+            # outermost frame first
+            self.assertEqual(stack[0][1], '_bootstrap')
+            names = [name for filename, name, lineno in stack]
+            if 'spin' in names:
+                self.assertEqual(stack[-1][1], 'spin')
+                spinning += count
+            elif 'block' in names:
+                blocked += count
+        self.assertEqual(spinning, 20)
+        self.assertEqual(blocked, 20)
+
+    def test_current_thread_not_sampled(self):
+        for _ in range(5):
+            _sampleprof.sample()
+        for stack in _sampleprof.get_stacks():
+            names = [name for filename, name, lineno in stack]
+            self.assertNotIn('test_current_thread_not_sampled', names)
+
+    def test_clear(self):
+        self.start_threads()
+        _sampleprof.sample()
+        self.assertTrue(_sampleprof.get_stacks())
+        _sampleprof.clear()
+        self.assertEqual(_sampleprof.get_stacks(), {})
+
+
+class ProfileTests(unittest.TestCase):
+
+    def test_profile(self):
+        done = []
+        t = threading.Thread(target=spin, args=(done, []))
+        t.start()
+        try:
+            with sampleprof.Profile(hz=1000) as prof:
+                for _ in range(500):
+                    if _sampleprof.get_stacks():
+                        break
+                    time.sleep(0.01)
+        finally:
+            done.append(True)
+            t.join()
+
+        self.assertTrue(prof.stacks)
+        for line in prof.collapsed().splitlines():
+            frames, count = line.rsplit(' ', 1)
+            self.assertGreater(int(count), 0)
+        self.assertIn(';spin (%s:' % __file__, prof.collapsed())
+
+    def test_one_profile_at_a_time(self):
+        prof = sampleprof.Profile()
+        with prof:
+            self.assertRaises(RuntimeError, sampleprof.Profile().start)
+        self.assertRaises(RuntimeError, prof.stop)
+        with sampleprof.Profile():
+            pass
+
+    def test_bad_rate(self):
+        self.assertRaises(ValueError, sampleprof.Profile, 0)
+
+    def test_write_collapsed(self):
+        prof = sampleprof.Profile()
+        prof.stacks = {(('a.py', 'f', 1), ('b.py', 'g', 2)): 3,
+                       (('a.py', 'f', 1),): 2}
+        self.addCleanup(support.unlink, support.TESTFN)
+        prof.write_collapsed(support.TESTFN)
+        with open(support.TESTFN, encoding='utf-8') as f:
+            self.assertEqual(f.read(),
+                             'f (a.py:1) 2\n'
+                             'f (a.py:1);g (b.py:2) 3\n')
+
+    def test_main(self):
+        script = support.TESTFN + '.py'
+        self.addCleanup(support.unlink, script)
+        with open(script, 'w', encoding='utf-8') as f:
+            f.write('import time\n'
+                    'def busy():\n'
+                    '    deadline = time.monotonic() + 0.5\n'
+                    '    while time.monotonic() < deadline:\n'
+                    '        pass\n'
+                    'busy()\n')
+        out_file = support.TESTFN + '.folded'
+        self.addCleanup(support.unlink, out_file)
+        assert_python_ok('-m', 'sampleprof', '-r', '1000',
+                         '-o', out_file, script)
+        with open(out_file, encoding='utf-8') as f:
+            self.assertIn('busy (', f.read())
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -399,6 +399,47 @@ class SysModuleTest(unittest.TestCase):
         leave_g.set()
         t.join()
 
+    @support.cpython_only
+    def test_current_frames_busy_threads(self):
+        # Frames are captured with per-thread handshakes: a thread running
+        # Python code pauses at its next eval breaker check, a blocked
+        # thread is visited without waking it up, and the world is never
+        # stopped.
+        import threading
+        import traceback
+
+        stop = threading.Event()
+        started = threading.Barrier(3)
+
+        def busy_loop():
+            started.wait()
+            while not stop.is_set():
+                pass
+
+        def blocked():
+            started.wait()
+            stop.wait()
+
+        threads = [threading.Thread(target=busy_loop),
+                   threading.Thread(target=blocked)]
+        for t in threads:
+            t.start()
+        try:
+            started.wait()
+            with support.disable_gc():
+                stops = gc.get_safepoint_stats()['stops']
+                for _ in range(50):
+                    d = sys._current_frames()
+                    for t, name in zip(threads, ('busy_loop', 'blocked')):
+                        names = [f.f_code.co_name
+                                 for f, _ in traceback.walk_stack(d[t.ident])]
+                        self.assertIn(name, names)
+                self.assertEqual(gc.get_safepoint_stats()['stops'], stops)
+        finally:
+            stop.set()
+            for t in threads:
+                t.join()
+
     def test_attributes(self):
         self.assertIsInstance(sys.api_version, int)
         self.assertIsInstance(sys.argv, list)
@@ -851,6 +892,49 @@ class SysModuleTest(unittest.TestCase):
         self.assertIsInstance(level, int)
         self.assertGreater(level, 0)
 
+    @unittest.skipUnless(hasattr(sys, '_vm_stats'),
+                         'need Python configured --with-vm-stats')
+    def test_vm_stats(self):
+        def get_len(obj):
+            return len(obj.items)
+
+        class C:
+            def __init__(self):
+                self.items = [1, 2, 3]
+
+        def run(n):
+            obj = C()
+            for i in range(n):
+                get_len(obj)
+
+        before = sys._vm_stats()
+        run(100)
+        after = sys._vm_stats()
+        self.assertEqual(set(after),
+                         {'opcodes', 'calls', 'cache', 'resize_stack'})
+        self.assertGreaterEqual(after['opcodes']['FUNC_HEADER'] -
+                                before['opcodes'].get('FUNC_HEADER', 0), 101)
+        self.assertGreaterEqual(after['calls']['function'] -
+                                before['calls']['function'], 101)
+        sites = {k[4]: (k, v) for k, v in after['cache'].items()
+                 if k[1] == 'get_len'}
+        self.assertEqual(set(sites), {'LOAD_GLOBAL', 'LOAD_ATTR'})
+        for (filename, name, lineno, offset, opname), (hits, misses) \
+                in sites.values():
+            self.assertEqual(filename, __file__)
+            self.assertEqual(lineno, get_len.__code__.co_firstlineno + 1)
+            self.assertGreaterEqual(hits + misses, 100)
+            self.assertGreaterEqual(hits, 90)
+
+        # counts of exited threads are kept
+        import threading
+        t = threading.Thread(target=run, args=(1000,))
+        t.start()
+        t.join()
+        stats = sys._vm_stats()
+        self.assertGreaterEqual(stats['calls']['function'] -
+                                after['calls']['function'], 1000)
+
     def test_sys_tracebacklimit(self):
         code = """if 1:
             import sys
@@ -1311,7 +1395,7 @@ class SizeofTest(unittest.TestCase):
         check(int, s)
         # class
         s = vsize(fmt +                 # PyTypeObject
-                  '3P'                  # PyAsyncMethods
+                  '4P'                  # PyAsyncMethods
                   '36P'                 # PyNumberMethods
                   '3P'                  # PyMappingMethods
                   '10P'                 # PySequenceMethods
@@ -9,6 +9,7 @@ import _string
 import codecs
 import itertools
 import operator
+import random
 import struct
 import sys
 import textwrap
@@ -413,6 +414,52 @@ class UnicodeTest(string_tests.CommonTest,
                 self.checkequal([left, right],
                                 left + delim * 2 + right, 'rsplit', delim *2)
 
+    @support.cpython_only
+    def test_vectorized_search(self):
+        # Compare the SSE2 and AVX2 kernels of find, count, split and
+        # replace (used for strings of 1 and 2 bytes per character and for
+        # bytes) with the portable code, around the sizes of their blocks
+        _testinternalcapi = support.import_module('_testinternalcapi')
+        all_features = (_testinternalcapi.CPU_SSE2 |
+                        _testinternalcapi.CPU_SSE41 |
+                        _testinternalcapi.CPU_AVX2)
+        features = (all_features, _testinternalcapi.CPU_SSE2, 0)
+
+        def results(text, sub, empty):
+            return (text.find(sub), text.rfind(sub), text.find(sub, 5),
+                    text.rfind(sub, 0, -5), sub in text,
+                    text.count(sub), text.count(sub, 3),
+                    text.split(sub), text.rsplit(sub),
+                    text.split(sub, 2), text.rsplit(sub, 2),
+                    text.replace(sub, empty), text.replace(sub, empty, 3))
+
+        rng = random.Random(3)
+        cases = []
+        # '\u6100' and '\u0161' share a byte with 'a'
+        alphabets = ('ab', 'ab\n', 'a\xe9\xff', 'a\u0161\u6100\u0101')
+        for alphabet in alphabets:
+            for length in (15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 300):
+                text = ''.join(rng.choice(alphabet) for _ in range(length))
+                for m in (1, 2, 3, 5, 17, 40):
+                    start = rng.randrange(max(length - m, 0) + 1)
+                    for sub in (text[start:start + m],
+                                ''.join(rng.choice(alphabet)
+                                        for _ in range(m))):
+                        cases.append((text, sub, ''))
+                        if max(alphabet) < '\u0100':
+                            cases.append((text.encode('latin-1'),
+                                          sub.encode('latin-1'), b''))
+        old_features = _testinternalcapi.set_cpu_features(0)
+        try:
+            for case in cases:
+                _testinternalcapi.set_cpu_features(0)
+                expected = results(*case)
+                for cpu in features:
+                    _testinternalcapi.set_cpu_features(cpu)
+                    self.assertEqual(results(*case), expected, (case, cpu))
+        finally:
+            _testinternalcapi.set_cpu_features(old_features)
+
     def test_partition(self):
         string_tests.MixinStrUnicodeUserStringTest.test_partition(self)
         # test mixed kinds
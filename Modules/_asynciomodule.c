@@ -1,5 +1,7 @@
 #include "Python.h"
+#include "pycore_llist.h"         // struct llist_node
 #include "pycore_pyerrors.h"      // _PyErr_ClearExcState()
+#include "structmember.h"         // PyMemberDef
 #include <stddef.h>               // offsetof()
 
 
@@ -16,7 +18,6 @@ _Py_IDENTIFIER(add_done_callback);
 _Py_IDENTIFIER(call_soon);
 _Py_IDENTIFIER(cancel);
 _Py_IDENTIFIER(get_event_loop);
-_Py_IDENTIFIER(send);
 _Py_IDENTIFIER(throw);
 
 
@@ -31,6 +32,8 @@ static PyObject *asyncio_task_print_stack_func;
 static PyObject *asyncio_task_repr_info_func;
 static PyObject *asyncio_InvalidStateError;
 static PyObject *asyncio_CancelledError;
+static PyObject *asyncio_format_callback_source_func;
+static PyObject *asyncio_extract_stack_func;
 static PyObject *context_kwname;
 static int module_initialized;
 
@@ -40,7 +43,8 @@ static Py_DECL_THREAD uint64_t cached_running_holder_tsid;
 /* Counter for autogenerated Task names */
 static uint64_t task_name_counter = 0;
 
-/* WeakSet containing all alive tasks. */
+/* WeakSet containing the alive task-like objects registered with
+   _register_task() that are not C tasks (see task_link()). */
 static PyObject *all_tasks;
 
 /* Dictionary containing tasks that are currently active in
@@ -84,6 +88,11 @@ typedef struct {
     PyObject *task_coro;
     PyObject *task_name;
     PyObject *task_context;
+    PyObject *task_worker;
+    PyObject *task_next_step;
+    struct task_list *task_list;
+    struct llist_node task_node;
+    int task_stepping;
     int task_must_cancel;
     int task_log_destroy_pending;
 } TaskObj;
@@ -107,17 +116,83 @@ typedef struct {
 #endif
 } PyRunningLoopHolder;
 
+#define HandleObj_HEAD(prefix)                                              \
+    PyObject_HEAD                                                           \
+    PyObject *prefix##_callback;                                            \
+    PyObject *prefix##_args;                                                \
+    PyObject *prefix##_loop;                                                \
+    PyObject *prefix##_context;                                             \
+    PyObject *prefix##_source_tb;                                           \
+    PyObject *prefix##_repr;                                                \
+    PyObject *prefix##_weakreflist;                                         \
+    int prefix##_state;                                                     \
+    char prefix##_cancelled;
+
+typedef struct {
+    HandleObj_HEAD(h)
+} HandleObj;
+
+typedef struct {
+    HandleObj_HEAD(th)
+    PyObject *th_when;
+    char th_scheduled;
+} TimerHandleObj;
+
+/* Handle states.  A handle that runs a step of a Task owned by a Worker
+   is published in the worker's queue, and is then claimed exactly once:
+   either by its own loop when it runs it, or by another worker that
+   steals the task. */
+#define HANDLE_PRIVATE  0
+#define HANDLE_QUEUED   1
+#define HANDLE_CLAIMED  2
+
+typedef struct {
+    TaskObj *task;
+    HandleObj *handle;
+} worker_entry;
+
+typedef struct {
+    PyObject_HEAD
+    PyObject *w_loop;
+    PyObject *w_group;
+    Py_ssize_t w_index;
+    Py_ssize_t w_next_victim;
+    _PyMutex w_mutex;
+    /* Ring buffer of runnable tasks, protected by w_mutex */
+    worker_entry *w_queue;
+    Py_ssize_t w_head;
+    Py_ssize_t w_size;
+    Py_ssize_t w_capacity;
+    int w_idle;
+} WorkerObj;
+
+typedef struct {
+    PyObject_HEAD
+    PyObject *wg_workers;
+    int wg_nidle;
+    int wg_closed;
+} WorkerGroupObj;
+
 
 static PyTypeObject FutureType;
 static PyTypeObject TaskType;
+static PyTypeObject HandleType;
+static PyTypeObject TimerHandleType;
+static PyTypeObject WorkerType;
+static PyTypeObject WorkerGroupType;
+static PyTypeObject TaskStepMethWrapper_Type;
+static PyTypeObject TaskWakeupMethWrapper_Type;
 static PyTypeObject PyRunningLoopHolder_Type;
 
 
 #define Future_CheckExact(obj) Py_IS_TYPE(obj, &FutureType)
 #define Task_CheckExact(obj) Py_IS_TYPE(obj, &TaskType)
+#define Handle_CheckExact(obj) Py_IS_TYPE(obj, &HandleType)
+#define TimerHandle_CheckExact(obj) Py_IS_TYPE(obj, &TimerHandleType)
 
 #define Future_Check(obj) PyObject_TypeCheck(obj, &FutureType)
 #define Task_Check(obj) PyObject_TypeCheck(obj, &TaskType)
+#define TimerHandle_Check(obj) PyObject_TypeCheck(obj, &TimerHandleType)
 
 #include "clinic/_asynciomodule.c.h"
 
@@ -133,6 +208,9 @@ static PyObject * future_new_iter(PyObject *);
 
 static PyRunningLoopHolder * new_running_loop_holder(PyObject *);
 
+/* Publish a runnable task in its worker's queue */
+static int worker_push(WorkerObj *, TaskObj *, HandleObj *);
+
 
 static int
 _is_coroutine(PyObject *coro)
@@ -348,6 +426,19 @@ get_event_loop(void)
 }
 
 
+/* Return the task whose step 'func' runs, if any (borrowed) */
+static TaskObj *
+callback_task(PyObject *func)
+{
+    if (Py_IS_TYPE(func, &TaskStepMethWrapper_Type)) {
+        return ((TaskStepMethWrapper *)func)->sw_task;
+    }
+    if (Py_IS_TYPE(func, &TaskWakeupMethWrapper_Type)) {
+        return ((TaskWakeupMethWrapper *)func)->ww_task;
+    }
+    return NULL;
+}
+
 static int
 call_soon(PyObject *loop, PyObject *func, PyObject *arg, PyObject *ctx)
 {
@@ -383,6 +474,24 @@ call_soon(PyObject *loop, PyObject *func, PyObject *arg, PyObject *ctx)
     if (handle == NULL) {
         return -1;
     }
+
+    /* A task owned by a worker has just become runnable: let idle
+       workers know about it. */
+    TaskObj *task = callback_task(func);
+    if (task != NULL && _Py_atomic_load_ptr_relaxed(&task->task_worker) &&
+            task->task_loop == loop && Handle_CheckExact(handle)) {
+        if (task->task_stepping) {
+            /* The task is still running its current step; handle_run()
+               publishes the next one when the current one has returned. */
+            Py_XSETREF(task->task_next_step, handle);
+            return 0;
+        }
+        int ret = worker_push((WorkerObj *)task->task_worker, task,
+                              (HandleObj *)handle);
+        Py_DECREF(handle);
+        return ret;
+    }
+
     Py_DECREF(handle);
     return 0;
 }
@@ -1589,36 +1698,60 @@ FutureIter_dealloc(futureiterobject *it)
     PyObject_GC_Del(it);
 }
 
-static PyObject *
-FutureIter_iternext(futureiterobject *it)
+static PySendResult
+FutureIter_am_send(futureiterobject *it,
+                   PyObject *Py_UNUSED(arg),
+                   PyObject **result)
 {
+    /* arg is unused, see the comment on FutureIter_send for clarification */
+
     PyObject *res;
     FutureObj *fut = it->future;
 
+    *result = NULL;
     if (fut == NULL) {
-        return NULL;
+        /* already exhausted: the same as returning None */
+        Py_INCREF(Py_None);
+        *result = Py_None;
+        return PYGEN_RETURN;
     }
 
     if (fut->fut_state == STATE_PENDING) {
         if (!fut->fut_blocking) {
             fut->fut_blocking = 1;
             Py_INCREF(fut);
-            return (PyObject *)fut;
+            *result = (PyObject *)fut;
+            return PYGEN_NEXT;
         }
         PyErr_SetString(PyExc_RuntimeError,
                         "await wasn't used with future");
-        return NULL;
+        return PYGEN_ERROR;
     }
 
     it->future = NULL;
     res = _asyncio_Future_result_impl(fut);
-    if (res != NULL) {
-        /* The result of the Future is not an exception. */
-        (void)_PyGen_SetStopIterationValue(res);
-        Py_DECREF(res);
+    Py_DECREF(fut);
+    if (res == NULL) {
+        return PYGEN_ERROR;
     }
+    /* The result of the Future is not an exception. */
+    *result = res;
+    return PYGEN_RETURN;
+}
 
-    Py_DECREF(fut);
+static PyObject *
+FutureIter_iternext(futureiterobject *it)
+{
+    PyObject *result;
+
+    if (it->future == NULL) {
+        return NULL;
+    }
+    if (FutureIter_am_send(it, Py_None, &result) != PYGEN_RETURN) {
+        return result;
+    }
+    (void)_PyGen_SetStopIterationValue(result);
+    Py_DECREF(result);
     return NULL;
 }
 
@@ -1708,12 +1841,17 @@ static PyMethodDef FutureIter_methods[] = {
     {NULL, NULL}        /* Sentinel */
 };
 
+static PyAsyncMethods FutureIterType_as_async = {
+    .am_send = (sendfunc)FutureIter_am_send,
+};
+
 static PyTypeObject FutureIterType = {
     PyVarObject_HEAD_INIT(NULL, 0)
     "_asyncio.FutureIter",
     .tp_basicsize = sizeof(futureiterobject),
     .tp_itemsize = 0,
     .tp_dealloc = (destructor)FutureIter_dealloc,
+    .tp_as_async = &FutureIterType_as_async,
     .tp_getattro = PyObject_GenericGetAttr,
     .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
     .tp_traverse = (traverseproc)FutureIter_traverse,
@@ -1937,11 +2075,132 @@ TaskWakeupMethWrapper_new(TaskObj *task)
 
 /* ----- Task introspection helpers */
 
+/* C tasks are registered in intrusive doubly-linked lists instead of the
+   all_tasks WeakSet, which would create a weak reference and take a lock
+   shared by all threads for every task.  Each thread links the tasks it
+   creates into one of TASK_LIST_SHARDS lists; a task stays there until it
+   is deallocated, as the lists hold no references.  _linked_tasks() takes
+   a new reference to each task it returns, which fails for a task whose
+   deallocation has started. */
+#define TASK_LIST_SHARDS 16
+
+typedef struct task_list {
+    _PyMutex mutex Py_ALIGNED(64);
+    struct llist_node head;     /* zero until a task is first linked */
+} task_list;
+
+static task_list task_lists[TASK_LIST_SHARDS];
+static int task_list_counter;
+static Py_DECL_THREAD task_list *cached_task_list;
+
+static task_list *
+task_list_for_thread(void)
+{
+    task_list *list = cached_task_list;
+    if (list == NULL) {
+        unsigned int i = (unsigned int)_Py_atomic_add_int(&task_list_counter, 1);
+        list = &task_lists[i % TASK_LIST_SHARDS];
+        cached_task_list = list;
+    }
+    return list;
+}
+
+static void
+task_link(TaskObj *task)
+{
+    if (task->task_list != NULL) {
+        return;
+    }
+    task_list *list = task_list_for_thread();
+    _PyMutex_lock(&list->mutex);
+    if (list->head.next == NULL) {
+        llist_init(&list->head);
+    }
+    llist_insert_tail(&list->head, &task->task_node);
+    task->task_list = list;
+    _PyMutex_unlock(&list->mutex);
+}
+
+static void
+task_unlink(TaskObj *task)
+{
+    task_list *list = task->task_list;
+    if (list == NULL) {
+        return;
+    }
+    _PyMutex_lock(&list->mutex);
+    llist_remove(&task->task_node);
+    task->task_list = NULL;
+    _PyMutex_unlock(&list->mutex);
+}
+
+static PyObject *
+linked_tasks(PyObject *loop)
+{
+    PyObject **items = NULL;
+    Py_ssize_t size = 0, allocated = 0;
+
+    for (int i = 0; i < TASK_LIST_SHARDS; i++) {
+        task_list *list = &task_lists[i];
+        struct llist_node *node;
+        _PyMutex_lock(&list->mutex);
+        if (list->head.next == NULL) {
+            _PyMutex_unlock(&list->mutex);
+            continue;
+        }
+        llist_for_each(node, &list->head) {
+            TaskObj *task = llist_data(node, TaskObj, task_node);
+            if (_Py_atomic_load_ptr_relaxed(&task->task_loop) != loop) {
+                continue;
+            }
+            if (size == allocated) {
+                /* No object allocation here: a collection could
+                   deallocate a task, which needs this lock. */
+                Py_ssize_t n = allocated ? allocated * 2 : 64;
+                PyObject **p = PyMem_RawRealloc(items, n * sizeof(PyObject *));
+                if (p == NULL) {
+                    _PyMutex_unlock(&list->mutex);
+                    PyErr_NoMemory();
+                    goto error;
+                }
+                items = p;
+                allocated = n;
+            }
+            if (_Py_TRY_INCREF(task)) {
+                items[size++] = (PyObject *)task;
+            }
+        }
+        _PyMutex_unlock(&list->mutex);
+    }
+
+    PyObject *res = PyList_New(size);
+    if (res == NULL) {
+        goto error;
+    }
+    for (Py_ssize_t i = 0; i < size; i++) {
+        PyList_SET_ITEM(res, i, items[i]);
+    }
+    PyMem_RawFree(items);
+    return res;
+
+error:
+    for (Py_ssize_t i = 0; i < size; i++) {
+        Py_DECREF(items[i]);
+    }
+    PyMem_RawFree(items);
+    return NULL;
+}
+
 static int
 register_task(PyObject *task)
 {
     _Py_IDENTIFIER(add);
 
+    if (Task_Check(task)) {
+        task_link((TaskObj *)task);
+        return 0;
+    }
+
     PyObject *res = _PyObject_CallMethodIdOneArg(all_tasks,
                                                  &PyId_add, task);
     if (res == NULL) {
@@ -1957,6 +2216,11 @@ unregister_task(PyObject *task)
 {
     _Py_IDENTIFIER(discard);
 
+    if (Task_Check(task)) {
+        task_unlink((TaskObj *)task);
+        return 0;
+    }
+
     PyObject *res = _PyObject_CallMethodIdOneArg(all_tasks,
                                                  &PyId_discard, task);
     if (res == NULL) {
@@ -2101,6 +2365,8 @@ TaskObj_clear(TaskObj *task)
 {
     (void)FutureObj_clear((FutureObj*) task);
     Py_CLEAR(task->task_context);
+    Py_CLEAR(task->task_worker);
+    Py_CLEAR(task->task_next_step);
     Py_CLEAR(task->task_coro);
     Py_CLEAR(task->task_name);
     Py_CLEAR(task->task_fut_waiter);
@@ -2111,6 +2377,8 @@ static int
 TaskObj_traverse(TaskObj *task, visitproc visit, void *arg)
 {
     Py_VISIT(task->task_context);
+    Py_VISIT(task->task_worker);
+    Py_VISIT(task->task_next_step);
     Py_VISIT(task->task_coro);
     Py_VISIT(task->task_name);
     Py_VISIT(task->task_fut_waiter);
@@ -2425,6 +2693,10 @@ TaskObj_finalize(TaskObj *task)
     PyObject *func;
     PyObject *error_type, *error_value, *error_traceback;
 
+    /* Like a weak reference, the registration does not survive the task
+       becoming garbage, even if the finalizer resurrects it. */
+    task_unlink(task);
+
     if (task->task_state != STATE_PENDING || !task->task_log_destroy_pending) {
         goto done;
     }
@@ -2556,6 +2828,7 @@ TaskObj_dealloc(PyObject *self)
         }
     }
 
+    task_unlink(task);
     PyObject_GC_UnTrack(self);
 
     if (task->task_weakreflist != NULL) {
@@ -2670,13 +2943,11 @@ task_step_impl(TaskObj *task, PyObject *exc)
         return NULL;
     }
 
+    PySendResult gen_status;
     if (exc == NULL) {
-        if (PyGen_CheckExact(coro) || PyCoro_CheckExact(coro)) {
-            result = _PyGen_Send((PyGenObject*)coro, Py_None);
-        }
-        else {
-            result = _PyObject_CallMethodIdOneArg(coro, &PyId_send, Py_None);
-        }
+        /* A finished coroutine returns its result through the send side
+           channel instead of raising StopIteration. */
+        gen_status = PyIter_Send(coro, Py_None, &result);
     }
     else {
         result = _PyObject_CallMethodIdOneArg(coro, &PyId_throw, exc);
@@ -2684,14 +2955,22 @@ task_step_impl(TaskObj *task, PyObject *exc)
             /* We created 'exc' during this call */
             Py_DECREF(exc);
         }
+        if (result != NULL) {
+            gen_status = PYGEN_NEXT;
+        }
+        else if (_PyGen_FetchStopIterationValue(&result) == 0) {
+            gen_status = PYGEN_RETURN;
+        }
+        else {
+            gen_status = PYGEN_ERROR;
+        }
     }
 
-    if (result == NULL) {
+    if (gen_status != PYGEN_NEXT) {
         PyObject *et, *ev, *tb;
 
-        if (_PyGen_FetchStopIterationValue(&o) == 0) {
-            /* The error is StopIteration and that means that
-               the underlying coroutine has resolved */
+        if (gen_status == PYGEN_RETURN) {
+            /* The underlying coroutine has resolved */
 
             PyObject *res;
             if (task->task_must_cancel) {
@@ -2700,10 +2979,10 @@ task_step_impl(TaskObj *task, PyObject *exc)
                 res = future_cancel((FutureObj*)task, task->task_cancel_msg);
             }
             else {
-                res = future_set_result((FutureObj*)task, o);
+                res = future_set_result((FutureObj*)task, result);
             }
 
-            Py_DECREF(o);
+            Py_DECREF(result);
 
             if (res == NULL) {
                 return NULL;
@@ -2972,7 +3251,9 @@ task_step(TaskObj *task, PyObject *exc)
         return NULL;
     }
 
+    task->task_stepping = 1;
     res = task_step_impl(task, exc);
+    task->task_stepping = 0;
 
     if (res == NULL) {
         PyObject *et, *ev, *tb;
@@ -3041,120 +3322,1909 @@ task_wakeup(TaskObj *task, PyObject *o)
 }
 
 
-/*********************** Functions **************************/
+/*********************** Handle **************************/
 
 
 /*[clinic input]
-_asyncio._get_running_loop
+class _asyncio.Handle "HandleObj *" "&HandleType"
+class _asyncio.TimerHandle "TimerHandleObj *" "&TimerHandleType"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=6d21dd13050cb891]*/
 
-Return the running event loop or None.
+/* The event loop creates a Handle for every callback it runs and drops it
+   right after running it.  Spent handles of the exact Handle and TimerHandle
+   types are kept in a small pool for reuse.  Pooled objects are untracked,
+   hold no references and are chained through their h_callback field. */
+#define HANDLE_POOL_MAXSIZE 256
 
-This is a low-level function intended to be used by event loops.
-This function is thread-specific.
+typedef struct {
+    _PyMutex mutex;
+    HandleObj *head;
+    int size;
+} handle_pool;
 
-[clinic start generated code]*/
+static handle_pool handle_pools[2];     /* Handle, TimerHandle */
 
-static PyObject *
-_asyncio__get_running_loop_impl(PyObject *module)
-/*[clinic end generated code: output=b4390af721411a0a input=0a21627e25a4bd43]*/
+static handle_pool *
+handle_pool_for(PyTypeObject *type)
 {
-    PyObject *loop;
-    if (get_running_loop(&loop)) {
-        return NULL;
+    if (type == &HandleType) {
+        return &handle_pools[0];
     }
-    if (loop == NULL) {
-        /* There's no currently running event loop */
-        Py_RETURN_NONE;
+    if (type == &TimerHandleType) {
+        return &handle_pools[1];
     }
-    return loop;
+    return NULL;
 }
 
-/*[clinic input]
-_asyncio._set_running_loop
-    loop: 'O'
-    /
+static HandleObj *
+handle_pool_pop(PyTypeObject *type)
+{
+    handle_pool *pool = handle_pool_for(type);
+    if (pool == NULL) {
+        return NULL;
+    }
+    _PyMutex_lock(&pool->mutex);
+    HandleObj *h = pool->head;
+    if (h != NULL) {
+        pool->head = (HandleObj *)h->h_callback;
+        pool->size--;
+    }
+    _PyMutex_unlock(&pool->mutex);
+    if (h != NULL) {
+        h->h_callback = NULL;
+        _Py_NewReference((PyObject *)h);
+        PyObject_GC_Track(h);
+    }
+    return h;
+}
 
-Set the running event loop.
+static int
+handle_pool_push(HandleObj *h)
+{
+    handle_pool *pool = handle_pool_for(Py_TYPE(h));
+    if (pool == NULL) {
+        return 0;
+    }
+    _PyMutex_lock(&pool->mutex);
+    int pushed = pool->size < HANDLE_POOL_MAXSIZE;
+    if (pushed) {
+        h->h_callback = (PyObject *)pool->head;
+        pool->head = h;
+        pool->size++;
+    }
+    _PyMutex_unlock(&pool->mutex);
+    return pushed;
+}
 
-This is a low-level function intended to be used by event loops.
-This function is thread-specific.
-[clinic start generated code]*/
+static void
+handle_pool_clear(void)
+{
+    for (size_t i = 0; i < Py_ARRAY_LENGTH(handle_pools); i++) {
+        handle_pool *pool = &handle_pools[i];
+        _PyMutex_lock(&pool->mutex);
+        HandleObj *h = pool->head;
+        pool->head = NULL;
+        pool->size = 0;
+        _PyMutex_unlock(&pool->mutex);
+        while (h != NULL) {
+            HandleObj *next = (HandleObj *)h->h_callback;
+            PyObject_GC_Del(h);
+            h = next;
+        }
+    }
+}
 
 static PyObject *
-_asyncio__set_running_loop(PyObject *module, PyObject *loop)
-/*[clinic end generated code: output=ae56bf7a28ca189a input=4c9720233d606604]*/
+HandleObj_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
-    if (set_running_loop(loop)) {
-        return NULL;
+    HandleObj *h = handle_pool_pop(type);
+    if (h == NULL) {
+        h = (HandleObj *)type->tp_alloc(type, 0);
+        if (h == NULL) {
+            return NULL;
+        }
     }
-    Py_RETURN_NONE;
+    /* Keep the fields valid until __init__() runs */
+    Py_INCREF(Py_None);
+    h->h_callback = Py_None;
+    Py_INCREF(Py_None);
+    h->h_args = Py_None;
+    Py_INCREF(Py_None);
+    h->h_loop = Py_None;
+    Py_INCREF(Py_None);
+    h->h_context = Py_None;
+    Py_INCREF(Py_None);
+    h->h_source_tb = Py_None;
+    Py_INCREF(Py_None);
+    h->h_repr = Py_None;
+    h->h_state = HANDLE_PRIVATE;
+    h->h_cancelled = 0;
+    if (TimerHandle_Check(h)) {
+        Py_INCREF(Py_None);
+        ((TimerHandleObj *)h)->th_when = Py_None;
+        ((TimerHandleObj *)h)->th_scheduled = 0;
+    }
+    return (PyObject *)h;
 }
 
-/*[clinic input]
-_asyncio.get_event_loop
+static int
+handle_init(HandleObj *h, PyObject *callback, PyObject *args,
+            PyObject *loop, PyObject *context)
+{
+    _Py_IDENTIFIER(get_debug);
+    PyObject *res;
+    int is_true;
 
-Return an asyncio event loop.
+    if (context == Py_None) {
+        context = PyContext_CopyCurrent();
+        if (context == NULL) {
+            return -1;
+        }
+    }
+    else {
+        Py_INCREF(context);
+    }
+    Py_XSETREF(h->h_context, context);
+    Py_INCREF(loop);
+    Py_XSETREF(h->h_loop, loop);
+    Py_INCREF(callback);
+    Py_XSETREF(h->h_callback, callback);
+    Py_INCREF(args);
+    Py_XSETREF(h->h_args, args);
+    h->h_cancelled = 0;
+    Py_INCREF(Py_None);
+    Py_XSETREF(h->h_repr, Py_None);
+    Py_INCREF(Py_None);
+    Py_XSETREF(h->h_source_tb, Py_None);
+
+    res = _PyObject_CallMethodIdNoArgs(loop, &PyId_get_debug);
+    if (res == NULL) {
+        return -1;
+    }
+    is_true = PyObject_IsTrue(res);
+    Py_DECREF(res);
+    if (is_true < 0) {
+        return -1;
+    }
+    if (is_true && !_Py_IsFinalizing()) {
+        /* Called from C, extract_stack() starts at the frame that
+           created the handle. */
+        PyObject *tb = PyObject_CallNoArgs(asyncio_extract_stack_func);
+        if (tb == NULL) {
+            return -1;
+        }
+        Py_SETREF(h->h_source_tb, tb);
+    }
+    return 0;
+}
 
-When called from a coroutine or a callback (e.g. scheduled with
-call_soon or similar API), this function will always return the
-running event loop.
+/*[clinic input]
+_asyncio.Handle.__init__
 
-If there is no running event loop set, the function will return
-the result of `get_event_loop_policy().get_event_loop()` call.
+    callback: object
+    args as callback_args: object
+    loop: object
+    context: object = None
+
+Object returned by callback registration methods.
 [clinic start generated code]*/
 
-static PyObject *
-_asyncio_get_event_loop_impl(PyObject *module)
-/*[clinic end generated code: output=2a2d8b2f824c648b input=9364bf2916c8655d]*/
+static int
+_asyncio_Handle___init___impl(HandleObj *self, PyObject *callback,
+                              PyObject *callback_args, PyObject *loop,
+                              PyObject *context)
+/*[clinic end generated code: output=a6fd445f3dd461ba input=2f5e00dd6750c23d]*/
 {
-    return get_event_loop();
+    return handle_init(self, callback, callback_args, loop, context);
 }
 
-/*[clinic input]
-_asyncio.get_running_loop
-
-Return the running event loop.  Raise a RuntimeError if there is none.
+static int
+HandleObj_clear(HandleObj *h)
+{
+    Py_CLEAR(h->h_callback);
+    Py_CLEAR(h->h_args);
+    Py_CLEAR(h->h_loop);
+    Py_CLEAR(h->h_context);
+    Py_CLEAR(h->h_source_tb);
+    Py_CLEAR(h->h_repr);
+    return 0;
+}
 
-This function is thread-specific.
-[clinic start generated code]*/
+static int
+HandleObj_traverse(HandleObj *h, visitproc visit, void *arg)
+{
+    Py_VISIT(h->h_callback);
+    Py_VISIT(h->h_args);
+    Py_VISIT(h->h_loop);
+    Py_VISIT(h->h_context);
+    Py_VISIT(h->h_source_tb);
+    Py_VISIT(h->h_repr);
+    return 0;
+}
 
-static PyObject *
-_asyncio_get_running_loop_impl(PyObject *module)
-/*[clinic end generated code: output=c247b5f9e529530e input=2a3bf02ba39f173d]*/
+static int
+handle_cancel(HandleObj *h)
 {
-    PyObject *loop;
-    if (get_running_loop(&loop)) {
-        return NULL;
+    _Py_IDENTIFIER(get_debug);
+    _Py_IDENTIFIER(_timer_handle_cancelled);
+    PyObject *res;
+    int is_true;
+
+    if (h->h_cancelled) {
+        return 0;
     }
-    if (loop == NULL) {
-        /* There's no currently running event loop */
-        PyErr_SetString(
-            PyExc_RuntimeError, "no running event loop");
+    if (TimerHandle_Check(h)) {
+        res = _PyObject_CallMethodIdOneArg(
+            h->h_loop, &PyId__timer_handle_cancelled, (PyObject *)h);
+        if (res == NULL) {
+            return -1;
+        }
+        Py_DECREF(res);
     }
-    return loop;
+
+    h->h_cancelled = 1;
+    res = _PyObject_CallMethodIdNoArgs(h->h_loop, &PyId_get_debug);
+    if (res == NULL) {
+        return -1;
+    }
+    is_true = PyObject_IsTrue(res);
+    Py_DECREF(res);
+    if (is_true < 0) {
+        return -1;
+    }
+    if (is_true) {
+        /* Keep a representation in debug mode to keep callback and
+           parameters. For example, to log the warning
+           "Executing <Handle...> took 2.5 second" */
+        PyObject *repr = PyObject_Repr((PyObject *)h);
+        if (repr == NULL) {
+            return -1;
+        }
+        Py_XSETREF(h->h_repr, repr);
+    }
+    Py_INCREF(Py_None);
+    Py_SETREF(h->h_callback, Py_None);
+    Py_INCREF(Py_None);
+    Py_SETREF(h->h_args, Py_None);
+    return 0;
 }
 
 /*[clinic input]
-_asyncio._register_task
-
-    task: object
-
-Register a new task in asyncio as executed by loop.
-
-Returns None.
+_asyncio.Handle.cancel
 [clinic start generated code]*/
 
 static PyObject *
-_asyncio__register_task_impl(PyObject *module, PyObject *task)
-/*[clinic end generated code: output=8672dadd69a7d4e2 input=21075aaea14dfbad]*/
+_asyncio_Handle_cancel_impl(HandleObj *self)
+/*[clinic end generated code: output=ddb39234782aab82 input=eaa3eb93236f622f]*/
 {
-    if (register_task(task) < 0) {
+    if (handle_cancel(self) < 0) {
         return NULL;
     }
     Py_RETURN_NONE;
 }
 
-
+/*[clinic input]
+_asyncio.Handle.cancelled
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_Handle_cancelled_impl(HandleObj *self)
+/*[clinic end generated code: output=0f4ad57f569e9f24 input=14a55098bea1b40a]*/
+{
+    return PyBool_FromLong(self->h_cancelled);
+}
+
+static int
+handle_report_exception(HandleObj *h)
+{
+    _Py_IDENTIFIER(call_exception_handler);
+    _Py_IDENTIFIER(message);
+    _Py_IDENTIFIER(exception);
+    _Py_IDENTIFIER(handle);
+    _Py_IDENTIFIER(source_traceback);
+    PyObject *et, *ev, *tb;
+    PyObject *saved_et, *saved_ev, *saved_tb;
+    PyObject *cb = NULL, *message = NULL, *context = NULL, *res = NULL;
+    int has_tb;
+
+    PyErr_Fetch(&et, &ev, &tb);
+    PyErr_NormalizeException(&et, &ev, &tb);
+    if (tb != NULL) {
+        PyException_SetTraceback(ev, tb);
+    }
+    /* Report it while it is the exception being handled, as the except
+       clause of the Python implementation does. */
+    PyErr_GetExcInfo(&saved_et, &saved_ev, &saved_tb);
+    Py_INCREF(ev);
+    PyErr_SetExcInfo(et, ev, tb);
+
+    cb = PyObject_CallFunctionObjArgs(asyncio_format_callback_source_func,
+                                      h->h_callback, h->h_args, NULL);
+    if (cb == NULL) {
+        goto done;
+    }
+    message = PyUnicode_FromFormat("Exception in callback %S", cb);
+    if (message == NULL) {
+        goto done;
+    }
+    context = PyDict_New();
+    if (context == NULL ||
+        _PyDict_SetItemId(context, &PyId_message, message) < 0 ||
+        _PyDict_SetItemId(context, &PyId_exception, ev) < 0 ||
+        _PyDict_SetItemId(context, &PyId_handle, (PyObject *)h) < 0) {
+        goto done;
+    }
+    has_tb = PyObject_IsTrue(h->h_source_tb);
+    if (has_tb < 0) {
+        goto done;
+    }
+    if (has_tb && _PyDict_SetItemId(context, &PyId_source_traceback,
+                                    h->h_source_tb) < 0) {
+        goto done;
+    }
+    res = _PyObject_CallMethodIdOneArg(h->h_loop, &PyId_call_exception_handler,
+                                       context);
+
+done:
+    PyErr_SetExcInfo(saved_et, saved_ev, saved_tb);
+    Py_DECREF(ev);
+    Py_XDECREF(cb);
+    Py_XDECREF(message);
+    Py_XDECREF(context);
+    if (res == NULL) {
+        return -1;
+    }
+    Py_DECREF(res);
+    return 0;
+}
+
+static int
+task_publish_next_step(PyObject *callback)
+{
+    TaskObj *task = callback_task(callback);
+    if (task == NULL || task->task_next_step == NULL) {
+        return 0;
+    }
+    PyObject *handle = task->task_next_step;
+    task->task_next_step = NULL;
+    int ret = 0;
+    if (_Py_atomic_load_ptr_relaxed(&task->task_worker) != NULL) {
+        ret = worker_push((WorkerObj *)task->task_worker, task,
+                          (HandleObj *)handle);
+    }
+    Py_DECREF(handle);
+    return ret;
+}
+
+static int
+handle_run(HandleObj *h)
+{
+    _Py_IDENTIFIER(run);
+    PyObject *callback = h->h_callback;
+    PyObject *context = h->h_context;
+    PyObject *args, *res;
+
+    if (h->h_state != HANDLE_PRIVATE &&
+            !_Py_atomic_compare_exchange_int(&h->h_state, HANDLE_QUEUED,
+                                             HANDLE_CLAIMED)) {
+        /* The task was stolen by another worker */
+        return 0;
+    }
+
+    /* The callback may cancel the handle */
+    Py_INCREF(callback);
+    Py_INCREF(context);
+    if (PyTuple_CheckExact(h->h_args)) {
+        args = h->h_args;
+        Py_INCREF(args);
+    }
+    else {
+        args = PySequence_Tuple(h->h_args);
+        if (args == NULL) {
+            res = NULL;
+            goto done;
+        }
+    }
+
+    if (PyContext_CheckExact(context)) {
+        if (PyContext_Enter(context) < 0) {
+            res = NULL;
+            goto done;
+        }
+        res = PyObject_Vectorcall(callback, &PyTuple_GET_ITEM(args, 0),
+                                  PyTuple_GET_SIZE(args), NULL);
+        if (PyContext_Exit(context) < 0) {
+            Py_CLEAR(res);
+        }
+    }
+    else {
+        PyObject *run_args = PyTuple_New(PyTuple_GET_SIZE(args) + 1);
+        if (run_args == NULL) {
+            res = NULL;
+            goto done;
+        }
+        Py_INCREF(callback);
+        PyTuple_SET_ITEM(run_args, 0, callback);
+        for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(args); i++) {
+            PyObject *arg = PyTuple_GET_ITEM(args, i);
+            Py_INCREF(arg);
+            PyTuple_SET_ITEM(run_args, i + 1, arg);
+        }
+        PyObject *run = _PyObject_GetAttrId(context, &PyId_run);
+        res = run ? PyObject_Call(run, run_args, NULL) : NULL;
+        Py_XDECREF(run);
+        Py_DECREF(run_args);
+    }
+
+done:
+    /* The task of the callback has left its context: only now may its next
+       step run on another worker. */
+    if (res == NULL) {
+        PyObject *et, *ev, *tb;
+        PyErr_Fetch(&et, &ev, &tb);
+        if (task_publish_next_step(callback) < 0) {
+            _PyErr_ChainExceptions(et, ev, tb);
+        }
+        else {
+            PyErr_Restore(et, ev, tb);
+        }
+    }
+    else if (task_publish_next_step(callback) < 0) {
+        Py_CLEAR(res);
+    }
+    Py_DECREF(callback);
+    Py_DECREF(context);
+    Py_XDECREF(args);
+    if (res != NULL) {
+        Py_DECREF(res);
+        return 0;
+    }
+    if (PyErr_ExceptionMatches(PyExc_SystemExit) ||
+        PyErr_ExceptionMatches(PyExc_KeyboardInterrupt)) {
+        return -1;
+    }
+    return handle_report_exception(h);
+}
+
+/*[clinic input]
+_asyncio.Handle._run
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_Handle__run_impl(HandleObj *self)
+/*[clinic end generated code: output=1b186b710881500a input=94fc71ae0ddc7106]*/
+{
+    if (handle_run(self) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_asyncio.Handle._repr_info
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_Handle__repr_info_impl(HandleObj *self)
+/*[clinic end generated code: output=7838b12075048d03 input=dba1c0a083077d57]*/
+{
+    PyObject *info, *item;
+    int has_tb;
+
+    info = PyList_New(0);
+    if (info == NULL) {
+        return NULL;
+    }
+    item = PyUnicode_FromString(_PyType_Name(Py_TYPE(self)));
+    if (item == NULL || PyList_Append(info, item) < 0) {
+        goto fail;
+    }
+    Py_DECREF(item);
+    if (self->h_cancelled) {
+        item = PyUnicode_FromString("cancelled");
+        if (item == NULL || PyList_Append(info, item) < 0) {
+            goto fail;
+        }
+        Py_DECREF(item);
+    }
+    if (TimerHandle_Check(self)) {
+        item = PyUnicode_FromFormat("when=%S",
+                                    ((TimerHandleObj *)self)->th_when);
+        if (item == NULL || PyList_Append(info, item) < 0) {
+            goto fail;
+        }
+        Py_DECREF(item);
+    }
+    if (self->h_callback != Py_None) {
+        item = PyObject_CallFunctionObjArgs(
+            asyncio_format_callback_source_func,
+            self->h_callback, self->h_args, NULL);
+        if (item == NULL || PyList_Append(info, item) < 0) {
+            goto fail;
+        }
+        Py_DECREF(item);
+    }
+    has_tb = PyObject_IsTrue(self->h_source_tb);
+    if (has_tb < 0) {
+        Py_DECREF(info);
+        return NULL;
+    }
+    if (has_tb) {
+        PyObject *frame = PySequence_GetItem(self->h_source_tb, -1);
+        if (frame == NULL) {
+            Py_DECREF(info);
+            return NULL;
+        }
+        PyObject *filename = PySequence_GetItem(frame, 0);
+        PyObject *lineno = filename ? PySequence_GetItem(frame, 1) : NULL;
+        Py_DECREF(frame);
+        item = lineno ? PyUnicode_FromFormat("created at %S:%S",
+                                             filename, lineno) : NULL;
+        Py_XDECREF(filename);
+        Py_XDECREF(lineno);
+        if (item == NULL || PyList_Append(info, item) < 0) {
+            goto fail;
+        }
+        Py_DECREF(item);
+    }
+    return info;
+
+fail:
+    Py_XDECREF(item);
+    Py_DECREF(info);
+    return NULL;
+}
+
+static PyObject *
+HandleObj_repr(HandleObj *h)
+{
+    _Py_IDENTIFIER(_repr_info);
+
+    if (h->h_repr != NULL && h->h_repr != Py_None) {
+        Py_INCREF(h->h_repr);
+        return h->h_repr;
+    }
+
+    PyObject *rinfo = _PyObject_CallMethodIdNoArgs((PyObject*)h,
+                                                   &PyId__repr_info);
+    if (rinfo == NULL) {
+        return NULL;
+    }
+
+    PyObject *rinfo_s = PyUnicode_Join(NULL, rinfo);
+    Py_DECREF(rinfo);
+    if (rinfo_s == NULL) {
+        return NULL;
+    }
+
+    PyObject *rstr = PyUnicode_FromFormat("<%U>", rinfo_s);
+    Py_DECREF(rinfo_s);
+    return rstr;
+}
+
+static void
+HandleObj_dealloc(PyObject *self)
+{
+    HandleObj *h = (HandleObj *)self;
+
+    PyObject_GC_UnTrack(self);
+
+    if (h->h_weakreflist != NULL) {
+        PyObject_ClearWeakRefs(self);
+    }
+
+    (void)HandleObj_clear(h);
+    if (TimerHandle_Check(h)) {
+        Py_CLEAR(((TimerHandleObj *)h)->th_when);
+    }
+    if (handle_pool_push(h)) {
+        return;
+    }
+    Py_TYPE(h)->tp_free(h);
+}
+
+static PyMethodDef HandleType_methods[] = {
+    _ASYNCIO_HANDLE_CANCEL_METHODDEF
+    _ASYNCIO_HANDLE_CANCELLED_METHODDEF
+    _ASYNCIO_HANDLE__RUN_METHODDEF
+    _ASYNCIO_HANDLE__REPR_INFO_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+#define HANDLE_COMMON_MEMBERS(TYPE, prefix)                                   \
+    {"_callback", T_OBJECT, offsetof(TYPE, prefix##_callback), READONLY},     \
+    {"_args", T_OBJECT, offsetof(TYPE, prefix##_args), READONLY},             \
+    {"_loop", T_OBJECT, offsetof(TYPE, prefix##_loop), READONLY},             \
+    {"_context", T_OBJECT, offsetof(TYPE, prefix##_context), READONLY},       \
+    {"_source_traceback", T_OBJECT, offsetof(TYPE, prefix##_source_tb),       \
+                          READONLY},                                          \
+    {"_repr", T_OBJECT, offsetof(TYPE, prefix##_repr), 0},                    \
+    {"_cancelled", T_BOOL, offsetof(TYPE, prefix##_cancelled), 0},
+
+static PyMemberDef HandleType_members[] = {
+    HANDLE_COMMON_MEMBERS(HandleObj, h)
+    {NULL} /* Sentinel */
+};
+
+static PyTypeObject HandleType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_asyncio.Handle",
+    sizeof(HandleObj),                       /* tp_basicsize */
+    .tp_dealloc = HandleObj_dealloc,
+    .tp_repr = (reprfunc)HandleObj_repr,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_BASETYPE,
+    .tp_doc = _asyncio_Handle___init____doc__,
+    .tp_traverse = (traverseproc)HandleObj_traverse,
+    .tp_clear = (inquiry)HandleObj_clear,
+    .tp_weaklistoffset = offsetof(HandleObj, h_weakreflist),
+    .tp_methods = HandleType_methods,
+    .tp_members = HandleType_members,
+    .tp_init = (initproc)_asyncio_Handle___init__,
+    .tp_new = HandleObj_new,
+};
+
+
+/* ----- TimerHandle */
+
+/*[clinic input]
+_asyncio.TimerHandle.__init__
+
+    when: object
+    callback: object
+    args as callback_args: object
+    loop: object
+    context: object = None
+
+Object returned by timed callback registration methods.
+[clinic start generated code]*/
+
+static int
+_asyncio_TimerHandle___init___impl(TimerHandleObj *self, PyObject *when,
+                                   PyObject *callback,
+                                   PyObject *callback_args, PyObject *loop,
+                                   PyObject *context)
+/*[clinic end generated code: output=15759937528ba819 input=7354f2bd261e1296]*/
+{
+    if (when == Py_None) {
+        PyErr_SetString(PyExc_AssertionError, "when cannot be None");
+        return -1;
+    }
+    if (handle_init((HandleObj *)self, callback, callback_args, loop,
+                    context) < 0) {
+        return -1;
+    }
+    Py_INCREF(when);
+    Py_XSETREF(self->th_when, when);
+    self->th_scheduled = 0;
+    return 0;
+}
+
+static int
+TimerHandleObj_clear(TimerHandleObj *th)
+{
+    (void)HandleObj_clear((HandleObj *)th);
+    Py_CLEAR(th->th_when);
+    return 0;
+}
+
+static int
+TimerHandleObj_traverse(TimerHandleObj *th, visitproc visit, void *arg)
+{
+    Py_VISIT(th->th_when);
+    return HandleObj_traverse((HandleObj *)th, visit, arg);
+}
+
+static int
+timer_handle_eq(TimerHandleObj *a, TimerHandleObj *b)
+{
+    int res = PyObject_RichCompareBool(a->th_when, b->th_when, Py_EQ);
+    if (res > 0) {
+        res = PyObject_RichCompareBool(a->th_callback, b->th_callback, Py_EQ);
+    }
+    if (res > 0) {
+        res = PyObject_RichCompareBool(a->th_args, b->th_args, Py_EQ);
+    }
+    if (res > 0) {
+        res = a->th_cancelled == b->th_cancelled;
+    }
+    return res;
+}
+
+static PyObject *
+TimerHandleObj_richcompare(TimerHandleObj *self, PyObject *other, int op)
+{
+    int res;
+
+    if (!TimerHandle_Check(other)) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    TimerHandleObj *o = (TimerHandleObj *)other;
+    switch (op) {
+    case Py_LT:
+    case Py_GT:
+        return PyObject_RichCompare(self->th_when, o->th_when, op);
+    case Py_LE:
+    case Py_GE:
+        res = PyObject_RichCompareBool(self->th_when, o->th_when,
+                                       op == Py_LE ? Py_LT : Py_GT);
+        if (res == 0) {
+            res = timer_handle_eq(self, o);
+        }
+        break;
+    case Py_EQ:
+        res = timer_handle_eq(self, o);
+        break;
+    default:
+        res = timer_handle_eq(self, o);
+        if (res >= 0) {
+            res = !res;
+        }
+        break;
+    }
+    if (res < 0) {
+        return NULL;
+    }
+    return PyBool_FromLong(res);
+}
+
+static Py_hash_t
+TimerHandleObj_hash(TimerHandleObj *self)
+{
+    return PyObject_Hash(self->th_when);
+}
+
+/*[clinic input]
+_asyncio.TimerHandle.when
+
+Return a scheduled callback time.
+
+The time is an absolute timestamp, using the same time
+reference as loop.time().
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_TimerHandle_when_impl(TimerHandleObj *self)
+/*[clinic end generated code: output=cab0e5577e51b3af input=de801fd191075931]*/
+{
+    Py_INCREF(self->th_when);
+    return self->th_when;
+}
+
+static PyMethodDef TimerHandleType_methods[] = {
+    _ASYNCIO_TIMERHANDLE_WHEN_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PyMemberDef TimerHandleType_members[] = {
+    HANDLE_COMMON_MEMBERS(TimerHandleObj, th)
+    {"_when", T_OBJECT, offsetof(TimerHandleObj, th_when), READONLY},
+    {"_scheduled", T_BOOL, offsetof(TimerHandleObj, th_scheduled), 0},
+    {NULL} /* Sentinel */
+};
+
+static PyTypeObject TimerHandleType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_asyncio.TimerHandle",
+    sizeof(TimerHandleObj),                  /* tp_basicsize */
+    .tp_base = &HandleType,
+    .tp_dealloc = HandleObj_dealloc,
+    .tp_repr = (reprfunc)HandleObj_repr,
+    .tp_hash = (hashfunc)TimerHandleObj_hash,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_BASETYPE,
+    .tp_doc = _asyncio_TimerHandle___init____doc__,
+    .tp_traverse = (traverseproc)TimerHandleObj_traverse,
+    .tp_clear = (inquiry)TimerHandleObj_clear,
+    .tp_richcompare = (richcmpfunc)TimerHandleObj_richcompare,
+    .tp_weaklistoffset = offsetof(TimerHandleObj, th_weakreflist),
+    .tp_methods = TimerHandleType_methods,
+    .tp_members = TimerHandleType_members,
+    .tp_init = (initproc)_asyncio_TimerHandle___init__,
+    .tp_new = HandleObj_new,
+};
+
+
+/* ----- Event loop core */
+
+/* These mirror the constants of the same names in asyncio/base_events.py */
+#define MIN_SCHEDULED_TIMER_HANDLES 100
+#define MIN_CANCELLED_TIMER_HANDLES_FRACTION 0.5
+#define MAXIMUM_SELECT_TIMEOUT (24 * 3600)
+
+static int
+handle_is_cancelled(PyObject *handle)
+{
+    _Py_IDENTIFIER(_cancelled);
+
+    if (Handle_CheckExact(handle) || TimerHandle_CheckExact(handle)) {
+        return ((HandleObj *)handle)->h_cancelled;
+    }
+    PyObject *cancelled = _PyObject_GetAttrId(handle, &PyId__cancelled);
+    if (cancelled == NULL) {
+        return -1;
+    }
+    int res = PyObject_IsTrue(cancelled);
+    Py_DECREF(cancelled);
+    return res;
+}
+
+static int
+timer_handle_unschedule(PyObject *handle)
+{
+    _Py_IDENTIFIER(_scheduled);
+
+    if (TimerHandle_CheckExact(handle)) {
+        ((TimerHandleObj *)handle)->th_scheduled = 0;
+        return 0;
+    }
+    return _PyObject_SetAttrId(handle, &PyId__scheduled, Py_False);
+}
+
+static PyObject *
+timer_handle_when(PyObject *handle)
+{
+    _Py_IDENTIFIER(_when);
+
+    if (TimerHandle_CheckExact(handle)) {
+        PyObject *when = ((TimerHandleObj *)handle)->th_when;
+        Py_INCREF(when);
+        return when;
+    }
+    return _PyObject_GetAttrId(handle, &PyId__when);
+}
+
+/* Same as a < b for timer handles, without leaving C when both are
+   TimerHandle objects scheduled at float times. */
+static int
+timer_handle_lt(PyObject *a, PyObject *b)
+{
+    if (TimerHandle_CheckExact(a) && TimerHandle_CheckExact(b)) {
+        PyObject *wa = ((TimerHandleObj *)a)->th_when;
+        PyObject *wb = ((TimerHandleObj *)b)->th_when;
+        if (PyFloat_CheckExact(wa) && PyFloat_CheckExact(wb)) {
+            return PyFloat_AS_DOUBLE(wa) < PyFloat_AS_DOUBLE(wb);
+        }
+    }
+    return PyObject_RichCompareBool(a, b, Py_LT);
+}
+
+/* The timer heap is the loop's _scheduled list, kept in the same order as
+   the heapq module keeps it; the sift functions are those of
+   Modules/_heapqmodule.c. */
+
+static int
+timer_heap_siftdown(PyListObject *heap, Py_ssize_t startpos, Py_ssize_t pos)
+{
+    PyObject *newitem, *parent, **arr;
+    Py_ssize_t parentpos, size;
+    int cmp;
+
+    size = PyList_GET_SIZE(heap);
+    arr = _PyList_ITEMS(heap);
+    newitem = arr[pos];
+    while (pos > startpos) {
+        parentpos = (pos - 1) >> 1;
+        parent = arr[parentpos];
+        Py_INCREF(newitem);
+        Py_INCREF(parent);
+        cmp = timer_handle_lt(newitem, parent);
+        Py_DECREF(parent);
+        Py_DECREF(newitem);
+        if (cmp < 0)
+            return -1;
+        if (size != PyList_GET_SIZE(heap)) {
+            PyErr_SetString(PyExc_RuntimeError,
+                            "list changed size during iteration");
+            return -1;
+        }
+        if (cmp == 0)
+            break;
+        arr = _PyList_ITEMS(heap);
+        parent = arr[parentpos];
+        newitem = arr[pos];
+        arr[parentpos] = newitem;
+        arr[pos] = parent;
+        pos = parentpos;
+    }
+    return 0;
+}
+
+static int
+timer_heap_siftup(PyListObject *heap, Py_ssize_t pos)
+{
+    Py_ssize_t startpos, endpos, childpos, limit;
+    PyObject *tmp1, *tmp2, **arr;
+    int cmp;
+
+    endpos = PyList_GET_SIZE(heap);
+    startpos = pos;
+    arr = _PyList_ITEMS(heap);
+    limit = endpos >> 1;         /* smallest pos that has no child */
+    while (pos < limit) {
+        /* Set childpos to index of smaller child.   */
+        childpos = 2*pos + 1;    /* leftmost child position  */
+        if (childpos + 1 < endpos) {
+            PyObject* a = arr[childpos];
+            PyObject* b = arr[childpos + 1];
+            Py_INCREF(a);
+            Py_INCREF(b);
+            cmp = timer_handle_lt(a, b);
+            Py_DECREF(a);
+            Py_DECREF(b);
+            if (cmp < 0)
+                return -1;
+            childpos += ((unsigned)cmp ^ 1);   /* increment when cmp==0 */
+            arr = _PyList_ITEMS(heap);         /* arr may have changed */
+            if (endpos != PyList_GET_SIZE(heap)) {
+                PyErr_SetString(PyExc_RuntimeError,
+                                "list changed size during iteration");
+                return -1;
+            }
+        }
+        /* Move the smaller child up. */
+        tmp1 = arr[childpos];
+        tmp2 = arr[pos];
+        arr[childpos] = tmp2;
+        arr[pos] = tmp1;
+        pos = childpos;
+    }
+    /* Bubble it up to its final resting place (by sifting its parents down). */
+    return timer_heap_siftdown(heap, startpos, pos);
+}
+
+static PyObject *
+timer_heap_pop(PyObject *heap)
+{
+    PyObject *lastelt, *returnitem;
+    Py_ssize_t n;
+
+    n = PyList_GET_SIZE(heap);
+    assert(n > 0);
+    lastelt = PyList_GET_ITEM(heap, n-1);
+    Py_INCREF(lastelt);
+    if (PyList_SetSlice(heap, n-1, n, NULL)) {
+        Py_DECREF(lastelt);
+        return NULL;
+    }
+    n--;
+
+    if (!n)
+        return lastelt;
+    returnitem = PyList_GET_ITEM(heap, 0);
+    PyList_SET_ITEM(heap, 0, lastelt);
+    if (timer_heap_siftup((PyListObject *)heap, 0)) {
+        Py_DECREF(returnitem);
+        return NULL;
+    }
+    return returnitem;
+}
+
+static int
+timer_heap_heapify(PyObject *heap)
+{
+    Py_ssize_t n = PyList_GET_SIZE(heap);
+    for (Py_ssize_t i = (n >> 1) - 1; i >= 0; i--) {
+        if (timer_heap_siftup((PyListObject *)heap, i)) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+/*[clinic input]
+_asyncio._run_once
+
+    loop: object
+    /
+
+Run one full iteration of the event loop.
+
+This is the C implementation of BaseEventLoop._run_once() used when the
+loop is not in debug mode.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__run_once(PyObject *module, PyObject *loop)
+/*[clinic end generated code: output=b61344df108d4a87 input=81b61934de0b0d37]*/
+{
+    _Py_IDENTIFIER(_scheduled);
+    _Py_IDENTIFIER(_timer_cancelled_count);
+    _Py_IDENTIFIER(_ready);
+    _Py_IDENTIFIER(_stopping);
+    _Py_IDENTIFIER(_selector);
+    _Py_IDENTIFIER(select);
+    _Py_IDENTIFIER(_process_events);
+    _Py_IDENTIFIER(time);
+    _Py_IDENTIFIER(_clock_resolution);
+    _Py_IDENTIFIER(append);
+    _Py_IDENTIFIER(popleft);
+    _Py_IDENTIFIER(_run);
+    PyObject *scheduled = NULL, *ready = NULL, *timeout = NULL;
+    PyObject *end_time = NULL, *append = NULL, *popleft = NULL;
+    PyObject *handle = NULL, *obj, *res;
+    Py_ssize_t cancelled_count, sched_count, ntodo;
+    int is_true;
+
+    scheduled = _PyObject_GetAttrId(loop, &PyId__scheduled);
+    if (scheduled == NULL) {
+        goto error;
+    }
+    if (!PyList_Check(scheduled)) {
+        PyErr_SetString(PyExc_TypeError, "loop._scheduled must be a list");
+        goto error;
+    }
+    obj = _PyObject_GetAttrId(loop, &PyId__timer_cancelled_count);
+    if (obj == NULL) {
+        goto error;
+    }
+    cancelled_count = PyLong_AsSsize_t(obj);
+    Py_DECREF(obj);
+    if (cancelled_count == -1 && PyErr_Occurred()) {
+        goto error;
+    }
+
+    sched_count = PyList_GET_SIZE(scheduled);
+    if (sched_count > MIN_SCHEDULED_TIMER_HANDLES &&
+        (double)cancelled_count / sched_count >
+            MIN_CANCELLED_TIMER_HANDLES_FRACTION) {
+        /* Remove delayed calls that were cancelled if their number
+           is too high */
+        PyObject *new_scheduled = PyList_New(0);
+        if (new_scheduled == NULL) {
+            goto error;
+        }
+        for (Py_ssize_t i = 0; i < PyList_GET_SIZE(scheduled); i++) {
+            handle = PyList_GET_ITEM(scheduled, i);
+            Py_INCREF(handle);
+            is_true = handle_is_cancelled(handle);
+            if (is_true > 0) {
+                is_true = timer_handle_unschedule(handle);
+            }
+            else if (is_true == 0) {
+                is_true = PyList_Append(new_scheduled, handle);
+            }
+            Py_CLEAR(handle);
+            if (is_true < 0) {
+                Py_DECREF(new_scheduled);
+                goto error;
+            }
+        }
+        Py_SETREF(scheduled, new_scheduled);
+        if (timer_heap_heapify(scheduled) < 0 ||
+            _PyObject_SetAttrId(loop, &PyId__scheduled, scheduled) < 0 ||
+            _PyObject_SetAttrId(loop, &PyId__timer_cancelled_count,
+                                _PyLong_Zero) < 0) {
+            goto error;
+        }
+    }
+    else {
+        /* Remove delayed calls that were cancelled from head of queue. */
+        while (PyList_GET_SIZE(scheduled) > 0) {
+            handle = PyList_GET_ITEM(scheduled, 0);
+            Py_INCREF(handle);
+            is_true = handle_is_cancelled(handle);
+            Py_CLEAR(handle);
+            if (is_true < 0) {
+                goto error;
+            }
+            if (!is_true) {
+                break;
+            }
+            obj = PyLong_FromSsize_t(--cancelled_count);
+            if (obj == NULL) {
+                goto error;
+            }
+            is_true = _PyObject_SetAttrId(loop, &PyId__timer_cancelled_count,
+                                          obj);
+            Py_DECREF(obj);
+            if (is_true < 0) {
+                goto error;
+            }
+            handle = timer_heap_pop(scheduled);
+            if (handle == NULL || timer_handle_unschedule(handle) < 0) {
+                goto error;
+            }
+            Py_CLEAR(handle);
+        }
+    }
+
+    ready = _PyObject_GetAttrId(loop, &PyId__ready);
+    if (ready == NULL) {
+        goto error;
+    }
+    is_true = PyObject_IsTrue(ready);
+    if (is_true == 0) {
+        obj = _PyObject_GetAttrId(loop, &PyId__stopping);
+        if (obj == NULL) {
+            goto error;
+        }
+        is_true = PyObject_IsTrue(obj);
+        Py_DECREF(obj);
+    }
+    if (is_true < 0) {
+        goto error;
+    }
+    if (is_true) {
+        timeout = _PyLong_Zero;
+        Py_INCREF(timeout);
+    }
+    else if (PyList_GET_SIZE(scheduled) > 0) {
+        /* Compute the desired timeout:
+           min(max(0, when - self.time()), MAXIMUM_SELECT_TIMEOUT) */
+        PyObject *when = timer_handle_when(PyList_GET_ITEM(scheduled, 0));
+        if (when == NULL) {
+            goto error;
+        }
+        obj = _PyObject_CallMethodIdNoArgs(loop, &PyId_time);
+        if (obj == NULL) {
+            Py_DECREF(when);
+            goto error;
+        }
+        timeout = PyNumber_Subtract(when, obj);
+        Py_DECREF(when);
+        Py_DECREF(obj);
+        if (timeout == NULL) {
+            goto error;
+        }
+        is_true = PyObject_RichCompareBool(timeout, _PyLong_Zero, Py_GT);
+        if (is_true == 0) {
+            Py_INCREF(_PyLong_Zero);
+            Py_SETREF(timeout, _PyLong_Zero);
+        }
+        else if (is_true > 0) {
+            obj = PyLong_FromLong(MAXIMUM_SELECT_TIMEOUT);
+            if (obj == NULL) {
+                goto error;
+            }
+            is_true = PyObject_RichCompareBool(obj, timeout, Py_LT);
+            if (is_true > 0) {
+                Py_SETREF(timeout, obj);
+            }
+            else {
+                Py_DECREF(obj);
+            }
+        }
+        if (is_true < 0) {
+            goto error;
+        }
+    }
+    else {
+        timeout = Py_None;
+        Py_INCREF(timeout);
+    }
+
+    obj = _PyObject_GetAttrId(loop, &PyId__selector);
+    if (obj == NULL) {
+        goto error;
+    }
+    res = _PyObject_CallMethodIdOneArg(obj, &PyId_select, timeout);
+    Py_DECREF(obj);
+    if (res == NULL) {
+        goto error;
+    }
+    obj = res;
+    res = _PyObject_CallMethodIdOneArg(loop, &PyId__process_events, obj);
+    Py_DECREF(obj);
+    if (res == NULL) {
+        goto error;
+    }
+    Py_DECREF(res);
+
+    /* Callbacks run by _process_events() may have scheduled timers */
+    Py_SETREF(scheduled, _PyObject_GetAttrId(loop, &PyId__scheduled));
+    if (scheduled == NULL) {
+        goto error;
+    }
+    if (!PyList_Check(scheduled)) {
+        PyErr_SetString(PyExc_TypeError, "loop._scheduled must be a list");
+        goto error;
+    }
+    Py_SETREF(ready, _PyObject_GetAttrId(loop, &PyId__ready));
+    if (ready == NULL) {
+        goto error;
+    }
+
+    /* Handle 'later' callbacks that are ready. */
+    if (PyList_GET_SIZE(scheduled) > 0) {
+        obj = _PyObject_CallMethodIdNoArgs(loop, &PyId_time);
+        if (obj == NULL) {
+            goto error;
+        }
+        res = _PyObject_GetAttrId(loop, &PyId__clock_resolution);
+        if (res == NULL) {
+            Py_DECREF(obj);
+            goto error;
+        }
+        end_time = PyNumber_Add(obj, res);
+        Py_DECREF(obj);
+        Py_DECREF(res);
+        if (end_time == NULL) {
+            goto error;
+        }
+        append = _PyObject_GetAttrId(ready, &PyId_append);
+        if (append == NULL) {
+            goto error;
+        }
+    }
+    while (PyList_GET_SIZE(scheduled) > 0) {
+        handle = PyList_GET_ITEM(scheduled, 0);
+        Py_INCREF(handle);
+        obj = timer_handle_when(handle);
+        Py_CLEAR(handle);
+        if (obj == NULL) {
+            goto error;
+        }
+        if (PyFloat_CheckExact(obj) && PyFloat_CheckExact(end_time)) {
+            is_true = PyFloat_AS_DOUBLE(obj) >= PyFloat_AS_DOUBLE(end_time);
+        }
+        else {
+            is_true = PyObject_RichCompareBool(obj, end_time, Py_GE);
+        }
+        Py_DECREF(obj);
+        if (is_true < 0) {
+            goto error;
+        }
+        if (is_true) {
+            break;
+        }
+        handle = timer_heap_pop(scheduled);
+        if (handle == NULL || timer_handle_unschedule(handle) < 0) {
+            goto error;
+        }
+        res = PyObject_CallOneArg(append, handle);
+        if (res == NULL) {
+            goto error;
+        }
+        Py_DECREF(res);
+        Py_CLEAR(handle);
+    }
+
+    /* This is the only place where callbacks are actually *called*.
+       All other places just add them to ready.  We run all currently
+       scheduled callbacks, but not any callbacks scheduled by callbacks
+       run this time around -- they will be run the next time (after
+       another I/O poll). */
+    ntodo = PyObject_Length(ready);
+    if (ntodo < 0) {
+        goto error;
+    }
+    if (ntodo > 0) {
+        popleft = _PyObject_GetAttrId(ready, &PyId_popleft);
+        if (popleft == NULL) {
+            goto error;
+        }
+    }
+    for (Py_ssize_t i = 0; i < ntodo; i++) {
+        handle = PyObject_CallNoArgs(popleft);
+        if (handle == NULL) {
+            goto error;
+        }
+        is_true = handle_is_cancelled(handle);
+        if (is_true < 0) {
+            goto error;
+        }
+        if (!is_true) {
+            if (Handle_CheckExact(handle) || TimerHandle_CheckExact(handle)) {
+                if (handle_run((HandleObj *)handle) < 0) {
+                    goto error;
+                }
+            }
+            else {
+                res = _PyObject_CallMethodIdNoArgs(handle, &PyId__run);
+                if (res == NULL) {
+                    goto error;
+                }
+                Py_DECREF(res);
+            }
+        }
+        Py_CLEAR(handle);
+    }
+
+    Py_DECREF(scheduled);
+    Py_DECREF(ready);
+    Py_DECREF(timeout);
+    Py_XDECREF(end_time);
+    Py_XDECREF(append);
+    Py_XDECREF(popleft);
+    Py_RETURN_NONE;
+
+error:
+    Py_XDECREF(scheduled);
+    Py_XDECREF(ready);
+    Py_XDECREF(timeout);
+    Py_XDECREF(end_time);
+    Py_XDECREF(append);
+    Py_XDECREF(popleft);
+    Py_XDECREF(handle);
+    return NULL;
+}
+
+
+/*********************** Worker **************************/
+
+
+/*[clinic input]
+class _asyncio.Worker "WorkerObj *" "&WorkerType"
+class _asyncio.WorkerGroup "WorkerGroupObj *" "&WorkerGroupType"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=243cefe678e0b896]*/
+
+/* A WorkerGroup ties together event loops that are run by different
+   threads.  Tasks created with Worker.create_task() may move between the
+   loops of the group: whenever such a task becomes runnable, the handle
+   that will run its next step is also published in the queue of the
+   worker that owns the task, and a worker that has nothing to run takes
+   tasks from the queues of the others.
+
+   The owning loop and a thief race for a queued handle through its state
+   (see HANDLE_QUEUED), so a step runs exactly once.  The thief moves the
+   task to its own loop while holding the victim's mutex and schedules the
+   step again with call_soon() on its own loop.  Tasks only move between
+   two of their steps, so enter_task() and leave_task() always see a task
+   on the loop that is running it. */
+
+#define WORKER_STEAL_MAX 32
+
+#define WORKER_ENTRY(w, i) \
+    ((w)->w_queue[((w)->w_head + (i)) % (w)->w_capacity])
+
+static void
+worker_entries_clear(worker_entry *entries, Py_ssize_t n)
+{
+    for (Py_ssize_t i = 0; i < n; i++) {
+        Py_DECREF(entries[i].task);
+        Py_DECREF(entries[i].handle);
+    }
+}
+
+/* Called with w->w_mutex held */
+static int
+worker_queue_grow(WorkerObj *w)
+{
+    Py_ssize_t capacity = w->w_capacity ? w->w_capacity * 2 : 16;
+    worker_entry *queue = PyMem_RawMalloc(capacity * sizeof(worker_entry));
+    if (queue == NULL) {
+        return -1;
+    }
+    for (Py_ssize_t i = 0; i < w->w_size; i++) {
+        queue[i] = WORKER_ENTRY(w, i);
+    }
+    PyMem_RawFree(w->w_queue);
+    w->w_queue = queue;
+    w->w_head = 0;
+    w->w_capacity = capacity;
+    return 0;
+}
+
+static int
+worker_wake_one(WorkerObj *w)
+{
+    _Py_IDENTIFIER(_write_to_self);
+    WorkerGroupObj *group = (WorkerGroupObj *)w->w_group;
+    Py_ssize_t n = PyTuple_GET_SIZE(group->wg_workers);
+
+    for (Py_ssize_t i = 1; i < n; i++) {
+        WorkerObj *other = (WorkerObj *)PyTuple_GET_ITEM(
+            group->wg_workers, (w->w_index + i) % n);
+        if (_Py_atomic_load_int_relaxed(&other->w_idle) &&
+                _Py_atomic_compare_exchange_int(&other->w_idle, 1, 0)) {
+            _Py_atomic_add_int(&group->wg_nidle, -1);
+            PyObject *res = _PyObject_CallMethodIdNoArgs(
+                other->w_loop, &PyId__write_to_self);
+            if (res == NULL) {
+                return -1;
+            }
+            Py_DECREF(res);
+            return 0;
+        }
+    }
+    return 0;
+}
+
+static int
+worker_push(WorkerObj *w, TaskObj *task, HandleObj *handle)
+{
+    WorkerGroupObj *group = (WorkerGroupObj *)w->w_group;
+    worker_entry dropped[WORKER_STEAL_MAX];
+    Py_ssize_t ndropped = 0;
+    Py_ssize_t size;
+
+    if (_Py_atomic_load_int_relaxed(&group->wg_closed)) {
+        return 0;
+    }
+
+    Py_INCREF(task);
+    Py_INCREF(handle);
+    handle->h_state = HANDLE_QUEUED;
+
+    _PyMutex_lock(&w->w_mutex);
+    /* Forget the oldest entries once their handles have been claimed */
+    while (w->w_size > 0 && ndropped < WORKER_STEAL_MAX) {
+        worker_entry *e = &WORKER_ENTRY(w, 0);
+        if (_Py_atomic_load_int_relaxed(&e->handle->h_state) == HANDLE_QUEUED
+                && e->task->task_worker == (PyObject *)w) {
+            break;
+        }
+        dropped[ndropped++] = *e;
+        w->w_head = (w->w_head + 1) % w->w_capacity;
+        w->w_size--;
+    }
+    if (w->w_size == w->w_capacity && worker_queue_grow(w) < 0) {
+        _PyMutex_unlock(&w->w_mutex);
+        handle->h_state = HANDLE_PRIVATE;
+        Py_DECREF(task);
+        Py_DECREF(handle);
+        worker_entries_clear(dropped, ndropped);
+        PyErr_NoMemory();
+        return -1;
+    }
+    WORKER_ENTRY(w, w->w_size).task = task;
+    WORKER_ENTRY(w, w->w_size).handle = handle;
+    w->w_size++;
+    size = w->w_size;
+    _PyMutex_unlock(&w->w_mutex);
+
+    worker_entries_clear(dropped, ndropped);
+
+    /* Only share work when there is more than the loop is about to run */
+    if (size >= 2 && _Py_atomic_load_int_relaxed(&group->wg_nidle) > 0) {
+        return worker_wake_one(w);
+    }
+    return 0;
+}
+
+static Py_ssize_t
+worker_steal(WorkerObj *thief)
+{
+    WorkerGroupObj *group = (WorkerGroupObj *)thief->w_group;
+    Py_ssize_t n = PyTuple_GET_SIZE(group->wg_workers);
+    worker_entry stolen[WORKER_STEAL_MAX];
+    worker_entry dropped[WORKER_STEAL_MAX];
+    Py_ssize_t nstolen = 0;
+    Py_ssize_t ndropped = 0;
+
+    if (n < 2 || _Py_atomic_load_int_relaxed(&group->wg_closed)) {
+        return 0;
+    }
+
+    /* Become idle before looking for work, so that a task published in
+       the meantime wakes this worker up. */
+    if (_Py_atomic_compare_exchange_int(&thief->w_idle, 0, 1)) {
+        _Py_atomic_add_int(&group->wg_nidle, 1);
+    }
+
+    for (Py_ssize_t i = 0; i < n - 1 && nstolen == 0; i++) {
+        Py_ssize_t k = (thief->w_next_victim + i) % (n - 1);
+        WorkerObj *victim = (WorkerObj *)PyTuple_GET_ITEM(
+            group->wg_workers, (thief->w_index + 1 + k) % n);
+        if (_Py_atomic_load_ssize_relaxed(&victim->w_size) < 2) {
+            continue;
+        }
+
+        _PyMutex_lock(&victim->w_mutex);
+        /* Take the newest half: the victim's loop runs the oldest first */
+        Py_ssize_t want = Py_MIN(victim->w_size / 2, WORKER_STEAL_MAX);
+        while (nstolen < want && victim->w_size > 0 &&
+               ndropped < WORKER_STEAL_MAX) {
+            victim->w_size--;
+            worker_entry e = WORKER_ENTRY(victim, victim->w_size);
+            if (e.task->task_worker == (PyObject *)victim &&
+                    !e.handle->h_cancelled &&
+                    _Py_atomic_compare_exchange_int(&e.handle->h_state,
+                                                    HANDLE_QUEUED,
+                                                    HANDLE_CLAIMED)) {
+                /* The victim holds other references to its loop and the
+                   group to the victim, so these can't be the last ones. */
+                Py_INCREF(thief->w_loop);
+                Py_SETREF(e.task->task_loop, thief->w_loop);
+                Py_INCREF(thief);
+                Py_SETREF(e.task->task_worker, (PyObject *)thief);
+                stolen[nstolen++] = e;
+            }
+            else {
+                dropped[ndropped++] = e;
+            }
+        }
+        _PyMutex_unlock(&victim->w_mutex);
+    }
+    thief->w_next_victim++;
+
+    if (nstolen > 0 &&
+            _Py_atomic_compare_exchange_int(&thief->w_idle, 1, 0)) {
+        _Py_atomic_add_int(&group->wg_nidle, -1);
+    }
+
+    int err = 0;
+    for (Py_ssize_t i = 0; i < nstolen && !err; i++) {
+        HandleObj *h = stolen[i].handle;
+        assert(PyTuple_Check(h->h_args));
+        PyObject *arg = NULL;
+        if (PyTuple_GET_SIZE(h->h_args) > 0) {
+            arg = PyTuple_GET_ITEM(h->h_args, 0);
+        }
+        err = call_soon(thief->w_loop, h->h_callback, arg, h->h_context);
+    }
+    worker_entries_clear(stolen, nstolen);
+    worker_entries_clear(dropped, ndropped);
+    return err ? -1 : nstolen;
+}
+
+/*[clinic input]
+_asyncio.Worker.create_task
+
+    coro: object
+    *
+    name: object = None
+
+Create a Task on the loop of the worker that other workers may take.
+
+Must be called by the thread that runs the worker's loop.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_Worker_create_task_impl(WorkerObj *self, PyObject *coro,
+                                 PyObject *name)
+/*[clinic end generated code: output=045bd974d49ad26f input=4db7f207cbcc1581]*/
+{
+    TaskObj *task = (TaskObj *)TaskType.tp_alloc(&TaskType, 0);
+    if (task == NULL) {
+        return NULL;
+    }
+    Py_INCREF(self);
+    task->task_worker = (PyObject *)self;
+    if (_asyncio_Task___init___impl(task, coro, self->w_loop, name) < 0) {
+        Py_DECREF(task);
+        return NULL;
+    }
+    return (PyObject *)task;
+}
+
+/*[clinic input]
+_asyncio.Worker.steal
+
+Move runnable tasks of other workers of the group to this worker's loop.
+
+Return the number of tasks taken.  If there were none, the worker is
+marked idle and its loop is woken up when another worker has tasks to
+spare.  Must be called by the thread that runs the worker's loop.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_Worker_steal_impl(WorkerObj *self)
+/*[clinic end generated code: output=f79bab3fa1e4bf92 input=f9c097e5465f504e]*/
+{
+    Py_ssize_t n = worker_steal(self);
+    if (n < 0) {
+        return NULL;
+    }
+    return PyLong_FromSsize_t(n);
+}
+
+static int
+WorkerObj_traverse(WorkerObj *w, visitproc visit, void *arg)
+{
+    Py_VISIT(w->w_loop);
+    Py_VISIT(w->w_group);
+    for (Py_ssize_t i = 0; i < w->w_size; i++) {
+        Py_VISIT(WORKER_ENTRY(w, i).task);
+        Py_VISIT(WORKER_ENTRY(w, i).handle);
+    }
+    return 0;
+}
+
+static int
+WorkerObj_clear(WorkerObj *w)
+{
+    Py_CLEAR(w->w_loop);
+    Py_CLEAR(w->w_group);
+    while (w->w_size > 0) {
+        worker_entry e = WORKER_ENTRY(w, 0);
+        w->w_head = (w->w_head + 1) % w->w_capacity;
+        w->w_size--;
+        worker_entries_clear(&e, 1);
+    }
+    return 0;
+}
+
+static void
+WorkerObj_dealloc(WorkerObj *w)
+{
+    PyObject_GC_UnTrack(w);
+    (void)WorkerObj_clear(w);
+    PyMem_RawFree(w->w_queue);
+    Py_TYPE(w)->tp_free(w);
+}
+
+static PyMethodDef WorkerType_methods[] = {
+    _ASYNCIO_WORKER_CREATE_TASK_METHODDEF
+    _ASYNCIO_WORKER_STEAL_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PyMemberDef WorkerType_members[] = {
+    {"loop", T_OBJECT, offsetof(WorkerObj, w_loop), READONLY},
+    {"index", T_PYSSIZET, offsetof(WorkerObj, w_index), READONLY},
+    {NULL}  /* Sentinel */
+};
+
+static PyTypeObject WorkerType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_asyncio.Worker",
+    sizeof(WorkerObj),                      /* tp_basicsize */
+    .tp_dealloc = (destructor)WorkerObj_dealloc,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
+    .tp_traverse = (traverseproc)WorkerObj_traverse,
+    .tp_clear = (inquiry)WorkerObj_clear,
+    .tp_methods = WorkerType_methods,
+    .tp_members = WorkerType_members,
+};
+
+/*[clinic input]
+@classmethod
+_asyncio.WorkerGroup.__new__ as worker_group_new
+
+    loops: object
+    /
+
+A group of event loops that share the tasks created by their workers.
+
+Each loop must be run by a different thread.
+[clinic start generated code]*/
+
+static PyObject *
+worker_group_new_impl(PyTypeObject *type, PyObject *loops)
+/*[clinic end generated code: output=019f12dc3fab45e7 input=627d2557ecef81ad]*/
+{
+    WorkerGroupObj *group;
+    PyObject *workers;
+    Py_ssize_t n;
+
+    loops = PySequence_Tuple(loops);
+    if (loops == NULL) {
+        return NULL;
+    }
+    n = PyTuple_GET_SIZE(loops);
+    if (n == 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "a worker group needs at least one loop");
+        Py_DECREF(loops);
+        return NULL;
+    }
+    group = (WorkerGroupObj *)type->tp_alloc(type, 0);
+    if (group == NULL) {
+        Py_DECREF(loops);
+        return NULL;
+    }
+    workers = PyTuple_New(n);
+    if (workers == NULL) {
+        goto error;
+    }
+    group->wg_workers = workers;
+    for (Py_ssize_t i = 0; i < n; i++) {
+        WorkerObj *w = (WorkerObj *)WorkerType.tp_alloc(&WorkerType, 0);
+        if (w == NULL) {
+            goto error;
+        }
+        Py_INCREF(PyTuple_GET_ITEM(loops, i));
+        w->w_loop = PyTuple_GET_ITEM(loops, i);
+        Py_INCREF(group);
+        w->w_group = (PyObject *)group;
+        w->w_index = i;
+        PyTuple_SET_ITEM(workers, i, (PyObject *)w);
+    }
+    Py_DECREF(loops);
+    return (PyObject *)group;
+
+error:
+    Py_DECREF(loops);
+    Py_DECREF(group);
+    return NULL;
+}
+
+/*[clinic input]
+_asyncio.WorkerGroup.close
+
+Stop sharing tasks between the workers of the group.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_WorkerGroup_close_impl(WorkerGroupObj *self)
+/*[clinic end generated code: output=2e9ab8cd6a5d3c9c input=665061989637e3c1]*/
+{
+    Py_ssize_t n = PyTuple_GET_SIZE(self->wg_workers);
+
+    _Py_atomic_store_int(&self->wg_closed, 1);
+    for (Py_ssize_t i = 0; i < n; i++) {
+        WorkerObj *w = (WorkerObj *)PyTuple_GET_ITEM(self->wg_workers, i);
+        _PyMutex_lock(&w->w_mutex);
+        worker_entry *queue = w->w_queue;
+        Py_ssize_t head = w->w_head;
+        Py_ssize_t size = w->w_size;
+        Py_ssize_t capacity = w->w_capacity;
+        w->w_queue = NULL;
+        w->w_head = w->w_size = w->w_capacity = 0;
+        _PyMutex_unlock(&w->w_mutex);
+
+        for (Py_ssize_t j = 0; j < size; j++) {
+            worker_entries_clear(&queue[(head + j) % capacity], 1);
+        }
+        PyMem_RawFree(queue);
+        if (_Py_atomic_compare_exchange_int(&w->w_idle, 1, 0)) {
+            _Py_atomic_add_int(&self->wg_nidle, -1);
+        }
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+WorkerGroupObj_get_workers(WorkerGroupObj *group, void *Py_UNUSED(ignored))
+{
+    Py_INCREF(group->wg_workers);
+    return group->wg_workers;
+}
+
+static int
+WorkerGroupObj_traverse(WorkerGroupObj *group, visitproc visit, void *arg)
+{
+    Py_VISIT(group->wg_workers);
+    return 0;
+}
+
+static int
+WorkerGroupObj_clear(WorkerGroupObj *group)
+{
+    Py_CLEAR(group->wg_workers);
+    return 0;
+}
+
+static void
+WorkerGroupObj_dealloc(WorkerGroupObj *group)
+{
+    PyObject_GC_UnTrack(group);
+    (void)WorkerGroupObj_clear(group);
+    Py_TYPE(group)->tp_free(group);
+}
+
+static PyMethodDef WorkerGroupType_methods[] = {
+    _ASYNCIO_WORKERGROUP_CLOSE_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PyGetSetDef WorkerGroupType_getsetlist[] = {
+    {"workers", (getter)WorkerGroupObj_get_workers, NULL, NULL},
+    {NULL} /* Sentinel */
+};
+
+static PyTypeObject WorkerGroupType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_asyncio.WorkerGroup",
+    sizeof(WorkerGroupObj),                 /* tp_basicsize */
+    .tp_dealloc = (destructor)WorkerGroupObj_dealloc,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
+    .tp_doc = worker_group_new__doc__,
+    .tp_traverse = (traverseproc)WorkerGroupObj_traverse,
+    .tp_clear = (inquiry)WorkerGroupObj_clear,
+    .tp_methods = WorkerGroupType_methods,
+    .tp_getset = WorkerGroupType_getsetlist,
+    .tp_new = worker_group_new,
+};
+
+
+/*********************** Functions **************************/
+
+
+/*[clinic input]
+_asyncio._get_running_loop
+
+Return the running event loop or None.
+
+This is a low-level function intended to be used by event loops.
+This function is thread-specific.
+
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__get_running_loop_impl(PyObject *module)
+/*[clinic end generated code: output=b4390af721411a0a input=0a21627e25a4bd43]*/
+{
+    PyObject *loop;
+    if (get_running_loop(&loop)) {
+        return NULL;
+    }
+    if (loop == NULL) {
+        /* There's no currently running event loop */
+        Py_RETURN_NONE;
+    }
+    return loop;
+}
+
+/*[clinic input]
+_asyncio._set_running_loop
+    loop: 'O'
+    /
+
+Set the running event loop.
+
+This is a low-level function intended to be used by event loops.
+This function is thread-specific.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__set_running_loop(PyObject *module, PyObject *loop)
+/*[clinic end generated code: output=ae56bf7a28ca189a input=4c9720233d606604]*/
+{
+    if (set_running_loop(loop)) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_asyncio.get_event_loop
+
+Return an asyncio event loop.
+
+When called from a coroutine or a callback (e.g. scheduled with
+call_soon or similar API), this function will always return the
+running event loop.
+
+If there is no running event loop set, the function will return
+the result of `get_event_loop_policy().get_event_loop()` call.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_get_event_loop_impl(PyObject *module)
+/*[clinic end generated code: output=2a2d8b2f824c648b input=9364bf2916c8655d]*/
+{
+    return get_event_loop();
+}
+
+/*[clinic input]
+_asyncio.get_running_loop
+
+Return the running event loop.  Raise a RuntimeError if there is none.
+
+This function is thread-specific.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_get_running_loop_impl(PyObject *module)
+/*[clinic end generated code: output=c247b5f9e529530e input=2a3bf02ba39f173d]*/
+{
+    PyObject *loop;
+    if (get_running_loop(&loop)) {
+        return NULL;
+    }
+    if (loop == NULL) {
+        /* There's no currently running event loop */
+        PyErr_SetString(
+            PyExc_RuntimeError, "no running event loop");
+    }
+    return loop;
+}
+
+/*[clinic input]
+_asyncio._register_task
+
+    task: object
+
+Register a new task in asyncio as executed by loop.
+
+Returns None.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__register_task_impl(PyObject *module, PyObject *task)
+/*[clinic end generated code: output=8672dadd69a7d4e2 input=21075aaea14dfbad]*/
+{
+    if (register_task(task) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
 /*[clinic input]
 _asyncio._unregister_task
 
@@ -3176,6 +5246,26 @@ _asyncio__unregister_task_impl(PyObject *module, PyObject *task)
 }
 
 
+/*[clinic input]
+_asyncio._linked_tasks
+
+    loop: object
+    /
+
+Return a list of the C tasks of the loop, including the done ones.
+
+Task-like objects registered with _register_task() are not included,
+they are in _all_tasks.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__linked_tasks(PyObject *module, PyObject *loop)
+/*[clinic end generated code: output=571347527256f234 input=ca99146bc8d9e850]*/
+{
+    return linked_tasks(loop);
+}
+
+
 /*[clinic input]
 _asyncio._enter_task
 
@@ -3224,6 +5314,50 @@ _asyncio__leave_task_impl(PyObject *module, PyObject *loop, PyObject *task)
 }
 
 
+/*[clinic input]
+_asyncio._pin_task
+
+    task: object
+    /
+
+Keep a task created by a Worker on its current loop and return the loop.
+
+After this call other workers of the group no longer take the task, so it
+can be safely manipulated from its loop's thread.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__pin_task(PyObject *module, PyObject *task)
+/*[clinic end generated code: output=778a1675d071f00f input=6dc21d89c0973d47]*/
+{
+    _Py_IDENTIFIER(get_loop);
+
+    if (!Task_Check(task)) {
+        return _PyObject_CallMethodIdNoArgs(task, &PyId_get_loop);
+    }
+    TaskObj *t = (TaskObj *)task;
+    ENSURE_FUTURE_ALIVE(t)
+
+    for (;;) {
+        WorkerObj *w = _Py_atomic_load_ptr(&t->task_worker);
+        if (w == NULL) {
+            break;
+        }
+        /* Thieves move the task while holding its worker's mutex */
+        _PyMutex_lock(&w->w_mutex);
+        if (t->task_worker == (PyObject *)w) {
+            t->task_worker = NULL;
+            _PyMutex_unlock(&w->w_mutex);
+            Py_DECREF(w);
+            break;
+        }
+        _PyMutex_unlock(&w->w_mutex);
+    }
+    Py_INCREF(t->task_loop);
+    return t->task_loop;
+}
+
+
 /*********************** PyRunningLoopHolder ********************/
 
 
@@ -3284,6 +5418,8 @@ module_free(void *m)
     Py_CLEAR(asyncio_task_repr_info_func);
     Py_CLEAR(asyncio_InvalidStateError);
     Py_CLEAR(asyncio_CancelledError);
+    Py_CLEAR(asyncio_format_callback_source_func);
+    Py_CLEAR(asyncio_extract_stack_func);
 
     Py_CLEAR(all_tasks);
     Py_CLEAR(current_tasks);
@@ -3291,6 +5427,8 @@ module_free(void *m)
 
     Py_CLEAR(context_kwname);
 
+    handle_pool_clear();
+
     module_initialized = 0;
 }
 
@@ -3354,6 +5492,10 @@ module_init(void)
     WITH_MOD("asyncio.coroutines")
     GET_MOD_ATTR(asyncio_iscoroutine_func, "iscoroutine")
 
+    WITH_MOD("asyncio.format_helpers")
+    GET_MOD_ATTR(asyncio_format_callback_source_func, "_format_callback_source")
+    GET_MOD_ATTR(asyncio_extract_stack_func, "extract_stack")
+
     WITH_MOD("traceback")
     GET_MOD_ATTR(traceback_extract_stack, "extract_stack")
 
@@ -3388,8 +5530,11 @@ static PyMethodDef asyncio_methods[] = {
     _ASYNCIO__SET_RUNNING_LOOP_METHODDEF
     _ASYNCIO__REGISTER_TASK_METHODDEF
     _ASYNCIO__UNREGISTER_TASK_METHODDEF
+    _ASYNCIO__LINKED_TASKS_METHODDEF
     _ASYNCIO__ENTER_TASK_METHODDEF
     _ASYNCIO__LEAVE_TASK_METHODDEF
+    _ASYNCIO__RUN_ONCE_METHODDEF
+    _ASYNCIO__PIN_TASK_METHODDEF
     {NULL, NULL}
 };
 
@@ -3424,13 +5569,17 @@ PyInit__asyncio(void)
     if (PyType_Ready(&PyRunningLoopHolder_Type) < 0) {
         return NULL;
     }
+    if (PyType_Ready(&WorkerType) < 0) {
+        return NULL;
+    }
 
     PyObject *m = PyModule_Create(&_asynciomodule);
     if (m == NULL) {
         return NULL;
     }
 
-    /* FutureType and TaskType are made ready by PyModule_AddType() calls below. */
+    /* FutureType, TaskType, HandleType, TimerHandleType and WorkerGroupType
+       are made ready by PyModule_AddType() calls below. */
     if (PyModule_AddType(m, &FutureType) < 0) {
         Py_DECREF(m);
         return NULL;
@@ -3441,6 +5590,21 @@ PyInit__asyncio(void)
         return NULL;
     }
 
+    if (PyModule_AddType(m, &HandleType) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+
+    if (PyModule_AddType(m, &TimerHandleType) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+
+    if (PyModule_AddType(m, &WorkerGroupType) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+
     Py_INCREF(all_tasks);
     if (PyModule_AddObject(m, "_all_tasks", all_tasks) < 0) {
         Py_DECREF(all_tasks);
@@ -41,6 +41,14 @@ typedef struct {
     blake2s_param    param;
     blake2s_state    state;
     PyThread_type_lock lock;
+    /* Tree mode (threads > 0): state is the root node and the data is
+       hashed in leaves of leaf_param.leaf_length bytes. */
+    int              threads;
+    blake2s_param    leaf_param;
+    blake2s_state    leaf;          /* Current leaf */
+    uint64_t         leaf_index;
+    uint32_t         leaf_used;     /* Bytes hashed in the current leaf */
+    uint8_t          key_block[BLAKE2S_BLOCKBYTES];
 } BLAKE2sObject;
 
 #include "clinic/blake2s_impl.c.h"
@@ -59,10 +67,199 @@ new_BLAKE2sObject(PyTypeObject *type)
     self = (BLAKE2sObject *)type->tp_alloc(type, 0);
     if (self != NULL) {
         self->lock = NULL;
+        self->threads = 0;
     }
     return self;
 }
 
+
+/* Tree hashing.
+ *
+ * With threads > 0, the data is hashed as a BLAKE2 tree of depth 2 and
+ * unlimited fanout: the leaves are consecutive pieces of leaf_size bytes,
+ * each hashed to inner_size bytes at node_depth 0 with its index as
+ * node_offset, and the root hashes the leaf digests in order at node_depth 1.
+ * The last leaf and the root are flagged as last nodes.  All nodes are
+ * keyed.  The digest doesn't depend on the number of threads: full leaves
+ * of a large update are just hashed on up to `threads` threads at once.
+ */
+
+#define TREE_LEAF_SIZE (64 * 1024)
+
+static void
+tree_leaf_init(const BLAKE2sObject *self, blake2s_state *S, uint64_t index)
+{
+    blake2s_param P = self->leaf_param;
+
+#ifdef HAVE_BLAKE2S
+    store48(&P.node_offset, index);
+#else
+    store64(&P.node_offset, index);
+#endif
+    blake2s_init_param(S, &P);
+    if (P.key_length) {
+        blake2s_update(S, self->key_block, BLAKE2S_BLOCKBYTES);
+    }
+    secure_zero_memory(&P, sizeof(P));
+}
+
+typedef struct {
+    const BLAKE2sObject *self;
+    const uint8_t *buf;         /* Input of the first leaf */
+    uint8_t *digests;           /* Digests of the leaves */
+    Py_ssize_t nleaves;
+    Py_ssize_t next_leaf;       /* Next leaf to hash; updated atomically */
+    Py_ssize_t running;         /* Threads still hashing; updated atomically */
+    PyThread_type_lock done;    /* Released by the last thread to finish */
+} tree_leaves;
+
+static void
+tree_leaves_run(tree_leaves *tl)
+{
+    const BLAKE2sObject *self = tl->self;
+    uint32_t leaf_length = load32(&self->leaf_param.leaf_length);
+    uint8_t inner_length = self->leaf_param.inner_length;
+    blake2s_state S;
+
+    for (;;) {
+        Py_ssize_t i = _Py_atomic_add_ssize(&tl->next_leaf, 1);
+        if (i >= tl->nleaves) {
+            break;
+        }
+        tree_leaf_init(self, &S, self->leaf_index + i);
+        blake2s_update(&S, tl->buf + (size_t)i * leaf_length, leaf_length);
+        blake2s_final(&S, tl->digests + (size_t)i * inner_length,
+                      inner_length);
+    }
+    secure_zero_memory(&S, sizeof(S));
+}
+
+static void
+tree_leaves_worker(void *arg)
+{
+    tree_leaves *tl = (tree_leaves *)arg;
+    tree_leaves_run(tl);
+    /* Don't touch tl after the last thread releases the lock */
+    if (_Py_atomic_add_ssize(&tl->running, -1) == 1) {
+        PyThread_release_lock(tl->done);
+    }
+}
+
+/* Hash nleaves full leaves, none of them the last one, starting at the
+   current leaf index, and add their digests to the root.  May be called
+   without the GIL. */
+static void
+tree_hash_leaves(BLAKE2sObject *self, const uint8_t *buf, Py_ssize_t nleaves)
+{
+    uint32_t leaf_length = load32(&self->leaf_param.leaf_length);
+    uint8_t inner_length = self->leaf_param.inner_length;
+    tree_leaves tl;
+    Py_ssize_t nworkers, i;
+
+    tl.digests = NULL;
+    tl.done = NULL;
+    if (self->threads > 1 && nleaves > 1) {
+        tl.digests = PyMem_RawMalloc((size_t)nleaves * inner_length);
+        tl.done = PyThread_allocate_lock();
+    }
+    if (tl.digests == NULL || tl.done == NULL) {
+        /* One leaf at a time on this thread */
+        uint8_t digest[BLAKE2S_OUTBYTES];
+        for (i = 0; i < nleaves; i++) {
+            tree_leaf_init(self, &self->leaf, self->leaf_index);
+            blake2s_update(&self->leaf, buf, leaf_length);
+            blake2s_final(&self->leaf, digest, inner_length);
+            blake2s_update(&self->state, digest, inner_length);
+            self->leaf_index++;
+            buf += leaf_length;
+        }
+        PyMem_RawFree(tl.digests);
+        if (tl.done != NULL) {
+            PyThread_free_lock(tl.done);
+        }
+        return;
+    }
+
+    tl.self = self;
+    tl.buf = buf;
+    tl.nleaves = nleaves;
+    tl.next_leaf = 0;
+    PyThread_acquire_lock(tl.done, WAIT_LOCK);
+    /* This thread hashes leaves too.  If a helper thread can't be started,
+       the remaining threads pick up its share. */
+    nworkers = Py_MIN((Py_ssize_t)self->threads, nleaves) - 1;
+    tl.running = nworkers + 1;
+    for (i = 0; i < nworkers; i++) {
+        if (PyThread_start_new_thread(tree_leaves_worker, &tl) ==
+                PYTHREAD_INVALID_THREAD_ID) {
+            _Py_atomic_add_ssize(&tl.running, -1);
+        }
+    }
+    tree_leaves_worker(&tl);
+    PyThread_acquire_lock(tl.done, WAIT_LOCK);
+    PyThread_free_lock(tl.done);
+
+    blake2s_update(&self->state, tl.digests, (size_t)nleaves * inner_length);
+    self->leaf_index += nleaves;
+    PyMem_RawFree(tl.digests);
+}
+
+/* Feed data to the hash.  May be called without the GIL. */
+static void
+blake2s_feed(BLAKE2sObject *self, const uint8_t *buf, Py_ssize_t len)
+{
+    uint32_t leaf_length;
+
+    if (self->threads == 0) {
+        blake2s_update(&self->state, buf, len);
+        return;
+    }
+
+    leaf_length = load32(&self->leaf_param.leaf_length);
+    while (len > 0) {
+        if (self->leaf_used == leaf_length) {
+            /* More data follows, so the current leaf is not the last one */
+            uint8_t digest[BLAKE2S_OUTBYTES];
+            blake2s_final(&self->leaf, digest, self->leaf_param.inner_length);
+            blake2s_update(&self->state, digest,
+                           self->leaf_param.inner_length);
+            self->leaf_index++;
+            self->leaf_used = 0;
+            if (len > leaf_length) {
+                /* Full leaves followed by more data */
+                Py_ssize_t nleaves = (len - 1) / leaf_length;
+                tree_hash_leaves(self, buf, nleaves);
+                buf += nleaves * leaf_length;
+                len -= nleaves * leaf_length;
+            }
+            tree_leaf_init(self, &self->leaf, self->leaf_index);
+        }
+        uint32_t n = (uint32_t)Py_MIN(len, leaf_length - self->leaf_used);
+        blake2s_update(&self->leaf, buf, n);
+        self->leaf_used += n;
+        buf += n;
+        len -= n;
+    }
+}
+
+/* Compute the digest of the data so far, with the object locked. */
+static void
+blake2s_get_digest(BLAKE2sObject *self, uint8_t *digest)
+{
+    blake2s_state state_cpy = self->state;
+
+    if (self->threads > 0) {
+        uint8_t leaf_digest[BLAKE2S_OUTBYTES];
+        blake2s_state leaf_cpy = self->leaf;
+        leaf_cpy.last_node = 1;
+        blake2s_final(&leaf_cpy, leaf_digest, self->leaf_param.inner_length);
+        blake2s_update(&state_cpy, leaf_digest, self->leaf_param.inner_length);
+        secure_zero_memory(&leaf_cpy, sizeof(leaf_cpy));
+    }
+    blake2s_final(&state_cpy, digest, self->param.digest_length);
+    secure_zero_memory(&state_cpy, sizeof(state_cpy));
+}
+
 /*[clinic input]
 @classmethod
 _blake2.blake2s.__new__ as py_blake2s_new
@@ -81,6 +278,7 @@ _blake2.blake2s.__new__ as py_blake2s_new
     inner_size: int = 0
     last_node: bool = False
     usedforsecurity: bool = True
+    threads: int = 0
 
 Return a new BLAKE2s hash object.
 [clinic start generated code]*/
@@ -90,8 +288,9 @@ py_blake2s_new_impl(PyTypeObject *type, PyObject *data, int digest_size,
                     Py_buffer *key, Py_buffer *salt, Py_buffer *person,
                     int fanout, int depth, unsigned long leaf_size,
                     unsigned long long node_offset, int node_depth,
-                    int inner_size, int last_node, int usedforsecurity)
-/*[clinic end generated code: output=556181f73905c686 input=4dda87723f23abb0]*/
+                    int inner_size, int last_node, int usedforsecurity,
+                    int threads)
+/*[clinic end generated code: output=8dd694da4e95fe54 input=5fa91dc801a596aa]*/
 {
     BLAKE2sObject *self = NULL;
     Py_buffer buf;
@@ -101,6 +300,18 @@ py_blake2s_new_impl(PyTypeObject *type, PyObject *data, int digest_size,
         goto error;
     }
 
+    if (threads < 0) {
+        PyErr_SetString(PyExc_ValueError, "threads must not be negative");
+        goto error;
+    }
+    if (threads > 0 && (fanout != 1 || depth != 1 || node_offset != 0 ||
+                        node_depth != 0 || last_node)) {
+        PyErr_SetString(PyExc_ValueError,
+                "threads can't be combined with fanout, depth, node_offset, "
+                "node_depth or last_node");
+        goto error;
+    }
+
     /* Zero parameter block. */
     memset(&self->param, 0, sizeof(self->param));
 
@@ -195,6 +406,31 @@ py_blake2s_new_impl(PyTypeObject *type, PyObject *data, int digest_size,
         self->param.key_length = (uint8_t)key->len;
     }
 
+    if (threads > 0) {
+        /* Set the parameters of the tree; the leaves differ from the root
+           in their digest size, node_offset and node_depth. */
+        self->threads = threads;
+        self->param.fanout = 0;
+        self->param.depth = 2;
+        if (leaf_size == 0) {
+            store32(&(self->param.leaf_length), TREE_LEAF_SIZE);
+        }
+        if (inner_size == 0) {
+            self->param.inner_length = BLAKE2S_OUTBYTES;
+        }
+        self->leaf_param = self->param;
+        self->leaf_param.digest_length = self->param.inner_length;
+        self->param.node_depth = 1;
+        last_node = 1;
+        if (self->param.key_length) {
+            memset(self->key_block, 0, sizeof(self->key_block));
+            memcpy(self->key_block, key->buf, key->len);
+        }
+        tree_leaf_init(self, &self->leaf, 0);
+        self->leaf_index = 0;
+        self->leaf_used = 0;
+    }
+
     /* Initialize hash state. */
     if (blake2s_init_param(&self->state, &self->param) < 0) {
         PyErr_SetString(PyExc_RuntimeError,
@@ -220,10 +456,10 @@ py_blake2s_new_impl(PyTypeObject *type, PyObject *data, int digest_size,
 
         if (buf.len >= HASHLIB_GIL_MINSIZE) {
             Py_BEGIN_ALLOW_THREADS
-            blake2s_update(&self->state, buf.buf, buf.len);
+            blake2s_feed(self, buf.buf, buf.len);
             Py_END_ALLOW_THREADS
         } else {
-            blake2s_update(&self->state, buf.buf, buf.len);
+            blake2s_feed(self, buf.buf, buf.len);
         }
         PyBuffer_Release(&buf);
     }
@@ -255,6 +491,14 @@ _blake2_blake2s_copy_impl(BLAKE2sObject *self)
     ENTER_HASHLIB(self);
     cpy->param = self->param;
     cpy->state = self->state;
+    cpy->threads = self->threads;
+    if (self->threads > 0) {
+        cpy->leaf_param = self->leaf_param;
+        cpy->leaf = self->leaf;
+        cpy->leaf_index = self->leaf_index;
+        cpy->leaf_used = self->leaf_used;
+        memcpy(cpy->key_block, self->key_block, sizeof(cpy->key_block));
+    }
     LEAVE_HASHLIB(self);
     return (PyObject *)cpy;
 }
@@ -282,11 +526,11 @@ _blake2_blake2s_update(BLAKE2sObject *self, PyObject *data)
     if (self->lock != NULL) {
        Py_BEGIN_ALLOW_THREADS
        PyThread_acquire_lock(self->lock, 1);
-       blake2s_update(&self->state, buf.buf, buf.len);
+       blake2s_feed(self, buf.buf, buf.len);
        PyThread_release_lock(self->lock);
        Py_END_ALLOW_THREADS
     } else {
-        blake2s_update(&self->state, buf.buf, buf.len);
+        blake2s_feed(self, buf.buf, buf.len);
     }
     PyBuffer_Release(&buf);
 
@@ -304,11 +548,9 @@ _blake2_blake2s_digest_impl(BLAKE2sObject *self)
 /*[clinic end generated code: output=40c566ca4bc6bc51 input=f41e0b8d6d937454]*/
 {
     uint8_t digest[BLAKE2S_OUTBYTES];
-    blake2s_state state_cpy;
 
     ENTER_HASHLIB(self);
-    state_cpy = self->state;
-    blake2s_final(&state_cpy, digest, self->param.digest_length);
+    blake2s_get_digest(self, digest);
     LEAVE_HASHLIB(self);
     return PyBytes_FromStringAndSize((const char *)digest,
             self->param.digest_length);
@@ -325,11 +567,9 @@ _blake2_blake2s_hexdigest_impl(BLAKE2sObject *self)
 /*[clinic end generated code: output=15153eb5e59c52eb input=c77a1321567e8952]*/
 {
     uint8_t digest[BLAKE2S_OUTBYTES];
-    blake2s_state state_cpy;
 
     ENTER_HASHLIB(self);
-    state_cpy = self->state;
-    blake2s_final(&state_cpy, digest, self->param.digest_length);
+    blake2s_get_digest(self, digest);
     LEAVE_HASHLIB(self);
     return _Py_strhex((const char *)digest, self->param.digest_length);
 }
@@ -387,6 +627,11 @@ py_blake2s_dealloc(PyObject *self)
     /* Try not to leave state in memory. */
     secure_zero_memory(&obj->param, sizeof(obj->param));
     secure_zero_memory(&obj->state, sizeof(obj->state));
+    if (obj->threads > 0) {
+        secure_zero_memory(&obj->leaf_param, sizeof(obj->leaf_param));
+        secure_zero_memory(&obj->leaf, sizeof(obj->leaf));
+        secure_zero_memory(obj->key_block, sizeof(obj->key_block));
+    }
     if (obj->lock) {
         PyThread_free_lock(obj->lock);
         obj->lock = NULL;
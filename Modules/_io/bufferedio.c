@@ -230,11 +230,10 @@ typedef struct {
        isn't ready for writing. */
     Py_off_t write_end;
 
-    /* TODO: sgross merge this with rlock */
-    PyThread_type_lock lock;
-    volatile unsigned long owner;
-
+    /* Serializes all operations on the object.  While held, `busy` is set
+       between ENTER_BUFFERED and LEAVE_BUFFERED to catch reentrant calls. */
     _PyRecursiveMutex rlock;
+    char busy;
 
     Py_ssize_t buffer_size;
     Py_ssize_t buffer_mask;
@@ -266,51 +265,29 @@ typedef struct {
 
 */
 
-/* These macros protect the buffered object against concurrent operations. */
+/* These macros protect the buffered object against concurrent operations.
+
+   Every caller already holds self->rlock (the "@ rlock" methods and the
+   getters and tp_iternext that lock it by hand), which excludes other
+   threads.  What is left is to detect a reentrant call from the owning
+   thread, e.g. from a signal handler or a raw stream calling back into the
+   buffered object, and that only needs a plain flag: it is only read and
+   written by the rlock owner. */
 
 static int
 _enter_buffered_busy(buffered *self)
 {
-    int relax_locking;
-    PyLockStatus st;
-    if (self->owner == PyThread_get_thread_ident()) {
-        PyErr_Format(PyExc_RuntimeError,
-                     "reentrant call inside %R", self);
-        return 0;
-    }
-    relax_locking = _Py_IsFinalizing();
-    Py_BEGIN_ALLOW_THREADS
-    if (!relax_locking)
-        st = PyThread_acquire_lock(self->lock, 1);
-    else {
-        /* When finalizing, we don't want a deadlock to happen with daemon
-         * threads abruptly shut down while they owned the lock.
-         * Therefore, only wait for a grace period (1 s.).
-         * Note that non-daemon threads have already exited here, so this
-         * shouldn't affect carefully written threaded I/O code.
-         */
-        st = PyThread_acquire_lock_timed(self->lock, (PY_TIMEOUT_T)1e6, 0);
-    }
-    Py_END_ALLOW_THREADS
-    if (relax_locking && st != PY_LOCK_ACQUIRED) {
-        PyObject *ascii = PyObject_ASCII((PyObject*)self);
-        _Py_FatalErrorFormat(__func__,
-            "could not acquire lock for %s at interpreter "
-            "shutdown, possibly due to daemon threads",
-            ascii ? PyUnicode_AsUTF8(ascii) : "<ascii(self) failed>");
-    }
-    return 1;
+    PyErr_Format(PyExc_RuntimeError,
+                 "reentrant call inside %R", self);
+    return 0;
 }
 
 #define ENTER_BUFFERED(self) \
-    ( (PyThread_acquire_lock(self->lock, 0) ? \
-       1 : _enter_buffered_busy(self)) \
-     && (self->owner = PyThread_get_thread_ident(), 1) )
+    ( (self)->busy ? _enter_buffered_busy(self) : ((self)->busy = 1, 1) )
 
 #define LEAVE_BUFFERED(self) \
     do { \
-        self->owner = 0; \
-        PyThread_release_lock(self->lock); \
+        self->busy = 0; \
     } while(0);
 
 #define CHECK_INITIALIZED(self) \
@@ -394,10 +371,6 @@ buffered_dealloc(buffered *self)
         PyMem_Free(self->buffer);
         self->buffer = NULL;
     }
-    if (self->lock) {
-        PyThread_free_lock(self->lock);
-        self->lock = NULL;
-    }
     Py_CLEAR(self->dict);
     Py_TYPE(self)->tp_free((PyObject *)self);
 }
@@ -791,14 +764,7 @@ _buffered_init(buffered *self)
         PyErr_NoMemory();
         return -1;
     }
-    if (self->lock)
-        PyThread_free_lock(self->lock);
-    self->lock = PyThread_allocate_lock();
-    if (self->lock == NULL) {
-        PyErr_SetString(PyExc_RuntimeError, "can't allocate read lock");
-        return -1;
-    }
-    self->owner = 0;
+    self->busy = 0;
     /* Find out whether buffer_size is a power of 2 */
     /* XXX is this optimization useful? */
     for (n = self->buffer_size - 1; n & 1; n >>= 1)
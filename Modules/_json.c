@@ -10,7 +10,6 @@
 
 #include "Python.h"
 #include "structmember.h"         // PyMemberDef
-#include "pycore_accu.h"
 
 typedef struct {
     PyObject *PyScannerType;
@@ -96,11 +95,11 @@ encoder_dealloc(PyObject *self);
 static int
 encoder_clear(PyEncoderObject *self);
 static int
-encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc, PyObject *seq, Py_ssize_t indent_level);
+encoder_listencode_list(PyEncoderObject *s, _PyUnicodeWriter *writer, PyObject *seq, Py_ssize_t indent_level);
 static int
-encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc, PyObject *obj, Py_ssize_t indent_level);
+encoder_listencode_obj(PyEncoderObject *s, _PyUnicodeWriter *writer, PyObject *obj, Py_ssize_t indent_level);
 static int
-encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc, PyObject *dct, Py_ssize_t indent_level);
+encoder_listencode_dict(PyEncoderObject *s, _PyUnicodeWriter *writer, PyObject *dct, Py_ssize_t indent_level);
 static PyObject *
 _encoded_const(PyObject *obj);
 static void
@@ -113,6 +112,41 @@ encoder_encode_float(PyEncoderObject *s, PyObject *obj);
 #define S_CHAR(c) (c >= ' ' && c <= '~' && c != '\\' && c != '"')
 #define IS_WHITESPACE(c) (((c) == ' ') || ((c) == '\t') || ((c) == '\n') || ((c) == '\r'))
 
+/* Word-at-a-time scanning of 1-byte kind strings.  A size_t holds
+   SIZEOF_SIZE_T characters and SPECIAL_WORD(v) is nonzero if any of them
+   is a double quote, a backslash or a control character, i.e. a character
+   that ends a run of plain string content for both the scanner and the
+   encoder.  HAS_ZERO() and HAS_LESS() are exact for bytes in 0..255, so a
+   zero result means the whole word can be skipped. */
+#define WORD_ONES ((size_t)-1 / 0xFF)
+#define WORD_HIGHS (WORD_ONES * 0x80)
+#define HAS_ZERO(v) (((v) - WORD_ONES) & ~(v) & WORD_HIGHS)
+#define HAS_LESS(v, n) (((v) - WORD_ONES * (n)) & ~(v) & WORD_HIGHS)
+#define SPECIAL_WORD(v) (HAS_ZERO((v) ^ (WORD_ONES * '"')) | \
+                         HAS_ZERO((v) ^ (WORD_ONES * '\\')) | \
+                         HAS_LESS((v), ' '))
+
+static inline Py_ssize_t
+skip_plain_ucs1(const Py_UCS1 *s, Py_ssize_t i, Py_ssize_t end, int ascii_only)
+{
+    /* Skip whole words of s[i:end] that contain no special character and
+       return the index where the caller's per-character loop must resume.
+       If ascii_only is true, characters above '~' are special too. */
+    while (end - i >= SIZEOF_SIZE_T) {
+        size_t v, special;
+        memcpy(&v, s + i, SIZEOF_SIZE_T);
+        special = SPECIAL_WORD(v);
+        if (ascii_only) {
+            special |= (v & WORD_HIGHS) | HAS_ZERO(v ^ (WORD_ONES * 0x7F));
+        }
+        if (special) {
+            break;
+        }
+        i += SIZEOF_SIZE_T;
+    }
+    return i;
+}
+
 static Py_ssize_t
 ascii_escape_unichar(Py_UCS4 c, unsigned char *output, Py_ssize_t chars)
 {
@@ -410,7 +444,11 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
         {
             // Use tight scope variable to help register allocation.
             Py_UCS4 d = 0;
-            for (next = end; next < len; next++) {
+            next = end;
+            if (kind == PyUnicode_1BYTE_KIND) {
+                next = skip_plain_ucs1(buf, next, len, 0);
+            }
+            for (; next < len; next++) {
                 d = PyUnicode_READ(kind, buf, next);
                 if (d == '"' || d == '\\') {
                     break;
@@ -1286,17 +1324,26 @@ encoder_call(PyEncoderObject *self, PyObject *args, PyObject *kwds)
     static char *kwlist[] = {"obj", "_current_indent_level", NULL};
     PyObject *obj;
     Py_ssize_t indent_level;
-    _PyAccu acc;
+    PyObject *result, *tuple;
+    _PyUnicodeWriter writer;
     if (!PyArg_ParseTupleAndKeywords(args, kwds, "On:_iterencode", kwlist,
         &obj, &indent_level))
         return NULL;
-    if (_PyAccu_Init(&acc))
+
+    _PyUnicodeWriter_Init(&writer);
+    writer.overallocate = 1;
+    if (encoder_listencode_obj(self, &writer, obj, indent_level)) {
+        _PyUnicodeWriter_Dealloc(&writer);
         return NULL;
-    if (encoder_listencode_obj(self, &acc, obj, indent_level)) {
-        _PyAccu_Destroy(&acc);
+    }
+    result = _PyUnicodeWriter_Finish(&writer);
+    if (result == NULL) {
         return NULL;
     }
-    return _PyAccu_FinishAsList(&acc);
+    /* JSONEncoder.encode() joins the chunks; hand it a single one */
+    tuple = PyTuple_Pack(1, result);
+    Py_DECREF(result);
+    return tuple;
 }
 
 static PyObject *
@@ -1380,58 +1427,130 @@ encoder_encode_string(PyEncoderObject *s, PyObject *obj)
 }
 
 static int
-_steal_accumulate(_PyAccu *acc, PyObject *stolen)
+write_escaped_string(_PyUnicodeWriter *writer, PyObject *pystr, int ascii_only)
+{
+    /* Write the JSON representation of pystr, as escaped by
+       encode_basestring_ascii() or encode_basestring(), straight into
+       writer: runs of characters that need no escaping are copied as
+       substrings, found a word at a time for 1-byte kind strings. */
+    Py_ssize_t i, start, len;
+    const void *input;
+    int kind;
+
+    if (PyUnicode_READY(pystr) == -1)
+        return -1;
+
+    len = PyUnicode_GET_LENGTH(pystr);
+    input = PyUnicode_DATA(pystr);
+    kind = PyUnicode_KIND(pystr);
+
+    if (_PyUnicodeWriter_WriteChar(writer, '"') < 0)
+        return -1;
+    i = start = 0;
+    while (i < len) {
+        Py_UCS4 c;
+        unsigned char buf[12];
+        Py_ssize_t n;
+
+        if (kind == PyUnicode_1BYTE_KIND) {
+            i = skip_plain_ucs1(input, i, len, ascii_only);
+            if (i == len)
+                break;
+        }
+        c = PyUnicode_READ(kind, input, i);
+        if (ascii_only ? S_CHAR(c) : (c >= ' ' && c != '\\' && c != '"')) {
+            i++;
+            continue;
+        }
+        if (i > start &&
+            _PyUnicodeWriter_WriteSubstring(writer, pystr, start, i) < 0)
+            return -1;
+        n = ascii_escape_unichar(c, buf, 0);
+        if (_PyUnicodeWriter_WriteASCIIString(writer, (const char *)buf, n) < 0)
+            return -1;
+        start = ++i;
+    }
+    if (start == 0) {
+        if (_PyUnicodeWriter_WriteStr(writer, pystr) < 0)
+            return -1;
+    }
+    else if (start < len &&
+             _PyUnicodeWriter_WriteSubstring(writer, pystr, start, len) < 0) {
+        return -1;
+    }
+    return _PyUnicodeWriter_WriteChar(writer, '"');
+}
+
+static int
+encoder_write_string(PyEncoderObject *s, _PyUnicodeWriter *writer,
+                     PyObject *obj)
+{
+    /* Write the JSON representation of a string */
+    PyObject *encoded;
+    int rv;
+
+    if (s->fast_encode) {
+        return write_escaped_string(writer, obj,
+            s->fast_encode == (PyCFunction)py_encode_basestring_ascii);
+    }
+    encoded = encoder_encode_string(s, obj);
+    if (encoded == NULL)
+        return -1;
+    rv = _PyUnicodeWriter_WriteStr(writer, encoded);
+    Py_DECREF(encoded);
+    return rv;
+}
+
+static int
+_steal_accumulate(_PyUnicodeWriter *writer, PyObject *stolen)
 {
     /* Append stolen and then decrement its reference count */
-    int rval = _PyAccu_Accumulate(acc, stolen);
+    int rval = _PyUnicodeWriter_WriteStr(writer, stolen);
     Py_DECREF(stolen);
     return rval;
 }
 
 static int
-encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
+encoder_listencode_obj(PyEncoderObject *s, _PyUnicodeWriter *writer,
                        PyObject *obj, Py_ssize_t indent_level)
 {
     /* Encode Python object obj to a JSON term */
     PyObject *newobj;
     int rv;
 
-    if (obj == Py_None || obj == Py_True || obj == Py_False) {
-        PyObject *cstr = _encoded_const(obj);
-        if (cstr == NULL)
-            return -1;
-        return _steal_accumulate(acc, cstr);
+    if (obj == Py_None) {
+        return _PyUnicodeWriter_WriteASCIIString(writer, "null", 4);
+    }
+    else if (obj == Py_True) {
+        return _PyUnicodeWriter_WriteASCIIString(writer, "true", 4);
+    }
+    else if (obj == Py_False) {
+        return _PyUnicodeWriter_WriteASCIIString(writer, "false", 5);
     }
     else if (PyUnicode_Check(obj))
     {
-        PyObject *encoded = encoder_encode_string(s, obj);
-        if (encoded == NULL)
-            return -1;
-        return _steal_accumulate(acc, encoded);
+        return encoder_write_string(s, writer, obj);
     }
     else if (PyLong_Check(obj)) {
-        PyObject *encoded = PyLong_Type.tp_repr(obj);
-        if (encoded == NULL)
-            return -1;
-        return _steal_accumulate(acc, encoded);
+        return _PyLong_FormatWriter(writer, obj, 10, 0);
     }
     else if (PyFloat_Check(obj)) {
         PyObject *encoded = encoder_encode_float(s, obj);
         if (encoded == NULL)
             return -1;
-        return _steal_accumulate(acc, encoded);
+        return _steal_accumulate(writer, encoded);
     }
     else if (PyList_Check(obj) || PyTuple_Check(obj)) {
         if (Py_EnterRecursiveCall(" while encoding a JSON object"))
             return -1;
-        rv = encoder_listencode_list(s, acc, obj, indent_level);
+        rv = encoder_listencode_list(s, writer, obj, indent_level);
         Py_LeaveRecursiveCall();
         return rv;
     }
     else if (PyDict_Check(obj)) {
         if (Py_EnterRecursiveCall(" while encoding a JSON object"))
             return -1;
-        rv = encoder_listencode_dict(s, acc, obj, indent_level);
+        rv = encoder_listencode_dict(s, writer, obj, indent_level);
         Py_LeaveRecursiveCall();
         return rv;
     }
@@ -1465,7 +1584,7 @@ encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
             Py_XDECREF(ident);
             return -1;
         }
-        rv = encoder_listencode_obj(s, acc, newobj, indent_level);
+        rv = encoder_listencode_obj(s, writer, newobj, indent_level);
         Py_LeaveRecursiveCall();
 
         Py_DECREF(newobj);
@@ -1485,13 +1604,10 @@ encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
 }
 
 static int
-encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
+encoder_listencode_dict(PyEncoderObject *s, _PyUnicodeWriter *writer,
                         PyObject *dct, Py_ssize_t indent_level)
 {
     /* Encode Python dict dct a JSON term */
-    static PyObject *open_dict = NULL;
-    static PyObject *close_dict = NULL;
-    static PyObject *empty_dict = NULL;
     PyObject *kstr = NULL;
     PyObject *ident = NULL;
     PyObject *it = NULL;
@@ -1499,15 +1615,8 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
     PyObject *item = NULL;
     Py_ssize_t idx;
 
-    if (open_dict == NULL || close_dict == NULL || empty_dict == NULL) {
-        open_dict = PyUnicode_InternFromString("{");
-        close_dict = PyUnicode_InternFromString("}");
-        empty_dict = PyUnicode_InternFromString("{}");
-        if (open_dict == NULL || close_dict == NULL || empty_dict == NULL)
-            return -1;
-    }
     if (PyDict_GET_SIZE(dct) == 0)  /* Fast path */
-        return _PyAccu_Accumulate(acc, empty_dict);
+        return _PyUnicodeWriter_WriteASCIIString(writer, "{}", 2);
 
     if (s->markers != Py_None) {
         int has_key;
@@ -1525,7 +1634,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         }
     }
 
-    if (_PyAccu_Accumulate(acc, open_dict))
+    if (_PyUnicodeWriter_WriteChar(writer, '{'))
         goto bail;
 
     if (s->indent != Py_None) {
@@ -1551,7 +1660,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         goto bail;
     idx = 0;
     while ((item = PyIter_Next(it)) != NULL) {
-        PyObject *encoded, *key, *value;
+        PyObject *key, *value;
         if (!PyTuple_Check(item) || PyTuple_GET_SIZE(item) != 2) {
             PyErr_SetString(PyExc_ValueError, "items must return 2-tuples");
             goto bail;
@@ -1591,24 +1700,18 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         }
 
         if (idx) {
-            if (_PyAccu_Accumulate(acc, s->item_separator))
+            if (_PyUnicodeWriter_WriteStr(writer, s->item_separator))
                 goto bail;
         }
 
-        encoded = encoder_encode_string(s, kstr);
-        Py_CLEAR(kstr);
-        if (encoded == NULL)
+        if (encoder_write_string(s, writer, kstr))
             goto bail;
-        if (_PyAccu_Accumulate(acc, encoded)) {
-            Py_DECREF(encoded);
-            goto bail;
-        }
-        Py_DECREF(encoded);
-        if (_PyAccu_Accumulate(acc, s->key_separator))
+        Py_CLEAR(kstr);
+        if (_PyUnicodeWriter_WriteStr(writer, s->key_separator))
             goto bail;
 
         value = PyTuple_GET_ITEM(item, 1);
-        if (encoder_listencode_obj(s, acc, value, indent_level))
+        if (encoder_listencode_obj(s, writer, value, indent_level))
             goto bail;
         idx += 1;
         Py_DECREF(item);
@@ -1628,7 +1731,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
 
         yield '\n' + (' ' * (_indent * _current_indent_level))
     }*/
-    if (_PyAccu_Accumulate(acc, close_dict))
+    if (_PyUnicodeWriter_WriteChar(writer, '}'))
         goto bail;
     return 0;
 
@@ -1642,31 +1745,21 @@ bail:
 
 
 static int
-encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
+encoder_listencode_list(PyEncoderObject *s, _PyUnicodeWriter *writer,
                         PyObject *seq, Py_ssize_t indent_level)
 {
     /* Encode Python list seq to a JSON term */
-    static PyObject *open_array = NULL;
-    static PyObject *close_array = NULL;
-    static PyObject *empty_array = NULL;
     PyObject *ident = NULL;
     PyObject *s_fast = NULL;
     Py_ssize_t i;
 
-    if (open_array == NULL || close_array == NULL || empty_array == NULL) {
-        open_array = PyUnicode_InternFromString("[");
-        close_array = PyUnicode_InternFromString("]");
-        empty_array = PyUnicode_InternFromString("[]");
-        if (open_array == NULL || close_array == NULL || empty_array == NULL)
-            return -1;
-    }
     ident = NULL;
     s_fast = PySequence_Fast(seq, "_iterencode_list needs a sequence");
     if (s_fast == NULL)
         return -1;
     if (PySequence_Fast_GET_SIZE(s_fast) == 0) {
         Py_DECREF(s_fast);
-        return _PyAccu_Accumulate(acc, empty_array);
+        return _PyUnicodeWriter_WriteASCIIString(writer, "[]", 2);
     }
 
     if (s->markers != Py_None) {
@@ -1685,7 +1778,7 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
         }
     }
 
-    if (_PyAccu_Accumulate(acc, open_array))
+    if (_PyUnicodeWriter_WriteChar(writer, '['))
         goto bail;
     if (s->indent != Py_None) {
         /* TODO: DOES NOT RUN */
@@ -1699,10 +1792,10 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
     for (i = 0; i < PySequence_Fast_GET_SIZE(s_fast); i++) {
         PyObject *obj = PySequence_Fast_GET_ITEM(s_fast, i);
         if (i) {
-            if (_PyAccu_Accumulate(acc, s->item_separator))
+            if (_PyUnicodeWriter_WriteStr(writer, s->item_separator))
                 goto bail;
         }
-        if (encoder_listencode_obj(s, acc, obj, indent_level))
+        if (encoder_listencode_obj(s, writer, obj, indent_level))
             goto bail;
     }
     if (ident != NULL) {
@@ -1717,7 +1810,7 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
 
         yield '\n' + (' ' * (_indent * _current_indent_level))
     }*/
-    if (_PyAccu_Accumulate(acc, close_array))
+    if (_PyUnicodeWriter_WriteChar(writer, ']'))
         goto bail;
     Py_DECREF(s_fast);
     return 0;
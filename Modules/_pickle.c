@@ -123,6 +123,11 @@ enum {
        checking for self-referential data-structures. */
     FAST_NESTING_LIMIT = 50,
 
+    /* Minimum number of list or dict items pickled by one helper thread
+       when a Pickler is created with threads > 1.  Containers smaller than
+       two chunks are always pickled serially. */
+    PARALLEL_CHUNK_MIN = 4 * BATCHSIZE,
+
     /* Initial size of the write buffer of Pickler. */
     WRITE_BUF_SIZE = 4096,
 
@@ -611,9 +616,13 @@ typedef struct {
     size_t mt_mask;
     size_t mt_used;
     size_t mt_allocated;
+    size_t mt_extra;        /* memo slots used by the pickle stream that have
+                               no entry in the table (see merge_chunks()) */
     PyMemoEntry *mt_table;
 } PyMemoTable;
 
+struct PickleChunk;
+
 typedef struct PicklerObject {
     PyObject_HEAD
     PyMemoTable *memo;          /* Memo table, keep track of the seen
@@ -651,8 +660,33 @@ typedef struct PicklerObject {
                                    the name of globals for Python 2.x. */
     PyObject *fast_memo;
     PyObject *buffer_callback;  /* Callback for out-of-band buffers, or NULL */
+    struct PickleChunk *chunk;  /* Set on the helper picklers used to pickle
+                                   a part of a large container in parallel */
+    int threads;                /* Number of threads used to pickle large
+                                   lists and dicts; 1 disables parallelism. */
 } PicklerObject;
 
+/* A slice of a large list or dict that is pickled by a helper pickler,
+   possibly on another thread, on behalf of a parent pickler.  See
+   batch_parallel(). */
+typedef struct PickleChunk {
+    PicklerObject *pickler;     /* Helper pickler, owns the chunk's output
+                                   and memo. */
+    PyMemoTable *parent_memo;   /* Memo of the parent pickler; read-only
+                                   while chunks are being pickled. */
+    Py_ssize_t start;           /* Index of the first item of the chunk. */
+    Py_ssize_t end;             /* Index past the last item of the chunk. */
+    Py_ssize_t *fixups;         /* Output offsets of LONG_BINGET arguments
+                                   that refer to the chunk's own memo and
+                                   must be rebased once the chunk's position
+                                   in the stream is known. */
+    Py_ssize_t nfixups;
+    Py_ssize_t fixups_size;
+    PyObject *exc_type;         /* Exception raised while pickling the */
+    PyObject *exc_value;        /* chunk, or NULL. */
+    PyObject *exc_tb;
+} PickleChunk;
+
 typedef struct UnpicklerObject {
     PyObject_HEAD
     Pdata *stack;               /* Pickle data stack, store unpickled objects. */
@@ -679,6 +713,8 @@ typedef struct UnpicklerObject {
     PyObject *readline;         /* readline() method of the input stream. */
     PyObject *peek;             /* peek() method of the input stream, or NULL */
     PyObject *buffers;          /* iterable of out-of-band buffers, or NULL */
+    PyObject *input_view;       /* byte-format memoryview of the in-memory
+                                   input, created lazily in zero-copy mode */
 
     char *encoding;             /* Name of the encoding to be used for
                                    decoding strings pickled using Python
@@ -693,6 +729,8 @@ typedef struct UnpicklerObject {
     int proto;                  /* Protocol of the pickle loaded. */
     int fix_imports;            /* Indicate whether Unpickler should fix
                                    the name of globals pickled by Python 2.x. */
+    int zero_copy;              /* Return bytes and bytearray objects as
+                                   memoryviews borrowing from the input. */
 } UnpicklerObject;
 
 typedef struct {
@@ -733,6 +771,7 @@ PyMemoTable_New(void)
     }
 
     memo->mt_used = 0;
+    memo->mt_extra = 0;
     memo->mt_allocated = MT_MINSIZE;
     memo->mt_mask = MT_MINSIZE - 1;
     memo->mt_table = PyMem_MALLOC(MT_MINSIZE * sizeof(PyMemoEntry));
@@ -754,6 +793,7 @@ PyMemoTable_Copy(PyMemoTable *self)
         return NULL;
 
     new->mt_used = self->mt_used;
+    new->mt_extra = self->mt_extra;
     new->mt_allocated = self->mt_allocated;
     new->mt_mask = self->mt_mask;
     /* The table we get from _New() is probably smaller than we wanted.
@@ -774,10 +814,12 @@ PyMemoTable_Copy(PyMemoTable *self)
     return new;
 }
 
+/* Returns the number of memo slots in use, which is also the index that
+   will be assigned to the next memoized object. */
 static Py_ssize_t
 PyMemoTable_Size(PyMemoTable *self)
 {
-    return self->mt_used;
+    return self->mt_used + self->mt_extra;
 }
 
 static int
@@ -789,6 +831,7 @@ PyMemoTable_Clear(PyMemoTable *self)
         Py_XDECREF(self->mt_table[i].me_key);
     }
     self->mt_used = 0;
+    self->mt_extra = 0;
     memset(self->mt_table, 0, self->mt_allocated * sizeof(PyMemoEntry));
     return 0;
 }
@@ -1125,6 +1168,8 @@ _Pickler_New(void)
     self->max_output_len = WRITE_BUF_SIZE;
     self->output_len = 0;
     self->reducer_override = NULL;
+    self->chunk = NULL;
+    self->threads = 1;
 
     self->memo = PyMemoTable_New();
     self->output_buffer = PyBytes_FromStringAndSize(NULL,
@@ -1185,6 +1230,17 @@ _Pickler_SetOutputStream(PicklerObject *self, PyObject *file)
     return 0;
 }
 
+static int
+_Pickler_SetThreads(PicklerObject *self, int threads)
+{
+    if (threads < 1) {
+        PyErr_SetString(PyExc_ValueError, "threads must be at least 1");
+        return -1;
+    }
+    self->threads = threads;
+    return 0;
+}
+
 static int
 _Pickler_SetBufferCallback(PicklerObject *self, PyObject *buffer_callback)
 {
@@ -1209,6 +1265,7 @@ _Unpickler_SetStringInput(UnpicklerObject *self, PyObject *input)
 {
     if (self->buffer.buf != NULL)
         PyBuffer_Release(&self->buffer);
+    Py_CLEAR(self->input_view);
     if (PyObject_GetBuffer(input, &self->buffer, PyBUF_CONTIG_RO) < 0)
         return -1;
     self->input_buffer = self->buffer.buf;
@@ -1454,6 +1511,78 @@ _Unpickler_ReadInto(UnpicklerObject *self, char *buf, Py_ssize_t n)
         (n))                                                 \
      : _Unpickler_ReadImpl(self, (s), (n)))
 
+/* Read `n` bytes from the unpickler's data source and return them as a new
+   memoryview.  This is used by the zero-copy mode for BINBYTES and
+   BYTEARRAY8 payloads.
+
+   When unpickling from memory (loads()), the view is a slice of the input
+   object itself and no data is copied; it keeps the input's buffer export
+   alive for as long as it exists.  When unpickling from a file, the data
+   has to be copied out of the stream anyway, so it is read into a fresh
+   bytes (or bytearray, if `readonly` is false) object and a view of that is
+   returned.  Views of borrowed input are writable only if `readonly` is
+   false and the input itself is writable.
+
+   Returns NULL (with an exception set) on failure. */
+static PyObject *
+_Unpickler_ReadView(UnpicklerObject *self, Py_ssize_t n, int readonly)
+{
+    _Py_IDENTIFIER(cast);
+    PyObject *obj, *slice, *view;
+
+    if (self->read != NULL) {
+        char *buf;
+
+        if (readonly) {
+            obj = PyBytes_FromStringAndSize(NULL, n);
+            buf = obj != NULL ? PyBytes_AS_STRING(obj) : NULL;
+        }
+        else {
+            obj = PyByteArray_FromStringAndSize(NULL, n);
+            buf = obj != NULL ? PyByteArray_AS_STRING(obj) : NULL;
+        }
+        if (obj == NULL)
+            return NULL;
+        if (_Unpickler_ReadInto(self, buf, n) < 0) {
+            Py_DECREF(obj);
+            return NULL;
+        }
+        view = PyMemoryView_FromObject(obj);
+        Py_DECREF(obj);
+        return view;
+    }
+
+    if (n > self->input_len - self->next_read_idx) {
+        (void)bad_readline();
+        return NULL;
+    }
+
+    if (self->input_view == NULL) {
+        /* The input may export any item format; cast to unsigned bytes so
+           that slice indices are byte offsets. */
+        obj = PyMemoryView_FromObject(self->buffer.obj);
+        if (obj == NULL)
+            return NULL;
+        self->input_view = _PyObject_CallMethodId(obj, &PyId_cast, "s", "B");
+        Py_DECREF(obj);
+        if (self->input_view == NULL)
+            return NULL;
+    }
+
+    slice = _PySlice_FromIndices(self->next_read_idx, self->next_read_idx + n);
+    if (slice == NULL)
+        return NULL;
+    view = PyObject_GetItem(self->input_view, slice);
+    Py_DECREF(slice);
+    if (view == NULL)
+        return NULL;
+    if (readonly) {
+        PyMemoryView_GET_BUFFER(view)->readonly = 1;
+    }
+    self->next_read_idx += n;
+    return view;
+}
+
 static Py_ssize_t
 _Unpickler_CopyLine(UnpicklerObject *self, char *line, Py_ssize_t len,
                     char **result)
@@ -1605,6 +1734,7 @@ _Unpickler_New(void)
     self->readline = NULL;
     self->peek = NULL;
     self->buffers = NULL;
+    self->input_view = NULL;
     self->encoding = NULL;
     self->errors = NULL;
     self->marks = NULL;
@@ -1612,6 +1742,7 @@ _Unpickler_New(void)
     self->marks_size = 0;
     self->proto = 0;
     self->fix_imports = 0;
+    self->zero_copy = 0;
     memset(&self->buffer, 0, sizeof(Py_buffer));
     self->memo_size = 32;
     self->memo_len = 0;
@@ -1698,38 +1829,31 @@ _Unpickler_SetBuffers(UnpicklerObject *self, PyObject *buffers)
     return 0;
 }
 
-/* Generate a GET opcode for an object stored in the memo. */
+/* Generate a GET opcode for the memo slot `idx`. */
 static int
-memo_get(PicklerObject *self, PyObject *key)
+memo_get_index(PicklerObject *self, Py_ssize_t idx)
 {
-    Py_ssize_t *value;
     char pdata[30];
     Py_ssize_t len;
 
-    value = PyMemoTable_Get(self->memo, key);
-    if (value == NULL)  {
-        PyErr_SetObject(PyExc_KeyError, key);
-        return -1;
-    }
-
     if (!self->bin) {
         pdata[0] = GET;
         PyOS_snprintf(pdata + 1, sizeof(pdata) - 1,
-                      "%" PY_FORMAT_SIZE_T "d\n", *value);
+                      "%" PY_FORMAT_SIZE_T "d\n", idx);
         len = strlen(pdata);
     }
     else {
-        if (*value < 256) {
+        if (idx < 256) {
             pdata[0] = BINGET;
-            pdata[1] = (unsigned char)(*value & 0xff);
+            pdata[1] = (unsigned char)(idx & 0xff);
             len = 2;
         }
-        else if ((size_t)*value <= 0xffffffffUL) {
+        else if ((size_t)idx <= 0xffffffffUL) {
             pdata[0] = LONG_BINGET;
-            pdata[1] = (unsigned char)(*value & 0xff);
-            pdata[2] = (unsigned char)((*value >> 8) & 0xff);
-            pdata[3] = (unsigned char)((*value >> 16) & 0xff);
-            pdata[4] = (unsigned char)((*value >> 24) & 0xff);
+            pdata[1] = (unsigned char)(idx & 0xff);
+            pdata[2] = (unsigned char)((idx >> 8) & 0xff);
+            pdata[3] = (unsigned char)((idx >> 16) & 0xff);
+            pdata[4] = (unsigned char)((idx >> 24) & 0xff);
             len = 5;
         }
         else { /* unlikely */
@@ -1746,6 +1870,63 @@ memo_get(PicklerObject *self, PyObject *key)
     return 0;
 }
 
+/* Generate a GET opcode for the slot `idx` of a helper pickler's own memo.
+   The slot's final index in the stream is only known after all chunks have
+   been pickled, so always use the fixed-size LONG_BINGET and remember where
+   its argument is; merge_chunks() rebases it. */
+static int
+chunk_memo_get(PicklerObject *self, Py_ssize_t idx)
+{
+    PickleChunk *chunk = self->chunk;
+    char pdata[5];
+
+    if (chunk->nfixups == chunk->fixups_size) {
+        Py_ssize_t new_size = chunk->fixups_size ? chunk->fixups_size * 2 : 64;
+        Py_ssize_t *fixups = PyMem_Realloc(chunk->fixups,
+                                           new_size * sizeof(Py_ssize_t));
+        if (fixups == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        chunk->fixups = fixups;
+        chunk->fixups_size = new_size;
+    }
+
+    if ((size_t)idx > 0xffffffffUL) {
+        PickleState *st = _Pickle_GetGlobalState();
+        PyErr_SetString(st->PicklingError,
+                        "memo id too large for LONG_BINGET");
+        return -1;
+    }
+    pdata[0] = LONG_BINGET;
+    pdata[1] = (unsigned char)(idx & 0xff);
+    pdata[2] = (unsigned char)((idx >> 8) & 0xff);
+    pdata[3] = (unsigned char)((idx >> 16) & 0xff);
+    pdata[4] = (unsigned char)((idx >> 24) & 0xff);
+    if (_Pickler_Write(self, pdata, 5) < 0)
+        return -1;
+    /* The write may have opened a new frame, so take the offset after it */
+    chunk->fixups[chunk->nfixups++] = self->output_len - 4;
+    return 0;
+}
+
+/* Generate a GET opcode for an object stored in the memo. */
+static int
+memo_get(PicklerObject *self, PyObject *key)
+{
+    Py_ssize_t *value;
+
+    value = PyMemoTable_Get(self->memo, key);
+    if (value == NULL)  {
+        PyErr_SetObject(PyExc_KeyError, key);
+        return -1;
+    }
+    if (self->chunk != NULL) {
+        return chunk_memo_get(self, *value);
+    }
+    return memo_get_index(self, *value);
+}
+
 /* Store an object in the memo, assign it a new unique ID based on the number
    of objects currently stored in the memo and generate a PUT opcode. */
 static int
@@ -2982,6 +3163,346 @@ batch_list(PicklerObject *self, PyObject *iter)
     return -1;
 }
 
+/* Parallel pickling of large lists and dicts.
+ *
+ * When a Pickler is created with threads > 1, the items of large exact lists
+ * and dicts after the first batch are split into chunks of whole MARK ...
+ * APPENDS (or SETITEMS) batches.  Each chunk is pickled into its own buffer
+ * by a helper pickler, on a pool of short-lived threads, and the buffers are
+ * then concatenated.
+ *
+ * Protocol 4 and later memoize with MEMOIZE, whose memo index is implied by
+ * the position in the stream, so a chunk can memoize without knowing how
+ * many objects the chunks before it memoized.  References to objects
+ * memoized earlier in the stream use the parent's (final) memo indices.
+ * References to objects memoized earlier in the same chunk are written as
+ * LONG_BINGET and rebased in merge_chunks().  An object memoized by two
+ * chunks would become two objects when unpickled, so if that happens for
+ * anything but an exact str or bytes, the parallel output is discarded and
+ * the container is pickled serially.
+ */
+
+typedef struct {
+    PyObject *items;            /* List of items (or of (key, value) pairs) */
+    int is_dict;
+    PickleChunk *chunks;
+    Py_ssize_t nchunks;
+    Py_ssize_t next_chunk;      /* Next chunk to pickle; updated atomically */
+    Py_ssize_t running;         /* Threads still pickling; updated atomically */
+    int failed;                 /* Set when a chunk fails, stops the others */
+    PyThread_type_lock done;    /* Released by the last thread to finish */
+} ParallelDump;
+
+static int
+_Pickler_CanPickleInParallel(PicklerObject *self, Py_ssize_t n)
+{
+    return (self->threads > 1 &&
+            n >= BATCHSIZE + 2 * PARALLEL_CHUNK_MIN &&
+            self->chunk == NULL &&
+            self->framing &&
+            !self->fast &&
+            self->pers_func == NULL &&
+            self->reducer_override == NULL &&
+            self->buffer_callback == NULL);
+}
+
+/* Pickle items [start, end) of `items` as MARK ... APPENDS (or SETITEMS)
+   batches of up to BATCHSIZE items. */
+static int
+save_batches(PicklerObject *pickler, PyObject *items,
+             Py_ssize_t start, Py_ssize_t end, int is_dict)
+{
+    Py_ssize_t i = start;
+
+    const char mark_op = MARK;
+    const char batch_op = is_dict ? SETITEMS : APPENDS;
+
+    while (i < end) {
+        Py_ssize_t batch_end = Py_MIN(i + BATCHSIZE, end);
+
+        if (_Pickler_Write(pickler, &mark_op, 1) < 0)
+            return -1;
+        for (; i < batch_end; i++) {
+            PyObject *item = PyList_GET_ITEM(items, i);
+            if (is_dict) {
+                if (save(pickler, PyTuple_GET_ITEM(item, 0), 0) < 0 ||
+                    save(pickler, PyTuple_GET_ITEM(item, 1), 0) < 0)
+                    return -1;
+            }
+            else if (save(pickler, item, 0) < 0) {
+                return -1;
+            }
+        }
+        if (_Pickler_Write(pickler, &batch_op, 1) < 0)
+            return -1;
+    }
+    return 0;
+}
+
+static int
+save_chunk(PickleChunk *chunk, PyObject *items, int is_dict)
+{
+    if (save_batches(chunk->pickler, items,
+                     chunk->start, chunk->end, is_dict) < 0)
+        return -1;
+    return _Pickler_CommitFrame(chunk->pickler);
+}
+
+static void
+parallel_dump_run(ParallelDump *pd)
+{
+    for (;;) {
+        Py_ssize_t i = _Py_atomic_add_ssize(&pd->next_chunk, 1);
+        if (i >= pd->nchunks || _Py_atomic_load_int(&pd->failed)) {
+            break;
+        }
+        PickleChunk *chunk = &pd->chunks[i];
+        if (save_chunk(chunk, pd->items, pd->is_dict) < 0) {
+            PyErr_Fetch(&chunk->exc_type, &chunk->exc_value, &chunk->exc_tb);
+            _Py_atomic_store_int(&pd->failed, 1);
+        }
+    }
+}
+
+static void
+parallel_dump_finish(ParallelDump *pd)
+{
+    /* Don't touch pd after the last thread releases the lock */
+    if (_Py_atomic_add_ssize(&pd->running, -1) == 1) {
+        PyThread_release_lock(pd->done);
+    }
+}
+
+static void
+parallel_dump_worker(void *arg)
+{
+    ParallelDump *pd = (ParallelDump *)arg;
+    PyGILState_STATE gstate = PyGILState_Ensure();
+    parallel_dump_run(pd);
+    PyGILState_Release(gstate);
+    parallel_dump_finish(pd);
+}
+
+/* Check that the pickled chunks can be concatenated without changing the
+   meaning of the stream.  If so, rebase their memo references, append their
+   output to self and merge their memos into self->memo.
+
+   Returns 1 on success, 0 if the chunks share objects (the caller must then
+   pickle the container serially), and -1 on error. */
+static int
+merge_chunks(PicklerObject *self, PickleChunk *chunks, Py_ssize_t nchunks)
+{
+    PyMemoTable *seen;
+    Py_ssize_t base, i, k;
+    size_t j;
+    int framing;
+
+    seen = PyMemoTable_New();
+    if (seen == NULL)
+        return -1;
+    for (k = 0; k < nchunks; k++) {
+        PyMemoTable *memo = chunks[k].pickler->memo;
+        for (j = 0; j < memo->mt_allocated; j++) {
+            PyObject *key = memo->mt_table[j].me_key;
+            if (key == NULL)
+                continue;
+            if (PyMemoTable_Get(seen, key) == NULL) {
+                if (PyMemoTable_Set(seen, key, 0) < 0) {
+                    PyMemoTable_Del(seen);
+                    return -1;
+                }
+            }
+            else if (!PyUnicode_CheckExact(key) && !PyBytes_CheckExact(key)) {
+                PyMemoTable_Del(seen);
+                return 0;
+            }
+        }
+    }
+    PyMemoTable_Del(seen);
+
+    /* The chunks' output is made of complete frames */
+    if (_Pickler_CommitFrame(self) < 0)
+        return -1;
+    framing = self->framing;
+    self->framing = 0;
+
+    base = PyMemoTable_Size(self->memo);
+    for (k = 0; k < nchunks; k++) {
+        PicklerObject *pickler = chunks[k].pickler;
+        PyMemoTable *memo = pickler->memo;
+        unsigned char *output;
+
+        output = (unsigned char *)PyBytes_AS_STRING(pickler->output_buffer);
+        for (i = 0; i < chunks[k].nfixups; i++) {
+            unsigned char *arg = output + chunks[k].fixups[i];
+            size_t idx = (size_t)base + ((size_t)arg[0] |
+                                         (size_t)arg[1] << 8 |
+                                         (size_t)arg[2] << 16 |
+                                         (size_t)arg[3] << 24);
+            if (idx > 0xffffffffUL) {
+                PickleState *st = _Pickle_GetGlobalState();
+                PyErr_SetString(st->PicklingError,
+                                "memo id too large for LONG_BINGET");
+                goto error;
+            }
+            arg[0] = (unsigned char)(idx & 0xff);
+            arg[1] = (unsigned char)((idx >> 8) & 0xff);
+            arg[2] = (unsigned char)((idx >> 16) & 0xff);
+            arg[3] = (unsigned char)((idx >> 24) & 0xff);
+        }
+
+        for (j = 0; j < memo->mt_allocated; j++) {
+            PyMemoEntry *entry = &memo->mt_table[j];
+            if (entry->me_key == NULL)
+                continue;
+            if (PyMemoTable_Get(self->memo, entry->me_key) != NULL) {
+                /* An equal str or bytes memoized again by a later chunk.
+                   It still takes a slot in the unpickler's memo. */
+                self->memo->mt_extra++;
+            }
+            else if (PyMemoTable_Set(self->memo, entry->me_key,
+                                     base + entry->me_value) < 0) {
+                goto error;
+            }
+        }
+        base += PyMemoTable_Size(memo);
+
+        if (_Pickler_Write(self, (char *)output, pickler->output_len) < 0)
+            goto error;
+        if (self->write != NULL) {
+            if (_Pickler_FlushToFile(self) < 0 ||
+                _Pickler_ClearBuffer(self) < 0)
+                goto error;
+        }
+    }
+    self->framing = framing;
+    return 1;
+
+  error:
+    self->framing = framing;
+    return -1;
+}
+
+/* Pickle the items of a large list or dict on up to self->threads threads.
+   `items` is a list of the container's items, or of its (key, value) pairs
+   if `is_dict` is true.  The caller has already written the empty container
+   and memoized it.
+
+   Returns 0 on success and -1 on error. */
+static int
+batch_parallel(PicklerObject *self, PyObject *items, int is_dict)
+{
+    ParallelDump pd;
+    PickleChunk *chunks;
+    Py_ssize_t n, chunk_size, nchunks, nworkers, i;
+    int status = -1;
+
+    /* Pickle the first batch serially.  Items of a large container tend to
+       share objects such as dict keys and classes; once these are in
+       self->memo, the chunks refer to them with short BINGETs instead of
+       each memoizing a copy. */
+    if (save_batches(self, items, 0, BATCHSIZE, is_dict) < 0)
+        return -1;
+
+    n = PyList_GET_SIZE(items) - BATCHSIZE;
+    /* Aim for a few chunks per thread so that threads finishing early can
+       pick up more work, in whole batches so that the output is batched
+       the same way as serial pickling. */
+    chunk_size = n / ((Py_ssize_t)self->threads * 4);
+    chunk_size = (chunk_size + BATCHSIZE - 1) / BATCHSIZE * BATCHSIZE;
+    chunk_size = Py_MAX(chunk_size, PARALLEL_CHUNK_MIN);
+    nchunks = (n + chunk_size - 1) / chunk_size;
+
+    chunks = PyMem_Calloc(nchunks, sizeof(PickleChunk));
+    if (chunks == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (i = 0; i < nchunks; i++) {
+        PicklerObject *pickler = _Pickler_New();
+        if (pickler == NULL)
+            goto done;
+        pickler->proto = self->proto;
+        pickler->bin = self->bin;
+        pickler->fix_imports = self->fix_imports;
+        pickler->framing = 1;
+        Py_XINCREF(self->dispatch_table);
+        pickler->dispatch_table = self->dispatch_table;
+        pickler->chunk = &chunks[i];
+        chunks[i].pickler = pickler;
+        chunks[i].parent_memo = self->memo;
+        chunks[i].start = BATCHSIZE + i * chunk_size;
+        chunks[i].end = BATCHSIZE + Py_MIN(n, (i + 1) * chunk_size);
+    }
+
+    pd.items = items;
+    pd.is_dict = is_dict;
+    pd.chunks = chunks;
+    pd.nchunks = nchunks;
+    pd.next_chunk = 0;
+    pd.failed = 0;
+    pd.done = PyThread_allocate_lock();
+    if (pd.done == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    PyThread_acquire_lock(pd.done, WAIT_LOCK);
+
+    /* This thread pickles chunks too.  If a helper thread can't be
+       started, the remaining threads pick up its share. */
+    nworkers = Py_MIN((Py_ssize_t)self->threads, nchunks) - 1;
+    pd.running = nworkers + 1;
+    for (i = 0; i < nworkers; i++) {
+        if (PyThread_start_new_thread(parallel_dump_worker, &pd) ==
+                PYTHREAD_INVALID_THREAD_ID) {
+            _Py_atomic_add_ssize(&pd.running, -1);
+        }
+    }
+    parallel_dump_run(&pd);
+    parallel_dump_finish(&pd);
+
+    Py_BEGIN_ALLOW_THREADS
+    PyThread_acquire_lock(pd.done, WAIT_LOCK);
+    Py_END_ALLOW_THREADS
+    PyThread_free_lock(pd.done);
+
+    if (pd.failed) {
+        /* Report the error of the first failing chunk */
+        for (i = 0; i < nchunks; i++) {
+            if (chunks[i].exc_type != NULL) {
+                PyErr_Restore(chunks[i].exc_type, chunks[i].exc_value,
+                              chunks[i].exc_tb);
+                chunks[i].exc_type = NULL;
+                chunks[i].exc_value = NULL;
+                chunks[i].exc_tb = NULL;
+                break;
+            }
+        }
+        goto done;
+    }
+
+    status = merge_chunks(self, chunks, nchunks);
+    if (status == 0) {
+        /* Shared objects were found; start over serially */
+        status = save_batches(self, items, BATCHSIZE,
+                              PyList_GET_SIZE(items), is_dict);
+    }
+    else if (status == 1) {
+        status = 0;
+    }
+
+  done:
+    for (i = 0; i < nchunks; i++) {
+        Py_XDECREF(chunks[i].pickler);
+        PyMem_Free(chunks[i].fixups);
+        Py_XDECREF(chunks[i].exc_type);
+        Py_XDECREF(chunks[i].exc_value);
+        Py_XDECREF(chunks[i].exc_tb);
+    }
+    PyMem_Free(chunks);
+    return status;
+}
+
 /* This is a variant of batch_list() above, specialized for lists (with no
  * support for list subclasses). Like batch_list(), we batch up chunks of
  *     MARK item item ... item APPENDS
@@ -3016,6 +3537,17 @@ batch_list_exact(PicklerObject *self, PyObject *obj)
         return 0;
     }
 
+    if (_Pickler_CanPickleInParallel(self, PyList_GET_SIZE(obj))) {
+        PyObject *items = PyList_GetSlice(obj, 0, PyList_GET_SIZE(obj));
+        int status;
+
+        if (items == NULL)
+            return -1;
+        status = batch_parallel(self, items, 0);
+        Py_DECREF(items);
+        return status;
+    }
+
     /* Write in batches of BATCHSIZE. */
     total = 0;
     do {
@@ -3271,6 +3803,17 @@ batch_dict_exact(PicklerObject *self, PyObject *obj)
         return 0;
     }
 
+    if (_Pickler_CanPickleInParallel(self, dict_size)) {
+        PyObject *items = PyDict_Items(obj);
+        int status;
+
+        if (items == NULL)
+            return -1;
+        status = batch_parallel(self, items, 1);
+        Py_DECREF(items);
+        return status;
+    }
+
     /* Write in batches of BATCHSIZE. */
     do {
         i = 0;
@@ -4306,6 +4849,14 @@ save(PicklerObject *self, PyObject *obj, int pers_save)
     if (PyMemoTable_Get(self->memo, obj)) {
         return memo_get(self, obj);
     }
+    if (self->chunk != NULL) {
+        /* Objects pickled before the parallel container keep their
+           final memo index. */
+        Py_ssize_t *value = PyMemoTable_Get(self->chunk->parent_memo, obj);
+        if (value != NULL) {
+            return memo_get_index(self, *value);
+        }
+    }
 
     if (type == &PyBytes_Type) {
         return save_bytes(self, obj);
@@ -4688,6 +5239,8 @@ _pickle.Pickler.__init__
   protocol: object = None
   fix_imports: bool = True
   buffer_callback: object = None
+  *
+  threads: int = 1
 
 This takes a binary file for writing a pickle data stream.
 
@@ -4720,13 +5273,21 @@ buffer is serialized in-band, i.e. inside the pickle stream.
 It is an error if *buffer_callback* is not None and *protocol*
 is None or smaller than 5.
 
+If *threads* is greater than 1 and *protocol* is at least 4, the
+items of large lists and dicts are pickled on up to *threads* threads.
+The output can be read by any unpickler.  Equal str and bytes objects
+shared between items may be stored more than once; if other objects
+are shared, the container is pickled again serially.  Parallel
+pickling is disabled when persistent_id(), reducer_override() or
+*buffer_callback* is used.
+
 [clinic start generated code]*/
 
 static int
 _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file,
                               PyObject *protocol, int fix_imports,
-                              PyObject *buffer_callback)
-/*[clinic end generated code: output=0abedc50590d259b input=a7c969699bf5dad3]*/
+                              PyObject *buffer_callback, int threads)
+/*[clinic end generated code: output=77787dc8521ef5ca input=1f1dae001ae8a041]*/
 {
     _Py_IDENTIFIER(persistent_id);
     _Py_IDENTIFIER(dispatch_table);
@@ -4744,6 +5305,9 @@ _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file,
     if (_Pickler_SetBufferCallback(self, buffer_callback) < 0)
         return -1;
 
+    if (_Pickler_SetThreads(self, threads) < 0)
+        return -1;
+
     /* memo and output_buffer may have already been created in _Pickler_New */
     if (self->memo == NULL) {
         self->memo = PyMemoTable_New();
@@ -5532,6 +6096,14 @@ load_counted_binbytes(UnpicklerObject *self, int nbytes)
         return -1;
     }
 
+    if (self->zero_copy) {
+        bytes = _Unpickler_ReadView(self, size, 1);
+        if (bytes == NULL)
+            return -1;
+        PDATA_PUSH(self->stack, bytes, -1);
+        return 0;
+    }
+
     bytes = PyBytes_FromStringAndSize(NULL, size);
     if (bytes == NULL)
         return -1;
@@ -5563,6 +6135,15 @@ load_counted_bytearray(UnpicklerObject *self)
         return -1;
     }
 
+    if (self->zero_copy) {
+        bytearray = _Unpickler_ReadView(self, size, 0);
+        if (bytearray == NULL) {
+            return -1;
+        }
+        PDATA_PUSH(self->stack, bytearray, -1);
+        return 0;
+    }
+
     bytearray = PyByteArray_FromStringAndSize(NULL, size);
     if (bytearray == NULL) {
         return -1;
@@ -7201,6 +7782,7 @@ Unpickler_dealloc(UnpicklerObject *self)
     Py_XDECREF(self->stack);
     Py_XDECREF(self->pers_func);
     Py_XDECREF(self->buffers);
+    Py_XDECREF(self->input_view);
     if (self->buffer.buf != NULL) {
         PyBuffer_Release(&self->buffer);
         self->buffer.buf = NULL;
@@ -7225,6 +7807,7 @@ Unpickler_traverse(UnpicklerObject *self, visitproc visit, void *arg)
     Py_VISIT(self->stack);
     Py_VISIT(self->pers_func);
     Py_VISIT(self->buffers);
+    Py_VISIT(self->input_view);
     return 0;
 }
 
@@ -7238,6 +7821,7 @@ Unpickler_clear(UnpicklerObject *self)
     Py_CLEAR(self->stack);
     Py_CLEAR(self->pers_func);
     Py_CLEAR(self->buffers);
+    Py_CLEAR(self->input_view);
     if (self->buffer.buf != NULL) {
         PyBuffer_Release(&self->buffer);
         self->buffer.buf = NULL;
@@ -7266,6 +7850,7 @@ _pickle.Unpickler.__init__
   encoding: str = 'ASCII'
   errors: str = 'strict'
   buffers: object(c_default="NULL") = ()
+  zero_copy: bool = False
 
 This takes a binary file for reading a pickle data stream.
 
@@ -7287,13 +7872,20 @@ map the old Python 2 names to the new names used in Python 3.  The
 instances pickled by Python 2; these default to 'ASCII' and 'strict',
 respectively.  The *encoding* can be 'bytes' to read these 8-bit
 string instances as bytes objects.
+
+If *zero_copy* is true, bytes and bytearray objects serialized with
+protocol 3 or higher are returned as memoryviews instead.  When the
+pickle data is in memory, these views borrow directly from it, so
+large payloads are not copied and pages of a memory-mapped input are
+only touched when a view is used.
 [clinic start generated code]*/
 
 static int
 _pickle_Unpickler___init___impl(UnpicklerObject *self, PyObject *file,
                                 int fix_imports, const char *encoding,
-                                const char *errors, PyObject *buffers)
-/*[clinic end generated code: output=09f0192649ea3f85 input=ca4c1faea9553121]*/
+                                const char *errors, PyObject *buffers,
+                                int zero_copy)
+/*[clinic end generated code: output=47781de80672302d input=facc39bfb5b6df99]*/
 {
     _Py_IDENTIFIER(persistent_load);
 
@@ -7311,6 +7903,7 @@ _pickle_Unpickler___init___impl(UnpicklerObject *self, PyObject *file,
         return -1;
 
     self->fix_imports = fix_imports;
+    self->zero_copy = zero_copy;
 
     if (init_method_ref((PyObject *)self, &PyId_persistent_load,
                         &self->pers_func, &self->pers_func_self) < 0)
@@ -7689,6 +8282,7 @@ _pickle.dump
   *
   fix_imports: bool = True
   buffer_callback: object = None
+  threads: int = 1
 
 Write a pickled representation of obj to the open file object file.
 
@@ -7717,13 +8311,16 @@ If *buffer_callback* is None (the default), buffer views are serialized
 into *file* as part of the pickle stream.  It is an error if
 *buffer_callback* is not None and *protocol* is None or smaller than 5.
 
+*threads* enables parallel pickling of large lists and dicts, as
+described for the Pickler class.
+
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_dump_impl(PyObject *module, PyObject *obj, PyObject *file,
                   PyObject *protocol, int fix_imports,
-                  PyObject *buffer_callback)
-/*[clinic end generated code: output=706186dba996490c input=5ed6653da99cd97c]*/
+                  PyObject *buffer_callback, int threads)
+/*[clinic end generated code: output=47998a31e1cb55fb input=70e91c3683035f4f]*/
 {
     PicklerObject *pickler = _Pickler_New();
 
@@ -7739,6 +8336,9 @@ _pickle_dump_impl(PyObject *module, PyObject *obj, PyObject *file,
     if (_Pickler_SetBufferCallback(pickler, buffer_callback) < 0)
         goto error;
 
+    if (_Pickler_SetThreads(pickler, threads) < 0)
+        goto error;
+
     if (dump(pickler, obj) < 0)
         goto error;
 
@@ -7762,6 +8362,7 @@ _pickle.dumps
   *
   fix_imports: bool = True
   buffer_callback: object = None
+  threads: int = 1
 
 Return the pickled representation of the object as a bytes object.
 
@@ -7782,12 +8383,15 @@ If *buffer_callback* is None (the default), buffer views are serialized
 into *file* as part of the pickle stream.  It is an error if
 *buffer_callback* is not None and *protocol* is None or smaller than 5.
 
+*threads* enables parallel pickling of large lists and dicts, as
+described for the Pickler class.
+
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_dumps_impl(PyObject *module, PyObject *obj, PyObject *protocol,
-                   int fix_imports, PyObject *buffer_callback)
-/*[clinic end generated code: output=fbab0093a5580fdf input=e543272436c6f987]*/
+                   int fix_imports, PyObject *buffer_callback, int threads)
+/*[clinic end generated code: output=a85b7e07a13a1493 input=e7e6cc781ee80aa2]*/
 {
     PyObject *result;
     PicklerObject *pickler = _Pickler_New();
@@ -7801,6 +8405,9 @@ _pickle_dumps_impl(PyObject *module, PyObject *obj, PyObject *protocol,
     if (_Pickler_SetBufferCallback(pickler, buffer_callback) < 0)
         goto error;
 
+    if (_Pickler_SetThreads(pickler, threads) < 0)
+        goto error;
+
     if (dump(pickler, obj) < 0)
         goto error;
 
@@ -7823,6 +8430,7 @@ _pickle.load
   encoding: str = 'ASCII'
   errors: str = 'strict'
   buffers: object(c_default="NULL") = ()
+  zero_copy: bool = False
 
 Read and return an object from the pickle data stored in a file.
 
@@ -7847,13 +8455,19 @@ map the old Python 2 names to the new names used in Python 3.  The
 instances pickled by Python 2; these default to 'ASCII' and 'strict',
 respectively.  The *encoding* can be 'bytes' to read these 8-bit
 string instances as bytes objects.
+
+If *zero_copy* is true, bytes and bytearray objects serialized with
+protocol 3 or higher are returned as memoryviews instead.  When the
+pickle data is in memory, these views borrow directly from it, so
+large payloads are not copied and pages of a memory-mapped input are
+only touched when a view is used.
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_load_impl(PyObject *module, PyObject *file, int fix_imports,
                   const char *encoding, const char *errors,
-                  PyObject *buffers)
-/*[clinic end generated code: output=250452d141c23e76 input=46c7c31c92f4f371]*/
+                  PyObject *buffers, int zero_copy)
+/*[clinic end generated code: output=93bcb00a84bf2a85 input=3a3eb8ddcae0d0d2]*/
 {
     PyObject *result;
     UnpicklerObject *unpickler = _Unpickler_New();
@@ -7871,6 +8485,7 @@ _pickle_load_impl(PyObject *module, PyObject *file, int fix_imports,
         goto error;
 
     unpickler->fix_imports = fix_imports;
+    unpickler->zero_copy = zero_copy;
 
     result = load(unpickler);
     Py_DECREF(unpickler);
@@ -7892,6 +8507,7 @@ _pickle.loads
   encoding: str = 'ASCII'
   errors: str = 'strict'
   buffers: object(c_default="NULL") = ()
+  zero_copy: bool = False
 
 Read and return an object from the given pickle data.
 
@@ -7907,13 +8523,19 @@ map the old Python 2 names to the new names used in Python 3.  The
 instances pickled by Python 2; these default to 'ASCII' and 'strict',
 respectively.  The *encoding* can be 'bytes' to read these 8-bit
 string instances as bytes objects.
+
+If *zero_copy* is true, bytes and bytearray objects serialized with
+protocol 3 or higher are returned as memoryviews instead.  When the
+pickle data is in memory, these views borrow directly from it, so
+large payloads are not copied and pages of a memory-mapped input are
+only touched when a view is used.
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_loads_impl(PyObject *module, PyObject *data, int fix_imports,
                    const char *encoding, const char *errors,
-                   PyObject *buffers)
-/*[clinic end generated code: output=82ac1e6b588e6d02 input=b3615540d0535087]*/
+                   PyObject *buffers, int zero_copy)
+/*[clinic end generated code: output=fcd658005b49060e input=d0452eaa0a6c1f35]*/
 {
     PyObject *result;
     UnpicklerObject *unpickler = _Unpickler_New();
@@ -7931,6 +8553,7 @@ _pickle_loads_impl(PyObject *module, PyObject *data, int fix_imports,
         goto error;
 
     unpickler->fix_imports = fix_imports;
+    unpickler->zero_copy = zero_copy;
 
     result = load(unpickler);
     Py_DECREF(unpickler);
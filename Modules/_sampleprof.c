@@ -0,0 +1,369 @@
+/* Statistical profiler: samples the Python stacks of all threads.
+
+   Each sample pauses one thread at a time with a handshake (see
+   _PyRuntimeState_Handshake()) and walks its register stack directly, without
+   creating frame objects. Identical stacks are aggregated in a hash table
+   keyed by (code object, line number) sequences. The sampling thread itself
+   is started by Lib/sampleprof.py. */
+
+#include "Python.h"
+#include "ceval_meta.h"
+#include "pycore_hashtable.h"
+#include "pycore_pystate.h"       // _PyRuntimeState_Handshake()
+#include "pycore_stackwalk.h"
+#include "lock.h"
+
+#include "clinic/_sampleprof.c.h"
+/*[clinic input]
+module _sampleprof
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=e73f6cf49b76d7fd]*/
+
+/* Deeper stacks are truncated: their outermost frames are dropped */
+#define MAX_NFRAME 128
+
+typedef struct {
+    PyCodeObject *code;     /* strong reference */
+    int lineno;
+} sample_frame_t;
+
+/* A sampled stack, innermost frame first */
+typedef struct {
+    Py_uhash_t hash;
+    int nframe;
+    sample_frame_t frames[1];
+} sample_stack_t;
+
+/* Filled by take_sample() while the sampled thread is paused. Only the
+   instruction offsets are recorded: line numbers are computed afterwards. */
+struct sample {
+    int nframe;
+    struct {
+        PyCodeObject *code;
+        int addrq;
+    } frames[MAX_NFRAME];
+};
+
+/* sample_stack_t* => number of samples (uintptr_t) */
+static _Py_hashtable_t *stacks = NULL;
+static _PyMutex stacks_mutex;
+
+
+static Py_uhash_t
+stack_hash(const void *key)
+{
+    return ((const sample_stack_t *)key)->hash;
+}
+
+static int
+stack_compare(const void *key1, const void *key2)
+{
+    const sample_stack_t *s1 = key1;
+    const sample_stack_t *s2 = key2;
+    if (s1->hash != s2->hash || s1->nframe != s2->nframe) {
+        return 0;
+    }
+    for (int i = 0; i < s1->nframe; i++) {
+        if (s1->frames[i].code != s2->frames[i].code ||
+            s1->frames[i].lineno != s2->frames[i].lineno) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void
+stack_free(void *key)
+{
+    sample_stack_t *s = key;
+    for (int i = 0; i < s->nframe; i++) {
+        Py_DECREF(s->frames[i].code);
+    }
+    PyMem_RawFree(s);
+}
+
+static _Py_hashtable_t *
+stacks_new(void)
+{
+    _Py_hashtable_allocator_t alloc = {PyMem_RawMalloc, PyMem_RawFree};
+    return _Py_hashtable_new_full(stack_hash, stack_compare,
+                                  stack_free, NULL, &alloc);
+}
+
+/* Handshake function: runs in the sampled thread, or on its behalf while it
+   is detached. Keep it short, the thread is paused meanwhile. */
+static void
+take_sample(PyThreadState *tstate, void *arg)
+{
+    struct sample *sample = arg;
+    struct _PyThreadStack *ts = vm_active(tstate);
+    if (ts == NULL) {
+        return;
+    }
+
+    struct stack_walk w;
+    vm_stack_walk_init(&w, ts);
+    while (sample->nframe < MAX_NFRAME && vm_stack_walk(&w)) {
+        PyFunctionObject *func = (PyFunctionObject *)AS_OBJ(w.regs[-1]);
+        PyCodeObject *code = _PyFunction_GET_CODE(func);
+
+        Py_INCREF(code);
+        sample->frames[sample->nframe].code = code;
+        sample->frames[sample->nframe].addrq =
+            (int)(w.pc - PyCode_FirstInstr(code));
+        sample->nframe++;
+    }
+}
+
+/* Add the sample to the table: steals the references to its code objects */
+static int
+add_sample(struct sample *sample)
+{
+    size_t size = (sizeof(sample_stack_t) +
+                   (sample->nframe - 1) * sizeof(sample_frame_t));
+    sample_stack_t *key = PyMem_RawMalloc(size);
+    if (key == NULL) {
+        for (int i = 0; i < sample->nframe; i++) {
+            Py_DECREF(sample->frames[i].code);
+        }
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    Py_uhash_t hash = (Py_uhash_t)sample->nframe;
+    for (int i = 0; i < sample->nframe; i++) {
+        PyCodeObject *code = sample->frames[i].code;
+        int lineno = PyCode_Addr2Line(code, sample->frames[i].addrq);
+        key->frames[i].code = code;
+        key->frames[i].lineno = lineno;
+        hash = (hash * 1000003) ^ _Py_hashtable_hash_ptr(code) ^ (Py_uhash_t)lineno;
+    }
+    key->hash = hash;
+    key->nframe = sample->nframe;
+
+    int res = 0;
+    _PyMutex_lock(&stacks_mutex);
+    if (stacks == NULL) {
+        stacks = stacks_new();
+    }
+    _Py_hashtable_entry_t *entry = NULL;
+    if (stacks != NULL) {
+        entry = _Py_hashtable_get_entry(stacks, key);
+        if (entry != NULL) {
+            entry->value = (void *)((uintptr_t)entry->value + 1);
+        }
+        else if (_Py_hashtable_set(stacks, key, (void *)(uintptr_t)1) < 0) {
+            res = -1;
+        }
+        else {
+            key = NULL;
+        }
+    }
+    else {
+        res = -1;
+    }
+    _PyMutex_unlock(&stacks_mutex);
+
+    if (key != NULL) {
+        // Freeing may run arbitrary code: do it without holding the lock
+        stack_free(key);
+    }
+    if (res < 0) {
+        PyErr_NoMemory();
+    }
+    return res;
+}
+
+
+/*[clinic input]
+_sampleprof.sample
+
+Sample the Python stack of every other thread once.
+
+Each thread is paused only while its own stack is walked. Threads blocked
+outside of Python code are sampled too, without waking them up.
+
+Return the number of threads sampled.
+[clinic start generated code]*/
+
+static PyObject *
+_sampleprof_sample_impl(PyObject *module)
+/*[clinic end generated code: output=5f44f53d6526ec2b input=960da003e585b979]*/
+{
+    _PyRuntimeState *runtime = &_PyRuntime;
+    unsigned long self_id = PyThread_get_thread_ident();
+    Py_ssize_t n, nsampled = 0;
+    unsigned long *ids = _PyRuntimeState_GetThreadIds(runtime, &n);
+    if (ids == NULL) {
+        return NULL;
+    }
+
+    struct sample *sample = PyMem_RawMalloc(sizeof(struct sample));
+    if (sample == NULL) {
+        PyMem_RawFree(ids);
+        return PyErr_NoMemory();
+    }
+
+    for (Py_ssize_t i = 0; i < n; i++) {
+        if (ids[i] == self_id) {
+            continue;
+        }
+        sample->nframe = 0;
+        if (!_PyRuntimeState_Handshake(runtime, ids[i], take_sample, sample)) {
+            // The thread exited
+            continue;
+        }
+        if (sample->nframe == 0) {
+            // Not running Python code (yet)
+            continue;
+        }
+        if (add_sample(sample) < 0) {
+            PyMem_RawFree(sample);
+            PyMem_RawFree(ids);
+            return NULL;
+        }
+        nsampled++;
+    }
+
+    PyMem_RawFree(sample);
+    PyMem_RawFree(ids);
+    return PyLong_FromSsize_t(nsampled);
+}
+
+
+static PyObject *
+frame_to_pyobject(sample_frame_t *frame)
+{
+    PyCodeObject *code = frame->code;
+    PyObject *lineno = PyLong_FromLong(frame->lineno);
+    if (lineno == NULL) {
+        return NULL;
+    }
+    PyObject *res = PyTuple_Pack(3, code->co_filename, code->co_name, lineno);
+    Py_DECREF(lineno);
+    return res;
+}
+
+static int
+stack_to_dict(_Py_hashtable_t *ht, const void *key, const void *value,
+              void *user_data)
+{
+    const sample_stack_t *stack = key;
+    PyObject *dict = user_data;
+
+    // Outermost frame first, as in collapsed stacks
+    PyObject *frames = PyTuple_New(stack->nframe);
+    if (frames == NULL) {
+        return -1;
+    }
+    for (int i = 0; i < stack->nframe; i++) {
+        PyObject *frame = frame_to_pyobject(
+            (sample_frame_t *)&stack->frames[stack->nframe - 1 - i]);
+        if (frame == NULL) {
+            Py_DECREF(frames);
+            return -1;
+        }
+        PyTuple_SET_ITEM(frames, i, frame);
+    }
+
+    // Distinct code objects may share a location: merge their counts
+    Py_ssize_t count = (Py_ssize_t)(uintptr_t)value;
+    PyObject *prev = PyDict_GetItemWithError(dict, frames);
+    if (prev != NULL) {
+        count += PyLong_AsSsize_t(prev);
+    }
+    else if (PyErr_Occurred()) {
+        Py_DECREF(frames);
+        return -1;
+    }
+    PyObject *pycount = PyLong_FromSsize_t(count);
+    if (pycount == NULL) {
+        Py_DECREF(frames);
+        return -1;
+    }
+    int res = PyDict_SetItem(dict, frames, pycount);
+    Py_DECREF(frames);
+    Py_DECREF(pycount);
+    return res;
+}
+
+/*[clinic input]
+_sampleprof.get_stacks
+
+Get the sampled stacks.
+
+Return a dict mapping each stack to its number of samples. A stack is a
+tuple of (filename, name, lineno) tuples, outermost frame first.
+[clinic start generated code]*/
+
+static PyObject *
+_sampleprof_get_stacks_impl(PyObject *module)
+/*[clinic end generated code: output=5ecf658a1c6ed4c8 input=30720682d754158f]*/
+{
+    PyObject *dict = PyDict_New();
+    if (dict == NULL) {
+        return NULL;
+    }
+
+    _PyMutex_lock(&stacks_mutex);
+    int res = 0;
+    if (stacks != NULL) {
+        res = _Py_hashtable_foreach(stacks, stack_to_dict, dict);
+    }
+    _PyMutex_unlock(&stacks_mutex);
+
+    if (res < 0) {
+        Py_DECREF(dict);
+        return NULL;
+    }
+    return dict;
+}
+
+
+/*[clinic input]
+_sampleprof.clear
+
+Clear the sampled stacks.
+[clinic start generated code]*/
+
+static PyObject *
+_sampleprof_clear_impl(PyObject *module)
+/*[clinic end generated code: output=e1edcb39422ad160 input=b10b0f001af709cb]*/
+{
+    _PyMutex_lock(&stacks_mutex);
+    _Py_hashtable_t *old = stacks;
+    stacks = NULL;
+    _PyMutex_unlock(&stacks_mutex);
+
+    if (old != NULL) {
+        _Py_hashtable_destroy(old);
+    }
+    Py_RETURN_NONE;
+}
+
+
+static PyMethodDef module_methods[] = {
+    _SAMPLEPROF_SAMPLE_METHODDEF
+    _SAMPLEPROF_GET_STACKS_METHODDEF
+    _SAMPLEPROF_CLEAR_METHODDEF
+    /* sentinel */
+    {NULL, NULL}
+};
+
+PyDoc_STRVAR(module_doc,
+"Sample the Python stacks of all threads.");
+
+static struct PyModuleDef module_def = {
+    PyModuleDef_HEAD_INIT,
+    "_sampleprof",
+    module_doc,
+    0, /* non-negative size to be able to unload the module */
+    module_methods,
+    NULL,
+};
+
+PyMODINIT_FUNC
+PyInit__sampleprof(void)
+{
+    return PyModule_Create(&module_def);
+}
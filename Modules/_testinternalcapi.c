@@ -13,6 +13,7 @@
 
 #include "Python.h"
 #include "pycore_byteswap.h"     // _Py_bswap32()
+#include "pycore_cpuinfo.h"      // _Py_cpu_features
 #include "pycore_initconfig.h"   // _Py_GetConfigsAsDict()
 #include "pycore_hashtable.h"    // _Py_hashtable_new()
 #include "pycore_gc.h"           // PyGC_Head
@@ -225,12 +226,31 @@ test_critical_sections(PyObject *self, PyObject *Py_UNUSED(args))
     Py_RETURN_NONE;
 }
 
+/* The features found at startup, before set_cpu_features() */
+static int detected_cpu_features = -1;
+
+static PyObject *
+set_cpu_features(PyObject *self, PyObject *arg)
+{
+    int features = _PyLong_AsInt(arg);
+    if (features == -1 && PyErr_Occurred()) {
+        return NULL;
+    }
+    int old = _Py_cpu_features;
+    if (detected_cpu_features == -1) {
+        detected_cpu_features = old;
+    }
+    _Py_cpu_features = features & detected_cpu_features;
+    return PyLong_FromLong(old);
+}
+
 static PyMethodDef TestMethods[] = {
     {"get_configs", get_configs, METH_NOARGS},
     {"get_recursion_depth", get_recursion_depth, METH_NOARGS},
     {"test_bswap", test_bswap, METH_NOARGS},
     {"test_hashtable", test_hashtable, METH_NOARGS},
     {"test_critical_sections", test_critical_sections, METH_NOARGS},
+    {"set_cpu_features", set_cpu_features, METH_O},
     {NULL, NULL} /* sentinel */
 };
 
@@ -260,6 +280,11 @@ PyInit__testinternalcapi(void)
                            PyLong_FromSsize_t(sizeof(PyGC_Head))) < 0) {
         goto error;
     }
+    if (PyModule_AddIntConstant(module, "CPU_SSE41", _Py_CPU_SSE41) < 0 ||
+        PyModule_AddIntConstant(module, "CPU_AVX2", _Py_CPU_AVX2) < 0 ||
+        PyModule_AddIntConstant(module, "CPU_SSE2", _Py_CPU_SSE2) < 0) {
+        goto error;
+    }
 
     return module;
 
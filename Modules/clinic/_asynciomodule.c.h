@@ -611,6 +611,311 @@ PyDoc_STRVAR(_asyncio_Task_set_name__doc__,
 #define _ASYNCIO_TASK_SET_NAME_METHODDEF    \
     {"set_name", (PyCFunction)_asyncio_Task_set_name, METH_O, _asyncio_Task_set_name__doc__},
 
+PyDoc_STRVAR(_asyncio_Handle___init____doc__,
+"Handle(callback, args, loop, context=None)\n"
+"--\n"
+"\n"
+"Object returned by callback registration methods.");
+
+static int
+_asyncio_Handle___init___impl(HandleObj *self, PyObject *callback,
+                              PyObject *callback_args, PyObject *loop,
+                              PyObject *context);
+
+static int
+_asyncio_Handle___init__(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    int return_value = -1;
+    static const char * const _keywords[] = {"callback", "args", "loop", "context", NULL};
+    static _PyArg_Parser _parser = {NULL, _keywords, "Handle", 0};
+    PyObject *argsbuf[4];
+    PyObject * const *fastargs;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 3;
+    PyObject *callback;
+    PyObject *callback_args;
+    PyObject *loop;
+    PyObject *context = Py_None;
+
+    fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser, 3, 4, 0, argsbuf);
+    if (!fastargs) {
+        goto exit;
+    }
+    callback = fastargs[0];
+    callback_args = fastargs[1];
+    loop = fastargs[2];
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    context = fastargs[3];
+skip_optional_pos:
+    return_value = _asyncio_Handle___init___impl((HandleObj *)self, callback, callback_args, loop, context);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio_Handle_cancel__doc__,
+"cancel($self, /)\n"
+"--\n"
+"\n");
+
+#define _ASYNCIO_HANDLE_CANCEL_METHODDEF    \
+    {"cancel", (PyCFunction)_asyncio_Handle_cancel, METH_NOARGS, _asyncio_Handle_cancel__doc__},
+
+static PyObject *
+_asyncio_Handle_cancel_impl(HandleObj *self);
+
+static PyObject *
+_asyncio_Handle_cancel(HandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_Handle_cancel_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio_Handle_cancelled__doc__,
+"cancelled($self, /)\n"
+"--\n"
+"\n");
+
+#define _ASYNCIO_HANDLE_CANCELLED_METHODDEF    \
+    {"cancelled", (PyCFunction)_asyncio_Handle_cancelled, METH_NOARGS, _asyncio_Handle_cancelled__doc__},
+
+static PyObject *
+_asyncio_Handle_cancelled_impl(HandleObj *self);
+
+static PyObject *
+_asyncio_Handle_cancelled(HandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_Handle_cancelled_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio_Handle__run__doc__,
+"_run($self, /)\n"
+"--\n"
+"\n");
+
+#define _ASYNCIO_HANDLE__RUN_METHODDEF    \
+    {"_run", (PyCFunction)_asyncio_Handle__run, METH_NOARGS, _asyncio_Handle__run__doc__},
+
+static PyObject *
+_asyncio_Handle__run_impl(HandleObj *self);
+
+static PyObject *
+_asyncio_Handle__run(HandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_Handle__run_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio_Handle__repr_info__doc__,
+"_repr_info($self, /)\n"
+"--\n"
+"\n");
+
+#define _ASYNCIO_HANDLE__REPR_INFO_METHODDEF    \
+    {"_repr_info", (PyCFunction)_asyncio_Handle__repr_info, METH_NOARGS, _asyncio_Handle__repr_info__doc__},
+
+static PyObject *
+_asyncio_Handle__repr_info_impl(HandleObj *self);
+
+static PyObject *
+_asyncio_Handle__repr_info(HandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_Handle__repr_info_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio_TimerHandle___init____doc__,
+"TimerHandle(when, callback, args, loop, context=None)\n"
+"--\n"
+"\n"
+"Object returned by timed callback registration methods.");
+
+static int
+_asyncio_TimerHandle___init___impl(TimerHandleObj *self, PyObject *when,
+                                   PyObject *callback,
+                                   PyObject *callback_args, PyObject *loop,
+                                   PyObject *context);
+
+static int
+_asyncio_TimerHandle___init__(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    int return_value = -1;
+    static const char * const _keywords[] = {"when", "callback", "args", "loop", "context", NULL};
+    static _PyArg_Parser _parser = {NULL, _keywords, "TimerHandle", 0};
+    PyObject *argsbuf[5];
+    PyObject * const *fastargs;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 4;
+    PyObject *when;
+    PyObject *callback;
+    PyObject *callback_args;
+    PyObject *loop;
+    PyObject *context = Py_None;
+
+    fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser, 4, 5, 0, argsbuf);
+    if (!fastargs) {
+        goto exit;
+    }
+    when = fastargs[0];
+    callback = fastargs[1];
+    callback_args = fastargs[2];
+    loop = fastargs[3];
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    context = fastargs[4];
+skip_optional_pos:
+    return_value = _asyncio_TimerHandle___init___impl((TimerHandleObj *)self, when, callback, callback_args, loop, context);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio_TimerHandle_when__doc__,
+"when($self, /)\n"
+"--\n"
+"\n"
+"Return a scheduled callback time.\n"
+"\n"
+"The time is an absolute timestamp, using the same time\n"
+"reference as loop.time().");
+
+#define _ASYNCIO_TIMERHANDLE_WHEN_METHODDEF    \
+    {"when", (PyCFunction)_asyncio_TimerHandle_when, METH_NOARGS, _asyncio_TimerHandle_when__doc__},
+
+static PyObject *
+_asyncio_TimerHandle_when_impl(TimerHandleObj *self);
+
+static PyObject *
+_asyncio_TimerHandle_when(TimerHandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_TimerHandle_when_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio__run_once__doc__,
+"_run_once($module, loop, /)\n"
+"--\n"
+"\n"
+"Run one full iteration of the event loop.\n"
+"\n"
+"This is the C implementation of BaseEventLoop._run_once() used when the\n"
+"loop is not in debug mode.");
+
+#define _ASYNCIO__RUN_ONCE_METHODDEF    \
+    {"_run_once", (PyCFunction)_asyncio__run_once, METH_O, _asyncio__run_once__doc__},
+
+PyDoc_STRVAR(_asyncio_Worker_create_task__doc__,
+"create_task($self, /, coro, *, name=None)\n"
+"--\n"
+"\n"
+"Create a Task on the loop of the worker that other workers may take.\n"
+"\n"
+"Must be called by the thread that runs the worker\'s loop.");
+
+#define _ASYNCIO_WORKER_CREATE_TASK_METHODDEF    \
+    {"create_task", (PyCFunction)(void(*)(void))_asyncio_Worker_create_task, METH_FASTCALL|METH_KEYWORDS, _asyncio_Worker_create_task__doc__},
+
+static PyObject *
+_asyncio_Worker_create_task_impl(WorkerObj *self, PyObject *coro,
+                                 PyObject *name);
+
+static PyObject *
+_asyncio_Worker_create_task(WorkerObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"coro", "name", NULL};
+    static _PyArg_Parser _parser = {NULL, _keywords, "create_task", 0};
+    PyObject *argsbuf[2];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 1;
+    PyObject *coro;
+    PyObject *name = Py_None;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 1, 1, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    coro = args[0];
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
+    name = args[1];
+skip_optional_kwonly:
+    return_value = _asyncio_Worker_create_task_impl(self, coro, name);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio_Worker_steal__doc__,
+"steal($self, /)\n"
+"--\n"
+"\n"
+"Move runnable tasks of other workers of the group to this worker\'s loop.\n"
+"\n"
+"Return the number of tasks taken.  If there were none, the worker is\n"
+"marked idle and its loop is woken up when another worker has tasks to\n"
+"spare.  Must be called by the thread that runs the worker\'s loop.");
+
+#define _ASYNCIO_WORKER_STEAL_METHODDEF    \
+    {"steal", (PyCFunction)_asyncio_Worker_steal, METH_NOARGS, _asyncio_Worker_steal__doc__},
+
+static PyObject *
+_asyncio_Worker_steal_impl(WorkerObj *self);
+
+static PyObject *
+_asyncio_Worker_steal(WorkerObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_Worker_steal_impl(self);
+}
+
+PyDoc_STRVAR(worker_group_new__doc__,
+"WorkerGroup(loops, /)\n"
+"--\n"
+"\n"
+"A group of event loops that share the tasks created by their workers.\n"
+"\n"
+"Each loop must be run by a different thread.");
+
+static PyObject *
+worker_group_new_impl(PyTypeObject *type, PyObject *loops);
+
+static PyObject *
+worker_group_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *loops;
+
+    if ((type == &WorkerGroupType) &&
+        !_PyArg_NoKeywords("WorkerGroup", kwargs)) {
+        goto exit;
+    }
+    if (!_PyArg_CheckPositional("WorkerGroup", PyTuple_GET_SIZE(args), 1, 1)) {
+        goto exit;
+    }
+    loops = PyTuple_GET_ITEM(args, 0);
+    return_value = worker_group_new_impl(type, loops);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio_WorkerGroup_close__doc__,
+"close($self, /)\n"
+"--\n"
+"\n"
+"Stop sharing tasks between the workers of the group.");
+
+#define _ASYNCIO_WORKERGROUP_CLOSE_METHODDEF    \
+    {"close", (PyCFunction)_asyncio_WorkerGroup_close, METH_NOARGS, _asyncio_WorkerGroup_close__doc__},
+
+static PyObject *
+_asyncio_WorkerGroup_close_impl(WorkerGroupObj *self);
+
+static PyObject *
+_asyncio_WorkerGroup_close(WorkerGroupObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_WorkerGroup_close_impl(self);
+}
+
 PyDoc_STRVAR(_asyncio__get_running_loop__doc__,
 "_get_running_loop($module, /)\n"
 "--\n"
@@ -757,6 +1062,18 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_asyncio__linked_tasks__doc__,
+"_linked_tasks($module, loop, /)\n"
+"--\n"
+"\n"
+"Return a list of the C tasks of the loop, including the done ones.\n"
+"\n"
+"Task-like objects registered with _register_task() are not included,\n"
+"they are in _all_tasks.");
+
+#define _ASYNCIO__LINKED_TASKS_METHODDEF    \
+    {"_linked_tasks", (PyCFunction)_asyncio__linked_tasks, METH_O, _asyncio__linked_tasks__doc__},
+
 PyDoc_STRVAR(_asyncio__enter_task__doc__,
 "_enter_task($module, /, loop, task)\n"
 "--\n"
@@ -832,4 +1149,16 @@ _asyncio__leave_task(PyObject *module, PyObject *const *args, Py_ssize_t nargs,
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=d0fc522bcbff9d61 input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(_asyncio__pin_task__doc__,
+"_pin_task($module, task, /)\n"
+"--\n"
+"\n"
+"Keep a task created by a Worker on its current loop and return the loop.\n"
+"\n"
+"After this call other workers of the group no longer take the task, so it\n"
+"can be safely manipulated from its loop\'s thread.");
+
+#define _ASYNCIO__PIN_TASK_METHODDEF    \
+    {"_pin_task", (PyCFunction)_asyncio__pin_task, METH_O, _asyncio__pin_task__doc__},
+/*[clinic end generated code: output=2bbae74de02f2154 input=a9049054013a1b77]*/
@@ -0,0 +1,66 @@
+/*[clinic input]
+preserve
+[clinic start generated code]*/
+
+PyDoc_STRVAR(_sampleprof_sample__doc__,
+"sample($module, /)\n"
+"--\n"
+"\n"
+"Sample the Python stack of every other thread once.\n"
+"\n"
+"Each thread is paused only while its own stack is walked. Threads blocked\n"
+"outside of Python code are sampled too, without waking them up.\n"
+"\n"
+"Return the number of threads sampled.");
+
+#define _SAMPLEPROF_SAMPLE_METHODDEF    \
+    {"sample", (PyCFunction)_sampleprof_sample, METH_NOARGS, _sampleprof_sample__doc__},
+
+static PyObject *
+_sampleprof_sample_impl(PyObject *module);
+
+static PyObject *
+_sampleprof_sample(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return _sampleprof_sample_impl(module);
+}
+
+PyDoc_STRVAR(_sampleprof_get_stacks__doc__,
+"get_stacks($module, /)\n"
+"--\n"
+"\n"
+"Get the sampled stacks.\n"
+"\n"
+"Return a dict mapping each stack to its number of samples. A stack is a\n"
+"tuple of (filename, name, lineno) tuples, outermost frame first.");
+
+#define _SAMPLEPROF_GET_STACKS_METHODDEF    \
+    {"get_stacks", (PyCFunction)_sampleprof_get_stacks, METH_NOARGS, _sampleprof_get_stacks__doc__},
+
+static PyObject *
+_sampleprof_get_stacks_impl(PyObject *module);
+
+static PyObject *
+_sampleprof_get_stacks(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return _sampleprof_get_stacks_impl(module);
+}
+
+PyDoc_STRVAR(_sampleprof_clear__doc__,
+"clear($module, /)\n"
+"--\n"
+"\n"
+"Clear the sampled stacks.");
+
+#define _SAMPLEPROF_CLEAR_METHODDEF    \
+    {"clear", (PyCFunction)_sampleprof_clear, METH_NOARGS, _sampleprof_clear__doc__},
+
+static PyObject *
+_sampleprof_clear_impl(PyObject *module);
+
+static PyObject *
+_sampleprof_clear(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return _sampleprof_clear_impl(module);
+}
+/*[clinic end generated code: output=b5a8b6d6febceca1 input=a9049054013a1b77]*/
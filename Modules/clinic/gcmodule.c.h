@@ -293,6 +293,28 @@ gc_get_stats(PyObject *module, PyObject *Py_UNUSED(ignored))
     return gc_get_stats_impl(module);
 }
 
+PyDoc_STRVAR(gc_get_safepoint_stats__doc__,
+"get_safepoint_stats($module, /)\n"
+"--\n"
+"\n"
+"Return a dictionary of statistics about stop-the-world pauses.\n"
+"\n"
+"The pauses are requested by the collector and other runtime operations\n"
+"that need all threads stopped.  The time to safepoint is the time the\n"
+"requesting thread waited until all other threads stopped.");
+
+#define GC_GET_SAFEPOINT_STATS_METHODDEF    \
+    {"get_safepoint_stats", (PyCFunction)gc_get_safepoint_stats, METH_NOARGS, gc_get_safepoint_stats__doc__},
+
+static PyObject *
+gc_get_safepoint_stats_impl(PyObject *module);
+
+static PyObject *
+gc_get_safepoint_stats(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return gc_get_safepoint_stats_impl(module);
+}
+
 PyDoc_STRVAR(gc_is_tracked__doc__,
 "is_tracked($module, obj, /)\n"
 "--\n"
@@ -382,4 +404,4 @@ gc_get_freeze_count(PyObject *module, PyObject *Py_UNUSED(ignored))
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=bd6a8056989e2e69 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=06c8536df334a7f9 input=a9049054013a1b77]*/
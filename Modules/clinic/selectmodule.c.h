@@ -870,6 +870,74 @@ exit:
 
 #if defined(HAVE_EPOLL)
 
+PyDoc_STRVAR(select_epoll_poll_into__doc__,
+"poll_into($self, /, buffer, timeout=None)\n"
+"--\n"
+"\n"
+"Wait for events on the epoll file descriptor, storing them in buffer.\n"
+"\n"
+"  buffer\n"
+"    a writable buffer, such as an array.array(\'I\'), receiving\n"
+"    fd and events pairs as C unsigned ints\n"
+"  timeout\n"
+"    the maximum time to wait in seconds (as float);\n"
+"    a timeout of None or -1 makes poll wait indefinitely\n"
+"\n"
+"Returns the number of events stored.  Unlike poll(), no Python objects\n"
+"are created for the events.  At most 256 events, and no more than fit\n"
+"into buffer, are returned per call.");
+
+#define SELECT_EPOLL_POLL_INTO_METHODDEF    \
+    {"poll_into", (PyCFunction)(void(*)(void))select_epoll_poll_into, METH_FASTCALL|METH_KEYWORDS, select_epoll_poll_into__doc__},
+
+static PyObject *
+select_epoll_poll_into_impl(pyEpoll_Object *self, Py_buffer *buffer,
+                            PyObject *timeout_obj);
+
+static PyObject *
+select_epoll_poll_into(pyEpoll_Object *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"buffer", "timeout", NULL};
+    static _PyArg_Parser _parser = {NULL, _keywords, "poll_into", 0};
+    PyObject *argsbuf[2];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 1;
+    Py_buffer buffer = {NULL, NULL};
+    PyObject *timeout_obj = Py_None;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 1, 2, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &buffer, PyBUF_WRITABLE) < 0) {
+        PyErr_Clear();
+        _PyArg_BadArgument("poll_into", "argument 'buffer'", "read-write bytes-like object", args[0]);
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&buffer, 'C')) {
+        _PyArg_BadArgument("poll_into", "argument 'buffer'", "contiguous buffer", args[0]);
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    timeout_obj = args[1];
+skip_optional_pos:
+    return_value = select_epoll_poll_into_impl(self, &buffer, timeout_obj);
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
+#endif /* defined(HAVE_EPOLL) */
+
+#if defined(HAVE_EPOLL)
+
 PyDoc_STRVAR(select_epoll___enter____doc__,
 "__enter__($self, /)\n"
 "--\n"
@@ -1196,6 +1264,10 @@ exit:
     #define SELECT_EPOLL_POLL_METHODDEF
 #endif /* !defined(SELECT_EPOLL_POLL_METHODDEF) */
 
+#ifndef SELECT_EPOLL_POLL_INTO_METHODDEF
+    #define SELECT_EPOLL_POLL_INTO_METHODDEF
+#endif /* !defined(SELECT_EPOLL_POLL_INTO_METHODDEF) */
+
 #ifndef SELECT_EPOLL___ENTER___METHODDEF
     #define SELECT_EPOLL___ENTER___METHODDEF
 #endif /* !defined(SELECT_EPOLL___ENTER___METHODDEF) */
@@ -1219,4 +1291,4 @@ exit:
 #ifndef SELECT_KQUEUE_CONTROL_METHODDEF
     #define SELECT_KQUEUE_CONTROL_METHODDEF
 #endif /* !defined(SELECT_KQUEUE_CONTROL_METHODDEF) */
-/*[clinic end generated code: output=ef42c3485a8fe3a0 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=cb0460003dc554e9 input=a9049054013a1b77]*/
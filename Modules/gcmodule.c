@@ -1500,7 +1500,8 @@ gc_reason_is_valid(GCState *gcstate, _PyGC_Reason reason)
 
 static void
 invoke_gc_callback(PyThreadState *tstate, const char *phase,
-                   Py_ssize_t collected, Py_ssize_t uncollectable);
+                   Py_ssize_t collected, Py_ssize_t uncollectable,
+                   _PyTime_t time_to_safepoint);
 
 /* This is the main function.  Read this to understand how the
  * collection process works. */
@@ -1537,9 +1538,10 @@ collect(PyThreadState *tstate, _PyGC_Reason reason)
 
     _PyMutex_lock(&_PyRuntime.stoptheworld_mutex);
     _PyRuntimeState_StopTheWorld(&_PyRuntime);
+    _PyTime_t time_to_safepoint = gcstate->stw_stats.last_time;
 
     if (reason != GC_REASON_SHUTDOWN) {
-        invoke_gc_callback(tstate, "start", 0, 0);
+        invoke_gc_callback(tstate, "start", 0, 0, time_to_safepoint);
     }
 
     if (gcstate->debug & DEBUG_STATS) {
@@ -1676,7 +1678,7 @@ collect(PyThreadState *tstate, _PyGC_Reason reason)
     assert(!_PyErr_Occurred(tstate));
 
     if (reason != GC_REASON_SHUTDOWN) {
-        invoke_gc_callback(tstate, "stop", m, n);
+        invoke_gc_callback(tstate, "stop", m, n, time_to_safepoint);
     }
 
     _Py_atomic_store_int(&gcstate->collecting, 0);
@@ -1688,7 +1690,8 @@ collect(PyThreadState *tstate, _PyGC_Reason reason)
  */
 static void
 invoke_gc_callback(PyThreadState *tstate, const char *phase,
-                   Py_ssize_t collected, Py_ssize_t uncollectable)
+                   Py_ssize_t collected, Py_ssize_t uncollectable,
+                   _PyTime_t time_to_safepoint)
 {
     assert(!_PyErr_Occurred(tstate));
 
@@ -1702,10 +1705,11 @@ invoke_gc_callback(PyThreadState *tstate, const char *phase,
     assert(PyList_CheckExact(gcstate->callbacks));
     PyObject *info = NULL;
     if (PyList_GET_SIZE(gcstate->callbacks) != 0) {
-        info = Py_BuildValue("{sisnsn}",
+        info = Py_BuildValue("{sisnsnsd}",
             "generation", 0,    // what value maximizes compatiblity?
             "collected", collected,
-            "uncollectable", uncollectable);
+            "uncollectable", uncollectable,
+            "time_to_safepoint", _PyTime_AsSecondsDouble(time_to_safepoint));
         if (info == NULL) {
             PyErr_WriteUnraisable(NULL);
             return;
@@ -2130,6 +2134,62 @@ error:
     return NULL;
 }
 
+/*[clinic input]
+gc.get_safepoint_stats
+
+Return a dictionary of statistics about stop-the-world pauses.
+
+The pauses are requested by the collector and other runtime operations
+that need all threads stopped.  The time to safepoint is the time the
+requesting thread waited until all other threads stopped.
+[clinic start generated code]*/
+
+static PyObject *
+gc_get_safepoint_stats_impl(PyObject *module)
+/*[clinic end generated code: output=70a8b2006611a9b0 input=a552bb14edc5311b]*/
+{
+    struct _gc_stw_stats stats;
+    PyObject *thread_id, *location, *result;
+    PyThreadState *tstate = _PyThreadState_GET();
+
+    /* Take a snapshot first: a collection triggered while building the
+       result may replace the code object. */
+    stats = tstate->interp->gc.stw_stats;
+    Py_XINCREF(stats.last_code);
+
+    if (stats.last_thread_id != 0) {
+        thread_id = PyLong_FromUnsignedLong(stats.last_thread_id);
+    }
+    else {
+        thread_id = Py_None;
+        Py_INCREF(thread_id);
+    }
+    if (stats.last_code != NULL) {
+        PyCodeObject *co = (PyCodeObject *)stats.last_code;
+        location = Py_BuildValue("(OiO)", co->co_filename,
+                                 stats.last_lineno, co->co_name);
+    }
+    else {
+        location = Py_None;
+        Py_INCREF(location);
+    }
+    Py_XDECREF(stats.last_code);
+    if (thread_id == NULL || location == NULL) {
+        Py_XDECREF(thread_id);
+        Py_XDECREF(location);
+        return NULL;
+    }
+
+    result = Py_BuildValue("{snsdsdsdsNsN}",
+                           "stops", stats.stops,
+                           "total_time", _PyTime_AsSecondsDouble(stats.total_time),
+                           "max_time", _PyTime_AsSecondsDouble(stats.max_time),
+                           "last_time", _PyTime_AsSecondsDouble(stats.last_time),
+                           "last_thread_id", thread_id,
+                           "last_location", location);
+    return result;
+}
+
 
 /*[clinic input]
 gc.is_tracked
@@ -2258,6 +2318,7 @@ static PyMethodDef GcMethods[] = {
     GC_COLLECT_METHODDEF
     GC_GET_OBJECTS_METHODDEF
     GC_GET_STATS_METHODDEF
+    GC_GET_SAFEPOINT_STATS_METHODDEF
     GC_IS_TRACKED_METHODDEF
     GC_IS_FINALIZED_METHODDEF
     {"get_referrers",  gc_get_referrers, METH_VARARGS,
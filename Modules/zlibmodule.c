@@ -199,6 +199,241 @@ arrange_output_buffer(z_stream *zst, PyObject **buffer, Py_ssize_t length)
     return ret;
 }
 
+#ifdef AT_LEAST_ZLIB_1_2_2_1
+/* Parallel compression, in the way of pigz.
+ *
+ * With threads > 1, data larger than PARALLEL_CHUNK_SIZE is split into
+ * chunks which are compressed to raw deflate data on up to `threads` threads.
+ * Each chunk is compressed with the PARALLEL_DICT_SIZE bytes of input before
+ * it as a preset dictionary, so that the ratio stays close to the serial
+ * one, and all but the last end with a sync flush, so that the chunks
+ * concatenate to a single deflate stream.  The zlib header and the Adler-32
+ * of the data, combined from the checksums of the chunks, are added around
+ * it.  The output depends on the chunk size, not on the number of threads.
+ */
+
+#define PARALLEL_CHUNK_SIZE (128 * 1024)
+#define PARALLEL_DICT_SIZE (32 * 1024)
+
+typedef struct {
+    const Byte *in;             /* Input of the chunk */
+    uInt inlen;
+    Byte *out;                  /* Compressed chunk, from PyMem_RawMalloc() */
+    size_t outlen;
+    uLong adler;                /* Adler-32 of the input */
+    int err;                    /* Z_OK, or the zlib error */
+} CompressChunk;
+
+typedef struct {
+    CompressChunk *chunks;
+    Py_ssize_t nchunks;
+    int level;
+    Py_ssize_t next_chunk;      /* Next chunk to compress; updated atomically */
+    Py_ssize_t running;         /* Threads still compressing; updated atomically */
+    PyThread_type_lock done;    /* Released by the last thread to finish */
+} ParallelCompress;
+
+/* Compress a chunk without the GIL.  Return Z_OK or the zlib error. */
+static int
+compress_chunk(CompressChunk *chunk, int level, int first, int last)
+{
+    z_stream zst;
+    size_t size, used;
+    Byte *out;
+    int err;
+
+    zst.opaque = NULL;
+    zst.zalloc = PyZlib_Malloc;
+    zst.zfree = PyZlib_Free;
+    err = deflateInit2(&zst, level, DEFLATED, -MAX_WBITS, DEF_MEM_LEVEL,
+                       Z_DEFAULT_STRATEGY);
+    if (err != Z_OK)
+        return err;
+    if (!first) {
+        err = deflateSetDictionary(&zst, chunk->in - PARALLEL_DICT_SIZE,
+                                   PARALLEL_DICT_SIZE);
+        if (err != Z_OK)
+            goto done;
+    }
+
+    /* deflateBound() plus room for the sync flush is usually enough */
+    size = deflateBound(&zst, chunk->inlen) + 16;
+    chunk->out = PyMem_RawMalloc(size);
+    if (chunk->out == NULL) {
+        err = Z_MEM_ERROR;
+        goto done;
+    }
+    zst.next_in = (Byte *)chunk->in;
+    zst.avail_in = chunk->inlen;
+    zst.next_out = chunk->out;
+    zst.avail_out = (uInt)size;
+    for (;;) {
+        err = deflate(&zst, last ? Z_FINISH : Z_SYNC_FLUSH);
+        if (err != Z_OK || zst.avail_out != 0)
+            break;
+        used = zst.next_out - chunk->out;
+        out = PyMem_RawRealloc(chunk->out, size * 2);
+        if (out == NULL) {
+            err = Z_MEM_ERROR;
+            goto done;
+        }
+        chunk->out = out;
+        zst.next_out = out + used;
+        zst.avail_out = (uInt)(size * 2 - used);
+        size *= 2;
+    }
+    if (err == (last ? Z_STREAM_END : Z_OK)) {
+        err = Z_OK;
+        chunk->outlen = zst.next_out - chunk->out;
+        chunk->adler = adler32(adler32(0L, Z_NULL, 0), chunk->in,
+                               chunk->inlen);
+    }
+  done:
+    deflateEnd(&zst);
+    return err;
+}
+
+static void
+parallel_compress_run(ParallelCompress *pc)
+{
+    for (;;) {
+        Py_ssize_t i = _Py_atomic_add_ssize(&pc->next_chunk, 1);
+        if (i >= pc->nchunks) {
+            break;
+        }
+        pc->chunks[i].err = compress_chunk(&pc->chunks[i], pc->level,
+                                           i == 0, i == pc->nchunks - 1);
+    }
+}
+
+static void
+parallel_compress_finish(ParallelCompress *pc)
+{
+    /* Don't touch pc after the last thread releases the lock */
+    if (_Py_atomic_add_ssize(&pc->running, -1) == 1) {
+        PyThread_release_lock(pc->done);
+    }
+}
+
+static void
+parallel_compress_worker(void *arg)
+{
+    ParallelCompress *pc = (ParallelCompress *)arg;
+    parallel_compress_run(pc);
+    parallel_compress_finish(pc);
+}
+
+static PyObject *
+compress_parallel(Py_buffer *data, int level, int threads)
+{
+    ParallelCompress pc;
+    CompressChunk *chunks;
+    PyObject *RetVal = NULL;
+    Py_ssize_t nchunks, nworkers, size, i;
+    unsigned int header, level_flags;
+    uLong adler;
+    Byte *p;
+    z_stream zst;
+
+    if (level != Z_DEFAULT_COMPRESSION && (level < 0 || level > 9)) {
+        PyErr_SetString(_zlibstate_global->ZlibError, "Bad compression level");
+        return NULL;
+    }
+    nchunks = (data->len + PARALLEL_CHUNK_SIZE - 1) / PARALLEL_CHUNK_SIZE;
+    chunks = PyMem_Calloc(nchunks, sizeof(CompressChunk));
+    if (chunks == NULL) {
+        return PyErr_NoMemory();
+    }
+    for (i = 0; i < nchunks; i++) {
+        chunks[i].in = (Byte *)data->buf + i * PARALLEL_CHUNK_SIZE;
+        chunks[i].inlen = (uInt)Py_MIN(PARALLEL_CHUNK_SIZE,
+                                       data->len - i * PARALLEL_CHUNK_SIZE);
+    }
+    pc.chunks = chunks;
+    pc.nchunks = nchunks;
+    pc.level = level;
+    pc.next_chunk = 0;
+    pc.done = PyThread_allocate_lock();
+    if (pc.done == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    PyThread_acquire_lock(pc.done, WAIT_LOCK);
+
+    /* This thread compresses chunks too.  If a helper thread can't be
+       started, the remaining threads pick up its share. */
+    nworkers = Py_MIN((Py_ssize_t)threads, nchunks) - 1;
+    pc.running = nworkers + 1;
+    Py_BEGIN_ALLOW_THREADS
+    for (i = 0; i < nworkers; i++) {
+        if (PyThread_start_new_thread(parallel_compress_worker, &pc) ==
+                PYTHREAD_INVALID_THREAD_ID) {
+            _Py_atomic_add_ssize(&pc.running, -1);
+        }
+    }
+    parallel_compress_run(&pc);
+    parallel_compress_finish(&pc);
+    PyThread_acquire_lock(pc.done, WAIT_LOCK);
+    Py_END_ALLOW_THREADS
+    PyThread_free_lock(pc.done);
+
+    size = 2 + 4;
+    for (i = 0; i < nchunks; i++) {
+        if (chunks[i].err != Z_OK) {
+            if (chunks[i].err == Z_MEM_ERROR) {
+                PyErr_SetString(PyExc_MemoryError,
+                                "Out of memory while compressing data");
+            }
+            else {
+                zst.msg = NULL;
+                zlib_error(zst, chunks[i].err, "while compressing data");
+            }
+            goto done;
+        }
+        size += chunks[i].outlen;
+    }
+    RetVal = PyBytes_FromStringAndSize(NULL, size);
+    if (RetVal == NULL) {
+        goto done;
+    }
+
+    /* The zlib header which deflate() writes for this level */
+    if (level == Z_DEFAULT_COMPRESSION || level == 6)
+        level_flags = 2;
+    else if (level < 2)
+        level_flags = 0;
+    else if (level < 6)
+        level_flags = 1;
+    else
+        level_flags = 3;
+    header = (DEFLATED + ((MAX_WBITS - 8) << 4)) << 8 | level_flags << 6;
+    header += 31 - header % 31;
+    p = (Byte *)PyBytes_AS_STRING(RetVal);
+    *p++ = (Byte)(header >> 8);
+    *p++ = (Byte)header;
+
+    adler = chunks[0].adler;
+    for (i = 0; i < nchunks; i++) {
+        memcpy(p, chunks[i].out, chunks[i].outlen);
+        p += chunks[i].outlen;
+        if (i > 0)
+            adler = adler32_combine(adler, chunks[i].adler, chunks[i].inlen);
+    }
+    *p++ = (Byte)(adler >> 24);
+    *p++ = (Byte)(adler >> 16);
+    *p++ = (Byte)(adler >> 8);
+    *p++ = (Byte)adler;
+    assert(p == (Byte *)PyBytes_AS_STRING(RetVal) + size);
+
+  done:
+    for (i = 0; i < nchunks; i++) {
+        PyMem_RawFree(chunks[i].out);
+    }
+    PyMem_Free(chunks);
+    return RetVal;
+}
+#endif /* AT_LEAST_ZLIB_1_2_2_1 */
+
 /*[clinic input]
 zlib.compress
 
@@ -207,13 +442,16 @@ zlib.compress
     /
     level: int(c_default="Z_DEFAULT_COMPRESSION") = Z_DEFAULT_COMPRESSION
         Compression level, in 0-9 or -1.
+    *
+    threads: int = 1
+        Number of threads to compress large data on.
 
 Returns a bytes object containing compressed data.
 [clinic start generated code]*/
 
 static PyObject *
-zlib_compress_impl(PyObject *module, Py_buffer *data, int level)
-/*[clinic end generated code: output=d80906d73f6294c8 input=638d54b6315dbed3]*/
+zlib_compress_impl(PyObject *module, Py_buffer *data, int level, int threads)
+/*[clinic end generated code: output=c4c9e402a303e81d input=61f071d27bf533bf]*/
 {
     PyObject *RetVal = NULL;
     Byte *ibuf;
@@ -221,6 +459,16 @@ zlib_compress_impl(PyObject *module, Py_buffer *data, int level)
     int err, flush;
     z_stream zst;
 
+    if (threads < 1) {
+        PyErr_SetString(PyExc_ValueError, "threads must be at least 1");
+        return NULL;
+    }
+#ifdef AT_LEAST_ZLIB_1_2_2_1
+    if (threads > 1 && data->len > PARALLEL_CHUNK_SIZE) {
+        return compress_parallel(data, level, threads);
+    }
+#endif
+
     ibuf = data->buf;
     ibuflen = data->len;
 
@@ -2695,6 +2695,31 @@ int PyIter_Check(PyObject *obj)
  * will be false.
  * Else return the next object.  PyErr_Occurred() will be false.
  */
+PySendResult
+PyIter_Send(PyObject *iter, PyObject *arg, PyObject **result)
+{
+    _Py_IDENTIFIER(send);
+    assert(arg != NULL);
+    assert(result != NULL);
+    PyAsyncMethods *am = Py_TYPE(iter)->tp_as_async;
+    if (am != NULL && am->am_send != NULL) {
+        return am->am_send(iter, arg, result);
+    }
+    if (arg == Py_None && PyIter_Check(iter)) {
+        *result = Py_TYPE(iter)->tp_iternext(iter);
+    }
+    else {
+        *result = _PyObject_CallMethodIdOneArg(iter, &PyId_send, arg);
+    }
+    if (*result != NULL) {
+        return PYGEN_NEXT;
+    }
+    if (_PyGen_FetchStopIterationValue(result) == 0) {
+        return PYGEN_RETURN;
+    }
+    return PYGEN_ERROR;
+}
+
 PyObject *
 PyIter_Next(PyObject *iter)
 {
@@ -5,6 +5,7 @@
 #include "Python.h"
 #include "pycore_abstract.h"      // _PyIndex_Check()
 #include "pycore_bytes_methods.h"
+#include "pycore_cpuinfo.h"       // _Py_cpu_features
 #include "pycore_object.h"
 #include "pycore_pymem.h"         // PYMEM_CLEANBYTE
 
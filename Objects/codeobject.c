@@ -438,6 +438,10 @@ code_dealloc(PyCodeObject *co)
     Py_XDECREF(co->co_name);
     Py_XDECREF(co->co_lnotab);
 
+    for (int i = 0; i < _PyCode_NKWMAPS; i++) {
+        PyMem_RawFree(co->co_kwmaps[i]);
+    }
+
     if (co->co_extra != NULL) {
         PyInterpreterState *interp = _PyInterpreterState_GET();
         _PyCodeObjectExtra *co_extra = co->co_extra;
@@ -653,6 +657,29 @@ error:
     return -1;
 }
 
+/* Intern a constant that is not in a code object yet */
+int
+_PyCode_InternConstant(PyObject **ptr)
+{
+    PyInterpreterState *is = PyThreadState_GET()->interp;
+    _PyRecursiveMutex_lock(&is->consts_mutex);
+
+    int err = -1;
+    _Py_hashtable_t *consts = is->consts;
+    if (consts == NULL) {
+        consts = _Py_hashtable_new(&hash_const, &compare_const);
+        if (consts == NULL) {
+            goto done;
+        }
+        is->consts = consts;
+    }
+    err = intern_constant(consts, ptr);
+
+done:
+    _PyRecursiveMutex_unlock(&is->consts_mutex);
+    return err;
+}
+
 static PyObject *
 code_repr(PyCodeObject *co)
 {
@@ -80,59 +80,6 @@ PyGen_NewWithCode(PyThreadState *tstate, PyCodeObject *co)
     }
 }
 
-/*
- *   If StopIteration exception is set, fetches its 'value'
- *   attribute if any, otherwise sets pvalue to None.
- *
- *   Returns 0 if no exception or StopIteration is set.
- *   If any other exception is set, returns -1 and leaves
- *   pvalue unchanged.
- */
-
-PyObject *
-_PyGen_FetchStopIterationValue2(void)
-{
-    PyObject *et, *ev, *tb;
-    PyObject *value = NULL;
-
-    if (PyErr_ExceptionMatches(PyExc_StopIteration)) {
-        PyErr_Fetch(&et, &ev, &tb);
-        if (ev) {
-            /* exception will usually be normalised already */
-            if (PyObject_TypeCheck(ev, (PyTypeObject *) et)) {
-                value = ((PyStopIterationObject *)ev)->value;
-                Py_INCREF(value);
-                Py_DECREF(ev);
-            } else if (et == PyExc_StopIteration && !PyTuple_Check(ev)) {
-                /* Avoid normalisation and take ev as value.
-                 *
-                 * Normalization is required if the value is a tuple, in
-                 * that case the value of StopIteration would be set to
-                 * the first element of the tuple.
-                 *
-                 * (See _PyErr_CreateException code for details.)
-                 */
-                value = ev;
-            } else {
-                /* normalisation required */
-                PyErr_NormalizeException(&et, &ev, &tb);
-                if (!PyObject_TypeCheck(ev, (PyTypeObject *)PyExc_StopIteration)) {
-                    PyErr_Restore(et, ev, tb);
-                    return NULL;
-                }
-                value = ((PyStopIterationObject *)ev)->value;
-                Py_INCREF(value);
-                Py_DECREF(ev);
-            }
-        }
-        Py_XDECREF(et);
-        Py_XDECREF(tb);
-    } else if (PyErr_Occurred()) {
-        return NULL;
-    }
-    return value == NULL ? Py_None : value;
-}
-
 static int
 gen_traverse(PyGenObject *gen, visitproc visit, void *arg)
 {
@@ -203,9 +150,6 @@ gen_typename(PyGenObject *gen)
     }
 }
 
-static PyObject *
-_PyGen_SetStopIterationValue2(PyGenObject *gen);
-
 static PyObject *
 gen_wrap_exception(PyGenObject *gen)
 {
@@ -225,8 +169,10 @@ gen_wrap_exception(PyGenObject *gen)
     return NULL;
 }
 
-static PyObject *
-gen_send_internal(PyGenObject *gen, PyObject *opt_value)
+/* Resumes the generator. The return value is passed back in *presult
+   (PYGEN_RETURN) instead of being raised as StopIteration. */
+static PySendResult
+gen_send_ex2(PyGenObject *gen, PyObject *opt_value, PyObject **presult)
 {
     PyObject *res;
 
@@ -236,7 +182,8 @@ gen_send_internal(PyGenObject *gen, PyObject *opt_value)
                 PyExc_TypeError,
                 "can't send non-None value to a just-started %s",
                 gen_typename(gen));
-            return NULL;
+            *presult = NULL;
+            return PYGEN_ERROR;
         }
         opt_value = NULL;
     }
@@ -245,22 +192,41 @@ gen_send_internal(PyGenObject *gen, PyObject *opt_value)
 
     if (LIKELY(res != NULL)) {
         assert(gen->status == GEN_SUSPENDED);
-        return res;
+        *presult = res;
+        return PYGEN_NEXT;
     }
 
-    if (LIKELY(gen->return_value == Py_None)) {
+    res = gen->return_value;
+    if (LIKELY(res != NULL)) {
         gen->return_value = NULL;
+        *presult = res;
+        return PYGEN_RETURN;
+    }
+
+    *presult = NULL;
+    gen_wrap_exception(gen);
+    return PYGEN_ERROR;
+}
+
+static PyObject *
+gen_send_internal(PyGenObject *gen, PyObject *opt_value)
+{
+    PyObject *res;
+
+    if (LIKELY(gen_send_ex2(gen, opt_value, &res) != PYGEN_RETURN)) {
+        return res;
+    }
+
+    if (LIKELY(res == Py_None)) {
         PyErr_SetNone(PyAsyncGen_CheckExact(gen)
                         ? PyExc_StopAsyncIteration
                         : PyExc_StopIteration);
-        return NULL;
-    }
-    else if (gen->return_value != NULL) {
-        return _PyGen_SetStopIterationValue2(gen);
     }
     else {
-        return gen_wrap_exception(gen);
+        _PyGen_SetStopIterationValue(res);
     }
+    Py_DECREF(res);
+    return NULL;
 }
 
 static PyObject *
@@ -314,33 +280,41 @@ _PyGen_Send(PyGenObject *gen, PyObject *arg)
     return gen_send_internal(gen, arg);
 }
 
-static PyObject *
-_PyObject_YieldFrom_ex(PyObject *awaitable, PyObject *arg)
+/* am_send of generators and coroutines */
+static PySendResult
+gen_am_send(PyGenObject *gen, PyObject *arg, PyObject **presult)
 {
-    _Py_IDENTIFIER(send);
-    if (arg == Py_None) {
-        return Py_TYPE(awaitable)->tp_iternext(awaitable);
+    if (UNLIKELY(gen->status >= GEN_RUNNING)) {
+        if (gen->status == GEN_CLOSED && PyGen_CheckExact(gen)) {
+            /* an exhausted generator returns None */
+            Py_INCREF(Py_None);
+            *presult = Py_None;
+            return PYGEN_RETURN;
+        }
+        *presult = gen_status_error(gen, arg);
+        return PYGEN_ERROR;
     }
-    return _PyObject_CallMethodIdOneArg(awaitable, &PyId_send, arg);
+    return gen_send_ex2(gen, arg, presult);
 }
 
-PyObject *
-_PyGen_YieldFrom(PyGenObject *gen, PyObject *awaitable, PyObject *arg)
+PySendResult
+_PyGen_YieldFrom(PyGenObject *gen, PyObject *awaitable, PyObject *arg,
+                 PyObject **presult)
 {
     Py_CLEAR(gen->yield_from);
-    PyObject *res;
+    PySendResult status;
     if (LIKELY(PyGen_CheckExact(awaitable) || PyCoro_CheckExact(awaitable))) {
-        res = _PyGen_Send((PyGenObject *)awaitable, arg);
+        status = gen_am_send((PyGenObject *)awaitable, arg, presult);
     }
     else {
-        res = _PyObject_YieldFrom_ex(awaitable, arg);
+        status = PyIter_Send(awaitable, arg, presult);
     }
-    if (res != NULL) {
+    if (status == PYGEN_NEXT) {
         assert(gen->yield_from == NULL);
         Py_XINCREF(awaitable);
         gen->yield_from = awaitable;
     }
-    return res;
+    return status;
 }
 
 static int
@@ -674,48 +648,24 @@ gen_close(PyGenObject *gen, PyObject *args)
     return NULL;
 }
 
-static PyObject *
-_PyGen_SetStopIterationValue2(PyGenObject *gen)
-{
-    PyObject *e;
-    PyObject *value = gen->return_value;
-
-    if (value == NULL ||
-        (!PyTuple_Check(value) && !PyExceptionInstance_Check(value)))
-    {
-        /* Delay exception instantiation if we can */
-        PyErr_SetObject(PyExc_StopIteration, value);
-        Py_CLEAR(gen->return_value);
-        return NULL;
-    }
-
-    /* Construct an exception instance manually with
-     * _PyObject_CallOneArg and pass it to PyErr_SetObject.
-     *
-     * We do this to handle a situation when "value" is a tuple, in which
-     * case PyErr_SetObject would set the value of StopIteration to
-     * the first element of the tuple.
-     *
-     * (See PyErr_SetObject/_PyErr_CreateException code for details.)
-     */
-    e = _PyObject_CallOneArg(PyExc_StopIteration, value);
-    if (e == NULL) {
-        return NULL;
-    }
-
-    PyErr_SetObject(PyExc_StopIteration, e);
-    Py_DECREF(e);
-    Py_CLEAR(gen->return_value);
-    return NULL;
-}
-
 static PyObject *
 gen_iternext(PyGenObject *gen)
 {
+    PyObject *res;
+
     if (UNLIKELY(gen->status >= GEN_RUNNING)) {
         return gen_status_error(gen, NULL);
     }
-    return gen_send_internal(gen, Py_None);
+    if (LIKELY(gen_send_ex2(gen, Py_None, &res) != PYGEN_RETURN)) {
+        return res;
+    }
+    /* A generator that returns None is exhausted: tp_iternext signals that
+       without an exception. */
+    if (res != Py_None) {
+        _PyGen_SetStopIterationValue(res);
+    }
+    Py_DECREF(res);
+    return NULL;
 }
 
 /*
@@ -1143,6 +1093,12 @@ coro_wrapper_iternext(PyCoroWrapper *cw)
     return _PyGen_Send((PyGenObject *)cw->coroutine, Py_None);
 }
 
+static PySendResult
+coro_wrapper_am_send(PyCoroWrapper *cw, PyObject *arg, PyObject **presult)
+{
+    return gen_am_send((PyGenObject *)cw->coroutine, arg, presult);
+}
+
 PyDoc_STRVAR(coro_send_doc,
 "send(arg) -> send 'arg' into coroutine,\n\
 return next iterated value or raise StopIteration.");
@@ -1230,24 +1186,29 @@ async_gen_asend_traverse(PyAsyncGenASend *o, visitproc visit, void *arg)
 }
 
 
-static PyObject *
-async_gen_asend_send(PyAsyncGenASend *o, PyObject *arg)
+/* Like async_gen_asend_send(), but a value yielded by the async generator
+   completes the awaitable through *presult (PYGEN_RETURN) instead of
+   raising StopIteration. */
+static PySendResult
+async_gen_asend_am_send(PyAsyncGenASend *o, PyObject *arg, PyObject **presult)
 {
+    PyAsyncGenObject *gen = o->ags_gen;
     PyObject *result;
 
+    *presult = NULL;
     if (o->ags_state == AWAITABLE_STATE_CLOSED) {
         PyErr_SetString(
             PyExc_RuntimeError,
             "cannot reuse already awaited __anext__()/asend()");
-        return NULL;
+        return PYGEN_ERROR;
     }
 
     if (o->ags_state == AWAITABLE_STATE_INIT) {
-        if (o->ags_gen->running_async) {
+        if (gen->running_async) {
             PyErr_SetString(
                 PyExc_RuntimeError,
                 "anext(): asynchronous generator is already running");
-            return NULL;
+            return PYGEN_ERROR;
         }
 
         if (arg == NULL || arg == Py_None) {
@@ -1259,14 +1220,45 @@ async_gen_asend_send(PyAsyncGenASend *o, PyObject *arg)
         arg = Py_None;
     }
 
-    o->ags_gen->running_async = 1;
-    result = _PyGen_Send((PyGenObject *)o->ags_gen, arg);
-    result = async_gen_unwrap_value(o->ags_gen, result);
+    gen->running_async = 1;
+    if (UNLIKELY(gen->base.status >= GEN_RUNNING)) {
+        result = gen_status_error((PyGenObject *)gen, arg);
+    }
+    else if (gen_send_ex2((PyGenObject *)gen, arg, &result) == PYGEN_RETURN) {
+        /* the async generator is exhausted: StopAsyncIteration is set by
+           async_gen_unwrap_value() */
+        Py_CLEAR(result);
+    }
+
+    if (result != NULL && _PyAsyncGenWrappedValue_CheckExact(result)) {
+        /* async yield */
+        *presult = ((_PyAsyncGenWrappedValue *)result)->agw_val;
+        Py_INCREF(*presult);
+        Py_DECREF(result);
+        gen->running_async = 0;
+        o->ags_state = AWAITABLE_STATE_CLOSED;
+        return PYGEN_RETURN;
+    }
 
+    result = async_gen_unwrap_value(gen, result);
     if (result == NULL) {
         o->ags_state = AWAITABLE_STATE_CLOSED;
+        return PYGEN_ERROR;
     }
+    *presult = result;
+    return PYGEN_NEXT;
+}
+
+static PyObject *
+async_gen_asend_send(PyAsyncGenASend *o, PyObject *arg)
+{
+    PyObject *result;
 
+    if (async_gen_asend_am_send(o, arg, &result) == PYGEN_RETURN) {
+        _PyGen_SetStopIterationValue(result);
+        Py_DECREF(result);
+        return NULL;
+    }
     return result;
 }
 
@@ -1666,11 +1658,16 @@ static PyMethodDef gen_methods[] = {
     {NULL, NULL}        /* Sentinel */
 };
 
+static PyAsyncMethods gen_as_async = {
+    .am_send = (sendfunc)gen_am_send
+};
+
 PyTypeObject PyGen_Type = {
     PyVarObject_HEAD_INIT(&PyType_Type, 0)
     .tp_name = "generator",
     .tp_basicsize = sizeof(PyGenObject),
     .tp_dealloc = (destructor)gen_dealloc,
+    .tp_as_async = &gen_as_async,
     .tp_repr = (reprfunc)gen_repr,
     .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
     .tp_traverse = (traverseproc)gen_traverse,
@@ -1684,7 +1681,8 @@ PyTypeObject PyGen_Type = {
 };
 
 static PyAsyncMethods coro_as_async = {
-    .am_await = (unaryfunc)coro_await
+    .am_await = (unaryfunc)coro_await,
+    .am_send = (sendfunc)gen_am_send
 };
 
 static PyMethodDef coro_methods[] = {
@@ -1736,11 +1734,16 @@ static PyMethodDef coro_wrapper_methods[] = {
     {NULL, NULL}        /* Sentinel */
 };
 
+static PyAsyncMethods coro_wrapper_as_async = {
+    .am_send = (sendfunc)coro_wrapper_am_send
+};
+
 PyTypeObject _PyCoroWrapper_Type = {
     PyVarObject_HEAD_INIT(&PyType_Type, 0)
     "coroutine_wrapper",
     .tp_basicsize = sizeof(PyCoroWrapper),
     .tp_dealloc = (destructor)coro_wrapper_dealloc,
+    .tp_as_async = &coro_wrapper_as_async,
     .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
     .tp_doc = "A wrapper object implementing __await__ for coroutines.",
     .tp_traverse = (traverseproc)coro_wrapper_traverse,
@@ -1819,7 +1822,8 @@ static PyMethodDef async_gen_asend_methods[] = {
 
 
 static PyAsyncMethods async_gen_asend_as_async = {
-    .am_await = PyObject_SelfIter
+    .am_await = PyObject_SelfIter,
+    .am_send = (sendfunc)async_gen_asend_am_send
 };
 
 
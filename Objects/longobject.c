@@ -89,6 +89,21 @@ _PyLong_Negate(PyLongObject **x_p)
 #define KARATSUBA_CUTOFF 70
 #define KARATSUBA_SQUARE_CUTOFF (2 * KARATSUBA_CUTOFF)
 
+/* For int division, use the O(N**2) school algorithm (x_divrem) unless
+ * both the divisor and the quotient contain more than BZ_DIV_CUTOFF
+ * digits.  Above, the Burnikel-Ziegler recursive division costs a few
+ * Karatsuba multiplications.
+ */
+#define BZ_DIV_CUTOFF 60
+
+/* Conversions of ints of more than TO_DECIMAL_CUTOFF digits to decimal,
+ * and of strings of more than FROM_STRING_CUTOFF digits in a base that
+ * is not a power of 2 to int, split the number in halves recursively
+ * instead of using the O(N**2) school algorithm.
+ */
+#define TO_DECIMAL_CUTOFF 200
+#define FROM_STRING_CUTOFF 2000
+
 /* For exponentiation, use the binary left-to-right algorithm
  * unless the exponent contains more than FIVEARY_CUTOFF digits.
  * In that case, do 5 bits at a time.  The potential drawback is that
@@ -1691,6 +1706,75 @@ divrem1(PyLongObject *a, digit n, digit *prem)
     return long_normalize(z);
 }
 
+static int long_divrem(PyLongObject *, PyLongObject *,
+                       PyLongObject **, PyLongObject **);
+static PyObject *long_mul(PyLongObject *, PyLongObject *);
+static PyObject *long_abs(PyLongObject *);
+
+/* Convert the size_a digits pin[0:size_a] of base _PyLong_BASE to base
+   _PyLong_DECIMAL_BASE digits in pout, least significant first, following
+   Knuth (TAOCP, Volume 2 (3rd edn), section 4.4, Method 1b).  Return the
+   number of digits written to pout (0 if size_a is 0), or -1 with an
+   exception set if interrupted. */
+
+static Py_ssize_t
+digits_to_decimal(digit *pout, const digit *pin, Py_ssize_t size_a)
+{
+    Py_ssize_t size = 0, i, j;
+
+    for (i = size_a; --i >= 0; ) {
+        digit hi = pin[i];
+        for (j = 0; j < size; j++) {
+            twodigits z = (twodigits)pout[j] << PyLong_SHIFT | hi;
+            hi = (digit)(z / _PyLong_DECIMAL_BASE);
+            pout[j] = (digit)(z - (twodigits)hi *
+                              _PyLong_DECIMAL_BASE);
+        }
+        while (hi) {
+            pout[size++] = hi % _PyLong_DECIMAL_BASE;
+            hi /= _PyLong_DECIMAL_BASE;
+        }
+        /* check for keyboard interrupt */
+        SIGCHECK({
+                return -1;
+            });
+    }
+    return size;
+}
+
+/* Write the nonnegative a, which is < pow10[level], as exactly 2**level
+   base _PyLong_DECIMAL_BASE digits in pout, where pow10[i] is
+   _PyLong_DECIMAL_BASE**(2**i).  Big numbers are divided by pow10[level-1]
+   and their halves converted recursively. */
+
+static int
+long_to_decimal_recursive(PyLongObject *a, digit *pout,
+                          PyLongObject **pow10, int level)
+{
+    Py_ssize_t width = (Py_ssize_t)1 << level, size;
+    PyLongObject *q, *r;
+    int res;
+
+    if (Py_SIZE(a) <= TO_DECIMAL_CUTOFF) {
+        size = digits_to_decimal(pout, a->ob_digit, Py_SIZE(a));
+        if (size < 0)
+            return -1;
+        assert(size <= width);
+        memset(pout + size, 0, (width - size) * sizeof(digit));
+        return 0;
+    }
+    assert(level > 0);
+    if (long_divrem(a, pow10[level - 1], &q, &r) < 0)
+        return -1;
+    res = long_to_decimal_recursive(r, pout, pow10, level - 1);
+    if (res == 0)
+        res = long_to_decimal_recursive(q, pout + width / 2,
+                                        pow10, level - 1);
+    Py_DECREF(q);
+    Py_DECREF(r);
+    return res;
+}
+
 /* Convert an integer to a base 10 string.  Returns a new non-shared
    string.  (Return value is non-shared so that callers can modify the
    returned value if necessary.) */
@@ -1705,7 +1789,7 @@ long_to_decimal_string_internal(PyObject *aa,
     PyLongObject *scratch, *a;
     PyObject *str = NULL;
     Py_ssize_t size, strlen, size_a, i, j;
-    digit *pout, *pin, rem, tenpow;
+    digit *pout, rem, tenpow;
     int negative;
     int d;
     enum PyUnicode_Kind kind;
@@ -1736,33 +1820,57 @@ long_to_decimal_string_internal(PyObject *aa,
         (10 * PyLong_SHIFT - 33 * _PyLong_DECIMAL_SHIFT);
     assert(size_a < PY_SSIZE_T_MAX/2);
     size = 1 + size_a + size_a / d;
-    scratch = _PyLong_New(size);
-    if (scratch == NULL)
-        return -1;
 
-    /* convert array of base _PyLong_BASE digits in pin to an array of
-       base _PyLong_DECIMAL_BASE digits in pout, following Knuth (TAOCP,
-       Volume 2 (3rd edn), section 4.4, Method 1b). */
-    pin = a->ob_digit;
-    pout = scratch->ob_digit;
-    size = 0;
-    for (i = size_a; --i >= 0; ) {
-        digit hi = pin[i];
-        for (j = 0; j < size; j++) {
-            twodigits z = (twodigits)pout[j] << PyLong_SHIFT | hi;
-            hi = (digit)(z / _PyLong_DECIMAL_BASE);
-            pout[j] = (digit)(z - (twodigits)hi *
-                              _PyLong_DECIMAL_BASE);
-        }
-        while (hi) {
-            pout[size++] = hi % _PyLong_DECIMAL_BASE;
-            hi /= _PyLong_DECIMAL_BASE;
+    if (size_a <= TO_DECIMAL_CUTOFF) {
+        scratch = _PyLong_New(size);
+        if (scratch == NULL)
+            return -1;
+        pout = scratch->ob_digit;
+        size = digits_to_decimal(pout, a->ob_digit, size_a);
+        if (size < 0) {
+            Py_DECREF(scratch);
+            return -1;
         }
-        /* check for keyboard interrupt */
-        SIGCHECK({
-                Py_DECREF(scratch);
+    }
+    else {
+        /* Divide and conquer: split |a| by the powers
+           _PyLong_DECIMAL_BASE**(2**i) down to numbers of TO_DECIMAL_CUTOFF
+           digits.  The output has 2**level digits, the first power of 2
+           above the upper bound size. */
+        PyLongObject *pow10[8 * sizeof(Py_ssize_t)], *abs_a;
+        int level = 0, res;
+
+        while (((Py_ssize_t)1 << level) < size)
+            level++;
+        pow10[0] = (PyLongObject *)PyLong_FromLong(_PyLong_DECIMAL_BASE);
+        if (pow10[0] == NULL)
+            return -1;
+        for (i = 1; i < level; i++) {
+            pow10[i] = (PyLongObject *)long_mul(pow10[i - 1], pow10[i - 1]);
+            if (pow10[i] == NULL) {
+                while (--i >= 0)
+                    Py_DECREF(pow10[i]);
                 return -1;
-            });
+            }
+        }
+        scratch = _PyLong_New((Py_ssize_t)1 << level);
+        abs_a = scratch == NULL ? NULL : (PyLongObject *)long_abs(a);
+        if (abs_a == NULL)
+            res = -1;
+        else
+            res = long_to_decimal_recursive(abs_a, scratch->ob_digit,
+                                            pow10, level);
+        Py_XDECREF(abs_a);
+        for (i = 0; i < level; i++)
+            Py_DECREF(pow10[i]);
+        if (res < 0) {
+            Py_XDECREF(scratch);
+            return -1;
+        }
+        pout = scratch->ob_digit;
+        size = (Py_ssize_t)1 << level;
+        while (size > 0 && pout[size - 1] == 0)
+            size--;
     }
     /* pout should have at least one digit, so that the case when a = 0
        works correctly */
@@ -2221,6 +2329,107 @@ long_from_binary_base(const char **str, int base, PyLongObject **res)
     return 0;
 }
 
+static PyObject *long_add(PyLongObject *, PyLongObject *);
+static PyObject *long_pow(PyObject *, PyObject *, PyObject *);
+
+/* Convert the n digit characters buf[0:n] in the given base, where
+ * n <= FROM_STRING_CUTOFF * 2**level and pow[i] is
+ * base**(FROM_STRING_CUTOFF * 2**i).  The low FROM_STRING_CUTOFF *
+ * 2**(level-1) digits and the high digits are converted recursively, and
+ * combined with a multiplication by pow[level-1].  buf[n] is modified
+ * temporarily.
+ */
+static PyLongObject *
+long_from_string_recursive(char *buf, Py_ssize_t n, int base,
+                           PyLongObject **pow, int level)
+{
+    Py_ssize_t half;
+    PyLongObject *hi, *lo, *z;
+    char c;
+
+    if (level == 0) {
+        /* use the school algorithm of PyLong_FromString() */
+        c = buf[n];
+        buf[n] = '\0';
+        z = (PyLongObject *)PyLong_FromString(buf, NULL, base);
+        buf[n] = c;
+        return z;
+    }
+    half = (Py_ssize_t)FROM_STRING_CUTOFF << (level - 1);
+    if (n <= half) {
+        return long_from_string_recursive(buf, n, base, pow, level - 1);
+    }
+    hi = long_from_string_recursive(buf, n - half, base, pow, level - 1);
+    if (hi == NULL) {
+        return NULL;
+    }
+    lo = long_from_string_recursive(buf + n - half, half, base,
+                                    pow, level - 1);
+    if (lo == NULL) {
+        Py_DECREF(hi);
+        return NULL;
+    }
+    z = (PyLongObject *)long_mul(hi, pow[level - 1]);
+    Py_DECREF(hi);
+    if (z != NULL) {
+        Py_SETREF(z, (PyLongObject *)long_add(z, lo));
+    }
+    Py_DECREF(lo);
+    return z;
+}
+
+/* Convert the digits of str[0:end], which may be separated by single
+ * underscores, in the given base, which is not a power of 2.  digits is the
+ * number of digits, more than FROM_STRING_CUTOFF.
+ */
+static PyLongObject *
+long_from_string_large(const char *str, const char *end, Py_ssize_t digits,
+                       int base)
+{
+    PyLongObject *pow[8 * sizeof(Py_ssize_t)], *z = NULL;
+    PyObject *b, *e;
+    char *buf, *p;
+    int level = 0, i;
+
+    assert(digits > FROM_STRING_CUTOFF);
+    buf = PyMem_Malloc(digits + 1);
+    if (buf == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    for (p = buf; str < end; str++) {
+        if (*str != '_') {
+            *p++ = *str;
+        }
+    }
+    assert(p - buf == digits);
+    *p = '\0';
+
+    while (((Py_ssize_t)FROM_STRING_CUTOFF << level) < digits) {
+        level++;
+    }
+    b = PyLong_FromLong(base);
+    e = PyLong_FromLong(FROM_STRING_CUTOFF);
+    pow[0] = NULL;
+    if (b != NULL && e != NULL) {
+        pow[0] = (PyLongObject *)long_pow(b, e, Py_None);
+    }
+    Py_XDECREF(b);
+    Py_XDECREF(e);
+    for (i = 0; i < level - 1 && pow[i] != NULL; i++) {
+        pow[i + 1] = (PyLongObject *)long_mul(pow[i], pow[i]);
+    }
+    if (pow[i] != NULL) {
+        z = long_from_string_recursive(buf, digits, base, pow, level);
+        i++;
+    }
+    while (--i >= 0) {
+        Py_DECREF(pow[i]);
+    }
+    PyMem_Free(buf);
+    return z;
+}
+
 /* Parses an int from a bytestring. Leading and trailing whitespace will be
  * ignored.
  *
@@ -2457,11 +2666,22 @@ digit beyond the first.
         /* Uncomment next line to test exceedingly rare copy code */
         /* size_z = 1; */
         assert(size_z > 0);
-        z = _PyLong_New(size_z);
-        if (z == NULL) {
-            return NULL;
+        if (digits > FROM_STRING_CUTOFF) {
+            /* Long strings are converted by divide and conquer: the loop
+             * below is skipped. */
+            z = long_from_string_large(str, scan, digits, base);
+            if (z == NULL) {
+                return NULL;
+            }
+            str = scan;
+        }
+        else {
+            z = _PyLong_New(size_z);
+            if (z == NULL) {
+                return NULL;
+            }
+            Py_SET_SIZE(z, 0);
         }
-        Py_SET_SIZE(z, 0);
 
         /* `convwidth` consecutive input digits are treated as a single
          * digit in base `convmultmax`.
@@ -2550,7 +2770,11 @@ digit beyond the first.
         goto onError;
     }
     if (sign < 0) {
-        Py_SET_SIZE(z, -(Py_SIZE(z)));
+        /* z may be a small int if it was converted by divide and conquer */
+        _PyLong_Negate(&z);
+        if (z == NULL) {
+            return NULL;
+        }
     }
     while (*str && Py_ISSPACE(*str)) {
         str++;
@@ -2653,6 +2877,10 @@ PyLong_FromUnicodeObject(PyObject *u, int base)
 /* forward */
 static PyLongObject *x_divrem
     (PyLongObject *, PyLongObject *, PyLongObject **);
+static int bz_divrem(PyLongObject *, PyLongObject *,
+                     PyLongObject **, PyLongObject **);
+static PyObject *long_sub(PyLongObject *, PyLongObject *);
+static PyObject *long_lshift1(PyLongObject *, Py_ssize_t, digit);
 static PyObject *long_long(PyObject *v);
 
 /* Int division with remainder, top-level routine */
@@ -2692,6 +2920,10 @@ long_divrem(PyLongObject *a, PyLongObject *b,
             return -1;
         }
     }
+    else if (size_b > BZ_DIV_CUTOFF && size_a - size_b > BZ_DIV_CUTOFF) {
+        if (bz_divrem(a, b, &z, prem) < 0)
+            return -1;
+    }
     else {
         z = x_divrem(a, b, prem);
         if (z == NULL)
@@ -2847,6 +3079,248 @@ x_divrem(PyLongObject *v1, PyLongObject *w1, PyLongObject **prem)
     return long_normalize(a);
 }
 
+/* Recursive division, following C. Burnikel and J. Ziegler, "Fast
+   Recursive Division", MPI-I-98-1-022, 1998.  Dividing a 2n-digit number
+   by an n-digit number is done with two divisions of 3n/2 digits by n
+   digits, each of which is a division of n digits by n/2 digits (done
+   recursively) and a multiplication of n/2 digits by n/2 digits.  With
+   Karatsuba multiplication, the division costs a few multiplications of n
+   digit numbers instead of the n**2 digit operations of x_divrem().
+
+   The numbers are split at digit boundaries, with the helpers below, and
+   all of them are nonnegative. */
+
+/* Return the digits lo to hi-1 of |a|, |a| // BASE**lo % BASE**(hi-lo). */
+
+static PyLongObject *
+digits_slice(PyLongObject *a, Py_ssize_t lo, Py_ssize_t hi)
+{
+    Py_ssize_t size_a = Py_ABS(Py_SIZE(a));
+    PyLongObject *z;
+
+    if (hi > size_a)
+        hi = size_a;
+    if (lo >= hi)
+        return (PyLongObject *)PyLong_FromLong(0);
+    z = _PyLong_New(hi - lo);
+    if (z == NULL)
+        return NULL;
+    memcpy(z->ob_digit, a->ob_digit + lo, (hi - lo) * sizeof(digit));
+    return long_normalize(z);
+}
+
+/* Return |hi| * BASE**n + |lo|, where |lo| < BASE**n. */
+
+static PyLongObject *
+digits_concat(PyLongObject *hi, Py_ssize_t n, PyLongObject *lo)
+{
+    Py_ssize_t size_hi = Py_ABS(Py_SIZE(hi)), size_lo = Py_ABS(Py_SIZE(lo));
+    PyLongObject *z;
+
+    assert(size_lo <= n);
+    if (size_hi == 0)
+        return digits_slice(lo, 0, size_lo);
+    z = _PyLong_New(n + size_hi);
+    if (z == NULL)
+        return NULL;
+    memcpy(z->ob_digit, lo->ob_digit, size_lo * sizeof(digit));
+    memset(z->ob_digit + size_lo, 0, (n - size_lo) * sizeof(digit));
+    memcpy(z->ob_digit + n, hi->ob_digit, size_hi * sizeof(digit));
+    return z;
+}
+
+static int bz_div3n2n(PyLongObject *, PyLongObject *, PyLongObject *,
+                      PyLongObject *, PyLongObject *, Py_ssize_t,
+                      PyLongObject **, PyLongObject **);
+
+/* Divide a by b, where b has n digits, its top digit is >= PyLong_BASE/2
+   and a < b * PyLong_BASE**n.  Set *pq and *pr to the quotient and the
+   remainder and return 0, or return -1 on error. */
+
+static int
+bz_div2n1n(PyLongObject *a, PyLongObject *b, Py_ssize_t n,
+           PyLongObject **pq, PyLongObject **pr)
+{
+    PyLongObject *a12 = NULL, *a3 = NULL, *a4 = NULL, *b1 = NULL, *b2 = NULL;
+    PyLongObject *q1 = NULL, *q2 = NULL, *r = NULL;
+    Py_ssize_t half;
+    int res = -1;
+
+    assert(Py_SIZE(a) >= 0 && Py_SIZE(b) == n);
+    if (n <= BZ_DIV_CUTOFF || Py_SIZE(a) - n <= BZ_DIV_CUTOFF) {
+        /* long_divrem() calls x_divrem() for such sizes */
+        return long_divrem(a, b, pq, pr);
+    }
+    assert(n % 2 == 0);
+    half = n / 2;
+    if ((a12 = digits_slice(a, n, 2 * n)) == NULL ||
+        (a3 = digits_slice(a, half, n)) == NULL ||
+        (a4 = digits_slice(a, 0, half)) == NULL ||
+        (b1 = digits_slice(b, half, n)) == NULL ||
+        (b2 = digits_slice(b, 0, half)) == NULL)
+        goto done;
+    if (bz_div3n2n(a12, a3, b, b1, b2, half, &q1, &r) < 0)
+        goto done;
+    if (bz_div3n2n(r, a4, b, b1, b2, half, &q2, pr) < 0)
+        goto done;
+    *pq = digits_concat(q1, half, q2);
+    if (*pq == NULL) {
+        Py_CLEAR(*pr);
+        goto done;
+    }
+    res = 0;
+  done:
+    Py_XDECREF(a12);
+    Py_XDECREF(a3);
+    Py_XDECREF(a4);
+    Py_XDECREF(b1);
+    Py_XDECREF(b2);
+    Py_XDECREF(q1);
+    Py_XDECREF(q2);
+    Py_XDECREF(r);
+    return res;
+}
+
+/* Divide a12 * PyLong_BASE**n + a3 by b = b1 * PyLong_BASE**n + b2, where
+   b1 has n digits, its top digit is >= PyLong_BASE/2, a3 < PyLong_BASE**n
+   and a12 < b.  Set *pq and *pr to the quotient and the remainder and
+   return 0, or return -1 on error. */
+
+static int
+bz_div3n2n(PyLongObject *a12, PyLongObject *a3, PyLongObject *b,
+           PyLongObject *b1, PyLongObject *b2, Py_ssize_t n,
+           PyLongObject **pq, PyLongObject **pr)
+{
+    PyLongObject *q = NULL, *r = NULL, *t;
+    Py_ssize_t i;
+
+    if (Py_SIZE(a12) == 2 * n &&
+        memcmp(a12->ob_digit + n, b1->ob_digit, n * sizeof(digit)) == 0) {
+        /* The quotient estimate is PyLong_BASE**n - 1, and the remainder
+           a12 - b1 * PyLong_BASE**n + b1. */
+        q = _PyLong_New(n);
+        if (q == NULL)
+            goto error;
+        for (i = 0; i < n; i++)
+            q->ob_digit[i] = PyLong_MASK;
+        t = digits_slice(a12, 0, n);
+        if (t == NULL)
+            goto error;
+        r = (PyLongObject *)long_add(t, b1);
+        Py_DECREF(t);
+        if (r == NULL)
+            goto error;
+    }
+    else if (bz_div2n1n(a12, b1, n, &q, &r) < 0)
+        goto error;
+
+    /* r * PyLong_BASE**n + a3 - q * b2 is the remainder, which is too
+       large by b or 2 * b when negative. */
+    Py_SETREF(r, digits_concat(r, n, a3));
+    if (r == NULL)
+        goto error;
+    t = (PyLongObject *)long_mul(q, b2);
+    if (t == NULL)
+        goto error;
+    Py_SETREF(r, (PyLongObject *)long_sub(r, t));
+    Py_DECREF(t);
+    if (r == NULL)
+        goto error;
+    while (Py_SIZE(r) < 0) {
+        Py_SETREF(r, (PyLongObject *)long_add(r, b));
+        if (r == NULL)
+            goto error;
+        Py_SETREF(q, (PyLongObject *)long_sub(q,
+                                              (PyLongObject *)_PyLong_One));
+        if (q == NULL)
+            goto error;
+    }
+    *pq = q;
+    *pr = r;
+    return 0;
+
+  error:
+    Py_XDECREF(q);
+    Py_XDECREF(r);
+    return -1;
+}
+
+/* Divide |a| by |b|, where |b| has more than BZ_DIV_CUTOFF digits, with
+   bz_div2n1n().  The quotient and the remainder are nonnegative.  Return 0
+   on success, -1 on error. */
+
+static int
+bz_divrem(PyLongObject *a, PyLongObject *b,
+          PyLongObject **pdiv, PyLongObject **prem)
+{
+    Py_ssize_t size_a, size_b = Py_ABS(Py_SIZE(b)), n, m, i;
+    PyLongObject *aa = NULL, *bb = NULL, *q = NULL, *r = NULL, *t, *x, *qi;
+    int d;
+
+    /* Pad b to n = j * 2**k digits, where j <= BZ_DIV_CUTOFF, so that the
+       recursion halves n down to x_divrem() sizes, and shift it so that
+       its top digit is >= PyLong_BASE/2.  a is shifted likewise. */
+    for (m = 1; (size_b + m - 1) / m > BZ_DIV_CUTOFF; m *= 2)
+        ;
+    n = (size_b + m - 1) / m * m;
+    d = PyLong_SHIFT - _Py_bit_length(b->ob_digit[size_b - 1]);
+    bb = (PyLongObject *)long_lshift1(b, n - size_b, d);
+    aa = (PyLongObject *)long_lshift1(a, n - size_b, d);
+    if (bb == NULL || aa == NULL)
+        goto error;
+    /* both are new objects, since a and b are larger than small ints */
+    assert(Py_REFCNT(aa) == 1 && Py_REFCNT(bb) == 1);
+    Py_SET_SIZE(aa, Py_ABS(Py_SIZE(aa)));
+    Py_SET_SIZE(bb, Py_ABS(Py_SIZE(bb)));
+    assert(Py_SIZE(bb) == n);
+
+    /* Divide the n-digit blocks of a, from the most significant, by b,
+       carrying the remainder to the next block. */
+    size_a = Py_SIZE(aa);
+    i = (size_a + n - 1) / n;
+    q = _PyLong_New(i * n);
+    r = (PyLongObject *)PyLong_FromLong(0);
+    if (q == NULL || r == NULL)
+        goto error;
+    memset(q->ob_digit, 0, i * n * sizeof(digit));
+    while (--i >= 0) {
+        t = digits_slice(aa, i * n, (i + 1) * n);
+        if (t == NULL)
+            goto error;
+        x = digits_concat(r, n, t);
+        Py_DECREF(t);
+        Py_CLEAR(r);
+        if (x == NULL)
+            goto error;
+        if (bz_div2n1n(x, bb, n, &qi, &r) < 0) {
+            Py_DECREF(x);
+            goto error;
+        }
+        Py_DECREF(x);
+        memcpy(q->ob_digit + i * n, qi->ob_digit,
+               Py_SIZE(qi) * sizeof(digit));
+        Py_DECREF(qi);
+    }
+    Py_DECREF(aa);
+    Py_DECREF(bb);
+    *pdiv = long_normalize(q);
+    *prem = (PyLongObject *)_PyLong_Rshift(
+        (PyObject *)r, (size_t)(n - size_b) * PyLong_SHIFT + d);
+    Py_DECREF(r);
+    if (*prem == NULL) {
+        Py_DECREF(*pdiv);
+        return -1;
+    }
+    return 0;
+
+  error:
+    Py_XDECREF(aa);
+    Py_XDECREF(bb);
+    Py_XDECREF(q);
+    Py_XDECREF(r);
+    return -1;
+}
+
 /* For a nonzero PyLong a, express a in the form x * 2**e, with 0.5 <=
    abs(x) < 1.0 and e >= 0; return x and put e in *e.  Here x is
    rounded to DBL_MANT_DIG significant bits using round-half-to-even.
@@ -138,14 +138,20 @@ static int debug_offsets[MI_NUM_HEAPS] = {
   [mi_heap_tag_dict_keys] = -1
 };
 
-static void _mi_heap_init_ex(mi_heap_t* heap, mi_tld_t* tld, int tag) {
+static void _mi_heap_init_ex(mi_heap_t* heap, mi_tld_t* tld, int tag, mi_heap_t* backing) {
   if (heap->cookie != 0) return;
   memcpy(heap, &_mi_heap_empty, sizeof(*heap));
   heap->thread_id = _mi_thread_id();
   if (heap == &_mi_heap_main) {
     heap->cookie = _mi_os_random_weak((uintptr_t)&_mi_heap_init_ex);
   }
-  _mi_random_init(&heap->random);
+  // seeding from the OS is a system call: only do it once per thread
+  if (backing == NULL) {
+    _mi_random_init(&heap->random);
+  }
+  else {
+    _mi_random_split(&backing->random, &heap->random);
+  }
   if (heap != &_mi_heap_main) {
     heap->cookie  = _mi_heap_random_next(heap) | 1;
   }
@@ -159,7 +165,7 @@ static void _mi_heap_init_ex(mi_heap_t* heap, mi_tld_t* tld, int tag) {
 static void _mi_thread_init_ex(mi_tld_t* tld, mi_heap_t heaps[])
 {
   for (int tag = 0; tag < MI_NUM_HEAPS; tag++) {
-    _mi_heap_init_ex(&heaps[tag], tld, tag);
+    _mi_heap_init_ex(&heaps[tag], tld, tag, tag == 0 ? NULL : &heaps[0]);
     tld->default_heaps[tag] = &heaps[tag];
   }
   tld->heap_backing = &heaps[mi_heap_tag_default];
@@ -192,6 +198,62 @@ typedef struct mi_thread_data_s {
   mi_tld_t   tld;
 } mi_thread_data_t;
 
+// Thread data is allocated directly from the OS. A few freed ones are cached
+// so that short-lived threads don't need an mmap/munmap pair each.
+#define TD_CACHE_SIZE (8)
+static _Atomic(mi_thread_data_t*) td_cache[TD_CACHE_SIZE];
+
+static mi_thread_data_t* mi_thread_data_alloc(void) {
+  // try to find thread metadata in the cache
+  mi_thread_data_t* td;
+  for (int i = 0; i < TD_CACHE_SIZE; i++) {
+    td = mi_atomic_load_ptr_relaxed(mi_thread_data_t, &td_cache[i]);
+    if (td != NULL) {
+      td = mi_atomic_exchange_ptr_acq_rel(mi_thread_data_t, &td_cache[i], NULL);
+      if (td != NULL) {
+        memset(td, 0, sizeof(*td));
+        return td;
+      }
+    }
+  }
+  // if that fails, allocate directly from the OS
+  td = (mi_thread_data_t*)_mi_os_alloc(sizeof(mi_thread_data_t), &_mi_stats_main);
+  if (td == NULL) {
+    // if this fails, try once more. (issue #257)
+    td = (mi_thread_data_t*)_mi_os_alloc(sizeof(mi_thread_data_t), &_mi_stats_main);
+    if (td == NULL) {
+      // really out of memory
+      _mi_error_message(ENOMEM, "unable to allocate thread local heap metadata (%zu bytes)\n", sizeof(mi_thread_data_t));
+    }
+  }
+  return td;
+}
+
+static void mi_thread_data_free(mi_thread_data_t* tdfree) {
+  // try to add the thread metadata to the cache
+  for (int i = 0; i < TD_CACHE_SIZE; i++) {
+    mi_thread_data_t* td = mi_atomic_load_ptr_relaxed(mi_thread_data_t, &td_cache[i]);
+    if (td == NULL) {
+      mi_thread_data_t* expected = NULL;
+      if (mi_atomic_cas_ptr_strong_release(mi_thread_data_t, &td_cache[i], &expected, tdfree)) {
+        return;
+      }
+    }
+  }
+  // if that fails, just free it directly
+  _mi_os_free(tdfree, sizeof(mi_thread_data_t), &_mi_stats_main);
+}
+
+static void mi_thread_data_collect(void) {
+  // free all thread metadata from the cache
+  for (int i = 0; i < TD_CACHE_SIZE; i++) {
+    mi_thread_data_t* td = mi_atomic_exchange_ptr_acq_rel(mi_thread_data_t, &td_cache[i], NULL);
+    if (td != NULL) {
+      _mi_os_free(td, sizeof(mi_thread_data_t), &_mi_stats_main);
+    }
+  }
+}
+
 // Initialize the thread local default heap, called from `mi_thread_init`
 static bool _mi_heap_init(void) {
   if (mi_heap_is_initialized(mi_get_default_heap())) return true;
@@ -203,18 +265,9 @@ static bool _mi_heap_init(void) {
     //mi_assert_internal(_mi_heap_default->tld->heap_backing == mi_get_default_heap());
   }
   else {
-    // use `_mi_os_alloc` to allocate directly from the OS
-    mi_thread_data_t* td = (mi_thread_data_t*)_mi_os_alloc(sizeof(mi_thread_data_t), &_mi_stats_main); // Todo: more efficient allocation?
-    if (td == NULL) {
-      // if this fails, try once more. (issue #257)
-      td = (mi_thread_data_t*)_mi_os_alloc(sizeof(mi_thread_data_t), &_mi_stats_main);
-      if (td == NULL) {
-        // really out of memory
-        _mi_error_message(ENOMEM, "unable to allocate thread local heap metadata (%zu bytes)\n", sizeof(mi_thread_data_t));
-        return false;
-      }
-    }
-    // OS allocated so already zero initialized
+    mi_thread_data_t* td = mi_thread_data_alloc();
+    if (td == NULL) return false;
+    // zero initialized (by the OS or the cache)
     _mi_thread_init_ex(&td->tld, td->heaps);
     _mi_heap_set_default_direct(&td->heaps[0]);
   }
@@ -260,6 +313,14 @@ void _mi_thread_abandon(mi_tld_t *tld) {
   // merge stats
   _mi_stats_done(&heap->tld->stats);  
 
+  if (heap->thread_id == _mi_thread_id()) {
+    // the owning thread abandons its own heaps: once its default heap is
+    // reset, `_mi_thread_done` won't see this tld, so free it now
+    _mi_heap_set_default_direct((mi_heap_t*)&_mi_heap_empty);
+    _mi_tld_destroy(tld);
+    return;
+  }
+
   uintptr_t status;
   do {
     status = mi_atomic_load_relaxed(&tld->status);
@@ -277,7 +338,7 @@ static void _mi_tld_destroy(mi_tld_t *tld) {
   mi_heap_t *heap = tld->heap_backing;
   if (heap != &_mi_heap_main) {
     mi_assert_internal(tld->segments.count == 0);
-    _mi_os_free(heap, sizeof(mi_thread_data_t), &_mi_stats_main);
+    mi_thread_data_free((mi_thread_data_t*)heap);
   }
 #if 0  
   // never free the main thread even in debug mode; if a dll is linked statically with mimalloc,
@@ -589,6 +650,7 @@ static void mi_process_done(void) {
     mi_collect(true /* force */ );
     #endif
   #endif
+  mi_thread_data_collect();
 
   if (mi_option_is_enabled(mi_option_show_stats) || mi_option_is_enabled(mi_option_verbose)) {
     mi_stats_print(NULL);
@@ -38,6 +38,14 @@
 #  define MEMCHR_CUT_OFF 40
 #endif
 
+/* SSE2 and AVX2 kernels for 1 and 2 bytes per character, see
+   fastsearch_simd.h (which needs pycore_cpuinfo.h) */
+#undef FASTSEARCH_SIMD
+#if defined(_Py_HAVE_X86_SIMD) && STRINGLIB_SIZEOF_CHAR <= 2
+#  include "fastsearch_simd.h"
+#  define FASTSEARCH_SIMD 1
+#endif
+
 Py_LOCAL_INLINE(Py_ssize_t)
 STRINGLIB(find_char)(const STRINGLIB_CHAR* s, Py_ssize_t n, STRINGLIB_CHAR ch)
 {
@@ -52,6 +60,12 @@ STRINGLIB(find_char)(const STRINGLIB_CHAR* s, Py_ssize_t n, STRINGLIB_CHAR ch)
             return (p - s);
         return -1;
 #else
+#ifdef FASTSEARCH_SIMD
+        if (FASTSEARCH_USE_SIMD(n, STRINGLIB_SIZEOF_CHAR)) {
+            return fastsearch_simd_find_char(s, n, ch,
+                                             STRINGLIB_SIZEOF_CHAR);
+        }
+#endif
         /* use memchr if we can choose a needle without too many likely
            false positives */
         const STRINGLIB_CHAR *s1, *e1;
@@ -99,6 +113,12 @@ Py_LOCAL_INLINE(Py_ssize_t)
 STRINGLIB(rfind_char)(const STRINGLIB_CHAR* s, Py_ssize_t n, STRINGLIB_CHAR ch)
 {
     const STRINGLIB_CHAR *p;
+#if defined(FASTSEARCH_SIMD) \
+    && !(defined(HAVE_MEMRCHR) && STRINGLIB_SIZEOF_CHAR == 1)
+    if (n > MEMCHR_CUT_OFF && FASTSEARCH_USE_SIMD(n, STRINGLIB_SIZEOF_CHAR)) {
+        return fastsearch_simd_rfind_char(s, n, ch, STRINGLIB_SIZEOF_CHAR);
+    }
+#endif
 #ifdef HAVE_MEMRCHR
     /* memrchr() is a GNU extension, available since glibc 2.1.91.
        it doesn't seem as optimized as memchr(), but is still quite
@@ -184,6 +204,12 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
         else if (mode == FAST_RSEARCH)
             return STRINGLIB(rfind_char)(s, n, p[0]);
         else {  /* FAST_COUNT */
+#ifdef FASTSEARCH_SIMD
+            if (FASTSEARCH_USE_SIMD(n, STRINGLIB_SIZEOF_CHAR)) {
+                return fastsearch_simd_count_char(s, n, p[0], maxcount,
+                                                  STRINGLIB_SIZEOF_CHAR);
+            }
+#endif
             for (i = 0; i < n; i++)
                 if (s[i] == p[0]) {
                     count++;
@@ -194,6 +220,15 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
         }
     }
 
+#ifdef FASTSEARCH_SIMD
+    if (mode != FAST_RSEARCH
+        && FASTSEARCH_USE_SIMD(n, STRINGLIB_SIZEOF_CHAR))
+    {
+        return fastsearch_simd_search(s, n, p, m, maxcount, mode,
+                                      STRINGLIB_SIZEOF_CHAR);
+    }
+#endif
+
     mlast = m - 1;
     skip = mlast - 1;
     mask = 0;
@@ -0,0 +1,578 @@
+/* stringlib: SSE2 and AVX2 kernels for fastsearch
+
+   fastsearch.h uses these functions for strings of 1 or 2 bytes per
+   character (charsize), which compare blocks of 16 (SSE2) or 32 (AVX2)
+   bytes at a time.  A comparison gives a mask with charsize bits per
+   character.
+
+   - fastsearch_simd_find_char() and fastsearch_simd_rfind_char() return
+     the position of the first (last) character of a block that matches;
+   - fastsearch_simd_count_char() adds the results of the comparisons in
+     vectors of 8-bit counters;
+   - fastsearch_simd_search() is the "SIMD-friendly" substring search of
+     W. Mula: the blocks at offsets 0 and m-1 are compared with the first
+     and the last character of the needle, and only the positions where
+     both match are compared with memcmp().
+
+   The kernels never read past the string: the last characters are handled
+   by an overlapping block or by a scalar loop. */
+
+#ifndef STRINGLIB_FASTSEARCH_SIMD_H
+#define STRINGLIB_FASTSEARCH_SIMD_H
+
+/* Whether to use the kernels for n characters */
+#define FASTSEARCH_USE_SIMD(n, charsize) \
+    ((n) * (charsize) >= 32 && (_Py_cpu_features & _Py_CPU_SSE2))
+
+#define FASTSEARCH_CHAR(s, i, charsize) \
+    ((charsize) == 1 ? (Py_UCS4)((const Py_UCS1 *)(s))[i] \
+                     : (Py_UCS4)((const Py_UCS2 *)(s))[i])
+
+static inline int
+fastsearch_lowest_bit(uint32_t mask)
+{
+#ifdef _MSC_VER
+    unsigned long bit;
+    _BitScanForward(&bit, mask);
+    return (int)bit;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+static inline int
+fastsearch_highest_bit(uint32_t mask)
+{
+#ifdef _MSC_VER
+    unsigned long bit;
+    _BitScanReverse(&bit, mask);
+    return (int)bit;
+#else
+    return 31 - __builtin_clz(mask);
+#endif
+}
+
+/* Check the positions i to n-m of s for the needle p[:m], after the vector
+   loop of fastsearch_simd_search() */
+static _Py_ALWAYS_INLINE Py_ssize_t
+fastsearch_search_tail(const char *s, Py_ssize_t n,
+                       const char *p, Py_ssize_t m,
+                       Py_ssize_t maxcount, int mode, int charsize,
+                       Py_ssize_t i, Py_ssize_t count)
+{
+    Py_UCS4 first = FASTSEARCH_CHAR(p, 0, charsize);
+    Py_UCS4 last = FASTSEARCH_CHAR(p, m - 1, charsize);
+    for (; i <= n - m; i++) {
+        if (FASTSEARCH_CHAR(s, i, charsize) == first
+            && FASTSEARCH_CHAR(s, i + m - 1, charsize) == last
+            && memcmp(s + (i + 1) * charsize, p + charsize,
+                      (m - 2) * charsize) == 0)
+        {
+            if (mode != FAST_COUNT) {
+                return i;
+            }
+            if (++count == maxcount) {
+                return maxcount;
+            }
+            i += m - 1;
+        }
+    }
+    return mode == FAST_COUNT ? count : -1;
+}
+
+
+/* SSE2 */
+
+static _Py_ALWAYS_INLINE __m128i
+fastsearch_set1_sse2(Py_UCS4 ch, int charsize)
+{
+    return charsize == 1 ? _mm_set1_epi8((char)ch) : _mm_set1_epi16((short)ch);
+}
+
+static _Py_ALWAYS_INLINE __m128i
+fastsearch_cmpeq_sse2(const char *s, __m128i v, int charsize)
+{
+    __m128i x = _mm_loadu_si128((const __m128i *)s);
+    return charsize == 1 ? _mm_cmpeq_epi8(x, v) : _mm_cmpeq_epi16(x, v);
+}
+
+static _Py_ALWAYS_INLINE uint32_t
+fastsearch_eq_sse2(const char *s, __m128i v, int charsize)
+{
+    return (uint32_t)_mm_movemask_epi8(fastsearch_cmpeq_sse2(s, v, charsize));
+}
+
+static _Py_ALWAYS_INLINE Py_ssize_t
+fastsearch_find_char_sse2_impl(const char *s, Py_ssize_t n, Py_UCS4 ch,
+                               int charsize)
+{
+    const Py_ssize_t step = 16 / charsize;
+    __m128i v = fastsearch_set1_sse2(ch, charsize);
+    uint32_t mask = fastsearch_eq_sse2(s, v, charsize);
+    if (mask) {
+        return fastsearch_lowest_bit(mask) / charsize;
+    }
+    /* Continue from the first aligned block, 4 blocks at a time, then
+       find the first match */
+    Py_ssize_t i = (Py_ssize_t)(-(uintptr_t)s & 15) / charsize;
+    for (; i + 4 * step <= n; i += 4 * step) {
+        const char *b = s + i * charsize;
+        __m128i eq = _mm_or_si128(
+            _mm_or_si128(fastsearch_cmpeq_sse2(b, v, charsize),
+                         fastsearch_cmpeq_sse2(b + 16, v, charsize)),
+            _mm_or_si128(fastsearch_cmpeq_sse2(b + 32, v, charsize),
+                         fastsearch_cmpeq_sse2(b + 48, v, charsize)));
+        if (_mm_movemask_epi8(eq)) {
+            break;
+        }
+    }
+    for (; i + step <= n; i += step) {
+        mask = fastsearch_eq_sse2(s + i * charsize, v, charsize);
+        if (mask) {
+            return i + fastsearch_lowest_bit(mask) / charsize;
+        }
+    }
+    if (i < n) {
+        i = n - step;
+        mask = fastsearch_eq_sse2(s + i * charsize, v, charsize);
+        if (mask) {
+            return i + fastsearch_lowest_bit(mask) / charsize;
+        }
+    }
+    return -1;
+}
+
+static _Py_ALWAYS_INLINE Py_ssize_t
+fastsearch_rfind_char_sse2_impl(const char *s, Py_ssize_t n, Py_UCS4 ch,
+                                int charsize)
+{
+    const Py_ssize_t step = 16 / charsize;
+    __m128i v = fastsearch_set1_sse2(ch, charsize);
+    uint32_t mask = fastsearch_eq_sse2(s + (n - step) * charsize, v, charsize);
+    if (mask) {
+        return n - step + fastsearch_highest_bit(mask) / charsize;
+    }
+    /* Continue from the end of the last aligned block; i is the end of the
+       blocks to check */
+    Py_ssize_t i = n - (Py_ssize_t)(((uintptr_t)(s + n * charsize) & 15)
+                                    / charsize);
+    for (; i >= 4 * step; i -= 4 * step) {
+        const char *b = s + (i - 4 * step) * charsize;
+        __m128i eq = _mm_or_si128(
+            _mm_or_si128(fastsearch_cmpeq_sse2(b, v, charsize),
+                         fastsearch_cmpeq_sse2(b + 16, v, charsize)),
+            _mm_or_si128(fastsearch_cmpeq_sse2(b + 32, v, charsize),
+                         fastsearch_cmpeq_sse2(b + 48, v, charsize)));
+        if (_mm_movemask_epi8(eq)) {
+            break;
+        }
+    }
+    for (; i >= step; i -= step) {
+        mask = fastsearch_eq_sse2(s + (i - step) * charsize, v, charsize);
+        if (mask) {
+            return i - step + fastsearch_highest_bit(mask) / charsize;
+        }
+    }
+    if (i > 0) {
+        mask = fastsearch_eq_sse2(s, v, charsize);
+        if (mask) {
+            return fastsearch_highest_bit(mask) / charsize;
+        }
+    }
+    return -1;
+}
+
+static _Py_ALWAYS_INLINE Py_ssize_t
+fastsearch_count_char_sse2_impl(const char *s, Py_ssize_t n, Py_UCS4 ch,
+                                Py_ssize_t maxcount, int charsize)
+{
+    const Py_ssize_t step = 16 / charsize;
+    __m128i v = fastsearch_set1_sse2(ch, charsize);
+    __m128i zero = _mm_setzero_si128();
+    __m128i counts = zero;
+    Py_ssize_t i, count = 0;
+    int blocks = 0;
+    for (i = 0; i + step <= n; i += step) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(s + i * charsize));
+        /* A match is -1 in its 8-bit or 16-bit lane */
+        if (charsize == 1) {
+            counts = _mm_sub_epi8(counts, _mm_cmpeq_epi8(x, v));
+        }
+        else {
+            counts = _mm_sub_epi16(counts, _mm_cmpeq_epi16(x, v));
+        }
+        if (++blocks == 255 || i + 2 * step > n) {
+            __m128i sums = _mm_sad_epu8(counts, zero);
+            count += (_mm_cvtsi128_si64(sums)
+                      + _mm_cvtsi128_si64(_mm_unpackhi_epi64(sums, sums)));
+            if (count >= maxcount) {
+                return maxcount;
+            }
+            counts = zero;
+            blocks = 0;
+        }
+    }
+    for (; i < n; i++) {
+        if (FASTSEARCH_CHAR(s, i, charsize) == ch) {
+            count++;
+        }
+    }
+    return Py_MIN(count, maxcount);
+}
+
+static _Py_ALWAYS_INLINE Py_ssize_t
+fastsearch_search_sse2_impl(const char *s, Py_ssize_t n,
+                            const char *p, Py_ssize_t m,
+                            Py_ssize_t maxcount, int mode, int charsize)
+{
+    const Py_ssize_t step = 16 / charsize;
+    __m128i first = fastsearch_set1_sse2(FASTSEARCH_CHAR(p, 0, charsize),
+                                         charsize);
+    __m128i last = fastsearch_set1_sse2(FASTSEARCH_CHAR(p, m - 1, charsize),
+                                        charsize);
+    Py_ssize_t i, count = 0;
+    for (i = 0; i + step <= n - m + 1; i += step) {
+        const char *block = s + i * charsize;
+        uint32_t mask = (fastsearch_eq_sse2(block, first, charsize)
+                         & fastsearch_eq_sse2(block + (m - 1) * charsize,
+                                              last, charsize));
+        while (mask) {
+            int bit = fastsearch_lowest_bit(mask);
+            Py_ssize_t j = i + bit / charsize;
+            if (memcmp(s + (j + 1) * charsize, p + charsize,
+                       (m - 2) * charsize) != 0) {
+                mask ^= ((1u << charsize) - 1) << bit;
+                continue;
+            }
+            if (mode != FAST_COUNT) {
+                return j;
+            }
+            if (++count == maxcount) {
+                return maxcount;
+            }
+            /* Skip the positions overlapping the match */
+            Py_ssize_t skip = (j + m - i) * charsize;
+            if (skip >= 16) {
+                i = j + m - step;
+                break;
+            }
+            mask &= ~0u << skip;
+        }
+    }
+    return fastsearch_search_tail(s, n, p, m, maxcount, mode, charsize,
+                                  i, count);
+}
+
+static Py_ssize_t
+fastsearch_find_char_sse2(const char *s, Py_ssize_t n, Py_UCS4 ch,
+                          int charsize)
+{
+    if (charsize == 1) {
+        return fastsearch_find_char_sse2_impl(s, n, ch, 1);
+    }
+    return fastsearch_find_char_sse2_impl(s, n, ch, 2);
+}
+
+static Py_ssize_t
+fastsearch_rfind_char_sse2(const char *s, Py_ssize_t n, Py_UCS4 ch,
+                           int charsize)
+{
+    if (charsize == 1) {
+        return fastsearch_rfind_char_sse2_impl(s, n, ch, 1);
+    }
+    return fastsearch_rfind_char_sse2_impl(s, n, ch, 2);
+}
+
+static Py_ssize_t
+fastsearch_count_char_sse2(const char *s, Py_ssize_t n, Py_UCS4 ch,
+                           Py_ssize_t maxcount, int charsize)
+{
+    if (charsize == 1) {
+        return fastsearch_count_char_sse2_impl(s, n, ch, maxcount, 1);
+    }
+    return fastsearch_count_char_sse2_impl(s, n, ch, maxcount, 2);
+}
+
+static Py_ssize_t
+fastsearch_search_sse2(const char *s, Py_ssize_t n,
+                       const char *p, Py_ssize_t m,
+                       Py_ssize_t maxcount, int mode, int charsize)
+{
+    if (charsize == 1) {
+        return fastsearch_search_sse2_impl(s, n, p, m, maxcount, mode, 1);
+    }
+    return fastsearch_search_sse2_impl(s, n, p, m, maxcount, mode, 2);
+}
+
+
+/* AVX2: the same with blocks of 32 bytes */
+
+_Py_TARGET("avx2") static _Py_ALWAYS_INLINE __m256i
+fastsearch_set1_avx2(Py_UCS4 ch, int charsize)
+{
+    return (charsize == 1 ? _mm256_set1_epi8((char)ch)
+                          : _mm256_set1_epi16((short)ch));
+}
+
+_Py_TARGET("avx2") static _Py_ALWAYS_INLINE __m256i
+fastsearch_cmpeq_avx2(const char *s, __m256i v, int charsize)
+{
+    __m256i x = _mm256_loadu_si256((const __m256i *)s);
+    return charsize == 1 ? _mm256_cmpeq_epi8(x, v) : _mm256_cmpeq_epi16(x, v);
+}
+
+_Py_TARGET("avx2") static _Py_ALWAYS_INLINE uint32_t
+fastsearch_eq_avx2(const char *s, __m256i v, int charsize)
+{
+    return (uint32_t)_mm256_movemask_epi8(
+        fastsearch_cmpeq_avx2(s, v, charsize));
+}
+
+_Py_TARGET("avx2") static _Py_ALWAYS_INLINE Py_ssize_t
+fastsearch_find_char_avx2_impl(const char *s, Py_ssize_t n, Py_UCS4 ch,
+                               int charsize)
+{
+    const Py_ssize_t step = 32 / charsize;
+    __m256i v = fastsearch_set1_avx2(ch, charsize);
+    uint32_t mask = fastsearch_eq_avx2(s, v, charsize);
+    if (mask) {
+        return fastsearch_lowest_bit(mask) / charsize;
+    }
+    Py_ssize_t i = (Py_ssize_t)(-(uintptr_t)s & 31) / charsize;
+    for (; i + 4 * step <= n; i += 4 * step) {
+        const char *b = s + i * charsize;
+        __m256i eq = _mm256_or_si256(
+            _mm256_or_si256(fastsearch_cmpeq_avx2(b, v, charsize),
+                            fastsearch_cmpeq_avx2(b + 32, v, charsize)),
+            _mm256_or_si256(fastsearch_cmpeq_avx2(b + 64, v, charsize),
+                            fastsearch_cmpeq_avx2(b + 96, v, charsize)));
+        if (_mm256_movemask_epi8(eq)) {
+            break;
+        }
+    }
+    for (; i + step <= n; i += step) {
+        mask = fastsearch_eq_avx2(s + i * charsize, v, charsize);
+        if (mask) {
+            return i + fastsearch_lowest_bit(mask) / charsize;
+        }
+    }
+    if (i < n) {
+        i = n - step;
+        mask = fastsearch_eq_avx2(s + i * charsize, v, charsize);
+        if (mask) {
+            return i + fastsearch_lowest_bit(mask) / charsize;
+        }
+    }
+    return -1;
+}
+
+_Py_TARGET("avx2") static _Py_ALWAYS_INLINE Py_ssize_t
+fastsearch_rfind_char_avx2_impl(const char *s, Py_ssize_t n, Py_UCS4 ch,
+                                int charsize)
+{
+    const Py_ssize_t step = 32 / charsize;
+    __m256i v = fastsearch_set1_avx2(ch, charsize);
+    uint32_t mask = fastsearch_eq_avx2(s + (n - step) * charsize, v, charsize);
+    if (mask) {
+        return n - step + fastsearch_highest_bit(mask) / charsize;
+    }
+    Py_ssize_t i = n - (Py_ssize_t)(((uintptr_t)(s + n * charsize) & 31)
+                                    / charsize);
+    for (; i >= 4 * step; i -= 4 * step) {
+        const char *b = s + (i - 4 * step) * charsize;
+        __m256i eq = _mm256_or_si256(
+            _mm256_or_si256(fastsearch_cmpeq_avx2(b, v, charsize),
+                            fastsearch_cmpeq_avx2(b + 32, v, charsize)),
+            _mm256_or_si256(fastsearch_cmpeq_avx2(b + 64, v, charsize),
+                            fastsearch_cmpeq_avx2(b + 96, v, charsize)));
+        if (_mm256_movemask_epi8(eq)) {
+            break;
+        }
+    }
+    for (; i >= step; i -= step) {
+        mask = fastsearch_eq_avx2(s + (i - step) * charsize, v, charsize);
+        if (mask) {
+            return i - step + fastsearch_highest_bit(mask) / charsize;
+        }
+    }
+    if (i > 0) {
+        mask = fastsearch_eq_avx2(s, v, charsize);
+        if (mask) {
+            return fastsearch_highest_bit(mask) / charsize;
+        }
+    }
+    return -1;
+}
+
+_Py_TARGET("avx2") static _Py_ALWAYS_INLINE Py_ssize_t
+fastsearch_count_char_avx2_impl(const char *s, Py_ssize_t n, Py_UCS4 ch,
+                                Py_ssize_t maxcount, int charsize)
+{
+    const Py_ssize_t step = 32 / charsize;
+    __m256i v = fastsearch_set1_avx2(ch, charsize);
+    __m256i zero = _mm256_setzero_si256();
+    __m256i counts = zero;
+    Py_ssize_t i, count = 0;
+    int blocks = 0;
+    for (i = 0; i + step <= n; i += step) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(s + i * charsize));
+        if (charsize == 1) {
+            counts = _mm256_sub_epi8(counts, _mm256_cmpeq_epi8(x, v));
+        }
+        else {
+            counts = _mm256_sub_epi16(counts, _mm256_cmpeq_epi16(x, v));
+        }
+        if (++blocks == 255 || i + 2 * step > n) {
+            __m256i sums = _mm256_sad_epu8(counts, zero);
+            __m128i sums2 = _mm_add_epi64(_mm256_castsi256_si128(sums),
+                                          _mm256_extracti128_si256(sums, 1));
+            count += (_mm_cvtsi128_si64(sums2)
+                      + _mm_cvtsi128_si64(_mm_unpackhi_epi64(sums2, sums2)));
+            if (count >= maxcount) {
+                return maxcount;
+            }
+            counts = zero;
+            blocks = 0;
+        }
+    }
+    for (; i < n; i++) {
+        if (FASTSEARCH_CHAR(s, i, charsize) == ch) {
+            count++;
+        }
+    }
+    return Py_MIN(count, maxcount);
+}
+
+_Py_TARGET("avx2") static _Py_ALWAYS_INLINE Py_ssize_t
+fastsearch_search_avx2_impl(const char *s, Py_ssize_t n,
+                            const char *p, Py_ssize_t m,
+                            Py_ssize_t maxcount, int mode, int charsize)
+{
+    const Py_ssize_t step = 32 / charsize;
+    __m256i first = fastsearch_set1_avx2(FASTSEARCH_CHAR(p, 0, charsize),
+                                         charsize);
+    __m256i last = fastsearch_set1_avx2(FASTSEARCH_CHAR(p, m - 1, charsize),
+                                        charsize);
+    Py_ssize_t i, count = 0;
+    for (i = 0; i + step <= n - m + 1; i += step) {
+        const char *block = s + i * charsize;
+        uint32_t mask = (fastsearch_eq_avx2(block, first, charsize)
+                         & fastsearch_eq_avx2(block + (m - 1) * charsize,
+                                              last, charsize));
+        while (mask) {
+            int bit = fastsearch_lowest_bit(mask);
+            Py_ssize_t j = i + bit / charsize;
+            if (memcmp(s + (j + 1) * charsize, p + charsize,
+                       (m - 2) * charsize) != 0) {
+                mask ^= ((1u << charsize) - 1) << bit;
+                continue;
+            }
+            if (mode != FAST_COUNT) {
+                return j;
+            }
+            if (++count == maxcount) {
+                return maxcount;
+            }
+            Py_ssize_t skip = (j + m - i) * charsize;
+            if (skip >= 32) {
+                i = j + m - step;
+                break;
+            }
+            mask &= ~0u << skip;
+        }
+    }
+    return fastsearch_search_tail(s, n, p, m, maxcount, mode, charsize,
+                                  i, count);
+}
+
+_Py_TARGET("avx2") static Py_ssize_t
+fastsearch_find_char_avx2(const char *s, Py_ssize_t n, Py_UCS4 ch,
+                          int charsize)
+{
+    if (charsize == 1) {
+        return fastsearch_find_char_avx2_impl(s, n, ch, 1);
+    }
+    return fastsearch_find_char_avx2_impl(s, n, ch, 2);
+}
+
+_Py_TARGET("avx2") static Py_ssize_t
+fastsearch_rfind_char_avx2(const char *s, Py_ssize_t n, Py_UCS4 ch,
+                           int charsize)
+{
+    if (charsize == 1) {
+        return fastsearch_rfind_char_avx2_impl(s, n, ch, 1);
+    }
+    return fastsearch_rfind_char_avx2_impl(s, n, ch, 2);
+}
+
+_Py_TARGET("avx2") static Py_ssize_t
+fastsearch_count_char_avx2(const char *s, Py_ssize_t n, Py_UCS4 ch,
+                           Py_ssize_t maxcount, int charsize)
+{
+    if (charsize == 1) {
+        return fastsearch_count_char_avx2_impl(s, n, ch, maxcount, 1);
+    }
+    return fastsearch_count_char_avx2_impl(s, n, ch, maxcount, 2);
+}
+
+_Py_TARGET("avx2") static Py_ssize_t
+fastsearch_search_avx2(const char *s, Py_ssize_t n,
+                       const char *p, Py_ssize_t m,
+                       Py_ssize_t maxcount, int mode, int charsize)
+{
+    if (charsize == 1) {
+        return fastsearch_search_avx2_impl(s, n, p, m, maxcount, mode, 1);
+    }
+    return fastsearch_search_avx2_impl(s, n, p, m, maxcount, mode, 2);
+}
+
+
+/* Entry points, for FASTSEARCH_USE_SIMD(n, charsize) */
+
+static inline Py_ssize_t
+fastsearch_simd_find_char(const void *s, Py_ssize_t n, Py_UCS4 ch,
+                          int charsize)
+{
+    ch &= charsize == 1 ? 0xFF : 0xFFFF;
+    if (_Py_cpu_features & _Py_CPU_AVX2) {
+        return fastsearch_find_char_avx2(s, n, ch, charsize);
+    }
+    return fastsearch_find_char_sse2(s, n, ch, charsize);
+}
+
+static inline Py_ssize_t
+fastsearch_simd_rfind_char(const void *s, Py_ssize_t n, Py_UCS4 ch,
+                           int charsize)
+{
+    ch &= charsize == 1 ? 0xFF : 0xFFFF;
+    if (_Py_cpu_features & _Py_CPU_AVX2) {
+        return fastsearch_rfind_char_avx2(s, n, ch, charsize);
+    }
+    return fastsearch_rfind_char_sse2(s, n, ch, charsize);
+}
+
+static inline Py_ssize_t
+fastsearch_simd_count_char(const void *s, Py_ssize_t n, Py_UCS4 ch,
+                           Py_ssize_t maxcount, int charsize)
+{
+    ch &= charsize == 1 ? 0xFF : 0xFFFF;
+    if (_Py_cpu_features & _Py_CPU_AVX2) {
+        return fastsearch_count_char_avx2(s, n, ch, maxcount, charsize);
+    }
+    return fastsearch_count_char_sse2(s, n, ch, maxcount, charsize);
+}
+
+/* Search p[:m] in s[:n] for m >= 2, like FASTSEARCH() for the FAST_SEARCH
+   and FAST_COUNT modes */
+static inline Py_ssize_t
+fastsearch_simd_search(const void *s, Py_ssize_t n,
+                       const void *p, Py_ssize_t m,
+                       Py_ssize_t maxcount, int mode, int charsize)
+{
+    if (_Py_cpu_features & _Py_CPU_AVX2) {
+        return fastsearch_search_avx2(s, n, p, m, maxcount, mode, charsize);
+    }
+    return fastsearch_search_sse2(s, n, p, m, maxcount, mode, charsize);
+}
+
+#endif /* !STRINGLIB_FASTSEARCH_SIMD_H */
@@ -47,6 +47,10 @@
     count++; }
 
 
+/* Number of characters that split_char() and rsplit_char() check before
+   searching the rest of the string with find_char() and rfind_char() */
+#define SPLIT_SCAN_AHEAD 8
+
 /* Always force the list to the expected size. */
 #define FIX_PREALLOC_SIZE(list) Py_SET_SIZE(list, count)
 
@@ -111,16 +115,23 @@ STRINGLIB(split_char)(PyObject* str_obj,
     if (list == NULL)
         return NULL;
 
-    i = j = 0;
-    while ((j < str_len) && (maxcount-- > 0)) {
-        for(; j < str_len; j++) {
-            /* I found that using memchr makes no difference */
-            if (str[j] == ch) {
-                SPLIT_ADD(str, i, j);
-                i = j = j + 1;
+    i = 0;
+    while ((i < str_len) && (maxcount-- > 0)) {
+        /* Short fields are found faster without calling find_char() */
+        for (j = i; j < str_len && j - i < SPLIT_SCAN_AHEAD; j++) {
+            if (str[j] == ch)
+                break;
+        }
+        if (j - i == SPLIT_SCAN_AHEAD) {
+            Py_ssize_t pos = STRINGLIB(find_char)(str + j, str_len - j, ch);
+            if (pos < 0)
                 break;
-            }
+            j += pos;
         }
+        else if (j == str_len)
+            break;
+        SPLIT_ADD(str, i, j);
+        i = j + 1;
     }
 #ifndef STRINGLIB_MUTABLE
     if (count == 0 && STRINGLIB_CHECK_EXACT(str_obj)) {
@@ -252,15 +263,21 @@ STRINGLIB(rsplit_char)(PyObject* str_obj,
     if (list == NULL)
         return NULL;
 
-    i = j = str_len - 1;
-    while ((i >= 0) && (maxcount-- > 0)) {
-        for(; i >= 0; i--) {
-            if (str[i] == ch) {
-                SPLIT_ADD(str, i + 1, j + 1);
-                j = i = i - 1;
+    j = str_len;
+    while ((j > 0) && (maxcount-- > 0)) {
+        for (i = j - 1; i >= 0 && j - i <= SPLIT_SCAN_AHEAD; i--) {
+            if (str[i] == ch)
+                break;
+        }
+        if (j - i > SPLIT_SCAN_AHEAD) {
+            i = STRINGLIB(rfind_char)(str, i + 1, ch);
+            if (i < 0)
                 break;
-            }
         }
+        else if (i < 0)
+            break;
+        SPLIT_ADD(str, i + 1, j);
+        j = i;
     }
 #ifndef STRINGLIB_MUTABLE
     if (count == 0 && STRINGLIB_CHECK_EXACT(str_obj)) {
@@ -270,8 +287,8 @@ STRINGLIB(rsplit_char)(PyObject* str_obj,
         count++;
     } else
 #endif
-    if (j >= -1) {
-        SPLIT_ADD(str, 0, j + 1);
+    if (j >= 0) {
+        SPLIT_ADD(str, 0, j);
     }
     FIX_PREALLOC_SIZE(list);
     if (PyList_Reverse(list) < 0)
@@ -0,0 +1,750 @@
+/* UTF-8 validation and decoding with SSE4.1 and AVX2
+
+   unicode_decode_utf8() uses these functions for input that is not only
+   ASCII, in two passes:
+
+   - utf8_scan_sse() or utf8_scan_avx2() checks that the input is valid
+     UTF-8, counts its continuation bytes and finds its largest byte.
+     This gives the length of the string and its kind: a valid input whose
+     largest byte is below 0xC4 only has code points below U+0100, below
+     0xF0 only code points of the BMP.  Validation is the algorithm of J. Keiser and D. Lemire,
+     "Validating UTF-8 In Less Than One Instruction Per Byte", Software:
+     Practice and Experience 51(5), 2021.
+
+   - utf8_write_sse() or utf8_write_avx2() then decodes the valid input
+     into the string without any check, 8 (SSE4.1) or 16 (AVX2) bytes at a
+     time: the code point of the sequence starting at each byte is
+     computed, assuming a sequence of at most 3 bytes starts there, and the
+     code points of the bytes that are not continuation bytes are packed
+     together by a shuffle.  Sequences of 4 bytes are decoded 8 bytes at a
+     time in 32-bit lanes with AVX2, one by one with SSE4.1.
+
+   Invalid input is decoded again by the stringlib decoder, which reports
+   the errors. */
+
+#ifdef _Py_HAVE_X86_SIMD
+
+/* Errors found from the first 12 bits of 2 consecutive bytes of input:
+   each lookup table gives, for a nibble, the errors that the pair may
+   have, and the pair has those given by all three tables. */
+#define U8_TOO_SHORT    (1 << 0)    /* 11______ 0_______
+                                       11______ 11______ */
+#define U8_TOO_LONG     (1 << 1)    /* 0_______ 10______ */
+#define U8_OVERLONG_3   (1 << 2)    /* 11100000 100_____ */
+#define U8_TOO_LARGE    (1 << 3)    /* 11110100 1001____
+                                       11110100 101_____
+                                       11110101 1001____ ...  */
+#define U8_SURROGATE    (1 << 4)    /* 11101101 101_____ */
+#define U8_OVERLONG_2   (1 << 5)    /* 1100000_ 10______ */
+#define U8_TOO_LARGE_1000 (1 << 6)  /* 11110101 1000____
+                                       1111011_ 1000____
+                                       11111___ 1000____ */
+#define U8_OVERLONG_4   (1 << 6)    /* 11110000 1000____ */
+#define U8_TWO_CONTS    (1 << 7)    /* 10______ 10______ */
+/* Errors that don't depend on the low nibble of the first byte */
+#define U8_CARRY (U8_TOO_SHORT | U8_TOO_LONG | U8_TWO_CONTS)
+
+/* By the high nibble of the first byte */
+static const uint8_t utf8_byte_1_high[16] = {
+    /* 0_______ ________ */
+    U8_TOO_LONG, U8_TOO_LONG, U8_TOO_LONG, U8_TOO_LONG,
+    U8_TOO_LONG, U8_TOO_LONG, U8_TOO_LONG, U8_TOO_LONG,
+    /* 10______ ________ */
+    U8_TWO_CONTS, U8_TWO_CONTS, U8_TWO_CONTS, U8_TWO_CONTS,
+    /* 1100____ ________ */
+    U8_TOO_SHORT | U8_OVERLONG_2,
+    /* 1101____ ________ */
+    U8_TOO_SHORT,
+    /* 1110____ ________ */
+    U8_TOO_SHORT | U8_OVERLONG_3 | U8_SURROGATE,
+    /* 1111____ ________ */
+    U8_TOO_SHORT | U8_TOO_LARGE | U8_TOO_LARGE_1000 | U8_OVERLONG_4,
+};
+
+/* By the low nibble of the first byte */
+static const uint8_t utf8_byte_1_low[16] = {
+    /* ____0000 ________ */
+    U8_CARRY | U8_OVERLONG_3 | U8_OVERLONG_2 | U8_OVERLONG_4,
+    /* ____0001 ________ */
+    U8_CARRY | U8_OVERLONG_2,
+    /* ____001_ ________ */
+    U8_CARRY,
+    U8_CARRY,
+    /* ____0100 ________ */
+    U8_CARRY | U8_TOO_LARGE,
+    /* ____0101 ________ */
+    U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+    /* ____011_ ________ */
+    U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+    U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+    /* ____1___ ________ */
+    U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+    U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+    U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+    U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+    U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+    /* ____1101 ________ */
+    U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000 | U8_SURROGATE,
+    U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+    U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,
+};
+
+/* By the high nibble of the second byte */
+static const uint8_t utf8_byte_2_high[16] = {
+    /* ________ 0_______ */
+    U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT,
+    U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT,
+    /* ________ 1000____ */
+    U8_TOO_LONG | U8_OVERLONG_2 | U8_TWO_CONTS | U8_OVERLONG_3
+        | U8_TOO_LARGE_1000 | U8_OVERLONG_4,
+    /* ________ 1001____ */
+    U8_TOO_LONG | U8_OVERLONG_2 | U8_TWO_CONTS | U8_OVERLONG_3
+        | U8_TOO_LARGE,
+    /* ________ 101_____ */
+    U8_TOO_LONG | U8_OVERLONG_2 | U8_TWO_CONTS | U8_SURROGATE | U8_TOO_LARGE,
+    U8_TOO_LONG | U8_OVERLONG_2 | U8_TWO_CONTS | U8_SURROGATE | U8_TOO_LARGE,
+    /* ________ 11______ */
+    U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT,
+};
+
+/* Shuffles packing the 16-bit lanes selected by a mask of 8 bits, the
+   same for 32-bit lanes (as indexes of lanes), and the number of these
+   lanes.  Filled by utf8_simd_init(). */
+static uint8_t utf8_pack_shuffle[256][16];
+static uint8_t utf8_pack_lanes[256][8];
+static uint8_t utf8_pack_count[256];
+
+static void
+utf8_simd_init(void)
+{
+    for (int mask = 0; mask < 256; mask++) {
+        int n = 0;
+        for (int i = 0; i < 8; i++) {
+            if (mask & (1 << i)) {
+                utf8_pack_shuffle[mask][2 * n] = (uint8_t)(2 * i);
+                utf8_pack_shuffle[mask][2 * n + 1] = (uint8_t)(2 * i + 1);
+                utf8_pack_lanes[mask][n] = (uint8_t)i;
+                n++;
+            }
+        }
+        for (int i = 2 * n; i < 16; i++) {
+            utf8_pack_shuffle[mask][i] = 0x80;
+        }
+        utf8_pack_count[mask] = (uint8_t)n;
+    }
+}
+
+/* Decode a valid sequence that may start with the end of the previous one
+   (the vector loops leave the input pointer in the middle of a sequence
+   they decoded).  Return a pointer past the decoded sequence. */
+static inline const char *
+utf8_decode_valid(const char *s, Py_UCS4 *ch)
+{
+    const unsigned char *p = (const unsigned char *)s;
+    while ((*p & 0xC0) == 0x80) {
+        p++;
+    }
+    if (p[0] < 0x80) {
+        *ch = p[0];
+        return (const char *)p + 1;
+    }
+    if (p[0] < 0xE0) {
+        *ch = ((p[0] & 0x1F) << 6) | (p[1] & 0x3F);
+        return (const char *)p + 2;
+    }
+    if (p[0] < 0xF0) {
+        *ch = ((p[0] & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+        return (const char *)p + 3;
+    }
+    *ch = (((p[0] & 0x07) << 18) | ((p[1] & 0x3F) << 12)
+           | ((p[2] & 0x3F) << 6) | (p[3] & 0x3F));
+    return (const char *)p + 4;
+}
+
+/* Write the code points of the valid input to *out (of a UCS4 string) up to
+   the first one outside the BMP, which the SSE loop doesn't handle */
+static inline const char *
+utf8_write_to_lead4(const char *s, char **out)
+{
+    Py_UCS4 ch;
+    do {
+        s = utf8_decode_valid(s, &ch);
+        *(Py_UCS4 *)*out = ch;
+        *out += 4;
+    } while (ch < 0x10000);
+    return s;
+}
+
+/* Write the code points of the valid input s[:end] from data[pos] */
+static void
+utf8_write_tail(const char *s, const char *end,
+                int kind, void *data, Py_ssize_t pos)
+{
+    while (s < end) {
+        Py_UCS4 ch;
+        /* The input may end with the end of a sequence already written */
+        if (((unsigned char)*s & 0xC0) == 0x80) {
+            s++;
+            continue;
+        }
+        s = utf8_decode_valid(s, &ch);
+        PyUnicode_WRITE(kind, data, pos, ch);
+        pos++;
+    }
+}
+
+
+/* SSE4.1 */
+
+_Py_TARGET("ssse3,sse4.1") static _Py_ALWAYS_INLINE __m128i
+utf8_errors_sse(__m128i input, __m128i prev_input)
+{
+    const __m128i low_nibble = _mm_set1_epi8(0x0F);
+    __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+    __m128i byte_1_high = _mm_shuffle_epi8(
+        _mm_loadu_si128((const __m128i *)utf8_byte_1_high),
+        _mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble));
+    __m128i byte_1_low = _mm_shuffle_epi8(
+        _mm_loadu_si128((const __m128i *)utf8_byte_1_low),
+        _mm_and_si128(prev1, low_nibble));
+    __m128i byte_2_high = _mm_shuffle_epi8(
+        _mm_loadu_si128((const __m128i *)utf8_byte_2_high),
+        _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble));
+    __m128i special = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low),
+                                    byte_2_high);
+    /* Two continuation bytes are an error unless they follow the lead of a
+       3 or 4 bytes sequence */
+    __m128i prev2 = _mm_alignr_epi8(input, prev_input, 14);
+    __m128i prev3 = _mm_alignr_epi8(input, prev_input, 13);
+    __m128i third = _mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xE0 - 0x80)));
+    __m128i fourth = _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xF0 - 0x80)));
+    __m128i must_be_cont = _mm_and_si128(_mm_or_si128(third, fourth),
+                                         _mm_set1_epi8((char)0x80));
+    return _mm_xor_si128(must_be_cont, special);
+}
+
+_Py_TARGET("ssse3,sse4.1") static int
+utf8_scan_sse(const char *s, const char *end,
+              Py_ssize_t *conts, unsigned char *maxbyte)
+{
+    /* A sequence is incomplete at the end of a block if one of its 3 last
+       bytes is a lead byte of a longer sequence */
+    const __m128i incomplete = _mm_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+    const __m128i cont_max = _mm_set1_epi8((char)0xC0);
+    __m128i zero = _mm_setzero_si128();
+    __m128i error = zero, prev_input = zero, prev_incomplete = zero;
+    __m128i vmax = zero, count = zero;
+    Py_ssize_t total = 0;
+    int nblocks = 0;
+
+    for (;;) {
+        __m128i input;
+        int last = (end - s < 16);
+        if (!last) {
+            input = _mm_loadu_si128((const __m128i *)s);
+            s += 16;
+        }
+        else {
+            /* Padding the input with zeros also checks that it doesn't end
+               with an incomplete sequence */
+            char tail[16] = {0};
+            memcpy(tail, s, end - s);
+            input = _mm_loadu_si128((const __m128i *)tail);
+        }
+        if (!last && _mm_movemask_epi8(input) == 0) {
+            error = _mm_or_si128(error, prev_incomplete);
+        }
+        else {
+            error = _mm_or_si128(error, utf8_errors_sse(input, prev_input));
+            prev_incomplete = _mm_subs_epu8(input, incomplete);
+            vmax = _mm_max_epu8(vmax, input);
+            /* Bytes 0x80-0xBF are signed bytes below (char)0xC0 */
+            count = _mm_sub_epi8(count, _mm_cmplt_epi8(input, cont_max));
+        }
+        prev_input = input;
+        if (last || ++nblocks == 255) {
+            __m128i sums = _mm_sad_epu8(count, zero);
+            total += _mm_cvtsi128_si64(sums) + _mm_extract_epi64(sums, 1);
+            count = zero;
+            nblocks = 0;
+            if (!_mm_testz_si128(error, error)) {
+                return 0;
+            }
+            if (last) {
+                break;
+            }
+        }
+    }
+
+    uint8_t bytes[16];
+    _mm_storeu_si128((__m128i *)bytes, vmax);
+    *maxbyte = 0;
+    for (int i = 0; i < 16; i++) {
+        *maxbyte = Py_MAX(*maxbyte, bytes[i]);
+    }
+    *conts = total;
+    return 1;
+}
+
+/* Code points of the sequences starting in the 8 first bytes of x, packed
+   in the first 16-bit lanes.  x must have the 2 next bytes of input, and
+   the sequences starting in the 8 first bytes must be 1 to 3 bytes long. */
+_Py_TARGET("ssse3,sse4.1") static _Py_ALWAYS_INLINE __m128i
+utf8_decode8_sse(__m128i x, int *n)
+{
+    const __m128i cont_bits = _mm_set1_epi16(0x3F);
+    __m128i b = _mm_cvtepu8_epi16(x);
+    __m128i c1 = _mm_and_si128(_mm_cvtepu8_epi16(_mm_srli_si128(x, 1)),
+                               cont_bits);
+    __m128i c2 = _mm_and_si128(_mm_cvtepu8_epi16(_mm_srli_si128(x, 2)),
+                               cont_bits);
+    /* 110xxxxx 10yyyyyy */
+    __m128i v2 = _mm_or_si128(
+        _mm_slli_epi16(_mm_and_si128(b, _mm_set1_epi16(0x1F)), 6), c1);
+    /* 1110xxxx 10yyyyyy 10zzzzzz: the shift drops the 1110 */
+    __m128i v3 = _mm_or_si128(
+        _mm_or_si128(_mm_slli_epi16(b, 12), _mm_slli_epi16(c1, 6)), c2);
+    __m128i v = _mm_blendv_epi8(v2, b,
+                                _mm_cmplt_epi16(b, _mm_set1_epi16(0x80)));
+    v = _mm_blendv_epi8(v, v3, _mm_cmpgt_epi16(b, _mm_set1_epi16(0xDF)));
+    /* Drop the lanes of continuation bytes (signed bytes below -64) */
+    int keep = _mm_movemask_epi8(
+        _mm_cmpgt_epi8(x, _mm_set1_epi8(-65))) & 0xFF;
+    *n = utf8_pack_count[keep];
+    return _mm_shuffle_epi8(
+        v, _mm_loadu_si128((const __m128i *)utf8_pack_shuffle[keep]));
+}
+
+/* Store the 8 code points of v */
+_Py_TARGET("ssse3,sse4.1") static _Py_ALWAYS_INLINE void
+utf8_store8_sse(char *out, __m128i v, int kind)
+{
+    if (kind == PyUnicode_1BYTE_KIND) {
+        _mm_storel_epi64((__m128i *)out, _mm_packus_epi16(v, v));
+    }
+    else if (kind == PyUnicode_2BYTE_KIND) {
+        _mm_storeu_si128((__m128i *)out, v);
+    }
+    else {
+        _mm_storeu_si128((__m128i *)out, _mm_cvtepu16_epi32(v));
+        _mm_storeu_si128((__m128i *)(out + 16),
+                         _mm_cvtepu16_epi32(_mm_srli_si128(v, 8)));
+    }
+}
+
+/* Store the 16 ASCII characters of x */
+_Py_TARGET("ssse3,sse4.1") static _Py_ALWAYS_INLINE void
+utf8_store_ascii_sse(char *out, __m128i x, int kind)
+{
+    __m128i zero = _mm_setzero_si128();
+    if (kind == PyUnicode_1BYTE_KIND) {
+        _mm_storeu_si128((__m128i *)out, x);
+    }
+    else if (kind == PyUnicode_2BYTE_KIND) {
+        _mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi8(x, zero));
+        _mm_storeu_si128((__m128i *)(out + 16), _mm_unpackhi_epi8(x, zero));
+    }
+    else {
+        for (int i = 0; i < 4; i++) {
+            _mm_storeu_si128((__m128i *)(out + 16 * i), _mm_cvtepu8_epi32(x));
+            x = _mm_srli_si128(x, 4);
+        }
+    }
+}
+
+/* Return non-zero if one of the 8 first bytes of x starts a sequence of
+   4 bytes */
+_Py_TARGET("ssse3,sse4.1") static _Py_ALWAYS_INLINE int
+utf8_has_lead4_sse(__m128i x)
+{
+    __m128i lead4 = _mm_set1_epi8((char)0xF0);
+    return (_mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_max_epu8(x, lead4), x)) & 0xFF) != 0;
+}
+
+_Py_TARGET("ssse3,sse4.1") static _Py_ALWAYS_INLINE Py_ssize_t
+utf8_write_sse_impl(const char **ps, const char *end,
+                    int kind, void *data, Py_ssize_t length)
+{
+    const char *s = *ps;
+    char *out = (char *)data;
+    char *out_end = out + length * kind;
+
+    while (end - s >= 16 && out_end - out >= 8 * kind) {
+        __m128i x = _mm_loadu_si128((const __m128i *)s);
+        if (_mm_movemask_epi8(x) == 0) {
+            utf8_store_ascii_sse(out, x, kind);
+            s += 16;
+            out += 16 * kind;
+            continue;
+        }
+        if (kind == PyUnicode_4BYTE_KIND && utf8_has_lead4_sse(x)) {
+            s = utf8_write_to_lead4(s, &out);
+            continue;
+        }
+        int n;
+        utf8_store8_sse(out, utf8_decode8_sse(x, &n), kind);
+        s += 8;
+        out += n * kind;
+    }
+    *ps = s;
+    return (out - (char *)data) / kind;
+}
+
+_Py_TARGET("ssse3,sse4.1") static Py_ssize_t
+utf8_write_sse(const char **ps, const char *end,
+               int kind, void *data, Py_ssize_t length)
+{
+    switch (kind) {
+    case PyUnicode_1BYTE_KIND:
+        return utf8_write_sse_impl(ps, end, PyUnicode_1BYTE_KIND,
+                                    data, length);
+    case PyUnicode_2BYTE_KIND:
+        return utf8_write_sse_impl(ps, end, PyUnicode_2BYTE_KIND,
+                                    data, length);
+    default:
+        return utf8_write_sse_impl(ps, end, PyUnicode_4BYTE_KIND,
+                                    data, length);
+    }
+}
+
+
+/* AVX2: the same with 32 bytes of input (16 for decoding) per step */
+
+/* Bytes 16-N to 31 of prev_input followed by bytes 0 to 31-N of input */
+#define UTF8_PREV_AVX2(input, prev_input, N) \
+    _mm256_alignr_epi8( \
+        (input), _mm256_permute2x128_si256((prev_input), (input), 0x21), \
+        16 - (N))
+
+_Py_TARGET("avx2") static _Py_ALWAYS_INLINE __m256i
+utf8_errors_avx2(__m256i input, __m256i prev_input)
+{
+    const __m256i low_nibble = _mm256_set1_epi8(0x0F);
+    __m256i prev1 = UTF8_PREV_AVX2(input, prev_input, 1);
+    __m256i byte_1_high = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(
+            _mm_loadu_si128((const __m128i *)utf8_byte_1_high)),
+        _mm256_and_si256(_mm256_srli_epi16(prev1, 4), low_nibble));
+    __m256i byte_1_low = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(
+            _mm_loadu_si128((const __m128i *)utf8_byte_1_low)),
+        _mm256_and_si256(prev1, low_nibble));
+    __m256i byte_2_high = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(
+            _mm_loadu_si128((const __m128i *)utf8_byte_2_high)),
+        _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble));
+    __m256i special = _mm256_and_si256(
+        _mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+    __m256i prev2 = UTF8_PREV_AVX2(input, prev_input, 2);
+    __m256i prev3 = UTF8_PREV_AVX2(input, prev_input, 3);
+    __m256i third = _mm256_subs_epu8(prev2,
+                                     _mm256_set1_epi8((char)(0xE0 - 0x80)));
+    __m256i fourth = _mm256_subs_epu8(prev3,
+                                      _mm256_set1_epi8((char)(0xF0 - 0x80)));
+    __m256i must_be_cont = _mm256_and_si256(_mm256_or_si256(third, fourth),
+                                            _mm256_set1_epi8((char)0x80));
+    return _mm256_xor_si256(must_be_cont, special);
+}
+
+_Py_TARGET("avx2") static int
+utf8_scan_avx2(const char *s, const char *end,
+               Py_ssize_t *conts, unsigned char *maxbyte)
+{
+    const __m256i incomplete = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+    const __m256i cont_max = _mm256_set1_epi8((char)0xC0);
+    __m256i zero = _mm256_setzero_si256();
+    __m256i error = zero, prev_input = zero, prev_incomplete = zero;
+    __m256i vmax = zero, count = zero;
+    Py_ssize_t total = 0;
+    int nblocks = 0;
+
+    for (;;) {
+        __m256i input;
+        int last = (end - s < 32);
+        if (!last) {
+            input = _mm256_loadu_si256((const __m256i *)s);
+            s += 32;
+        }
+        else {
+            char tail[32] = {0};
+            memcpy(tail, s, end - s);
+            input = _mm256_loadu_si256((const __m256i *)tail);
+        }
+        if (!last && _mm256_movemask_epi8(input) == 0) {
+            error = _mm256_or_si256(error, prev_incomplete);
+        }
+        else {
+            error = _mm256_or_si256(error,
+                                    utf8_errors_avx2(input, prev_input));
+            prev_incomplete = _mm256_subs_epu8(input, incomplete);
+            vmax = _mm256_max_epu8(vmax, input);
+            count = _mm256_sub_epi8(count,
+                                    _mm256_cmpgt_epi8(cont_max, input));
+        }
+        prev_input = input;
+        if (last || ++nblocks == 255) {
+            __m256i sums = _mm256_sad_epu8(count, zero);
+            __m128i sums2 = _mm_add_epi64(_mm256_castsi256_si128(sums),
+                                          _mm256_extracti128_si256(sums, 1));
+            total += _mm_cvtsi128_si64(sums2) + _mm_extract_epi64(sums2, 1);
+            count = zero;
+            nblocks = 0;
+            if (!_mm256_testz_si256(error, error)) {
+                return 0;
+            }
+            if (last) {
+                break;
+            }
+        }
+    }
+
+    uint8_t bytes[32];
+    _mm256_storeu_si256((__m256i *)bytes, vmax);
+    *maxbyte = 0;
+    for (int i = 0; i < 32; i++) {
+        *maxbyte = Py_MAX(*maxbyte, bytes[i]);
+    }
+    *conts = total;
+    return 1;
+}
+
+/* Like utf8_decode8_sse() for the 16 first bytes of s, which must have
+   18 bytes of input.  The code points are packed in each 128-bit half. */
+_Py_TARGET("avx2") static _Py_ALWAYS_INLINE __m256i
+utf8_decode16_avx2(const char *s, int *keep)
+{
+    const __m256i cont_bits = _mm256_set1_epi16(0x3F);
+    __m128i x = _mm_loadu_si128((const __m128i *)s);
+    __m256i b = _mm256_cvtepu8_epi16(x);
+    __m256i c1 = _mm256_and_si256(
+        _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(s + 1))),
+        cont_bits);
+    __m256i c2 = _mm256_and_si256(
+        _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(s + 2))),
+        cont_bits);
+    __m256i v2 = _mm256_or_si256(
+        _mm256_slli_epi16(_mm256_and_si256(b, _mm256_set1_epi16(0x1F)), 6),
+        c1);
+    __m256i v3 = _mm256_or_si256(
+        _mm256_or_si256(_mm256_slli_epi16(b, 12), _mm256_slli_epi16(c1, 6)),
+        c2);
+    __m256i v = _mm256_blendv_epi8(
+        v2, b, _mm256_cmpgt_epi16(_mm256_set1_epi16(0x80), b));
+    v = _mm256_blendv_epi8(
+        v, v3, _mm256_cmpgt_epi16(b, _mm256_set1_epi16(0xDF)));
+    *keep = _mm_movemask_epi8(_mm_cmpgt_epi8(x, _mm_set1_epi8(-65)));
+    __m256i shuffle = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(
+            _mm_loadu_si128((const __m128i *)utf8_pack_shuffle[*keep & 0xFF])),
+        _mm_loadu_si128((const __m128i *)utf8_pack_shuffle[*keep >> 8]), 1);
+    return _mm256_shuffle_epi8(v, shuffle);
+}
+
+/* Decode the sequences starting in the 8 first bytes of s, which must have
+   11 bytes of input, into 32-bit code points packed at the start of the
+   result.  Set *keep to the mask of the positions starting a sequence.
+
+   Each lane gets the 4 bytes from its position, whose 6 (7 for the first
+   one) low bits are joined into b << 18 | c1 << 12 | c2 << 6 | c3, and
+   the bits of the sequence are then isolated by two shifts that depend on
+   the high nibble of the first byte. */
+_Py_TARGET("avx2") static _Py_ALWAYS_INLINE __m256i
+utf8_decode8_ucs4_avx2(const char *s, int *keep)
+{
+    /* Shift counts by high nibble of the first byte */
+    const __m256i shift_left = _mm256_setr_epi8(
+        7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 9, 9, 10, 11,
+        7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 9, 9, 10, 11);
+    const __m256i shift_right = _mm256_setr_epi8(
+        25, 25, 25, 25, 25, 25, 25, 25, 0, 0, 0, 0, 21, 21, 16, 11,
+        25, 25, 25, 25, 25, 25, 25, 25, 0, 0, 0, 0, 21, 21, 16, 11);
+    __m128i x = _mm_loadu_si128((const __m128i *)s);
+    __m256i v = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(x),
+        _mm256_setr_epi8(3, 2, 1, 0, 4, 3, 2, 1, 5, 4, 3, 2, 6, 5, 4, 3,
+                         7, 6, 5, 4, 8, 7, 6, 5, 9, 8, 7, 6, 10, 9, 8, 7));
+    __m256i nibble = _mm256_or_si256(_mm256_srli_epi32(v, 28),
+                                     _mm256_set1_epi32((int)0x80808000));
+    __m256i bits = _mm256_and_si256(v, _mm256_set1_epi32(0x7F3F3F3F));
+    bits = _mm256_maddubs_epi16(bits, _mm256_set1_epi16(64 << 8 | 1));
+    bits = _mm256_madd_epi16(bits, _mm256_set1_epi32(4096 << 16 | 1));
+    bits = _mm256_sllv_epi32(bits, _mm256_shuffle_epi8(shift_left, nibble));
+    bits = _mm256_srlv_epi32(bits, _mm256_shuffle_epi8(shift_right, nibble));
+    *keep = _mm_movemask_epi8(_mm_cmpgt_epi8(x, _mm_set1_epi8(-65))) & 0xFF;
+    __m256i lanes = _mm256_cvtepu8_epi32(
+        _mm_loadl_epi64((const __m128i *)utf8_pack_lanes[*keep]));
+    return _mm256_permutevar8x32_epi32(bits, lanes);
+}
+
+_Py_TARGET("avx2") static _Py_ALWAYS_INLINE void
+utf8_store_ascii_avx2(char *out, __m256i x, int kind)
+{
+    if (kind == PyUnicode_1BYTE_KIND) {
+        _mm256_storeu_si256((__m256i *)out, x);
+    }
+    else if (kind == PyUnicode_2BYTE_KIND) {
+        _mm256_storeu_si256((__m256i *)out,
+            _mm256_cvtepu8_epi16(_mm256_castsi256_si128(x)));
+        _mm256_storeu_si256((__m256i *)(out + 32),
+            _mm256_cvtepu8_epi16(_mm256_extracti128_si256(x, 1)));
+    }
+    else {
+        __m128i lo = _mm256_castsi256_si128(x);
+        __m128i hi = _mm256_extracti128_si256(x, 1);
+        _mm256_storeu_si256((__m256i *)out, _mm256_cvtepu8_epi32(lo));
+        _mm256_storeu_si256((__m256i *)(out + 32),
+            _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+        _mm256_storeu_si256((__m256i *)(out + 64), _mm256_cvtepu8_epi32(hi));
+        _mm256_storeu_si256((__m256i *)(out + 96),
+            _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+    }
+}
+
+_Py_TARGET("avx2") static _Py_ALWAYS_INLINE void
+utf8_store8_avx2(char *out, __m128i v, int kind)
+{
+    if (kind == PyUnicode_1BYTE_KIND) {
+        _mm_storel_epi64((__m128i *)out, _mm_packus_epi16(v, v));
+    }
+    else if (kind == PyUnicode_2BYTE_KIND) {
+        _mm_storeu_si128((__m128i *)out, v);
+    }
+    else {
+        _mm256_storeu_si256((__m256i *)out, _mm256_cvtepu16_epi32(v));
+    }
+}
+
+_Py_TARGET("avx2") static _Py_ALWAYS_INLINE Py_ssize_t
+utf8_write_avx2_impl(const char **ps, const char *end,
+                     int kind, void *data, Py_ssize_t length)
+{
+    const char *s = *ps;
+    char *out = (char *)data;
+    char *out_end = out + length * kind;
+
+    while (end - s >= 32 && out_end - out >= 16 * kind) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)s);
+        if (_mm256_movemask_epi8(x) == 0) {
+            utf8_store_ascii_avx2(out, x, kind);
+            s += 32;
+            out += 32 * kind;
+            continue;
+        }
+        if (kind == PyUnicode_4BYTE_KIND) {
+            __m256i lead4 = _mm256_set1_epi8((char)0xF0);
+            int mask = _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(_mm256_max_epu8(x, lead4), x));
+            if (mask & 0xFFFF) {
+                int keep;
+                __m256i v = utf8_decode8_ucs4_avx2(s, &keep);
+                _mm256_storeu_si256((__m256i *)out, v);
+                out += utf8_pack_count[keep] * 4;
+                s += 8;
+                continue;
+            }
+        }
+        int keep;
+        __m256i v = utf8_decode16_avx2(s, &keep);
+        utf8_store8_avx2(out, _mm256_castsi256_si128(v), kind);
+        out += utf8_pack_count[keep & 0xFF] * kind;
+        utf8_store8_avx2(out, _mm256_extracti128_si256(v, 1), kind);
+        out += utf8_pack_count[keep >> 8] * kind;
+        s += 16;
+    }
+    *ps = s;
+    return (out - (char *)data) / kind;
+}
+
+_Py_TARGET("avx2") static Py_ssize_t
+utf8_write_avx2(const char **ps, const char *end,
+                int kind, void *data, Py_ssize_t length)
+{
+    switch (kind) {
+    case PyUnicode_1BYTE_KIND:
+        return utf8_write_avx2_impl(ps, end, PyUnicode_1BYTE_KIND,
+                                     data, length);
+    case PyUnicode_2BYTE_KIND:
+        return utf8_write_avx2_impl(ps, end, PyUnicode_2BYTE_KIND,
+                                     data, length);
+    default:
+        return utf8_write_avx2_impl(ps, end, PyUnicode_4BYTE_KIND,
+                                     data, length);
+    }
+}
+
+
+/* Inputs shorter than this aren't worth a second pass */
+#define UTF8_SIMD_MIN_SIZE 32
+
+/* Decode the UTF-8 string starts[:end] whose ASCII prefix ends at s, a
+   non-ASCII byte.  Return 1 and set *result to the new string, 0 if the
+   input is not valid UTF-8, or -1 with an exception set. */
+static int
+utf8_simd_decode(const char *starts, const char *s, const char *end,
+                 PyObject **result)
+{
+    Py_ssize_t conts;
+    unsigned char maxbyte;
+    int valid;
+    if (_Py_cpu_features & _Py_CPU_AVX2) {
+        valid = utf8_scan_avx2(s, end, &conts, &maxbyte);
+    }
+    else {
+        valid = utf8_scan_sse(s, end, &conts, &maxbyte);
+    }
+    if (!valid) {
+        return 0;
+    }
+
+    Py_UCS4 maxchar;
+    if (maxbyte >= 0xF0) {
+        maxchar = MAX_UNICODE;
+    }
+    else if (maxbyte >= 0xC4) {
+        maxchar = 0xFFFF;
+    }
+    else {
+        assert(maxbyte >= 0xC2);
+        maxchar = 0xFF;
+    }
+    Py_ssize_t prefix = s - starts;
+    Py_ssize_t length = (end - starts) - conts;
+    PyObject *u = PyUnicode_New(length, maxchar);
+    if (u == NULL) {
+        return -1;
+    }
+    int kind = PyUnicode_KIND(u);
+    void *data = PyUnicode_DATA(u);
+    if (kind == PyUnicode_1BYTE_KIND) {
+        memcpy(data, starts, prefix);
+    }
+    else if (kind == PyUnicode_2BYTE_KIND) {
+        _PyUnicode_CONVERT_BYTES(Py_UCS1, Py_UCS2, starts, s, data);
+    }
+    else {
+        _PyUnicode_CONVERT_BYTES(Py_UCS1, Py_UCS4, starts, s, data);
+    }
+    data = (char *)data + prefix * kind;
+    /* The vector functions leave the end of the input to utf8_write_tail():
+       calling it from them, compilers may not clear the upper halves of the
+       AVX registers, which slows down the SSE code running next */
+    Py_ssize_t pos;
+    if (_Py_cpu_features & _Py_CPU_AVX2) {
+        pos = utf8_write_avx2(&s, end, kind, data, length - prefix);
+    }
+    else {
+        pos = utf8_write_sse(&s, end, kind, data, length - prefix);
+    }
+    utf8_write_tail(s, end, kind, data, pos);
+    assert(_PyUnicode_CheckConsistency(u, 1));
+    *result = u;
+    return 1;
+}
+
+#endif /* _Py_HAVE_X86_SIMD */
@@ -2668,6 +2668,15 @@ type_new(PyTypeObject *metatype, PyObject *args, PyObject *kwds)
     if (type == NULL)
         goto error;
 
+    /* Initialize tp_flags */
+    // All heap types need GC, since we can create a reference cycle by storing
+    // an instance on one of its parents.
+    // The flags must be initialized before anything that may block, like
+    // _PyTypeId_Allocate(): another thread can then run the GC, which
+    // traverses us.
+    type->tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HEAPTYPE |
+        Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC;
+
     if (_PyTypeId_Allocate(&_PyRuntime.typeids, type) < 0) {
         goto error;
     }
@@ -2680,12 +2689,6 @@ type_new(PyTypeObject *metatype, PyObject *args, PyObject *kwds)
     et->ht_slots = slots;
     slots = NULL;
 
-    /* Initialize tp_flags */
-    // All heap types need GC, since we can create a reference cycle by storing
-    // an instance on one of its parents:
-    type->tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HEAPTYPE |
-        Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC;
-
     /* Initialize essential fields */
     type->tp_as_async = &et->as_async;
     type->tp_as_number = &et->as_number;
@@ -2992,6 +2995,8 @@ PyType_FromModuleAndSpec(PyObject *module, PyType_Spec *spec, PyObject *bases)
         return NULL;
 
     type = &res->ht_type;
+    /* The flags must be initialized early, before the GC traverses us */
+    type->tp_flags = spec->flags | Py_TPFLAGS_HEAPTYPE;
     if (_PyTypeId_Allocate(&_PyRuntime.typeids, type) < 0) {
         goto fail;
     }
@@ -3012,8 +3017,6 @@ PyType_FromModuleAndSpec(PyObject *module, PyType_Spec *spec, PyObject *bases)
     else
         s++;
 
-    /* The flags must be initialized early, before the GC traverses us */
-    type->tp_flags = spec->flags | Py_TPFLAGS_HEAPTYPE;
     res->ht_name = PyUnicode_FromString(s);
     if (!res->ht_name)
         goto fail;
@@ -5338,6 +5341,7 @@ inherit_slots(PyTypeObject *type, PyTypeObject *base)
         COPYASYNC(am_await);
         COPYASYNC(am_aiter);
         COPYASYNC(am_anext);
+        COPYASYNC(am_send);
     }
 
     if (type->tp_as_sequence != NULL && base->tp_as_sequence != NULL) {
@@ -42,6 +42,7 @@ OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #include "Python.h"
 #include "pycore_abstract.h"       // _PyIndex_Check()
 #include "pycore_bytes_methods.h"
+#include "pycore_cpuinfo.h"        // _Py_cpu_features
 #include "pycore_fileutils.h"
 #include "pycore_initconfig.h"
 #include "pycore_interp.h"         // PyInterpreterState.fs_codec
@@ -4938,6 +4939,8 @@ PyUnicode_DecodeUTF8(const char *s,
 #include "stringlib/codecs.h"
 #include "stringlib/undef.h"
 
+#include "stringlib/utf8_simd.h"
+
 /* Mask to quickly check whether a C 'long' contains a
    non-ASCII, UTF8-encoded char. */
 #if (SIZEOF_LONG == 8)
@@ -5043,6 +5046,24 @@ unicode_decode_utf8(const char *s, Py_ssize_t size,
         return u;
     }
 
+#ifdef _Py_HAVE_X86_SIMD
+    // Vectorized decoder for valid input, see stringlib/utf8_simd.h.
+    if (end - s >= UTF8_SIMD_MIN_SIZE && (_Py_cpu_features & _Py_CPU_SSE41)) {
+        PyObject *result;
+        int res = utf8_simd_decode(starts, s, end, &result);
+        if (res != 0) {
+            Py_DECREF(u);
+            if (res < 0) {
+                return NULL;
+            }
+            if (consumed) {
+                *consumed = size;
+            }
+            return result;
+        }
+    }
+#endif
+
     // Use _PyUnicodeWriter after fast path is failed.
     _PyUnicodeWriter writer;
     _PyUnicodeWriter_InitWithBuffer(&writer, u);
@@ -15681,6 +15702,10 @@ _PyUnicode_Init(void)
         PyUnicode_2BYTE_KIND, linebreak,
         Py_ARRAY_LENGTH(linebreak));
 
+#ifdef _Py_HAVE_X86_SIMD
+    utf8_simd_init();
+#endif
+
     if (PyType_Ready(&EncodingMapType) < 0) {
          return _PyStatus_ERR("Can't initialize encoding map type");
     }
@@ -43,6 +43,7 @@
 #include "pycore_tupleobject.h"
 #include "pycore_qsbr.h"
 #include "pycore_dict.h"
+#include "pycore_list.h"
 
 #include "frameobject.h"
 #include "pydtrace.h"
@@ -270,8 +271,42 @@ _OWNING_REF(Register r, intptr_t tid)
 #define DISPATCH_NOTRACE() goto dispatch_notrace
 #endif
 
+#ifdef DYNAMIC_EXECUTION_PROFILE
+/* Opcode execution counts, and pair counts with -DDXPAIRS, returned (and
+   reset) by sys.getdxp(). Threads update them without synchronization, so
+   the counts are approximate when several threads run Python code. */
+#ifdef DXPAIRS
+static long dxpairs[257][256];
+#define dxp dxpairs[256]
+#define DXP_COUNT() do {                        \
+    dxpairs[lastopcode][opcode]++;              \
+    lastopcode = opcode;                        \
+    dxp[opcode]++;                              \
+} while (0)
+#else
+static long dxp[256];
+#define DXP_COUNT() dxp[opcode]++
+#endif
+#else
+#define DXP_COUNT() ((void)0)
+#endif
+
+#ifdef Py_VM_STATS
+/* Per-thread counters of a --with-vm-stats build, see sys._vm_stats() */
+#define VM_STATS (((PyThreadStateImpl *)ts)->vm_stats)
+#define STAT_OPCODE(op) VM_STATS.opcodes[op]++
+#define STAT_CALL(kind) VM_STATS.calls[_Py_VM_CALL_##kind]++
+#define STAT_CACHE(hit) vm_stats_cache_site(ts, THIS_CODE(), pc, hit)
+#else
+#define STAT_OPCODE(op) ((void)0)
+#define STAT_CALL(kind) ((void)0)
+#define STAT_CACHE(hit) ((void)0)
+#endif
+
 #define NEXT_INSTRUCTION() \
     opcode = *pc; \
+    DXP_COUNT(); \
+    STAT_OPCODE(opcode); \
     /* __asm__ volatile("# computed goto " #name); */ \
     DISPATCH_NARROW();
 
@@ -294,6 +329,18 @@ _OWNING_REF(Register r, intptr_t tid)
     pc += OP_SIZE(name);    \
     NEXT_INSTRUCTION()
 
+// Ends the first half of a superinstruction: continues directly with the
+// handler of the second instruction, which follows unchanged in the code.
+// If tracing was turned on by the first half, go through the dispatch table
+// instead so that the second instruction is traced.
+#define DISPATCH_SUPER(first, second)   \
+    pc += OP_SIZE(first);               \
+    if (UNLIKELY(ts->use_tracing)) {    \
+        NEXT_INSTRUCTION();             \
+    }                                   \
+    STAT_OPCODE(second);                \
+    goto second
+
 #define THIS_FUNC() \
     ((PyFunctionObject *)AS_OBJ(regs[-1]))
 
@@ -350,6 +397,9 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
 #endif
     const uint8_t *pc = initial_pc;
     intptr_t opcode;
+#ifdef DXPAIRS
+    intptr_t lastopcode = 0;
+#endif
     Register acc = initial_acc;
     Register *regs = ts->regs;
     PyObject **constants = THIS_CODE()->co_constants;
@@ -496,6 +546,7 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
         int err;
         assert(ts->regs == regs);
 
+        STAT_CALL(FUNCTION);
         Py_ssize_t frame_size = UImm(0);
         if (UNLIKELY(regs + frame_size > ts->maxstack)) {
             // resize the virtual stack
@@ -559,9 +610,29 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
 
         if (acc.as_int64 & ACC_MASK_KWARGS) {
             assert(!IS_RC(regs[-FRAME_EXTRA - 1]));
-            PyObject **kwnames = _PyTuple_ITEMS(AS_OBJ(regs[-FRAME_EXTRA - 1]));
+            PyObject *kwtuple = AS_OBJ(regs[-FRAME_EXTRA - 1]);
+            PyObject **kwnames = _PyTuple_ITEMS(kwtuple);
             regs[-FRAME_EXTRA - 1].as_int64 = 0;
 
+            // Same keywords as an earlier call: copy the arguments straight
+            // to their registers.
+            const Py_ssize_t *kwregs = _PyCode_FindKwMap(this_code, kwtuple);
+            if (kwregs != NULL) {
+                do {
+                    Py_ssize_t j = *kwregs++;
+                    if (UNLIKELY(regs[j].as_int64 != 0)) {
+                        FUNC_CALL_VM(duplicate_keyword_argument(ts, this_code, *kwnames));
+                        goto error;
+                    }
+                    Py_ssize_t kwdpos = -FRAME_EXTRA - ACC_KWCOUNT(acc) - 1;
+                    regs[j] = regs[kwdpos];
+                    regs[kwdpos].as_int64 = 0;
+                    acc.as_int64 -= (1 << ACC_SHIFT_KWARGS);
+                    kwnames++;
+                } while ((acc.as_int64 & ACC_MASK_KWARGS) != 0);
+                goto LABEL(setup_default_args);
+            }
+
             Py_ssize_t total_args = this_code->co_totalargcount;
             while ((acc.as_int64 & ACC_MASK_KWARGS) != 0) {
                 PyObject *keyword = *kwnames;
@@ -582,7 +653,7 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
                 if (UNLIKELY(err == -1)) {
                     goto error;
                 }
-                break;
+                goto LABEL(setup_default_args);
 
             LABEL(kw_found):
                 if (UNLIKELY(regs[j].as_int64 != 0)) {
@@ -596,6 +667,12 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
                 acc.as_int64 -= (1 << ACC_SHIFT_KWARGS);
                 kwnames++;
             }
+
+            // All keywords were found by pointer comparison: cache where
+            // they go, unless the cache is already full.
+            if (_Py_atomic_load_ptr_relaxed(&this_code->co_kwmaps[_PyCode_NKWMAPS - 1]) == NULL) {
+                FUNC_CALL_VM(vm_kwmap_add(this_code, kwtuple));
+            }
         }
 
     LABEL(setup_default_args): ;
@@ -684,6 +761,7 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
 
     #ifndef WIDE_OP
     TARGET(METHOD_HEADER) {
+        STAT_CALL(METHOD);
         PyMethodObject *meth = (PyMethodObject *)AS_OBJ(regs[-1]);
         if ((acc.as_int64 & ACC_FLAG_VARARGS) != 0) {
             // TODO: would be nice to only use below case by handling hybrid call formats.
@@ -723,6 +801,7 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
     }
 
     TARGET(CFUNC_HEADER) {
+        STAT_CALL(CFUNCTION);
         PyObject *res;
         regs[-2].as_int64 = ACC_ARGCOUNT(acc);  // frame size
         if (LIKELY(acc.as_int64 < 8)) {
@@ -883,6 +962,134 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
         NEXT_INSTRUCTION();
     }
 
+    TARGET(CMETHOD_LIST_APPEND) {
+        // list.append(x): takes the list's lock here instead of calling
+        // through the method descriptor. Builtin types are immutable, so
+        // the exact type check is the only guard needed.
+        if (UNLIKELY(acc.as_int64 != 2)) {
+            goto LABEL(CFUNC_HEADER);
+        }
+
+        PyObject *self = AS_OBJ(regs[0]);
+        if (UNLIKELY(!PyList_CheckExact(self))) {
+            goto LABEL(CFUNC_HEADER);
+        }
+
+        PyListObject *list = (PyListObject *)self;
+        PyObject *item = AS_OBJ(regs[1]);
+        struct _Py_critical_section cs;
+        int err = 0;
+
+        regs[-2].as_int64 = 2;
+        CALL_VM(_Py_critical_section_begin(&cs, &list->mutex));
+        Py_ssize_t n = Py_SIZE(list);
+        if (LIKELY(n < list->allocated)) {
+            Py_INCREF(item);
+            list->ob_item[n] = item;
+            Py_SET_SIZE(list, n + 1);
+        }
+        else {
+            CALL_VM(err = _PyList_AppendPrivate(self, item));
+        }
+        _Py_critical_section_end(&cs);
+        if (UNLIKELY(err != 0)) {
+            acc.as_int64 = 0;
+            goto error;
+        }
+        acc = PACK(Py_None, NO_REFCOUNT_TAG);
+        CLEAR_REGISTERS(-1, 2);
+        pc = (const uint8_t *)regs[-3].as_int64;
+        intptr_t frame_delta = regs[-4].as_int64;
+        regs[-2].as_int64 = 0;
+        regs[-3].as_int64 = 0;
+        regs[-4].as_int64 = 0;
+        regs -= frame_delta;
+        ts->regs = regs;
+        CHECK_EVAL_BREAKER();
+        NEXT_INSTRUCTION();
+    }
+
+    TARGET(CMETHOD_DICT_GET) {
+        // dict.get(key[, default]) without argument clinic parsing
+        if (UNLIKELY(acc.as_int64 != 2 && acc.as_int64 != 3)) {
+            goto LABEL(CFUNC_HEADER);
+        }
+
+        PyObject *self = AS_OBJ(regs[0]);
+        if (UNLIKELY(!PyDict_CheckExact(self))) {
+            goto LABEL(CFUNC_HEADER);
+        }
+
+        PyObject *res;
+        regs[-2].as_int64 = acc.as_int64;
+        CALL_VM(res = PyDict_GetItemWithError2(self, AS_OBJ(regs[1])));
+        if (res != NULL) {
+            acc = PACK_OBJ(res);
+        }
+        else if (UNLIKELY(_PyErr_Occurred(ts) != NULL)) {
+            acc.as_int64 = 0;
+            goto error;
+        }
+        else if (regs[-2].as_int64 == 3) {
+            acc = PACK_INCREF(AS_OBJ(regs[2]));
+        }
+        else {
+            acc = PACK(Py_None, NO_REFCOUNT_TAG);
+        }
+        CLEAR_REGISTERS(-1, regs[-2].as_int64);
+        pc = (const uint8_t *)regs[-3].as_int64;
+        intptr_t frame_delta = regs[-4].as_int64;
+        regs[-2].as_int64 = 0;
+        regs[-3].as_int64 = 0;
+        regs[-4].as_int64 = 0;
+        regs -= frame_delta;
+        ts->regs = regs;
+        CHECK_EVAL_BREAKER();
+        NEXT_INSTRUCTION();
+    }
+
+    TARGET(CFUNC_LEN) {
+        if (UNLIKELY(acc.as_int64 != 1)) {
+            goto LABEL(CFUNC_HEADER);
+        }
+
+        PyObject *obj = AS_OBJ(regs[0]);
+        PyObject *res;
+        Py_ssize_t n;
+
+        regs[-2].as_int64 = 1;
+        if (PyList_CheckExact(obj)) {
+            n = _Py_atomic_load_ssize_relaxed(&Py_SIZE(obj));
+        }
+        else if (PyTuple_CheckExact(obj)) {
+            n = Py_SIZE(obj);
+        }
+        else {
+            CALL_VM(n = PyObject_Size(obj));
+            if (UNLIKELY(n < 0)) {
+                acc.as_int64 = 0;
+                goto error;
+            }
+        }
+        CALL_VM(res = PyLong_FromSsize_t(n));
+        if (UNLIKELY(res == NULL)) {
+            acc.as_int64 = 0;
+            goto error;
+        }
+        acc = PACK_OBJ(res);
+        CLEAR(regs[0]);
+        CLEAR(regs[-1]);
+        pc = (const uint8_t *)regs[-3].as_int64;
+        intptr_t frame_delta = regs[-4].as_int64;
+        regs[-2].as_int64 = 0;
+        regs[-3].as_int64 = 0;
+        regs[-4].as_int64 = 0;
+        regs -= frame_delta;
+        ts->regs = regs;
+        CHECK_EVAL_BREAKER();
+        NEXT_INSTRUCTION();
+    }
+
     TARGET(FUNC_TPCALL_HEADER) {
         PyObject *res;
         regs[-2].as_int64 = ACC_ARGCOUNT(acc);  // frame size
@@ -977,6 +1184,7 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
     #ifndef WIDE_OP
     call_object: {
         // DEBUG_LABEL(call_object);
+        STAT_CALL(OBJECT);
         regs[-2].as_int64 = ACC_ARGCOUNT(acc);  // frame size
         PyObject *res;
         CALL_VM(res = vm_call_function(ts, acc));
@@ -1048,6 +1256,7 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
     #ifndef WIDE_OP
     call_object_ex: {
         // DEBUG_LABEL(call_object_ex);
+        STAT_CALL(OBJECT_EX);
         assert(regs[-2].as_int64 == 0 && "frame size not zero");
         PyObject *callable = AS_OBJ(regs[-1]);
         PyObject *args = AS_OBJ(regs[-FRAME_EXTRA - 2]);
@@ -1084,22 +1293,25 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
     }
 
     #define IMPL_YIELD_FROM(awaitable, res) do {                                \
-        CALL_VM(res = _PyGen_YieldFrom(                                         \
-            PyGen_FromThread(ts->active), awaitable, AS_OBJ(acc)));             \
-        if (res != NULL) {                                                      \
+        PySendResult status;                                                    \
+        CALL_VM(status = _PyGen_YieldFrom(                                      \
+            PyGen_FromThread(ts->active), awaitable, AS_OBJ(acc), &res));       \
+        if (status == PYGEN_NEXT) {                                             \
             SET_ACC(PACK_OBJ(res));                                             \
             PyGenObject *gen = PyGen_FromThread(ts->active);                    \
             gen->status = GEN_SUSPENDED;                                        \
             ts->pc = pc;  /* will resume with YIELD_FROM */                     \
             goto exit_maybe_trace;                                              \
         }                                                                       \
-        if (UNLIKELY(ts->use_tracing)) {                                        \
-            CALL_VM(vm_trace_stop_iteration(ts));                               \
-        }                                                                       \
-        CALL_VM(res = _PyGen_FetchStopIterationValue2());                       \
-        if (UNLIKELY(res == NULL)) {                                            \
+        if (UNLIKELY(status == PYGEN_ERROR)) {                                  \
             goto error;                                                         \
         }                                                                       \
+        if (UNLIKELY(ts->use_tracing)) {                                        \
+            CALL_VM(res = vm_trace_stop_iteration(ts, res));                    \
+            if (UNLIKELY(res == NULL)) {                                        \
+                goto error;                                                     \
+            }                                                                   \
+        }                                                                       \
     } while (0)
     #endif
 
@@ -1194,6 +1406,7 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
         probe = dict_probe((PyDictObject *)globals, name, guess, tid);
         acc = probe.acc;
         if (LIKELY(probe.found)) {
+            STAT_CACHE(1);
             goto LABEL(dispatch_load_global);
         }
         goto LABEL(load_global_slow);
@@ -1209,6 +1422,7 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
         probe = dict_probe((PyDictObject *)builtins, name, guess, tid);
         acc = probe.acc;
         if (LIKELY(probe.found)) {
+            STAT_CACHE(1);
             goto LABEL(dispatch_load_global);
         }
         // fallthrough to load_global_slow
@@ -1216,6 +1430,7 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
 
     LABEL(load_global_slow): {
         PyObject *value;
+        STAT_CACHE(0);
         CALL_VM(value = vm_load_global(ts, constants[UImm(0)], &metadata[SImm(1)]));
         if (UNLIKELY(value == NULL)) {
             goto error;
@@ -1253,12 +1468,14 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
             probe = dict_probe((PyDictObject *)dict, name, guess, tid);
             acc = probe.acc;
             if (probe.found) {
+                STAT_CACHE(1);
                 DISPATCH(LOAD_ATTR);
             }
         }
 
         CALL_VM(res = vm_try_load(dict, name, &metadata[metaidx]));
         if (res != NULL) {
+            STAT_CACHE(0);
             XSET_ACC(PACK_OBJ(res));
             DISPATCH(LOAD_ATTR);
         }
@@ -1268,6 +1485,7 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
         name = constants[UImm(1)];
 
     LABEL(load_attr_slow):
+        STAT_CACHE(0);
         CALL_VM(res = PyObject_GetAttr(owner, name));
         if (UNLIKELY(res == NULL)) {
             goto error;
@@ -1310,6 +1528,7 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
                 probe = dict_probe((PyDictObject *)dict, name, guess, tid);
                 // FIXME(sgross): decref probe.acc on failure!!
                 if (probe.found) {
+                    STAT_CACHE(1);
                     regs[UImm(0)] = probe.acc;
                     DECREF(acc);
                     acc.as_int64 = 0;
@@ -1317,8 +1536,10 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
                 }
             }
             else if ((uint64_t)(-guess) == _PyDict_VersionTag(dict)) {
+                STAT_CACHE(1);
                 goto LABEL(lookup_type);
             }
+            STAT_CACHE(0);
             CALL_VM(res = vm_try_load(dict, name, &metadata[SImm(2)]));
         }
         else {
@@ -1547,6 +1768,67 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
     }
 
     #ifndef WIDE_OP
+    TARGET(STORE_FAST__LOAD_FAST) {
+        intptr_t dst = UImm(0);
+        Register prev = regs[dst];
+        regs[dst] = acc;
+        acc.as_int64 = 0;
+        if (prev.as_int64) {
+            DECREF(prev);
+        }
+        DISPATCH_SUPER(STORE_FAST, LOAD_FAST);
+    }
+
+    TARGET(STORE_FAST__LOAD_CONST) {
+        intptr_t dst = UImm(0);
+        Register prev = regs[dst];
+        regs[dst] = acc;
+        acc.as_int64 = 0;
+        if (prev.as_int64) {
+            DECREF(prev);
+        }
+        DISPATCH_SUPER(STORE_FAST, LOAD_CONST);
+    }
+
+    TARGET(LOAD_CONST__STORE_FAST) {
+        acc = PACK(constants[UImm(0)], NO_REFCOUNT_TAG);
+        DISPATCH_SUPER(LOAD_CONST, STORE_FAST);
+    }
+
+    TARGET(COMPARE__POP_JUMP_IF_FALSE) {
+        int cmp = UImm(0);
+        assert(cmp <= Py_GE);
+        PyObject *left = AS_OBJ(regs[UImm(1)]);
+        if (UNLIKELY(left == NULL)) {
+            goto LABEL(unbound_local_error1);
+        }
+        PyObject *right = AS_OBJ(acc);
+        PyObject *res;
+        CALL_VM(res = PyObject_RichCompare(left, right, cmp));
+        if (UNLIKELY(res == NULL)) {
+            goto error;
+        }
+        SET_ACC(PACK_OBJ(res));
+        DISPATCH_SUPER(COMPARE_OP, POP_JUMP_IF_FALSE);
+    }
+
+    TARGET(COMPARE__POP_JUMP_IF_TRUE) {
+        int cmp = UImm(0);
+        assert(cmp <= Py_GE);
+        PyObject *left = AS_OBJ(regs[UImm(1)]);
+        if (UNLIKELY(left == NULL)) {
+            goto LABEL(unbound_local_error1);
+        }
+        PyObject *right = AS_OBJ(acc);
+        PyObject *res;
+        CALL_VM(res = PyObject_RichCompare(left, right, cmp));
+        if (UNLIKELY(res == NULL)) {
+            goto error;
+        }
+        SET_ACC(PACK_OBJ(res));
+        DISPATCH_SUPER(COMPARE_OP, POP_JUMP_IF_TRUE);
+    }
+
     TARGET(CLEAR_ACC) {
         // CLEAR_ACC
         // Clears the accumulator.
@@ -2809,6 +3091,9 @@ _PyEval_Fast(PyThreadState *ts, Register initial_acc, const uint8_t *initial_pc)
             [CFUNC_HEADER_O] = 1,
             [CMETHOD_O] = 1,
             [CMETHOD_NOARGS] = 1,
+            [CMETHOD_LIST_APPEND] = 1,
+            [CMETHOD_DICT_GET] = 1,
+            [CFUNC_LEN] = 1,
             [FUNC_TPCALL_HEADER] = 1,
         };
         if (trace_cfunc[opcode]) {
@@ -3016,4 +3301,51 @@ dict_probe(PyDictObject *dict, PyObject *name, intptr_t guess, intptr_t tid)
     }
     return result;
 }
+
+#ifdef DYNAMIC_EXECUTION_PROFILE
+// These use Py_DecRef() because Py_DECREF is redefined above to use the
+// interpreter's local variables.
+static PyObject *
+getarray(long a[256])
+{
+    PyObject *l = PyList_New(256);
+    if (l == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < 256; i++) {
+        PyObject *x = PyLong_FromLong(a[i]);
+        if (x == NULL) {
+            Py_DecRef(l);
+            return NULL;
+        }
+        PyList_SET_ITEM(l, i, x);
+    }
+    for (int i = 0; i < 256; i++) {
+        a[i] = 0;
+    }
+    return l;
+}
+
+PyObject *
+_Py_GetDXProfile(PyObject *self, PyObject *args)
+{
+#ifndef DXPAIRS
+    return getarray(dxp);
+#else
+    PyObject *l = PyList_New(257);
+    if (l == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < 257; i++) {
+        PyObject *x = getarray(dxpairs[i]);
+        if (x == NULL) {
+            Py_DecRef(l);
+            return NULL;
+        }
+        PyList_SET_ITEM(l, i, x);
+    }
+    return l;
+#endif
+}
+#endif
 #endif // WIDE_OP
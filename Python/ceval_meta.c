@@ -11,6 +11,7 @@
 #include "pycore_ceval.h"
 #include "pycore_code.h"
 #include "pycore_generator.h"
+#include "pycore_hashtable.h"
 #include "pycore_object.h"
 #include "pycore_pyerrors.h"
 #include "pycore_pylifecycle.h"
@@ -1321,6 +1322,34 @@ vm_call_cfunction(PyThreadState *ts, Register acc)
     return func->vectorcall(args[0], args + 1, nargsf, NULL);
 }
 
+static const uint8_t cmethod_list_append = CMETHOD_LIST_APPEND;
+static const uint8_t cmethod_dict_get = CMETHOD_DICT_GET;
+static const uint8_t cfunc_len = CFUNC_LEN;
+
+static void
+specialize_method(PyTypeObject *type, const char *name, const uint8_t *header)
+{
+    PyObject *descr = PyDict_GetItemString(type->tp_dict, name);
+    if (descr != NULL && Py_IS_TYPE(descr, &PyMethodDescr_Type)) {
+        ((PyFuncBase *)descr)->first_instr = header;
+    }
+}
+
+/* Gives a few hot builtins headers that run them inline in the
+   interpreter loop (see CMETHOD_LIST_APPEND in ceval.c). The headers check
+   their argument types and fall back to CFUNC_HEADER. */
+void
+vm_specialize_builtins(PyObject *builtins)
+{
+    specialize_method(&PyList_Type, "append", &cmethod_list_append);
+    specialize_method(&PyDict_Type, "get", &cmethod_dict_get);
+
+    PyObject *len = PyDict_GetItemString(builtins, "len");
+    if (len != NULL && PyCFunction_CheckExact(len)) {
+        ((PyFuncBase *)len)->first_instr = &cfunc_len;
+    }
+}
+
 PyObject *
 vm_call_function(PyThreadState *ts, Register acc)
 {
@@ -1918,6 +1947,58 @@ vm_setup_varargs(PyThreadState *ts, PyCodeObject *co, Register acc)
     return 0;
 }
 
+// Caches the registers of the keywords in kwnames for calls to co. Later
+// calls with the same kwnames tuple use them instead of searching
+// co_varnames (see FUNC_HEADER).
+void
+vm_kwmap_add(PyCodeObject *co, PyObject *kwnames)
+{
+    if (!_PyObject_IS_IMMORTAL(kwnames)) {
+        // Not an interned constant (e.g., built by a vectorcall caller):
+        // its address may later be reused for a different tuple.
+        return;
+    }
+
+    Py_ssize_t n = PyTuple_GET_SIZE(kwnames);
+    struct _PyKwMap *map;
+    map = PyMem_RawMalloc(sizeof(*map) + n * sizeof(Py_ssize_t));
+    if (map == NULL) {
+        return;
+    }
+    map->kwnames = kwnames;
+
+    Py_ssize_t total_args = co->co_totalargcount;
+    for (Py_ssize_t i = 0; i < n; i++) {
+        PyObject *keyword = PyTuple_GET_ITEM(kwnames, i);
+        Py_ssize_t j;
+        for (j = co->co_posonlyargcount; j < total_args; j++) {
+            if (PyTuple_GET_ITEM(co->co_varnames, j) == keyword) {
+                break;
+            }
+        }
+        if (j == total_args) {
+            // goes to **kwargs or isn't interned: not cached
+            PyMem_RawFree(map);
+            return;
+        }
+        map->regs[i] = j;
+    }
+
+    // Entries are filled in order and are only freed with the code object,
+    // so _PyCode_FindKwMap() just needs an atomic load.
+    for (int i = 0; i < _PyCode_NKWMAPS; i++) {
+        if (_Py_atomic_compare_exchange_ptr(&co->co_kwmaps[i], NULL, map)) {
+            return;
+        }
+        struct _PyKwMap *other = _Py_atomic_load_ptr(&co->co_kwmaps[i]);
+        if (other->kwnames == kwnames) {
+            // added concurrently by another thread
+            break;
+        }
+    }
+    PyMem_RawFree(map);
+}
+
 int
 vm_setup_kwargs(PyThreadState *ts, PyCodeObject *co, Register acc, PyObject **kwnames)
 {
@@ -2363,9 +2444,256 @@ vm_resize_stack(PyThreadState *tstate, Py_ssize_t needed)
     ts->maxstack = tstate->maxstack;
 
     memset(newstack + oldsize, 0, (newsize - oldsize) * sizeof(Register));
+#ifdef Py_VM_STATS
+    ((PyThreadStateImpl *)tstate)->vm_stats.resize_stack++;
+#endif
     return 0;
 }
 
+#ifdef Py_VM_STATS
+struct _Py_vm_cache_site {
+    PyCodeObject *code;     // strong reference, keeps the pc key valid
+    uint64_t hits;
+    uint64_t misses;
+};
+
+static void
+vm_stats_free_site(void *ptr)
+{
+    struct _Py_vm_cache_site *site = (struct _Py_vm_cache_site *)ptr;
+    Py_DECREF(site->code);
+    PyMem_RawFree(site);
+}
+
+static struct _Py_vm_cache_site *
+vm_stats_find_site(_Py_hashtable_t **sites, PyCodeObject *code,
+                   const uint8_t *pc)
+{
+    if (*sites == NULL) {
+        *sites = _Py_hashtable_new_full(_Py_hashtable_hash_ptr,
+                                        _Py_hashtable_compare_direct,
+                                        NULL, vm_stats_free_site, NULL);
+        if (*sites == NULL) {
+            return NULL;
+        }
+    }
+    struct _Py_vm_cache_site *site = _Py_hashtable_get(*sites, pc);
+    if (site == NULL) {
+        site = PyMem_RawCalloc(1, sizeof(*site));
+        if (site == NULL) {
+            return NULL;
+        }
+        if (_Py_hashtable_set(*sites, pc, site) < 0) {
+            PyMem_RawFree(site);
+            return NULL;
+        }
+        Py_INCREF(code);
+        site->code = code;
+    }
+    return site;
+}
+
+void
+vm_stats_cache_site(PyThreadState *ts, PyCodeObject *code,
+                    const uint8_t *pc, int hit)
+{
+    struct _Py_vm_stats *stats = &((PyThreadStateImpl *)ts)->vm_stats;
+    struct _Py_vm_cache_site *site;
+    site = vm_stats_find_site(&stats->cache_sites, code, pc);
+    if (site == NULL) {
+        // out of memory: the access just isn't counted
+        return;
+    }
+    if (hit) {
+        site->hits++;
+    }
+    else {
+        site->misses++;
+    }
+}
+
+static int
+vm_stats_add_site(_Py_hashtable_t *ht, const void *key, const void *value,
+                  void *arg)
+{
+    const struct _Py_vm_cache_site *src = value;
+    struct _Py_vm_cache_site *dst;
+    dst = vm_stats_find_site((_Py_hashtable_t **)arg, src->code, key);
+    if (dst != NULL) {
+        dst->hits += src->hits;
+        dst->misses += src->misses;
+    }
+    return 0;
+}
+
+static void
+vm_stats_add(struct _Py_vm_stats *dst, const struct _Py_vm_stats *src)
+{
+    for (int i = 0; i < 256; i++) {
+        dst->opcodes[i] += src->opcodes[i];
+    }
+    for (int i = 0; i < _Py_VM_CALL_KINDS; i++) {
+        dst->calls[i] += src->calls[i];
+    }
+    dst->resize_stack += src->resize_stack;
+    if (src->cache_sites != NULL) {
+        _Py_hashtable_foreach(src->cache_sites, vm_stats_add_site,
+                              &dst->cache_sites);
+    }
+}
+
+static void
+vm_stats_reset(struct _Py_vm_stats *stats)
+{
+    if (stats->cache_sites != NULL) {
+        _Py_hashtable_destroy(stats->cache_sites);
+    }
+    memset(stats, 0, sizeof(*stats));
+}
+
+// Called from PyThreadState_Clear(): adds the thread's counters to the
+// interpreter's.
+void
+vm_stats_merge(PyThreadState *tstate)
+{
+    PyInterpreterState *interp = tstate->interp;
+    struct _Py_vm_stats *stats = &((PyThreadStateImpl *)tstate)->vm_stats;
+
+    // We only lock the mutex if not called from garbage collection
+    int do_lock = !_PyRuntime.stop_the_world;
+    if (do_lock) {
+        _PyMutex_lock(&interp->vm_stats_mutex);
+    }
+    vm_stats_add(&interp->vm_stats, stats);
+    if (do_lock) {
+        _PyMutex_unlock(&interp->vm_stats_mutex);
+    }
+    vm_stats_reset(stats);
+}
+
+void
+vm_stats_clear(PyInterpreterState *interp)
+{
+    vm_stats_reset(&interp->vm_stats);
+}
+
+static int
+vm_stats_site_to_dict(_Py_hashtable_t *ht, const void *key,
+                      const void *value, void *arg)
+{
+    const struct _Py_vm_cache_site *site = value;
+    PyCodeObject *code = site->code;
+    const uint8_t *pc = key;
+    int addr = (int)(pc - PyCode_FirstInstr(code));
+    int opcode = (pc[0] == WIDE ? pc[1] : pc[0]);
+
+    PyObject *k = Py_BuildValue("(OOiis)", code->co_filename, code->co_name,
+                                PyCode_Addr2Line(code, addr), addr,
+                                opcode_names[opcode]);
+    if (k == NULL) {
+        return -1;
+    }
+    PyObject *v = Py_BuildValue("(KK)", (unsigned long long)site->hits,
+                                (unsigned long long)site->misses);
+    if (v == NULL) {
+        Py_DECREF(k);
+        return -1;
+    }
+    int err = PyDict_SetItem((PyObject *)arg, k, v);
+    Py_DECREF(k);
+    Py_DECREF(v);
+    return err;
+}
+
+static int
+vm_stats_set_count(PyObject *dict, const char *key, uint64_t count)
+{
+    PyObject *v = PyLong_FromUnsignedLongLong(count);
+    if (v == NULL) {
+        return -1;
+    }
+    int err = PyDict_SetItemString(dict, key, v);
+    Py_DECREF(v);
+    return err;
+}
+
+static PyObject *
+vm_stats_as_dict(const struct _Py_vm_stats *stats)
+{
+    static const char *call_kinds[_Py_VM_CALL_KINDS] = {
+        [_Py_VM_CALL_FUNCTION] = "function",
+        [_Py_VM_CALL_METHOD] = "method",
+        [_Py_VM_CALL_CFUNCTION] = "cfunction",
+        [_Py_VM_CALL_OBJECT] = "object",
+        [_Py_VM_CALL_OBJECT_EX] = "object_ex",
+    };
+    PyObject *opcodes = NULL, *calls = NULL, *cache = NULL;
+    PyObject *res = NULL;
+
+    opcodes = PyDict_New();
+    if (opcodes == NULL) {
+        goto exit;
+    }
+    for (int i = 0; i < 256; i++) {
+        if (stats->opcodes[i] != 0 &&
+            vm_stats_set_count(opcodes, opcode_names[i], stats->opcodes[i]) < 0) {
+            goto exit;
+        }
+    }
+
+    calls = PyDict_New();
+    if (calls == NULL) {
+        goto exit;
+    }
+    for (int i = 0; i < _Py_VM_CALL_KINDS; i++) {
+        if (vm_stats_set_count(calls, call_kinds[i], stats->calls[i]) < 0) {
+            goto exit;
+        }
+    }
+
+    cache = PyDict_New();
+    if (cache == NULL) {
+        goto exit;
+    }
+    if (stats->cache_sites != NULL &&
+        _Py_hashtable_foreach(stats->cache_sites, vm_stats_site_to_dict,
+                              cache) < 0) {
+        goto exit;
+    }
+
+    res = Py_BuildValue("{sOsOsOsK}",
+                        "opcodes", opcodes,
+                        "calls", calls,
+                        "cache", cache,
+                        "resize_stack",
+                        (unsigned long long)stats->resize_stack);
+exit:
+    Py_XDECREF(opcodes);
+    Py_XDECREF(calls);
+    Py_XDECREF(cache);
+    return res;
+}
+
+// sys._vm_stats(): counters of the exited threads and the calling thread
+PyObject *
+vm_stats_get(PyObject *self, PyObject *unused)
+{
+    PyThreadState *tstate = _PyThreadState_GET();
+    PyInterpreterState *interp = tstate->interp;
+    struct _Py_vm_stats total;
+    memset(&total, 0, sizeof(total));
+
+    _PyMutex_lock(&interp->vm_stats_mutex);
+    vm_stats_add(&total, &interp->vm_stats);
+    _PyMutex_unlock(&interp->vm_stats_mutex);
+    vm_stats_add(&total, &((PyThreadStateImpl *)tstate)->vm_stats);
+
+    PyObject *res = vm_stats_as_dict(&total);
+    vm_stats_reset(&total);
+    return res;
+}
+#endif  /* Py_VM_STATS */
+
 static int
 vm_init_stack(struct _PyThreadStack *ts, Py_ssize_t stack_size)
 {
@@ -2381,6 +2709,8 @@ vm_init_stack(struct _PyThreadStack *ts, Py_ssize_t stack_size)
     return 0;
 }
 
+#define INITIAL_STACK_SIZE 256
+
 struct _PyThreadStack *
 vm_new_threadstate(PyThreadState *tstate)
 {
@@ -2390,8 +2720,7 @@ vm_new_threadstate(PyThreadState *tstate)
     }
     memset(ts, 0, sizeof(struct _PyThreadStack));
 
-    Py_ssize_t stack_size = 256;
-    if (UNLIKELY(vm_init_stack(ts, stack_size) != 0)) {
+    if (UNLIKELY(vm_init_stack(ts, INITIAL_STACK_SIZE) != 0)) {
         PyMem_RawFree(ts);
         return NULL;
     }
@@ -2414,6 +2743,23 @@ vm_free_threadstate(struct _PyThreadStack *ts)
     ts->stack = ts->regs = ts->maxstack = NULL;
 }
 
+// Resets the stack of a deleted thread state so that a new thread state can
+// reuse it. Returns -1 if the stack is still in use or grew past its initial
+// size: it's not worth keeping around then.
+int
+vm_reset_threadstate(struct _PyThreadStack *ts)
+{
+    if (ts->prev != NULL || ts->regs != ts->stack ||
+        ts->maxstack != ts->stack + INITIAL_STACK_SIZE - PY_STACK_EXTRA) {
+        return -1;
+    }
+    memset(ts->stack, 0, INITIAL_STACK_SIZE * sizeof(Register));
+    ts->pc = NULL;
+    ts->ts = NULL;
+    ts->gc_visited = 0;
+    return 0;
+}
+
 void
 vm_push_thread_stack(PyThreadState *tstate, struct _PyThreadStack *ts)
 {
@@ -2469,14 +2815,27 @@ vm_for_iter_exc(PyThreadState *ts)
     return 0;
 }
 
-void
-vm_trace_stop_iteration(PyThreadState *ts)
+// Reports the StopIteration that ends a traced "yield from". The return
+// value is passed back without an exception, so the StopIteration is only
+// created here when there is a trace function. Steals "value".
+PyObject *
+vm_trace_stop_iteration(PyThreadState *ts, PyObject *value)
 {
     PyThreadState *tstate = ts;
-    if (_PyErr_ExceptionMatches(tstate, PyExc_StopIteration) &&
-        tstate->c_tracefunc != NULL) {
-        vm_trace_active_exc(ts);
+    if (tstate->c_tracefunc == NULL) {
+        return value;
+    }
+    int err = _PyGen_SetStopIterationValue(value);
+    Py_DECREF(value);
+    if (err < 0) {
+        return NULL;
     }
+    vm_trace_active_exc(ts);
+    value = NULL;
+    if (_PyGen_FetchStopIterationValue(&value) < 0) {
+        return NULL;
+    }
+    return value;
 }
 
 int
@@ -4348,6 +4707,11 @@ _PyEval_HandleBreaker(PyThreadState *tstate)
         }
     }
 
+    if ((b & EVAL_HANDSHAKE) != 0) {
+        _PyThreadState_Unsignal(tstate, EVAL_HANDSHAKE);
+        _PyThreadState_HandleHandshake(tstate);
+    }
+
     if ((b & EVAL_EXPLICIT_MERGE) != 0) {
         _PyThreadState_Unsignal(tstate, EVAL_EXPLICIT_MERGE);
         _Py_queue_process(tstate);
@@ -4429,6 +4793,9 @@ update_use_tracing(PyThreadState *tstate)
         [CFUNC_HEADER_O] = 1,
         [CMETHOD_O] = 1,
         [CMETHOD_NOARGS] = 1,
+        [CMETHOD_LIST_APPEND] = 1,
+        [CMETHOD_DICT_GET] = 1,
+        [CFUNC_LEN] = 1,
         [FUNC_TPCALL_HEADER] = 1,
     };
 
@@ -485,6 +485,78 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_imp__snapshot_code__doc__,
+"_snapshot_code($module, path, mtime, size, /)\n"
+"--\n"
+"\n"
+"Return the code object of a source file from the bytecode snapshot.\n"
+"\n"
+"Return None if there is no snapshot, if it has no code for the file, or\n"
+"if the file changed since the snapshot was written.");
+
+#define _IMP__SNAPSHOT_CODE_METHODDEF    \
+    {"_snapshot_code", (PyCFunction)(void(*)(void))_imp__snapshot_code, METH_FASTCALL, _imp__snapshot_code__doc__},
+
+static PyObject *
+_imp__snapshot_code_impl(PyObject *module, PyObject *path, long long mtime,
+                         long long size);
+
+static PyObject *
+_imp__snapshot_code(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *path;
+    long long mtime;
+    long long size;
+
+    if (!_PyArg_CheckPositional("_snapshot_code", nargs, 3, 3)) {
+        goto exit;
+    }
+    if (!PyUnicode_Check(args[0])) {
+        _PyArg_BadArgument("_snapshot_code", "argument 1", "str", args[0]);
+        goto exit;
+    }
+    if (PyUnicode_READY(args[0]) == -1) {
+        goto exit;
+    }
+    path = args[0];
+    if (PyFloat_Check(args[1])) {
+        PyErr_SetString(PyExc_TypeError,
+                        "integer argument expected, got float" );
+        goto exit;
+    }
+    mtime = PyLong_AsLongLong(args[1]);
+    if (mtime == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (PyFloat_Check(args[2])) {
+        PyErr_SetString(PyExc_TypeError,
+                        "integer argument expected, got float" );
+        goto exit;
+    }
+    size = PyLong_AsLongLong(args[2]);
+    if (size == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = _imp__snapshot_code_impl(module, path, mtime, size);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_imp__snapshot_dumps__doc__,
+"_snapshot_dumps($module, entries, /)\n"
+"--\n"
+"\n"
+"Return the contents of a bytecode snapshot file.\n"
+"\n"
+"entries is a sequence of (source path, mtime, size, code) tuples.  The\n"
+"snapshot is only valid for this build of Python and the current\n"
+"optimization level.");
+
+#define _IMP__SNAPSHOT_DUMPS_METHODDEF    \
+    {"_snapshot_dumps", (PyCFunction)_imp__snapshot_dumps, METH_O, _imp__snapshot_dumps__doc__},
+
 #ifndef _IMP_CREATE_DYNAMIC_METHODDEF
     #define _IMP_CREATE_DYNAMIC_METHODDEF
 #endif /* !defined(_IMP_CREATE_DYNAMIC_METHODDEF) */
@@ -492,4 +564,4 @@ exit:
 #ifndef _IMP_EXEC_DYNAMIC_METHODDEF
     #define _IMP_EXEC_DYNAMIC_METHODDEF
 #endif /* !defined(_IMP_EXEC_DYNAMIC_METHODDEF) */
-/*[clinic end generated code: output=ad3aa4964e8ac26f input=a9049054013a1b77]*/
+/*[clinic end generated code: output=b6f29bc586d208de input=a9049054013a1b77]*/
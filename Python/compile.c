@@ -5297,6 +5297,52 @@ cmp_jump_entries(const void *a, const void *b)
     return 0;
 }
 
+// Replaces the opcode of the first instruction of common pairs with a
+// superinstruction that also executes the second one without going through
+// the dispatch table. The second instruction is left in place, so jumps to it,
+// line numbers and exception handlers are unaffected.
+static void
+fuse_superinstructions(struct compiler *c)
+{
+    static const uint8_t sizes[256] = {
+#define OP_SIZES(Name, Code, Size, WideSize) \
+        [Code] = Size, [128 + Code] = WideSize,
+        OPCODE_LIST(OP_SIZES)
+#undef OP_SIZES
+    };
+    uint8_t *code = c->unit->instr.arr;
+    Py_ssize_t n = c->unit->instr.offset;
+    Py_ssize_t i = 0;
+    while (i < n) {
+        int opcode = code[i];
+        if (opcode == WIDE) {
+            i += sizes[128 + code[i + 1]];
+            continue;
+        }
+        Py_ssize_t next = i + sizes[opcode];
+        assert(next > i);
+        if (next < n) {
+            int next_opcode = code[next];
+            if (opcode == STORE_FAST && next_opcode == LOAD_FAST) {
+                code[i] = STORE_FAST__LOAD_FAST;
+            }
+            else if (opcode == STORE_FAST && next_opcode == LOAD_CONST) {
+                code[i] = STORE_FAST__LOAD_CONST;
+            }
+            else if (opcode == LOAD_CONST && next_opcode == STORE_FAST) {
+                code[i] = LOAD_CONST__STORE_FAST;
+            }
+            else if (opcode == COMPARE_OP && next_opcode == POP_JUMP_IF_FALSE) {
+                code[i] = COMPARE__POP_JUMP_IF_FALSE;
+            }
+            else if (opcode == COMPARE_OP && next_opcode == POP_JUMP_IF_TRUE) {
+                code[i] = COMPARE__POP_JUMP_IF_TRUE;
+            }
+        }
+        i = next;
+    }
+}
+
 static PyCodeObject *
 makecode(struct compiler *c)
 {
@@ -5340,6 +5386,7 @@ makecode(struct compiler *c)
     co->co_firstlineno = c->unit->firstlineno;
     co->co_lnotab = PyBytes_FromStringAndSize("", 0);
 
+    fuse_superinstructions(c);
     uint8_t *code = PyCode_FirstInstr(co);
     memcpy(code, header, header_size);
     memcpy(code + header_size, c->unit->instr.arr, c->unit->instr.offset);
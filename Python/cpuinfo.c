@@ -0,0 +1,50 @@
+/* Detection of the instruction set extensions of the CPU,
+   see Include/internal/pycore_cpuinfo.h */
+
+#include "Python.h"
+#include "pycore_cpuinfo.h"
+
+#if defined(_Py_HAVE_X86_SIMD) && defined(_MSC_VER)
+#  include <intrin.h>               // __cpuid(), _xgetbv()
+#endif
+
+int _Py_cpu_features = 0;
+
+void
+_Py_InitCpuFeatures(void)
+{
+    int features = 0;
+#ifdef _Py_HAVE_X86_SIMD
+    features |= _Py_CPU_SSE2;
+#endif
+#if defined(_Py_HAVE_X86_SIMD) && !defined(_MSC_VER)
+    /* The compiler's runtime also checks that the OS saves the AVX
+       registers */
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("ssse3") && __builtin_cpu_supports("sse4.1")) {
+        features |= _Py_CPU_SSE41;
+        if (__builtin_cpu_supports("avx2")) {
+            features |= _Py_CPU_AVX2;
+        }
+    }
+#elif defined(_Py_HAVE_X86_SIMD)
+    int info[4];
+    __cpuid(info, 0);
+    int max_leaf = info[0];
+    __cpuid(info, 1);
+    int ecx = info[2];
+    if ((ecx & (1 << 9)) && (ecx & (1 << 19))) {
+        features |= _Py_CPU_SSE41;
+        /* AVX2 needs AVX and the OS saving the XMM and YMM registers */
+        if (max_leaf >= 7 && (ecx & (1 << 27)) && (ecx & (1 << 28))
+            && (_xgetbv(0) & 6) == 6)
+        {
+            __cpuidex(info, 7, 0);
+            if (info[1] & (1 << 5)) {
+                features |= _Py_CPU_AVX2;
+            }
+        }
+    }
+#endif
+    _Py_cpu_features = features;
+}
@@ -11,6 +11,7 @@
 #include "pycore_pymem.h"         // _PyMem_SetDefaultAllocator()
 #include "pycore_interp.h"        // _PyInterpreterState_ClearModules()
 #include "pycore_pystate.h"       // _PyInterpreterState_GET()
+#include "pycore_snapshot.h"      // _PySnapshot_Open()
 #include "pycore_sysmodule.h"
 #include "errcode.h"
 #include "marshal.h"
@@ -2350,6 +2351,127 @@ _imp_source_hash_impl(PyObject *module, long key, Py_buffer *source)
     return PyBytes_FromStringAndSize(hash.data, sizeof(hash.data));
 }
 
+/* The bytecode snapshot named by -X snapshot=FILE or PYTHONSNAPSHOT, opened
+   on first use.  It stays mapped until the process exits. */
+static _PySnapshot *import_snapshot = NULL;
+static int import_snapshot_opened = 0;
+
+/* Return NULL, with an exception set on error, if there is no snapshot */
+static _PySnapshot *
+get_import_snapshot(PyThreadState *tstate)
+{
+    if (_Py_atomic_load_int(&import_snapshot_opened)) {
+        return _Py_atomic_load_ptr(&import_snapshot);
+    }
+
+    const PyConfig *config = _PyInterpreterState_GetConfig(tstate->interp);
+    PyObject *path = NULL;
+    const wchar_t *xoption = _Py_get_xoption(&config->xoptions, L"snapshot");
+    if (xoption != NULL) {
+        const wchar_t *sep = wcschr(xoption, L'=');
+        if (sep != NULL && sep[1] != L'\0') {
+            path = PyUnicode_FromWideChar(sep + 1, -1);
+            if (path == NULL) {
+                return NULL;
+            }
+        }
+        /* "-X snapshot" without a file ignores PYTHONSNAPSHOT */
+    }
+    else {
+        const char *env = _Py_GetEnv(config->use_environment,
+                                     "PYTHONSNAPSHOT");
+        if (env != NULL) {
+            path = PyUnicode_DecodeFSDefault(env);
+            if (path == NULL) {
+                return NULL;
+            }
+        }
+    }
+
+    _PySnapshot *snapshot = NULL;
+    if (path != NULL) {
+        PyObject *encoded = PyUnicode_EncodeFSDefault(path);
+        long magic = PyImport_GetMagicNumber();
+        if (encoded == NULL || (magic == -1 && PyErr_Occurred())) {
+            Py_XDECREF(encoded);
+            Py_DECREF(path);
+            return NULL;
+        }
+        const char *reason;
+        snapshot = _PySnapshot_Open(PyBytes_AS_STRING(encoded), magic,
+                                    config->optimization_level, &reason);
+        Py_DECREF(encoded);
+        if (snapshot == NULL && config->verbose) {
+            PySys_FormatStderr("# ignoring snapshot %R: %s\n", path, reason);
+        }
+        Py_DECREF(path);
+    }
+    if (snapshot != NULL &&
+            !_Py_atomic_compare_exchange_ptr(&import_snapshot, NULL,
+                                             snapshot)) {
+        /* Another thread was faster */
+        _PySnapshot_Close(snapshot);
+    }
+    _Py_atomic_store_int(&import_snapshot_opened, 1);
+    return _Py_atomic_load_ptr(&import_snapshot);
+}
+
+/*[clinic input]
+_imp._snapshot_code
+
+    path: unicode
+    mtime: long_long
+    size: long_long
+    /
+
+Return the code object of a source file from the bytecode snapshot.
+
+Return None if there is no snapshot, if it has no code for the file, or
+if the file changed since the snapshot was written.
+[clinic start generated code]*/
+
+static PyObject *
+_imp__snapshot_code_impl(PyObject *module, PyObject *path, long long mtime,
+                         long long size)
+/*[clinic end generated code: output=fe650ff23f41a28f input=aa4de9ae8e464d21]*/
+{
+    PyThreadState *tstate = _PyThreadState_GET();
+    _PySnapshot *snapshot = get_import_snapshot(tstate);
+    if (snapshot == NULL) {
+        if (_PyErr_Occurred(tstate)) {
+            return NULL;
+        }
+        Py_RETURN_NONE;
+    }
+    return _PySnapshot_GetCode(snapshot, path, mtime, size);
+}
+
+/*[clinic input]
+_imp._snapshot_dumps
+
+    entries: object
+    /
+
+Return the contents of a bytecode snapshot file.
+
+entries is a sequence of (source path, mtime, size, code) tuples.  The
+snapshot is only valid for this build of Python and the current
+optimization level.
+[clinic start generated code]*/
+
+static PyObject *
+_imp__snapshot_dumps(PyObject *module, PyObject *entries)
+/*[clinic end generated code: output=20ae5a2e01523b1d input=29e4ff14e3ed090a]*/
+{
+    long magic = PyImport_GetMagicNumber();
+    if (magic == -1 && PyErr_Occurred()) {
+        return NULL;
+    }
+    const PyConfig *config =
+        _PyInterpreterState_GetConfig(_PyInterpreterState_GET());
+    return _PySnapshot_Dumps(entries, magic, config->optimization_level);
+}
+
 
 PyDoc_STRVAR(doc_imp,
 "(Extremely) low-level import machinery bits as used by importlib and imp.");
@@ -2370,6 +2492,8 @@ static PyMethodDef imp_methods[] = {
     _IMP_EXEC_BUILTIN_METHODDEF
     _IMP__FIX_CO_FILENAME_METHODDEF
     _IMP_SOURCE_HASH_METHODDEF
+    _IMP__SNAPSHOT_CODE_METHODDEF
+    _IMP__SNAPSHOT_DUMPS_METHODDEF
     _IMP_MODULE_INITIALIZED_METHODDEF
     {NULL, NULL}  /* sentinel */
 };
@@ -124,8 +124,8 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     6,3,1,14,242,6,11,53,2,254,54,8,3,253,73,9,
     1,0,57,1,52,0,4,252,57,2,53,5,250,57,8,71,
     9,0,0,57,3,53,6,248,54,8,7,247,4,10,2,73,
-    9,2,0,57,4,51,0,33,4,84,6,0,51,8,76,52,
-    4,4,246,57,2,49,1,35,2,2,84,6,0,51,9,76,
+    9,2,0,121,4,51,0,33,4,84,6,0,51,8,76,52,
+    4,4,246,120,2,49,1,123,2,2,84,6,0,51,9,76,
     49,3,34,2,84,6,0,51,8,76,49,3,54,8,10,245,
     4,10,2,73,9,2,0,1,80,189,255,114,49,0,0,0,
     99,214,0,0,0,1,0,0,0,3,0,0,0,1,0,0,
@@ -159,18 +159,18 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     2,0,0,6,13,1,12,3,7,1,33,1,5,1,15,1,
     11,1,13,1,22,1,19,1,17,2,13,1,13,244,3,14,
     6,10,53,2,254,54,5,3,253,73,6,1,0,57,1,53,
-    4,251,57,2,49,1,63,0,2,2,2,52,0,5,250,108,
-    2,1,52,0,6,249,57,4,51,7,35,2,4,2,4,82,
-    17,0,1,52,0,8,248,57,4,49,1,35,2,4,2,4,
-    84,34,0,49,1,59,0,8,52,0,6,247,57,4,51,9,
+    4,251,120,2,49,1,63,0,2,2,2,52,0,5,250,108,
+    2,1,52,0,6,249,121,4,51,7,35,2,4,2,4,82,
+    17,0,1,52,0,8,248,120,4,49,1,35,2,4,2,4,
+    84,34,0,49,1,59,0,8,52,0,6,247,121,4,51,9,
     38,4,59,0,6,2,4,51,10,109,2,57,3,98,2,105,
     0,76,49,0,54,7,11,246,73,8,1,0,84,25,0,53,
-    12,244,57,7,51,13,57,8,49,0,22,8,2,8,57,8,
-    71,8,1,0,77,52,0,14,243,54,7,15,242,51,16,57,
-    9,73,8,2,0,84,18,0,52,0,17,241,57,4,51,9,
+    12,244,121,7,122,13,120,8,49,0,22,8,2,8,57,8,
+    71,8,1,0,77,52,0,14,243,54,7,15,242,122,16,57,
+    9,73,8,2,0,84,18,0,52,0,17,241,121,4,51,9,
     38,4,59,0,17,2,4,109,2,52,0,14,240,54,5,15,
     239,73,6,1,0,1,52,0,14,238,54,5,18,237,73,6,
-    1,0,1,80,88,255,53,4,251,57,4,49,1,69,4,2,
+    1,0,1,80,88,255,53,4,251,120,4,49,1,69,4,2,
     4,99,2,51,19,76,114,54,0,0,0,99,146,0,0,0,
     1,0,0,0,3,0,0,0,1,0,0,0,2,0,0,0,
     0,0,0,0,0,0,0,0,1,0,0,0,9,0,0,0,
@@ -189,12 +189,12 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,0,1,13,1,7,1,16,1,14,1,18,1,15,1,16,
     1,5,1,7,1,15,1,6,9,53,2,254,54,5,3,253,
     73,6,1,0,57,1,52,0,4,252,108,2,1,52,0,5,
-    251,57,4,49,1,35,3,4,2,4,84,17,0,53,6,249,
-    57,7,51,7,57,8,71,8,1,0,77,52,0,8,248,57,
+    251,120,4,49,1,35,3,4,2,4,84,17,0,53,6,249,
+    121,7,122,7,57,8,71,8,1,0,77,52,0,8,248,121,
     4,51,9,35,4,4,2,4,85,5,0,74,8,52,0,8,
-    247,57,4,51,10,39,4,59,0,8,2,4,52,0,8,246,
-    57,4,51,9,35,2,4,2,4,84,43,0,51,0,59,0,
-    5,52,0,11,245,84,31,0,52,0,11,244,57,4,51,10,
+    247,121,4,51,10,39,4,59,0,8,2,4,52,0,8,246,
+    121,4,51,9,35,2,4,2,4,84,43,0,51,0,59,0,
+    5,52,0,11,245,84,31,0,52,0,11,244,121,4,51,10,
     39,4,59,0,11,2,4,52,0,12,243,54,7,13,242,73,
     8,1,0,1,109,2,51,0,76,114,55,0,0,0,99,33,
     0,0,0,1,0,0,0,3,0,0,0,1,0,0,0,1,
@@ -249,7 +249,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     84,137,0,0,0,41,1,114,39,0,0,0,114,17,0,0,
     0,114,17,0,0,0,114,18,0,0,0,114,54,0,0,0,
     115,6,0,0,0,2,0,0,1,15,1,6,2,52,0,2,
-    255,57,1,51,3,38,1,59,0,2,2,1,51,4,76,114,
+    255,121,1,51,3,38,1,59,0,2,2,1,51,4,76,114,
     54,0,0,0,99,50,0,0,0,1,0,0,0,3,0,0,
     0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
     0,1,0,0,0,6,0,0,0,7,0,0,0,4,0,0,
@@ -260,9 +260,9 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     114,52,0,0,0,141,0,0,0,41,1,114,39,0,0,0,
     114,17,0,0,0,114,17,0,0,0,114,18,0,0,0,114,
     55,0,0,0,115,8,0,0,0,2,0,0,1,16,1,14,
-    1,6,6,52,0,2,255,57,1,51,3,35,2,1,2,1,
-    84,17,0,53,4,253,57,4,51,5,57,5,71,5,1,0,
-    77,52,0,2,252,57,1,51,6,39,1,59,0,2,2,1,
+    1,6,6,52,0,2,255,121,1,51,3,35,2,1,2,1,
+    84,17,0,53,4,253,121,4,122,5,57,5,71,5,1,0,
+    77,52,0,2,252,121,1,51,6,39,1,59,0,2,2,1,
     51,0,76,114,55,0,0,0,99,33,0,0,0,1,0,0,
     0,3,0,0,0,1,0,0,0,1,0,0,0,0,0,0,
     0,0,0,0,0,1,0,0,0,12,0,0,0,6,0,0,
@@ -361,8 +361,8 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     114,18,0,0,0,218,2,99,98,115,10,0,0,0,2,0,
     0,1,12,5,25,1,11,2,6,9,53,2,254,54,5,3,
     253,73,6,1,0,1,53,4,251,54,5,5,250,4,7,1,
-    73,6,2,0,57,2,49,0,33,2,2,2,84,14,0,53,
-    4,251,57,2,49,1,69,2,2,2,53,2,254,54,7,6,
+    73,6,2,0,120,2,49,0,33,2,2,2,84,14,0,53,
+    4,251,120,2,49,1,69,2,2,2,53,2,254,54,7,6,
     249,73,8,1,0,1,99,2,51,0,76,218,8,95,119,101,
     97,107,114,101,102,114,87,0,0,0,114,86,0,0,0,14,
     0,0,0,36,0,0,0,54,0,0,0,3,0,0,0,14,
@@ -372,15 +372,15 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,0,0,114,75,0,0,0,115,26,0,0,0,2,0,0,
     6,12,3,22,1,7,1,11,2,7,1,14,1,17,2,14,
     2,9,11,33,2,14,2,6,10,53,2,254,54,6,3,253,
-    73,7,1,0,1,53,4,251,57,3,49,0,25,3,2,3,
+    73,7,1,0,1,53,4,251,120,3,49,0,25,3,2,3,
     57,6,71,7,0,0,57,1,80,21,0,53,5,249,83,3,
-    13,0,51,6,57,1,97,3,80,5,0,99,3,51,6,33,
-    1,84,90,0,53,7,247,57,3,51,6,33,3,2,3,84,
+    13,0,122,6,57,1,97,3,80,5,0,99,3,51,6,33,
+    1,84,90,0,53,7,247,121,3,51,6,33,3,2,3,84,
     20,0,53,8,245,57,6,4,7,0,71,7,1,0,57,1,
     80,17,0,53,9,243,57,6,4,7,0,71,7,1,0,57,
     1,4,3,0,107,10,2,3,57,2,53,11,241,54,6,12,
     240,4,8,1,4,9,2,73,7,3,0,57,3,53,4,251,
-    57,4,49,0,63,3,4,2,4,2,3,53,2,254,54,8,
+    120,4,49,0,63,3,4,2,4,2,3,53,2,254,54,8,
     13,239,73,9,1,0,1,99,3,49,1,76,114,75,0,0,
     0,99,58,0,0,0,1,0,0,0,3,0,0,0,1,0,
     0,0,2,0,0,0,0,0,0,0,0,0,0,0,1,0,
@@ -405,7 +405,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,0,114,33,0,0,0,114,17,0,0,0,114,17,0,0,
     0,114,18,0,0,0,114,91,0,0,0,115,12,0,0,0,
     2,0,0,6,14,2,14,1,7,3,7,2,6,7,53,2,
-    254,57,5,4,6,0,71,6,1,0,57,1,49,1,54,5,
+    254,57,5,4,6,0,71,6,1,0,120,1,49,1,54,5,
     3,253,73,6,1,0,1,80,17,0,53,4,251,83,2,9,
     0,97,2,80,16,0,99,2,49,1,54,5,5,250,73,6,
     1,0,1,51,6,76,114,91,0,0,0,99,14,0,0,0,
@@ -457,12 +457,12 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     78,0,0,0,114,17,0,0,0,114,17,0,0,0,114,18,
     0,0,0,114,97,0,0,0,115,10,0,0,0,2,0,0,
     2,31,1,18,1,12,1,6,15,53,2,254,57,3,52,3,
-    3,253,2,3,57,3,52,3,4,252,2,3,57,3,49,1,
-    35,5,3,2,3,84,73,0,49,0,54,6,5,251,51,6,
-    57,8,73,7,2,0,16,84,15,0,51,7,57,3,49,0,
+    3,253,2,3,57,3,52,3,4,252,2,3,120,3,49,1,
+    35,5,3,2,3,84,73,0,49,0,54,6,5,251,122,6,
+    57,8,73,7,2,0,16,84,15,0,122,7,120,3,49,0,
     23,3,2,3,57,0,53,8,249,57,8,52,0,9,248,57,
     14,4,9,2,72,15,57,9,53,2,254,57,10,52,10,10,
-    247,2,10,57,3,51,11,57,4,71,9,1,1,1,51,12,
+    247,2,10,121,3,122,11,57,4,71,9,1,1,1,51,12,
     76,114,97,0,0,0,99,26,0,0,0,1,0,8,0,3,
     0,0,0,1,0,0,0,2,0,0,0,0,0,0,0,0,
     0,0,0,1,0,0,0,8,0,0,0,4,0,0,0,2,
@@ -491,8 +491,8 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     117,105,108,116,105,110,95,119,114,97,112,112,101,114,115,8,
     0,0,0,2,0,0,1,17,1,32,2,6,15,53,2,254,
     57,3,52,3,3,253,2,3,34,1,17,84,35,0,53,4,
-    251,57,8,51,5,54,12,6,250,4,14,1,73,13,2,0,
-    57,9,4,3,1,51,7,57,4,71,9,1,1,77,55,2,
+    251,121,8,51,5,54,12,6,250,4,14,1,73,13,2,0,
+    57,9,4,3,1,122,7,57,4,71,9,1,1,77,55,2,
     57,6,4,7,0,4,8,1,71,7,2,0,76,114,4,0,
     0,0,0,0,0,0,239,0,0,0,41,2,114,119,0,0,
     0,114,120,0,0,0,114,17,0,0,0,41,1,114,119,0,
@@ -525,8 +525,8 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     102,114,111,122,101,110,95,119,114,97,112,112,101,114,115,8,
     0,0,0,2,0,0,1,18,1,32,2,6,15,53,2,254,
     54,6,3,253,4,8,1,73,7,2,0,16,84,35,0,53,
-    4,251,57,8,51,5,54,12,6,250,4,14,1,73,13,2,
-    0,57,9,4,3,1,51,7,57,4,71,9,1,1,77,55,
+    4,251,121,8,51,5,54,12,6,250,4,14,1,73,13,2,
+    0,57,9,4,3,1,122,7,57,4,71,9,1,1,77,55,
     2,57,6,4,7,0,4,8,1,71,7,2,0,76,114,4,
     0,0,0,0,0,0,0,250,0,0,0,41,2,114,119,0,
     0,0,114,126,0,0,0,114,17,0,0,0,41,1,114,119,
@@ -556,10 +556,10 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     2,0,0,6,17,1,16,1,21,1,16,1,20,2,6,10,
     53,2,254,57,7,4,8,1,4,9,0,71,8,2,0,57,
     2,53,3,252,57,4,52,4,4,251,2,4,34,1,84,60,
-    0,53,3,252,57,4,52,4,4,250,2,4,57,4,49,1,
+    0,53,3,252,57,4,52,4,4,250,2,4,120,4,49,1,
     25,4,2,4,57,3,53,5,248,57,7,4,8,2,4,9,
     3,71,8,2,0,1,53,3,252,57,4,52,4,4,247,2,
-    4,57,4,49,1,25,4,2,4,76,53,6,245,57,7,4,
+    4,120,4,49,1,25,4,2,4,76,53,6,245,57,7,4,
     8,2,71,8,1,0,76,114,128,0,0,0,99,219,0,0,
     0,1,0,0,0,3,0,0,0,1,0,0,0,5,0,0,
     0,0,0,0,0,0,0,0,0,1,0,0,0,14,0,0,
@@ -587,15 +587,15 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,0,0,114,135,0,0,0,115,40,0,0,0,2,0,0,
     2,22,1,19,5,14,1,7,1,7,2,9,1,7,1,7,
     2,8,1,13,5,9,1,7,1,11,2,9,1,7,1,7,
-    1,16,2,21,2,6,14,53,2,254,57,8,4,9,0,51,
-    3,57,10,51,0,57,11,71,9,3,0,57,1,53,4,252,
-    57,8,4,9,1,51,5,57,10,71,9,2,0,84,31,0,
+    1,16,2,21,2,6,14,53,2,254,57,8,4,9,0,122,
+    3,121,10,122,0,57,11,71,9,3,0,57,1,53,4,252,
+    57,8,4,9,1,122,5,57,10,71,9,2,0,84,31,0,
     49,1,54,8,5,251,4,10,0,73,9,2,0,76,53,6,
     249,83,5,9,0,97,5,80,5,0,99,5,52,0,7,248,
     57,2,80,17,0,53,8,246,83,5,9,0,97,5,80,26,
     0,99,5,51,0,33,2,17,84,16,0,53,9,244,57,8,
     4,9,2,71,9,1,0,76,52,0,10,243,57,3,80,21,
-    0,53,8,246,83,5,13,0,51,11,57,3,97,5,80,5,
+    0,53,8,246,83,5,13,0,122,11,57,3,97,5,80,5,
     0,99,5,52,0,12,242,57,4,80,54,0,53,8,246,83,
     5,46,0,51,0,33,1,84,19,0,51,13,54,10,14,241,
     4,12,3,73,11,2,0,97,5,76,51,15,54,10,14,240,
@@ -739,16 +739,16 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,0,0,114,17,0,0,0,114,18,0,0,0,114,62,0,
     0,0,115,22,0,0,0,2,0,0,1,18,1,16,255,7,
     2,16,1,29,1,16,1,12,1,4,255,13,2,6,14,51,
-    2,54,5,3,255,52,0,4,254,57,7,73,6,2,0,57,
+    2,54,5,3,255,52,0,4,254,57,7,73,6,2,0,121,
     2,51,5,54,6,3,253,52,0,6,252,57,8,73,7,2,
-    0,57,3,94,2,2,57,1,52,0,7,251,57,2,51,0,
+    0,57,3,94,2,2,57,1,52,0,7,251,121,2,51,0,
     33,2,17,2,2,84,32,0,49,1,54,5,8,250,51,9,
     54,10,3,249,52,0,7,248,57,12,73,11,2,0,57,7,
-    73,6,2,0,1,52,0,10,247,57,2,51,0,33,2,17,
+    73,6,2,0,1,52,0,10,247,121,2,51,0,33,2,17,
     2,2,84,32,0,49,1,54,5,8,246,51,11,54,10,3,
     245,52,0,10,244,57,12,73,11,2,0,57,7,73,6,2,
     0,1,51,12,54,5,3,243,52,0,13,242,57,7,52,7,
-    14,241,2,7,57,7,51,15,54,11,16,240,4,13,1,73,
+    14,241,2,7,121,7,51,15,54,11,16,240,4,13,1,73,
     12,2,0,57,8,73,6,3,0,76,114,62,0,0,0,99,
     129,0,0,0,2,0,0,0,3,0,0,0,2,0,0,0,
     3,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
@@ -786,9 +786,9 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,0,0,114,17,0,0,0,114,17,0,0,0,114,18,0,
     0,0,114,169,0,0,0,115,14,0,0,0,2,0,0,2,
     15,1,24,1,14,1,4,1,20,1,6,7,52,0,2,255,
-    57,1,51,0,33,1,2,1,84,65,0,52,0,3,254,57,
+    121,1,51,0,33,1,2,1,84,65,0,52,0,3,254,121,
     1,51,0,33,1,17,2,1,81,8,0,1,52,0,4,253,
-    84,41,0,53,5,251,57,1,51,0,33,1,2,1,84,7,
+    84,41,0,53,5,251,121,1,51,0,33,1,2,1,84,7,
     0,53,6,249,77,53,5,251,54,4,7,248,52,0,3,247,
     57,6,73,5,2,0,59,0,2,52,0,2,246,76,114,169,
     0,0,0,218,6,115,101,116,116,101,114,99,10,0,0,0,
@@ -812,8 +812,8 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     1,114,39,0,0,0,114,17,0,0,0,114,17,0,0,0,
     114,18,0,0,0,218,6,112,97,114,101,110,116,115,8,0,
     0,0,2,0,0,3,15,1,25,2,6,7,52,0,2,255,
-    57,1,51,3,33,1,2,1,84,28,0,52,0,4,254,54,
-    4,5,253,51,6,57,6,73,5,2,0,57,1,51,7,25,
+    121,1,51,3,33,1,2,1,84,28,0,52,0,4,254,54,
+    4,5,253,122,6,57,6,73,5,2,0,121,1,51,7,25,
     1,2,1,76,52,0,4,252,76,114,184,0,0,0,99,7,
     0,0,0,1,0,0,0,3,0,0,0,1,0,0,0,1,
     0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,
@@ -840,7 +840,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,2,0,9,1,2,255,2,37,8,1,2,255,12,12,4,
     10,4,12,5,1,10,8,13,1,10,3,5,1,10,7,5,
     1,10,3,13,1,6,11,50,0,254,58,1,51,2,58,3,
-    51,4,58,5,51,6,57,7,51,6,57,8,51,6,57,9,
+    51,4,58,5,122,6,121,7,122,6,121,8,122,6,57,9,
     107,7,2,9,2,8,2,7,58,8,107,9,58,10,107,11,
     58,12,50,13,252,57,10,107,14,57,11,71,11,1,0,58,
     15,50,15,250,57,7,52,7,16,249,2,7,57,10,107,17,
@@ -870,19 +870,19 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     114,17,0,0,0,114,18,0,0,0,114,129,0,0,0,115,
     32,0,0,0,2,0,0,2,19,1,14,1,4,1,13,2,
     7,1,18,1,15,1,21,3,7,1,19,2,18,1,7,1,
-    14,3,4,2,6,15,53,2,254,57,9,4,10,1,51,3,
-    57,11,71,10,2,0,84,95,0,53,4,252,57,6,51,5,
+    14,3,4,2,6,15,53,2,254,57,9,4,10,1,122,3,
+    57,11,71,10,2,0,84,95,0,53,4,252,121,6,51,5,
     33,6,2,6,84,7,0,53,6,250,77,53,4,252,57,6,
-    52,6,7,249,2,6,57,4,51,5,33,3,84,21,0,4,
-    11,4,4,12,0,4,6,1,51,8,57,7,71,12,1,1,
-    76,49,3,84,9,0,94,6,0,80,5,0,51,5,57,5,
-    4,12,4,4,13,0,4,6,1,4,7,5,51,9,57,8,
+    52,6,7,249,2,6,121,4,51,5,33,3,84,21,0,4,
+    11,4,4,12,0,4,6,1,122,8,57,7,71,12,1,1,
+    76,49,3,84,9,0,94,6,0,80,5,0,122,5,57,5,
+    4,12,4,4,13,0,4,6,1,4,7,5,122,9,57,8,
     71,13,1,2,76,51,5,33,3,84,65,0,53,2,254,57,
-    9,4,10,1,51,10,57,11,71,10,2,0,84,42,0,49,
+    9,4,10,1,122,10,57,11,71,10,2,0,84,42,0,49,
     1,54,9,10,248,4,11,0,73,10,2,0,57,3,80,21,
-    0,53,11,246,83,6,13,0,51,5,57,3,97,6,80,5,
-    0,99,6,80,7,0,51,12,57,3,53,13,244,57,12,4,
-    13,0,4,14,1,4,6,2,4,7,3,51,14,57,8,71,
+    0,53,11,246,83,6,13,0,122,5,57,3,97,6,80,5,
+    0,99,6,80,7,0,122,12,57,3,53,13,244,57,12,4,
+    13,0,4,14,1,4,6,2,4,7,3,122,14,57,8,71,
     13,2,2,76,114,129,0,0,0,99,10,1,0,0,3,0,
     0,0,3,0,0,0,3,0,0,0,8,0,0,0,2,0,
     0,0,0,0,0,0,3,0,0,0,16,0,0,0,18,0,
@@ -912,19 +912,19 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     2,20,1,7,1,11,2,24,1,17,1,5,1,5,1,6,
     16,52,0,2,255,57,3,80,17,0,53,3,253,83,8,9,
     0,97,8,80,16,0,99,8,51,0,33,3,17,84,6,0,
-    49,3,76,52,0,4,252,57,4,51,0,33,1,84,26,0,
+    49,3,76,52,0,4,252,121,4,51,0,33,1,84,26,0,
     52,0,5,251,57,1,80,17,0,53,3,253,83,8,9,0,
     97,8,80,5,0,99,8,52,0,6,250,57,5,80,21,0,
-    53,3,253,83,8,13,0,51,0,57,5,97,8,80,5,0,
+    53,3,253,83,8,13,0,122,0,57,5,97,8,80,5,0,
     99,8,51,0,33,2,84,44,0,51,0,33,5,84,33,0,
     52,1,7,249,57,2,80,21,0,53,3,253,83,8,13,0,
-    51,0,57,2,97,8,80,5,0,99,8,80,7,0,49,5,
+    122,0,57,2,97,8,80,5,0,99,8,80,7,0,49,5,
     57,2,52,0,8,248,57,6,80,21,0,53,3,253,83,8,
-    13,0,51,0,57,6,97,8,80,5,0,99,8,53,9,246,
+    13,0,122,0,57,6,97,8,80,5,0,99,8,53,9,246,
     57,11,52,0,10,245,57,12,71,12,1,0,57,7,80,21,
-    0,53,3,253,83,8,13,0,51,0,57,7,97,8,80,5,
+    0,53,3,253,83,8,13,0,122,0,57,7,97,8,80,5,
     0,99,8,53,11,243,57,13,4,14,4,4,15,1,4,8,
-    2,51,12,57,9,71,14,2,1,57,3,51,0,33,5,84,
+    2,122,12,57,9,71,14,2,1,121,3,51,0,33,5,84,
     8,0,51,13,80,5,0,51,14,59,3,15,49,6,59,3,
     16,49,7,59,3,17,49,3,76,114,195,0,0,0,70,99,
     10,2,0,0,2,0,32,0,3,0,0,0,2,0,0,0,
@@ -957,37 +957,37 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     7,2,37,2,10,1,7,1,7,3,8,1,7,1,7,2,
     37,1,16,2,10,1,7,1,7,2,7,1,37,2,10,1,
     7,1,7,2,37,1,16,2,10,1,7,1,7,1,6,12,
-    49,2,82,32,0,1,53,2,254,57,8,4,9,1,51,3,
-    57,10,51,0,57,11,71,9,3,0,57,5,51,0,33,5,
+    49,2,82,32,0,1,53,2,254,57,8,4,9,1,122,3,
+    121,10,122,0,57,11,71,9,3,0,121,5,51,0,33,5,
     2,5,84,27,0,52,0,4,253,59,1,3,80,17,0,53,
     5,251,83,5,9,0,97,5,80,5,0,99,5,49,2,82,
-    32,0,1,53,2,254,57,8,4,9,1,51,6,57,10,51,
-    0,57,11,71,9,3,0,57,5,51,0,33,5,2,5,84,
-    117,0,52,0,7,250,57,3,51,0,33,3,84,82,0,52,
-    0,8,249,57,5,51,0,33,5,17,2,5,84,66,0,53,
-    9,247,57,5,51,0,33,5,2,5,84,7,0,53,10,245,
-    77,53,9,247,57,5,52,5,11,244,2,5,57,4,49,4,
+    32,0,1,53,2,254,57,8,4,9,1,122,6,121,10,122,
+    0,57,11,71,9,3,0,121,5,51,0,33,5,2,5,84,
+    117,0,52,0,7,250,121,3,51,0,33,3,84,82,0,52,
+    0,8,249,121,5,51,0,33,5,17,2,5,84,66,0,53,
+    9,247,121,5,51,0,33,5,2,5,84,7,0,53,10,245,
+    77,53,9,247,57,5,52,5,11,244,2,5,120,4,49,4,
     54,8,12,243,4,10,4,73,9,2,0,57,3,52,0,8,
     242,59,3,13,49,3,59,0,7,51,0,59,1,14,49,3,
     59,1,6,80,17,0,53,5,251,83,5,9,0,97,5,80,
     5,0,99,5,49,2,82,32,0,1,53,2,254,57,8,4,
-    9,1,51,15,57,10,51,0,57,11,71,9,3,0,57,5,
+    9,1,122,15,121,10,122,0,57,11,71,9,3,0,121,5,
     51,0,33,5,2,5,84,27,0,52,0,16,241,59,1,15,
     80,17,0,53,5,251,83,5,9,0,97,5,80,5,0,99,
     5,49,0,59,1,17,80,17,0,53,5,251,83,5,9,0,
     97,5,80,5,0,99,5,49,2,82,32,0,1,53,2,254,
-    57,8,4,9,1,51,18,57,10,51,0,57,11,71,9,3,
-    0,57,5,51,0,33,5,2,5,84,43,0,52,0,8,240,
-    57,5,51,0,33,5,17,2,5,84,27,0,52,0,8,239,
+    57,8,4,9,1,122,18,121,10,122,0,57,11,71,9,3,
+    0,121,5,51,0,33,5,2,5,84,43,0,52,0,8,240,
+    121,5,51,0,33,5,17,2,5,84,27,0,52,0,8,239,
     59,1,18,80,17,0,53,5,251,83,5,9,0,97,5,80,
     5,0,99,5,52,0,19,238,84,141,0,49,2,82,32,0,
-    1,53,2,254,57,8,4,9,1,51,14,57,10,51,0,57,
-    11,71,9,3,0,57,5,51,0,33,5,2,5,84,27,0,
+    1,53,2,254,57,8,4,9,1,122,14,121,10,122,0,57,
+    11,71,9,3,0,121,5,51,0,33,5,2,5,84,27,0,
     52,0,20,237,59,1,14,80,17,0,53,5,251,83,5,9,
     0,97,5,80,5,0,99,5,49,2,82,32,0,1,53,2,
-    254,57,8,4,9,1,51,21,57,10,51,0,57,11,71,9,
-    3,0,57,5,51,0,33,5,2,5,84,43,0,52,0,22,
-    236,57,5,51,0,33,5,17,2,5,84,27,0,52,0,22,
+    254,57,8,4,9,1,122,21,121,10,122,0,57,11,71,9,
+    3,0,121,5,51,0,33,5,2,5,84,43,0,52,0,22,
+    236,121,5,51,0,33,5,17,2,5,84,27,0,52,0,22,
     235,59,1,21,80,17,0,53,5,251,83,5,9,0,97,5,
     80,5,0,99,5,49,1,76,114,202,0,0,0,99,127,0,
     0,0,1,0,0,0,3,0,0,0,1,0,0,0,2,0,
@@ -1009,12 +1009,12 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,0,0,114,134,0,0,0,114,17,0,0,0,114,17,0,
     0,0,114,18,0,0,0,114,209,0,0,0,115,20,0,0,
     0,2,0,0,3,4,1,22,3,20,1,22,1,14,2,7,
-    1,17,1,16,1,6,8,51,2,57,1,53,3,254,57,5,
-    52,0,4,253,57,6,51,5,57,7,71,6,2,0,84,23,
+    1,17,1,16,1,6,8,122,2,57,1,53,3,254,57,5,
+    52,0,4,253,121,6,122,5,57,7,71,6,2,0,84,23,
     0,52,0,4,252,54,5,5,251,4,7,0,73,6,2,0,
-    57,1,80,39,0,53,3,254,57,5,52,0,4,250,57,6,
-    51,6,57,7,71,6,2,0,84,17,0,53,7,248,57,5,
-    51,8,57,6,71,6,1,0,77,51,2,33,1,84,20,0,
+    57,1,80,39,0,53,3,254,57,5,52,0,4,250,121,6,
+    122,6,57,7,71,6,2,0,84,17,0,53,7,248,121,5,
+    122,8,57,6,71,6,1,0,77,51,2,33,1,84,20,0,
     53,9,246,57,5,52,0,10,245,57,6,71,6,1,0,57,
     1,53,11,243,57,5,4,6,0,4,7,1,71,6,2,0,
     1,49,1,76,114,209,0,0,0,99,142,0,0,0,1,0,
@@ -1032,9 +1032,9 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     114,22,0,0,0,114,17,0,0,0,114,17,0,0,0,114,
     18,0,0,0,114,141,0,0,0,115,18,0,0,0,2,0,
     0,3,26,1,15,1,15,1,14,2,20,2,7,1,20,2,
-    6,9,52,0,2,255,57,2,51,3,33,2,2,2,84,8,
+    6,9,52,0,2,255,121,2,51,3,33,2,2,2,84,8,
     0,51,4,80,7,0,52,0,2,254,57,1,52,0,5,253,
-    57,2,51,3,33,2,2,2,84,52,0,52,0,6,252,57,
+    121,2,51,3,33,2,2,2,84,52,0,52,0,6,252,121,
     2,51,3,33,2,2,2,84,17,0,51,7,54,5,8,251,
     4,7,1,73,6,2,0,76,51,9,54,5,8,250,4,7,
     1,52,0,6,249,57,8,73,6,3,0,76,52,0,10,248,
@@ -1068,17 +1068,17 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     27,2,24,1,23,4,19,2,16,4,27,1,26,1,6,14,
     52,0,2,255,57,2,53,3,253,57,7,4,8,2,71,8,
     1,0,108,4,1,53,4,251,57,6,52,6,5,250,2,6,
-    54,9,6,249,4,11,2,73,10,2,0,57,6,49,1,33,
+    54,9,6,249,4,11,2,73,10,2,0,120,6,49,1,33,
     6,17,2,6,84,38,0,51,7,54,9,8,248,4,11,2,
     73,10,2,0,57,3,53,9,246,57,11,4,12,3,4,6,
-    2,51,10,57,7,71,12,1,1,77,52,0,11,245,57,6,
-    51,12,33,6,2,6,84,69,0,52,0,13,244,57,6,51,
-    12,33,6,2,6,84,27,0,53,9,246,57,11,51,14,57,
-    12,52,0,2,243,57,6,51,10,57,7,71,12,1,1,77,
-    53,15,241,57,11,4,12,0,4,13,1,51,16,57,6,51,
+    2,122,10,57,7,71,12,1,1,77,52,0,11,245,121,6,
+    51,12,33,6,2,6,84,69,0,52,0,13,244,121,6,51,
+    12,33,6,2,6,84,27,0,53,9,246,121,11,122,14,57,
+    12,52,0,2,243,121,6,122,10,57,7,71,12,1,1,77,
+    53,15,241,57,11,4,12,0,4,13,1,122,16,121,6,122,
     17,57,7,71,12,2,1,1,80,85,0,53,15,241,57,11,
-    4,12,0,4,13,1,51,16,57,6,51,17,57,7,71,12,
-    2,1,1,53,18,239,57,9,52,0,11,238,57,10,51,19,
+    4,12,0,4,13,1,122,16,121,6,122,17,57,7,71,12,
+    2,1,1,53,18,239,57,9,52,0,11,238,121,10,122,19,
     57,11,71,10,2,0,16,84,22,0,52,0,11,237,54,9,
     20,236,4,11,2,73,10,2,0,1,80,19,0,52,0,11,
     235,54,9,19,234,4,11,1,73,10,2,0,1,53,4,251,
@@ -1115,18 +1115,18 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     77,53,5,250,57,2,52,2,6,243,2,2,54,5,7,242,
     52,0,4,241,57,7,73,6,2,0,57,1,53,5,250,57,
     2,52,2,6,240,2,2,57,2,52,0,4,239,63,1,2,
-    2,2,53,8,237,57,5,4,6,1,51,9,57,7,51,0,
-    57,8,71,6,3,0,57,2,51,0,33,2,2,2,84,27,
+    2,2,53,8,237,57,5,4,6,1,122,9,121,7,122,0,
+    57,8,71,6,3,0,121,2,51,0,33,2,2,2,84,27,
     0,52,0,2,236,59,1,9,80,17,0,53,10,234,83,2,
     9,0,97,2,80,5,0,99,2,53,8,237,57,5,4,6,
-    1,51,11,57,7,51,0,57,8,71,6,3,0,57,2,51,
+    1,122,11,121,7,122,0,57,8,71,6,3,0,121,2,51,
     0,33,2,2,2,84,74,0,52,1,12,233,59,1,11,53,
-    13,231,57,5,4,6,1,51,14,57,7,71,6,2,0,16,
-    84,30,0,52,0,4,230,54,5,15,229,51,16,57,7,73,
-    6,2,0,57,2,51,17,25,2,2,2,59,1,11,80,17,
+    13,231,57,5,4,6,1,122,14,57,7,71,6,2,0,16,
+    84,30,0,52,0,4,230,54,5,15,229,122,16,57,7,73,
+    6,2,0,121,2,51,17,25,2,2,2,59,1,11,80,17,
     0,53,10,234,83,2,9,0,97,2,80,5,0,99,2,53,
-    8,237,57,5,4,6,1,51,18,57,7,51,0,57,8,71,
-    6,3,0,57,2,51,0,33,2,2,2,84,25,0,49,0,
+    8,237,57,5,4,6,1,122,18,121,7,122,0,57,8,71,
+    6,3,0,121,2,51,0,33,2,2,2,84,25,0,49,0,
     59,1,18,80,17,0,53,10,234,83,2,9,0,97,2,80,
     5,0,99,2,49,1,76,114,222,0,0,0,99,77,1,0,
     0,1,0,0,0,3,0,0,0,1,0,0,0,2,0,0,
@@ -1150,17 +1150,17 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,0,114,223,0,0,0,115,44,0,0,0,2,0,0,2,
     16,2,23,1,13,2,14,5,5,1,19,2,22,2,15,1,
     15,1,27,3,19,3,24,1,7,1,7,1,1,5,27,1,
-    22,1,19,1,26,2,7,2,6,9,52,0,2,255,57,2,
+    22,1,19,1,26,2,7,2,6,9,52,0,2,255,121,2,
     51,0,33,2,17,2,2,84,39,0,53,3,253,57,5,52,
-    0,2,252,57,6,51,4,57,7,71,6,2,0,16,84,16,
+    0,2,252,121,6,122,4,57,7,71,6,2,0,16,84,16,
     0,53,5,250,57,5,4,6,0,71,6,1,0,76,53,6,
-    248,57,5,4,6,0,71,6,1,0,57,1,51,7,59,0,
-    8,53,9,246,54,5,10,245,4,7,1,51,11,57,8,73,
+    248,57,5,4,6,0,71,6,1,0,121,1,51,7,59,0,
+    8,53,9,246,54,5,10,245,4,7,1,122,11,57,8,73,
     6,3,0,1,53,12,243,57,2,52,2,13,242,2,2,57,
-    2,52,0,14,241,63,1,2,2,2,52,0,2,240,57,2,
-    51,0,33,2,2,2,84,45,0,52,0,15,239,57,2,51,
-    0,33,2,2,2,84,27,0,53,16,237,57,7,51,17,57,
-    8,52,0,14,236,57,2,51,18,57,3,71,8,1,1,77,
+    2,52,0,14,241,63,1,2,2,2,52,0,2,240,121,2,
+    51,0,33,2,2,2,84,45,0,52,0,15,239,121,2,51,
+    0,33,2,2,2,84,27,0,53,16,237,121,7,122,17,57,
+    8,52,0,14,236,121,2,122,18,57,3,71,8,1,1,77,
     80,19,0,52,0,2,235,54,5,4,234,4,7,1,73,6,
     2,0,1,80,42,0,53,12,243,57,4,52,4,13,233,2,
     4,57,4,52,0,14,232,69,4,2,4,80,17,0,53,19,
@@ -1168,8 +1168,8 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     57,2,52,2,13,229,2,2,54,5,20,228,52,0,14,227,
     57,7,73,6,2,0,57,1,53,12,243,57,2,52,2,13,
     226,2,2,57,2,52,0,14,225,63,1,2,2,2,53,9,
-    246,54,5,10,224,4,7,1,51,7,57,8,73,6,3,0,
-    1,53,21,222,57,5,51,22,57,6,52,0,14,221,57,7,
+    246,54,5,10,224,4,7,1,122,7,57,8,73,6,3,0,
+    1,53,21,222,121,5,122,22,57,6,52,0,14,221,57,7,
     52,0,2,220,57,8,71,6,3,0,1,51,11,59,0,8,
     99,2,49,1,76,114,223,0,0,0,99,40,0,0,0,1,
     0,0,0,3,0,0,0,1,0,0,0,1,0,0,0,0,
@@ -1229,10 +1229,10 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,0,0,218,2,32,40,114,228,0,0,0,114,196,0,0,
     0,218,2,41,62,217,2,0,0,41,1,114,134,0,0,0,
     114,17,0,0,0,114,17,0,0,0,114,18,0,0,0,114,
-    137,0,0,0,115,4,0,0,0,2,0,0,7,6,6,51,
-    2,57,1,52,0,3,255,74,2,74,4,57,2,51,4,57,
-    3,53,5,253,57,4,52,4,6,252,2,4,74,4,57,4,
-    51,7,57,5,75,6,1,5,76,114,137,0,0,0,218,11,
+    137,0,0,0,115,4,0,0,0,2,0,0,7,6,6,122,
+    2,57,1,52,0,3,255,74,2,74,4,121,2,122,4,57,
+    3,53,5,253,57,4,52,4,6,252,2,4,74,4,121,4,
+    122,7,57,5,75,6,1,5,76,114,137,0,0,0,218,11,
     99,108,97,115,115,109,101,116,104,111,100,78,99,59,0,0,
     0,4,0,0,0,3,0,0,0,4,0,0,0,4,0,0,
     0,2,0,0,0,0,0,0,0,4,0,0,0,12,0,0,
@@ -1249,7 +1249,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,0,2,0,0,2,8,1,3,1,17,1,26,2,6,12,
     51,0,33,2,17,84,6,0,51,0,76,53,2,254,54,7,
     3,253,4,9,1,73,8,2,0,84,29,0,53,4,251,57,
-    9,4,10,1,4,11,0,52,0,5,250,57,4,51,6,57,
+    9,4,10,1,4,11,0,52,0,5,250,121,4,122,6,57,
     5,71,10,2,1,76,51,0,76,114,243,0,0,0,99,38,
     0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,4,
     0,0,0,1,0,0,0,0,0,0,0,3,0,0,0,11,
@@ -1273,7 +1273,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,114,133,0,0,0,114,17,0,0,0,114,17,0,0,0,
     114,18,0,0,0,218,11,102,105,110,100,95,109,111,100,117,
     108,101,115,6,0,0,0,2,0,0,9,18,1,6,11,49,
-    0,54,7,2,255,4,9,1,4,10,2,73,8,3,0,57,
+    0,54,7,2,255,4,9,1,4,10,2,73,8,3,0,121,
     3,51,3,33,3,17,84,10,0,52,3,4,254,80,5,0,
     51,3,76,114,246,0,0,0,99,91,0,0,0,2,0,0,
     0,3,0,0,0,2,0,0,0,2,0,0,0,0,0,0,
@@ -1291,9 +1291,9 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     114,17,0,0,0,114,18,0,0,0,114,210,0,0,0,115,
     12,0,0,0,2,0,0,3,25,1,23,1,4,255,11,2,
     6,14,52,1,2,255,57,2,53,3,253,57,3,52,3,4,
-    252,2,3,34,2,17,2,2,84,41,0,53,5,250,57,7,
+    252,2,3,34,2,17,2,2,84,41,0,53,5,250,121,7,
     51,6,54,11,7,249,52,1,2,248,57,13,73,12,2,0,
-    57,8,52,1,2,247,57,2,51,8,57,3,71,8,1,1,
+    57,8,52,1,2,247,121,2,122,8,57,3,71,8,1,1,
     77,53,9,245,57,5,53,10,243,57,6,52,6,11,242,2,
     6,57,6,4,7,1,71,6,2,0,76,114,210,0,0,0,
     99,31,0,0,0,2,0,0,0,3,0,0,0,2,0,0,
@@ -1359,9 +1359,9 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     1,10,7,5,1,10,4,5,1,5,1,16,4,5,1,5,
     1,16,4,5,1,5,1,16,4,6,19,50,0,254,58,1,
     51,2,58,3,51,4,58,5,51,6,58,7,50,8,252,57,
-    14,107,9,57,15,71,15,1,0,58,10,50,11,250,57,14,
-    51,12,57,15,51,12,57,16,107,13,2,16,2,15,57,15,
-    71,15,1,0,58,14,50,11,250,57,14,51,12,57,15,107,
+    14,107,9,57,15,71,15,1,0,58,10,50,11,250,121,14,
+    122,12,121,15,122,12,57,16,107,13,2,16,2,15,57,15,
+    71,15,1,0,58,14,50,11,250,121,14,122,12,57,15,107,
     15,2,15,57,15,71,15,1,0,58,16,50,11,250,57,14,
     107,17,57,15,71,15,1,0,58,18,50,11,250,57,14,107,
     19,57,15,71,15,1,0,58,20,50,11,250,57,14,50,21,
@@ -1413,7 +1413,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     18,0,0,0,114,243,0,0,0,115,8,0,0,0,2,0,
     0,2,17,1,26,2,6,12,53,2,254,54,7,3,253,4,
     9,1,73,8,2,0,84,29,0,53,4,251,57,9,4,10,
-    1,4,11,0,52,0,5,250,57,4,51,6,57,5,71,10,
+    1,4,11,0,52,0,5,250,121,4,122,6,57,5,71,10,
     2,1,76,51,0,76,114,243,0,0,0,99,27,0,0,0,
     3,0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,
     1,0,0,0,0,0,0,0,3,0,0,0,9,0,0,0,
@@ -1460,9 +1460,9 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,114,211,0,0,0,115,12,0,0,0,2,0,0,2,14,
     1,18,1,32,2,27,1,6,15,52,0,2,255,57,3,52,
     3,3,254,2,3,57,1,53,4,252,54,6,5,251,4,8,
-    1,73,7,2,0,16,84,35,0,53,6,249,57,8,51,7,
+    1,73,7,2,0,16,84,35,0,53,6,249,121,8,51,7,
     54,12,8,248,4,14,1,73,13,2,0,57,9,4,3,1,
-    51,9,57,4,71,9,1,1,77,53,10,246,57,6,53,4,
+    122,9,57,4,71,9,1,1,77,53,10,246,57,6,53,4,
     252,57,7,52,7,11,245,2,7,57,7,4,8,1,71,7,
     2,0,57,2,53,12,243,57,6,4,7,2,52,0,13,242,
     57,8,71,7,2,0,1,51,0,76,114,211,0,0,0,99,
@@ -1533,8 +1533,8 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     16,4,5,1,5,1,16,4,5,1,5,1,6,19,50,0,
     254,58,1,51,2,58,3,51,4,58,5,51,6,58,7,50,
     8,252,57,14,107,9,57,15,71,15,1,0,58,10,50,11,
-    250,57,14,51,12,57,15,51,12,57,16,107,13,2,16,2,
-    15,57,15,71,15,1,0,58,14,50,11,250,57,14,51,12,
+    250,121,14,122,12,121,15,122,12,57,16,107,13,2,16,2,
+    15,57,15,71,15,1,0,58,14,50,11,250,121,14,122,12,
     57,15,107,15,2,15,57,15,71,15,1,0,58,16,50,11,
     250,57,14,107,17,57,15,71,15,1,0,58,18,50,8,252,
     57,14,107,19,57,15,71,15,1,0,58,20,50,11,250,57,
@@ -1605,11 +1605,11 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     118,101,108,218,4,98,105,116,115,218,4,98,97,115,101,114,
     17,0,0,0,114,17,0,0,0,114,18,0,0,0,114,38,
     1,0,0,115,12,0,0,0,2,0,0,2,22,1,24,1,
-    14,1,6,1,6,12,49,1,54,8,2,255,51,3,57,10,
+    14,1,6,1,6,12,49,1,54,8,2,255,122,3,121,10,
     51,4,24,2,57,11,73,9,3,0,57,3,53,5,253,57,
-    8,4,9,3,71,9,1,0,57,5,49,2,35,0,5,2,
-    5,84,17,0,53,6,251,57,8,51,7,57,9,71,9,1,
-    0,77,51,8,25,3,57,4,49,0,84,22,0,51,9,54,
+    8,4,9,3,71,9,1,0,120,5,49,2,35,0,5,2,
+    5,84,17,0,53,6,251,121,8,122,7,57,9,71,9,1,
+    0,77,51,8,25,3,120,4,49,0,84,22,0,51,9,54,
     8,10,250,4,10,4,4,11,0,73,9,3,0,80,5,0,
     49,4,76,114,38,1,0,0,99,46,0,0,0,3,0,0,
     0,3,0,0,0,3,0,0,0,4,0,0,0,0,0,0,
@@ -1622,7 +1622,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     114,17,0,0,0,114,17,0,0,0,114,18,0,0,0,114,
     47,1,0,0,115,10,0,0,0,2,0,0,3,18,1,7,
     1,3,1,6,11,49,0,54,7,2,255,4,9,1,4,10,
-    2,73,8,3,0,57,3,51,0,33,3,84,6,0,51,0,
+    2,73,8,3,0,121,3,51,0,33,3,84,6,0,51,0,
     76,53,3,253,57,7,4,8,1,4,9,3,71,8,2,0,
     76,114,47,1,0,0,99,26,1,0,0,3,0,0,0,3,
     0,0,0,3,0,0,0,10,0,0,0,1,0,0,0,0,
@@ -1653,20 +1653,20 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     14,3,6,1,21,5,15,1,9,1,12,2,9,1,7,1,
     20,1,7,1,14,2,20,1,8,2,23,1,21,2,9,1,
     7,4,9,2,7,1,5,2,5,2,5,229,4,29,6,22,
-    53,2,254,57,10,52,10,3,253,2,10,57,3,51,4,33,
-    3,84,17,0,53,5,251,57,13,51,6,57,14,71,14,1,
-    0,77,49,3,16,84,24,0,53,7,249,54,13,8,248,51,
+    53,2,254,57,10,52,10,3,253,2,10,121,3,51,4,33,
+    3,84,17,0,53,5,251,121,13,122,6,57,14,71,14,1,
+    0,77,49,3,16,84,24,0,53,7,249,54,13,8,248,122,
     9,57,15,53,10,246,57,16,73,14,3,0,1,53,2,254,
-    57,10,52,10,11,245,2,10,34,0,57,4,49,3,86,10,
+    57,10,52,10,11,245,2,10,34,0,120,4,49,3,86,10,
     80,193,0,57,5,53,12,243,57,14,71,15,0,0,108,11,
     1,52,5,13,242,57,6,80,51,0,53,14,240,83,13,43,
     0,53,15,238,57,18,4,19,5,4,20,0,4,21,1,71,
-    19,3,0,57,7,51,4,33,7,84,10,0,97,13,109,11,
+    19,3,0,121,7,51,4,33,7,84,10,0,97,13,109,11,
     80,129,0,97,13,80,23,0,99,13,4,16,6,4,17,0,
     4,18,1,4,19,2,71,17,3,0,57,7,109,11,51,4,
     33,7,17,84,94,0,49,4,16,81,17,0,1,53,2,254,
     57,11,52,11,11,237,2,11,34,0,84,66,0,53,2,254,
-    57,11,52,11,11,236,2,11,57,11,49,0,25,11,2,11,
+    57,11,52,11,11,236,2,11,120,11,49,0,25,11,2,11,
     57,8,52,8,16,235,57,9,80,19,0,53,14,240,83,11,
     11,0,49,7,97,11,2,10,76,99,11,51,4,33,9,84,
     8,0,49,7,2,10,76,49,9,2,10,76,49,7,2,10,
@@ -1697,15 +1697,15 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,0,0,2,0,0,2,21,1,36,1,8,1,14,1,8,
     1,21,1,14,1,6,1,14,2,15,1,6,17,53,2,254,
     57,6,4,7,0,53,3,252,57,8,71,7,2,0,16,84,
-    39,0,53,4,250,57,6,51,5,54,10,6,249,53,7,247,
+    39,0,53,4,250,121,6,51,5,54,10,6,249,53,7,247,
     57,15,4,16,0,71,16,1,0,57,12,73,11,2,0,57,
-    7,71,7,1,0,77,51,8,35,0,2,84,17,0,53,9,
-    245,57,6,51,10,57,7,71,7,1,0,77,51,8,35,4,
+    7,71,7,1,0,77,51,8,123,0,2,84,17,0,53,9,
+    245,121,6,122,10,57,7,71,7,1,0,77,51,8,123,4,
     2,84,58,0,53,2,254,57,6,4,7,1,53,3,252,57,
-    8,71,7,2,0,16,84,17,0,53,4,250,57,6,51,11,
+    8,71,7,2,0,16,84,17,0,53,4,250,121,6,122,11,
     57,7,71,7,1,0,77,49,1,16,84,17,0,53,12,243,
-    57,6,51,13,57,7,71,7,1,0,77,49,0,16,81,9,
-    0,1,51,8,35,2,2,84,17,0,53,9,245,57,6,51,
+    121,6,122,13,57,7,71,7,1,0,77,49,0,16,81,9,
+    0,1,51,8,123,2,2,84,17,0,53,9,245,121,6,122,
     14,57,7,71,7,1,0,77,51,15,76,114,59,1,0,0,
     218,16,78,111,32,109,111,100,117,108,101,32,110,97,109,101,
     100,32,218,15,95,69,82,82,95,77,83,71,95,80,82,69,
@@ -1738,29 +1738,29 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,0,1,4,1,24,1,5,1,17,1,16,2,16,1,20,
     1,21,2,9,1,7,1,27,1,32,1,17,1,7,1,33,
     2,14,1,5,2,21,1,24,2,22,1,7,1,30,1,27,
-    1,6,21,51,0,57,2,49,0,54,12,2,255,51,3,57,
-    14,73,13,2,0,57,9,51,4,25,9,2,9,57,3,49,
+    1,6,21,122,0,120,2,49,0,54,12,2,255,122,3,57,
+    14,73,13,2,0,121,9,51,4,25,9,2,9,120,3,49,
     3,84,168,0,53,5,253,57,9,52,9,6,252,2,9,34,
     3,17,84,19,0,53,7,250,57,12,4,13,1,4,14,3,
     71,13,2,0,1,53,5,253,57,9,52,9,6,249,2,9,
     34,0,84,23,0,53,5,253,57,9,52,9,6,248,2,9,
-    57,9,49,0,25,9,2,9,76,53,5,253,57,9,52,9,
-    6,247,2,9,57,9,49,3,25,9,2,9,57,4,52,4,
+    120,9,49,0,25,9,2,9,76,53,5,253,57,9,52,9,
+    6,247,2,9,120,9,49,3,25,9,2,9,57,4,52,4,
     8,246,57,2,80,69,0,53,9,244,83,9,61,0,53,10,
-    242,57,11,51,11,23,11,2,11,54,14,12,241,4,16,0,
+    242,121,11,51,11,23,11,2,11,54,14,12,241,4,16,0,
     4,17,3,73,15,3,0,57,5,53,13,239,57,16,4,17,
-    5,4,11,0,51,14,57,12,71,17,1,1,57,11,51,0,
+    5,4,11,0,122,14,57,12,71,17,1,1,121,11,122,0,
     57,12,75,9,11,2,77,99,9,53,15,237,57,12,4,13,
-    0,4,14,2,71,13,2,0,57,6,51,0,33,6,84,36,
+    0,4,14,2,71,13,2,0,121,6,51,0,33,6,84,36,
     0,53,13,239,57,14,53,10,242,54,18,12,236,4,20,0,
-    73,19,2,0,57,15,4,9,0,51,14,57,10,71,15,1,
-    1,77,53,16,234,57,12,4,13,6,71,13,1,0,57,7,
+    73,19,2,0,57,15,4,9,0,122,14,57,10,71,15,1,
+    1,77,53,16,234,57,12,4,13,6,71,13,1,0,120,7,
     49,3,84,134,0,53,5,253,57,9,52,9,6,233,2,9,
-    57,9,49,3,25,9,2,9,57,4,49,0,54,12,2,232,
-    51,3,57,14,73,13,2,0,57,9,51,17,25,9,2,9,
+    120,9,49,3,25,9,2,9,120,4,49,0,54,12,2,232,
+    122,3,57,14,73,13,2,0,121,9,51,17,25,9,2,9,
     57,8,53,18,230,57,12,4,13,4,4,14,8,4,15,7,
-    71,13,3,0,1,80,67,0,53,9,244,83,9,59,0,51,
-    19,57,11,49,3,74,2,74,4,57,12,51,20,57,13,49,
+    71,13,3,0,1,80,67,0,53,9,244,83,9,59,0,122,
+    19,120,11,49,3,74,2,74,4,121,12,122,20,120,13,49,
     8,74,2,74,4,57,14,75,6,11,4,57,5,53,21,228,
     54,14,22,227,4,16,5,53,23,225,57,17,73,15,3,0,
     1,97,9,80,5,0,99,9,49,7,76,114,73,1,0,0,
@@ -1789,7 +1789,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     57,2,53,6,248,33,2,84,21,0,53,7,246,57,9,4,
     10,0,4,11,1,71,10,2,0,109,4,76,109,4,51,8,
     33,2,84,38,0,51,9,54,7,10,245,4,9,0,73,8,
-    2,0,57,3,53,11,243,57,9,4,10,3,4,4,0,51,
+    2,0,57,3,53,11,243,57,9,4,10,3,4,4,0,122,
     12,57,5,71,10,1,1,77,53,13,241,57,7,4,8,0,
     71,8,1,0,1,49,2,76,114,85,1,0,0,114,36,0,
     0,0,99,67,0,0,0,3,0,0,0,3,0,0,0,3,
@@ -1823,7 +1823,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,114,17,0,0,0,114,18,0,0,0,114,88,1,0,0,
     115,10,0,0,0,2,0,0,9,19,1,8,1,20,1,6,
     10,53,2,254,57,6,4,7,0,4,8,1,4,9,2,71,
-    7,3,0,1,51,3,35,4,2,84,23,0,53,4,252,57,
+    7,3,0,1,51,3,123,4,2,84,23,0,53,4,252,57,
     6,4,7,0,4,8,1,4,9,2,71,7,3,0,57,0,
     53,5,250,57,6,4,7,0,53,1,248,57,8,71,7,2,
     0,76,114,88,1,0,0,99,75,1,0,0,3,0,32,0,
@@ -1869,23 +1869,23 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     1,11,4,17,1,36,255,3,2,7,1,12,233,4,24,6,
     21,49,1,86,8,80,62,1,57,4,53,2,254,57,12,4,
     13,4,53,3,252,57,14,71,13,2,0,16,84,83,0,49,
-    3,84,20,0,52,0,4,251,57,9,51,5,23,9,2,9,
-    57,5,80,7,0,51,6,57,5,53,7,249,57,12,51,8,
-    57,13,49,5,74,4,57,14,51,9,57,15,53,10,247,57,
+    3,84,20,0,52,0,4,251,121,9,51,5,23,9,2,9,
+    57,5,80,7,0,122,6,57,5,53,7,249,121,12,122,8,
+    120,13,49,5,74,4,121,14,122,9,57,15,53,10,247,57,
     19,4,20,4,71,20,1,0,57,16,52,16,4,246,2,16,
     74,4,57,16,75,6,13,4,57,13,71,13,1,0,77,51,
-    11,35,2,4,84,62,0,49,3,16,81,20,0,1,53,12,
-    244,57,12,4,13,0,51,13,57,14,71,13,2,0,84,33,
+    11,123,2,4,84,62,0,49,3,16,81,20,0,1,53,12,
+    244,57,12,4,13,0,122,13,57,14,71,13,2,0,84,33,
     0,53,1,242,57,14,4,15,0,52,0,13,241,57,16,4,
-    17,2,51,14,57,9,51,15,57,10,71,15,3,1,1,80,
+    17,2,122,14,121,9,122,15,57,10,71,15,3,1,1,80,
     148,0,53,12,244,57,12,4,13,0,4,14,4,71,13,2,
     0,16,84,129,0,51,16,54,12,17,240,52,0,4,239,57,
     14,4,15,4,73,13,3,0,57,6,53,18,237,57,12,4,
     13,2,4,14,6,71,13,2,0,1,80,89,0,53,19,235,
-    83,9,81,0,49,10,57,7,52,7,20,234,57,11,49,6,
+    83,9,81,0,49,10,57,7,52,7,20,234,120,11,49,6,
     35,2,11,2,11,81,40,0,1,53,21,232,57,11,52,11,
     22,231,2,11,54,14,23,230,4,16,6,53,24,228,57,17,
-    73,15,3,0,57,11,51,25,33,11,17,2,11,84,10,0,
+    73,15,3,0,121,11,51,25,33,11,17,2,11,84,10,0,
     2,7,97,9,80,15,0,77,2,7,99,11,97,9,80,5,
     0,99,9,88,8,197,254,49,0,76,114,90,1,0,0,99,
     226,0,0,0,1,0,0,0,3,0,0,0,1,0,0,0,
@@ -1923,21 +1923,21 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     2,0,0,7,16,1,16,1,8,1,19,1,17,1,2,255,
     10,1,4,255,16,2,3,254,2,2,2,254,11,3,3,1,
     8,1,5,2,17,2,3,254,2,2,2,254,11,3,6,1,
-    14,1,24,1,6,14,49,0,54,6,2,255,51,3,57,8,
-    73,7,2,0,57,1,49,0,54,6,2,254,51,4,57,8,
-    73,7,2,0,57,2,51,5,33,1,17,84,92,0,51,5,
-    33,2,17,81,11,0,1,52,2,6,253,35,3,1,84,70,
-    0,53,7,251,57,3,52,3,8,250,2,3,57,8,51,9,
-    57,9,49,1,74,2,74,4,57,10,51,10,57,11,52,2,
-    6,249,74,2,74,4,57,12,51,11,57,13,75,6,9,5,
-    57,9,53,12,247,57,10,51,13,57,3,51,14,57,4,71,
+    14,1,24,1,6,14,49,0,54,6,2,255,122,3,57,8,
+    73,7,2,0,120,1,49,0,54,6,2,254,122,4,57,8,
+    73,7,2,0,121,2,51,5,33,1,17,84,92,0,51,5,
+    33,2,17,81,11,0,1,52,2,6,253,123,3,1,84,70,
+    0,53,7,251,57,3,52,3,8,250,2,3,121,8,122,9,
+    120,9,49,1,74,2,74,4,121,10,122,10,57,11,52,2,
+    6,249,74,2,74,4,121,12,122,11,57,13,75,6,9,5,
+    57,9,53,12,247,121,10,122,13,121,3,122,14,57,4,71,
     9,2,1,1,49,1,76,51,5,33,2,17,84,8,0,52,
-    2,6,246,76,53,7,251,57,3,52,3,8,245,2,3,57,
-    8,51,15,57,9,53,12,247,57,10,51,13,57,3,51,14,
-    57,4,71,9,2,1,1,51,16,25,0,57,1,51,17,57,
+    2,6,246,76,53,7,251,57,3,52,3,8,245,2,3,121,
+    8,122,15,57,9,53,12,247,121,10,122,13,121,3,122,14,
+    57,4,71,9,2,1,1,51,16,25,0,121,1,122,17,120,
     3,49,0,34,3,17,2,3,84,27,0,49,1,54,6,18,
-    244,51,19,57,8,73,7,2,0,57,3,51,20,25,3,2,
-    3,57,1,49,1,76,114,105,1,0,0,114,17,0,0,0,
+    244,122,19,57,8,73,7,2,0,121,3,51,20,25,3,2,
+    3,120,1,49,1,76,114,105,1,0,0,114,17,0,0,0,
     99,38,1,0,0,5,0,0,0,3,0,0,0,5,0,0,
     0,9,0,0,0,4,0,0,0,0,0,0,0,5,0,0,
     0,20,0,0,0,15,0,0,0,17,0,0,0,0,0,0,
@@ -1986,23 +1986,23 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,114,18,0,0,0,114,115,1,0,0,115,32,0,0,0,
     2,0,0,11,8,1,17,2,17,1,14,1,20,1,6,3,
     8,1,34,1,6,1,3,4,53,3,63,1,19,1,21,2,
-    6,20,51,2,35,2,4,84,20,0,53,3,254,57,12,4,
+    6,20,51,2,123,2,4,84,20,0,53,3,254,57,12,4,
     13,0,71,13,1,0,57,5,80,54,0,51,4,33,1,17,
     84,8,0,49,1,80,5,0,96,0,57,6,53,5,252,57,
     12,4,13,6,71,13,1,0,57,7,53,3,254,57,12,4,
-    13,0,4,14,7,4,15,4,71,13,3,0,57,5,49,3,
-    16,84,170,0,51,2,35,2,4,84,37,0,53,3,254,57,
-    12,49,0,54,16,6,251,51,7,57,18,73,17,2,0,57,
+    13,0,4,14,7,4,15,4,71,13,3,0,120,5,49,3,
+    16,84,170,0,51,2,123,2,4,84,37,0,53,3,254,120,
+    12,49,0,54,16,6,251,122,7,57,18,73,17,2,0,121,
     13,51,2,25,13,2,13,57,13,71,13,1,0,76,49,0,
     16,84,6,0,49,5,76,53,8,249,57,12,4,13,0,71,
-    13,1,0,57,9,53,8,249,57,13,49,0,54,17,6,248,
-    51,7,57,19,73,18,2,0,57,14,51,2,25,14,2,14,
+    13,1,0,57,9,53,8,249,120,13,49,0,54,17,6,248,
+    122,7,57,19,73,18,2,0,121,14,51,2,25,14,2,14,
     57,14,71,14,1,0,24,9,2,9,57,8,53,9,246,57,
-    9,52,9,10,245,2,9,57,9,52,5,11,244,57,10,51,
+    9,52,9,10,245,2,9,57,9,52,5,11,244,121,10,122,
     4,57,11,53,8,249,57,15,52,5,11,243,57,16,71,16,
-    1,0,57,12,49,8,24,12,2,12,57,12,51,4,57,13,
+    1,0,120,12,49,8,24,12,2,12,121,12,122,4,57,13,
     92,11,25,10,2,10,25,9,2,9,76,53,12,241,57,12,
-    4,13,5,51,13,57,14,71,13,2,0,84,24,0,53,14,
+    4,13,5,122,13,57,14,71,13,2,0,84,24,0,53,14,
     239,57,12,4,13,5,4,14,3,53,3,254,57,15,71,13,
     3,0,76,49,5,76,114,115,1,0,0,99,60,0,0,0,
     1,0,0,0,3,0,0,0,1,0,0,0,2,0,0,0,
@@ -2016,8 +2016,8 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     41,2,114,22,0,0,0,114,133,0,0,0,114,17,0,0,
     0,114,17,0,0,0,114,18,0,0,0,114,120,1,0,0,
     115,10,0,0,0,2,0,0,1,16,1,7,1,22,1,6,
-    8,53,2,254,54,5,3,253,4,7,0,73,6,2,0,57,
-    1,51,0,33,1,84,25,0,53,4,251,57,5,51,5,57,
+    8,53,2,254,54,5,3,253,4,7,0,73,6,2,0,121,
+    1,51,0,33,1,84,25,0,53,4,251,121,5,122,5,120,
     6,49,0,23,6,2,6,57,6,71,6,1,0,77,53,6,
     249,57,5,4,6,1,71,6,1,0,76,114,120,1,0,0,
     99,23,1,0,0,2,0,0,0,3,0,0,0,2,0,0,
@@ -2068,11 +2068,11 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     53,12,238,57,14,4,15,4,4,16,5,71,15,2,0,57,
     6,53,13,236,57,14,4,15,6,4,16,4,71,15,2,0,
     1,88,10,143,255,53,3,252,57,10,52,10,5,235,2,10,
-    57,10,53,14,233,25,10,2,10,57,7,51,15,86,10,80,
+    57,10,53,14,233,25,10,2,10,121,7,51,15,86,10,80,
     79,0,57,8,53,3,252,57,11,52,11,5,232,2,11,34,
     8,17,84,20,0,53,16,230,57,14,4,15,8,71,15,1,
     0,57,9,80,24,0,53,3,252,57,11,52,11,5,229,2,
-    11,57,11,49,8,25,11,2,11,57,9,53,17,227,57,14,
+    11,120,11,49,8,25,11,2,11,57,9,53,17,227,57,14,
     4,15,7,4,16,8,4,17,9,71,15,3,0,1,88,10,
     180,255,51,18,76,114,123,1,0,0,99,71,0,0,0,2,
     0,0,0,3,0,0,0,2,0,0,0,2,0,0,0,0,
@@ -2108,7 +2108,7 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     0,78,162,4,0,0,41,1,114,137,1,0,0,114,17,0,
     0,0,114,17,0,0,0,114,18,0,0,0,114,135,1,0,
     0,115,8,0,0,0,2,0,0,3,4,1,4,1,6,7,
-    89,2,57,0,49,0,61,3,49,0,54,4,4,255,53,5,
+    89,2,120,0,49,0,61,3,49,0,54,4,4,255,53,5,
     253,57,6,52,6,6,252,2,6,57,6,53,7,250,25,6,
     2,6,57,6,73,5,2,0,1,51,8,76,114,135,1,0,
     0,1,0,0,0,41,1,114,26,0,0,0,114,17,0,0,
@@ -2121,28 +2121,28 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     4,16,4,1,13,2,4,32,11,3,4,16,16,15,10,37,
     4,27,28,37,4,7,4,35,4,8,6,8,51,0,58,1,
     51,2,61,3,107,4,58,5,107,6,58,7,96,0,58,8,
-    96,0,58,9,100,57,4,107,10,57,5,51,11,57,6,50,
-    12,254,57,7,71,5,3,0,58,11,100,57,4,107,13,57,
-    5,51,14,57,6,71,5,2,0,58,14,100,57,4,107,15,
-    57,5,51,16,57,6,71,5,2,0,58,16,100,57,4,107,
-    17,57,5,51,18,57,6,71,5,2,0,58,18,107,19,58,
-    20,107,21,58,22,107,23,58,24,51,25,57,1,107,26,2,
+    96,0,58,9,100,57,4,107,10,121,5,122,11,57,6,50,
+    12,254,57,7,71,5,3,0,58,11,100,57,4,107,13,121,
+    5,122,14,57,6,71,5,2,0,58,14,100,57,4,107,15,
+    121,5,122,16,57,6,71,5,2,0,58,16,100,57,4,107,
+    17,121,5,122,18,57,6,71,5,2,0,58,18,107,19,58,
+    20,107,21,58,22,107,23,58,24,122,25,57,1,107,26,2,
     1,58,27,107,28,58,29,107,30,58,31,107,32,58,33,107,
-    34,58,35,100,57,4,107,36,57,5,51,37,57,6,71,5,
-    2,0,58,37,51,2,57,1,51,2,57,2,107,38,2,2,
-    2,1,58,39,51,2,57,1,51,2,57,2,107,40,2,2,
-    2,1,58,41,51,42,57,1,107,43,2,1,58,44,107,45,
+    34,58,35,100,57,4,107,36,121,5,122,37,57,6,71,5,
+    2,0,58,37,122,2,121,1,122,2,57,2,107,38,2,2,
+    2,1,58,39,122,2,121,1,122,2,57,2,107,40,2,2,
+    2,1,58,41,122,42,57,1,107,43,2,1,58,44,107,45,
     58,46,107,47,58,48,107,49,58,50,107,51,58,52,107,53,
-    58,54,107,55,58,56,100,57,4,107,57,57,5,51,58,57,
-    6,71,5,2,0,58,58,100,57,4,107,59,57,5,51,60,
-    57,6,71,5,2,0,58,60,100,57,4,107,61,57,5,51,
+    58,54,107,55,58,56,100,57,4,107,57,121,5,122,58,57,
+    6,71,5,2,0,58,58,100,57,4,107,59,121,5,122,60,
+    57,6,71,5,2,0,58,60,100,57,4,107,61,121,5,122,
     62,57,6,71,5,2,0,58,62,107,63,58,64,107,65,58,
-    66,51,2,57,1,107,67,2,1,58,68,107,69,58,70,51,
-    71,58,72,50,72,252,57,1,51,73,23,1,2,1,58,74,
+    66,122,2,57,1,107,67,2,1,58,68,107,69,58,70,51,
+    71,58,72,50,72,252,121,1,51,73,23,1,2,1,58,74,
     107,75,58,76,50,77,250,57,4,71,5,0,0,58,78,107,
-    79,58,80,51,2,57,1,51,81,57,2,107,82,2,2,2,
-    1,58,83,51,42,57,1,107,84,2,1,58,85,107,86,58,
-    87,51,2,57,1,51,2,57,2,51,88,57,3,51,81,57,
+    79,58,80,122,2,121,1,122,81,57,2,107,82,2,2,2,
+    1,58,83,122,42,57,1,107,84,2,1,58,85,107,86,58,
+    87,122,2,121,1,122,2,121,2,122,88,121,3,122,81,57,
     4,107,89,2,4,2,3,2,2,2,1,58,90,107,91,58,
     92,107,93,58,94,107,95,58,96,107,97,58,98,51,2,76,
 };
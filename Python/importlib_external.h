@@ -1,8 +1,8 @@
 /* Auto-generated by Programs/_freeze_importlib.c */
 const unsigned char _Py_M__importlib_bootstrap_external[] = {
-    99,29,3,0,0,0,0,128,0,0,0,0,0,0,0,0,
+    99,33,3,0,0,0,0,128,0,0,0,0,0,0,0,0,
     0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,10,0,0,0,152,0,0,0,39,0,0,0,0,0,0,
+    0,10,0,0,0,153,0,0,0,39,0,0,0,0,0,0,
     0,0,0,0,0,0,0,0,0,0,0,0,0,193,94,1,
     0,0,67,111,114,101,32,105,109,112,108,101,109,101,110,116,
     97,116,105,111,110,32,111,102,32,112,97,116,104,45,98,97,
@@ -50,7 +50,7 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     105,109,112,111,114,116,108,105,98,46,95,98,111,111,116,115,
     116,114,97,112,95,101,120,116,101,114,110,97,108,62,114,27,
     0,0,0,115,2,0,0,0,2,0,6,7,80,28,0,57,
-    1,53,2,254,57,5,4,6,1,71,6,1,0,57,2,51,
+    1,53,2,254,57,5,4,6,1,71,6,1,0,121,2,51,
     3,35,2,2,2,2,78,1,88,0,231,255,51,0,76,114,
     4,0,0,0,218,8,112,97,116,104,95,115,101,112,218,5,
     116,117,112,108,101,218,14,112,97,116,104,95,115,101,112,95,
@@ -62,7 +62,7 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     116,99,111,109,112,62,250,1,58,47,0,0,0,41,2,122,
     2,46,48,218,1,115,114,31,0,0,0,114,31,0,0,0,
     114,32,0,0,0,114,38,0,0,0,115,2,0,0,0,2,
-    0,6,5,95,0,0,57,2,80,21,0,57,1,51,2,57,
+    0,6,5,95,0,0,57,2,80,21,0,121,1,122,2,120,
     3,49,1,74,4,57,4,75,6,3,2,113,2,88,0,238,
     255,49,2,2,2,76,218,20,95,112,97,116,104,115,101,112,
     115,95,119,105,116,104,95,99,111,108,111,110,169,1,218,3,
@@ -123,7 +123,7 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     7,73,6,2,0,84,48,0,53,2,254,57,2,52,2,3,
     249,2,2,54,5,4,248,53,6,246,57,7,73,6,2,0,
     84,10,0,51,7,64,0,80,7,0,51,8,64,0,107,9,
-    57,1,80,7,0,107,10,57,1,49,1,76,114,50,0,0,
+    57,1,80,7,0,107,10,120,1,49,1,76,114,50,0,0,
     0,99,39,0,0,0,1,0,0,0,3,0,0,0,1,0,
     0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,
     0,0,8,0,0,0,7,0,0,0,3,0,0,0,0,0,
@@ -137,8 +137,8 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     0,0,0,41,1,218,1,120,114,31,0,0,0,114,31,0,
     0,0,114,32,0,0,0,114,63,0,0,0,115,4,0,0,
     0,2,0,0,2,6,8,53,2,254,57,4,4,5,0,71,
-    5,1,0,57,1,51,3,30,1,2,1,54,4,4,253,51,
-    5,57,6,51,6,57,7,73,5,3,0,76,114,63,0,0,
+    5,1,0,121,1,51,3,30,1,2,1,54,4,4,253,122,
+    5,121,6,122,6,57,7,73,5,3,0,76,114,63,0,0,
     0,99,47,0,0,0,1,0,0,0,3,0,0,0,1,0,
     0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,
     0,0,8,0,0,0,7,0,0,0,5,0,0,0,0,0,
@@ -152,9 +152,9 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     0,0,0,41,1,218,4,100,97,116,97,114,31,0,0,0,
     114,31,0,0,0,114,32,0,0,0,114,71,0,0,0,115,
     6,0,0,0,2,0,0,2,26,1,6,8,53,2,254,57,
-    4,4,5,0,71,5,1,0,57,1,51,3,35,2,1,2,
+    4,4,5,0,71,5,1,0,121,1,51,3,35,2,1,2,
     1,85,5,0,74,8,53,4,252,54,4,5,251,4,6,0,
-    51,6,57,7,73,5,3,0,76,114,71,0,0,0,99,47,
+    122,6,57,7,73,5,3,0,76,114,71,0,0,0,99,47,
     0,0,0,1,0,0,0,3,0,0,0,1,0,0,0,1,
     0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,8,
     0,0,0,7,0,0,0,5,0,0,0,0,0,0,0,0,
@@ -167,9 +167,9 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     114,68,0,0,0,84,0,0,0,41,1,114,73,0,0,0,
     114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,114,
     75,0,0,0,115,6,0,0,0,2,0,0,2,26,1,6,
-    8,53,2,254,57,4,4,5,0,71,5,1,0,57,1,51,
+    8,53,2,254,57,4,4,5,0,71,5,1,0,121,1,51,
     3,35,2,1,2,1,85,5,0,74,8,53,4,252,54,4,
-    5,251,4,6,0,51,6,57,7,73,5,3,0,76,114,75,
+    5,251,4,6,0,122,6,57,7,73,5,3,0,76,114,75,
     0,0,0,99,91,1,0,0,0,0,1,0,7,0,0,0,
     0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,
     0,0,0,0,12,0,0,0,20,0,0,0,22,0,0,0,
@@ -193,7 +193,7 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     0,114,0,0,0,41,2,122,2,46,48,218,1,112,114,31,
     0,0,0,114,31,0,0,0,114,32,0,0,0,218,10,60,
     108,105,115,116,99,111,109,112,62,115,2,0,0,0,2,0,
-    6,9,94,0,0,57,2,80,27,0,57,1,49,1,84,20,
+    6,9,94,0,0,57,2,80,27,0,120,1,49,1,84,20,
     0,49,1,54,6,2,255,53,3,253,57,8,73,7,2,0,
     112,2,88,0,232,255,49,2,2,2,76,114,37,0,0,0,
     91,0,0,0,41,5,218,10,112,97,116,104,95,112,97,114,
@@ -204,25 +204,25 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     1,5,1,4,1,5,1,40,1,37,1,23,1,21,1,17,
     1,30,3,4,1,11,2,17,2,10,1,14,242,4,15,14,
     1,33,2,6,1,6,12,49,0,16,84,6,0,51,2,76,
-    53,3,254,57,8,4,9,0,71,9,1,0,57,5,51,4,
-    35,2,5,2,5,84,8,0,51,5,25,0,76,51,2,57,
+    53,3,254,57,8,4,9,0,71,9,1,0,121,5,51,4,
+    35,2,5,2,5,84,8,0,51,5,25,0,76,122,2,57,
     1,94,5,0,57,2,53,6,252,57,8,53,7,250,57,9,
     52,9,8,249,2,9,57,9,4,10,0,71,9,2,0,86,
     5,80,197,0,106,6,2,0,5,3,7,5,4,6,49,3,
     54,9,9,248,53,10,246,57,11,73,10,2,0,82,19,0,
     1,49,3,54,9,11,245,53,10,246,57,11,73,10,2,0,
     84,47,0,49,3,54,9,12,244,53,13,242,57,11,73,10,
-    2,0,82,6,0,1,49,1,57,1,53,14,240,57,6,49,
+    2,0,82,6,0,1,49,1,57,1,53,14,240,120,6,49,
     4,23,6,2,6,57,6,94,6,1,57,2,80,106,0,49,
-    3,54,9,11,239,51,15,57,11,73,10,2,0,84,65,0,
-    49,1,54,9,16,238,73,10,1,0,57,6,49,3,54,10,
+    3,54,9,11,239,122,15,57,11,73,10,2,0,84,65,0,
+    49,1,54,9,16,238,73,10,1,0,120,6,49,3,54,10,
     16,237,73,11,1,0,35,3,6,2,6,84,18,0,49,3,
     57,1,4,6,4,94,6,1,57,2,80,17,0,49,2,54,
     9,17,236,4,11,4,73,10,2,0,1,80,27,0,49,3,
-    82,6,0,1,49,1,57,1,49,2,54,9,17,235,4,11,
-    4,73,10,2,0,1,88,5,62,255,107,18,57,8,49,2,
+    82,6,0,1,49,1,120,1,49,2,54,9,17,235,4,11,
+    4,73,10,2,0,1,88,5,62,255,107,18,120,8,49,2,
     86,9,71,9,1,0,57,2,53,3,254,57,8,4,9,2,
-    71,9,1,0,57,5,51,4,35,2,5,2,5,81,9,0,
+    71,9,1,0,121,5,51,4,35,2,5,2,5,81,9,0,
     1,51,5,25,2,16,84,9,0,53,14,240,23,1,76,53,
     14,240,54,8,19,234,4,10,2,73,9,2,0,23,1,76,
     114,78,0,0,0,99,28,0,0,0,0,0,1,0,7,0,
@@ -238,13 +238,13 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     0,0,0,123,0,0,0,41,2,122,2,46,48,218,4,112,
     97,114,116,114,31,0,0,0,114,31,0,0,0,114,32,0,
     0,0,114,87,0,0,0,115,6,0,0,0,2,0,10,1,
-    2,255,6,9,94,0,0,57,2,80,27,0,57,1,49,1,
+    2,255,6,9,94,0,0,57,2,80,27,0,120,1,49,1,
     84,20,0,49,1,54,6,2,255,53,3,253,57,8,73,7,
     2,0,112,2,88,0,232,255,49,2,2,2,76,121,0,0,
     0,41,1,114,88,0,0,0,114,31,0,0,0,114,31,0,
     0,0,114,32,0,0,0,114,78,0,0,0,115,8,0,0,
     0,2,0,0,2,11,1,2,255,6,11,53,2,254,54,4,
-    3,253,107,4,57,9,49,0,86,10,71,10,1,0,57,6,
+    3,253,107,4,120,9,49,0,86,10,71,10,1,0,57,6,
     73,5,2,0,76,99,101,0,0,0,1,0,8,0,3,0,
     0,0,1,0,0,0,2,0,0,0,0,0,0,0,0,0,
     0,0,1,0,0,0,11,0,0,0,9,0,0,0,4,0,
@@ -270,11 +270,11 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     90,0,0,0,114,32,0,0,0,114,95,0,0,0,115,10,
     0,0,0,2,0,0,2,26,1,8,1,12,1,6,11,53,
     2,254,57,5,107,3,57,9,53,4,252,86,10,71,10,1,
-    0,57,6,71,6,1,0,57,1,51,5,35,0,1,84,15,
-    0,51,6,57,2,55,0,57,3,93,2,2,76,55,0,57,
-    2,51,7,57,3,4,4,1,51,7,57,5,92,3,25,2,
-    2,2,57,2,55,0,57,3,51,8,23,1,57,4,51,7,
-    57,5,51,7,57,6,92,4,25,3,2,3,57,3,93,2,
+    0,57,6,71,6,1,0,121,1,51,5,123,0,1,84,15,
+    0,122,6,57,2,55,0,57,3,93,2,2,76,55,0,121,
+    2,122,7,57,3,4,4,1,122,7,57,5,92,3,25,2,
+    2,2,57,2,55,0,121,3,51,8,23,1,121,4,122,7,
+    121,5,122,7,57,6,92,4,25,3,2,3,57,3,93,2,
     2,76,114,95,0,0,0,99,17,0,0,0,1,0,0,0,
     3,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,
     0,0,0,0,1,0,0,0,7,0,0,0,4,0,0,0,
@@ -309,8 +309,8 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     114,32,0,0,0,114,104,0,0,0,115,10,0,0,0,2,
     0,0,3,17,1,7,1,7,1,6,8,53,2,254,57,6,
     4,7,0,71,7,1,0,57,2,80,17,0,53,3,252,83,
-    3,9,0,51,4,97,3,76,99,3,52,2,5,251,57,3,
-    51,6,30,3,2,3,57,3,49,1,35,2,3,2,3,76,
+    3,9,0,51,4,97,3,76,99,3,52,2,5,251,121,3,
+    51,6,30,3,2,3,120,3,49,1,35,2,3,2,3,76,
     114,104,0,0,0,99,19,0,0,0,1,0,0,0,3,0,
     0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,
     0,0,1,0,0,0,7,0,0,0,4,0,0,0,2,0,
@@ -321,7 +321,7 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     101,114,104,0,0,0,233,0,128,0,0,154,0,0,0,41,
     1,114,90,0,0,0,114,31,0,0,0,114,31,0,0,0,
     114,32,0,0,0,114,111,0,0,0,115,4,0,0,0,2,
-    0,0,2,6,7,53,2,254,57,4,4,5,0,51,3,57,
+    0,0,2,6,7,53,2,254,57,4,4,5,0,122,3,57,
     6,71,5,2,0,76,114,111,0,0,0,99,38,0,0,0,
     1,0,0,0,3,0,0,0,1,0,0,0,1,0,0,0,
     0,0,0,0,0,0,0,0,1,0,0,0,7,0,0,0,
@@ -335,7 +335,7 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     0,114,32,0,0,0,114,114,0,0,0,115,8,0,0,0,
     2,0,0,2,6,1,13,1,6,7,49,0,16,84,16,0,
     53,2,254,54,4,3,253,73,5,1,0,57,0,53,4,251,
-    57,4,4,5,0,51,5,57,6,71,5,2,0,76,114,114,
+    57,4,4,5,0,122,5,57,6,71,5,2,0,76,114,114,
     0,0,0,99,109,0,0,0,1,0,0,0,3,0,0,0,
     1,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
     1,0,0,0,9,0,0,0,14,0,0,0,8,0,0,0,
@@ -351,11 +351,11 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     0,0,114,32,0,0,0,114,118,0,0,0,115,10,0,0,
     0,2,0,0,2,6,1,3,1,40,1,6,9,49,0,16,
     84,6,0,51,2,76,53,3,254,54,5,4,253,4,7,0,
-    73,6,2,0,57,2,51,5,25,2,2,2,54,5,6,252,
-    51,7,57,7,51,8,57,8,73,6,3,0,57,1,53,9,
-    250,57,5,4,6,1,71,6,1,0,57,2,51,10,35,4,
-    2,2,2,81,36,0,1,49,1,54,5,11,249,51,12,57,
-    7,73,6,2,0,82,18,0,1,49,1,54,5,13,248,51,
+    73,6,2,0,121,2,51,5,25,2,2,2,54,5,6,252,
+    122,7,121,7,122,8,57,8,73,6,3,0,57,1,53,9,
+    250,57,5,4,6,1,71,6,1,0,121,2,51,10,35,4,
+    2,2,2,81,36,0,1,49,1,54,5,11,249,122,12,57,
+    7,73,6,2,0,82,18,0,1,49,1,54,5,13,248,122,
     8,57,7,73,6,2,0,76,114,118,0,0,0,99,18,0,
     0,0,1,0,0,0,3,0,0,0,1,0,0,0,1,0,
     0,0,0,0,0,0,0,0,0,0,1,0,0,0,7,0,
@@ -402,2967 +402,2985 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     54,9,6,250,4,11,3,53,5,251,57,12,52,12,7,249,
     2,12,57,12,53,5,251,57,13,52,13,8,248,2,13,32,
     12,2,12,57,12,53,5,251,57,13,52,13,9,247,2,13,
-    32,12,2,12,57,12,51,10,30,2,57,13,73,10,4,0,
-    57,4,53,11,245,54,9,12,244,4,11,4,51,13,57,12,
-    73,10,3,0,108,6,57,5,49,5,54,11,14,243,4,13,
+    32,12,2,12,121,12,51,10,30,2,57,13,73,10,4,0,
+    57,4,53,11,245,54,9,12,244,4,11,4,122,13,57,12,
+    73,10,3,0,108,6,120,5,49,5,54,11,14,243,4,13,
     1,73,12,2,0,1,109,6,53,5,251,54,9,15,242,4,
     11,3,4,12,0,73,10,3,0,1,80,45,0,53,16,240,
     83,6,37,0,53,5,251,54,11,17,239,4,13,3,73,12,
     2,0,1,80,17,0,53,16,240,83,8,9,0,97,8,80,
     5,0,99,8,77,99,6,51,18,76,114,123,0,0,0,218,
     4,116,121,112,101,218,8,95,95,99,111,100,101,95,95,218,
-    10,95,99,111,100,101,95,116,121,112,101,233,42,35,0,0,
+    10,95,99,111,100,101,95,116,121,112,101,233,43,35,0,0,
     114,66,0,0,0,114,76,0,0,0,114,68,0,0,0,243,
     2,0,0,0,13,10,218,12,77,65,71,73,67,95,78,85,
     77,66,69,82,114,64,0,0,0,114,72,0,0,0,218,17,
     95,82,65,87,95,77,65,71,73,67,95,78,85,77,66,69,
-    82,218,11,95,95,112,121,99,97,99,104,101,95,95,218,8,
-    95,80,89,67,65,67,72,69,218,4,111,112,116,45,218,4,
-    95,79,80,84,218,3,46,112,121,218,15,83,79,85,82,67,
-    69,95,83,85,70,70,73,88,69,83,218,4,46,112,121,99,
-    218,17,66,89,84,69,67,79,68,69,95,83,85,70,70,73,
-    88,69,83,218,23,68,69,66,85,71,95,66,89,84,69,67,
-    79,68,69,95,83,85,70,70,73,88,69,83,218,27,79,80,
-    84,73,77,73,90,69,68,95,66,89,84,69,67,79,68,69,
-    95,83,85,70,70,73,88,69,83,78,99,37,2,0,0,2,
-    0,32,0,3,0,0,0,2,0,0,0,12,0,0,0,2,
-    0,0,0,0,0,0,0,3,0,0,0,23,0,0,0,42,
-    0,0,0,47,0,0,0,0,0,0,0,2,0,0,0,0,
-    0,0,0,0,0,0,0,193,254,2,0,0,71,105,118,101,
+    82,218,16,95,112,114,101,102,101,116,99,104,101,100,95,99,
+    111,100,101,218,11,95,95,112,121,99,97,99,104,101,95,95,
+    218,8,95,80,89,67,65,67,72,69,218,4,111,112,116,45,
+    218,4,95,79,80,84,218,3,46,112,121,218,15,83,79,85,
+    82,67,69,95,83,85,70,70,73,88,69,83,218,4,46,112,
+    121,99,218,17,66,89,84,69,67,79,68,69,95,83,85,70,
+    70,73,88,69,83,218,23,68,69,66,85,71,95,66,89,84,
+    69,67,79,68,69,95,83,85,70,70,73,88,69,83,218,27,
+    79,80,84,73,77,73,90,69,68,95,66,89,84,69,67,79,
+    68,69,95,83,85,70,70,73,88,69,83,78,99,37,2,0,
+    0,2,0,32,0,3,0,0,0,2,0,0,0,12,0,0,
+    0,2,0,0,0,0,0,0,0,3,0,0,0,23,0,0,
+    0,42,0,0,0,47,0,0,0,0,0,0,0,2,0,0,
+    0,0,0,0,0,0,0,0,0,193,254,2,0,0,71,105,
+    118,101,110,32,116,104,101,32,112,97,116,104,32,116,111,32,
+    97,32,46,112,121,32,102,105,108,101,44,32,114,101,116,117,
+    114,110,32,116,104,101,32,112,97,116,104,32,116,111,32,105,
+    116,115,32,46,112,121,99,32,102,105,108,101,46,10,10,32,
+    32,32,32,84,104,101,32,46,112,121,32,102,105,108,101,32,
+    100,111,101,115,32,110,111,116,32,110,101,101,100,32,116,111,
+    32,101,120,105,115,116,59,32,116,104,105,115,32,115,105,109,
+    112,108,121,32,114,101,116,117,114,110,115,32,116,104,101,32,
+    112,97,116,104,32,116,111,32,116,104,101,10,32,32,32,32,
+    46,112,121,99,32,102,105,108,101,32,99,97,108,99,117,108,
+    97,116,101,100,32,97,115,32,105,102,32,116,104,101,32,46,
+    112,121,32,102,105,108,101,32,119,101,114,101,32,105,109,112,
+    111,114,116,101,100,46,10,10,32,32,32,32,84,104,101,32,
+    39,111,112,116,105,109,105,122,97,116,105,111,110,39,32,112,
+    97,114,97,109,101,116,101,114,32,99,111,110,116,114,111,108,
+    115,32,116,104,101,32,112,114,101,115,117,109,101,100,32,111,
+    112,116,105,109,105,122,97,116,105,111,110,32,108,101,118,101,
+    108,32,111,102,10,32,32,32,32,116,104,101,32,98,121,116,
+    101,99,111,100,101,32,102,105,108,101,46,32,73,102,32,39,
+    111,112,116,105,109,105,122,97,116,105,111,110,39,32,105,115,
+    32,110,111,116,32,78,111,110,101,44,32,116,104,101,32,115,
+    116,114,105,110,103,32,114,101,112,114,101,115,101,110,116,97,
+    116,105,111,110,10,32,32,32,32,111,102,32,116,104,101,32,
+    97,114,103,117,109,101,110,116,32,105,115,32,116,97,107,101,
+    110,32,97,110,100,32,118,101,114,105,102,105,101,100,32,116,
+    111,32,98,101,32,97,108,112,104,97,110,117,109,101,114,105,
+    99,32,40,101,108,115,101,32,86,97,108,117,101,69,114,114,
+    111,114,10,32,32,32,32,105,115,32,114,97,105,115,101,100,
+    41,46,10,10,32,32,32,32,84,104,101,32,100,101,98,117,
+    103,95,111,118,101,114,114,105,100,101,32,112,97,114,97,109,
+    101,116,101,114,32,105,115,32,100,101,112,114,101,99,97,116,
+    101,100,46,32,73,102,32,100,101,98,117,103,95,111,118,101,
+    114,114,105,100,101,32,105,115,32,110,111,116,32,78,111,110,
+    101,44,10,32,32,32,32,97,32,84,114,117,101,32,118,97,
+    108,117,101,32,105,115,32,116,104,101,32,115,97,109,101,32,
+    97,115,32,115,101,116,116,105,110,103,32,39,111,112,116,105,
+    109,105,122,97,116,105,111,110,39,32,116,111,32,116,104,101,
+    32,101,109,112,116,121,32,115,116,114,105,110,103,10,32,32,
+    32,32,119,104,105,108,101,32,97,32,70,97,108,115,101,32,
+    118,97,108,117,101,32,105,115,32,101,113,117,105,118,97,108,
+    101,110,116,32,116,111,32,115,101,116,116,105,110,103,32,39,
+    111,112,116,105,109,105,122,97,116,105,111,110,39,32,116,111,
+    32,39,49,39,46,10,10,32,32,32,32,73,102,32,115,121,
+    115,46,105,109,112,108,101,109,101,110,116,97,116,105,111,110,
+    46,99,97,99,104,101,95,116,97,103,32,105,115,32,78,111,
+    110,101,32,116,104,101,110,32,78,111,116,73,109,112,108,101,
+    109,101,110,116,101,100,69,114,114,111,114,32,105,115,32,114,
+    97,105,115,101,100,46,10,10,32,32,32,32,218,17,99,97,
+    99,104,101,95,102,114,111,109,95,115,111,117,114,99,101,78,
+    114,10,0,0,0,218,4,119,97,114,110,218,70,116,104,101,
+    32,100,101,98,117,103,95,111,118,101,114,114,105,100,101,32,
+    112,97,114,97,109,101,116,101,114,32,105,115,32,100,101,112,
+    114,101,99,97,116,101,100,59,32,117,115,101,32,39,111,112,
+    116,105,109,105,122,97,116,105,111,110,39,32,105,110,115,116,
+    101,97,100,218,18,68,101,112,114,101,99,97,116,105,111,110,
+    87,97,114,110,105,110,103,218,50,100,101,98,117,103,95,111,
+    118,101,114,114,105,100,101,32,111,114,32,111,112,116,105,109,
+    105,122,97,116,105,111,110,32,109,117,115,116,32,98,101,32,
+    115,101,116,32,116,111,32,78,111,110,101,218,9,84,121,112,
+    101,69,114,114,111,114,114,36,0,0,0,114,29,0,0,0,
+    114,18,0,0,0,218,6,102,115,112,97,116,104,114,95,0,
+    0,0,218,10,114,112,97,114,116,105,116,105,111,110,218,1,
+    46,114,8,0,0,0,218,14,105,109,112,108,101,109,101,110,
+    116,97,116,105,111,110,218,9,99,97,99,104,101,95,116,97,
+    103,218,19,78,111,116,73,109,112,108,101,109,101,110,116,101,
+    100,69,114,114,111,114,218,36,115,121,115,46,105,109,112,108,
+    101,109,101,110,116,97,116,105,111,110,46,99,97,99,104,101,
+    95,116,97,103,32,105,115,32,78,111,110,101,114,37,0,0,
+    0,114,56,0,0,0,218,8,111,112,116,105,109,105,122,101,
+    114,4,0,0,0,218,3,115,116,114,218,7,105,115,97,108,
+    110,117,109,218,10,86,97,108,117,101,69,114,114,111,114,218,
+    24,123,33,114,125,32,105,115,32,110,111,116,32,97,108,112,
+    104,97,110,117,109,101,114,105,99,114,125,0,0,0,218,7,
+    123,125,46,123,125,123,125,114,149,0,0,0,114,153,0,0,
+    0,218,14,112,121,99,97,99,104,101,95,112,114,101,102,105,
+    120,114,118,0,0,0,114,78,0,0,0,114,115,0,0,0,
+    114,39,0,0,0,114,25,0,0,0,186,114,76,0,0,0,
+    78,78,218,6,108,115,116,114,105,112,114,147,0,0,0,1,
+    0,0,0,1,0,0,0,2,0,0,0,2,0,0,0,112,
+    1,0,0,41,12,114,90,0,0,0,218,14,100,101,98,117,
+    103,95,111,118,101,114,114,105,100,101,218,12,111,112,116,105,
+    109,105,122,97,116,105,111,110,218,7,109,101,115,115,97,103,
+    101,218,4,104,101,97,100,114,92,0,0,0,218,4,98,97,
+    115,101,114,30,0,0,0,218,4,114,101,115,116,218,3,116,
+    97,103,218,15,97,108,109,111,115,116,95,102,105,108,101,110,
+    97,109,101,218,8,102,105,108,101,110,97,109,101,114,31,0,
+    0,0,114,31,0,0,0,114,32,0,0,0,114,157,0,0,
+    0,115,74,0,0,0,2,0,0,18,8,1,11,1,3,255,
+    7,2,8,1,4,1,13,1,14,1,16,1,22,1,27,1,
+    21,1,7,1,14,1,37,1,7,1,31,1,7,2,21,1,
+    14,1,8,1,14,1,25,1,23,1,15,1,23,9,16,1,
+    27,5,34,1,6,4,5,1,11,255,2,2,15,254,10,5,
+    6,23,51,2,33,1,17,84,63,0,53,3,254,54,15,4,
+    253,122,5,57,17,53,6,251,57,18,73,16,3,0,1,51,
+    2,33,2,17,84,20,0,122,7,57,3,53,8,249,57,15,
+    4,16,3,71,16,1,0,77,49,1,84,8,0,51,9,80,
+    5,0,122,10,57,2,53,11,247,54,15,12,246,4,17,0,
+    73,16,2,0,57,0,53,13,244,57,15,4,16,0,71,16,
+    1,0,106,12,2,0,5,4,13,5,5,12,49,5,54,15,
+    14,243,122,15,57,17,73,16,2,0,106,12,3,0,5,6,
+    14,5,7,13,5,8,12,53,16,241,57,12,52,12,17,240,
+    2,12,57,12,52,12,18,239,2,12,121,9,51,2,33,9,
+    84,17,0,53,19,237,121,15,122,20,57,16,71,16,1,0,
+    77,51,9,54,15,21,236,49,6,84,8,0,49,6,80,5,
+    0,49,8,57,17,4,18,7,4,19,9,94,17,3,57,17,
+    73,16,2,0,121,10,51,2,33,2,84,62,0,53,16,241,
+    57,12,52,12,22,235,2,12,57,12,52,12,23,234,2,12,
+    121,12,51,24,35,2,12,2,12,84,10,0,122,9,57,2,
+    80,24,0,53,16,241,57,12,52,12,22,233,2,12,57,12,
+    52,12,23,232,2,12,57,2,53,25,230,57,15,4,16,2,
+    71,16,1,0,121,2,51,9,123,3,2,84,65,0,49,2,
+    54,15,26,229,73,16,1,0,16,84,28,0,53,27,227,121,
+    15,51,28,54,19,29,226,4,21,2,73,20,2,0,57,16,
+    71,16,1,0,77,51,30,54,15,29,225,4,17,10,53,31,
+    223,57,18,4,19,2,73,16,4,0,57,10,53,32,221,121,
+    12,51,24,25,12,2,12,23,10,57,11,53,16,241,57,12,
+    52,12,33,220,2,12,121,12,51,2,33,12,17,2,12,84,
+    129,0,53,34,218,57,15,4,16,4,71,16,1,0,16,84,
+    30,0,53,35,216,57,15,53,11,247,54,19,36,215,73,20,
+    1,0,57,16,4,17,4,71,16,2,0,121,4,51,10,25,
+    4,121,12,51,37,35,2,12,2,12,81,18,0,1,51,24,
+    25,4,57,12,53,38,213,34,12,17,2,12,84,9,0,51,
+    39,25,4,57,4,53,35,216,57,15,53,16,241,57,16,52,
+    16,33,212,2,16,120,16,49,4,54,20,40,211,53,38,213,
+    57,22,73,21,2,0,57,17,4,18,11,71,16,3,0,76,
+    53,35,216,57,15,4,16,4,53,41,209,57,17,4,18,11,
+    71,16,3,0,76,114,157,0,0,0,99,13,2,0,0,1,
+    0,0,0,3,0,0,0,1,0,0,0,10,0,0,0,0,
+    0,0,0,0,0,0,0,1,0,0,0,17,0,0,0,39,
+    0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,193,110,1,0,0,71,105,118,101,
     110,32,116,104,101,32,112,97,116,104,32,116,111,32,97,32,
-    46,112,121,32,102,105,108,101,44,32,114,101,116,117,114,110,
-    32,116,104,101,32,112,97,116,104,32,116,111,32,105,116,115,
-    32,46,112,121,99,32,102,105,108,101,46,10,10,32,32,32,
-    32,84,104,101,32,46,112,121,32,102,105,108,101,32,100,111,
-    101,115,32,110,111,116,32,110,101,101,100,32,116,111,32,101,
-    120,105,115,116,59,32,116,104,105,115,32,115,105,109,112,108,
-    121,32,114,101,116,117,114,110,115,32,116,104,101,32,112,97,
-    116,104,32,116,111,32,116,104,101,10,32,32,32,32,46,112,
-    121,99,32,102,105,108,101,32,99,97,108,99,117,108,97,116,
-    101,100,32,97,115,32,105,102,32,116,104,101,32,46,112,121,
-    32,102,105,108,101,32,119,101,114,101,32,105,109,112,111,114,
-    116,101,100,46,10,10,32,32,32,32,84,104,101,32,39,111,
-    112,116,105,109,105,122,97,116,105,111,110,39,32,112,97,114,
-    97,109,101,116,101,114,32,99,111,110,116,114,111,108,115,32,
-    116,104,101,32,112,114,101,115,117,109,101,100,32,111,112,116,
-    105,109,105,122,97,116,105,111,110,32,108,101,118,101,108,32,
-    111,102,10,32,32,32,32,116,104,101,32,98,121,116,101,99,
-    111,100,101,32,102,105,108,101,46,32,73,102,32,39,111,112,
-    116,105,109,105,122,97,116,105,111,110,39,32,105,115,32,110,
-    111,116,32,78,111,110,101,44,32,116,104,101,32,115,116,114,
-    105,110,103,32,114,101,112,114,101,115,101,110,116,97,116,105,
-    111,110,10,32,32,32,32,111,102,32,116,104,101,32,97,114,
-    103,117,109,101,110,116,32,105,115,32,116,97,107,101,110,32,
-    97,110,100,32,118,101,114,105,102,105,101,100,32,116,111,32,
-    98,101,32,97,108,112,104,97,110,117,109,101,114,105,99,32,
-    40,101,108,115,101,32,86,97,108,117,101,69,114,114,111,114,
-    10,32,32,32,32,105,115,32,114,97,105,115,101,100,41,46,
-    10,10,32,32,32,32,84,104,101,32,100,101,98,117,103,95,
-    111,118,101,114,114,105,100,101,32,112,97,114,97,109,101,116,
-    101,114,32,105,115,32,100,101,112,114,101,99,97,116,101,100,
-    46,32,73,102,32,100,101,98,117,103,95,111,118,101,114,114,
-    105,100,101,32,105,115,32,110,111,116,32,78,111,110,101,44,
-    10,32,32,32,32,97,32,84,114,117,101,32,118,97,108,117,
-    101,32,105,115,32,116,104,101,32,115,97,109,101,32,97,115,
-    32,115,101,116,116,105,110,103,32,39,111,112,116,105,109,105,
-    122,97,116,105,111,110,39,32,116,111,32,116,104,101,32,101,
-    109,112,116,121,32,115,116,114,105,110,103,10,32,32,32,32,
-    119,104,105,108,101,32,97,32,70,97,108,115,101,32,118,97,
-    108,117,101,32,105,115,32,101,113,117,105,118,97,108,101,110,
-    116,32,116,111,32,115,101,116,116,105,110,103,32,39,111,112,
-    116,105,109,105,122,97,116,105,111,110,39,32,116,111,32,39,
-    49,39,46,10,10,32,32,32,32,73,102,32,115,121,115,46,
+    46,112,121,99,46,32,102,105,108,101,44,32,114,101,116,117,
+    114,110,32,116,104,101,32,112,97,116,104,32,116,111,32,105,
+    116,115,32,46,112,121,32,102,105,108,101,46,10,10,32,32,
+    32,32,84,104,101,32,46,112,121,99,32,102,105,108,101,32,
+    100,111,101,115,32,110,111,116,32,110,101,101,100,32,116,111,
+    32,101,120,105,115,116,59,32,116,104,105,115,32,115,105,109,
+    112,108,121,32,114,101,116,117,114,110,115,32,116,104,101,32,
+    112,97,116,104,32,116,111,10,32,32,32,32,116,104,101,32,
+    46,112,121,32,102,105,108,101,32,99,97,108,99,117,108,97,
+    116,101,100,32,116,111,32,99,111,114,114,101,115,112,111,110,
+    100,32,116,111,32,116,104,101,32,46,112,121,99,32,102,105,
+    108,101,46,32,32,73,102,32,112,97,116,104,32,100,111,101,
+    115,10,32,32,32,32,110,111,116,32,99,111,110,102,111,114,
+    109,32,116,111,32,80,69,80,32,51,49,52,55,47,52,56,
+    56,32,102,111,114,109,97,116,44,32,86,97,108,117,101,69,
+    114,114,111,114,32,119,105,108,108,32,98,101,32,114,97,105,
+    115,101,100,46,32,73,102,10,32,32,32,32,115,121,115,46,
     105,109,112,108,101,109,101,110,116,97,116,105,111,110,46,99,
     97,99,104,101,95,116,97,103,32,105,115,32,78,111,110,101,
     32,116,104,101,110,32,78,111,116,73,109,112,108,101,109,101,
     110,116,101,100,69,114,114,111,114,32,105,115,32,114,97,105,
-    115,101,100,46,10,10,32,32,32,32,218,17,99,97,99,104,
-    101,95,102,114,111,109,95,115,111,117,114,99,101,78,114,10,
-    0,0,0,218,4,119,97,114,110,218,70,116,104,101,32,100,
-    101,98,117,103,95,111,118,101,114,114,105,100,101,32,112,97,
-    114,97,109,101,116,101,114,32,105,115,32,100,101,112,114,101,
-    99,97,116,101,100,59,32,117,115,101,32,39,111,112,116,105,
-    109,105,122,97,116,105,111,110,39,32,105,110,115,116,101,97,
-    100,218,18,68,101,112,114,101,99,97,116,105,111,110,87,97,
-    114,110,105,110,103,218,50,100,101,98,117,103,95,111,118,101,
-    114,114,105,100,101,32,111,114,32,111,112,116,105,109,105,122,
-    97,116,105,111,110,32,109,117,115,116,32,98,101,32,115,101,
-    116,32,116,111,32,78,111,110,101,218,9,84,121,112,101,69,
-    114,114,111,114,114,36,0,0,0,114,29,0,0,0,114,18,
-    0,0,0,218,6,102,115,112,97,116,104,114,95,0,0,0,
-    218,10,114,112,97,114,116,105,116,105,111,110,218,1,46,114,
-    8,0,0,0,218,14,105,109,112,108,101,109,101,110,116,97,
-    116,105,111,110,218,9,99,97,99,104,101,95,116,97,103,218,
-    19,78,111,116,73,109,112,108,101,109,101,110,116,101,100,69,
-    114,114,111,114,218,36,115,121,115,46,105,109,112,108,101,109,
-    101,110,116,97,116,105,111,110,46,99,97,99,104,101,95,116,
-    97,103,32,105,115,32,78,111,110,101,114,37,0,0,0,114,
-    56,0,0,0,218,8,111,112,116,105,109,105,122,101,114,4,
-    0,0,0,218,3,115,116,114,218,7,105,115,97,108,110,117,
-    109,218,10,86,97,108,117,101,69,114,114,111,114,218,24,123,
-    33,114,125,32,105,115,32,110,111,116,32,97,108,112,104,97,
-    110,117,109,101,114,105,99,114,125,0,0,0,218,7,123,125,
-    46,123,125,123,125,114,148,0,0,0,114,152,0,0,0,218,
-    14,112,121,99,97,99,104,101,95,112,114,101,102,105,120,114,
-    118,0,0,0,114,78,0,0,0,114,115,0,0,0,114,39,
-    0,0,0,114,25,0,0,0,186,114,76,0,0,0,78,78,
-    218,6,108,115,116,114,105,112,114,146,0,0,0,1,0,0,
-    0,1,0,0,0,2,0,0,0,2,0,0,0,106,1,0,
-    0,41,12,114,90,0,0,0,218,14,100,101,98,117,103,95,
-    111,118,101,114,114,105,100,101,218,12,111,112,116,105,109,105,
-    122,97,116,105,111,110,218,7,109,101,115,115,97,103,101,218,
-    4,104,101,97,100,114,92,0,0,0,218,4,98,97,115,101,
-    114,30,0,0,0,218,4,114,101,115,116,218,3,116,97,103,
-    218,15,97,108,109,111,115,116,95,102,105,108,101,110,97,109,
-    101,218,8,102,105,108,101,110,97,109,101,114,31,0,0,0,
-    114,31,0,0,0,114,32,0,0,0,114,156,0,0,0,115,
-    74,0,0,0,2,0,0,18,8,1,11,1,3,255,7,2,
-    8,1,4,1,13,1,14,1,16,1,22,1,27,1,21,1,
-    7,1,14,1,37,1,7,1,31,1,7,2,21,1,14,1,
-    8,1,14,1,25,1,23,1,15,1,23,9,16,1,27,5,
-    34,1,6,4,5,1,11,255,2,2,15,254,10,5,6,23,
-    51,2,33,1,17,84,63,0,53,3,254,54,15,4,253,51,
-    5,57,17,53,6,251,57,18,73,16,3,0,1,51,2,33,
-    2,17,84,20,0,51,7,57,3,53,8,249,57,15,4,16,
-    3,71,16,1,0,77,49,1,84,8,0,51,9,80,5,0,
-    51,10,57,2,53,11,247,54,15,12,246,4,17,0,73,16,
-    2,0,57,0,53,13,244,57,15,4,16,0,71,16,1,0,
-    106,12,2,0,5,4,13,5,5,12,49,5,54,15,14,243,
-    51,15,57,17,73,16,2,0,106,12,3,0,5,6,14,5,
-    7,13,5,8,12,53,16,241,57,12,52,12,17,240,2,12,
-    57,12,52,12,18,239,2,12,57,9,51,2,33,9,84,17,
-    0,53,19,237,57,15,51,20,57,16,71,16,1,0,77,51,
-    9,54,15,21,236,49,6,84,8,0,49,6,80,5,0,49,
-    8,57,17,4,18,7,4,19,9,94,17,3,57,17,73,16,
-    2,0,57,10,51,2,33,2,84,62,0,53,16,241,57,12,
-    52,12,22,235,2,12,57,12,52,12,23,234,2,12,57,12,
-    51,24,35,2,12,2,12,84,10,0,51,9,57,2,80,24,
-    0,53,16,241,57,12,52,12,22,233,2,12,57,12,52,12,
-    23,232,2,12,57,2,53,25,230,57,15,4,16,2,71,16,
-    1,0,57,2,51,9,35,3,2,84,65,0,49,2,54,15,
-    26,229,73,16,1,0,16,84,28,0,53,27,227,57,15,51,
-    28,54,19,29,226,4,21,2,73,20,2,0,57,16,71,16,
-    1,0,77,51,30,54,15,29,225,4,17,10,53,31,223,57,
-    18,4,19,2,73,16,4,0,57,10,53,32,221,57,12,51,
-    24,25,12,2,12,23,10,57,11,53,16,241,57,12,52,12,
-    33,220,2,12,57,12,51,2,33,12,17,2,12,84,129,0,
-    53,34,218,57,15,4,16,4,71,16,1,0,16,84,30,0,
-    53,35,216,57,15,53,11,247,54,19,36,215,73,20,1,0,
-    57,16,4,17,4,71,16,2,0,57,4,51,10,25,4,57,
-    12,51,37,35,2,12,2,12,81,18,0,1,51,24,25,4,
-    57,12,53,38,213,34,12,17,2,12,84,9,0,51,39,25,
-    4,57,4,53,35,216,57,15,53,16,241,57,16,52,16,33,
-    212,2,16,57,16,49,4,54,20,40,211,53,38,213,57,22,
-    73,21,2,0,57,17,4,18,11,71,16,3,0,76,53,35,
-    216,57,15,4,16,4,53,41,209,57,17,4,18,11,71,16,
-    3,0,76,114,156,0,0,0,99,13,2,0,0,1,0,0,
-    0,3,0,0,0,1,0,0,0,10,0,0,0,0,0,0,
-    0,0,0,0,0,1,0,0,0,17,0,0,0,39,0,0,
-    0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,193,110,1,0,0,71,105,118,101,110,32,
-    116,104,101,32,112,97,116,104,32,116,111,32,97,32,46,112,
-    121,99,46,32,102,105,108,101,44,32,114,101,116,117,114,110,
-    32,116,104,101,32,112,97,116,104,32,116,111,32,105,116,115,
-    32,46,112,121,32,102,105,108,101,46,10,10,32,32,32,32,
-    84,104,101,32,46,112,121,99,32,102,105,108,101,32,100,111,
-    101,115,32,110,111,116,32,110,101,101,100,32,116,111,32,101,
-    120,105,115,116,59,32,116,104,105,115,32,115,105,109,112,108,
-    121,32,114,101,116,117,114,110,115,32,116,104,101,32,112,97,
-    116,104,32,116,111,10,32,32,32,32,116,104,101,32,46,112,
-    121,32,102,105,108,101,32,99,97,108,99,117,108,97,116,101,
-    100,32,116,111,32,99,111,114,114,101,115,112,111,110,100,32,
-    116,111,32,116,104,101,32,46,112,121,99,32,102,105,108,101,
-    46,32,32,73,102,32,112,97,116,104,32,100,111,101,115,10,
-    32,32,32,32,110,111,116,32,99,111,110,102,111,114,109,32,
-    116,111,32,80,69,80,32,51,49,52,55,47,52,56,56,32,
-    102,111,114,109,97,116,44,32,86,97,108,117,101,69,114,114,
-    111,114,32,119,105,108,108,32,98,101,32,114,97,105,115,101,
-    100,46,32,73,102,10,32,32,32,32,115,121,115,46,105,109,
-    112,108,101,109,101,110,116,97,116,105,111,110,46,99,97,99,
-    104,101,95,116,97,103,32,105,115,32,78,111,110,101,32,116,
-    104,101,110,32,78,111,116,73,109,112,108,101,109,101,110,116,
-    101,100,69,114,114,111,114,32,105,115,32,114,97,105,115,101,
-    100,46,10,10,32,32,32,32,218,17,115,111,117,114,99,101,
-    95,102,114,111,109,95,99,97,99,104,101,114,8,0,0,0,
-    114,165,0,0,0,114,166,0,0,0,78,114,167,0,0,0,
-    114,168,0,0,0,114,18,0,0,0,114,162,0,0,0,114,
-    95,0,0,0,70,114,175,0,0,0,114,82,0,0,0,114,
-    25,0,0,0,114,51,0,0,0,114,33,0,0,0,114,28,
-    0,0,0,84,114,146,0,0,0,114,172,0,0,0,218,31,
-    32,110,111,116,32,98,111,116,116,111,109,45,108,101,118,101,
-    108,32,100,105,114,101,99,116,111,114,121,32,105,110,32,218,
-    5,99,111,117,110,116,114,164,0,0,0,62,2,0,0,0,
-    114,76,0,0,0,233,3,0,0,0,218,29,101,120,112,101,
-    99,116,101,100,32,111,110,108,121,32,50,32,111,114,32,51,
-    32,100,111,116,115,32,105,110,32,114,191,0,0,0,218,6,
-    114,115,112,108,105,116,114,76,0,0,0,233,254,255,255,255,
-    114,148,0,0,0,218,53,111,112,116,105,109,105,122,97,116,
-    105,111,110,32,112,111,114,116,105,111,110,32,111,102,32,102,
-    105,108,101,110,97,109,101,32,100,111,101,115,32,110,111,116,
-    32,115,116,97,114,116,32,119,105,116,104,32,114,171,0,0,
-    0,218,19,111,112,116,105,109,105,122,97,116,105,111,110,32,
-    108,101,118,101,108,32,218,29,32,105,115,32,110,111,116,32,
-    97,110,32,97,108,112,104,97,110,117,109,101,114,105,99,32,
-    118,97,108,117,101,218,9,112,97,114,116,105,116,105,111,110,
-    114,4,0,0,0,114,78,0,0,0,114,150,0,0,0,177,
-    1,0,0,41,10,114,90,0,0,0,114,181,0,0,0,218,
-    16,112,121,99,97,99,104,101,95,102,105,108,101,110,97,109,
-    101,218,23,102,111,117,110,100,95,105,110,95,112,121,99,97,
-    99,104,101,95,112,114,101,102,105,120,218,13,115,116,114,105,
-    112,112,101,100,95,112,97,116,104,218,7,112,121,99,97,99,
-    104,101,218,9,100,111,116,95,99,111,117,110,116,114,179,0,
-    0,0,218,9,111,112,116,95,108,101,118,101,108,218,13,98,
-    97,115,101,95,102,105,108,101,110,97,109,101,114,31,0,0,
-    0,114,31,0,0,0,114,32,0,0,0,114,188,0,0,0,
-    115,62,0,0,0,2,0,0,9,30,1,14,1,16,1,22,
-    1,4,1,23,1,26,1,20,1,28,1,4,1,6,1,22,
-    1,9,1,16,1,2,255,17,2,16,1,8,1,28,1,8,
-    1,28,1,19,1,9,1,3,255,17,2,30,1,14,1,32,
-    2,24,1,6,17,53,2,254,57,10,52,10,3,253,2,10,
-    57,10,52,10,4,252,2,10,57,10,51,5,33,10,2,10,
-    84,17,0,53,6,250,57,13,51,7,57,14,71,14,1,0,
-    77,53,8,248,54,13,9,247,4,15,0,73,14,2,0,57,
-    0,53,10,245,57,13,4,14,0,71,14,1,0,106,10,2,
-    0,5,1,11,5,2,10,51,11,57,3,53,2,254,57,10,
-    52,10,12,244,2,10,57,10,51,5,33,10,17,2,10,84,
-    81,0,53,2,254,57,10,52,10,12,243,2,10,54,13,13,
-    242,53,14,240,57,15,73,14,2,0,57,4,49,1,54,13,
-    15,239,53,16,237,23,4,57,15,73,14,2,0,84,35,0,
-    53,17,235,57,13,4,14,4,71,14,1,0,57,10,51,5,
-    57,11,51,5,57,12,92,10,25,1,57,1,51,18,57,3,
-    49,3,16,84,69,0,53,10,245,57,13,4,14,1,71,14,
-    1,0,106,10,2,0,5,1,11,5,5,10,53,19,233,35,
-    3,5,84,38,0,53,20,231,57,13,53,19,233,74,4,57,
-    14,51,21,57,15,49,0,74,2,74,4,57,16,75,6,14,
-    3,57,14,71,14,1,0,77,49,2,54,13,22,230,51,23,
-    57,15,73,14,2,0,57,6,51,24,34,6,17,84,31,0,
-    53,20,231,57,13,51,25,57,14,49,2,74,2,74,4,57,
-    15,75,6,14,2,57,14,71,14,1,0,77,51,26,35,2,
-    6,84,155,0,49,2,54,13,27,229,51,23,57,15,51,28,
-    57,16,73,14,3,0,57,10,51,29,25,10,2,10,57,7,
-    49,7,54,13,15,228,53,30,226,57,15,73,14,2,0,16,
-    84,32,0,53,20,231,57,13,51,31,57,14,53,30,226,74,
-    2,74,4,57,15,75,6,14,2,57,14,71,14,1,0,77,
-    53,17,235,57,13,53,30,226,57,14,71,14,1,0,57,10,
-    51,5,57,11,51,5,57,12,92,10,25,7,57,8,49,8,
-    54,13,32,225,73,14,1,0,16,84,35,0,53,20,231,57,
-    13,51,33,57,14,49,7,74,2,74,4,57,15,51,34,57,
-    16,75,6,14,3,57,14,71,14,1,0,77,49,2,54,13,
-    35,224,51,23,57,15,73,14,2,0,57,10,51,36,25,10,
-    2,10,57,9,53,37,222,57,13,4,14,1,53,38,220,57,
-    15,51,36,25,15,2,15,23,9,57,15,71,14,2,0,76,
-    114,188,0,0,0,99,166,0,0,0,1,0,0,0,3,0,
-    0,0,1,0,0,0,5,0,0,0,0,0,0,0,0,0,
-    0,0,1,0,0,0,11,0,0,0,15,0,0,0,12,0,
-    0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,
-    0,0,218,188,67,111,110,118,101,114,116,32,97,32,98,121,
-    116,101,99,111,100,101,32,102,105,108,101,32,112,97,116,104,
-    32,116,111,32,97,32,115,111,117,114,99,101,32,112,97,116,
-    104,32,40,105,102,32,112,111,115,115,105,98,108,101,41,46,
-    10,10,32,32,32,32,84,104,105,115,32,102,117,110,99,116,
-    105,111,110,32,101,120,105,115,116,115,32,112,117,114,101,108,
-    121,32,102,111,114,32,98,97,99,107,119,97,114,100,115,45,
-    99,111,109,112,97,116,105,98,105,108,105,116,121,32,102,111,
-    114,10,32,32,32,32,80,121,73,109,112,111,114,116,95,69,
-    120,101,99,67,111,100,101,77,111,100,117,108,101,87,105,116,
-    104,70,105,108,101,110,97,109,101,115,40,41,32,105,110,32,
-    116,104,101,32,67,32,65,80,73,46,10,10,32,32,32,32,
-    218,15,95,103,101,116,95,115,111,117,114,99,101,102,105,108,
-    101,114,28,0,0,0,114,4,0,0,0,78,114,163,0,0,
-    0,114,164,0,0,0,218,5,108,111,119,101,114,186,233,253,
-    255,255,255,233,255,255,255,255,78,218,2,112,121,114,188,0,
-    0,0,114,167,0,0,0,114,172,0,0,0,186,78,114,211,
-    0,0,0,78,114,111,0,0,0,96,0,0,0,113,0,0,
-    0,143,0,0,0,5,0,0,0,217,1,0,0,41,5,218,
-    13,98,121,116,101,99,111,100,101,95,112,97,116,104,114,183,
-    0,0,0,218,1,95,218,9,101,120,116,101,110,115,105,111,
-    110,218,11,115,111,117,114,99,101,95,112,97,116,104,114,31,
-    0,0,0,114,31,0,0,0,114,32,0,0,0,114,207,0,
-    0,0,115,20,0,0,0,2,0,0,7,24,1,3,1,27,
-    1,37,1,3,2,17,1,17,1,13,1,6,11,53,2,254,
-    57,8,4,9,0,71,9,1,0,57,5,51,3,35,2,5,
-    2,5,84,6,0,51,4,76,49,0,54,8,5,253,51,6,
-    57,10,73,9,2,0,106,5,3,0,5,1,7,5,2,6,
-    5,3,5,49,1,16,82,31,0,1,49,3,54,8,7,252,
-    73,9,1,0,57,5,51,8,25,5,2,5,57,5,51,9,
-    35,3,5,2,5,84,6,0,49,0,76,53,10,250,57,8,
-    4,9,0,71,9,1,0,57,4,80,33,0,53,11,248,57,
-    7,53,12,246,57,8,93,7,2,83,5,15,0,51,13,25,
-    0,57,4,97,5,80,5,0,99,5,53,14,244,57,8,4,
-    9,4,71,9,1,0,84,8,0,49,4,80,5,0,49,0,
-    76,114,207,0,0,0,99,99,0,0,0,1,0,0,0,3,
-    0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,
-    0,0,0,1,0,0,0,11,0,0,0,8,0,0,0,12,
-    0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
-    0,0,0,78,218,11,95,103,101,116,95,99,97,99,104,101,
-    100,114,81,0,0,0,114,34,0,0,0,114,150,0,0,0,
-    114,156,0,0,0,114,167,0,0,0,114,152,0,0,0,31,
-    0,0,0,44,0,0,0,58,0,0,0,1,0,0,0,236,
-    1,0,0,41,1,114,186,0,0,0,114,31,0,0,0,114,
-    31,0,0,0,114,32,0,0,0,114,218,0,0,0,115,16,
-    0,0,0,2,0,0,1,29,2,13,1,7,1,10,1,29,
-    1,3,2,6,11,49,0,54,4,2,255,53,3,253,57,9,
-    53,4,251,57,10,71,10,1,0,57,6,73,5,2,0,84,
-    33,0,53,5,249,57,4,4,5,0,71,5,1,0,76,53,
-    6,247,83,1,9,0,97,1,80,5,0,99,1,80,38,0,
-    49,0,54,4,2,246,53,3,253,57,9,53,7,244,57,10,
-    71,10,1,0,57,6,73,5,2,0,84,6,0,49,0,76,
-    51,0,76,51,0,76,114,218,0,0,0,99,54,0,0,0,
-    1,0,0,0,3,0,0,0,1,0,0,0,2,0,0,0,
-    0,0,0,0,0,0,0,0,1,0,0,0,7,0,0,0,
-    7,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,
-    1,0,0,0,0,0,0,0,218,51,67,97,108,99,117,108,
-    97,116,101,32,116,104,101,32,109,111,100,101,32,112,101,114,
-    109,105,115,115,105,111,110,115,32,102,111,114,32,97,32,98,
-    121,116,101,99,111,100,101,32,102,105,108,101,46,218,10,95,
-    99,97,108,99,95,109,111,100,101,114,101,0,0,0,114,106,
-    0,0,0,114,105,0,0,0,114,121,0,0,0,233,128,0,
-    0,0,2,0,0,0,27,0,0,0,45,0,0,0,2,0,
-    0,0,248,1,0,0,41,2,114,90,0,0,0,114,108,0,
-    0,0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,
-    0,114,220,0,0,0,115,12,0,0,0,2,0,0,3,25,
-    1,7,1,11,3,6,1,6,7,53,2,254,57,5,4,6,
-    0,71,6,1,0,57,2,52,2,3,253,2,2,57,1,80,
-    21,0,53,4,251,83,2,13,0,51,5,57,1,97,2,80,
-    5,0,99,2,51,6,45,1,57,1,49,1,76,114,220,0,
-    0,0,99,64,0,0,0,1,0,8,0,3,0,0,0,1,
-    0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,1,
-    0,0,0,9,0,0,0,8,0,0,0,5,0,0,0,1,
-    0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,218,
-    252,68,101,99,111,114,97,116,111,114,32,116,111,32,118,101,
-    114,105,102,121,32,116,104,97,116,32,116,104,101,32,109,111,
-    100,117,108,101,32,98,101,105,110,103,32,114,101,113,117,101,
-    115,116,101,100,32,109,97,116,99,104,101,115,32,116,104,101,
-    32,111,110,101,32,116,104,101,10,32,32,32,32,108,111,97,
-    100,101,114,32,99,97,110,32,104,97,110,100,108,101,46,10,
-    10,32,32,32,32,84,104,101,32,102,105,114,115,116,32,97,
-    114,103,117,109,101,110,116,32,40,115,101,108,102,41,32,109,
-    117,115,116,32,100,101,102,105,110,101,32,95,110,97,109,101,
-    32,119,104,105,99,104,32,116,104,101,32,115,101,99,111,110,
-    100,32,97,114,103,117,109,101,110,116,32,105,115,10,32,32,
-    32,32,99,111,109,112,97,114,101,100,32,97,103,97,105,110,
-    115,116,46,32,73,102,32,116,104,101,32,99,111,109,112,97,
-    114,105,115,111,110,32,102,97,105,108,115,32,116,104,101,110,
-    32,73,109,112,111,114,116,69,114,114,111,114,32,105,115,32,
-    114,97,105,115,101,100,46,10,10,32,32,32,32,218,11,95,
-    99,104,101,99,107,95,110,97,109,101,78,99,106,0,0,0,
-    2,0,21,0,31,0,0,0,2,0,0,0,5,0,0,0,
-    1,0,0,0,0,0,0,0,2,0,0,0,14,0,0,0,
-    6,0,0,0,5,0,0,0,0,0,0,0,2,0,0,0,
-    0,0,0,0,0,0,0,0,78,218,40,95,99,104,101,99,
-    107,95,110,97,109,101,46,60,108,111,99,97,108,115,62,46,
-    95,99,104,101,99,107,95,110,97,109,101,95,119,114,97,112,
-    112,101,114,218,4,110,97,109,101,218,11,73,109,112,111,114,
-    116,69,114,114,111,114,218,30,108,111,97,100,101,114,32,102,
-    111,114,32,37,115,32,99,97,110,110,111,116,32,104,97,110,
-    100,108,101,32,37,115,169,1,114,225,0,0,0,3,0,0,
-    0,1,0,0,0,0,0,0,0,4,0,0,0,12,2,0,
-    0,41,5,218,4,115,101,108,102,114,225,0,0,0,218,4,
-    97,114,103,115,218,6,107,119,97,114,103,115,218,6,109,101,
-    116,104,111,100,41,1,114,232,0,0,0,114,31,0,0,0,
-    114,32,0,0,0,218,19,95,99,104,101,99,107,95,110,97,
-    109,101,95,119,114,97,112,112,101,114,115,16,0,0,0,2,
-    0,0,1,7,1,9,1,16,1,9,1,12,255,18,2,6,
-    14,51,0,33,1,84,12,0,52,0,2,255,57,1,80,58,
-    0,52,0,2,254,57,5,49,1,35,3,5,2,5,84,42,
-    0,53,3,252,57,10,51,4,57,11,52,0,2,251,57,12,
-    4,13,1,93,12,2,22,11,2,11,57,11,4,5,1,51,
-    5,57,6,71,11,1,1,77,55,4,57,10,4,11,0,4,
-    12,1,94,11,2,57,11,49,2,111,11,49,11,2,11,74,
-    7,57,5,4,6,3,72,11,76,218,10,95,98,111,111,116,
-    115,116,114,97,112,218,5,95,119,114,97,112,218,9,78,97,
-    109,101,69,114,114,111,114,99,88,0,0,0,2,0,0,0,
-    19,0,0,0,2,0,0,0,3,0,0,0,0,0,0,0,
-    0,0,0,0,2,0,0,0,16,0,0,0,8,0,0,0,
-    9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,78,218,26,95,99,104,101,99,107,95,110,97,
-    109,101,46,60,108,111,99,97,108,115,62,46,95,119,114,97,
-    112,169,4,218,10,95,95,109,111,100,117,108,101,95,95,218,
-    8,95,95,110,97,109,101,95,95,218,12,95,95,113,117,97,
-    108,110,97,109,101,95,95,114,1,0,0,0,218,7,104,97,
-    115,97,116,116,114,218,7,115,101,116,97,116,116,114,218,7,
-    103,101,116,97,116,116,114,218,8,95,95,100,105,99,116,95,
-    95,218,6,117,112,100,97,116,101,23,2,0,0,41,3,218,
-    3,110,101,119,218,3,111,108,100,114,119,0,0,0,114,31,
-    0,0,0,114,31,0,0,0,114,32,0,0,0,114,235,0,
-    0,0,115,12,0,0,0,2,0,0,1,9,1,18,1,33,
-    254,4,3,6,16,51,2,86,3,80,56,0,57,2,53,3,
-    254,57,7,4,8,1,4,9,2,71,8,2,0,84,36,0,
-    53,4,252,57,7,4,8,0,4,9,2,53,5,250,57,13,
-    4,14,1,4,15,2,71,14,2,0,57,10,71,8,3,0,
-    1,88,3,203,255,52,0,6,249,54,6,7,248,52,1,6,
-    247,57,8,73,7,2,0,1,51,0,76,0,0,0,0,12,
-    0,0,0,28,0,0,0,46,0,0,0,3,0,0,0,4,
-    2,0,0,41,3,114,232,0,0,0,114,233,0,0,0,114,
-    235,0,0,0,114,31,0,0,0,41,1,114,232,0,0,0,
-    114,32,0,0,0,114,223,0,0,0,115,14,0,0,0,2,
-    0,0,8,10,8,16,1,7,2,11,5,15,1,6,9,51,
-    2,57,3,107,3,2,3,57,1,53,4,254,57,3,52,3,
-    5,253,2,3,57,2,80,21,0,53,6,251,83,3,13,0,
-    107,7,57,2,97,3,80,5,0,99,3,4,6,2,4,7,
-    1,55,0,57,8,71,7,2,0,1,49,1,76,114,223,0,
-    0,0,99,90,0,0,0,2,0,0,0,3,0,0,0,2,
-    0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,2,
-    0,0,0,16,0,0,0,11,0,0,0,9,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,
-    155,84,114,121,32,116,111,32,102,105,110,100,32,97,32,108,
-    111,97,100,101,114,32,102,111,114,32,116,104,101,32,115,112,
-    101,99,105,102,105,101,100,32,109,111,100,117,108,101,32,98,
-    121,32,100,101,108,101,103,97,116,105,110,103,32,116,111,10,
-    32,32,32,32,115,101,108,102,46,102,105,110,100,95,108,111,
-    97,100,101,114,40,41,46,10,10,32,32,32,32,84,104,105,
-    115,32,109,101,116,104,111,100,32,105,115,32,100,101,112,114,
-    101,99,97,116,101,100,32,105,110,32,102,97,118,111,114,32,
-    111,102,32,102,105,110,100,101,114,46,102,105,110,100,95,115,
-    112,101,99,40,41,46,10,10,32,32,32,32,218,17,95,102,
-    105,110,100,95,109,111,100,117,108,101,95,115,104,105,109,218,
-    11,102,105,110,100,95,108,111,97,100,101,114,78,114,28,0,
-    0,0,218,44,78,111,116,32,105,109,112,111,114,116,105,110,
-    103,32,100,105,114,101,99,116,111,114,121,32,123,125,58,32,
-    109,105,115,115,105,110,103,32,95,95,105,110,105,116,95,95,
-    114,10,0,0,0,114,157,0,0,0,114,125,0,0,0,114,
-    4,0,0,0,218,13,73,109,112,111,114,116,87,97,114,110,
-    105,110,103,32,2,0,0,41,5,114,229,0,0,0,218,8,
-    102,117,108,108,110,97,109,101,218,6,108,111,97,100,101,114,
-    218,8,112,111,114,116,105,111,110,115,218,3,109,115,103,114,
-    31,0,0,0,114,31,0,0,0,114,32,0,0,0,114,250,
-    0,0,0,115,12,0,0,0,2,0,0,10,23,1,23,1,
-    4,1,35,1,6,16,49,0,54,8,2,255,4,10,1,73,
-    9,2,0,106,5,2,0,5,2,6,5,3,5,51,3,33,
-    2,81,16,0,1,53,4,253,57,8,4,9,3,71,9,1,
-    0,84,42,0,51,5,57,4,53,6,251,54,8,7,250,49,
-    4,54,13,8,249,51,9,25,3,57,15,73,14,2,0,57,
-    10,53,10,247,57,11,73,9,3,0,1,49,2,76,114,250,
-    0,0,0,99,235,0,0,0,3,0,0,0,3,0,0,0,
-    3,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,
-    3,0,0,0,13,0,0,0,19,0,0,0,14,0,0,0,
+    115,101,100,46,10,10,32,32,32,32,218,17,115,111,117,114,
+    99,101,95,102,114,111,109,95,99,97,99,104,101,114,8,0,
+    0,0,114,166,0,0,0,114,167,0,0,0,78,114,168,0,
+    0,0,114,169,0,0,0,114,18,0,0,0,114,163,0,0,
+    0,114,95,0,0,0,70,114,176,0,0,0,114,82,0,0,
+    0,114,25,0,0,0,114,51,0,0,0,114,33,0,0,0,
+    114,28,0,0,0,84,114,147,0,0,0,114,173,0,0,0,
+    218,31,32,110,111,116,32,98,111,116,116,111,109,45,108,101,
+    118,101,108,32,100,105,114,101,99,116,111,114,121,32,105,110,
+    32,218,5,99,111,117,110,116,114,165,0,0,0,62,2,0,
+    0,0,114,76,0,0,0,233,3,0,0,0,218,29,101,120,
+    112,101,99,116,101,100,32,111,110,108,121,32,50,32,111,114,
+    32,51,32,100,111,116,115,32,105,110,32,114,192,0,0,0,
+    218,6,114,115,112,108,105,116,114,76,0,0,0,233,254,255,
+    255,255,114,149,0,0,0,218,53,111,112,116,105,109,105,122,
+    97,116,105,111,110,32,112,111,114,116,105,111,110,32,111,102,
+    32,102,105,108,101,110,97,109,101,32,100,111,101,115,32,110,
+    111,116,32,115,116,97,114,116,32,119,105,116,104,32,114,172,
+    0,0,0,218,19,111,112,116,105,109,105,122,97,116,105,111,
+    110,32,108,101,118,101,108,32,218,29,32,105,115,32,110,111,
+    116,32,97,110,32,97,108,112,104,97,110,117,109,101,114,105,
+    99,32,118,97,108,117,101,218,9,112,97,114,116,105,116,105,
+    111,110,114,4,0,0,0,114,78,0,0,0,114,151,0,0,
+    0,183,1,0,0,41,10,114,90,0,0,0,114,182,0,0,
+    0,218,16,112,121,99,97,99,104,101,95,102,105,108,101,110,
+    97,109,101,218,23,102,111,117,110,100,95,105,110,95,112,121,
+    99,97,99,104,101,95,112,114,101,102,105,120,218,13,115,116,
+    114,105,112,112,101,100,95,112,97,116,104,218,7,112,121,99,
+    97,99,104,101,218,9,100,111,116,95,99,111,117,110,116,114,
+    180,0,0,0,218,9,111,112,116,95,108,101,118,101,108,218,
+    13,98,97,115,101,95,102,105,108,101,110,97,109,101,114,31,
+    0,0,0,114,31,0,0,0,114,32,0,0,0,114,189,0,
+    0,0,115,62,0,0,0,2,0,0,9,30,1,14,1,16,
+    1,22,1,4,1,23,1,26,1,20,1,28,1,4,1,6,
+    1,22,1,9,1,16,1,2,255,17,2,16,1,8,1,28,
+    1,8,1,28,1,19,1,9,1,3,255,17,2,30,1,14,
+    1,32,2,24,1,6,17,53,2,254,57,10,52,10,3,253,
+    2,10,57,10,52,10,4,252,2,10,121,10,51,5,33,10,
+    2,10,84,17,0,53,6,250,121,13,122,7,57,14,71,14,
+    1,0,77,53,8,248,54,13,9,247,4,15,0,73,14,2,
+    0,57,0,53,10,245,57,13,4,14,0,71,14,1,0,106,
+    10,2,0,5,1,11,5,2,10,122,11,57,3,53,2,254,
+    57,10,52,10,12,244,2,10,121,10,51,5,33,10,17,2,
+    10,84,81,0,53,2,254,57,10,52,10,12,243,2,10,54,
+    13,13,242,53,14,240,57,15,73,14,2,0,120,4,49,1,
+    54,13,15,239,53,16,237,23,4,57,15,73,14,2,0,84,
+    35,0,53,17,235,57,13,4,14,4,71,14,1,0,121,10,
+    122,5,121,11,122,5,57,12,92,10,25,1,121,1,122,18,
+    120,3,49,3,16,84,69,0,53,10,245,57,13,4,14,1,
+    71,14,1,0,106,10,2,0,5,1,11,5,5,10,53,19,
+    233,123,3,5,84,38,0,53,20,231,57,13,53,19,233,74,
+    4,121,14,122,21,120,15,49,0,74,2,74,4,57,16,75,
+    6,14,3,57,14,71,14,1,0,77,49,2,54,13,22,230,
+    122,23,57,15,73,14,2,0,121,6,51,24,34,6,17,84,
+    31,0,53,20,231,121,13,122,25,120,14,49,2,74,2,74,
+    4,57,15,75,6,14,2,57,14,71,14,1,0,77,51,26,
+    123,2,6,84,155,0,49,2,54,13,27,229,122,23,121,15,
+    122,28,57,16,73,14,3,0,121,10,51,29,25,10,2,10,
+    120,7,49,7,54,13,15,228,53,30,226,57,15,73,14,2,
+    0,16,84,32,0,53,20,231,121,13,122,31,57,14,53,30,
+    226,74,2,74,4,57,15,75,6,14,2,57,14,71,14,1,
+    0,77,53,17,235,57,13,53,30,226,57,14,71,14,1,0,
+    121,10,122,5,121,11,122,5,57,12,92,10,25,7,120,8,
+    49,8,54,13,32,225,73,14,1,0,16,84,35,0,53,20,
+    231,121,13,122,33,120,14,49,7,74,2,74,4,121,15,122,
+    34,57,16,75,6,14,3,57,14,71,14,1,0,77,49,2,
+    54,13,35,224,122,23,57,15,73,14,2,0,121,10,51,36,
+    25,10,2,10,57,9,53,37,222,57,13,4,14,1,53,38,
+    220,121,15,51,36,25,15,2,15,23,9,57,15,71,14,2,
+    0,76,114,189,0,0,0,99,166,0,0,0,1,0,0,0,
+    3,0,0,0,1,0,0,0,5,0,0,0,0,0,0,0,
+    0,0,0,0,1,0,0,0,11,0,0,0,15,0,0,0,
+    12,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+    0,0,0,0,218,188,67,111,110,118,101,114,116,32,97,32,
+    98,121,116,101,99,111,100,101,32,102,105,108,101,32,112,97,
+    116,104,32,116,111,32,97,32,115,111,117,114,99,101,32,112,
+    97,116,104,32,40,105,102,32,112,111,115,115,105,98,108,101,
+    41,46,10,10,32,32,32,32,84,104,105,115,32,102,117,110,
+    99,116,105,111,110,32,101,120,105,115,116,115,32,112,117,114,
+    101,108,121,32,102,111,114,32,98,97,99,107,119,97,114,100,
+    115,45,99,111,109,112,97,116,105,98,105,108,105,116,121,32,
+    102,111,114,10,32,32,32,32,80,121,73,109,112,111,114,116,
+    95,69,120,101,99,67,111,100,101,77,111,100,117,108,101,87,
+    105,116,104,70,105,108,101,110,97,109,101,115,40,41,32,105,
+    110,32,116,104,101,32,67,32,65,80,73,46,10,10,32,32,
+    32,32,218,15,95,103,101,116,95,115,111,117,114,99,101,102,
+    105,108,101,114,28,0,0,0,114,4,0,0,0,78,114,164,
+    0,0,0,114,165,0,0,0,218,5,108,111,119,101,114,186,
+    233,253,255,255,255,233,255,255,255,255,78,218,2,112,121,114,
+    189,0,0,0,114,168,0,0,0,114,173,0,0,0,186,78,
+    114,212,0,0,0,78,114,111,0,0,0,96,0,0,0,113,
+    0,0,0,143,0,0,0,5,0,0,0,223,1,0,0,41,
+    5,218,13,98,121,116,101,99,111,100,101,95,112,97,116,104,
+    114,184,0,0,0,218,1,95,218,9,101,120,116,101,110,115,
+    105,111,110,218,11,115,111,117,114,99,101,95,112,97,116,104,
+    114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,114,
+    208,0,0,0,115,20,0,0,0,2,0,0,7,24,1,3,
+    1,27,1,37,1,3,2,17,1,17,1,13,1,6,11,53,
+    2,254,57,8,4,9,0,71,9,1,0,121,5,51,3,35,
+    2,5,2,5,84,6,0,51,4,76,49,0,54,8,5,253,
+    122,6,57,10,73,9,2,0,106,5,3,0,5,1,7,5,
+    2,6,5,3,5,49,1,16,82,31,0,1,49,3,54,8,
+    7,252,73,9,1,0,121,5,51,8,25,5,2,5,121,5,
+    51,9,35,3,5,2,5,84,6,0,49,0,76,53,10,250,
+    57,8,4,9,0,71,9,1,0,57,4,80,33,0,53,11,
+    248,57,7,53,12,246,57,8,93,7,2,83,5,15,0,51,
+    13,25,0,57,4,97,5,80,5,0,99,5,53,14,244,57,
+    8,4,9,4,71,9,1,0,84,8,0,49,4,80,5,0,
+    49,0,76,114,208,0,0,0,99,99,0,0,0,1,0,0,
+    0,3,0,0,0,1,0,0,0,1,0,0,0,0,0,0,
+    0,0,0,0,0,1,0,0,0,11,0,0,0,8,0,0,
+    0,12,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+    0,0,0,0,0,78,218,11,95,103,101,116,95,99,97,99,
+    104,101,100,114,81,0,0,0,114,34,0,0,0,114,151,0,
+    0,0,114,157,0,0,0,114,168,0,0,0,114,153,0,0,
+    0,31,0,0,0,44,0,0,0,58,0,0,0,1,0,0,
+    0,242,1,0,0,41,1,114,187,0,0,0,114,31,0,0,
+    0,114,31,0,0,0,114,32,0,0,0,114,219,0,0,0,
+    115,16,0,0,0,2,0,0,1,29,2,13,1,7,1,10,
+    1,29,1,3,2,6,11,49,0,54,4,2,255,53,3,253,
+    57,9,53,4,251,57,10,71,10,1,0,57,6,73,5,2,
+    0,84,33,0,53,5,249,57,4,4,5,0,71,5,1,0,
+    76,53,6,247,83,1,9,0,97,1,80,5,0,99,1,80,
+    38,0,49,0,54,4,2,246,53,3,253,57,9,53,7,244,
+    57,10,71,10,1,0,57,6,73,5,2,0,84,6,0,49,
+    0,76,51,0,76,51,0,76,114,219,0,0,0,99,54,0,
+    0,0,1,0,0,0,3,0,0,0,1,0,0,0,2,0,
+    0,0,0,0,0,0,0,0,0,0,1,0,0,0,7,0,
+    0,0,7,0,0,0,5,0,0,0,0,0,0,0,0,0,
+    0,0,1,0,0,0,0,0,0,0,218,51,67,97,108,99,
+    117,108,97,116,101,32,116,104,101,32,109,111,100,101,32,112,
+    101,114,109,105,115,115,105,111,110,115,32,102,111,114,32,97,
+    32,98,121,116,101,99,111,100,101,32,102,105,108,101,46,218,
+    10,95,99,97,108,99,95,109,111,100,101,114,101,0,0,0,
+    114,106,0,0,0,114,105,0,0,0,114,121,0,0,0,233,
+    128,0,0,0,2,0,0,0,27,0,0,0,45,0,0,0,
+    2,0,0,0,254,1,0,0,41,2,114,90,0,0,0,114,
+    108,0,0,0,114,31,0,0,0,114,31,0,0,0,114,32,
+    0,0,0,114,221,0,0,0,115,12,0,0,0,2,0,0,
+    3,25,1,7,1,11,3,6,1,6,7,53,2,254,57,5,
+    4,6,0,71,6,1,0,57,2,52,2,3,253,2,2,57,
+    1,80,21,0,53,4,251,83,2,13,0,122,5,57,1,97,
+    2,80,5,0,99,2,51,6,45,1,120,1,49,1,76,114,
+    221,0,0,0,99,64,0,0,0,1,0,8,0,3,0,0,
+    0,1,0,0,0,3,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,0,0,9,0,0,0,8,0,0,0,5,0,0,
+    0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,
+    0,218,252,68,101,99,111,114,97,116,111,114,32,116,111,32,
+    118,101,114,105,102,121,32,116,104,97,116,32,116,104,101,32,
+    109,111,100,117,108,101,32,98,101,105,110,103,32,114,101,113,
+    117,101,115,116,101,100,32,109,97,116,99,104,101,115,32,116,
+    104,101,32,111,110,101,32,116,104,101,10,32,32,32,32,108,
+    111,97,100,101,114,32,99,97,110,32,104,97,110,100,108,101,
+    46,10,10,32,32,32,32,84,104,101,32,102,105,114,115,116,
+    32,97,114,103,117,109,101,110,116,32,40,115,101,108,102,41,
+    32,109,117,115,116,32,100,101,102,105,110,101,32,95,110,97,
+    109,101,32,119,104,105,99,104,32,116,104,101,32,115,101,99,
+    111,110,100,32,97,114,103,117,109,101,110,116,32,105,115,10,
+    32,32,32,32,99,111,109,112,97,114,101,100,32,97,103,97,
+    105,110,115,116,46,32,73,102,32,116,104,101,32,99,111,109,
+    112,97,114,105,115,111,110,32,102,97,105,108,115,32,116,104,
+    101,110,32,73,109,112,111,114,116,69,114,114,111,114,32,105,
+    115,32,114,97,105,115,101,100,46,10,10,32,32,32,32,218,
+    11,95,99,104,101,99,107,95,110,97,109,101,78,99,106,0,
+    0,0,2,0,21,0,31,0,0,0,2,0,0,0,5,0,
+    0,0,1,0,0,0,0,0,0,0,2,0,0,0,14,0,
+    0,0,6,0,0,0,5,0,0,0,0,0,0,0,2,0,
+    0,0,0,0,0,0,0,0,0,0,78,218,40,95,99,104,
+    101,99,107,95,110,97,109,101,46,60,108,111,99,97,108,115,
+    62,46,95,99,104,101,99,107,95,110,97,109,101,95,119,114,
+    97,112,112,101,114,218,4,110,97,109,101,218,11,73,109,112,
+    111,114,116,69,114,114,111,114,218,30,108,111,97,100,101,114,
+    32,102,111,114,32,37,115,32,99,97,110,110,111,116,32,104,
+    97,110,100,108,101,32,37,115,169,1,114,226,0,0,0,3,
+    0,0,0,1,0,0,0,0,0,0,0,4,0,0,0,18,
+    2,0,0,41,5,218,4,115,101,108,102,114,226,0,0,0,
+    218,4,97,114,103,115,218,6,107,119,97,114,103,115,218,6,
+    109,101,116,104,111,100,41,1,114,233,0,0,0,114,31,0,
+    0,0,114,32,0,0,0,218,19,95,99,104,101,99,107,95,
+    110,97,109,101,95,119,114,97,112,112,101,114,115,16,0,0,
+    0,2,0,0,1,7,1,9,1,16,1,9,1,12,255,18,
+    2,6,14,51,0,33,1,84,12,0,52,0,2,255,57,1,
+    80,58,0,52,0,2,254,120,5,49,1,35,3,5,2,5,
+    84,42,0,53,3,252,121,10,122,4,57,11,52,0,2,251,
+    57,12,4,13,1,93,12,2,22,11,2,11,57,11,4,5,
+    1,122,5,57,6,71,11,1,1,77,55,4,57,10,4,11,
+    0,4,12,1,94,11,2,120,11,49,2,111,11,49,11,2,
+    11,74,7,57,5,4,6,3,72,11,76,218,10,95,98,111,
+    111,116,115,116,114,97,112,218,5,95,119,114,97,112,218,9,
+    78,97,109,101,69,114,114,111,114,99,88,0,0,0,2,0,
+    0,0,19,0,0,0,2,0,0,0,3,0,0,0,0,0,
+    0,0,0,0,0,0,2,0,0,0,16,0,0,0,8,0,
+    0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,78,218,26,95,99,104,101,99,107,95,
+    110,97,109,101,46,60,108,111,99,97,108,115,62,46,95,119,
+    114,97,112,169,4,218,10,95,95,109,111,100,117,108,101,95,
+    95,218,8,95,95,110,97,109,101,95,95,218,12,95,95,113,
+    117,97,108,110,97,109,101,95,95,114,1,0,0,0,218,7,
+    104,97,115,97,116,116,114,218,7,115,101,116,97,116,116,114,
+    218,7,103,101,116,97,116,116,114,218,8,95,95,100,105,99,
+    116,95,95,218,6,117,112,100,97,116,101,29,2,0,0,41,
+    3,218,3,110,101,119,218,3,111,108,100,114,119,0,0,0,
+    114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,114,
+    236,0,0,0,115,12,0,0,0,2,0,0,1,9,1,18,
+    1,33,254,4,3,6,16,51,2,86,3,80,56,0,57,2,
+    53,3,254,57,7,4,8,1,4,9,2,71,8,2,0,84,
+    36,0,53,4,252,57,7,4,8,0,4,9,2,53,5,250,
+    57,13,4,14,1,4,15,2,71,14,2,0,57,10,71,8,
+    3,0,1,88,3,203,255,52,0,6,249,54,6,7,248,52,
+    1,6,247,57,8,73,7,2,0,1,51,0,76,0,0,0,
+    0,12,0,0,0,28,0,0,0,46,0,0,0,3,0,0,
+    0,10,2,0,0,41,3,114,233,0,0,0,114,234,0,0,
+    0,114,236,0,0,0,114,31,0,0,0,41,1,114,233,0,
+    0,0,114,32,0,0,0,114,224,0,0,0,115,14,0,0,
+    0,2,0,0,8,10,8,16,1,7,2,11,5,15,1,6,
+    9,122,2,57,3,107,3,2,3,57,1,53,4,254,57,3,
+    52,3,5,253,2,3,57,2,80,21,0,53,6,251,83,3,
+    13,0,107,7,57,2,97,3,80,5,0,99,3,4,6,2,
+    4,7,1,55,0,57,8,71,7,2,0,1,49,1,76,114,
+    224,0,0,0,99,90,0,0,0,2,0,0,0,3,0,0,
+    0,2,0,0,0,5,0,0,0,0,0,0,0,0,0,0,
+    0,2,0,0,0,16,0,0,0,11,0,0,0,9,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,218,155,84,114,121,32,116,111,32,102,105,110,100,32,97,
+    32,108,111,97,100,101,114,32,102,111,114,32,116,104,101,32,
+    115,112,101,99,105,102,105,101,100,32,109,111,100,117,108,101,
+    32,98,121,32,100,101,108,101,103,97,116,105,110,103,32,116,
+    111,10,32,32,32,32,115,101,108,102,46,102,105,110,100,95,
+    108,111,97,100,101,114,40,41,46,10,10,32,32,32,32,84,
+    104,105,115,32,109,101,116,104,111,100,32,105,115,32,100,101,
+    112,114,101,99,97,116,101,100,32,105,110,32,102,97,118,111,
+    114,32,111,102,32,102,105,110,100,101,114,46,102,105,110,100,
+    95,115,112,101,99,40,41,46,10,10,32,32,32,32,218,17,
+    95,102,105,110,100,95,109,111,100,117,108,101,95,115,104,105,
+    109,218,11,102,105,110,100,95,108,111,97,100,101,114,78,114,
+    28,0,0,0,218,44,78,111,116,32,105,109,112,111,114,116,
+    105,110,103,32,100,105,114,101,99,116,111,114,121,32,123,125,
+    58,32,109,105,115,115,105,110,103,32,95,95,105,110,105,116,
+    95,95,114,10,0,0,0,114,158,0,0,0,114,125,0,0,
+    0,114,4,0,0,0,218,13,73,109,112,111,114,116,87,97,
+    114,110,105,110,103,38,2,0,0,41,5,114,230,0,0,0,
+    218,8,102,117,108,108,110,97,109,101,218,6,108,111,97,100,
+    101,114,218,8,112,111,114,116,105,111,110,115,218,3,109,115,
+    103,114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,
+    114,251,0,0,0,115,12,0,0,0,2,0,0,10,23,1,
+    23,1,4,1,35,1,6,16,49,0,54,8,2,255,4,10,
+    1,73,9,2,0,106,5,2,0,5,2,6,5,3,5,51,
+    3,33,2,81,16,0,1,53,4,253,57,8,4,9,3,71,
+    9,1,0,84,42,0,122,5,57,4,53,6,251,54,8,7,
+    250,49,4,54,13,8,249,51,9,25,3,57,15,73,14,2,
+    0,57,10,53,10,247,57,11,73,9,3,0,1,49,2,76,
+    114,251,0,0,0,99,235,0,0,0,3,0,0,0,3,0,
+    0,0,3,0,0,0,6,0,0,0,0,0,0,0,0,0,
+    0,0,3,0,0,0,13,0,0,0,19,0,0,0,14,0,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    193,84,2,0,0,80,101,114,102,111,114,109,32,98,97,115,
-    105,99,32,118,97,108,105,100,105,116,121,32,99,104,101,99,
-    107,105,110,103,32,111,102,32,97,32,112,121,99,32,104,101,
-    97,100,101,114,32,97,110,100,32,114,101,116,117,114,110,32,
-    116,104,101,32,102,108,97,103,115,32,102,105,101,108,100,44,
-    10,32,32,32,32,119,104,105,99,104,32,100,101,116,101,114,
-    109,105,110,101,115,32,104,111,119,32,116,104,101,32,112,121,
-    99,32,115,104,111,117,108,100,32,98,101,32,102,117,114,116,
-    104,101,114,32,118,97,108,105,100,97,116,101,100,32,97,103,
-    97,105,110,115,116,32,116,104,101,32,115,111,117,114,99,101,
-    46,10,10,32,32,32,32,42,100,97,116,97,42,32,105,115,
-    32,116,104,101,32,99,111,110,116,101,110,116,115,32,111,102,
-    32,116,104,101,32,112,121,99,32,102,105,108,101,46,32,40,
-    79,110,108,121,32,116,104,101,32,102,105,114,115,116,32,49,
-    54,32,98,121,116,101,115,32,97,114,101,10,32,32,32,32,
-    114,101,113,117,105,114,101,100,44,32,116,104,111,117,103,104,
-    46,41,10,10,32,32,32,32,42,110,97,109,101,42,32,105,
-    115,32,116,104,101,32,110,97,109,101,32,111,102,32,116,104,
-    101,32,109,111,100,117,108,101,32,98,101,105,110,103,32,105,
-    109,112,111,114,116,101,100,46,32,73,116,32,105,115,32,117,
-    115,101,100,32,102,111,114,32,108,111,103,103,105,110,103,46,
-    10,10,32,32,32,32,42,101,120,99,95,100,101,116,97,105,
-    108,115,42,32,105,115,32,97,32,100,105,99,116,105,111,110,
-    97,114,121,32,112,97,115,115,101,100,32,116,111,32,73,109,
-    112,111,114,116,69,114,114,111,114,32,105,102,32,105,116,32,
-    114,97,105,115,101,100,32,102,111,114,10,32,32,32,32,105,
-    109,112,114,111,118,101,100,32,100,101,98,117,103,103,105,110,
-    103,46,10,10,32,32,32,32,73,109,112,111,114,116,69,114,
+    0,0,193,84,2,0,0,80,101,114,102,111,114,109,32,98,
+    97,115,105,99,32,118,97,108,105,100,105,116,121,32,99,104,
+    101,99,107,105,110,103,32,111,102,32,97,32,112,121,99,32,
+    104,101,97,100,101,114,32,97,110,100,32,114,101,116,117,114,
+    110,32,116,104,101,32,102,108,97,103,115,32,102,105,101,108,
+    100,44,10,32,32,32,32,119,104,105,99,104,32,100,101,116,
+    101,114,109,105,110,101,115,32,104,111,119,32,116,104,101,32,
+    112,121,99,32,115,104,111,117,108,100,32,98,101,32,102,117,
+    114,116,104,101,114,32,118,97,108,105,100,97,116,101,100,32,
+    97,103,97,105,110,115,116,32,116,104,101,32,115,111,117,114,
+    99,101,46,10,10,32,32,32,32,42,100,97,116,97,42,32,
+    105,115,32,116,104,101,32,99,111,110,116,101,110,116,115,32,
+    111,102,32,116,104,101,32,112,121,99,32,102,105,108,101,46,
+    32,40,79,110,108,121,32,116,104,101,32,102,105,114,115,116,
+    32,49,54,32,98,121,116,101,115,32,97,114,101,10,32,32,
+    32,32,114,101,113,117,105,114,101,100,44,32,116,104,111,117,
+    103,104,46,41,10,10,32,32,32,32,42,110,97,109,101,42,
+    32,105,115,32,116,104,101,32,110,97,109,101,32,111,102,32,
+    116,104,101,32,109,111,100,117,108,101,32,98,101,105,110,103,
+    32,105,109,112,111,114,116,101,100,46,32,73,116,32,105,115,
+    32,117,115,101,100,32,102,111,114,32,108,111,103,103,105,110,
+    103,46,10,10,32,32,32,32,42,101,120,99,95,100,101,116,
+    97,105,108,115,42,32,105,115,32,97,32,100,105,99,116,105,
+    111,110,97,114,121,32,112,97,115,115,101,100,32,116,111,32,
+    73,109,112,111,114,116,69,114,114,111,114,32,105,102,32,105,
+    116,32,114,97,105,115,101,100,32,102,111,114,10,32,32,32,
+    32,105,109,112,114,111,118,101,100,32,100,101,98,117,103,103,
+    105,110,103,46,10,10,32,32,32,32,73,109,112,111,114,116,
+    69,114,114,111,114,32,105,115,32,114,97,105,115,101,100,32,
+    119,104,101,110,32,116,104,101,32,109,97,103,105,99,32,110,
+    117,109,98,101,114,32,105,115,32,105,110,99,111,114,114,101,
+    99,116,32,111,114,32,119,104,101,110,32,116,104,101,32,102,
+    108,97,103,115,10,32,32,32,32,102,105,101,108,100,32,105,
+    115,32,105,110,118,97,108,105,100,46,32,69,79,70,69,114,
     114,111,114,32,105,115,32,114,97,105,115,101,100,32,119,104,
-    101,110,32,116,104,101,32,109,97,103,105,99,32,110,117,109,
-    98,101,114,32,105,115,32,105,110,99,111,114,114,101,99,116,
-    32,111,114,32,119,104,101,110,32,116,104,101,32,102,108,97,
-    103,115,10,32,32,32,32,102,105,101,108,100,32,105,115,32,
-    105,110,118,97,108,105,100,46,32,69,79,70,69,114,114,111,
-    114,32,105,115,32,114,97,105,115,101,100,32,119,104,101,110,
-    32,116,104,101,32,100,97,116,97,32,105,115,32,102,111,117,
-    110,100,32,116,111,32,98,101,32,116,114,117,110,99,97,116,
-    101,100,46,10,10,32,32,32,32,218,13,95,99,108,97,115,
-    115,105,102,121,95,112,121,99,186,78,114,67,0,0,0,78,
-    114,143,0,0,0,218,20,98,97,100,32,109,97,103,105,99,
-    32,110,117,109,98,101,114,32,105,110,32,218,2,58,32,114,
-    234,0,0,0,218,16,95,118,101,114,98,111,115,101,95,109,
-    101,115,115,97,103,101,218,2,123,125,114,226,0,0,0,114,
-    28,0,0,0,233,16,0,0,0,218,40,114,101,97,99,104,
-    101,100,32,69,79,70,32,119,104,105,108,101,32,114,101,97,
-    100,105,110,103,32,112,121,99,32,104,101,97,100,101,114,32,
-    111,102,32,218,8,69,79,70,69,114,114,111,114,114,71,0,
-    0,0,186,114,67,0,0,0,233,8,0,0,0,78,233,252,
-    255,255,255,218,14,105,110,118,97,108,105,100,32,102,108,97,
-    103,115,32,218,4,32,105,110,32,49,2,0,0,41,6,114,
-    73,0,0,0,114,225,0,0,0,218,11,101,120,99,95,100,
-    101,116,97,105,108,115,218,5,109,97,103,105,99,114,180,0,
-    0,0,114,56,0,0,0,114,31,0,0,0,114,31,0,0,
-    0,114,32,0,0,0,114,3,1,0,0,115,30,0,0,0,
-    2,0,0,16,6,1,9,1,30,1,19,1,19,1,24,1,
-    18,1,19,1,13,1,17,2,7,1,30,1,19,1,6,13,
-    51,2,25,0,57,3,53,3,254,35,3,3,84,71,0,51,
-    4,57,6,49,1,74,2,74,4,57,7,51,5,57,8,49,
-    3,74,2,74,4,57,9,75,6,6,4,57,4,53,6,252,
-    54,9,7,251,51,8,57,11,4,12,4,73,10,3,0,1,
-    53,9,249,57,11,4,12,4,93,12,1,57,6,4,7,2,
-    72,12,77,53,10,247,57,9,4,10,0,71,10,1,0,57,
-    6,51,11,35,0,6,2,6,84,53,0,51,12,57,6,49,
-    1,74,2,74,4,57,7,75,6,6,2,57,4,53,6,252,
-    54,9,7,246,51,8,57,11,4,12,4,73,10,3,0,1,
-    53,13,244,57,9,4,10,4,71,10,1,0,77,53,14,242,
-    57,9,51,15,25,0,57,10,71,10,1,0,57,5,51,16,
-    30,5,84,52,0,51,17,57,6,49,5,74,2,74,4,57,
-    7,51,18,57,8,49,1,74,2,74,4,57,9,75,6,6,
-    4,57,4,53,9,249,57,11,4,12,4,93,12,1,57,6,
-    4,7,2,72,12,77,49,5,76,114,3,1,0,0,99,162,
-    0,0,0,5,0,0,0,3,0,0,0,5,0,0,0,6,
-    0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,14,
-    0,0,0,12,0,0,0,7,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,193,7,2,0,0,
-    86,97,108,105,100,97,116,101,32,97,32,112,121,99,32,97,
-    103,97,105,110,115,116,32,116,104,101,32,115,111,117,114,99,
-    101,32,108,97,115,116,45,109,111,100,105,102,105,101,100,32,
-    116,105,109,101,46,10,10,32,32,32,32,42,100,97,116,97,
-    42,32,105,115,32,116,104,101,32,99,111,110,116,101,110,116,
-    115,32,111,102,32,116,104,101,32,112,121,99,32,102,105,108,
-    101,46,32,40,79,110,108,121,32,116,104,101,32,102,105,114,
-    115,116,32,49,54,32,98,121,116,101,115,32,97,114,101,10,
-    32,32,32,32,114,101,113,117,105,114,101,100,46,41,10,10,
-    32,32,32,32,42,115,111,117,114,99,101,95,109,116,105,109,
-    101,42,32,105,115,32,116,104,101,32,108,97,115,116,32,109,
-    111,100,105,102,105,101,100,32,116,105,109,101,115,116,97,109,
-    112,32,111,102,32,116,104,101,32,115,111,117,114,99,101,32,
-    102,105,108,101,46,10,10,32,32,32,32,42,115,111,117,114,
-    99,101,95,115,105,122,101,42,32,105,115,32,78,111,110,101,
-    32,111,114,32,116,104,101,32,115,105,122,101,32,111,102,32,
-    116,104,101,32,115,111,117,114,99,101,32,102,105,108,101,32,
-    105,110,32,98,121,116,101,115,46,10,10,32,32,32,32,42,
-    110,97,109,101,42,32,105,115,32,116,104,101,32,110,97,109,
-    101,32,111,102,32,116,104,101,32,109,111,100,117,108,101,32,
-    98,101,105,110,103,32,105,109,112,111,114,116,101,100,46,32,
-    73,116,32,105,115,32,117,115,101,100,32,102,111,114,32,108,
-    111,103,103,105,110,103,46,10,10,32,32,32,32,42,101,120,
-    99,95,100,101,116,97,105,108,115,42,32,105,115,32,97,32,
-    100,105,99,116,105,111,110,97,114,121,32,112,97,115,115,101,
-    100,32,116,111,32,73,109,112,111,114,116,69,114,114,111,114,
-    32,105,102,32,105,116,32,114,97,105,115,101,100,32,102,111,
-    114,10,32,32,32,32,105,109,112,114,111,118,101,100,32,100,
-    101,98,117,103,103,105,110,103,46,10,10,32,32,32,32,65,
-    110,32,73,109,112,111,114,116,69,114,114,111,114,32,105,115,
-    32,114,97,105,115,101,100,32,105,102,32,116,104,101,32,98,
-    121,116,101,99,111,100,101,32,105,115,32,115,116,97,108,101,
-    46,10,10,32,32,32,32,218,23,95,118,97,108,105,100,97,
-    116,101,95,116,105,109,101,115,116,97,109,112,95,112,121,99,
-    114,71,0,0,0,186,114,13,1,0,0,233,12,0,0,0,
-    78,114,65,0,0,0,218,22,98,121,116,101,99,111,100,101,
-    32,105,115,32,115,116,97,108,101,32,102,111,114,32,114,234,
-    0,0,0,114,7,1,0,0,114,8,1,0,0,114,226,0,
-    0,0,78,186,114,22,1,0,0,114,9,1,0,0,78,82,
-    2,0,0,41,6,114,73,0,0,0,218,12,115,111,117,114,
-    99,101,95,109,116,105,109,101,218,11,115,111,117,114,99,101,
-    95,115,105,122,101,114,225,0,0,0,114,17,1,0,0,114,
-    180,0,0,0,114,31,0,0,0,114,31,0,0,0,114,32,
-    0,0,0,114,20,1,0,0,115,18,0,0,0,2,0,0,
-    19,29,1,18,1,19,1,19,1,9,1,26,255,3,2,6,
-    14,53,2,254,57,9,51,3,25,0,57,10,71,10,1,0,
-    57,6,51,4,30,1,35,3,6,2,6,84,59,0,51,5,
-    57,6,49,3,74,2,74,4,57,7,75,6,6,2,57,5,
-    53,6,252,54,9,7,251,51,8,57,11,4,12,5,73,10,
-    3,0,1,53,9,249,57,11,4,12,5,93,12,1,57,6,
-    4,7,4,72,12,77,51,10,33,2,17,81,30,0,1,53,
-    2,254,57,9,51,11,25,0,57,10,71,10,1,0,57,6,
-    51,4,30,2,35,3,6,2,6,84,37,0,53,9,249,57,
-    11,51,5,57,12,49,3,74,2,74,4,57,13,75,6,12,
-    2,57,12,93,12,1,57,6,4,7,4,72,12,77,51,10,
-    76,114,20,1,0,0,99,55,0,0,0,4,0,0,0,3,
-    0,0,0,4,0,0,0,4,0,0,0,0,0,0,0,0,
-    0,0,0,4,0,0,0,12,0,0,0,6,0,0,0,2,
+    101,110,32,116,104,101,32,100,97,116,97,32,105,115,32,102,
+    111,117,110,100,32,116,111,32,98,101,32,116,114,117,110,99,
+    97,116,101,100,46,10,10,32,32,32,32,218,13,95,99,108,
+    97,115,115,105,102,121,95,112,121,99,186,78,114,67,0,0,
+    0,78,114,143,0,0,0,218,20,98,97,100,32,109,97,103,
+    105,99,32,110,117,109,98,101,114,32,105,110,32,218,2,58,
+    32,114,235,0,0,0,218,16,95,118,101,114,98,111,115,101,
+    95,109,101,115,115,97,103,101,218,2,123,125,114,227,0,0,
+    0,114,28,0,0,0,233,16,0,0,0,218,40,114,101,97,
+    99,104,101,100,32,69,79,70,32,119,104,105,108,101,32,114,
+    101,97,100,105,110,103,32,112,121,99,32,104,101,97,100,101,
+    114,32,111,102,32,218,8,69,79,70,69,114,114,111,114,114,
+    71,0,0,0,186,114,67,0,0,0,233,8,0,0,0,78,
+    233,252,255,255,255,218,14,105,110,118,97,108,105,100,32,102,
+    108,97,103,115,32,218,4,32,105,110,32,55,2,0,0,41,
+    6,114,73,0,0,0,114,226,0,0,0,218,11,101,120,99,
+    95,100,101,116,97,105,108,115,218,5,109,97,103,105,99,114,
+    181,0,0,0,114,56,0,0,0,114,31,0,0,0,114,31,
+    0,0,0,114,32,0,0,0,114,4,1,0,0,115,30,0,
+    0,0,2,0,0,16,6,1,9,1,30,1,19,1,19,1,
+    24,1,18,1,19,1,13,1,17,2,7,1,30,1,19,1,
+    6,13,51,2,25,0,57,3,53,3,254,123,3,3,84,71,
+    0,122,4,120,6,49,1,74,2,74,4,121,7,122,5,120,
+    8,49,3,74,2,74,4,57,9,75,6,6,4,57,4,53,
+    6,252,54,9,7,251,122,8,57,11,4,12,4,73,10,3,
+    0,1,53,9,249,57,11,4,12,4,93,12,1,57,6,4,
+    7,2,72,12,77,53,10,247,57,9,4,10,0,71,10,1,
+    0,121,6,51,11,35,0,6,2,6,84,53,0,122,12,120,
+    6,49,1,74,2,74,4,57,7,75,6,6,2,57,4,53,
+    6,252,54,9,7,246,122,8,57,11,4,12,4,73,10,3,
+    0,1,53,13,244,57,9,4,10,4,71,10,1,0,77,53,
+    14,242,121,9,51,15,25,0,57,10,71,10,1,0,121,5,
+    51,16,30,5,84,52,0,122,17,120,6,49,5,74,2,74,
+    4,121,7,122,18,120,8,49,1,74,2,74,4,57,9,75,
+    6,6,4,57,4,53,9,249,57,11,4,12,4,93,12,1,
+    57,6,4,7,2,72,12,77,49,5,76,114,4,1,0,0,
+    99,162,0,0,0,5,0,0,0,3,0,0,0,5,0,0,
+    0,6,0,0,0,0,0,0,0,0,0,0,0,5,0,0,
+    0,14,0,0,0,12,0,0,0,7,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,193,7,2,
+    0,0,86,97,108,105,100,97,116,101,32,97,32,112,121,99,
+    32,97,103,97,105,110,115,116,32,116,104,101,32,115,111,117,
+    114,99,101,32,108,97,115,116,45,109,111,100,105,102,105,101,
+    100,32,116,105,109,101,46,10,10,32,32,32,32,42,100,97,
+    116,97,42,32,105,115,32,116,104,101,32,99,111,110,116,101,
+    110,116,115,32,111,102,32,116,104,101,32,112,121,99,32,102,
+    105,108,101,46,32,40,79,110,108,121,32,116,104,101,32,102,
+    105,114,115,116,32,49,54,32,98,121,116,101,115,32,97,114,
+    101,10,32,32,32,32,114,101,113,117,105,114,101,100,46,41,
+    10,10,32,32,32,32,42,115,111,117,114,99,101,95,109,116,
+    105,109,101,42,32,105,115,32,116,104,101,32,108,97,115,116,
+    32,109,111,100,105,102,105,101,100,32,116,105,109,101,115,116,
+    97,109,112,32,111,102,32,116,104,101,32,115,111,117,114,99,
+    101,32,102,105,108,101,46,10,10,32,32,32,32,42,115,111,
+    117,114,99,101,95,115,105,122,101,42,32,105,115,32,78,111,
+    110,101,32,111,114,32,116,104,101,32,115,105,122,101,32,111,
+    102,32,116,104,101,32,115,111,117,114,99,101,32,102,105,108,
+    101,32,105,110,32,98,121,116,101,115,46,10,10,32,32,32,
+    32,42,110,97,109,101,42,32,105,115,32,116,104,101,32,110,
+    97,109,101,32,111,102,32,116,104,101,32,109,111,100,117,108,
+    101,32,98,101,105,110,103,32,105,109,112,111,114,116,101,100,
+    46,32,73,116,32,105,115,32,117,115,101,100,32,102,111,114,
+    32,108,111,103,103,105,110,103,46,10,10,32,32,32,32,42,
+    101,120,99,95,100,101,116,97,105,108,115,42,32,105,115,32,
+    97,32,100,105,99,116,105,111,110,97,114,121,32,112,97,115,
+    115,101,100,32,116,111,32,73,109,112,111,114,116,69,114,114,
+    111,114,32,105,102,32,105,116,32,114,97,105,115,101,100,32,
+    102,111,114,10,32,32,32,32,105,109,112,114,111,118,101,100,
+    32,100,101,98,117,103,103,105,110,103,46,10,10,32,32,32,
+    32,65,110,32,73,109,112,111,114,116,69,114,114,111,114,32,
+    105,115,32,114,97,105,115,101,100,32,105,102,32,116,104,101,
+    32,98,121,116,101,99,111,100,101,32,105,115,32,115,116,97,
+    108,101,46,10,10,32,32,32,32,218,23,95,118,97,108,105,
+    100,97,116,101,95,116,105,109,101,115,116,97,109,112,95,112,
+    121,99,114,71,0,0,0,186,114,14,1,0,0,233,12,0,
+    0,0,78,114,65,0,0,0,218,22,98,121,116,101,99,111,
+    100,101,32,105,115,32,115,116,97,108,101,32,102,111,114,32,
+    114,235,0,0,0,114,8,1,0,0,114,9,1,0,0,114,
+    227,0,0,0,78,186,114,23,1,0,0,114,10,1,0,0,
+    78,88,2,0,0,41,6,114,73,0,0,0,218,12,115,111,
+    117,114,99,101,95,109,116,105,109,101,218,11,115,111,117,114,
+    99,101,95,115,105,122,101,114,226,0,0,0,114,18,1,0,
+    0,114,181,0,0,0,114,31,0,0,0,114,31,0,0,0,
+    114,32,0,0,0,114,21,1,0,0,115,18,0,0,0,2,
+    0,0,19,29,1,18,1,19,1,19,1,9,1,26,255,3,
+    2,6,14,53,2,254,121,9,51,3,25,0,57,10,71,10,
+    1,0,121,6,51,4,30,1,35,3,6,2,6,84,59,0,
+    122,5,120,6,49,3,74,2,74,4,57,7,75,6,6,2,
+    57,5,53,6,252,54,9,7,251,122,8,57,11,4,12,5,
+    73,10,3,0,1,53,9,249,57,11,4,12,5,93,12,1,
+    57,6,4,7,4,72,12,77,51,10,33,2,17,81,30,0,
+    1,53,2,254,121,9,51,11,25,0,57,10,71,10,1,0,
+    121,6,51,4,30,2,35,3,6,2,6,84,37,0,53,9,
+    249,121,11,122,5,120,12,49,3,74,2,74,4,57,13,75,
+    6,12,2,57,12,93,12,1,57,6,4,7,4,72,12,77,
+    51,10,76,114,21,1,0,0,99,55,0,0,0,4,0,0,
+    0,3,0,0,0,4,0,0,0,4,0,0,0,0,0,0,
+    0,0,0,0,0,4,0,0,0,12,0,0,0,6,0,0,
+    0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,193,243,1,0,0,86,97,108,105,100,97,
+    116,101,32,97,32,104,97,115,104,45,98,97,115,101,100,32,
+    112,121,99,32,98,121,32,99,104,101,99,107,105,110,103,32,
+    116,104,101,32,114,101,97,108,32,115,111,117,114,99,101,32,
+    104,97,115,104,32,97,103,97,105,110,115,116,32,116,104,101,
+    32,111,110,101,32,105,110,10,32,32,32,32,116,104,101,32,
+    112,121,99,32,104,101,97,100,101,114,46,10,10,32,32,32,
+    32,42,100,97,116,97,42,32,105,115,32,116,104,101,32,99,
+    111,110,116,101,110,116,115,32,111,102,32,116,104,101,32,112,
+    121,99,32,102,105,108,101,46,32,40,79,110,108,121,32,116,
+    104,101,32,102,105,114,115,116,32,49,54,32,98,121,116,101,
+    115,32,97,114,101,10,32,32,32,32,114,101,113,117,105,114,
+    101,100,46,41,10,10,32,32,32,32,42,115,111,117,114,99,
+    101,95,104,97,115,104,42,32,105,115,32,116,104,101,32,105,
+    109,112,111,114,116,108,105,98,46,117,116,105,108,46,115,111,
+    117,114,99,101,95,104,97,115,104,40,41,32,111,102,32,116,
+    104,101,32,115,111,117,114,99,101,32,102,105,108,101,46,10,
+    10,32,32,32,32,42,110,97,109,101,42,32,105,115,32,116,
+    104,101,32,110,97,109,101,32,111,102,32,116,104,101,32,109,
+    111,100,117,108,101,32,98,101,105,110,103,32,105,109,112,111,
+    114,116,101,100,46,32,73,116,32,105,115,32,117,115,101,100,
+    32,102,111,114,32,108,111,103,103,105,110,103,46,10,10,32,
+    32,32,32,42,101,120,99,95,100,101,116,97,105,108,115,42,
+    32,105,115,32,97,32,100,105,99,116,105,111,110,97,114,121,
+    32,112,97,115,115,101,100,32,116,111,32,73,109,112,111,114,
+    116,69,114,114,111,114,32,105,102,32,105,116,32,114,97,105,
+    115,101,100,32,102,111,114,10,32,32,32,32,105,109,112,114,
+    111,118,101,100,32,100,101,98,117,103,103,105,110,103,46,10,
+    10,32,32,32,32,65,110,32,73,109,112,111,114,116,69,114,
+    114,111,114,32,105,115,32,114,97,105,115,101,100,32,105,102,
+    32,116,104,101,32,98,121,116,101,99,111,100,101,32,105,115,
+    32,115,116,97,108,101,46,10,10,32,32,32,32,218,18,95,
+    118,97,108,105,100,97,116,101,95,104,97,115,104,95,112,121,
+    99,186,114,14,1,0,0,114,10,1,0,0,78,114,227,0,
+    0,0,218,46,104,97,115,104,32,105,110,32,98,121,116,101,
+    99,111,100,101,32,100,111,101,115,110,39,116,32,109,97,116,
+    99,104,32,104,97,115,104,32,111,102,32,115,111,117,114,99,
+    101,32,78,116,2,0,0,41,4,114,73,0,0,0,218,11,
+    115,111,117,114,99,101,95,104,97,115,104,114,226,0,0,0,
+    114,18,1,0,0,114,31,0,0,0,114,31,0,0,0,114,
+    32,0,0,0,114,29,1,0,0,115,10,0,0,0,2,0,
+    0,17,16,1,5,1,16,255,6,12,51,2,25,0,120,4,
+    49,1,35,3,4,2,4,84,37,0,53,3,254,121,9,122,
+    4,120,10,49,2,74,2,74,4,57,11,75,6,10,2,57,
+    10,93,10,1,57,4,4,5,3,72,10,77,51,5,76,114,
+    29,1,0,0,99,121,0,0,0,4,0,0,0,3,0,0,
+    0,4,0,0,0,5,0,0,0,3,0,0,0,0,0,0,
+    0,4,0,0,0,18,0,0,0,16,0,0,0,16,0,0,
+    0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,
+    0,218,35,67,111,109,112,105,108,101,32,98,121,116,101,99,
+    111,100,101,32,97,115,32,102,111,117,110,100,32,105,110,32,
+    97,32,112,121,99,46,218,17,95,99,111,109,112,105,108,101,
+    95,98,121,116,101,99,111,100,101,114,12,0,0,0,218,5,
+    108,111,97,100,115,218,10,105,115,105,110,115,116,97,110,99,
+    101,114,140,0,0,0,114,235,0,0,0,114,8,1,0,0,
+    218,21,99,111,100,101,32,111,98,106,101,99,116,32,102,114,
+    111,109,32,123,33,114,125,78,114,3,0,0,0,218,16,95,
+    102,105,120,95,99,111,95,102,105,108,101,110,97,109,101,114,
+    227,0,0,0,218,23,78,111,110,45,99,111,100,101,32,111,
+    98,106,101,99,116,32,105,110,32,123,33,114,125,114,125,0,
+    0,0,169,2,114,226,0,0,0,114,90,0,0,0,1,0,
+    0,0,1,0,0,0,2,0,0,0,2,0,0,0,3,0,
+    0,0,3,0,0,0,140,2,0,0,41,5,114,73,0,0,
+    0,114,226,0,0,0,114,215,0,0,0,114,218,0,0,0,
+    218,4,99,111,100,101,114,31,0,0,0,114,31,0,0,0,
+    114,32,0,0,0,114,34,1,0,0,115,16,0,0,0,2,
+    0,0,2,16,1,20,1,19,1,8,1,18,1,3,2,6,
+    18,53,2,254,54,8,3,253,4,10,0,73,9,2,0,57,
+    4,53,4,251,57,8,4,9,4,53,5,249,57,10,71,9,
+    2,0,84,51,0,53,6,247,54,8,7,246,122,8,57,10,
+    4,11,2,73,9,3,0,1,51,9,33,3,17,84,21,0,
+    53,10,244,54,8,11,243,4,10,4,4,11,3,73,9,3,
+    0,1,49,4,76,53,12,241,121,11,51,13,54,15,14,240,
+    4,17,2,73,16,2,0,57,12,4,5,1,4,6,2,122,
+    15,57,7,71,12,1,2,77,114,34,1,0,0,99,124,0,
+    0,0,3,0,0,0,3,0,0,0,3,0,0,0,4,0,
+    0,0,2,0,0,0,0,0,0,0,3,0,0,0,15,0,
+    0,0,9,0,0,0,13,0,0,0,0,0,0,0,2,0,
+    0,0,0,0,0,0,0,0,0,0,218,43,80,114,111,100,
+    117,99,101,32,116,104,101,32,100,97,116,97,32,102,111,114,
+    32,97,32,116,105,109,101,115,116,97,109,112,45,98,97,115,
+    101,100,32,112,121,99,46,218,22,95,99,111,100,101,95,116,
+    111,95,116,105,109,101,115,116,97,109,112,95,112,121,99,218,
+    9,98,121,116,101,97,114,114,97,121,114,143,0,0,0,218,
+    6,101,120,116,101,110,100,114,63,0,0,0,114,4,0,0,
+    0,114,12,0,0,0,218,5,100,117,109,112,115,1,0,0,
+    0,1,0,0,0,2,0,0,0,2,0,0,0,153,2,0,
+    0,41,4,114,41,1,0,0,218,5,109,116,105,109,101,114,
+    27,1,0,0,114,73,0,0,0,114,31,0,0,0,114,31,
+    0,0,0,114,32,0,0,0,114,43,1,0,0,115,14,0,
+    0,0,2,0,0,2,16,1,26,1,25,1,25,1,27,1,
+    6,15,53,2,254,57,7,53,3,252,57,8,71,8,1,0,
+    120,3,49,3,54,7,4,251,53,5,249,121,12,122,6,57,
+    13,71,13,1,0,57,9,73,8,2,0,1,49,3,54,7,
+    4,248,53,5,249,57,12,4,13,1,71,13,1,0,57,9,
+    73,8,2,0,1,49,3,54,7,4,247,53,5,249,57,12,
+    4,13,2,71,13,1,0,57,9,73,8,2,0,1,49,3,
+    54,7,4,246,53,7,244,54,12,8,243,4,14,0,73,13,
+    2,0,57,9,73,8,2,0,1,49,3,76,114,43,1,0,
+    0,84,99,127,0,0,0,3,0,0,0,3,0,0,0,3,
+    0,0,0,5,0,0,0,1,0,0,0,0,0,0,0,3,
+    0,0,0,16,0,0,0,11,0,0,0,14,0,0,0,0,
+    0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,218,
+    38,80,114,111,100,117,99,101,32,116,104,101,32,100,97,116,
+    97,32,102,111,114,32,97,32,104,97,115,104,45,98,97,115,
+    101,100,32,112,121,99,46,218,17,95,99,111,100,101,95,116,
+    111,95,104,97,115,104,95,112,121,99,114,44,1,0,0,114,
+    143,0,0,0,114,29,0,0,0,114,45,1,0,0,114,63,
+    0,0,0,114,28,0,0,0,114,14,1,0,0,114,12,0,
+    0,0,114,46,1,0,0,1,0,0,0,2,0,0,0,163,
+    2,0,0,41,5,114,41,1,0,0,114,32,1,0,0,218,
+    7,99,104,101,99,107,101,100,114,73,0,0,0,114,56,0,
+    0,0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,
+    0,114,49,1,0,0,115,16,0,0,0,2,0,0,2,16,
+    1,14,1,25,1,26,1,14,1,27,1,6,16,53,2,254,
+    57,8,53,3,252,57,9,71,9,1,0,121,3,122,4,121,
+    5,51,4,28,2,32,5,2,5,120,4,49,3,54,8,5,
+    251,53,6,249,57,13,4,14,4,71,14,1,0,57,10,73,
+    9,2,0,1,53,7,247,57,8,4,9,1,71,9,1,0,
+    121,5,51,8,35,2,5,2,5,85,5,0,74,8,49,3,
+    54,8,5,246,4,10,1,73,9,2,0,1,49,3,54,8,
+    5,245,53,9,243,54,13,10,242,4,15,0,73,14,2,0,
+    57,10,73,9,2,0,1,49,3,76,114,49,1,0,0,99,
+    95,0,0,0,1,0,0,0,3,0,0,0,1,0,0,0,
+    5,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+    16,0,0,0,12,0,0,0,8,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,218,121,68,101,
+    99,111,100,101,32,98,121,116,101,115,32,114,101,112,114,101,
+    115,101,110,116,105,110,103,32,115,111,117,114,99,101,32,99,
+    111,100,101,32,97,110,100,32,114,101,116,117,114,110,32,116,
+    104,101,32,115,116,114,105,110,103,46,10,10,32,32,32,32,
+    85,110,105,118,101,114,115,97,108,32,110,101,119,108,105,110,
+    101,32,115,117,112,112,111,114,116,32,105,115,32,117,115,101,
+    100,32,105,110,32,116,104,101,32,100,101,99,111,100,105,110,
+    103,46,10,32,32,32,32,218,13,100,101,99,111,100,101,95,
+    115,111,117,114,99,101,169,3,218,8,116,111,107,101,110,105,
+    122,101,78,114,4,0,0,0,114,6,0,0,0,218,7,66,
+    121,116,101,115,73,79,218,8,114,101,97,100,108,105,110,101,
+    218,15,100,101,116,101,99,116,95,101,110,99,111,100,105,110,
+    103,218,25,73,110,99,114,101,109,101,110,116,97,108,78,101,
+    119,108,105,110,101,68,101,99,111,100,101,114,78,84,218,6,
+    100,101,99,111,100,101,114,4,0,0,0,174,2,0,0,41,
+    5,218,12,115,111,117,114,99,101,95,98,121,116,101,115,114,
+    54,1,0,0,218,21,115,111,117,114,99,101,95,98,121,116,
+    101,115,95,114,101,97,100,108,105,110,101,218,8,101,110,99,
+    111,100,105,110,103,218,15,110,101,119,108,105,110,101,95,100,
+    101,99,111,100,101,114,114,31,0,0,0,114,31,0,0,0,
+    114,32,0,0,0,114,52,1,0,0,115,12,0,0,0,2,
+    0,0,5,4,1,24,1,15,1,21,1,6,16,89,2,57,
+    1,53,3,254,54,8,4,253,4,10,0,73,9,2,0,57,
+    5,52,5,5,252,2,5,120,2,49,1,54,8,6,251,4,
+    10,2,73,9,2,0,57,3,53,3,254,54,8,7,250,122,
+    8,121,10,122,9,57,11,73,9,3,0,120,4,49,4,54,
+    8,10,249,49,0,54,13,10,248,51,11,25,3,57,15,73,
+    14,2,0,57,10,73,9,2,0,76,114,52,1,0,0,218,
+    6,111,98,106,101,99,116,218,9,95,80,79,80,85,76,65,
+    84,69,99,95,1,0,0,2,0,32,0,3,0,0,0,2,
+    0,0,0,9,0,0,0,3,0,0,0,0,0,0,0,4,
+    0,0,0,20,0,0,0,24,0,0,0,24,0,0,0,0,
+    0,0,0,3,0,0,0,2,0,0,0,0,0,0,0,193,
+    61,1,0,0,82,101,116,117,114,110,32,97,32,109,111,100,
+    117,108,101,32,115,112,101,99,32,98,97,115,101,100,32,111,
+    110,32,97,32,102,105,108,101,32,108,111,99,97,116,105,111,
+    110,46,10,10,32,32,32,32,84,111,32,105,110,100,105,99,
+    97,116,101,32,116,104,97,116,32,116,104,101,32,109,111,100,
+    117,108,101,32,105,115,32,97,32,112,97,99,107,97,103,101,
+    44,32,115,101,116,10,32,32,32,32,115,117,98,109,111,100,
+    117,108,101,95,115,101,97,114,99,104,95,108,111,99,97,116,
+    105,111,110,115,32,116,111,32,97,32,108,105,115,116,32,111,
+    102,32,100,105,114,101,99,116,111,114,121,32,112,97,116,104,
+    115,46,32,32,65,110,10,32,32,32,32,101,109,112,116,121,
+    32,108,105,115,116,32,105,115,32,115,117,102,102,105,99,105,
+    101,110,116,44,32,116,104,111,117,103,104,32,105,116,115,32,
+    110,111,116,32,111,116,104,101,114,119,105,115,101,32,117,115,
+    101,102,117,108,32,116,111,32,116,104,101,10,32,32,32,32,
+    105,109,112,111,114,116,32,115,121,115,116,101,109,46,10,10,
+    32,32,32,32,84,104,101,32,108,111,97,100,101,114,32,109,
+    117,115,116,32,116,97,107,101,32,97,32,115,112,101,99,32,
+    97,115,32,105,116,115,32,111,110,108,121,32,95,95,105,110,
+    105,116,95,95,40,41,32,97,114,103,46,10,10,32,32,32,
+    32,218,23,115,112,101,99,95,102,114,111,109,95,102,105,108,
+    101,95,108,111,99,97,116,105,111,110,78,218,9,60,117,110,
+    107,110,111,119,110,62,114,243,0,0,0,218,12,103,101,116,
+    95,102,105,108,101,110,97,109,101,114,227,0,0,0,114,18,
+    0,0,0,114,163,0,0,0,114,235,0,0,0,218,10,77,
+    111,100,117,108,101,83,112,101,99,169,1,218,6,111,114,105,
+    103,105,110,84,218,13,95,115,101,116,95,102,105,108,101,97,
+    116,116,114,218,27,95,103,101,116,95,115,117,112,112,111,114,
+    116,101,100,95,102,105,108,101,95,108,111,97,100,101,114,115,
+    114,81,0,0,0,114,34,0,0,0,114,0,1,0,0,114,
+    65,1,0,0,218,10,105,115,95,112,97,99,107,97,103,101,
+    218,26,115,117,98,109,111,100,117,108,101,95,115,101,97,114,
+    99,104,95,108,111,99,97,116,105,111,110,115,114,95,0,0,
+    0,114,4,0,0,0,114,84,0,0,0,1,0,0,0,1,
+    0,0,0,2,0,0,0,2,0,0,0,3,0,0,0,3,
+    0,0,0,32,0,0,0,50,0,0,0,64,0,0,0,9,
+    0,0,0,237,0,0,0,255,0,0,0,13,1,0,0,9,
+    0,0,0,191,2,0,0,41,9,114,226,0,0,0,218,8,
+    108,111,99,97,116,105,111,110,114,0,1,0,0,114,76,1,
+    0,0,218,4,115,112,101,99,218,12,108,111,97,100,101,114,
+    95,99,108,97,115,115,218,8,115,117,102,102,105,120,101,115,
+    114,75,1,0,0,218,7,100,105,114,110,97,109,101,114,31,
+    0,0,0,114,31,0,0,0,114,32,0,0,0,114,67,1,
+    0,0,115,62,0,0,0,2,0,0,12,7,4,4,1,19,
+    3,18,1,7,1,10,2,16,8,32,1,5,3,7,1,24,
+    1,27,1,15,1,5,1,5,252,4,6,3,3,8,2,19,
+    2,18,1,7,1,7,2,5,1,9,2,5,1,17,1,5,
+    1,22,1,16,2,6,20,51,2,33,1,84,61,0,122,3,
+    57,1,53,4,254,57,12,4,13,2,122,5,57,14,71,13,
+    2,0,84,35,0,49,2,54,12,5,253,4,14,0,73,13,
+    2,0,57,1,80,17,0,53,6,251,83,9,9,0,97,9,
+    80,5,0,99,9,80,19,0,53,7,249,54,12,8,248,4,
+    14,1,73,13,2,0,57,1,53,9,246,57,9,52,9,10,
+    245,2,9,57,14,4,15,0,4,16,2,4,9,1,122,11,
+    57,10,71,15,2,1,121,4,51,12,59,4,13,51,2,33,
+    2,84,86,0,53,14,243,57,12,71,13,0,0,86,9,80,
+    65,0,106,10,2,0,5,5,11,5,6,10,49,1,54,13,
+    15,242,53,16,240,57,18,4,19,6,71,19,1,0,57,15,
+    73,14,2,0,84,28,0,4,13,5,4,14,0,4,15,1,
+    71,14,2,0,120,2,49,2,59,4,17,2,9,80,10,0,
+    88,9,194,255,51,2,76,53,18,238,33,3,84,68,0,53,
+    4,254,57,12,4,13,2,122,19,57,14,71,13,2,0,84,
+    46,0,49,2,54,12,19,237,4,14,0,73,13,2,0,57,
+    7,80,17,0,53,6,251,83,9,9,0,97,9,80,16,0,
+    99,9,49,7,84,9,0,94,9,0,59,4,20,80,8,0,
+    49,3,59,4,20,52,4,20,236,57,9,94,10,0,35,2,
+    9,2,9,84,46,0,49,1,84,41,0,53,21,234,57,12,
+    4,13,1,71,13,1,0,121,9,51,22,25,9,2,9,57,
+    8,52,4,20,233,54,12,23,232,4,14,8,73,13,2,0,
+    1,49,4,76,114,67,1,0,0,99,108,0,0,0,0,0,
+    128,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,14,0,0,0,22,0,
+    0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,114,241,0,0,0,114,240,0,0,0,
+    218,21,87,105,110,100,111,119,115,82,101,103,105,115,116,114,
+    121,70,105,110,100,101,114,114,242,0,0,0,218,62,77,101,
+    116,97,32,112,97,116,104,32,102,105,110,100,101,114,32,102,
+    111,114,32,109,111,100,117,108,101,115,32,100,101,99,108,97,
+    114,101,100,32,105,110,32,116,104,101,32,87,105,110,100,111,
+    119,115,32,114,101,103,105,115,116,114,121,46,114,1,0,0,
+    0,218,59,83,111,102,116,119,97,114,101,92,80,121,116,104,
+    111,110,92,80,121,116,104,111,110,67,111,114,101,92,123,115,
+    121,115,95,118,101,114,115,105,111,110,125,92,77,111,100,117,
+    108,101,115,92,123,102,117,108,108,110,97,109,101,125,218,12,
+    82,69,71,73,83,84,82,89,95,75,69,89,218,65,83,111,
+    102,116,119,97,114,101,92,80,121,116,104,111,110,92,80,121,
+    116,104,111,110,67,111,114,101,92,123,115,121,115,95,118,101,
+    114,115,105,111,110,125,92,77,111,100,117,108,101,115,92,123,
+    102,117,108,108,110,97,109,101,125,92,68,101,98,117,103,218,
+    18,82,69,71,73,83,84,82,89,95,75,69,89,95,68,69,
+    66,85,71,70,218,11,68,69,66,85,71,95,66,85,73,76,
+    68,218,11,99,108,97,115,115,109,101,116,104,111,100,99,72,
+    0,0,0,2,0,0,0,3,0,0,0,2,0,0,0,2,
+    0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,11,
+    0,0,0,7,0,0,0,8,0,0,0,0,0,0,0,0,
+    0,0,0,1,0,0,0,0,0,0,0,78,218,36,87,105,
+    110,100,111,119,115,82,101,103,105,115,116,114,121,70,105,110,
+    100,101,114,46,95,111,112,101,110,95,114,101,103,105,115,116,
+    114,121,114,20,0,0,0,218,7,79,112,101,110,75,101,121,
+    218,17,72,75,69,89,95,67,85,82,82,69,78,84,95,85,
+    83,69,82,114,105,0,0,0,218,18,72,75,69,89,95,76,
+    79,67,65,76,95,77,65,67,72,73,78,69,2,0,0,0,
+    30,0,0,0,69,0,0,0,2,0,0,0,15,3,0,0,
+    41,2,218,3,99,108,115,114,59,0,0,0,114,31,0,0,
+    0,114,31,0,0,0,114,32,0,0,0,218,14,95,111,112,
+    101,110,95,114,101,103,105,115,116,114,121,115,8,0,0,0,
+    2,0,0,3,28,1,7,1,6,11,53,2,254,54,5,3,
+    253,53,2,254,57,7,52,7,4,252,2,7,57,7,4,8,
+    1,73,6,3,0,76,53,5,250,83,2,34,0,53,2,254,
+    54,7,3,249,53,2,254,57,9,52,9,6,248,2,9,57,
+    9,4,10,1,73,8,3,0,97,2,76,99,2,51,0,76,
+    114,95,1,0,0,99,131,0,0,0,2,0,0,0,3,0,
+    0,0,2,0,0,0,6,0,0,0,0,0,0,0,0,0,
+    0,0,2,0,0,0,15,0,0,0,16,0,0,0,13,0,
+    0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,
+    0,0,78,218,38,87,105,110,100,111,119,115,82,101,103,105,
+    115,116,114,121,70,105,110,100,101,114,46,95,115,101,97,114,
+    99,104,95,114,101,103,105,115,116,114,121,114,88,1,0,0,
+    114,87,1,0,0,114,85,1,0,0,114,125,0,0,0,218,
+    5,37,100,46,37,100,114,8,0,0,0,218,12,118,101,114,
+    115,105,111,110,95,105,110,102,111,186,78,114,76,0,0,0,
+    78,169,2,114,255,0,0,0,218,11,115,121,115,95,118,101,
+    114,115,105,111,110,114,95,1,0,0,114,20,0,0,0,218,
+    10,81,117,101,114,121,86,97,108,117,101,114,36,0,0,0,
+    114,105,0,0,0,87,0,0,0,109,0,0,0,111,0,0,
+    0,8,0,0,0,72,0,0,0,114,0,0,0,128,0,0,
+    0,6,0,0,0,22,3,0,0,41,6,114,94,1,0,0,
+    114,255,0,0,0,218,12,114,101,103,105,115,116,114,121,95,
+    107,101,121,114,59,0,0,0,218,4,104,107,101,121,218,8,
+    102,105,108,101,112,97,116,104,114,31,0,0,0,114,31,0,
+    0,0,114,32,0,0,0,218,16,95,115,101,97,114,99,104,
+    95,114,101,103,105,115,116,114,121,115,24,0,0,0,2,0,
+    0,2,7,1,9,2,6,1,9,1,27,255,12,3,17,1,
+    25,1,7,1,7,1,6,15,52,0,2,255,84,12,0,52,
+    0,3,254,57,2,80,9,0,52,0,4,253,57,2,52,2,
+    5,252,57,12,4,6,1,122,6,57,13,53,7,250,57,14,
+    52,14,8,249,2,14,121,14,51,9,25,14,2,14,22,13,
+    2,13,121,7,122,10,57,8,71,13,0,2,120,3,49,0,
+    54,9,11,248,4,11,3,73,10,2,0,108,6,57,4,53,
+    12,246,54,11,13,245,4,13,4,122,14,57,14,73,12,3,
+    0,57,5,109,6,80,17,0,53,15,243,83,6,9,0,51,
+    0,97,6,76,99,6,49,5,76,114,106,1,0,0,78,99,
+    164,0,0,0,4,0,0,0,3,0,0,0,4,0,0,0,
+    8,0,0,0,2,0,0,0,0,0,0,0,4,0,0,0,
+    22,0,0,0,11,0,0,0,13,0,0,0,0,0,0,0,
+    2,0,0,0,1,0,0,0,0,0,0,0,78,218,31,87,
+    105,110,100,111,119,115,82,101,103,105,115,116,114,121,70,105,
+    110,100,101,114,46,102,105,110,100,95,115,112,101,99,114,106,
+    1,0,0,114,101,0,0,0,114,105,0,0,0,114,74,1,
+    0,0,114,81,0,0,0,114,34,0,0,0,114,235,0,0,
+    0,218,16,115,112,101,99,95,102,114,111,109,95,108,111,97,
+    100,101,114,114,71,1,0,0,12,0,0,0,2,0,0,0,
+    13,0,0,0,3,0,0,0,27,0,0,0,43,0,0,0,
+    57,0,0,0,8,0,0,0,37,3,0,0,41,8,114,94,
+    1,0,0,114,255,0,0,0,114,90,0,0,0,218,6,116,
+    97,114,103,101,116,114,105,1,0,0,114,0,1,0,0,114,
+    80,1,0,0,114,78,1,0,0,114,31,0,0,0,114,31,
+    0,0,0,114,32,0,0,0,218,9,102,105,110,100,95,115,
+    112,101,99,115,28,0,0,0,2,0,0,2,15,1,7,1,
+    3,2,16,1,7,1,7,1,24,1,27,1,16,1,13,255,
+    15,3,5,251,6,22,49,0,54,11,2,255,4,13,1,73,
+    12,2,0,121,4,51,0,33,4,84,6,0,51,0,76,53,
+    3,253,57,11,4,12,4,71,12,1,0,1,80,17,0,53,
+    4,251,83,8,9,0,51,0,97,8,76,99,8,53,5,249,
+    57,11,71,12,0,0,86,8,80,89,0,106,9,2,0,5,
+    5,10,5,6,9,49,4,54,12,6,248,53,7,246,57,17,
+    4,18,6,71,18,1,0,57,14,73,13,2,0,84,52,0,
+    53,8,244,57,9,52,9,9,243,2,9,57,14,4,15,1,
+    4,19,5,4,20,1,4,21,4,71,20,2,0,57,16,4,
+    9,4,122,10,57,10,71,15,2,1,120,7,49,7,2,8,
+    76,88,8,170,255,51,0,76,114,110,1,0,0,99,36,0,
+    0,0,3,0,0,0,3,0,0,0,3,0,0,0,4,0,
+    0,0,1,0,0,0,0,0,0,0,3,0,0,0,11,0,
+    0,0,5,0,0,0,2,0,0,0,0,0,0,0,1,0,
+    0,0,0,0,0,0,0,0,0,0,218,108,70,105,110,100,
+    32,109,111,100,117,108,101,32,110,97,109,101,100,32,105,110,
+    32,116,104,101,32,114,101,103,105,115,116,114,121,46,10,10,
+    32,32,32,32,32,32,32,32,84,104,105,115,32,109,101,116,
+    104,111,100,32,105,115,32,100,101,112,114,101,99,97,116,101,
+    100,46,32,32,85,115,101,32,101,120,101,99,95,109,111,100,
+    117,108,101,40,41,32,105,110,115,116,101,97,100,46,10,10,
+    32,32,32,32,32,32,32,32,218,33,87,105,110,100,111,119,
+    115,82,101,103,105,115,116,114,121,70,105,110,100,101,114,46,
+    102,105,110,100,95,109,111,100,117,108,101,114,110,1,0,0,
+    78,114,0,1,0,0,12,0,0,0,2,0,0,0,53,3,
+    0,0,41,4,114,94,1,0,0,114,255,0,0,0,114,90,
+    0,0,0,114,78,1,0,0,114,31,0,0,0,114,31,0,
+    0,0,114,32,0,0,0,218,11,102,105,110,100,95,109,111,
+    100,117,108,101,115,10,0,0,0,2,0,0,7,18,1,8,
+    1,5,2,6,11,49,0,54,7,2,255,4,9,1,4,10,
+    2,73,8,3,0,121,3,51,3,33,3,17,84,8,0,52,
+    3,4,254,76,51,3,76,114,113,1,0,0,3,3,0,0,
+    41,8,218,8,60,108,111,99,97,108,115,62,114,85,1,0,
+    0,114,87,1,0,0,114,88,1,0,0,114,95,1,0,0,
+    114,106,1,0,0,114,110,1,0,0,114,113,1,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,32,0,0,0,114,82,
+    1,0,0,115,32,0,0,0,2,0,9,2,2,254,2,5,
+    2,255,2,4,2,255,2,3,4,2,5,1,10,6,5,1,
+    10,14,5,1,22,15,5,1,6,14,50,0,254,58,1,51,
+    2,58,3,51,4,58,5,51,6,58,7,51,8,58,9,51,
+    10,58,11,50,12,252,57,11,107,13,57,12,71,12,1,0,
+    58,14,50,12,252,57,11,107,15,57,12,71,12,1,0,58,
+    16,50,12,252,121,11,122,17,121,12,122,17,57,13,107,18,
+    2,13,2,12,57,12,71,12,1,0,58,19,50,12,252,121,
+    11,122,17,57,12,107,20,2,12,57,12,71,12,1,0,58,
+    21,51,17,76,114,82,1,0,0,99,34,0,0,0,0,0,
+    128,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,5,0,0,0,15,0,
+    0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,114,241,0,0,0,114,240,0,0,0,
+    218,13,95,76,111,97,100,101,114,66,97,115,105,99,115,114,
+    242,0,0,0,218,83,66,97,115,101,32,99,108,97,115,115,
+    32,111,102,32,99,111,109,109,111,110,32,99,111,100,101,32,
+    110,101,101,100,101,100,32,98,121,32,98,111,116,104,32,83,
+    111,117,114,99,101,76,111,97,100,101,114,32,97,110,100,10,
+    32,32,32,32,83,111,117,114,99,101,108,101,115,115,70,105,
+    108,101,76,111,97,100,101,114,46,114,1,0,0,0,99,103,
+    0,0,0,2,0,0,0,3,0,0,0,2,0,0,0,5,
+    0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,15,
+    0,0,0,11,0,0,0,5,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,218,141,67,111,110,
+    99,114,101,116,101,32,105,109,112,108,101,109,101,110,116,97,
+    116,105,111,110,32,111,102,32,73,110,115,112,101,99,116,76,
+    111,97,100,101,114,46,105,115,95,112,97,99,107,97,103,101,
+    32,98,121,32,99,104,101,99,107,105,110,103,32,105,102,10,
+    32,32,32,32,32,32,32,32,116,104,101,32,112,97,116,104,
+    32,114,101,116,117,114,110,101,100,32,98,121,32,103,101,116,
+    95,102,105,108,101,110,97,109,101,32,104,97,115,32,97,32,
+    102,105,108,101,110,97,109,101,32,111,102,32,39,95,95,105,
+    110,105,116,95,95,46,112,121,39,46,218,24,95,76,111,97,
+    100,101,114,66,97,115,105,99,115,46,105,115,95,112,97,99,
+    107,97,103,101,114,95,0,0,0,114,69,1,0,0,114,29,
+    0,0,0,114,194,0,0,0,114,165,0,0,0,114,4,0,
+    0,0,114,164,0,0,0,114,76,0,0,0,218,8,95,95,
+    105,110,105,116,95,95,72,3,0,0,41,5,114,230,0,0,
+    0,114,255,0,0,0,114,187,0,0,0,218,13,102,105,108,
+    101,110,97,109,101,95,98,97,115,101,218,9,116,97,105,108,
+    95,110,97,109,101,114,31,0,0,0,114,31,0,0,0,114,
+    32,0,0,0,114,75,1,0,0,115,10,0,0,0,2,0,
+    0,3,34,1,28,1,24,1,6,15,53,2,254,120,8,49,
+    0,54,12,3,253,4,14,1,73,13,2,0,57,9,71,9,
+    1,0,121,5,51,4,25,5,2,5,120,2,49,2,54,8,
+    5,252,122,6,121,10,122,4,57,11,73,9,3,0,121,5,
+    51,7,25,5,2,5,120,3,49,1,54,8,8,251,122,6,
+    57,10,73,9,2,0,121,5,51,9,25,5,2,5,121,4,
+    51,10,35,2,3,81,9,0,1,51,10,35,3,4,76,114,
+    75,1,0,0,99,5,0,0,0,2,0,0,0,3,0,0,
+    0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,
+    0,2,0,0,0,2,0,0,0,3,0,0,0,0,0,0,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,193,243,1,0,0,86,97,108,105,100,97,116,101,
-    32,97,32,104,97,115,104,45,98,97,115,101,100,32,112,121,
-    99,32,98,121,32,99,104,101,99,107,105,110,103,32,116,104,
-    101,32,114,101,97,108,32,115,111,117,114,99,101,32,104,97,
-    115,104,32,97,103,97,105,110,115,116,32,116,104,101,32,111,
-    110,101,32,105,110,10,32,32,32,32,116,104,101,32,112,121,
-    99,32,104,101,97,100,101,114,46,10,10,32,32,32,32,42,
-    100,97,116,97,42,32,105,115,32,116,104,101,32,99,111,110,
-    116,101,110,116,115,32,111,102,32,116,104,101,32,112,121,99,
-    32,102,105,108,101,46,32,40,79,110,108,121,32,116,104,101,
-    32,102,105,114,115,116,32,49,54,32,98,121,116,101,115,32,
-    97,114,101,10,32,32,32,32,114,101,113,117,105,114,101,100,
-    46,41,10,10,32,32,32,32,42,115,111,117,114,99,101,95,
-    104,97,115,104,42,32,105,115,32,116,104,101,32,105,109,112,
-    111,114,116,108,105,98,46,117,116,105,108,46,115,111,117,114,
-    99,101,95,104,97,115,104,40,41,32,111,102,32,116,104,101,
-    32,115,111,117,114,99,101,32,102,105,108,101,46,10,10,32,
-    32,32,32,42,110,97,109,101,42,32,105,115,32,116,104,101,
-    32,110,97,109,101,32,111,102,32,116,104,101,32,109,111,100,
-    117,108,101,32,98,101,105,110,103,32,105,109,112,111,114,116,
-    101,100,46,32,73,116,32,105,115,32,117,115,101,100,32,102,
-    111,114,32,108,111,103,103,105,110,103,46,10,10,32,32,32,
-    32,42,101,120,99,95,100,101,116,97,105,108,115,42,32,105,
-    115,32,97,32,100,105,99,116,105,111,110,97,114,121,32,112,
-    97,115,115,101,100,32,116,111,32,73,109,112,111,114,116,69,
-    114,114,111,114,32,105,102,32,105,116,32,114,97,105,115,101,
-    100,32,102,111,114,10,32,32,32,32,105,109,112,114,111,118,
-    101,100,32,100,101,98,117,103,103,105,110,103,46,10,10,32,
-    32,32,32,65,110,32,73,109,112,111,114,116,69,114,114,111,
-    114,32,105,115,32,114,97,105,115,101,100,32,105,102,32,116,
-    104,101,32,98,121,116,101,99,111,100,101,32,105,115,32,115,
-    116,97,108,101,46,10,10,32,32,32,32,218,18,95,118,97,
-    108,105,100,97,116,101,95,104,97,115,104,95,112,121,99,186,
-    114,13,1,0,0,114,9,1,0,0,78,114,226,0,0,0,
-    218,46,104,97,115,104,32,105,110,32,98,121,116,101,99,111,
-    100,101,32,100,111,101,115,110,39,116,32,109,97,116,99,104,
-    32,104,97,115,104,32,111,102,32,115,111,117,114,99,101,32,
-    78,110,2,0,0,41,4,114,73,0,0,0,218,11,115,111,
-    117,114,99,101,95,104,97,115,104,114,225,0,0,0,114,17,
-    1,0,0,114,31,0,0,0,114,31,0,0,0,114,32,0,
-    0,0,114,28,1,0,0,115,10,0,0,0,2,0,0,17,
-    16,1,5,1,16,255,6,12,51,2,25,0,57,4,49,1,
-    35,3,4,2,4,84,37,0,53,3,254,57,9,51,4,57,
-    10,49,2,74,2,74,4,57,11,75,6,10,2,57,10,93,
-    10,1,57,4,4,5,3,72,10,77,51,5,76,114,28,1,
-    0,0,99,121,0,0,0,4,0,0,0,3,0,0,0,4,
-    0,0,0,5,0,0,0,3,0,0,0,0,0,0,0,4,
-    0,0,0,18,0,0,0,16,0,0,0,16,0,0,0,0,
-    0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,218,
-    35,67,111,109,112,105,108,101,32,98,121,116,101,99,111,100,
-    101,32,97,115,32,102,111,117,110,100,32,105,110,32,97,32,
-    112,121,99,46,218,17,95,99,111,109,112,105,108,101,95,98,
-    121,116,101,99,111,100,101,114,12,0,0,0,218,5,108,111,
-    97,100,115,218,10,105,115,105,110,115,116,97,110,99,101,114,
-    140,0,0,0,114,234,0,0,0,114,7,1,0,0,218,21,
-    99,111,100,101,32,111,98,106,101,99,116,32,102,114,111,109,
-    32,123,33,114,125,78,114,3,0,0,0,218,16,95,102,105,
-    120,95,99,111,95,102,105,108,101,110,97,109,101,114,226,0,
-    0,0,218,23,78,111,110,45,99,111,100,101,32,111,98,106,
-    101,99,116,32,105,110,32,123,33,114,125,114,125,0,0,0,
-    169,2,114,225,0,0,0,114,90,0,0,0,1,0,0,0,
-    1,0,0,0,2,0,0,0,2,0,0,0,3,0,0,0,
-    3,0,0,0,134,2,0,0,41,5,114,73,0,0,0,114,
-    225,0,0,0,114,214,0,0,0,114,217,0,0,0,218,4,
-    99,111,100,101,114,31,0,0,0,114,31,0,0,0,114,32,
-    0,0,0,114,33,1,0,0,115,16,0,0,0,2,0,0,
-    2,16,1,20,1,19,1,8,1,18,1,3,2,6,18,53,
-    2,254,54,8,3,253,4,10,0,73,9,2,0,57,4,53,
-    4,251,57,8,4,9,4,53,5,249,57,10,71,9,2,0,
-    84,51,0,53,6,247,54,8,7,246,51,8,57,10,4,11,
-    2,73,9,3,0,1,51,9,33,3,17,84,21,0,53,10,
-    244,54,8,11,243,4,10,4,4,11,3,73,9,3,0,1,
-    49,4,76,53,12,241,57,11,51,13,54,15,14,240,4,17,
-    2,73,16,2,0,57,12,4,5,1,4,6,2,51,15,57,
-    7,71,12,1,2,77,114,33,1,0,0,99,124,0,0,0,
-    3,0,0,0,3,0,0,0,3,0,0,0,4,0,0,0,
-    2,0,0,0,0,0,0,0,3,0,0,0,15,0,0,0,
-    9,0,0,0,13,0,0,0,0,0,0,0,2,0,0,0,
-    0,0,0,0,0,0,0,0,218,43,80,114,111,100,117,99,
-    101,32,116,104,101,32,100,97,116,97,32,102,111,114,32,97,
-    32,116,105,109,101,115,116,97,109,112,45,98,97,115,101,100,
-    32,112,121,99,46,218,22,95,99,111,100,101,95,116,111,95,
-    116,105,109,101,115,116,97,109,112,95,112,121,99,218,9,98,
-    121,116,101,97,114,114,97,121,114,143,0,0,0,218,6,101,
-    120,116,101,110,100,114,63,0,0,0,114,4,0,0,0,114,
-    12,0,0,0,218,5,100,117,109,112,115,1,0,0,0,1,
-    0,0,0,2,0,0,0,2,0,0,0,147,2,0,0,41,
-    4,114,40,1,0,0,218,5,109,116,105,109,101,114,26,1,
-    0,0,114,73,0,0,0,114,31,0,0,0,114,31,0,0,
-    0,114,32,0,0,0,114,42,1,0,0,115,14,0,0,0,
-    2,0,0,2,16,1,26,1,25,1,25,1,27,1,6,15,
-    53,2,254,57,7,53,3,252,57,8,71,8,1,0,57,3,
-    49,3,54,7,4,251,53,5,249,57,12,51,6,57,13,71,
-    13,1,0,57,9,73,8,2,0,1,49,3,54,7,4,248,
-    53,5,249,57,12,4,13,1,71,13,1,0,57,9,73,8,
-    2,0,1,49,3,54,7,4,247,53,5,249,57,12,4,13,
-    2,71,13,1,0,57,9,73,8,2,0,1,49,3,54,7,
-    4,246,53,7,244,54,12,8,243,4,14,0,73,13,2,0,
-    57,9,73,8,2,0,1,49,3,76,114,42,1,0,0,84,
-    99,127,0,0,0,3,0,0,0,3,0,0,0,3,0,0,
-    0,5,0,0,0,1,0,0,0,0,0,0,0,3,0,0,
-    0,16,0,0,0,11,0,0,0,14,0,0,0,0,0,0,
-    0,1,0,0,0,0,0,0,0,0,0,0,0,218,38,80,
-    114,111,100,117,99,101,32,116,104,101,32,100,97,116,97,32,
-    102,111,114,32,97,32,104,97,115,104,45,98,97,115,101,100,
-    32,112,121,99,46,218,17,95,99,111,100,101,95,116,111,95,
-    104,97,115,104,95,112,121,99,114,43,1,0,0,114,143,0,
-    0,0,114,29,0,0,0,114,44,1,0,0,114,63,0,0,
-    0,114,28,0,0,0,114,13,1,0,0,114,12,0,0,0,
-    114,45,1,0,0,1,0,0,0,2,0,0,0,157,2,0,
-    0,41,5,114,40,1,0,0,114,31,1,0,0,218,7,99,
-    104,101,99,107,101,100,114,73,0,0,0,114,56,0,0,0,
-    114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,114,
-    48,1,0,0,115,16,0,0,0,2,0,0,2,16,1,14,
-    1,25,1,26,1,14,1,27,1,6,16,53,2,254,57,8,
-    53,3,252,57,9,71,9,1,0,57,3,51,4,57,5,51,
-    4,28,2,32,5,2,5,57,4,49,3,54,8,5,251,53,
-    6,249,57,13,4,14,4,71,14,1,0,57,10,73,9,2,
-    0,1,53,7,247,57,8,4,9,1,71,9,1,0,57,5,
-    51,8,35,2,5,2,5,85,5,0,74,8,49,3,54,8,
-    5,246,4,10,1,73,9,2,0,1,49,3,54,8,5,245,
-    53,9,243,54,13,10,242,4,15,0,73,14,2,0,57,10,
-    73,9,2,0,1,49,3,76,114,48,1,0,0,99,95,0,
-    0,0,1,0,0,0,3,0,0,0,1,0,0,0,5,0,
-    0,0,0,0,0,0,0,0,0,0,1,0,0,0,16,0,
-    0,0,12,0,0,0,8,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,218,121,68,101,99,111,
-    100,101,32,98,121,116,101,115,32,114,101,112,114,101,115,101,
-    110,116,105,110,103,32,115,111,117,114,99,101,32,99,111,100,
-    101,32,97,110,100,32,114,101,116,117,114,110,32,116,104,101,
-    32,115,116,114,105,110,103,46,10,10,32,32,32,32,85,110,
-    105,118,101,114,115,97,108,32,110,101,119,108,105,110,101,32,
-    115,117,112,112,111,114,116,32,105,115,32,117,115,101,100,32,
-    105,110,32,116,104,101,32,100,101,99,111,100,105,110,103,46,
-    10,32,32,32,32,218,13,100,101,99,111,100,101,95,115,111,
-    117,114,99,101,169,3,218,8,116,111,107,101,110,105,122,101,
-    78,114,4,0,0,0,114,6,0,0,0,218,7,66,121,116,
-    101,115,73,79,218,8,114,101,97,100,108,105,110,101,218,15,
-    100,101,116,101,99,116,95,101,110,99,111,100,105,110,103,218,
-    25,73,110,99,114,101,109,101,110,116,97,108,78,101,119,108,
-    105,110,101,68,101,99,111,100,101,114,78,84,218,6,100,101,
-    99,111,100,101,114,4,0,0,0,168,2,0,0,41,5,218,
-    12,115,111,117,114,99,101,95,98,121,116,101,115,114,53,1,
-    0,0,218,21,115,111,117,114,99,101,95,98,121,116,101,115,
-    95,114,101,97,100,108,105,110,101,218,8,101,110,99,111,100,
-    105,110,103,218,15,110,101,119,108,105,110,101,95,100,101,99,
-    111,100,101,114,114,31,0,0,0,114,31,0,0,0,114,32,
-    0,0,0,114,51,1,0,0,115,12,0,0,0,2,0,0,
-    5,4,1,24,1,15,1,21,1,6,16,89,2,57,1,53,
-    3,254,54,8,4,253,4,10,0,73,9,2,0,57,5,52,
-    5,5,252,2,5,57,2,49,1,54,8,6,251,4,10,2,
-    73,9,2,0,57,3,53,3,254,54,8,7,250,51,8,57,
-    10,51,9,57,11,73,9,3,0,57,4,49,4,54,8,10,
-    249,49,0,54,13,10,248,51,11,25,3,57,15,73,14,2,
-    0,57,10,73,9,2,0,76,114,51,1,0,0,218,6,111,
-    98,106,101,99,116,218,9,95,80,79,80,85,76,65,84,69,
-    99,95,1,0,0,2,0,32,0,3,0,0,0,2,0,0,
-    0,9,0,0,0,3,0,0,0,0,0,0,0,4,0,0,
-    0,20,0,0,0,24,0,0,0,24,0,0,0,0,0,0,
-    0,3,0,0,0,2,0,0,0,0,0,0,0,193,61,1,
-    0,0,82,101,116,117,114,110,32,97,32,109,111,100,117,108,
-    101,32,115,112,101,99,32,98,97,115,101,100,32,111,110,32,
-    97,32,102,105,108,101,32,108,111,99,97,116,105,111,110,46,
-    10,10,32,32,32,32,84,111,32,105,110,100,105,99,97,116,
-    101,32,116,104,97,116,32,116,104,101,32,109,111,100,117,108,
-    101,32,105,115,32,97,32,112,97,99,107,97,103,101,44,32,
-    115,101,116,10,32,32,32,32,115,117,98,109,111,100,117,108,
-    101,95,115,101,97,114,99,104,95,108,111,99,97,116,105,111,
-    110,115,32,116,111,32,97,32,108,105,115,116,32,111,102,32,
-    100,105,114,101,99,116,111,114,121,32,112,97,116,104,115,46,
-    32,32,65,110,10,32,32,32,32,101,109,112,116,121,32,108,
-    105,115,116,32,105,115,32,115,117,102,102,105,99,105,101,110,
-    116,44,32,116,104,111,117,103,104,32,105,116,115,32,110,111,
-    116,32,111,116,104,101,114,119,105,115,101,32,117,115,101,102,
-    117,108,32,116,111,32,116,104,101,10,32,32,32,32,105,109,
-    112,111,114,116,32,115,121,115,116,101,109,46,10,10,32,32,
-    32,32,84,104,101,32,108,111,97,100,101,114,32,109,117,115,
-    116,32,116,97,107,101,32,97,32,115,112,101,99,32,97,115,
-    32,105,116,115,32,111,110,108,121,32,95,95,105,110,105,116,
-    95,95,40,41,32,97,114,103,46,10,10,32,32,32,32,218,
-    23,115,112,101,99,95,102,114,111,109,95,102,105,108,101,95,
-    108,111,99,97,116,105,111,110,78,218,9,60,117,110,107,110,
-    111,119,110,62,114,242,0,0,0,218,12,103,101,116,95,102,
-    105,108,101,110,97,109,101,114,226,0,0,0,114,18,0,0,
-    0,114,162,0,0,0,114,234,0,0,0,218,10,77,111,100,
-    117,108,101,83,112,101,99,169,1,218,6,111,114,105,103,105,
-    110,84,218,13,95,115,101,116,95,102,105,108,101,97,116,116,
-    114,218,27,95,103,101,116,95,115,117,112,112,111,114,116,101,
-    100,95,102,105,108,101,95,108,111,97,100,101,114,115,114,81,
-    0,0,0,114,34,0,0,0,114,255,0,0,0,114,64,1,
-    0,0,218,10,105,115,95,112,97,99,107,97,103,101,218,26,
-    115,117,98,109,111,100,117,108,101,95,115,101,97,114,99,104,
-    95,108,111,99,97,116,105,111,110,115,114,95,0,0,0,114,
-    4,0,0,0,114,84,0,0,0,1,0,0,0,1,0,0,
-    0,2,0,0,0,2,0,0,0,3,0,0,0,3,0,0,
-    0,32,0,0,0,50,0,0,0,64,0,0,0,9,0,0,
-    0,237,0,0,0,255,0,0,0,13,1,0,0,9,0,0,
-    0,185,2,0,0,41,9,114,225,0,0,0,218,8,108,111,
-    99,97,116,105,111,110,114,255,0,0,0,114,75,1,0,0,
-    218,4,115,112,101,99,218,12,108,111,97,100,101,114,95,99,
-    108,97,115,115,218,8,115,117,102,102,105,120,101,115,114,74,
-    1,0,0,218,7,100,105,114,110,97,109,101,114,31,0,0,
-    0,114,31,0,0,0,114,32,0,0,0,114,66,1,0,0,
-    115,62,0,0,0,2,0,0,12,7,4,4,1,19,3,18,
-    1,7,1,10,2,16,8,32,1,5,3,7,1,24,1,27,
-    1,15,1,5,1,5,252,4,6,3,3,8,2,19,2,18,
-    1,7,1,7,2,5,1,9,2,5,1,17,1,5,1,22,
-    1,16,2,6,20,51,2,33,1,84,61,0,51,3,57,1,
-    53,4,254,57,12,4,13,2,51,5,57,14,71,13,2,0,
-    84,35,0,49,2,54,12,5,253,4,14,0,73,13,2,0,
-    57,1,80,17,0,53,6,251,83,9,9,0,97,9,80,5,
-    0,99,9,80,19,0,53,7,249,54,12,8,248,4,14,1,
-    73,13,2,0,57,1,53,9,246,57,9,52,9,10,245,2,
-    9,57,14,4,15,0,4,16,2,4,9,1,51,11,57,10,
-    71,15,2,1,57,4,51,12,59,4,13,51,2,33,2,84,
-    86,0,53,14,243,57,12,71,13,0,0,86,9,80,65,0,
-    106,10,2,0,5,5,11,5,6,10,49,1,54,13,15,242,
-    53,16,240,57,18,4,19,6,71,19,1,0,57,15,73,14,
-    2,0,84,28,0,4,13,5,4,14,0,4,15,1,71,14,
-    2,0,57,2,49,2,59,4,17,2,9,80,10,0,88,9,
-    194,255,51,2,76,53,18,238,33,3,84,68,0,53,4,254,
-    57,12,4,13,2,51,19,57,14,71,13,2,0,84,46,0,
-    49,2,54,12,19,237,4,14,0,73,13,2,0,57,7,80,
-    17,0,53,6,251,83,9,9,0,97,9,80,16,0,99,9,
-    49,7,84,9,0,94,9,0,59,4,20,80,8,0,49,3,
-    59,4,20,52,4,20,236,57,9,94,10,0,35,2,9,2,
-    9,84,46,0,49,1,84,41,0,53,21,234,57,12,4,13,
-    1,71,13,1,0,57,9,51,22,25,9,2,9,57,8,52,
-    4,20,233,54,12,23,232,4,14,8,73,13,2,0,1,49,
-    4,76,114,66,1,0,0,99,108,0,0,0,0,0,128,0,
-    0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,14,0,0,0,22,0,0,0,
-    4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,114,240,0,0,0,114,239,0,0,0,218,21,
-    87,105,110,100,111,119,115,82,101,103,105,115,116,114,121,70,
-    105,110,100,101,114,114,241,0,0,0,218,62,77,101,116,97,
-    32,112,97,116,104,32,102,105,110,100,101,114,32,102,111,114,
-    32,109,111,100,117,108,101,115,32,100,101,99,108,97,114,101,
-    100,32,105,110,32,116,104,101,32,87,105,110,100,111,119,115,
-    32,114,101,103,105,115,116,114,121,46,114,1,0,0,0,218,
-    59,83,111,102,116,119,97,114,101,92,80,121,116,104,111,110,
-    92,80,121,116,104,111,110,67,111,114,101,92,123,115,121,115,
-    95,118,101,114,115,105,111,110,125,92,77,111,100,117,108,101,
-    115,92,123,102,117,108,108,110,97,109,101,125,218,12,82,69,
-    71,73,83,84,82,89,95,75,69,89,218,65,83,111,102,116,
-    119,97,114,101,92,80,121,116,104,111,110,92,80,121,116,104,
-    111,110,67,111,114,101,92,123,115,121,115,95,118,101,114,115,
-    105,111,110,125,92,77,111,100,117,108,101,115,92,123,102,117,
-    108,108,110,97,109,101,125,92,68,101,98,117,103,218,18,82,
-    69,71,73,83,84,82,89,95,75,69,89,95,68,69,66,85,
-    71,70,218,11,68,69,66,85,71,95,66,85,73,76,68,218,
-    11,99,108,97,115,115,109,101,116,104,111,100,99,72,0,0,
-    0,2,0,0,0,3,0,0,0,2,0,0,0,2,0,0,
-    0,0,0,0,0,0,0,0,0,2,0,0,0,11,0,0,
-    0,7,0,0,0,8,0,0,0,0,0,0,0,0,0,0,
-    0,1,0,0,0,0,0,0,0,78,218,36,87,105,110,100,
-    111,119,115,82,101,103,105,115,116,114,121,70,105,110,100,101,
-    114,46,95,111,112,101,110,95,114,101,103,105,115,116,114,121,
-    114,20,0,0,0,218,7,79,112,101,110,75,101,121,218,17,
-    72,75,69,89,95,67,85,82,82,69,78,84,95,85,83,69,
-    82,114,105,0,0,0,218,18,72,75,69,89,95,76,79,67,
-    65,76,95,77,65,67,72,73,78,69,2,0,0,0,30,0,
-    0,0,69,0,0,0,2,0,0,0,9,3,0,0,41,2,
-    218,3,99,108,115,114,59,0,0,0,114,31,0,0,0,114,
-    31,0,0,0,114,32,0,0,0,218,14,95,111,112,101,110,
-    95,114,101,103,105,115,116,114,121,115,8,0,0,0,2,0,
-    0,3,28,1,7,1,6,11,53,2,254,54,5,3,253,53,
-    2,254,57,7,52,7,4,252,2,7,57,7,4,8,1,73,
-    6,3,0,76,53,5,250,83,2,34,0,53,2,254,54,7,
-    3,249,53,2,254,57,9,52,9,6,248,2,9,57,9,4,
-    10,1,73,8,3,0,97,2,76,99,2,51,0,76,114,94,
-    1,0,0,99,131,0,0,0,2,0,0,0,3,0,0,0,
-    2,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,
-    2,0,0,0,15,0,0,0,16,0,0,0,13,0,0,0,
-    0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
-    78,218,38,87,105,110,100,111,119,115,82,101,103,105,115,116,
-    114,121,70,105,110,100,101,114,46,95,115,101,97,114,99,104,
-    95,114,101,103,105,115,116,114,121,114,87,1,0,0,114,86,
-    1,0,0,114,84,1,0,0,114,125,0,0,0,218,5,37,
-    100,46,37,100,114,8,0,0,0,218,12,118,101,114,115,105,
-    111,110,95,105,110,102,111,186,78,114,76,0,0,0,78,169,
-    2,114,254,0,0,0,218,11,115,121,115,95,118,101,114,115,
-    105,111,110,114,94,1,0,0,114,20,0,0,0,218,10,81,
-    117,101,114,121,86,97,108,117,101,114,36,0,0,0,114,105,
-    0,0,0,87,0,0,0,109,0,0,0,111,0,0,0,8,
-    0,0,0,72,0,0,0,114,0,0,0,128,0,0,0,6,
-    0,0,0,16,3,0,0,41,6,114,93,1,0,0,114,254,
-    0,0,0,218,12,114,101,103,105,115,116,114,121,95,107,101,
-    121,114,59,0,0,0,218,4,104,107,101,121,218,8,102,105,
-    108,101,112,97,116,104,114,31,0,0,0,114,31,0,0,0,
-    114,32,0,0,0,218,16,95,115,101,97,114,99,104,95,114,
-    101,103,105,115,116,114,121,115,24,0,0,0,2,0,0,2,
-    7,1,9,2,6,1,9,1,27,255,12,3,17,1,25,1,
-    7,1,7,1,6,15,52,0,2,255,84,12,0,52,0,3,
-    254,57,2,80,9,0,52,0,4,253,57,2,52,2,5,252,
-    57,12,4,6,1,51,6,57,13,53,7,250,57,14,52,14,
-    8,249,2,14,57,14,51,9,25,14,2,14,22,13,2,13,
-    57,7,51,10,57,8,71,13,0,2,57,3,49,0,54,9,
-    11,248,4,11,3,73,10,2,0,108,6,57,4,53,12,246,
-    54,11,13,245,4,13,4,51,14,57,14,73,12,3,0,57,
-    5,109,6,80,17,0,53,15,243,83,6,9,0,51,0,97,
-    6,76,99,6,49,5,76,114,105,1,0,0,78,99,164,0,
-    0,0,4,0,0,0,3,0,0,0,4,0,0,0,8,0,
-    0,0,2,0,0,0,0,0,0,0,4,0,0,0,22,0,
-    0,0,11,0,0,0,13,0,0,0,0,0,0,0,2,0,
-    0,0,1,0,0,0,0,0,0,0,78,218,31,87,105,110,
-    100,111,119,115,82,101,103,105,115,116,114,121,70,105,110,100,
-    101,114,46,102,105,110,100,95,115,112,101,99,114,105,1,0,
-    0,114,101,0,0,0,114,105,0,0,0,114,73,1,0,0,
-    114,81,0,0,0,114,34,0,0,0,114,234,0,0,0,218,
-    16,115,112,101,99,95,102,114,111,109,95,108,111,97,100,101,
-    114,114,70,1,0,0,12,0,0,0,2,0,0,0,13,0,
-    0,0,3,0,0,0,27,0,0,0,43,0,0,0,57,0,
-    0,0,8,0,0,0,31,3,0,0,41,8,114,93,1,0,
-    0,114,254,0,0,0,114,90,0,0,0,218,6,116,97,114,
-    103,101,116,114,104,1,0,0,114,255,0,0,0,114,79,1,
-    0,0,114,77,1,0,0,114,31,0,0,0,114,31,0,0,
-    0,114,32,0,0,0,218,9,102,105,110,100,95,115,112,101,
-    99,115,28,0,0,0,2,0,0,2,15,1,7,1,3,2,
-    16,1,7,1,7,1,24,1,27,1,16,1,13,255,15,3,
-    5,251,6,22,49,0,54,11,2,255,4,13,1,73,12,2,
-    0,57,4,51,0,33,4,84,6,0,51,0,76,53,3,253,
-    57,11,4,12,4,71,12,1,0,1,80,17,0,53,4,251,
-    83,8,9,0,51,0,97,8,76,99,8,53,5,249,57,11,
-    71,12,0,0,86,8,80,89,0,106,9,2,0,5,5,10,
-    5,6,9,49,4,54,12,6,248,53,7,246,57,17,4,18,
-    6,71,18,1,0,57,14,73,13,2,0,84,52,0,53,8,
-    244,57,9,52,9,9,243,2,9,57,14,4,15,1,4,19,
-    5,4,20,1,4,21,4,71,20,2,0,57,16,4,9,4,
-    51,10,57,10,71,15,2,1,57,7,49,7,2,8,76,88,
-    8,170,255,51,0,76,114,109,1,0,0,99,36,0,0,0,
-    3,0,0,0,3,0,0,0,3,0,0,0,4,0,0,0,
-    1,0,0,0,0,0,0,0,3,0,0,0,11,0,0,0,
-    5,0,0,0,2,0,0,0,0,0,0,0,1,0,0,0,
-    0,0,0,0,0,0,0,0,218,108,70,105,110,100,32,109,
-    111,100,117,108,101,32,110,97,109,101,100,32,105,110,32,116,
-    104,101,32,114,101,103,105,115,116,114,121,46,10,10,32,32,
-    32,32,32,32,32,32,84,104,105,115,32,109,101,116,104,111,
-    100,32,105,115,32,100,101,112,114,101,99,97,116,101,100,46,
-    32,32,85,115,101,32,101,120,101,99,95,109,111,100,117,108,
-    101,40,41,32,105,110,115,116,101,97,100,46,10,10,32,32,
-    32,32,32,32,32,32,218,33,87,105,110,100,111,119,115,82,
-    101,103,105,115,116,114,121,70,105,110,100,101,114,46,102,105,
-    110,100,95,109,111,100,117,108,101,114,109,1,0,0,78,114,
-    255,0,0,0,12,0,0,0,2,0,0,0,47,3,0,0,
-    41,4,114,93,1,0,0,114,254,0,0,0,114,90,0,0,
-    0,114,77,1,0,0,114,31,0,0,0,114,31,0,0,0,
-    114,32,0,0,0,218,11,102,105,110,100,95,109,111,100,117,
-    108,101,115,10,0,0,0,2,0,0,7,18,1,8,1,5,
-    2,6,11,49,0,54,7,2,255,4,9,1,4,10,2,73,
-    8,3,0,57,3,51,3,33,3,17,84,8,0,52,3,4,
-    254,76,51,3,76,114,112,1,0,0,253,2,0,0,41,8,
-    218,8,60,108,111,99,97,108,115,62,114,84,1,0,0,114,
-    86,1,0,0,114,87,1,0,0,114,94,1,0,0,114,105,
-    1,0,0,114,109,1,0,0,114,112,1,0,0,114,31,0,
-    0,0,114,31,0,0,0,114,32,0,0,0,114,81,1,0,
-    0,115,32,0,0,0,2,0,9,2,2,254,2,5,2,255,
-    2,4,2,255,2,3,4,2,5,1,10,6,5,1,10,14,
-    5,1,22,15,5,1,6,14,50,0,254,58,1,51,2,58,
-    3,51,4,58,5,51,6,58,7,51,8,58,9,51,10,58,
-    11,50,12,252,57,11,107,13,57,12,71,12,1,0,58,14,
-    50,12,252,57,11,107,15,57,12,71,12,1,0,58,16,50,
-    12,252,57,11,51,17,57,12,51,17,57,13,107,18,2,13,
-    2,12,57,12,71,12,1,0,58,19,50,12,252,57,11,51,
-    17,57,12,107,20,2,12,57,12,71,12,1,0,58,21,51,
-    17,76,114,81,1,0,0,99,34,0,0,0,0,0,128,0,
-    0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,5,0,0,0,15,0,0,0,
-    2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,114,240,0,0,0,114,239,0,0,0,218,13,
-    95,76,111,97,100,101,114,66,97,115,105,99,115,114,241,0,
-    0,0,218,83,66,97,115,101,32,99,108,97,115,115,32,111,
-    102,32,99,111,109,109,111,110,32,99,111,100,101,32,110,101,
-    101,100,101,100,32,98,121,32,98,111,116,104,32,83,111,117,
-    114,99,101,76,111,97,100,101,114,32,97,110,100,10,32,32,
-    32,32,83,111,117,114,99,101,108,101,115,115,70,105,108,101,
-    76,111,97,100,101,114,46,114,1,0,0,0,99,103,0,0,
-    0,2,0,0,0,3,0,0,0,2,0,0,0,5,0,0,
-    0,0,0,0,0,0,0,0,0,2,0,0,0,15,0,0,
-    0,11,0,0,0,5,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,218,141,67,111,110,99,114,
-    101,116,101,32,105,109,112,108,101,109,101,110,116,97,116,105,
-    111,110,32,111,102,32,73,110,115,112,101,99,116,76,111,97,
-    100,101,114,46,105,115,95,112,97,99,107,97,103,101,32,98,
-    121,32,99,104,101,99,107,105,110,103,32,105,102,10,32,32,
-    32,32,32,32,32,32,116,104,101,32,112,97,116,104,32,114,
-    101,116,117,114,110,101,100,32,98,121,32,103,101,116,95,102,
-    105,108,101,110,97,109,101,32,104,97,115,32,97,32,102,105,
-    108,101,110,97,109,101,32,111,102,32,39,95,95,105,110,105,
-    116,95,95,46,112,121,39,46,218,24,95,76,111,97,100,101,
-    114,66,97,115,105,99,115,46,105,115,95,112,97,99,107,97,
-    103,101,114,95,0,0,0,114,68,1,0,0,114,29,0,0,
-    0,114,193,0,0,0,114,164,0,0,0,114,4,0,0,0,
-    114,163,0,0,0,114,76,0,0,0,218,8,95,95,105,110,
-    105,116,95,95,66,3,0,0,41,5,114,229,0,0,0,114,
-    254,0,0,0,114,186,0,0,0,218,13,102,105,108,101,110,
-    97,109,101,95,98,97,115,101,218,9,116,97,105,108,95,110,
-    97,109,101,114,31,0,0,0,114,31,0,0,0,114,32,0,
-    0,0,114,74,1,0,0,115,10,0,0,0,2,0,0,3,
-    34,1,28,1,24,1,6,15,53,2,254,57,8,49,0,54,
-    12,3,253,4,14,1,73,13,2,0,57,9,71,9,1,0,
-    57,5,51,4,25,5,2,5,57,2,49,2,54,8,5,252,
-    51,6,57,10,51,4,57,11,73,9,3,0,57,5,51,7,
-    25,5,2,5,57,3,49,1,54,8,8,251,51,6,57,10,
-    73,9,2,0,57,5,51,9,25,5,2,5,57,4,51,10,
-    35,2,3,81,9,0,1,51,10,35,3,4,76,114,74,1,
-    0,0,99,5,0,0,0,2,0,0,0,3,0,0,0,2,
-    0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,2,
-    0,0,0,2,0,0,0,3,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,
-    42,85,115,101,32,100,101,102,97,117,108,116,32,115,101,109,
-    97,110,116,105,99,115,32,102,111,114,32,109,111,100,117,108,
-    101,32,99,114,101,97,116,105,111,110,46,218,27,95,76,111,
-    97,100,101,114,66,97,115,105,99,115,46,99,114,101,97,116,
-    101,95,109,111,100,117,108,101,78,74,3,0,0,41,2,114,
-    229,0,0,0,114,77,1,0,0,114,31,0,0,0,114,31,
-    0,0,0,114,32,0,0,0,218,13,99,114,101,97,116,101,
-    95,109,111,100,117,108,101,115,4,0,0,0,2,0,0,1,
-    6,2,51,2,76,114,123,1,0,0,99,84,0,0,0,2,
-    0,0,0,3,0,0,0,2,0,0,0,3,0,0,0,0,
-    0,0,0,0,0,0,0,2,0,0,0,13,0,0,0,12,
-    0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,218,19,69,120,101,99,117,116,101,
-    32,116,104,101,32,109,111,100,117,108,101,46,218,25,95,76,
-    111,97,100,101,114,66,97,115,105,99,115,46,101,120,101,99,
-    95,109,111,100,117,108,101,218,8,103,101,116,95,99,111,100,
-    101,114,240,0,0,0,78,114,226,0,0,0,218,52,99,97,
-    110,110,111,116,32,108,111,97,100,32,109,111,100,117,108,101,
-    32,123,33,114,125,32,119,104,101,110,32,103,101,116,95,99,
-    111,100,101,40,41,32,114,101,116,117,114,110,115,32,78,111,
-    110,101,114,125,0,0,0,114,234,0,0,0,218,25,95,99,
-    97,108,108,95,119,105,116,104,95,102,114,97,109,101,115,95,
-    114,101,109,111,118,101,100,218,4,101,120,101,99,114,245,0,
-    0,0,77,3,0,0,41,3,114,229,0,0,0,218,6,109,
-    111,100,117,108,101,114,40,1,0,0,114,31,0,0,0,114,
-    31,0,0,0,114,32,0,0,0,218,11,101,120,101,99,95,
-    109,111,100,117,108,101,115,14,0,0,0,2,0,0,2,18,
-    1,7,1,11,1,4,255,13,2,6,13,49,0,54,6,2,
-    255,52,1,3,254,57,8,73,7,2,0,57,2,51,4,33,
-    2,84,31,0,53,5,252,57,6,51,6,54,10,7,251,52,
-    1,3,250,57,12,73,11,2,0,57,7,71,7,1,0,77,
-    53,8,248,54,6,9,247,53,10,245,57,8,4,9,2,52,
-    1,11,244,57,10,73,7,4,0,1,51,4,76,114,131,1,
-    0,0,99,20,0,0,0,2,0,0,0,3,0,0,0,2,
-    0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,2,
-    0,0,0,9,0,0,0,4,0,0,0,3,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,
-    26,84,104,105,115,32,109,111,100,117,108,101,32,105,115,32,
-    100,101,112,114,101,99,97,116,101,100,46,218,25,95,76,111,
-    97,100,101,114,66,97,115,105,99,115,46,108,111,97,100,95,
-    109,111,100,117,108,101,114,234,0,0,0,218,17,95,108,111,
-    97,100,95,109,111,100,117,108,101,95,115,104,105,109,85,3,
-    0,0,41,2,114,229,0,0,0,114,254,0,0,0,114,31,
-    0,0,0,114,31,0,0,0,114,32,0,0,0,218,11,108,
-    111,97,100,95,109,111,100,117,108,101,115,4,0,0,0,2,
-    0,0,2,6,9,53,2,254,54,5,3,253,4,7,0,4,
-    8,1,73,6,3,0,76,114,135,1,0,0,78,61,3,0,
-    0,41,5,114,113,1,0,0,114,74,1,0,0,114,123,1,
-    0,0,114,131,1,0,0,114,135,1,0,0,114,31,0,0,
-    0,114,31,0,0,0,114,32,0,0,0,114,114,1,0,0,
-    115,14,0,0,0,2,0,9,2,2,254,2,5,4,8,4,
-    3,4,8,6,5,50,0,254,58,1,51,2,58,3,51,4,
-    58,5,107,6,58,7,107,8,58,9,107,10,58,11,107,12,
-    58,13,51,14,76,114,114,1,0,0,99,48,0,0,0,0,
-    0,128,0,0,0,0,0,0,0,0,0,8,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,20,
-    0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,114,240,0,0,0,114,239,0,0,
-    0,218,12,83,111,117,114,99,101,76,111,97,100,101,114,114,
-    241,0,0,0,99,6,0,0,0,2,0,0,0,3,0,0,
+    0,218,42,85,115,101,32,100,101,102,97,117,108,116,32,115,
+    101,109,97,110,116,105,99,115,32,102,111,114,32,109,111,100,
+    117,108,101,32,99,114,101,97,116,105,111,110,46,218,27,95,
+    76,111,97,100,101,114,66,97,115,105,99,115,46,99,114,101,
+    97,116,101,95,109,111,100,117,108,101,78,80,3,0,0,41,
+    2,114,230,0,0,0,114,78,1,0,0,114,31,0,0,0,
+    114,31,0,0,0,114,32,0,0,0,218,13,99,114,101,97,
+    116,101,95,109,111,100,117,108,101,115,4,0,0,0,2,0,
+    0,1,6,2,51,2,76,114,124,1,0,0,99,84,0,0,
+    0,2,0,0,0,3,0,0,0,2,0,0,0,3,0,0,
+    0,0,0,0,0,0,0,0,0,2,0,0,0,13,0,0,
+    0,12,0,0,0,12,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,218,19,69,120,101,99,117,
+    116,101,32,116,104,101,32,109,111,100,117,108,101,46,218,25,
+    95,76,111,97,100,101,114,66,97,115,105,99,115,46,101,120,
+    101,99,95,109,111,100,117,108,101,218,8,103,101,116,95,99,
+    111,100,101,114,241,0,0,0,78,114,227,0,0,0,218,52,
+    99,97,110,110,111,116,32,108,111,97,100,32,109,111,100,117,
+    108,101,32,123,33,114,125,32,119,104,101,110,32,103,101,116,
+    95,99,111,100,101,40,41,32,114,101,116,117,114,110,115,32,
+    78,111,110,101,114,125,0,0,0,114,235,0,0,0,218,25,
+    95,99,97,108,108,95,119,105,116,104,95,102,114,97,109,101,
+    115,95,114,101,109,111,118,101,100,218,4,101,120,101,99,114,
+    246,0,0,0,83,3,0,0,41,3,114,230,0,0,0,218,
+    6,109,111,100,117,108,101,114,41,1,0,0,114,31,0,0,
+    0,114,31,0,0,0,114,32,0,0,0,218,11,101,120,101,
+    99,95,109,111,100,117,108,101,115,14,0,0,0,2,0,0,
+    2,18,1,7,1,11,1,4,255,13,2,6,13,49,0,54,
+    6,2,255,52,1,3,254,57,8,73,7,2,0,121,2,51,
+    4,33,2,84,31,0,53,5,252,121,6,51,6,54,10,7,
+    251,52,1,3,250,57,12,73,11,2,0,57,7,71,7,1,
+    0,77,53,8,248,54,6,9,247,53,10,245,57,8,4,9,
+    2,52,1,11,244,57,10,73,7,4,0,1,51,4,76,114,
+    132,1,0,0,99,20,0,0,0,2,0,0,0,3,0,0,
     0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,
-    0,2,0,0,0,2,0,0,0,3,0,0,0,2,0,0,
+    0,2,0,0,0,9,0,0,0,4,0,0,0,3,0,0,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,218,165,79,112,116,105,111,110,97,108,32,109,101,116,104,
-    111,100,32,116,104,97,116,32,114,101,116,117,114,110,115,32,
-    116,104,101,32,109,111,100,105,102,105,99,97,116,105,111,110,
-    32,116,105,109,101,32,40,97,110,32,105,110,116,41,32,102,
-    111,114,32,116,104,101,10,32,32,32,32,32,32,32,32,115,
-    112,101,99,105,102,105,101,100,32,112,97,116,104,32,40,97,
-    32,115,116,114,41,46,10,10,32,32,32,32,32,32,32,32,
-    82,97,105,115,101,115,32,79,83,69,114,114,111,114,32,119,
-    104,101,110,32,116,104,101,32,112,97,116,104,32,99,97,110,
-    110,111,116,32,98,101,32,104,97,110,100,108,101,100,46,10,
-    32,32,32,32,32,32,32,32,218,23,83,111,117,114,99,101,
-    76,111,97,100,101,114,46,112,97,116,104,95,109,116,105,109,
-    101,114,105,0,0,0,92,3,0,0,41,2,114,229,0,0,
-    0,114,90,0,0,0,114,31,0,0,0,114,31,0,0,0,
-    114,32,0,0,0,218,10,112,97,116,104,95,109,116,105,109,
-    101,115,4,0,0,0,2,0,0,6,6,2,53,2,254,77,
-    114,139,1,0,0,99,33,0,0,0,2,0,0,0,3,0,
-    0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,
-    0,0,2,0,0,0,10,0,0,0,4,0,0,0,1,0,
+    0,218,26,84,104,105,115,32,109,111,100,117,108,101,32,105,
+    115,32,100,101,112,114,101,99,97,116,101,100,46,218,25,95,
+    76,111,97,100,101,114,66,97,115,105,99,115,46,108,111,97,
+    100,95,109,111,100,117,108,101,114,235,0,0,0,218,17,95,
+    108,111,97,100,95,109,111,100,117,108,101,95,115,104,105,109,
+    91,3,0,0,41,2,114,230,0,0,0,114,255,0,0,0,
+    114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,218,
+    11,108,111,97,100,95,109,111,100,117,108,101,115,4,0,0,
+    0,2,0,0,2,6,9,53,2,254,54,5,3,253,4,7,
+    0,4,8,1,73,6,3,0,76,114,136,1,0,0,78,67,
+    3,0,0,41,5,114,114,1,0,0,114,75,1,0,0,114,
+    124,1,0,0,114,132,1,0,0,114,136,1,0,0,114,31,
+    0,0,0,114,31,0,0,0,114,32,0,0,0,114,115,1,
+    0,0,115,14,0,0,0,2,0,9,2,2,254,2,5,4,
+    8,4,3,4,8,6,5,50,0,254,58,1,51,2,58,3,
+    51,4,58,5,107,6,58,7,107,8,58,9,107,10,58,11,
+    107,12,58,13,51,14,76,114,115,1,0,0,99,48,0,0,
+    0,0,0,128,0,0,0,0,0,0,0,0,0,8,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+    0,20,0,0,0,2,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,114,241,0,0,0,114,240,
+    0,0,0,218,12,83,111,117,114,99,101,76,111,97,100,101,
+    114,114,242,0,0,0,99,6,0,0,0,2,0,0,0,3,
+    0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,
+    0,0,0,2,0,0,0,2,0,0,0,3,0,0,0,2,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,193,158,1,0,0,79,112,116,105,111,110,97,108,32,
-    109,101,116,104,111,100,32,114,101,116,117,114,110,105,110,103,
-    32,97,32,109,101,116,97,100,97,116,97,32,100,105,99,116,
-    32,102,111,114,32,116,104,101,32,115,112,101,99,105,102,105,
-    101,100,10,32,32,32,32,32,32,32,32,112,97,116,104,32,
+    0,0,0,218,165,79,112,116,105,111,110,97,108,32,109,101,
+    116,104,111,100,32,116,104,97,116,32,114,101,116,117,114,110,
+    115,32,116,104,101,32,109,111,100,105,102,105,99,97,116,105,
+    111,110,32,116,105,109,101,32,40,97,110,32,105,110,116,41,
+    32,102,111,114,32,116,104,101,10,32,32,32,32,32,32,32,
+    32,115,112,101,99,105,102,105,101,100,32,112,97,116,104,32,
     40,97,32,115,116,114,41,46,10,10,32,32,32,32,32,32,
-    32,32,80,111,115,115,105,98,108,101,32,107,101,121,115,58,
-    10,32,32,32,32,32,32,32,32,45,32,39,109,116,105,109,
-    101,39,32,40,109,97,110,100,97,116,111,114,121,41,32,105,
-    115,32,116,104,101,32,110,117,109,101,114,105,99,32,116,105,
-    109,101,115,116,97,109,112,32,111,102,32,108,97,115,116,32,
-    115,111,117,114,99,101,10,32,32,32,32,32,32,32,32,32,
-    32,99,111,100,101,32,109,111,100,105,102,105,99,97,116,105,
-    111,110,59,10,32,32,32,32,32,32,32,32,45,32,39,115,
-    105,122,101,39,32,40,111,112,116,105,111,110,97,108,41,32,
-    105,115,32,116,104,101,32,115,105,122,101,32,105,110,32,98,
-    121,116,101,115,32,111,102,32,116,104,101,32,115,111,117,114,
-    99,101,32,99,111,100,101,46,10,10,32,32,32,32,32,32,
-    32,32,73,109,112,108,101,109,101,110,116,105,110,103,32,116,
-    104,105,115,32,109,101,116,104,111,100,32,97,108,108,111,119,
-    115,32,116,104,101,32,108,111,97,100,101,114,32,116,111,32,
-    114,101,97,100,32,98,121,116,101,99,111,100,101,32,102,105,
-    108,101,115,46,10,32,32,32,32,32,32,32,32,82,97,105,
-    115,101,115,32,79,83,69,114,114,111,114,32,119,104,101,110,
-    32,116,104,101,32,112,97,116,104,32,99,97,110,110,111,116,
-    32,98,101,32,104,97,110,100,108,101,100,46,10,32,32,32,
-    32,32,32,32,32,218,23,83,111,117,114,99,101,76,111,97,
-    100,101,114,46,112,97,116,104,95,115,116,97,116,115,114,46,
-    1,0,0,114,139,1,0,0,100,3,0,0,41,2,114,229,
+    32,32,82,97,105,115,101,115,32,79,83,69,114,114,111,114,
+    32,119,104,101,110,32,116,104,101,32,112,97,116,104,32,99,
+    97,110,110,111,116,32,98,101,32,104,97,110,100,108,101,100,
+    46,10,32,32,32,32,32,32,32,32,218,23,83,111,117,114,
+    99,101,76,111,97,100,101,114,46,112,97,116,104,95,109,116,
+    105,109,101,114,105,0,0,0,98,3,0,0,41,2,114,230,
     0,0,0,114,90,0,0,0,114,31,0,0,0,114,31,0,
-    0,0,114,32,0,0,0,218,10,112,97,116,104,95,115,116,
-    97,116,115,115,4,0,0,0,2,0,0,12,6,10,96,1,
-    57,2,51,2,57,3,49,0,54,7,3,255,4,9,1,73,
-    8,2,0,62,2,3,2,3,49,2,2,2,76,114,142,1,
-    0,0,99,19,0,0,0,4,0,0,0,3,0,0,0,4,
-    0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,4,
-    0,0,0,11,0,0,0,3,0,0,0,1,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,
-    228,79,112,116,105,111,110,97,108,32,109,101,116,104,111,100,
-    32,119,104,105,99,104,32,119,114,105,116,101,115,32,100,97,
-    116,97,32,40,98,121,116,101,115,41,32,116,111,32,97,32,
-    102,105,108,101,32,112,97,116,104,32,40,97,32,115,116,114,
-    41,46,10,10,32,32,32,32,32,32,32,32,73,109,112,108,
-    101,109,101,110,116,105,110,103,32,116,104,105,115,32,109,101,
-    116,104,111,100,32,97,108,108,111,119,115,32,102,111,114,32,
-    116,104,101,32,119,114,105,116,105,110,103,32,111,102,32,98,
-    121,116,101,99,111,100,101,32,102,105,108,101,115,46,10,10,
-    32,32,32,32,32,32,32,32,84,104,101,32,115,111,117,114,
-    99,101,32,112,97,116,104,32,105,115,32,110,101,101,100,101,
-    100,32,105,110,32,111,114,100,101,114,32,116,111,32,99,111,
-    114,114,101,99,116,108,121,32,116,114,97,110,115,102,101,114,
-    32,112,101,114,109,105,115,115,105,111,110,115,10,32,32,32,
-    32,32,32,32,32,218,28,83,111,117,114,99,101,76,111,97,
-    100,101,114,46,95,99,97,99,104,101,95,98,121,116,101,99,
-    111,100,101,218,8,115,101,116,95,100,97,116,97,114,3,0,
-    0,41,4,114,229,0,0,0,114,217,0,0,0,218,10,99,
-    97,99,104,101,95,112,97,116,104,114,73,0,0,0,114,31,
-    0,0,0,114,31,0,0,0,114,32,0,0,0,218,15,95,
-    99,97,99,104,101,95,98,121,116,101,99,111,100,101,115,4,
-    0,0,0,2,0,0,8,6,11,49,0,54,7,2,255,4,
-    9,2,4,10,3,73,8,3,0,76,114,147,1,0,0,99,
-    5,0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,
-    3,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,
-    3,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,218,150,79,112,
-    116,105,111,110,97,108,32,109,101,116,104,111,100,32,119,104,
-    105,99,104,32,119,114,105,116,101,115,32,100,97,116,97,32,
-    40,98,121,116,101,115,41,32,116,111,32,97,32,102,105,108,
-    101,32,112,97,116,104,32,40,97,32,115,116,114,41,46,10,
-    10,32,32,32,32,32,32,32,32,73,109,112,108,101,109,101,
-    110,116,105,110,103,32,116,104,105,115,32,109,101,116,104,111,
-    100,32,97,108,108,111,119,115,32,102,111,114,32,116,104,101,
-    32,119,114,105,116,105,110,103,32,111,102,32,98,121,116,101,
-    99,111,100,101,32,102,105,108,101,115,46,10,32,32,32,32,
-    32,32,32,32,218,21,83,111,117,114,99,101,76,111,97,100,
-    101,114,46,115,101,116,95,100,97,116,97,78,124,3,0,0,
-    41,3,114,229,0,0,0,114,90,0,0,0,114,73,0,0,
-    0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,
-    114,145,1,0,0,115,4,0,0,0,2,0,0,1,6,3,
-    51,2,76,114,145,1,0,0,99,100,0,0,0,2,0,0,
-    0,3,0,0,0,2,0,0,0,5,0,0,0,0,0,0,
-    0,0,0,0,0,2,0,0,0,14,0,0,0,9,0,0,
-    0,8,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
-    0,0,0,0,0,218,52,67,111,110,99,114,101,116,101,32,
-    105,109,112,108,101,109,101,110,116,97,116,105,111,110,32,111,
-    102,32,73,110,115,112,101,99,116,76,111,97,100,101,114,46,
-    103,101,116,95,115,111,117,114,99,101,46,218,23,83,111,117,
-    114,99,101,76,111,97,100,101,114,46,103,101,116,95,115,111,
-    117,114,99,101,114,68,1,0,0,218,8,103,101,116,95,100,
-    97,116,97,114,105,0,0,0,114,226,0,0,0,218,39,115,
-    111,117,114,99,101,32,110,111,116,32,97,118,97,105,108,97,
-    98,108,101,32,116,104,114,111,117,103,104,32,103,101,116,95,
-    100,97,116,97,40,41,114,228,0,0,0,114,51,1,0,0,
-    17,0,0,0,35,0,0,0,87,0,0,0,5,0,0,0,
-    46,0,0,0,76,0,0,0,80,0,0,0,7,0,0,0,
-    131,3,0,0,41,5,114,229,0,0,0,114,254,0,0,0,
-    114,90,0,0,0,114,59,1,0,0,218,3,101,120,99,114,
-    31,0,0,0,114,31,0,0,0,114,32,0,0,0,218,10,
-    103,101,116,95,115,111,117,114,99,101,115,12,0,0,0,2,
-    0,0,2,15,2,18,1,11,1,41,2,6,14,49,0,54,
-    8,2,255,4,10,1,73,9,2,0,57,2,49,0,54,8,
-    3,254,4,10,2,73,9,2,0,57,3,80,55,0,53,4,
-    252,83,5,47,0,49,6,57,4,53,5,250,57,12,51,6,
-    57,13,4,7,1,51,7,57,8,71,13,1,1,57,7,4,
-    8,4,75,9,7,2,77,2,4,99,7,97,5,80,5,0,
-    99,5,53,8,248,57,8,4,9,3,71,9,1,0,76,114,
-    155,1,0,0,114,211,0,0,0,99,46,0,0,0,3,0,
-    32,0,3,0,0,0,3,0,0,0,4,0,0,0,1,0,
-    0,0,0,0,0,0,4,0,0,0,15,0,0,0,8,0,
-    0,0,5,0,0,0,0,0,0,0,1,0,0,0,0,0,
-    0,0,0,0,0,0,218,130,82,101,116,117,114,110,32,116,
-    104,101,32,99,111,100,101,32,111,98,106,101,99,116,32,99,
-    111,109,112,105,108,101,100,32,102,114,111,109,32,115,111,117,
-    114,99,101,46,10,10,32,32,32,32,32,32,32,32,84,104,
-    101,32,39,100,97,116,97,39,32,97,114,103,117,109,101,110,
-    116,32,99,97,110,32,98,101,32,97,110,121,32,111,98,106,
-    101,99,116,32,116,121,112,101,32,116,104,97,116,32,99,111,
-    109,112,105,108,101,40,41,32,115,117,112,112,111,114,116,115,
-    46,10,32,32,32,32,32,32,32,32,218,27,83,111,117,114,
-    99,101,76,111,97,100,101,114,46,115,111,117,114,99,101,95,
-    116,111,95,99,111,100,101,114,234,0,0,0,114,128,1,0,
-    0,218,7,99,111,109,112,105,108,101,114,129,1,0,0,84,
-    169,2,218,12,100,111,110,116,95,105,110,104,101,114,105,116,
-    114,169,0,0,0,8,0,0,0,3,0,0,0,141,3,0,
-    0,41,4,114,229,0,0,0,114,73,0,0,0,114,90,0,
-    0,0,218,9,95,111,112,116,105,109,105,122,101,114,31,0,
-    0,0,114,31,0,0,0,114,32,0,0,0,218,14,115,111,
-    117,114,99,101,95,116,111,95,99,111,100,101,115,8,0,0,
-    0,2,0,0,5,28,1,2,255,6,15,53,2,254,57,4,
-    52,4,3,253,2,4,57,10,53,4,251,57,11,4,12,1,
-    4,13,2,51,5,57,14,51,6,57,4,4,5,3,51,7,
-    57,6,71,11,4,2,76,114,162,1,0,0,99,181,2,0,
-    0,2,0,0,0,3,0,0,0,2,0,0,0,15,0,0,
-    0,0,0,0,0,0,0,0,0,2,0,0,0,26,0,0,
-    0,45,0,0,0,50,0,0,0,0,0,0,0,0,0,0,
-    0,5,0,0,0,0,0,0,0,218,190,67,111,110,99,114,
-    101,116,101,32,105,109,112,108,101,109,101,110,116,97,116,105,
-    111,110,32,111,102,32,73,110,115,112,101,99,116,76,111,97,
-    100,101,114,46,103,101,116,95,99,111,100,101,46,10,10,32,
-    32,32,32,32,32,32,32,82,101,97,100,105,110,103,32,111,
-    102,32,98,121,116,101,99,111,100,101,32,114,101,113,117,105,
-    114,101,115,32,112,97,116,104,95,115,116,97,116,115,32,116,
-    111,32,98,101,32,105,109,112,108,101,109,101,110,116,101,100,
-    46,32,84,111,32,119,114,105,116,101,10,32,32,32,32,32,
-    32,32,32,98,121,116,101,99,111,100,101,44,32,115,101,116,
-    95,100,97,116,97,32,109,117,115,116,32,97,108,115,111,32,
-    98,101,32,105,109,112,108,101,109,101,110,116,101,100,46,10,
-    10,32,32,32,32,32,32,32,32,218,21,83,111,117,114,99,
-    101,76,111,97,100,101,114,46,103,101,116,95,99,111,100,101,
-    114,68,1,0,0,78,70,84,114,156,0,0,0,114,167,0,
-    0,0,114,142,1,0,0,114,105,0,0,0,114,64,0,0,
-    0,114,46,1,0,0,114,152,1,0,0,114,225,0,0,0,
-    114,90,0,0,0,114,3,1,0,0,218,10,109,101,109,111,
-    114,121,118,105,101,119,186,114,9,1,0,0,78,78,114,29,
-    0,0,0,114,4,0,0,0,114,76,0,0,0,114,3,0,
-    0,0,218,21,99,104,101,99,107,95,104,97,115,104,95,98,
-    97,115,101,100,95,112,121,99,115,218,5,110,101,118,101,114,
-    218,6,97,108,119,97,121,115,114,31,1,0,0,114,144,0,
-    0,0,114,28,1,0,0,114,20,1,0,0,218,4,115,105,
-    122,101,114,226,0,0,0,114,11,1,0,0,114,234,0,0,
-    0,114,7,1,0,0,218,13,123,125,32,109,97,116,99,104,
-    101,115,32,123,125,114,33,1,0,0,169,3,114,225,0,0,
-    0,114,214,0,0,0,114,217,0,0,0,114,162,1,0,0,
-    218,19,99,111,100,101,32,111,98,106,101,99,116,32,102,114,
-    111,109,32,123,125,114,8,0,0,0,218,19,100,111,110,116,
-    95,119,114,105,116,101,95,98,121,116,101,99,111,100,101,114,
-    48,1,0,0,114,42,1,0,0,114,28,0,0,0,114,147,
-    1,0,0,37,0,0,0,54,0,0,0,72,0,0,0,15,
-    0,0,0,72,0,0,0,90,0,0,0,104,0,0,0,15,
-    0,0,0,121,0,0,0,139,0,0,0,153,0,0,0,15,
-    0,0,0,185,0,0,0,151,1,0,0,175,1,0,0,15,
-    0,0,0,141,2,0,0,164,2,0,0,178,2,0,0,15,
-    0,0,0,149,3,0,0,41,15,114,229,0,0,0,114,254,
-    0,0,0,114,217,0,0,0,114,25,1,0,0,114,59,1,
-    0,0,114,31,1,0,0,218,10,104,97,115,104,95,98,97,
-    115,101,100,218,12,99,104,101,99,107,95,115,111,117,114,99,
-    101,114,214,0,0,0,218,2,115,116,114,73,0,0,0,114,
-    17,1,0,0,114,56,0,0,0,218,10,98,121,116,101,115,
-    95,100,97,116,97,218,11,99,111,100,101,95,111,98,106,101,
-    99,116,114,31,0,0,0,114,31,0,0,0,114,32,0,0,
-    0,114,126,1,0,0,115,130,0,0,0,2,0,0,7,15,
-    1,4,1,4,1,4,1,4,1,4,2,17,1,7,1,11,
-    3,18,1,7,1,7,2,17,2,18,1,7,1,7,2,4,
-    1,2,255,2,1,2,255,5,2,2,254,2,2,2,254,11,
-    5,20,1,22,1,15,1,5,1,15,1,24,1,6,1,20,
-    254,3,3,15,1,7,1,3,255,11,4,25,3,11,3,4,
-    253,16,7,17,1,7,2,22,2,26,3,7,1,15,1,18,
-    1,19,1,25,1,5,255,3,2,5,1,7,1,16,1,23,
-    2,11,1,12,255,8,3,23,1,7,1,7,1,6,26,49,
-    0,54,18,2,255,4,20,1,73,19,2,0,57,2,51,3,
-    57,3,51,3,57,4,51,3,57,5,51,4,57,6,51,5,
-    57,7,53,6,253,57,18,4,19,2,71,19,1,0,57,8,
-    80,21,0,53,7,251,83,15,13,0,51,3,57,8,97,15,
-    80,156,1,99,15,49,0,54,18,8,250,4,20,2,73,19,
-    2,0,57,9,80,17,0,53,9,248,83,15,9,0,97,15,
-    80,124,1,99,15,53,10,246,57,18,51,11,25,9,57,19,
-    71,19,1,0,57,3,49,0,54,18,12,245,4,20,8,73,
-    19,2,0,57,10,80,17,0,53,9,248,83,15,9,0,97,
-    15,80,75,1,99,15,96,2,57,15,51,13,57,16,49,1,
-    62,15,16,2,16,51,14,57,16,49,8,62,15,16,2,16,
-    49,15,2,15,57,11,53,15,243,57,18,4,19,10,4,20,
-    1,4,21,11,71,19,3,0,57,12,53,16,241,57,18,4,
-    19,10,71,19,1,0,57,15,51,17,25,15,2,15,57,13,
-    51,18,30,12,57,15,51,19,35,3,15,2,15,57,6,49,
-    6,84,132,0,51,20,30,12,57,15,51,19,35,3,15,2,
-    15,57,7,53,21,239,57,15,52,15,22,238,2,15,57,15,
-    51,23,35,3,15,2,15,81,30,0,1,49,7,82,24,0,
-    1,53,21,239,57,15,52,15,22,237,2,15,57,15,51,24,
-    35,2,15,2,15,84,61,0,49,0,54,18,12,236,4,20,
-    2,73,19,2,0,57,4,53,21,239,54,18,25,235,53,26,
-    233,57,20,4,21,4,73,19,3,0,57,5,53,27,231,57,
-    18,4,19,10,4,20,5,4,21,1,4,22,11,71,19,4,
-    0,1,80,31,0,53,28,229,57,18,4,19,10,4,20,3,
-    51,29,25,9,57,21,4,22,1,4,23,11,71,19,5,0,
-    1,80,27,0,53,30,227,57,17,53,31,225,57,18,93,17,
-    2,83,15,9,0,97,15,80,53,0,99,15,53,32,223,54,
-    18,33,222,51,34,57,20,4,21,8,4,22,2,73,19,4,
-    0,1,53,35,220,57,22,4,23,13,4,15,1,4,16,8,
-    4,17,2,51,36,57,18,71,23,1,3,76,51,3,33,4,
-    84,18,0,49,0,54,18,12,219,4,20,2,73,19,2,0,
-    57,4,49,0,54,18,37,218,4,20,4,4,21,2,73,19,
-    3,0,57,14,53,32,223,54,18,33,217,51,38,57,20,4,
-    21,2,73,19,3,0,1,53,39,215,57,15,52,15,40,214,
-    2,15,16,81,18,0,1,51,3,33,8,17,81,9,0,1,
-    51,3,33,3,17,84,122,0,49,6,84,49,0,51,3,33,
-    5,84,19,0,53,21,239,54,18,25,213,4,20,4,73,19,
-    2,0,57,5,53,41,211,57,18,4,19,14,4,20,5,4,
-    21,7,71,19,3,0,57,10,80,34,0,53,42,209,57,18,
-    4,19,14,4,20,3,53,43,207,57,24,4,25,4,71,25,
-    1,0,57,21,71,19,3,0,57,10,49,0,54,18,44,206,
-    4,20,2,4,21,8,4,22,10,73,19,4,0,1,80,17,
-    0,53,7,251,83,15,9,0,97,15,80,5,0,99,15,49,
-    14,76,114,126,1,0,0,78,90,3,0,0,41,8,114,113,
-    1,0,0,114,139,1,0,0,114,142,1,0,0,114,147,1,
-    0,0,114,145,1,0,0,114,155,1,0,0,114,162,1,0,
-    0,114,126,1,0,0,114,31,0,0,0,114,31,0,0,0,
-    114,32,0,0,0,114,136,1,0,0,115,16,0,0,0,2,
-    0,9,2,4,8,4,14,4,10,4,7,4,10,10,8,6,
-    9,50,0,254,58,1,51,2,58,3,107,4,58,5,107,6,
-    58,7,107,8,58,9,107,10,58,11,107,12,58,13,51,14,
-    57,8,107,15,2,8,58,16,107,17,58,18,51,19,76,114,
-    136,1,0,0,99,99,0,0,0,0,0,136,0,0,0,0,
-    0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,17,0,0,0,30,0,0,0,4,0,0,
-    0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,114,240,0,0,0,114,239,0,0,0,218,10,70,105,108,
-    101,76,111,97,100,101,114,114,241,0,0,0,218,103,66,97,
-    115,101,32,102,105,108,101,32,108,111,97,100,101,114,32,99,
-    108,97,115,115,32,119,104,105,99,104,32,105,109,112,108,101,
-    109,101,110,116,115,32,116,104,101,32,108,111,97,100,101,114,
-    32,112,114,111,116,111,99,111,108,32,109,101,116,104,111,100,
-    115,32,116,104,97,116,10,32,32,32,32,114,101,113,117,105,
-    114,101,32,102,105,108,101,32,115,121,115,116,101,109,32,117,
-    115,97,103,101,46,114,1,0,0,0,99,15,0,0,0,3,
-    0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,0,
-    0,0,0,0,0,0,0,3,0,0,0,3,0,0,0,5,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,218,75,67,97,99,104,101,32,116,
-    104,101,32,109,111,100,117,108,101,32,110,97,109,101,32,97,
-    110,100,32,116,104,101,32,112,97,116,104,32,116,111,32,116,
-    104,101,32,102,105,108,101,32,102,111,117,110,100,32,98,121,
-    32,116,104,101,10,32,32,32,32,32,32,32,32,102,105,110,
-    100,101,114,46,218,19,70,105,108,101,76,111,97,100,101,114,
-    46,95,95,105,110,105,116,95,95,114,225,0,0,0,114,90,
-    0,0,0,78,239,3,0,0,41,3,114,229,0,0,0,114,
-    254,0,0,0,114,90,0,0,0,114,31,0,0,0,114,31,
-    0,0,0,114,32,0,0,0,114,118,1,0,0,115,6,0,
-    0,0,2,0,0,3,5,1,6,3,49,1,59,0,2,49,
-    2,59,0,3,51,4,76,114,118,1,0,0,99,37,0,0,
-    0,2,0,0,0,3,0,0,0,2,0,0,0,2,0,0,
-    0,0,0,0,0,0,0,0,0,2,0,0,0,3,0,0,
+    0,0,114,32,0,0,0,218,10,112,97,116,104,95,109,116,
+    105,109,101,115,4,0,0,0,2,0,0,6,6,2,53,2,
+    254,77,114,140,1,0,0,99,33,0,0,0,2,0,0,0,
+    3,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,
+    0,0,0,0,2,0,0,0,10,0,0,0,4,0,0,0,
+    1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,193,158,1,0,0,79,112,116,105,111,110,97,
+    108,32,109,101,116,104,111,100,32,114,101,116,117,114,110,105,
+    110,103,32,97,32,109,101,116,97,100,97,116,97,32,100,105,
+    99,116,32,102,111,114,32,116,104,101,32,115,112,101,99,105,
+    102,105,101,100,10,32,32,32,32,32,32,32,32,112,97,116,
+    104,32,40,97,32,115,116,114,41,46,10,10,32,32,32,32,
+    32,32,32,32,80,111,115,115,105,98,108,101,32,107,101,121,
+    115,58,10,32,32,32,32,32,32,32,32,45,32,39,109,116,
+    105,109,101,39,32,40,109,97,110,100,97,116,111,114,121,41,
+    32,105,115,32,116,104,101,32,110,117,109,101,114,105,99,32,
+    116,105,109,101,115,116,97,109,112,32,111,102,32,108,97,115,
+    116,32,115,111,117,114,99,101,10,32,32,32,32,32,32,32,
+    32,32,32,99,111,100,101,32,109,111,100,105,102,105,99,97,
+    116,105,111,110,59,10,32,32,32,32,32,32,32,32,45,32,
+    39,115,105,122,101,39,32,40,111,112,116,105,111,110,97,108,
+    41,32,105,115,32,116,104,101,32,115,105,122,101,32,105,110,
+    32,98,121,116,101,115,32,111,102,32,116,104,101,32,115,111,
+    117,114,99,101,32,99,111,100,101,46,10,10,32,32,32,32,
+    32,32,32,32,73,109,112,108,101,109,101,110,116,105,110,103,
+    32,116,104,105,115,32,109,101,116,104,111,100,32,97,108,108,
+    111,119,115,32,116,104,101,32,108,111,97,100,101,114,32,116,
+    111,32,114,101,97,100,32,98,121,116,101,99,111,100,101,32,
+    102,105,108,101,115,46,10,32,32,32,32,32,32,32,32,82,
+    97,105,115,101,115,32,79,83,69,114,114,111,114,32,119,104,
+    101,110,32,116,104,101,32,112,97,116,104,32,99,97,110,110,
+    111,116,32,98,101,32,104,97,110,100,108,101,100,46,10,32,
+    32,32,32,32,32,32,32,218,23,83,111,117,114,99,101,76,
+    111,97,100,101,114,46,112,97,116,104,95,115,116,97,116,115,
+    114,47,1,0,0,114,140,1,0,0,106,3,0,0,41,2,
+    114,230,0,0,0,114,90,0,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,32,0,0,0,218,10,112,97,116,104,95,
+    115,116,97,116,115,115,4,0,0,0,2,0,0,12,6,10,
+    96,1,121,2,122,2,120,3,49,0,54,7,3,255,4,9,
+    1,73,8,2,0,62,2,3,2,3,49,2,2,2,76,114,
+    143,1,0,0,99,19,0,0,0,4,0,0,0,3,0,0,
     0,4,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,78,218,17,70,105,108,101,
-    76,111,97,100,101,114,46,95,95,101,113,95,95,218,9,95,
-    95,99,108,97,115,115,95,95,114,245,0,0,0,245,3,0,
-    0,41,2,114,229,0,0,0,218,5,111,116,104,101,114,114,
-    31,0,0,0,114,31,0,0,0,114,32,0,0,0,218,6,
-    95,95,101,113,95,95,115,8,0,0,0,2,0,0,1,19,
-    1,15,255,6,3,52,0,2,255,57,2,52,1,2,254,35,
-    2,2,2,2,81,19,0,1,52,0,3,253,57,2,52,1,
-    3,252,35,2,2,2,2,76,114,187,1,0,0,99,39,0,
-    0,0,1,0,0,0,3,0,0,0,1,0,0,0,1,0,
-    0,0,0,0,0,0,0,0,0,0,1,0,0,0,7,0,
-    0,0,5,0,0,0,4,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,78,218,19,70,105,108,
-    101,76,111,97,100,101,114,46,95,95,104,97,115,104,95,95,
-    218,4,104,97,115,104,114,225,0,0,0,114,90,0,0,0,
-    249,3,0,0,41,1,114,229,0,0,0,114,31,0,0,0,
-    114,31,0,0,0,114,32,0,0,0,218,8,95,95,104,97,
-    115,104,95,95,115,4,0,0,0,2,0,0,1,6,7,53,
-    2,254,57,4,52,0,3,253,57,5,71,5,1,0,57,1,
-    53,2,254,57,5,52,0,4,252,57,6,71,6,1,0,31,
-    1,2,1,76,114,190,1,0,0,114,223,0,0,0,99,31,
-    0,0,0,2,0,16,0,3,0,0,0,2,0,0,0,3,
-    0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,9,
-    0,0,0,5,0,0,0,5,0,0,0,0,0,0,0,1,
-    0,0,0,0,0,0,0,0,0,0,0,218,100,76,111,97,
-    100,32,97,32,109,111,100,117,108,101,32,102,114,111,109,32,
-    97,32,102,105,108,101,46,10,10,32,32,32,32,32,32,32,
-    32,84,104,105,115,32,109,101,116,104,111,100,32,105,115,32,
-    100,101,112,114,101,99,97,116,101,100,46,32,32,85,115,101,
-    32,101,120,101,99,95,109,111,100,117,108,101,40,41,32,105,
-    110,115,116,101,97,100,46,10,10,32,32,32,32,32,32,32,
-    32,218,22,70,105,108,101,76,111,97,100,101,114,46,108,111,
-    97,100,95,109,111,100,117,108,101,218,5,115,117,112,101,114,
-    114,180,1,0,0,114,135,1,0,0,12,0,0,0,2,0,
-    0,0,252,3,0,0,41,3,114,229,0,0,0,114,254,0,
-    0,0,114,185,1,0,0,41,1,114,185,1,0,0,114,31,
-    0,0,0,114,32,0,0,0,114,135,1,0,0,115,4,0,
-    0,0,2,0,0,10,6,9,53,2,254,57,6,53,3,252,
-    57,7,4,8,0,71,7,2,0,54,6,4,251,4,8,1,
-    73,7,2,0,76,114,135,1,0,0,99,7,0,0,0,2,
-    0,0,0,3,0,0,0,2,0,0,0,2,0,0,0,0,
-    0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,3,
-    0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,218,58,82,101,116,117,114,110,32,
-    116,104,101,32,112,97,116,104,32,116,111,32,116,104,101,32,
-    115,111,117,114,99,101,32,102,105,108,101,32,97,115,32,102,
-    111,117,110,100,32,98,121,32,116,104,101,32,102,105,110,100,
-    101,114,46,218,23,70,105,108,101,76,111,97,100,101,114,46,
-    103,101,116,95,102,105,108,101,110,97,109,101,114,90,0,0,
-    0,8,4,0,0,41,2,114,229,0,0,0,114,254,0,0,
-    0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,
-    114,68,1,0,0,115,4,0,0,0,2,0,0,3,6,2,
-    52,0,2,255,76,114,68,1,0,0,99,119,0,0,0,2,
-    0,0,0,3,0,0,0,2,0,0,0,3,0,0,0,0,
-    0,0,0,0,0,0,0,2,0,0,0,13,0,0,0,12,
-    0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,2,
-    0,0,0,0,0,0,0,218,39,82,101,116,117,114,110,32,
-    116,104,101,32,100,97,116,97,32,102,114,111,109,32,112,97,
-    116,104,32,97,115,32,114,97,119,32,98,121,116,101,115,46,
-    218,19,70,105,108,101,76,111,97,100,101,114,46,103,101,116,
-    95,100,97,116,97,114,35,1,0,0,114,136,1,0,0,218,
-    19,69,120,116,101,110,115,105,111,110,70,105,108,101,76,111,
-    97,100,101,114,114,6,0,0,0,218,9,111,112,101,110,95,
-    99,111,100,101,114,170,0,0,0,218,4,114,101,97,100,114,
-    131,0,0,0,250,1,114,78,59,0,0,0,74,0,0,0,
-    76,0,0,0,5,0,0,0,99,0,0,0,114,0,0,0,
-    116,0,0,0,5,0,0,0,13,4,0,0,41,3,114,229,
-    0,0,0,114,90,0,0,0,114,137,0,0,0,114,31,0,
-    0,0,114,31,0,0,0,114,32,0,0,0,114,152,1,0,
-    0,115,12,0,0,0,2,0,0,2,30,1,29,1,18,2,
-    22,1,6,13,53,2,254,57,6,4,7,0,53,3,252,57,
-    8,53,4,250,57,9,93,8,2,57,8,71,7,2,0,84,
-    50,0,53,5,248,54,6,6,247,53,7,245,57,11,4,12,
-    1,71,12,1,0,57,8,73,7,2,0,108,3,57,2,49,
-    2,54,8,8,244,73,9,1,0,109,3,76,109,3,80,40,
-    0,53,5,248,54,6,9,243,4,8,1,51,10,57,9,73,
-    7,3,0,108,3,57,2,49,2,54,8,8,242,73,9,1,
-    0,109,3,76,109,3,51,11,76,114,152,1,0,0,99,24,
-    0,0,0,2,0,0,0,3,0,0,0,2,0,0,0,2,
-    0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,8,
-    0,0,0,3,0,0,0,1,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,78,218,30,70,105,
-    108,101,76,111,97,100,101,114,46,103,101,116,95,114,101,115,
-    111,117,114,99,101,95,114,101,97,100,101,114,114,74,1,0,
-    0,24,4,0,0,41,2,114,229,0,0,0,114,130,1,0,
-    0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,
-    218,19,103,101,116,95,114,101,115,111,117,114,99,101,95,114,
-    101,97,100,101,114,115,8,0,0,0,2,0,0,2,16,1,
-    3,1,6,8,49,0,54,5,2,255,4,7,1,73,6,2,
-    0,84,6,0,49,0,76,51,0,76,114,203,1,0,0,99,
-    60,0,0,0,2,0,0,0,3,0,0,0,2,0,0,0,
-    3,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
-    12,0,0,0,9,0,0,0,8,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,78,218,24,70,
-    105,108,101,76,111,97,100,101,114,46,111,112,101,110,95,114,
-    101,115,111,117,114,99,101,114,78,0,0,0,114,95,0,0,
-    0,114,90,0,0,0,114,4,0,0,0,114,6,0,0,0,
-    114,131,0,0,0,114,201,1,0,0,30,4,0,0,41,3,
-    114,229,0,0,0,218,8,114,101,115,111,117,114,99,101,114,
-    90,0,0,0,114,31,0,0,0,114,31,0,0,0,114,32,
-    0,0,0,218,13,111,112,101,110,95,114,101,115,111,117,114,
-    99,101,115,6,0,0,0,2,0,0,1,39,1,6,12,53,
-    2,254,57,6,53,3,252,57,10,52,0,4,251,57,11,71,
-    11,1,0,57,7,51,5,25,7,2,7,57,7,4,8,1,
-    71,7,2,0,57,2,53,6,249,54,6,7,248,4,8,2,
-    51,8,57,9,73,7,3,0,76,114,206,1,0,0,99,65,
-    0,0,0,2,0,0,0,3,0,0,0,2,0,0,0,3,
-    0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,12,
-    0,0,0,8,0,0,0,8,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,78,218,24,70,105,
-    108,101,76,111,97,100,101,114,46,114,101,115,111,117,114,99,
-    101,95,112,97,116,104,218,11,105,115,95,114,101,115,111,117,
-    114,99,101,218,17,70,105,108,101,78,111,116,70,111,117,110,
-    100,69,114,114,111,114,114,78,0,0,0,114,95,0,0,0,
-    114,90,0,0,0,114,4,0,0,0,34,4,0,0,41,3,
-    114,229,0,0,0,114,205,1,0,0,114,90,0,0,0,114,
-    31,0,0,0,114,31,0,0,0,114,32,0,0,0,218,13,
-    114,101,115,111,117,114,99,101,95,112,97,116,104,115,10,0,
-    0,0,2,0,0,1,17,1,4,1,39,1,6,12,49,0,
-    54,6,2,255,4,8,1,73,7,2,0,16,84,7,0,53,
-    3,253,77,53,4,251,57,6,53,5,249,57,10,52,0,6,
-    248,57,11,71,11,1,0,57,7,51,7,25,7,2,7,57,
-    7,4,8,1,71,7,2,0,57,2,49,2,76,114,210,1,
-    0,0,99,71,0,0,0,2,0,0,0,3,0,0,0,2,
-    0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,2,
-    0,0,0,12,0,0,0,9,0,0,0,9,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,
-    218,22,70,105,108,101,76,111,97,100,101,114,46,105,115,95,
-    114,101,115,111,117,114,99,101,114,33,0,0,0,70,114,78,
-    0,0,0,114,95,0,0,0,114,90,0,0,0,114,4,0,
-    0,0,114,111,0,0,0,40,4,0,0,41,3,114,229,0,
-    0,0,114,225,0,0,0,114,90,0,0,0,114,31,0,0,
-    0,114,31,0,0,0,114,32,0,0,0,114,208,1,0,0,
-    115,10,0,0,0,2,0,0,1,14,1,3,1,39,1,6,
-    12,53,2,254,57,3,49,1,34,3,2,3,84,6,0,51,
-    3,76,53,4,252,57,6,53,5,250,57,10,52,0,6,249,
-    57,11,71,11,1,0,57,7,51,7,25,7,2,7,57,7,
-    4,8,1,71,7,2,0,57,2,53,8,247,57,6,4,7,
-    2,71,7,1,0,76,114,208,1,0,0,99,50,0,0,0,
-    1,0,0,0,3,0,0,0,1,0,0,0,1,0,0,0,
-    0,0,0,0,0,0,0,0,1,0,0,0,15,0,0,0,
-    8,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,78,218,19,70,105,108,101,76,
-    111,97,100,101,114,46,99,111,110,116,101,110,116,115,218,4,
-    105,116,101,114,114,18,0,0,0,218,7,108,105,115,116,100,
-    105,114,114,95,0,0,0,114,90,0,0,0,114,4,0,0,
-    0,46,4,0,0,41,1,114,229,0,0,0,114,31,0,0,
-    0,114,31,0,0,0,114,32,0,0,0,218,8,99,111,110,
-    116,101,110,116,115,115,4,0,0,0,2,0,0,1,6,15,
-    53,2,254,57,4,53,3,252,54,8,4,251,53,5,249,57,
-    13,52,0,6,248,57,14,71,14,1,0,57,10,51,7,25,
-    10,2,10,57,10,73,9,2,0,57,5,71,5,1,0,76,
-    114,215,1,0,0,218,13,95,95,99,108,97,115,115,99,101,
-    108,108,95,95,12,0,0,0,234,3,0,0,41,13,114,113,
-    1,0,0,114,118,1,0,0,114,187,1,0,0,114,190,1,
-    0,0,114,135,1,0,0,114,68,1,0,0,114,152,1,0,
-    0,114,203,1,0,0,114,206,1,0,0,114,210,1,0,0,
-    114,208,1,0,0,114,215,1,0,0,114,185,1,0,0,114,
-    31,0,0,0,41,1,114,185,1,0,0,114,32,0,0,0,
-    114,180,1,0,0,115,34,0,0,0,2,0,9,2,2,254,
-    2,5,4,6,4,4,4,3,5,1,10,11,5,1,10,4,
-    4,11,5,1,10,5,4,4,4,6,4,6,6,17,50,0,
-    254,58,1,51,2,58,3,51,4,58,5,107,6,58,7,107,
-    8,58,9,107,10,58,11,50,12,252,57,16,107,13,57,17,
-    71,17,1,0,58,14,50,12,252,57,16,107,15,57,17,71,
-    17,1,0,58,16,107,17,58,18,50,12,252,57,16,107,19,
-    57,17,71,17,1,0,58,20,107,21,58,22,107,23,58,24,
-    107,25,58,26,107,27,58,28,49,12,58,29,49,12,76,114,
-    180,1,0,0,99,36,0,0,0,0,0,128,0,0,0,0,
-    0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,5,0,0,0,14,0,0,0,2,0,0,
+    0,4,0,0,0,11,0,0,0,3,0,0,0,1,0,0,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,114,240,0,0,0,114,239,0,0,0,218,16,83,111,117,
-    114,99,101,70,105,108,101,76,111,97,100,101,114,114,241,0,
-    0,0,218,62,67,111,110,99,114,101,116,101,32,105,109,112,
-    108,101,109,101,110,116,97,116,105,111,110,32,111,102,32,83,
-    111,117,114,99,101,76,111,97,100,101,114,32,117,115,105,110,
-    103,32,116,104,101,32,102,105,108,101,32,115,121,115,116,101,
-    109,46,114,1,0,0,0,99,51,0,0,0,2,0,0,0,
-    3,0,0,0,2,0,0,0,3,0,0,0,0,0,0,0,
-    0,0,0,0,2,0,0,0,8,0,0,0,7,0,0,0,
-    4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,218,33,82,101,116,117,114,110,32,116,104,101,
-    32,109,101,116,97,100,97,116,97,32,102,111,114,32,116,104,
-    101,32,112,97,116,104,46,218,27,83,111,117,114,99,101,70,
-    105,108,101,76,111,97,100,101,114,46,112,97,116,104,95,115,
-    116,97,116,115,114,101,0,0,0,114,46,1,0,0,218,8,
-    115,116,95,109,116,105,109,101,114,170,1,0,0,218,7,115,
-    116,95,115,105,122,101,54,4,0,0,41,3,114,229,0,0,
-    0,114,90,0,0,0,114,177,1,0,0,114,31,0,0,0,
-    114,31,0,0,0,114,32,0,0,0,114,142,1,0,0,115,
-    6,0,0,0,2,0,0,2,14,1,6,8,53,2,254,57,
-    6,4,7,1,71,7,1,0,57,2,96,2,57,3,51,3,
-    57,4,52,2,4,253,62,3,4,2,4,51,5,57,4,52,
-    2,6,252,62,3,4,2,4,49,3,2,3,76,114,142,1,
-    0,0,99,40,0,0,0,4,0,0,0,3,0,0,0,4,
-    0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,4,
-    0,0,0,13,0,0,0,5,0,0,0,3,0,0,0,0,
+    0,218,228,79,112,116,105,111,110,97,108,32,109,101,116,104,
+    111,100,32,119,104,105,99,104,32,119,114,105,116,101,115,32,
+    100,97,116,97,32,40,98,121,116,101,115,41,32,116,111,32,
+    97,32,102,105,108,101,32,112,97,116,104,32,40,97,32,115,
+    116,114,41,46,10,10,32,32,32,32,32,32,32,32,73,109,
+    112,108,101,109,101,110,116,105,110,103,32,116,104,105,115,32,
+    109,101,116,104,111,100,32,97,108,108,111,119,115,32,102,111,
+    114,32,116,104,101,32,119,114,105,116,105,110,103,32,111,102,
+    32,98,121,116,101,99,111,100,101,32,102,105,108,101,115,46,
+    10,10,32,32,32,32,32,32,32,32,84,104,101,32,115,111,
+    117,114,99,101,32,112,97,116,104,32,105,115,32,110,101,101,
+    100,101,100,32,105,110,32,111,114,100,101,114,32,116,111,32,
+    99,111,114,114,101,99,116,108,121,32,116,114,97,110,115,102,
+    101,114,32,112,101,114,109,105,115,115,105,111,110,115,10,32,
+    32,32,32,32,32,32,32,218,28,83,111,117,114,99,101,76,
+    111,97,100,101,114,46,95,99,97,99,104,101,95,98,121,116,
+    101,99,111,100,101,218,8,115,101,116,95,100,97,116,97,120,
+    3,0,0,41,4,114,230,0,0,0,114,218,0,0,0,218,
+    10,99,97,99,104,101,95,112,97,116,104,114,73,0,0,0,
+    114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,218,
+    15,95,99,97,99,104,101,95,98,121,116,101,99,111,100,101,
+    115,4,0,0,0,2,0,0,8,6,11,49,0,54,7,2,
+    255,4,9,2,4,10,3,73,8,3,0,76,114,148,1,0,
+    0,99,5,0,0,0,3,0,0,0,3,0,0,0,3,0,
+    0,0,3,0,0,0,0,0,0,0,0,0,0,0,3,0,
+    0,0,3,0,0,0,3,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,150,
+    79,112,116,105,111,110,97,108,32,109,101,116,104,111,100,32,
+    119,104,105,99,104,32,119,114,105,116,101,115,32,100,97,116,
+    97,32,40,98,121,116,101,115,41,32,116,111,32,97,32,102,
+    105,108,101,32,112,97,116,104,32,40,97,32,115,116,114,41,
+    46,10,10,32,32,32,32,32,32,32,32,73,109,112,108,101,
+    109,101,110,116,105,110,103,32,116,104,105,115,32,109,101,116,
+    104,111,100,32,97,108,108,111,119,115,32,102,111,114,32,116,
+    104,101,32,119,114,105,116,105,110,103,32,111,102,32,98,121,
+    116,101,99,111,100,101,32,102,105,108,101,115,46,10,32,32,
+    32,32,32,32,32,32,218,21,83,111,117,114,99,101,76,111,
+    97,100,101,114,46,115,101,116,95,100,97,116,97,78,130,3,
+    0,0,41,3,114,230,0,0,0,114,90,0,0,0,114,73,
+    0,0,0,114,31,0,0,0,114,31,0,0,0,114,32,0,
+    0,0,114,146,1,0,0,115,4,0,0,0,2,0,0,1,
+    6,3,51,2,76,114,146,1,0,0,99,100,0,0,0,2,
+    0,0,0,3,0,0,0,2,0,0,0,5,0,0,0,0,
+    0,0,0,0,0,0,0,2,0,0,0,14,0,0,0,9,
+    0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,2,
+    0,0,0,0,0,0,0,218,52,67,111,110,99,114,101,116,
+    101,32,105,109,112,108,101,109,101,110,116,97,116,105,111,110,
+    32,111,102,32,73,110,115,112,101,99,116,76,111,97,100,101,
+    114,46,103,101,116,95,115,111,117,114,99,101,46,218,23,83,
+    111,117,114,99,101,76,111,97,100,101,114,46,103,101,116,95,
+    115,111,117,114,99,101,114,69,1,0,0,218,8,103,101,116,
+    95,100,97,116,97,114,105,0,0,0,114,227,0,0,0,218,
+    39,115,111,117,114,99,101,32,110,111,116,32,97,118,97,105,
+    108,97,98,108,101,32,116,104,114,111,117,103,104,32,103,101,
+    116,95,100,97,116,97,40,41,114,229,0,0,0,114,52,1,
+    0,0,17,0,0,0,35,0,0,0,87,0,0,0,5,0,
+    0,0,46,0,0,0,76,0,0,0,80,0,0,0,7,0,
+    0,0,137,3,0,0,41,5,114,230,0,0,0,114,255,0,
+    0,0,114,90,0,0,0,114,60,1,0,0,218,3,101,120,
+    99,114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,
+    218,10,103,101,116,95,115,111,117,114,99,101,115,12,0,0,
+    0,2,0,0,2,15,2,18,1,11,1,41,2,6,14,49,
+    0,54,8,2,255,4,10,1,73,9,2,0,120,2,49,0,
+    54,8,3,254,4,10,2,73,9,2,0,57,3,80,55,0,
+    53,4,252,83,5,47,0,49,6,57,4,53,5,250,121,12,
+    122,6,57,13,4,7,1,122,7,57,8,71,13,1,1,57,
+    7,4,8,4,75,9,7,2,77,2,4,99,7,97,5,80,
+    5,0,99,5,53,8,248,57,8,4,9,3,71,9,1,0,
+    76,114,156,1,0,0,114,212,0,0,0,99,46,0,0,0,
+    3,0,32,0,3,0,0,0,3,0,0,0,4,0,0,0,
+    1,0,0,0,0,0,0,0,4,0,0,0,15,0,0,0,
+    8,0,0,0,5,0,0,0,0,0,0,0,1,0,0,0,
+    0,0,0,0,0,0,0,0,218,130,82,101,116,117,114,110,
+    32,116,104,101,32,99,111,100,101,32,111,98,106,101,99,116,
+    32,99,111,109,112,105,108,101,100,32,102,114,111,109,32,115,
+    111,117,114,99,101,46,10,10,32,32,32,32,32,32,32,32,
+    84,104,101,32,39,100,97,116,97,39,32,97,114,103,117,109,
+    101,110,116,32,99,97,110,32,98,101,32,97,110,121,32,111,
+    98,106,101,99,116,32,116,121,112,101,32,116,104,97,116,32,
+    99,111,109,112,105,108,101,40,41,32,115,117,112,112,111,114,
+    116,115,46,10,32,32,32,32,32,32,32,32,218,27,83,111,
+    117,114,99,101,76,111,97,100,101,114,46,115,111,117,114,99,
+    101,95,116,111,95,99,111,100,101,114,235,0,0,0,114,129,
+    1,0,0,218,7,99,111,109,112,105,108,101,114,130,1,0,
+    0,84,169,2,218,12,100,111,110,116,95,105,110,104,101,114,
+    105,116,114,170,0,0,0,8,0,0,0,3,0,0,0,147,
+    3,0,0,41,4,114,230,0,0,0,114,73,0,0,0,114,
+    90,0,0,0,218,9,95,111,112,116,105,109,105,122,101,114,
+    31,0,0,0,114,31,0,0,0,114,32,0,0,0,218,14,
+    115,111,117,114,99,101,95,116,111,95,99,111,100,101,115,8,
+    0,0,0,2,0,0,5,28,1,2,255,6,15,53,2,254,
+    57,4,52,4,3,253,2,4,57,10,53,4,251,57,11,4,
+    12,1,4,13,2,122,5,121,14,122,6,57,4,4,5,3,
+    122,7,57,6,71,11,4,2,76,114,163,1,0,0,99,63,
+    3,0,0,2,0,0,0,3,0,0,0,2,0,0,0,16,
+    0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,30,
+    0,0,0,52,0,0,0,57,0,0,0,0,0,0,0,0,
+    0,0,0,5,0,0,0,0,0,0,0,218,190,67,111,110,
+    99,114,101,116,101,32,105,109,112,108,101,109,101,110,116,97,
+    116,105,111,110,32,111,102,32,73,110,115,112,101,99,116,76,
+    111,97,100,101,114,46,103,101,116,95,99,111,100,101,46,10,
+    10,32,32,32,32,32,32,32,32,82,101,97,100,105,110,103,
+    32,111,102,32,98,121,116,101,99,111,100,101,32,114,101,113,
+    117,105,114,101,115,32,112,97,116,104,95,115,116,97,116,115,
+    32,116,111,32,98,101,32,105,109,112,108,101,109,101,110,116,
+    101,100,46,32,84,111,32,119,114,105,116,101,10,32,32,32,
+    32,32,32,32,32,98,121,116,101,99,111,100,101,44,32,115,
+    101,116,95,100,97,116,97,32,109,117,115,116,32,97,108,115,
+    111,32,98,101,32,105,109,112,108,101,109,101,110,116,101,100,
+    46,10,10,32,32,32,32,32,32,32,32,218,21,83,111,117,
+    114,99,101,76,111,97,100,101,114,46,103,101,116,95,99,111,
+    100,101,114,69,1,0,0,78,70,84,114,157,0,0,0,114,
+    168,0,0,0,114,143,1,0,0,114,105,0,0,0,114,64,
+    0,0,0,114,47,1,0,0,114,145,0,0,0,218,3,112,
+    111,112,114,4,0,0,0,114,235,0,0,0,114,8,1,0,
+    0,218,31,99,111,100,101,32,111,98,106,101,99,116,32,112,
+    114,101,102,101,116,99,104,101,100,32,102,111,114,32,123,33,
+    114,125,114,29,0,0,0,114,3,0,0,0,218,14,95,115,
+    110,97,112,115,104,111,116,95,99,111,100,101,218,3,103,101,
+    116,218,4,115,105,122,101,114,212,0,0,0,218,34,99,111,
+    100,101,32,111,98,106,101,99,116,32,102,114,111,109,32,115,
+    110,97,112,115,104,111,116,32,102,111,114,32,123,33,114,125,
+    114,153,1,0,0,114,226,0,0,0,114,90,0,0,0,114,
+    4,1,0,0,218,10,109,101,109,111,114,121,118,105,101,119,
+    186,114,10,1,0,0,78,78,114,76,0,0,0,218,21,99,
+    104,101,99,107,95,104,97,115,104,95,98,97,115,101,100,95,
+    112,121,99,115,218,5,110,101,118,101,114,218,6,97,108,119,
+    97,121,115,114,32,1,0,0,114,144,0,0,0,114,29,1,
+    0,0,114,21,1,0,0,114,227,0,0,0,114,12,1,0,
+    0,218,13,123,125,32,109,97,116,99,104,101,115,32,123,125,
+    114,34,1,0,0,169,3,114,226,0,0,0,114,215,0,0,
+    0,114,218,0,0,0,114,163,1,0,0,218,19,99,111,100,
+    101,32,111,98,106,101,99,116,32,102,114,111,109,32,123,125,
+    114,8,0,0,0,218,19,100,111,110,116,95,119,114,105,116,
+    101,95,98,121,116,101,99,111,100,101,114,49,1,0,0,114,
+    43,1,0,0,114,28,0,0,0,114,148,1,0,0,37,0,
+    0,0,54,0,0,0,72,0,0,0,16,0,0,0,72,0,
+    0,0,90,0,0,0,104,0,0,0,16,0,0,0,3,1,
+    0,0,21,1,0,0,35,1,0,0,16,0,0,0,67,1,
+    0,0,33,2,0,0,57,2,0,0,16,0,0,0,23,3,
+    0,0,46,3,0,0,60,3,0,0,16,0,0,0,155,3,
+    0,0,41,16,114,230,0,0,0,114,255,0,0,0,114,218,
+    0,0,0,114,26,1,0,0,114,60,1,0,0,114,32,1,
+    0,0,218,10,104,97,115,104,95,98,97,115,101,100,218,12,
+    99,104,101,99,107,95,115,111,117,114,99,101,114,215,0,0,
+    0,218,2,115,116,218,10,112,114,101,102,101,116,99,104,101,
+    100,218,11,99,111,100,101,95,111,98,106,101,99,116,114,73,
+    0,0,0,114,18,1,0,0,114,56,0,0,0,218,10,98,
+    121,116,101,115,95,100,97,116,97,114,31,0,0,0,114,31,
+    0,0,0,114,32,0,0,0,114,127,1,0,0,115,150,0,
+    0,0,2,0,0,7,15,1,4,1,4,1,4,1,4,1,
+    4,2,17,1,7,1,11,3,18,1,7,1,7,2,17,1,
+    20,1,25,1,19,2,5,1,13,1,18,255,8,2,8,1,
+    19,2,3,2,18,1,7,1,7,2,4,1,2,255,2,1,
+    2,255,5,2,2,254,2,2,2,254,11,5,20,1,22,1,
+    15,1,5,1,15,1,24,1,6,1,20,254,3,3,15,1,
+    7,1,3,255,11,4,25,3,11,3,4,253,16,7,17,1,
+    7,2,22,2,26,3,7,1,15,1,18,1,19,1,25,1,
+    5,255,3,2,5,1,7,1,16,1,23,2,11,1,12,255,
+    8,3,23,1,7,1,7,1,6,30,49,0,54,19,2,255,
+    4,21,1,73,20,2,0,121,2,122,3,121,3,122,3,121,
+    4,122,3,121,5,122,4,121,6,122,5,57,7,53,6,253,
+    57,19,4,20,2,71,20,1,0,57,8,80,21,0,53,7,
+    251,83,16,13,0,122,3,57,8,97,16,80,38,2,99,16,
+    49,0,54,19,8,250,4,21,2,73,20,2,0,57,9,80,
+    17,0,53,9,248,83,16,9,0,97,16,80,6,2,99,16,
+    53,10,246,121,19,51,11,25,9,57,20,71,20,1,0,57,
+    3,53,12,244,54,19,13,243,4,21,2,122,3,57,22,73,
+    20,3,0,121,10,51,3,33,10,17,81,17,0,1,51,14,
+    25,10,120,16,49,3,35,2,16,2,16,84,27,0,53,15,
+    241,54,19,16,240,122,17,57,21,4,22,2,73,20,3,0,
+    1,51,18,25,10,76,53,19,238,54,19,20,237,4,21,2,
+    4,22,3,49,9,54,26,21,236,122,22,121,28,122,23,57,
+    29,73,27,3,0,57,23,73,20,4,0,121,11,51,3,33,
+    11,17,84,25,0,53,15,241,54,19,16,235,122,24,57,21,
+    4,22,2,73,20,3,0,1,49,11,76,49,0,54,19,25,
+    234,4,21,8,73,20,2,0,57,12,80,17,0,53,9,248,
+    83,16,9,0,97,16,80,75,1,99,16,96,2,121,16,122,
+    26,120,17,49,1,62,16,17,2,17,122,27,120,17,49,8,
+    62,16,17,2,17,49,16,2,16,57,13,53,28,232,57,19,
+    4,20,12,4,21,1,4,22,13,71,20,3,0,57,14,53,
+    29,230,57,19,4,20,12,71,20,1,0,121,16,51,30,25,
+    16,2,16,121,15,51,18,30,14,121,16,51,14,35,3,16,
+    2,16,120,6,49,6,84,132,0,51,31,30,14,121,16,51,
+    14,35,3,16,2,16,57,7,53,19,238,57,16,52,16,32,
+    229,2,16,121,16,51,33,35,3,16,2,16,81,30,0,1,
+    49,7,82,24,0,1,53,19,238,57,16,52,16,32,228,2,
+    16,121,16,51,34,35,2,16,2,16,84,61,0,49,0,54,
+    19,25,227,4,21,2,73,20,2,0,57,4,53,19,238,54,
+    19,35,226,53,36,224,57,21,4,22,4,73,20,3,0,57,
+    5,53,37,222,57,19,4,20,12,4,21,5,4,22,1,4,
+    23,13,71,20,4,0,1,80,31,0,53,38,220,57,19,4,
+    20,12,4,21,3,51,22,25,9,57,22,4,23,1,4,24,
+    13,71,20,5,0,1,80,27,0,53,39,218,57,18,53,40,
+    216,57,19,93,18,2,83,16,9,0,97,16,80,53,0,99,
+    16,53,15,241,54,19,16,215,122,41,57,21,4,22,8,4,
+    23,2,73,20,4,0,1,53,42,213,57,23,4,24,15,4,
+    16,1,4,17,8,4,18,2,122,43,57,19,71,24,1,3,
+    76,51,3,33,4,84,18,0,49,0,54,19,25,212,4,21,
+    2,73,20,2,0,120,4,49,0,54,19,44,211,4,21,4,
+    4,22,2,73,20,3,0,57,11,53,15,241,54,19,16,210,
+    122,45,57,21,4,22,2,73,20,3,0,1,53,46,208,57,
+    16,52,16,47,207,2,16,16,81,18,0,1,51,3,33,8,
+    17,81,9,0,1,51,3,33,3,17,84,122,0,49,6,84,
+    49,0,51,3,33,5,84,19,0,53,19,238,54,19,35,206,
+    4,21,4,73,20,2,0,57,5,53,48,204,57,19,4,20,
+    11,4,21,5,4,22,7,71,20,3,0,57,12,80,34,0,
+    53,49,202,57,19,4,20,11,4,21,3,53,50,200,57,25,
+    4,26,4,71,26,1,0,57,22,71,20,3,0,120,12,49,
+    0,54,19,51,199,4,21,2,4,22,8,4,23,12,73,20,
+    4,0,1,80,17,0,53,7,251,83,16,9,0,97,16,80,
+    5,0,99,16,49,11,76,114,127,1,0,0,78,96,3,0,
+    0,41,8,114,114,1,0,0,114,140,1,0,0,114,143,1,
+    0,0,114,148,1,0,0,114,146,1,0,0,114,156,1,0,
+    0,114,163,1,0,0,114,127,1,0,0,114,31,0,0,0,
+    114,31,0,0,0,114,32,0,0,0,114,137,1,0,0,115,
+    16,0,0,0,2,0,9,2,4,8,4,14,4,10,4,7,
+    4,10,10,8,6,9,50,0,254,58,1,51,2,58,3,107,
+    4,58,5,107,6,58,7,107,8,58,9,107,10,58,11,107,
+    12,58,13,122,14,57,8,107,15,2,8,58,16,107,17,58,
+    18,51,19,76,114,137,1,0,0,99,99,0,0,0,0,0,
+    136,0,0,0,0,0,0,0,0,0,13,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,17,0,0,0,30,0,
+    0,0,4,0,0,0,1,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,114,241,0,0,0,114,240,0,0,0,
+    218,10,70,105,108,101,76,111,97,100,101,114,114,242,0,0,
+    0,218,103,66,97,115,101,32,102,105,108,101,32,108,111,97,
+    100,101,114,32,99,108,97,115,115,32,119,104,105,99,104,32,
+    105,109,112,108,101,109,101,110,116,115,32,116,104,101,32,108,
+    111,97,100,101,114,32,112,114,111,116,111,99,111,108,32,109,
+    101,116,104,111,100,115,32,116,104,97,116,10,32,32,32,32,
+    114,101,113,117,105,114,101,32,102,105,108,101,32,115,121,115,
+    116,101,109,32,117,115,97,103,101,46,114,1,0,0,0,99,
+    15,0,0,0,3,0,0,0,3,0,0,0,3,0,0,0,
+    3,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,
+    3,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,218,75,67,97,
+    99,104,101,32,116,104,101,32,109,111,100,117,108,101,32,110,
+    97,109,101,32,97,110,100,32,116,104,101,32,112,97,116,104,
+    32,116,111,32,116,104,101,32,102,105,108,101,32,102,111,117,
+    110,100,32,98,121,32,116,104,101,10,32,32,32,32,32,32,
+    32,32,102,105,110,100,101,114,46,218,19,70,105,108,101,76,
+    111,97,100,101,114,46,95,95,105,110,105,116,95,95,114,226,
+    0,0,0,114,90,0,0,0,78,0,4,0,0,41,3,114,
+    230,0,0,0,114,255,0,0,0,114,90,0,0,0,114,31,
+    0,0,0,114,31,0,0,0,114,32,0,0,0,114,119,1,
+    0,0,115,6,0,0,0,2,0,0,3,5,1,6,3,49,
+    1,59,0,2,49,2,59,0,3,51,4,76,114,119,1,0,
+    0,99,37,0,0,0,2,0,0,0,3,0,0,0,2,0,
+    0,0,2,0,0,0,0,0,0,0,0,0,0,0,2,0,
+    0,0,3,0,0,0,4,0,0,0,4,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,218,
+    17,70,105,108,101,76,111,97,100,101,114,46,95,95,101,113,
+    95,95,218,9,95,95,99,108,97,115,115,95,95,114,246,0,
+    0,0,6,4,0,0,41,2,114,230,0,0,0,218,5,111,
+    116,104,101,114,114,31,0,0,0,114,31,0,0,0,114,32,
+    0,0,0,218,6,95,95,101,113,95,95,115,8,0,0,0,
+    2,0,0,1,19,1,15,255,6,3,52,0,2,255,57,2,
+    52,1,2,254,35,2,2,2,2,81,19,0,1,52,0,3,
+    253,57,2,52,1,3,252,35,2,2,2,2,76,114,194,1,
+    0,0,99,39,0,0,0,1,0,0,0,3,0,0,0,1,
+    0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,
+    0,0,0,7,0,0,0,5,0,0,0,4,0,0,0,0,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,
-    218,32,83,111,117,114,99,101,70,105,108,101,76,111,97,100,
-    101,114,46,95,99,97,99,104,101,95,98,121,116,101,99,111,
-    100,101,114,220,0,0,0,114,145,1,0,0,169,1,218,5,
-    95,109,111,100,101,59,4,0,0,41,5,114,229,0,0,0,
-    114,217,0,0,0,114,214,0,0,0,114,73,0,0,0,114,
-    108,0,0,0,114,31,0,0,0,114,31,0,0,0,114,32,
-    0,0,0,114,147,1,0,0,115,6,0,0,0,2,0,0,
-    2,14,1,6,13,53,2,254,57,8,4,9,1,71,9,1,
-    0,57,4,52,0,3,253,57,10,4,11,2,4,12,3,4,
-    5,4,51,4,57,6,71,11,2,1,76,114,147,1,0,0,
-    114,121,0,0,0,99,45,1,0,0,3,0,32,0,3,0,
-    0,0,3,0,0,0,9,0,0,0,1,0,0,0,0,0,
-    0,0,4,0,0,0,20,0,0,0,17,0,0,0,23,0,
-    0,0,0,0,0,0,1,0,0,0,4,0,0,0,0,0,
-    0,0,218,27,87,114,105,116,101,32,98,121,116,101,115,32,
-    100,97,116,97,32,116,111,32,97,32,102,105,108,101,46,218,
-    25,83,111,117,114,99,101,70,105,108,101,76,111,97,100,101,
-    114,46,115,101,116,95,100,97,116,97,114,95,0,0,0,114,
-    84,0,0,0,114,114,0,0,0,218,8,114,101,118,101,114,
-    115,101,100,114,78,0,0,0,114,18,0,0,0,218,5,109,
-    107,100,105,114,218,15,70,105,108,101,69,120,105,115,116,115,
-    69,114,114,111,114,114,105,0,0,0,114,234,0,0,0,114,
-    7,1,0,0,218,27,99,111,117,108,100,32,110,111,116,32,
-    99,114,101,97,116,101,32,123,33,114,125,58,32,123,33,114,
-    125,78,114,123,0,0,0,218,12,99,114,101,97,116,101,100,
-    32,123,33,114,125,4,0,0,0,3,0,0,0,126,0,0,
-    0,144,0,0,0,209,0,0,0,10,0,0,0,167,0,0,
-    0,198,0,0,0,202,0,0,0,12,0,0,0,213,0,0,
-    0,254,0,0,0,42,1,0,0,9,0,0,0,9,1,0,
-    0,31,1,0,0,35,1,0,0,11,0,0,0,64,4,0,
-    0,41,9,114,229,0,0,0,114,90,0,0,0,114,73,0,
-    0,0,114,225,1,0,0,218,6,112,97,114,101,110,116,114,
-    186,0,0,0,114,88,0,0,0,114,93,0,0,0,114,154,
-    1,0,0,114,31,0,0,0,114,31,0,0,0,114,32,0,
-    0,0,114,145,1,0,0,115,40,0,0,0,2,0,0,2,
-    22,1,5,2,3,1,22,1,14,254,22,4,19,1,17,2,
-    18,1,7,2,5,1,11,3,22,2,20,244,4,14,19,1,
-    22,1,11,2,6,20,53,2,254,57,12,4,13,1,71,13,
-    1,0,106,9,2,0,5,4,10,5,5,9,94,9,0,57,
-    6,80,39,0,53,2,254,57,12,4,13,4,71,13,1,0,
-    106,9,2,0,5,4,10,5,7,9,49,6,54,12,3,253,
-    4,14,7,73,13,2,0,1,49,4,81,17,0,1,53,4,
-    251,57,12,4,13,4,71,13,1,0,16,85,201,255,53,5,
-    249,57,12,4,13,6,71,13,1,0,86,9,80,105,0,57,
-    7,53,6,247,57,13,4,14,4,4,15,7,71,14,2,0,
-    57,4,53,7,245,54,13,8,244,4,15,4,73,14,2,0,
-    1,80,68,0,53,9,242,83,10,9,0,97,10,80,56,0,
-    53,10,240,83,10,48,0,49,11,57,8,53,11,238,54,15,
-    12,237,51,13,57,17,4,18,4,4,19,8,73,16,4,0,
-    1,51,14,2,8,97,10,2,9,76,2,8,99,12,97,10,
-    80,5,0,99,10,88,9,154,255,53,15,235,57,12,4,13,
-    1,4,14,2,4,15,3,71,13,3,0,1,53,11,238,54,
-    12,12,234,51,16,57,14,4,15,1,73,13,3,0,1,80,
-    47,0,53,10,240,83,9,39,0,49,10,57,8,53,11,238,
-    54,14,12,233,51,13,57,16,4,17,1,4,18,8,73,15,
-    4,0,1,2,8,99,11,97,9,80,5,0,99,9,51,14,
-    76,114,145,1,0,0,78,50,4,0,0,41,4,114,113,1,
-    0,0,114,142,1,0,0,114,147,1,0,0,114,145,1,0,
-    0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,
-    114,217,1,0,0,115,12,0,0,0,2,0,9,2,2,254,
-    2,4,4,5,4,5,6,5,50,0,254,58,1,51,2,58,
-    3,51,4,58,5,107,6,58,7,107,8,58,9,51,10,57,
-    4,107,11,2,4,58,12,51,13,76,114,217,1,0,0,99,
-    26,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,
-    3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    3,0,0,0,11,0,0,0,2,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,114,240,0,0,
-    0,114,239,0,0,0,218,20,83,111,117,114,99,101,108,101,
-    115,115,70,105,108,101,76,111,97,100,101,114,114,241,0,0,
-    0,218,45,76,111,97,100,101,114,32,119,104,105,99,104,32,
-    104,97,110,100,108,101,115,32,115,111,117,114,99,101,108,101,
-    115,115,32,102,105,108,101,32,105,109,112,111,114,116,115,46,
-    114,1,0,0,0,99,125,0,0,0,2,0,0,0,3,0,
-    0,0,2,0,0,0,5,0,0,0,0,0,0,0,0,0,
-    0,0,2,0,0,0,17,0,0,0,11,0,0,0,8,0,
+    218,19,70,105,108,101,76,111,97,100,101,114,46,95,95,104,
+    97,115,104,95,95,218,4,104,97,115,104,114,226,0,0,0,
+    114,90,0,0,0,10,4,0,0,41,1,114,230,0,0,0,
+    114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,218,
+    8,95,95,104,97,115,104,95,95,115,4,0,0,0,2,0,
+    0,1,6,7,53,2,254,57,4,52,0,3,253,57,5,71,
+    5,1,0,57,1,53,2,254,57,5,52,0,4,252,57,6,
+    71,6,1,0,31,1,2,1,76,114,197,1,0,0,114,224,
+    0,0,0,99,31,0,0,0,2,0,16,0,3,0,0,0,
+    2,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,
+    2,0,0,0,9,0,0,0,5,0,0,0,5,0,0,0,
+    0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+    218,100,76,111,97,100,32,97,32,109,111,100,117,108,101,32,
+    102,114,111,109,32,97,32,102,105,108,101,46,10,10,32,32,
+    32,32,32,32,32,32,84,104,105,115,32,109,101,116,104,111,
+    100,32,105,115,32,100,101,112,114,101,99,97,116,101,100,46,
+    32,32,85,115,101,32,101,120,101,99,95,109,111,100,117,108,
+    101,40,41,32,105,110,115,116,101,97,100,46,10,10,32,32,
+    32,32,32,32,32,32,218,22,70,105,108,101,76,111,97,100,
+    101,114,46,108,111,97,100,95,109,111,100,117,108,101,218,5,
+    115,117,112,101,114,114,187,1,0,0,114,136,1,0,0,12,
+    0,0,0,2,0,0,0,13,4,0,0,41,3,114,230,0,
+    0,0,114,255,0,0,0,114,192,1,0,0,41,1,114,192,
+    1,0,0,114,31,0,0,0,114,32,0,0,0,114,136,1,
+    0,0,115,4,0,0,0,2,0,0,10,6,9,53,2,254,
+    57,6,53,3,252,57,7,4,8,0,71,7,2,0,54,6,
+    4,251,4,8,1,73,7,2,0,76,114,136,1,0,0,99,
+    7,0,0,0,2,0,0,0,3,0,0,0,2,0,0,0,
+    2,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+    2,0,0,0,3,0,0,0,1,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,218,58,82,101,
+    116,117,114,110,32,116,104,101,32,112,97,116,104,32,116,111,
+    32,116,104,101,32,115,111,117,114,99,101,32,102,105,108,101,
+    32,97,115,32,102,111,117,110,100,32,98,121,32,116,104,101,
+    32,102,105,110,100,101,114,46,218,23,70,105,108,101,76,111,
+    97,100,101,114,46,103,101,116,95,102,105,108,101,110,97,109,
+    101,114,90,0,0,0,25,4,0,0,41,2,114,230,0,0,
+    0,114,255,0,0,0,114,31,0,0,0,114,31,0,0,0,
+    114,32,0,0,0,114,69,1,0,0,115,4,0,0,0,2,
+    0,0,3,6,2,52,0,2,255,76,114,69,1,0,0,99,
+    119,0,0,0,2,0,0,0,3,0,0,0,2,0,0,0,
+    3,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+    13,0,0,0,12,0,0,0,14,0,0,0,0,0,0,0,
+    0,0,0,0,2,0,0,0,0,0,0,0,218,39,82,101,
+    116,117,114,110,32,116,104,101,32,100,97,116,97,32,102,114,
+    111,109,32,112,97,116,104,32,97,115,32,114,97,119,32,98,
+    121,116,101,115,46,218,19,70,105,108,101,76,111,97,100,101,
+    114,46,103,101,116,95,100,97,116,97,114,36,1,0,0,114,
+    137,1,0,0,218,19,69,120,116,101,110,115,105,111,110,70,
+    105,108,101,76,111,97,100,101,114,114,6,0,0,0,218,9,
+    111,112,101,110,95,99,111,100,101,114,171,0,0,0,218,4,
+    114,101,97,100,114,131,0,0,0,250,1,114,78,59,0,0,
+    0,74,0,0,0,76,0,0,0,5,0,0,0,99,0,0,
+    0,114,0,0,0,116,0,0,0,5,0,0,0,30,4,0,
+    0,41,3,114,230,0,0,0,114,90,0,0,0,114,137,0,
+    0,0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,
+    0,114,153,1,0,0,115,12,0,0,0,2,0,0,2,30,
+    1,29,1,18,2,22,1,6,13,53,2,254,57,6,4,7,
+    0,53,3,252,57,8,53,4,250,57,9,93,8,2,57,8,
+    71,7,2,0,84,50,0,53,5,248,54,6,6,247,53,7,
+    245,57,11,4,12,1,71,12,1,0,57,8,73,7,2,0,
+    108,3,120,2,49,2,54,8,8,244,73,9,1,0,109,3,
+    76,109,3,80,40,0,53,5,248,54,6,9,243,4,8,1,
+    122,10,57,9,73,7,3,0,108,3,120,2,49,2,54,8,
+    8,242,73,9,1,0,109,3,76,109,3,51,11,76,114,153,
+    1,0,0,99,24,0,0,0,2,0,0,0,3,0,0,0,
+    2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+    2,0,0,0,8,0,0,0,3,0,0,0,1,0,0,0,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,78,218,29,83,111,117,114,99,101,108,101,115,115,70,
-    105,108,101,76,111,97,100,101,114,46,103,101,116,95,99,111,
-    100,101,114,68,1,0,0,114,152,1,0,0,114,225,0,0,
-    0,114,90,0,0,0,114,3,1,0,0,114,33,1,0,0,
-    114,165,1,0,0,114,166,1,0,0,169,2,114,225,0,0,
-    0,114,214,0,0,0,99,4,0,0,41,5,114,229,0,0,
-    0,114,254,0,0,0,114,90,0,0,0,114,73,0,0,0,
-    114,17,1,0,0,114,31,0,0,0,114,31,0,0,0,114,
-    32,0,0,0,114,126,1,0,0,115,32,0,0,0,2,0,
-    0,1,15,1,15,3,4,1,2,255,2,1,2,255,5,2,
-    2,254,2,2,2,254,11,4,19,1,5,1,20,255,6,17,
-    49,0,54,8,2,255,4,10,1,73,9,2,0,57,2,49,
-    0,54,8,3,254,4,10,2,73,9,2,0,57,3,96,2,
-    57,5,51,4,57,6,49,1,62,5,6,2,6,51,5,57,
-    6,49,2,62,5,6,2,6,49,5,2,5,57,4,53,6,
-    252,57,8,4,9,3,4,10,1,4,11,4,71,9,3,0,
-    1,53,7,250,57,11,53,8,248,57,15,4,16,3,71,16,
-    1,0,57,12,51,9,25,12,2,12,57,12,4,5,1,4,
-    6,2,51,10,57,7,71,12,1,2,76,114,126,1,0,0,
-    99,5,0,0,0,2,0,0,0,3,0,0,0,2,0,0,
-    0,2,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+    78,218,30,70,105,108,101,76,111,97,100,101,114,46,103,101,
+    116,95,114,101,115,111,117,114,99,101,95,114,101,97,100,101,
+    114,114,75,1,0,0,41,4,0,0,41,2,114,230,0,0,
+    0,114,131,1,0,0,114,31,0,0,0,114,31,0,0,0,
+    114,32,0,0,0,218,19,103,101,116,95,114,101,115,111,117,
+    114,99,101,95,114,101,97,100,101,114,115,8,0,0,0,2,
+    0,0,2,16,1,3,1,6,8,49,0,54,5,2,255,4,
+    7,1,73,6,2,0,84,6,0,49,0,76,51,0,76,114,
+    210,1,0,0,99,60,0,0,0,2,0,0,0,3,0,0,
     0,2,0,0,0,3,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,218,39,82,
-    101,116,117,114,110,32,78,111,110,101,32,97,115,32,116,104,
-    101,114,101,32,105,115,32,110,111,32,115,111,117,114,99,101,
-    32,99,111,100,101,46,218,31,83,111,117,114,99,101,108,101,
-    115,115,70,105,108,101,76,111,97,100,101,114,46,103,101,116,
-    95,115,111,117,114,99,101,78,115,4,0,0,41,2,114,229,
-    0,0,0,114,254,0,0,0,114,31,0,0,0,114,31,0,
-    0,0,114,32,0,0,0,114,155,1,0,0,115,4,0,0,
-    0,2,0,0,2,6,2,51,2,76,114,155,1,0,0,78,
-    95,4,0,0,41,3,114,113,1,0,0,114,126,1,0,0,
-    114,155,1,0,0,114,31,0,0,0,114,31,0,0,0,114,
-    32,0,0,0,114,234,1,0,0,115,10,0,0,0,2,0,
-    9,2,2,254,2,4,4,16,6,3,50,0,254,58,1,51,
-    2,58,3,51,4,58,5,107,6,58,7,107,8,58,9,51,
-    10,76,114,234,1,0,0,218,18,69,88,84,69,78,83,73,
-    79,78,95,83,85,70,70,73,88,69,83,99,65,0,0,0,
-    0,0,128,0,0,0,0,0,0,0,0,0,10,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,
-    26,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,114,240,0,0,0,114,239,0,
-    0,0,114,198,1,0,0,114,241,0,0,0,218,93,76,111,
-    97,100,101,114,32,102,111,114,32,101,120,116,101,110,115,105,
-    111,110,32,109,111,100,117,108,101,115,46,10,10,32,32,32,
-    32,84,104,101,32,99,111,110,115,116,114,117,99,116,111,114,
-    32,105,115,32,100,101,115,105,103,110,101,100,32,116,111,32,
-    119,111,114,107,32,119,105,116,104,32,70,105,108,101,70,105,
-    110,100,101,114,46,10,10,32,32,32,32,114,1,0,0,0,
-    99,75,0,0,0,3,0,0,0,3,0,0,0,3,0,0,
-    0,3,0,0,0,0,0,0,0,0,0,0,0,3,0,0,
-    0,12,0,0,0,9,0,0,0,9,0,0,0,0,0,0,
-    0,0,0,0,0,1,0,0,0,0,0,0,0,78,218,28,
-    69,120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,
-    100,101,114,46,95,95,105,110,105,116,95,95,114,225,0,0,
-    0,114,118,0,0,0,114,78,0,0,0,114,18,0,0,0,
-    114,115,0,0,0,114,105,0,0,0,114,90,0,0,0,23,
-    0,0,0,53,0,0,0,67,0,0,0,3,0,0,0,132,
-    4,0,0,41,3,114,229,0,0,0,114,225,0,0,0,114,
+    0,2,0,0,0,12,0,0,0,9,0,0,0,8,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,78,218,24,70,105,108,101,76,111,97,100,101,114,46,111,
+    112,101,110,95,114,101,115,111,117,114,99,101,114,78,0,0,
+    0,114,95,0,0,0,114,90,0,0,0,114,4,0,0,0,
+    114,6,0,0,0,114,131,0,0,0,114,208,1,0,0,47,
+    4,0,0,41,3,114,230,0,0,0,218,8,114,101,115,111,
+    117,114,99,101,114,90,0,0,0,114,31,0,0,0,114,31,
+    0,0,0,114,32,0,0,0,218,13,111,112,101,110,95,114,
+    101,115,111,117,114,99,101,115,6,0,0,0,2,0,0,1,
+    39,1,6,12,53,2,254,57,6,53,3,252,57,10,52,0,
+    4,251,57,11,71,11,1,0,121,7,51,5,25,7,2,7,
+    57,7,4,8,1,71,7,2,0,57,2,53,6,249,54,6,
+    7,248,4,8,2,122,8,57,9,73,7,3,0,76,114,213,
+    1,0,0,99,65,0,0,0,2,0,0,0,3,0,0,0,
+    2,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,
+    2,0,0,0,12,0,0,0,8,0,0,0,8,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    78,218,24,70,105,108,101,76,111,97,100,101,114,46,114,101,
+    115,111,117,114,99,101,95,112,97,116,104,218,11,105,115,95,
+    114,101,115,111,117,114,99,101,218,17,70,105,108,101,78,111,
+    116,70,111,117,110,100,69,114,114,111,114,114,78,0,0,0,
+    114,95,0,0,0,114,90,0,0,0,114,4,0,0,0,51,
+    4,0,0,41,3,114,230,0,0,0,114,212,1,0,0,114,
     90,0,0,0,114,31,0,0,0,114,31,0,0,0,114,32,
-    0,0,0,114,118,1,0,0,115,14,0,0,0,2,0,0,
-    1,5,1,16,2,30,1,7,1,7,1,6,12,49,1,59,
-    0,2,53,3,254,57,6,4,7,2,71,7,1,0,16,84,
-    47,0,53,4,252,57,6,53,5,250,54,10,6,249,73,11,
-    1,0,57,7,4,8,2,71,7,2,0,57,2,80,17,0,
-    53,7,247,83,3,9,0,97,3,80,5,0,99,3,49,2,
-    59,0,8,51,0,76,114,118,1,0,0,99,37,0,0,0,
-    2,0,0,0,3,0,0,0,2,0,0,0,2,0,0,0,
-    0,0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,
-    4,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,78,218,26,69,120,116,101,110,
-    115,105,111,110,70,105,108,101,76,111,97,100,101,114,46,95,
-    95,101,113,95,95,114,185,1,0,0,114,245,0,0,0,141,
-    4,0,0,41,2,114,229,0,0,0,114,186,1,0,0,114,
-    31,0,0,0,114,31,0,0,0,114,32,0,0,0,114,187,
-    1,0,0,115,8,0,0,0,2,0,0,1,19,1,15,255,
-    6,3,52,0,2,255,57,2,52,1,2,254,35,2,2,2,
-    2,81,19,0,1,52,0,3,253,57,2,52,1,3,252,35,
-    2,2,2,2,76,114,187,1,0,0,99,39,0,0,0,1,
-    0,0,0,3,0,0,0,1,0,0,0,1,0,0,0,0,
-    0,0,0,0,0,0,0,1,0,0,0,7,0,0,0,5,
-    0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,78,218,28,69,120,116,101,110,115,
-    105,111,110,70,105,108,101,76,111,97,100,101,114,46,95,95,
-    104,97,115,104,95,95,114,189,1,0,0,114,225,0,0,0,
-    114,90,0,0,0,145,4,0,0,41,1,114,229,0,0,0,
-    114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,114,
-    190,1,0,0,115,4,0,0,0,2,0,0,1,6,7,53,
-    2,254,57,4,52,0,3,253,57,5,71,5,1,0,57,1,
-    53,2,254,57,5,52,0,4,252,57,6,71,6,1,0,31,
-    1,2,1,76,114,190,1,0,0,99,62,0,0,0,2,0,
-    0,0,3,0,0,0,2,0,0,0,3,0,0,0,0,0,
-    0,0,0,0,0,0,2,0,0,0,11,0,0,0,10,0,
-    0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,218,38,67,114,101,97,116,101,32,97,
-    110,32,117,110,105,116,105,97,108,105,122,101,100,32,101,120,
-    116,101,110,115,105,111,110,32,109,111,100,117,108,101,218,33,
-    69,120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,
-    100,101,114,46,99,114,101,97,116,101,95,109,111,100,117,108,
-    101,114,234,0,0,0,114,128,1,0,0,114,3,0,0,0,
-    218,14,99,114,101,97,116,101,95,100,121,110,97,109,105,99,
-    114,7,1,0,0,218,38,101,120,116,101,110,115,105,111,110,
-    32,109,111,100,117,108,101,32,123,33,114,125,32,108,111,97,
-    100,101,100,32,102,114,111,109,32,123,33,114,125,114,225,0,
-    0,0,114,90,0,0,0,148,4,0,0,41,3,114,229,0,
-    0,0,114,77,1,0,0,114,130,1,0,0,114,31,0,0,
-    0,114,31,0,0,0,114,32,0,0,0,114,123,1,0,0,
-    115,20,0,0,0,2,0,0,2,7,1,11,255,11,2,11,
-    1,4,255,2,1,4,255,7,2,6,11,53,2,254,54,6,
-    3,253,53,4,251,57,8,52,8,5,250,2,8,57,8,4,
-    9,1,73,7,3,0,57,2,53,2,254,54,6,6,249,51,
-    7,57,8,52,1,8,248,57,9,52,0,9,247,57,10,73,
-    7,4,0,1,49,2,76,114,123,1,0,0,99,61,0,0,
-    0,2,0,0,0,3,0,0,0,2,0,0,0,2,0,0,
-    0,0,0,0,0,0,0,0,0,2,0,0,0,10,0,0,
-    0,11,0,0,0,9,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,218,30,73,110,105,116,105,
-    97,108,105,122,101,32,97,110,32,101,120,116,101,110,115,105,
-    111,110,32,109,111,100,117,108,101,218,31,69,120,116,101,110,
-    115,105,111,110,70,105,108,101,76,111,97,100,101,114,46,101,
-    120,101,99,95,109,111,100,117,108,101,114,234,0,0,0,114,
-    128,1,0,0,114,3,0,0,0,218,12,101,120,101,99,95,
-    100,121,110,97,109,105,99,114,7,1,0,0,218,40,101,120,
-    116,101,110,115,105,111,110,32,109,111,100,117,108,101,32,123,
-    33,114,125,32,101,120,101,99,117,116,101,100,32,102,114,111,
-    109,32,123,33,114,125,114,225,0,0,0,114,90,0,0,0,
-    78,156,4,0,0,41,2,114,229,0,0,0,114,130,1,0,
+    0,0,0,218,13,114,101,115,111,117,114,99,101,95,112,97,
+    116,104,115,10,0,0,0,2,0,0,1,17,1,4,1,39,
+    1,6,12,49,0,54,6,2,255,4,8,1,73,7,2,0,
+    16,84,7,0,53,3,253,77,53,4,251,57,6,53,5,249,
+    57,10,52,0,6,248,57,11,71,11,1,0,121,7,51,7,
+    25,7,2,7,57,7,4,8,1,71,7,2,0,120,2,49,
+    2,76,114,217,1,0,0,99,71,0,0,0,2,0,0,0,
+    3,0,0,0,2,0,0,0,3,0,0,0,0,0,0,0,
+    0,0,0,0,2,0,0,0,12,0,0,0,9,0,0,0,
+    9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,78,218,22,70,105,108,101,76,111,97,100,101,
+    114,46,105,115,95,114,101,115,111,117,114,99,101,114,33,0,
+    0,0,70,114,78,0,0,0,114,95,0,0,0,114,90,0,
+    0,0,114,4,0,0,0,114,111,0,0,0,57,4,0,0,
+    41,3,114,230,0,0,0,114,226,0,0,0,114,90,0,0,
     0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,
-    114,131,1,0,0,115,14,0,0,0,2,0,0,2,28,1,
-    11,1,4,255,2,1,4,255,6,10,53,2,254,54,5,3,
-    253,53,4,251,57,7,52,7,5,250,2,7,57,7,4,8,
-    1,73,6,3,0,1,53,2,254,54,5,6,249,51,7,57,
-    7,52,0,8,248,57,8,52,0,9,247,57,9,73,6,4,
-    0,1,51,10,76,114,131,1,0,0,99,52,0,0,0,2,
-    0,8,0,3,0,0,0,2,0,0,0,3,0,0,0,0,
-    0,0,0,0,0,0,0,2,0,0,0,12,0,0,0,8,
-    0,0,0,7,0,0,0,1,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,218,49,82,101,116,117,114,110,32,
-    84,114,117,101,32,105,102,32,116,104,101,32,101,120,116,101,
-    110,115,105,111,110,32,109,111,100,117,108,101,32,105,115,32,
-    97,32,112,97,99,107,97,103,101,46,218,30,69,120,116,101,
-    110,115,105,111,110,70,105,108,101,76,111,97,100,101,114,46,
-    105,115,95,112,97,99,107,97,103,101,114,95,0,0,0,114,
-    90,0,0,0,114,29,0,0,0,218,3,97,110,121,99,35,
-    0,0,0,1,0,16,1,51,0,0,0,1,0,0,0,3,
-    0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,5,
-    0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,1,
-    0,0,0,0,0,0,0,0,0,0,0,78,218,49,69,120,
-    116,101,110,115,105,111,110,70,105,108,101,76,111,97,100,101,
-    114,46,105,115,95,112,97,99,107,97,103,101,46,60,108,111,
-    99,97,108,115,62,46,60,103,101,110,101,120,112,114,62,114,
-    118,1,0,0,2,0,0,0,2,0,0,0,165,4,0,0,
-    41,3,122,2,46,48,218,6,115,117,102,102,105,120,218,9,
-    102,105,108,101,95,110,97,109,101,41,1,114,2,2,0,0,
-    114,31,0,0,0,114,32,0,0,0,114,27,0,0,0,115,
-    2,0,0,0,2,0,6,5,80,26,0,57,1,55,2,57,
-    3,51,2,57,4,49,1,23,4,2,4,35,2,3,2,3,
-    78,1,88,0,233,255,51,0,76,114,240,1,0,0,2,0,
-    0,0,162,4,0,0,41,3,114,229,0,0,0,114,254,0,
-    0,0,114,2,2,0,0,114,31,0,0,0,41,1,114,2,
-    2,0,0,114,32,0,0,0,114,74,1,0,0,115,10,0,
-    0,0,2,0,0,2,25,1,9,1,3,255,6,12,53,2,
-    254,57,6,52,0,3,253,57,7,71,7,1,0,57,3,51,
-    4,25,3,2,3,64,2,53,5,251,57,6,107,6,57,10,
-    53,7,249,86,11,71,11,1,0,57,7,71,7,1,0,76,
-    114,74,1,0,0,99,5,0,0,0,2,0,0,0,3,0,
+    114,215,1,0,0,115,10,0,0,0,2,0,0,1,14,1,
+    3,1,39,1,6,12,53,2,254,120,3,49,1,34,3,2,
+    3,84,6,0,51,3,76,53,4,252,57,6,53,5,250,57,
+    10,52,0,6,249,57,11,71,11,1,0,121,7,51,7,25,
+    7,2,7,57,7,4,8,1,71,7,2,0,57,2,53,8,
+    247,57,6,4,7,2,71,7,1,0,76,114,215,1,0,0,
+    99,50,0,0,0,1,0,0,0,3,0,0,0,1,0,0,
+    0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+    0,15,0,0,0,8,0,0,0,8,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,78,218,19,
+    70,105,108,101,76,111,97,100,101,114,46,99,111,110,116,101,
+    110,116,115,218,4,105,116,101,114,114,18,0,0,0,218,7,
+    108,105,115,116,100,105,114,114,95,0,0,0,114,90,0,0,
+    0,114,4,0,0,0,63,4,0,0,41,1,114,230,0,0,
+    0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,
+    218,8,99,111,110,116,101,110,116,115,115,4,0,0,0,2,
+    0,0,1,6,15,53,2,254,57,4,53,3,252,54,8,4,
+    251,53,5,249,57,13,52,0,6,248,57,14,71,14,1,0,
+    121,10,51,7,25,10,2,10,57,10,73,9,2,0,57,5,
+    71,5,1,0,76,114,222,1,0,0,218,13,95,95,99,108,
+    97,115,115,99,101,108,108,95,95,12,0,0,0,251,3,0,
+    0,41,13,114,114,1,0,0,114,119,1,0,0,114,194,1,
+    0,0,114,197,1,0,0,114,136,1,0,0,114,69,1,0,
+    0,114,153,1,0,0,114,210,1,0,0,114,213,1,0,0,
+    114,217,1,0,0,114,215,1,0,0,114,222,1,0,0,114,
+    192,1,0,0,114,31,0,0,0,41,1,114,192,1,0,0,
+    114,32,0,0,0,114,187,1,0,0,115,34,0,0,0,2,
+    0,9,2,2,254,2,5,4,6,4,4,4,3,5,1,10,
+    11,5,1,10,4,4,11,5,1,10,5,4,4,4,6,4,
+    6,6,17,50,0,254,58,1,51,2,58,3,51,4,58,5,
+    107,6,58,7,107,8,58,9,107,10,58,11,50,12,252,57,
+    16,107,13,57,17,71,17,1,0,58,14,50,12,252,57,16,
+    107,15,57,17,71,17,1,0,58,16,107,17,58,18,50,12,
+    252,57,16,107,19,57,17,71,17,1,0,58,20,107,21,58,
+    22,107,23,58,24,107,25,58,26,107,27,58,28,49,12,58,
+    29,49,12,76,114,187,1,0,0,99,36,0,0,0,0,0,
+    128,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,5,0,0,0,14,0,
+    0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,114,241,0,0,0,114,240,0,0,0,
+    218,16,83,111,117,114,99,101,70,105,108,101,76,111,97,100,
+    101,114,114,242,0,0,0,218,62,67,111,110,99,114,101,116,
+    101,32,105,109,112,108,101,109,101,110,116,97,116,105,111,110,
+    32,111,102,32,83,111,117,114,99,101,76,111,97,100,101,114,
+    32,117,115,105,110,103,32,116,104,101,32,102,105,108,101,32,
+    115,121,115,116,101,109,46,114,1,0,0,0,99,51,0,0,
+    0,2,0,0,0,3,0,0,0,2,0,0,0,3,0,0,
+    0,0,0,0,0,0,0,0,0,2,0,0,0,8,0,0,
+    0,7,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,218,33,82,101,116,117,114,
+    110,32,116,104,101,32,109,101,116,97,100,97,116,97,32,102,
+    111,114,32,116,104,101,32,112,97,116,104,46,218,27,83,111,
+    117,114,99,101,70,105,108,101,76,111,97,100,101,114,46,112,
+    97,116,104,95,115,116,97,116,115,114,101,0,0,0,114,47,
+    1,0,0,218,8,115,116,95,109,116,105,109,101,114,170,1,
+    0,0,218,7,115,116,95,115,105,122,101,71,4,0,0,41,
+    3,114,230,0,0,0,114,90,0,0,0,114,183,1,0,0,
+    114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,114,
+    143,1,0,0,115,6,0,0,0,2,0,0,2,14,1,6,
+    8,53,2,254,57,6,4,7,1,71,7,1,0,57,2,96,
+    2,121,3,122,3,57,4,52,2,4,253,62,3,4,2,4,
+    122,5,57,4,52,2,6,252,62,3,4,2,4,49,3,2,
+    3,76,114,143,1,0,0,99,40,0,0,0,4,0,0,0,
+    3,0,0,0,4,0,0,0,5,0,0,0,0,0,0,0,
+    0,0,0,0,4,0,0,0,13,0,0,0,5,0,0,0,
+    3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,78,218,32,83,111,117,114,99,101,70,105,108,
+    101,76,111,97,100,101,114,46,95,99,97,99,104,101,95,98,
+    121,116,101,99,111,100,101,114,221,0,0,0,114,146,1,0,
+    0,169,1,218,5,95,109,111,100,101,76,4,0,0,41,5,
+    114,230,0,0,0,114,218,0,0,0,114,215,0,0,0,114,
+    73,0,0,0,114,108,0,0,0,114,31,0,0,0,114,31,
+    0,0,0,114,32,0,0,0,114,148,1,0,0,115,6,0,
+    0,0,2,0,0,2,14,1,6,13,53,2,254,57,8,4,
+    9,1,71,9,1,0,57,4,52,0,3,253,57,10,4,11,
+    2,4,12,3,4,5,4,122,4,57,6,71,11,2,1,76,
+    114,148,1,0,0,114,121,0,0,0,99,45,1,0,0,3,
+    0,32,0,3,0,0,0,3,0,0,0,9,0,0,0,1,
+    0,0,0,0,0,0,0,4,0,0,0,20,0,0,0,17,
+    0,0,0,23,0,0,0,0,0,0,0,1,0,0,0,4,
+    0,0,0,0,0,0,0,218,27,87,114,105,116,101,32,98,
+    121,116,101,115,32,100,97,116,97,32,116,111,32,97,32,102,
+    105,108,101,46,218,25,83,111,117,114,99,101,70,105,108,101,
+    76,111,97,100,101,114,46,115,101,116,95,100,97,116,97,114,
+    95,0,0,0,114,84,0,0,0,114,114,0,0,0,218,8,
+    114,101,118,101,114,115,101,100,114,78,0,0,0,114,18,0,
+    0,0,218,5,109,107,100,105,114,218,15,70,105,108,101,69,
+    120,105,115,116,115,69,114,114,111,114,114,105,0,0,0,114,
+    235,0,0,0,114,8,1,0,0,218,27,99,111,117,108,100,
+    32,110,111,116,32,99,114,101,97,116,101,32,123,33,114,125,
+    58,32,123,33,114,125,78,114,123,0,0,0,218,12,99,114,
+    101,97,116,101,100,32,123,33,114,125,4,0,0,0,3,0,
+    0,0,126,0,0,0,144,0,0,0,209,0,0,0,10,0,
+    0,0,167,0,0,0,198,0,0,0,202,0,0,0,12,0,
+    0,0,213,0,0,0,254,0,0,0,42,1,0,0,9,0,
+    0,0,9,1,0,0,31,1,0,0,35,1,0,0,11,0,
+    0,0,81,4,0,0,41,9,114,230,0,0,0,114,90,0,
+    0,0,114,73,0,0,0,114,232,1,0,0,218,6,112,97,
+    114,101,110,116,114,187,0,0,0,114,88,0,0,0,114,93,
+    0,0,0,114,155,1,0,0,114,31,0,0,0,114,31,0,
+    0,0,114,32,0,0,0,114,146,1,0,0,115,40,0,0,
+    0,2,0,0,2,22,1,5,2,3,1,22,1,14,254,22,
+    4,19,1,17,2,18,1,7,2,5,1,11,3,22,2,20,
+    244,4,14,19,1,22,1,11,2,6,20,53,2,254,57,12,
+    4,13,1,71,13,1,0,106,9,2,0,5,4,10,5,5,
+    9,94,9,0,57,6,80,39,0,53,2,254,57,12,4,13,
+    4,71,13,1,0,106,9,2,0,5,4,10,5,7,9,49,
+    6,54,12,3,253,4,14,7,73,13,2,0,1,49,4,81,
+    17,0,1,53,4,251,57,12,4,13,4,71,13,1,0,16,
+    85,201,255,53,5,249,57,12,4,13,6,71,13,1,0,86,
+    9,80,105,0,57,7,53,6,247,57,13,4,14,4,4,15,
+    7,71,14,2,0,57,4,53,7,245,54,13,8,244,4,15,
+    4,73,14,2,0,1,80,68,0,53,9,242,83,10,9,0,
+    97,10,80,56,0,53,10,240,83,10,48,0,49,11,57,8,
+    53,11,238,54,15,12,237,122,13,57,17,4,18,4,4,19,
+    8,73,16,4,0,1,51,14,2,8,97,10,2,9,76,2,
+    8,99,12,97,10,80,5,0,99,10,88,9,154,255,53,15,
+    235,57,12,4,13,1,4,14,2,4,15,3,71,13,3,0,
+    1,53,11,238,54,12,12,234,122,16,57,14,4,15,1,73,
+    13,3,0,1,80,47,0,53,10,240,83,9,39,0,49,10,
+    57,8,53,11,238,54,14,12,233,122,13,57,16,4,17,1,
+    4,18,8,73,15,4,0,1,2,8,99,11,97,9,80,5,
+    0,99,9,51,14,76,114,146,1,0,0,78,67,4,0,0,
+    41,4,114,114,1,0,0,114,143,1,0,0,114,148,1,0,
+    0,114,146,1,0,0,114,31,0,0,0,114,31,0,0,0,
+    114,32,0,0,0,114,224,1,0,0,115,12,0,0,0,2,
+    0,9,2,2,254,2,4,4,5,4,5,6,5,50,0,254,
+    58,1,51,2,58,3,51,4,58,5,107,6,58,7,107,8,
+    58,9,122,10,57,4,107,11,2,4,58,12,51,13,76,114,
+    224,1,0,0,99,26,0,0,0,0,0,128,0,0,0,0,
+    0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,3,0,0,0,11,0,0,0,2,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,114,241,0,0,0,114,240,0,0,0,218,20,83,111,117,
+    114,99,101,108,101,115,115,70,105,108,101,76,111,97,100,101,
+    114,114,242,0,0,0,218,45,76,111,97,100,101,114,32,119,
+    104,105,99,104,32,104,97,110,100,108,101,115,32,115,111,117,
+    114,99,101,108,101,115,115,32,102,105,108,101,32,105,109,112,
+    111,114,116,115,46,114,1,0,0,0,99,125,0,0,0,2,
+    0,0,0,3,0,0,0,2,0,0,0,5,0,0,0,0,
+    0,0,0,0,0,0,0,2,0,0,0,17,0,0,0,11,
+    0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,78,218,29,83,111,117,114,99,101,
+    108,101,115,115,70,105,108,101,76,111,97,100,101,114,46,103,
+    101,116,95,99,111,100,101,114,69,1,0,0,114,153,1,0,
+    0,114,226,0,0,0,114,90,0,0,0,114,4,1,0,0,
+    114,34,1,0,0,114,172,1,0,0,114,173,1,0,0,169,
+    2,114,226,0,0,0,114,215,0,0,0,116,4,0,0,41,
+    5,114,230,0,0,0,114,255,0,0,0,114,90,0,0,0,
+    114,73,0,0,0,114,18,1,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,32,0,0,0,114,127,1,0,0,115,32,
+    0,0,0,2,0,0,1,15,1,15,3,4,1,2,255,2,
+    1,2,255,5,2,2,254,2,2,2,254,11,4,19,1,5,
+    1,20,255,6,17,49,0,54,8,2,255,4,10,1,73,9,
+    2,0,120,2,49,0,54,8,3,254,4,10,2,73,9,2,
+    0,57,3,96,2,121,5,122,4,120,6,49,1,62,5,6,
+    2,6,122,5,120,6,49,2,62,5,6,2,6,49,5,2,
+    5,57,4,53,6,252,57,8,4,9,3,4,10,1,4,11,
+    4,71,9,3,0,1,53,7,250,57,11,53,8,248,57,15,
+    4,16,3,71,16,1,0,121,12,51,9,25,12,2,12,57,
+    12,4,5,1,4,6,2,122,10,57,7,71,12,1,2,76,
+    114,127,1,0,0,99,5,0,0,0,2,0,0,0,3,0,
     0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,
     0,0,2,0,0,0,2,0,0,0,3,0,0,0,0,0,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,218,63,82,101,116,117,114,110,32,78,111,110,101,32,
-    97,115,32,97,110,32,101,120,116,101,110,115,105,111,110,32,
-    109,111,100,117,108,101,32,99,97,110,110,111,116,32,99,114,
-    101,97,116,101,32,97,32,99,111,100,101,32,111,98,106,101,
-    99,116,46,218,28,69,120,116,101,110,115,105,111,110,70,105,
-    108,101,76,111,97,100,101,114,46,103,101,116,95,99,111,100,
-    101,78,168,4,0,0,41,2,114,229,0,0,0,114,254,0,
-    0,0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,
-    0,114,126,1,0,0,115,4,0,0,0,2,0,0,2,6,
-    2,51,2,76,114,126,1,0,0,99,5,0,0,0,2,0,
-    0,0,3,0,0,0,2,0,0,0,2,0,0,0,0,0,
-    0,0,0,0,0,0,2,0,0,0,2,0,0,0,3,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,218,53,82,101,116,117,114,110,32,78,
-    111,110,101,32,97,115,32,101,120,116,101,110,115,105,111,110,
-    32,109,111,100,117,108,101,115,32,104,97,118,101,32,110,111,
-    32,115,111,117,114,99,101,32,99,111,100,101,46,218,30,69,
+    0,0,218,39,82,101,116,117,114,110,32,78,111,110,101,32,
+    97,115,32,116,104,101,114,101,32,105,115,32,110,111,32,115,
+    111,117,114,99,101,32,99,111,100,101,46,218,31,83,111,117,
+    114,99,101,108,101,115,115,70,105,108,101,76,111,97,100,101,
+    114,46,103,101,116,95,115,111,117,114,99,101,78,132,4,0,
+    0,41,2,114,230,0,0,0,114,255,0,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,32,0,0,0,114,156,1,0,
+    0,115,4,0,0,0,2,0,0,2,6,2,51,2,76,114,
+    156,1,0,0,78,112,4,0,0,41,3,114,114,1,0,0,
+    114,127,1,0,0,114,156,1,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,32,0,0,0,114,241,1,0,0,115,10,
+    0,0,0,2,0,9,2,2,254,2,4,4,16,6,3,50,
+    0,254,58,1,51,2,58,3,51,4,58,5,107,6,58,7,
+    107,8,58,9,51,10,76,114,241,1,0,0,218,18,69,88,
+    84,69,78,83,73,79,78,95,83,85,70,70,73,88,69,83,
+    99,65,0,0,0,0,0,128,0,0,0,0,0,0,0,0,
+    0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,14,0,0,0,26,0,0,0,4,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,114,241,0,
+    0,0,114,240,0,0,0,114,205,1,0,0,114,242,0,0,
+    0,218,93,76,111,97,100,101,114,32,102,111,114,32,101,120,
+    116,101,110,115,105,111,110,32,109,111,100,117,108,101,115,46,
+    10,10,32,32,32,32,84,104,101,32,99,111,110,115,116,114,
+    117,99,116,111,114,32,105,115,32,100,101,115,105,103,110,101,
+    100,32,116,111,32,119,111,114,107,32,119,105,116,104,32,70,
+    105,108,101,70,105,110,100,101,114,46,10,10,32,32,32,32,
+    114,1,0,0,0,99,75,0,0,0,3,0,0,0,3,0,
+    0,0,3,0,0,0,3,0,0,0,0,0,0,0,0,0,
+    0,0,3,0,0,0,12,0,0,0,9,0,0,0,9,0,
+    0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,
+    0,0,78,218,28,69,120,116,101,110,115,105,111,110,70,105,
+    108,101,76,111,97,100,101,114,46,95,95,105,110,105,116,95,
+    95,114,226,0,0,0,114,118,0,0,0,114,78,0,0,0,
+    114,18,0,0,0,114,115,0,0,0,114,105,0,0,0,114,
+    90,0,0,0,23,0,0,0,53,0,0,0,67,0,0,0,
+    3,0,0,0,149,4,0,0,41,3,114,230,0,0,0,114,
+    226,0,0,0,114,90,0,0,0,114,31,0,0,0,114,31,
+    0,0,0,114,32,0,0,0,114,119,1,0,0,115,14,0,
+    0,0,2,0,0,1,5,1,16,2,30,1,7,1,7,1,
+    6,12,49,1,59,0,2,53,3,254,57,6,4,7,2,71,
+    7,1,0,16,84,47,0,53,4,252,57,6,53,5,250,54,
+    10,6,249,73,11,1,0,57,7,4,8,2,71,7,2,0,
+    57,2,80,17,0,53,7,247,83,3,9,0,97,3,80,5,
+    0,99,3,49,2,59,0,8,51,0,76,114,119,1,0,0,
+    99,37,0,0,0,2,0,0,0,3,0,0,0,2,0,0,
+    0,2,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+    0,3,0,0,0,4,0,0,0,4,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,78,218,26,
+    69,120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,
+    100,101,114,46,95,95,101,113,95,95,114,192,1,0,0,114,
+    246,0,0,0,158,4,0,0,41,2,114,230,0,0,0,114,
+    193,1,0,0,114,31,0,0,0,114,31,0,0,0,114,32,
+    0,0,0,114,194,1,0,0,115,8,0,0,0,2,0,0,
+    1,19,1,15,255,6,3,52,0,2,255,57,2,52,1,2,
+    254,35,2,2,2,2,81,19,0,1,52,0,3,253,57,2,
+    52,1,3,252,35,2,2,2,2,76,114,194,1,0,0,99,
+    39,0,0,0,1,0,0,0,3,0,0,0,1,0,0,0,
+    1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+    7,0,0,0,5,0,0,0,4,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,78,218,28,69,
     120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,100,
-    101,114,46,103,101,116,95,115,111,117,114,99,101,78,172,4,
-    0,0,41,2,114,229,0,0,0,114,254,0,0,0,114,31,
-    0,0,0,114,31,0,0,0,114,32,0,0,0,114,155,1,
-    0,0,115,4,0,0,0,2,0,0,2,6,2,51,2,76,
-    114,155,1,0,0,114,223,0,0,0,99,7,0,0,0,2,
+    101,114,46,95,95,104,97,115,104,95,95,114,196,1,0,0,
+    114,226,0,0,0,114,90,0,0,0,162,4,0,0,41,1,
+    114,230,0,0,0,114,31,0,0,0,114,31,0,0,0,114,
+    32,0,0,0,114,197,1,0,0,115,4,0,0,0,2,0,
+    0,1,6,7,53,2,254,57,4,52,0,3,253,57,5,71,
+    5,1,0,57,1,53,2,254,57,5,52,0,4,252,57,6,
+    71,6,1,0,31,1,2,1,76,114,197,1,0,0,99,62,
+    0,0,0,2,0,0,0,3,0,0,0,2,0,0,0,3,
+    0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,11,
+    0,0,0,10,0,0,0,9,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,218,38,67,114,101,
+    97,116,101,32,97,110,32,117,110,105,116,105,97,108,105,122,
+    101,100,32,101,120,116,101,110,115,105,111,110,32,109,111,100,
+    117,108,101,218,33,69,120,116,101,110,115,105,111,110,70,105,
+    108,101,76,111,97,100,101,114,46,99,114,101,97,116,101,95,
+    109,111,100,117,108,101,114,235,0,0,0,114,129,1,0,0,
+    114,3,0,0,0,218,14,99,114,101,97,116,101,95,100,121,
+    110,97,109,105,99,114,8,1,0,0,218,38,101,120,116,101,
+    110,115,105,111,110,32,109,111,100,117,108,101,32,123,33,114,
+    125,32,108,111,97,100,101,100,32,102,114,111,109,32,123,33,
+    114,125,114,226,0,0,0,114,90,0,0,0,165,4,0,0,
+    41,3,114,230,0,0,0,114,78,1,0,0,114,131,1,0,
+    0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,
+    114,124,1,0,0,115,20,0,0,0,2,0,0,2,7,1,
+    11,255,11,2,11,1,4,255,2,1,4,255,7,2,6,11,
+    53,2,254,54,6,3,253,53,4,251,57,8,52,8,5,250,
+    2,8,57,8,4,9,1,73,7,3,0,57,2,53,2,254,
+    54,6,6,249,122,7,57,8,52,1,8,248,57,9,52,0,
+    9,247,57,10,73,7,4,0,1,49,2,76,114,124,1,0,
+    0,99,61,0,0,0,2,0,0,0,3,0,0,0,2,0,
+    0,0,2,0,0,0,0,0,0,0,0,0,0,0,2,0,
+    0,0,10,0,0,0,11,0,0,0,9,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,30,
+    73,110,105,116,105,97,108,105,122,101,32,97,110,32,101,120,
+    116,101,110,115,105,111,110,32,109,111,100,117,108,101,218,31,
+    69,120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,
+    100,101,114,46,101,120,101,99,95,109,111,100,117,108,101,114,
+    235,0,0,0,114,129,1,0,0,114,3,0,0,0,218,12,
+    101,120,101,99,95,100,121,110,97,109,105,99,114,8,1,0,
+    0,218,40,101,120,116,101,110,115,105,111,110,32,109,111,100,
+    117,108,101,32,123,33,114,125,32,101,120,101,99,117,116,101,
+    100,32,102,114,111,109,32,123,33,114,125,114,226,0,0,0,
+    114,90,0,0,0,78,173,4,0,0,41,2,114,230,0,0,
+    0,114,131,1,0,0,114,31,0,0,0,114,31,0,0,0,
+    114,32,0,0,0,114,132,1,0,0,115,14,0,0,0,2,
+    0,0,2,28,1,11,1,4,255,2,1,4,255,6,10,53,
+    2,254,54,5,3,253,53,4,251,57,7,52,7,5,250,2,
+    7,57,7,4,8,1,73,6,3,0,1,53,2,254,54,5,
+    6,249,122,7,57,7,52,0,8,248,57,8,52,0,9,247,
+    57,9,73,6,4,0,1,51,10,76,114,132,1,0,0,99,
+    52,0,0,0,2,0,8,0,3,0,0,0,2,0,0,0,
+    3,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+    12,0,0,0,8,0,0,0,7,0,0,0,1,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,218,49,82,101,
+    116,117,114,110,32,84,114,117,101,32,105,102,32,116,104,101,
+    32,101,120,116,101,110,115,105,111,110,32,109,111,100,117,108,
+    101,32,105,115,32,97,32,112,97,99,107,97,103,101,46,218,
+    30,69,120,116,101,110,115,105,111,110,70,105,108,101,76,111,
+    97,100,101,114,46,105,115,95,112,97,99,107,97,103,101,114,
+    95,0,0,0,114,90,0,0,0,114,29,0,0,0,218,3,
+    97,110,121,99,35,0,0,0,1,0,16,1,51,0,0,0,
+    1,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,
+    1,0,0,0,5,0,0,0,3,0,0,0,0,0,0,0,
+    0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+    78,218,49,69,120,116,101,110,115,105,111,110,70,105,108,101,
+    76,111,97,100,101,114,46,105,115,95,112,97,99,107,97,103,
+    101,46,60,108,111,99,97,108,115,62,46,60,103,101,110,101,
+    120,112,114,62,114,119,1,0,0,2,0,0,0,2,0,0,
+    0,182,4,0,0,41,3,122,2,46,48,218,6,115,117,102,
+    102,105,120,218,9,102,105,108,101,95,110,97,109,101,41,1,
+    114,9,2,0,0,114,31,0,0,0,114,32,0,0,0,114,
+    27,0,0,0,115,2,0,0,0,2,0,6,5,80,26,0,
+    57,1,55,2,121,3,122,2,120,4,49,1,23,4,2,4,
+    35,2,3,2,3,78,1,88,0,233,255,51,0,76,114,247,
+    1,0,0,2,0,0,0,179,4,0,0,41,3,114,230,0,
+    0,0,114,255,0,0,0,114,9,2,0,0,114,31,0,0,
+    0,41,1,114,9,2,0,0,114,32,0,0,0,114,75,1,
+    0,0,115,10,0,0,0,2,0,0,2,25,1,9,1,3,
+    255,6,12,53,2,254,57,6,52,0,3,253,57,7,71,7,
+    1,0,121,3,51,4,25,3,2,3,64,2,53,5,251,57,
+    6,107,6,57,10,53,7,249,86,11,71,11,1,0,57,7,
+    71,7,1,0,76,114,75,1,0,0,99,5,0,0,0,2,
     0,0,0,3,0,0,0,2,0,0,0,2,0,0,0,0,
     0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,3,
-    0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,114,194,1,0,0,218,32,69,120,
-    116,101,110,115,105,111,110,70,105,108,101,76,111,97,100,101,
-    114,46,103,101,116,95,102,105,108,101,110,97,109,101,114,90,
-    0,0,0,176,4,0,0,41,2,114,229,0,0,0,114,254,
-    0,0,0,114,31,0,0,0,114,31,0,0,0,114,32,0,
-    0,0,114,68,1,0,0,115,4,0,0,0,2,0,0,3,
-    6,2,52,0,2,255,76,114,68,1,0,0,78,124,4,0,
-    0,41,10,114,113,1,0,0,114,118,1,0,0,114,187,1,
-    0,0,114,190,1,0,0,114,123,1,0,0,114,131,1,0,
-    0,114,74,1,0,0,114,126,1,0,0,114,155,1,0,0,
-    114,68,1,0,0,114,31,0,0,0,114,31,0,0,0,114,
-    32,0,0,0,114,198,1,0,0,115,26,0,0,0,2,0,
-    9,2,2,254,2,8,4,9,4,4,4,3,4,8,4,6,
-    4,6,4,4,4,4,5,1,6,14,50,0,254,58,1,51,
-    2,58,3,51,4,58,5,107,6,58,7,107,8,58,9,107,
-    10,58,11,107,12,58,13,107,14,58,15,107,16,58,17,107,
-    18,58,19,107,20,58,21,50,22,252,57,13,107,23,57,14,
-    71,14,1,0,58,24,51,25,76,114,198,1,0,0,99,62,
-    0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,12,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,
-    0,0,0,29,0,0,0,2,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,114,240,0,0,0,
-    114,239,0,0,0,218,14,95,78,97,109,101,115,112,97,99,
-    101,80,97,116,104,114,241,0,0,0,193,38,1,0,0,82,
-    101,112,114,101,115,101,110,116,115,32,97,32,110,97,109,101,
-    115,112,97,99,101,32,112,97,99,107,97,103,101,39,115,32,
-    112,97,116,104,46,32,32,73,116,32,117,115,101,115,32,116,
-    104,101,32,109,111,100,117,108,101,32,110,97,109,101,10,32,
-    32,32,32,116,111,32,102,105,110,100,32,105,116,115,32,112,
-    97,114,101,110,116,32,109,111,100,117,108,101,44,32,97,110,
-    100,32,102,114,111,109,32,116,104,101,114,101,32,105,116,32,
-    108,111,111,107,115,32,117,112,32,116,104,101,32,112,97,114,
-    101,110,116,39,115,10,32,32,32,32,95,95,112,97,116,104,
-    95,95,46,32,32,87,104,101,110,32,116,104,105,115,32,99,
-    104,97,110,103,101,115,44,32,116,104,101,32,109,111,100,117,
-    108,101,39,115,32,111,119,110,32,112,97,116,104,32,105,115,
-    32,114,101,99,111,109,112,117,116,101,100,44,10,32,32,32,
-    32,117,115,105,110,103,32,112,97,116,104,95,102,105,110,100,
-    101,114,46,32,32,70,111,114,32,116,111,112,45,108,101,118,
-    101,108,32,109,111,100,117,108,101,115,44,32,116,104,101,32,
-    112,97,114,101,110,116,32,109,111,100,117,108,101,39,115,32,
-    112,97,116,104,10,32,32,32,32,105,115,32,115,121,115,46,
-    112,97,116,104,46,114,1,0,0,0,99,44,0,0,0,4,
-    0,0,0,3,0,0,0,4,0,0,0,4,0,0,0,0,
-    0,0,0,0,0,0,0,4,0,0,0,13,0,0,0,8,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,218,63,82,101,116,117,114,110,32,
+    78,111,110,101,32,97,115,32,97,110,32,101,120,116,101,110,
+    115,105,111,110,32,109,111,100,117,108,101,32,99,97,110,110,
+    111,116,32,99,114,101,97,116,101,32,97,32,99,111,100,101,
+    32,111,98,106,101,99,116,46,218,28,69,120,116,101,110,115,
+    105,111,110,70,105,108,101,76,111,97,100,101,114,46,103,101,
+    116,95,99,111,100,101,78,185,4,0,0,41,2,114,230,0,
+    0,0,114,255,0,0,0,114,31,0,0,0,114,31,0,0,
+    0,114,32,0,0,0,114,127,1,0,0,115,4,0,0,0,
+    2,0,0,2,6,2,51,2,76,114,127,1,0,0,99,5,
+    0,0,0,2,0,0,0,3,0,0,0,2,0,0,0,2,
+    0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,2,
     0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,78,218,23,95,78,97,109,101,115,
-    112,97,99,101,80,97,116,104,46,95,95,105,110,105,116,95,
-    95,218,5,95,110,97,109,101,218,5,95,112,97,116,104,114,
-    34,0,0,0,218,16,95,103,101,116,95,112,97,114,101,110,
-    116,95,112,97,116,104,218,17,95,108,97,115,116,95,112,97,
-    114,101,110,116,95,112,97,116,104,218,12,95,112,97,116,104,
-    95,102,105,110,100,101,114,189,4,0,0,41,4,114,229,0,
-    0,0,114,225,0,0,0,114,90,0,0,0,218,11,112,97,
-    116,104,95,102,105,110,100,101,114,114,31,0,0,0,114,31,
-    0,0,0,114,32,0,0,0,114,118,1,0,0,115,10,0,
-    0,0,2,0,0,1,5,1,5,1,24,1,6,13,49,1,
-    59,0,2,49,2,59,0,3,53,4,254,57,7,49,0,54,
-    11,5,253,73,12,1,0,57,8,71,8,1,0,59,0,6,
-    49,3,59,0,7,51,0,76,114,118,1,0,0,99,53,0,
-    0,0,1,0,0,0,3,0,0,0,1,0,0,0,4,0,
-    0,0,0,0,0,0,0,0,0,0,1,0,0,0,10,0,
-    0,0,8,0,0,0,2,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,218,62,82,101,116,117,
-    114,110,115,32,97,32,116,117,112,108,101,32,111,102,32,40,
-    112,97,114,101,110,116,45,109,111,100,117,108,101,45,110,97,
-    109,101,44,32,112,97,114,101,110,116,45,112,97,116,104,45,
-    97,116,116,114,45,110,97,109,101,41,218,38,95,78,97,109,
-    101,115,112,97,99,101,80,97,116,104,46,95,102,105,110,100,
-    95,112,97,114,101,110,116,95,112,97,116,104,95,110,97,109,
-    101,115,114,11,2,0,0,114,163,0,0,0,114,164,0,0,
-    0,114,36,0,0,0,169,2,114,8,0,0,0,114,90,0,
-    0,0,218,8,95,95,112,97,116,104,95,95,195,4,0,0,
-    41,4,114,229,0,0,0,114,233,1,0,0,218,3,100,111,
-    116,218,2,109,101,114,31,0,0,0,114,31,0,0,0,114,
-    32,0,0,0,218,23,95,102,105,110,100,95,112,97,114,101,
-    110,116,95,112,97,116,104,95,110,97,109,101,115,115,10,0,
-    0,0,2,0,0,2,29,1,8,2,3,3,6,10,52,0,
-    2,255,54,7,3,254,51,4,57,9,73,8,2,0,106,4,
-    3,0,5,1,6,5,2,5,5,3,4,51,5,35,2,2,
-    84,6,0,51,6,76,4,4,1,51,7,57,5,93,4,2,
-    76,114,23,2,0,0,99,56,0,0,0,1,0,0,0,3,
-    0,0,0,1,0,0,0,3,0,0,0,0,0,0,0,0,
-    0,0,0,1,0,0,0,9,0,0,0,6,0,0,0,6,
+    0,0,0,0,0,0,0,0,0,0,0,218,53,82,101,116,
+    117,114,110,32,78,111,110,101,32,97,115,32,101,120,116,101,
+    110,115,105,111,110,32,109,111,100,117,108,101,115,32,104,97,
+    118,101,32,110,111,32,115,111,117,114,99,101,32,99,111,100,
+    101,46,218,30,69,120,116,101,110,115,105,111,110,70,105,108,
+    101,76,111,97,100,101,114,46,103,101,116,95,115,111,117,114,
+    99,101,78,189,4,0,0,41,2,114,230,0,0,0,114,255,
+    0,0,0,114,31,0,0,0,114,31,0,0,0,114,32,0,
+    0,0,114,156,1,0,0,115,4,0,0,0,2,0,0,2,
+    6,2,51,2,76,114,156,1,0,0,114,224,0,0,0,99,
+    7,0,0,0,2,0,0,0,3,0,0,0,2,0,0,0,
+    2,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+    2,0,0,0,3,0,0,0,1,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,114,201,1,0,
+    0,218,32,69,120,116,101,110,115,105,111,110,70,105,108,101,
+    76,111,97,100,101,114,46,103,101,116,95,102,105,108,101,110,
+    97,109,101,114,90,0,0,0,193,4,0,0,41,2,114,230,
+    0,0,0,114,255,0,0,0,114,31,0,0,0,114,31,0,
+    0,0,114,32,0,0,0,114,69,1,0,0,115,4,0,0,
+    0,2,0,0,3,6,2,52,0,2,255,76,114,69,1,0,
+    0,78,141,4,0,0,41,10,114,114,1,0,0,114,119,1,
+    0,0,114,194,1,0,0,114,197,1,0,0,114,124,1,0,
+    0,114,132,1,0,0,114,75,1,0,0,114,127,1,0,0,
+    114,156,1,0,0,114,69,1,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,32,0,0,0,114,205,1,0,0,115,26,
+    0,0,0,2,0,9,2,2,254,2,8,4,9,4,4,4,
+    3,4,8,4,6,4,6,4,4,4,4,5,1,6,14,50,
+    0,254,58,1,51,2,58,3,51,4,58,5,107,6,58,7,
+    107,8,58,9,107,10,58,11,107,12,58,13,107,14,58,15,
+    107,16,58,17,107,18,58,19,107,20,58,21,50,22,252,57,
+    13,107,23,57,14,71,14,1,0,58,24,51,25,76,114,205,
+    1,0,0,99,62,0,0,0,0,0,128,0,0,0,0,0,
+    0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,12,0,0,0,29,0,0,0,2,0,0,0,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,78,218,31,95,78,97,109,101,115,112,97,99,101,
-    80,97,116,104,46,95,103,101,116,95,112,97,114,101,110,116,
-    95,112,97,116,104,114,23,2,0,0,114,244,0,0,0,114,
-    8,0,0,0,218,7,109,111,100,117,108,101,115,205,4,0,
-    0,41,3,114,229,0,0,0,218,18,112,97,114,101,110,116,
-    95,109,111,100,117,108,101,95,110,97,109,101,218,14,112,97,
-    116,104,95,97,116,116,114,95,110,97,109,101,114,31,0,0,
-    0,114,31,0,0,0,114,32,0,0,0,114,13,2,0,0,
-    115,6,0,0,0,2,0,0,1,20,1,6,9,49,0,54,
-    6,2,255,73,7,1,0,106,3,2,0,5,1,4,5,2,
-    3,53,3,253,57,6,53,4,251,57,7,52,7,5,250,2,
-    7,57,7,49,1,25,7,2,7,57,7,4,8,2,71,7,
-    2,0,76,114,13,2,0,0,99,104,0,0,0,1,0,0,
-    0,3,0,0,0,1,0,0,0,3,0,0,0,0,0,0,
-    0,0,0,0,0,1,0,0,0,12,0,0,0,10,0,0,
-    0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,78,218,27,95,78,97,109,101,115,112,97,
-    99,101,80,97,116,104,46,95,114,101,99,97,108,99,117,108,
-    97,116,101,114,34,0,0,0,114,13,2,0,0,114,14,2,
-    0,0,114,15,2,0,0,114,11,2,0,0,114,255,0,0,
-    0,114,75,1,0,0,114,12,2,0,0,209,4,0,0,41,
-    3,114,229,0,0,0,218,11,112,97,114,101,110,116,95,112,
-    97,116,104,114,77,1,0,0,114,31,0,0,0,114,31,0,
-    0,0,114,32,0,0,0,218,12,95,114,101,99,97,108,99,
-    117,108,97,116,101,115,18,0,0,0,2,0,0,2,23,1,
-    10,1,21,3,24,1,7,1,7,1,5,1,6,12,53,2,
-    254,57,6,49,0,54,10,3,253,73,11,1,0,57,7,71,
-    7,1,0,57,1,52,0,4,252,35,3,1,84,67,0,49,
-    0,54,6,5,251,52,0,6,250,57,8,4,9,1,73,7,
-    3,0,57,2,51,0,33,2,17,81,16,0,1,52,2,7,
-    249,57,3,51,0,33,3,2,3,84,17,0,52,2,8,248,
-    84,10,0,52,2,8,247,59,0,9,49,1,59,0,4,52,
-    0,9,246,76,114,30,2,0,0,99,24,0,0,0,1,0,
+    114,241,0,0,0,114,240,0,0,0,218,14,95,78,97,109,
+    101,115,112,97,99,101,80,97,116,104,114,242,0,0,0,193,
+    38,1,0,0,82,101,112,114,101,115,101,110,116,115,32,97,
+    32,110,97,109,101,115,112,97,99,101,32,112,97,99,107,97,
+    103,101,39,115,32,112,97,116,104,46,32,32,73,116,32,117,
+    115,101,115,32,116,104,101,32,109,111,100,117,108,101,32,110,
+    97,109,101,10,32,32,32,32,116,111,32,102,105,110,100,32,
+    105,116,115,32,112,97,114,101,110,116,32,109,111,100,117,108,
+    101,44,32,97,110,100,32,102,114,111,109,32,116,104,101,114,
+    101,32,105,116,32,108,111,111,107,115,32,117,112,32,116,104,
+    101,32,112,97,114,101,110,116,39,115,10,32,32,32,32,95,
+    95,112,97,116,104,95,95,46,32,32,87,104,101,110,32,116,
+    104,105,115,32,99,104,97,110,103,101,115,44,32,116,104,101,
+    32,109,111,100,117,108,101,39,115,32,111,119,110,32,112,97,
+    116,104,32,105,115,32,114,101,99,111,109,112,117,116,101,100,
+    44,10,32,32,32,32,117,115,105,110,103,32,112,97,116,104,
+    95,102,105,110,100,101,114,46,32,32,70,111,114,32,116,111,
+    112,45,108,101,118,101,108,32,109,111,100,117,108,101,115,44,
+    32,116,104,101,32,112,97,114,101,110,116,32,109,111,100,117,
+    108,101,39,115,32,112,97,116,104,10,32,32,32,32,105,115,
+    32,115,121,115,46,112,97,116,104,46,114,1,0,0,0,99,
+    44,0,0,0,4,0,0,0,3,0,0,0,4,0,0,0,
+    4,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,
+    13,0,0,0,8,0,0,0,3,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,78,218,23,95,
+    78,97,109,101,115,112,97,99,101,80,97,116,104,46,95,95,
+    105,110,105,116,95,95,218,5,95,110,97,109,101,218,5,95,
+    112,97,116,104,114,34,0,0,0,218,16,95,103,101,116,95,
+    112,97,114,101,110,116,95,112,97,116,104,218,17,95,108,97,
+    115,116,95,112,97,114,101,110,116,95,112,97,116,104,218,12,
+    95,112,97,116,104,95,102,105,110,100,101,114,206,4,0,0,
+    41,4,114,230,0,0,0,114,226,0,0,0,114,90,0,0,
+    0,218,11,112,97,116,104,95,102,105,110,100,101,114,114,31,
+    0,0,0,114,31,0,0,0,114,32,0,0,0,114,119,1,
+    0,0,115,10,0,0,0,2,0,0,1,5,1,5,1,24,
+    1,6,13,49,1,59,0,2,49,2,59,0,3,53,4,254,
+    120,7,49,0,54,11,5,253,73,12,1,0,57,8,71,8,
+    1,0,59,0,6,49,3,59,0,7,51,0,76,114,119,1,
+    0,0,99,53,0,0,0,1,0,0,0,3,0,0,0,1,
+    0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,1,
+    0,0,0,10,0,0,0,8,0,0,0,2,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,
+    62,82,101,116,117,114,110,115,32,97,32,116,117,112,108,101,
+    32,111,102,32,40,112,97,114,101,110,116,45,109,111,100,117,
+    108,101,45,110,97,109,101,44,32,112,97,114,101,110,116,45,
+    112,97,116,104,45,97,116,116,114,45,110,97,109,101,41,218,
+    38,95,78,97,109,101,115,112,97,99,101,80,97,116,104,46,
+    95,102,105,110,100,95,112,97,114,101,110,116,95,112,97,116,
+    104,95,110,97,109,101,115,114,18,2,0,0,114,164,0,0,
+    0,114,165,0,0,0,114,36,0,0,0,169,2,114,8,0,
+    0,0,114,90,0,0,0,218,8,95,95,112,97,116,104,95,
+    95,212,4,0,0,41,4,114,230,0,0,0,114,240,1,0,
+    0,218,3,100,111,116,218,2,109,101,114,31,0,0,0,114,
+    31,0,0,0,114,32,0,0,0,218,23,95,102,105,110,100,
+    95,112,97,114,101,110,116,95,112,97,116,104,95,110,97,109,
+    101,115,115,10,0,0,0,2,0,0,2,29,1,8,2,3,
+    3,6,10,52,0,2,255,54,7,3,254,122,4,57,9,73,
+    8,2,0,106,4,3,0,5,1,6,5,2,5,5,3,4,
+    51,5,123,2,2,84,6,0,51,6,76,4,4,1,122,7,
+    57,5,93,4,2,76,114,30,2,0,0,99,56,0,0,0,
+    1,0,0,0,3,0,0,0,1,0,0,0,3,0,0,0,
+    0,0,0,0,0,0,0,0,1,0,0,0,9,0,0,0,
+    6,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,78,218,31,95,78,97,109,101,
+    115,112,97,99,101,80,97,116,104,46,95,103,101,116,95,112,
+    97,114,101,110,116,95,112,97,116,104,114,30,2,0,0,114,
+    245,0,0,0,114,8,0,0,0,218,7,109,111,100,117,108,
+    101,115,222,4,0,0,41,3,114,230,0,0,0,218,18,112,
+    97,114,101,110,116,95,109,111,100,117,108,101,95,110,97,109,
+    101,218,14,112,97,116,104,95,97,116,116,114,95,110,97,109,
+    101,114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,
+    114,20,2,0,0,115,6,0,0,0,2,0,0,1,20,1,
+    6,9,49,0,54,6,2,255,73,7,1,0,106,3,2,0,
+    5,1,4,5,2,3,53,3,253,57,6,53,4,251,57,7,
+    52,7,5,250,2,7,120,7,49,1,25,7,2,7,57,7,
+    4,8,2,71,7,2,0,76,114,20,2,0,0,99,104,0,
+    0,0,1,0,0,0,3,0,0,0,1,0,0,0,3,0,
+    0,0,0,0,0,0,0,0,0,0,1,0,0,0,12,0,
+    0,0,10,0,0,0,10,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,78,218,27,95,78,97,
+    109,101,115,112,97,99,101,80,97,116,104,46,95,114,101,99,
+    97,108,99,117,108,97,116,101,114,34,0,0,0,114,20,2,
+    0,0,114,21,2,0,0,114,22,2,0,0,114,18,2,0,
+    0,114,0,1,0,0,114,76,1,0,0,114,19,2,0,0,
+    226,4,0,0,41,3,114,230,0,0,0,218,11,112,97,114,
+    101,110,116,95,112,97,116,104,114,78,1,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,32,0,0,0,218,12,95,114,
+    101,99,97,108,99,117,108,97,116,101,115,18,0,0,0,2,
+    0,0,2,23,1,10,1,21,3,24,1,7,1,7,1,5,
+    1,6,12,53,2,254,120,6,49,0,54,10,3,253,73,11,
+    1,0,57,7,71,7,1,0,57,1,52,0,4,252,123,3,
+    1,84,67,0,49,0,54,6,5,251,52,0,6,250,57,8,
+    4,9,1,73,7,3,0,121,2,51,0,33,2,17,81,16,
+    0,1,52,2,7,249,121,3,51,0,33,3,2,3,84,17,
+    0,52,2,8,248,84,10,0,52,2,8,247,59,0,9,49,
+    1,59,0,4,52,0,9,246,76,114,37,2,0,0,99,24,
+    0,0,0,1,0,0,0,3,0,0,0,1,0,0,0,1,
+    0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,10,
+    0,0,0,4,0,0,0,3,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,78,218,23,95,78,
+    97,109,101,115,112,97,99,101,80,97,116,104,46,95,95,105,
+    116,101,114,95,95,114,220,1,0,0,114,37,2,0,0,239,
+    4,0,0,41,1,114,230,0,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,32,0,0,0,218,8,95,95,105,116,101,
+    114,95,95,115,4,0,0,0,2,0,0,1,6,10,53,2,
+    254,120,4,49,0,54,8,3,253,73,9,1,0,57,5,71,
+    5,1,0,76,114,39,2,0,0,99,21,0,0,0,2,0,
+    0,0,3,0,0,0,2,0,0,0,2,0,0,0,0,0,
+    0,0,0,0,0,0,2,0,0,0,7,0,0,0,3,0,
+    0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,78,218,26,95,78,97,109,101,115,112,
+    97,99,101,80,97,116,104,46,95,95,103,101,116,105,116,101,
+    109,95,95,114,37,2,0,0,242,4,0,0,41,2,114,230,
+    0,0,0,218,5,105,110,100,101,120,114,31,0,0,0,114,
+    31,0,0,0,114,32,0,0,0,218,11,95,95,103,101,116,
+    105,116,101,109,95,95,115,4,0,0,0,2,0,0,1,6,
+    7,49,0,54,5,2,255,73,6,1,0,120,2,49,1,25,
+    2,2,2,76,114,42,2,0,0,99,18,0,0,0,3,0,
+    0,0,3,0,0,0,3,0,0,0,3,0,0,0,0,0,
+    0,0,0,0,0,0,3,0,0,0,4,0,0,0,3,0,
+    0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,78,218,26,95,78,97,109,101,115,112,
+    97,99,101,80,97,116,104,46,95,95,115,101,116,105,116,101,
+    109,95,95,114,19,2,0,0,245,4,0,0,41,3,114,230,
+    0,0,0,114,41,2,0,0,114,90,0,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,32,0,0,0,218,11,95,95,
+    115,101,116,105,116,101,109,95,95,115,4,0,0,0,2,0,
+    0,1,6,4,52,0,2,255,120,3,49,1,63,2,3,2,
+    3,51,0,76,114,44,2,0,0,99,24,0,0,0,1,0,
     0,0,3,0,0,0,1,0,0,0,1,0,0,0,0,0,
     0,0,0,0,0,0,1,0,0,0,10,0,0,0,4,0,
     0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,78,218,23,95,78,97,109,101,115,112,
-    97,99,101,80,97,116,104,46,95,95,105,116,101,114,95,95,
-    114,213,1,0,0,114,30,2,0,0,222,4,0,0,41,1,
-    114,229,0,0,0,114,31,0,0,0,114,31,0,0,0,114,
-    32,0,0,0,218,8,95,95,105,116,101,114,95,95,115,4,
-    0,0,0,2,0,0,1,6,10,53,2,254,57,4,49,0,
-    54,8,3,253,73,9,1,0,57,5,71,5,1,0,76,114,
-    32,2,0,0,99,21,0,0,0,2,0,0,0,3,0,0,
-    0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,
-    0,2,0,0,0,7,0,0,0,3,0,0,0,1,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,78,218,26,95,78,97,109,101,115,112,97,99,101,80,97,
-    116,104,46,95,95,103,101,116,105,116,101,109,95,95,114,30,
-    2,0,0,225,4,0,0,41,2,114,229,0,0,0,218,5,
-    105,110,100,101,120,114,31,0,0,0,114,31,0,0,0,114,
-    32,0,0,0,218,11,95,95,103,101,116,105,116,101,109,95,
-    95,115,4,0,0,0,2,0,0,1,6,7,49,0,54,5,
-    2,255,73,6,1,0,57,2,49,1,25,2,2,2,76,114,
-    35,2,0,0,99,18,0,0,0,3,0,0,0,3,0,0,
-    0,3,0,0,0,3,0,0,0,0,0,0,0,0,0,0,
-    0,3,0,0,0,4,0,0,0,3,0,0,0,1,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,78,218,26,95,78,97,109,101,115,112,97,99,101,80,97,
-    116,104,46,95,95,115,101,116,105,116,101,109,95,95,114,12,
-    2,0,0,228,4,0,0,41,3,114,229,0,0,0,114,34,
-    2,0,0,114,90,0,0,0,114,31,0,0,0,114,31,0,
-    0,0,114,32,0,0,0,218,11,95,95,115,101,116,105,116,
-    101,109,95,95,115,4,0,0,0,2,0,0,1,6,4,52,
-    0,2,255,57,3,49,1,63,2,3,2,3,51,0,76,114,
-    37,2,0,0,99,24,0,0,0,1,0,0,0,3,0,0,
-    0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
-    0,1,0,0,0,10,0,0,0,4,0,0,0,3,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,78,218,22,95,78,97,109,101,115,112,97,99,101,80,97,
-    116,104,46,95,95,108,101,110,95,95,114,28,0,0,0,114,
-    30,2,0,0,231,4,0,0,41,1,114,229,0,0,0,114,
-    31,0,0,0,114,31,0,0,0,114,32,0,0,0,218,7,
-    95,95,108,101,110,95,95,115,4,0,0,0,2,0,0,1,
-    6,10,53,2,254,57,4,49,0,54,8,3,253,73,9,1,
-    0,57,5,71,5,1,0,76,114,39,2,0,0,99,19,0,
-    0,0,1,0,0,0,3,0,0,0,1,0,0,0,1,0,
-    0,0,0,0,0,0,0,0,0,0,1,0,0,0,7,0,
-    0,0,5,0,0,0,2,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,78,218,23,95,78,97,
-    109,101,115,112,97,99,101,80,97,116,104,46,95,95,114,101,
-    112,114,95,95,218,20,95,78,97,109,101,115,112,97,99,101,
-    80,97,116,104,40,123,33,114,125,41,114,125,0,0,0,114,
-    12,2,0,0,234,4,0,0,41,1,114,229,0,0,0,114,
-    31,0,0,0,114,31,0,0,0,114,32,0,0,0,218,8,
-    95,95,114,101,112,114,95,95,115,4,0,0,0,2,0,0,
-    1,6,7,51,2,54,4,3,255,52,0,4,254,57,6,73,
-    5,2,0,76,114,42,2,0,0,99,15,0,0,0,2,0,
+    0,0,0,0,0,0,78,218,22,95,78,97,109,101,115,112,
+    97,99,101,80,97,116,104,46,95,95,108,101,110,95,95,114,
+    28,0,0,0,114,37,2,0,0,248,4,0,0,41,1,114,
+    230,0,0,0,114,31,0,0,0,114,31,0,0,0,114,32,
+    0,0,0,218,7,95,95,108,101,110,95,95,115,4,0,0,
+    0,2,0,0,1,6,10,53,2,254,120,4,49,0,54,8,
+    3,253,73,9,1,0,57,5,71,5,1,0,76,114,46,2,
+    0,0,99,19,0,0,0,1,0,0,0,3,0,0,0,1,
+    0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,
+    0,0,0,7,0,0,0,5,0,0,0,2,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,
+    218,23,95,78,97,109,101,115,112,97,99,101,80,97,116,104,
+    46,95,95,114,101,112,114,95,95,218,20,95,78,97,109,101,
+    115,112,97,99,101,80,97,116,104,40,123,33,114,125,41,114,
+    125,0,0,0,114,19,2,0,0,251,4,0,0,41,1,114,
+    230,0,0,0,114,31,0,0,0,114,31,0,0,0,114,32,
+    0,0,0,218,8,95,95,114,101,112,114,95,95,115,4,0,
+    0,0,2,0,0,1,6,7,51,2,54,4,3,255,52,0,
+    4,254,57,6,73,5,2,0,76,114,49,2,0,0,99,15,
+    0,0,0,2,0,0,0,3,0,0,0,2,0,0,0,2,
+    0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,7,
+    0,0,0,3,0,0,0,1,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,78,218,27,95,78,
+    97,109,101,115,112,97,99,101,80,97,116,104,46,95,95,99,
+    111,110,116,97,105,110,115,95,95,114,37,2,0,0,254,4,
+    0,0,41,2,114,230,0,0,0,218,4,105,116,101,109,114,
+    31,0,0,0,114,31,0,0,0,114,32,0,0,0,218,12,
+    95,95,99,111,110,116,97,105,110,115,95,95,115,4,0,0,
+    0,2,0,0,1,6,7,49,0,54,5,2,255,73,6,1,
+    0,34,1,76,114,52,2,0,0,99,21,0,0,0,2,0,
     0,0,3,0,0,0,2,0,0,0,2,0,0,0,0,0,
-    0,0,0,0,0,0,2,0,0,0,7,0,0,0,3,0,
-    0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,78,218,27,95,78,97,109,101,115,112,
-    97,99,101,80,97,116,104,46,95,95,99,111,110,116,97,105,
-    110,115,95,95,114,30,2,0,0,237,4,0,0,41,2,114,
-    229,0,0,0,218,4,105,116,101,109,114,31,0,0,0,114,
-    31,0,0,0,114,32,0,0,0,218,12,95,95,99,111,110,
-    116,97,105,110,115,95,95,115,4,0,0,0,2,0,0,1,
-    6,7,49,0,54,5,2,255,73,6,1,0,34,1,76,114,
-    45,2,0,0,99,21,0,0,0,2,0,0,0,3,0,0,
-    0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,
-    0,2,0,0,0,8,0,0,0,4,0,0,0,2,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,78,218,21,95,78,97,109,101,115,112,97,99,101,80,97,
-    116,104,46,97,112,112,101,110,100,114,12,2,0,0,114,84,
-    0,0,0,240,4,0,0,41,2,114,229,0,0,0,114,44,
-    2,0,0,114,31,0,0,0,114,31,0,0,0,114,32,0,
-    0,0,114,84,0,0,0,115,4,0,0,0,2,0,0,1,
-    6,8,52,0,2,255,54,5,3,254,4,7,1,73,6,2,
-    0,1,51,0,76,114,84,0,0,0,78,182,4,0,0,41,
-    12,114,113,1,0,0,114,118,1,0,0,114,23,2,0,0,
-    114,13,2,0,0,114,30,2,0,0,114,32,2,0,0,114,
-    35,2,0,0,114,37,2,0,0,114,39,2,0,0,114,42,
-    2,0,0,114,45,2,0,0,114,84,0,0,0,114,31,0,
-    0,0,114,31,0,0,0,114,32,0,0,0,114,8,2,0,
-    0,115,28,0,0,0,2,0,9,1,2,255,2,7,4,6,
-    4,10,4,4,4,13,4,3,4,3,4,3,4,3,4,3,
-    4,3,6,12,50,0,254,58,1,51,2,58,3,51,4,58,
-    5,107,6,58,7,107,8,58,9,107,10,58,11,107,12,58,
-    13,107,14,58,15,107,16,58,17,107,18,58,19,107,20,58,
-    21,107,22,58,23,107,24,58,25,107,26,58,27,51,28,76,
-    114,8,2,0,0,99,57,0,0,0,0,0,128,0,0,0,
-    0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,13,0,0,0,22,0,0,0,4,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,114,240,0,0,0,114,239,0,0,0,218,16,95,78,
-    97,109,101,115,112,97,99,101,76,111,97,100,101,114,114,241,
-    0,0,0,99,26,0,0,0,4,0,0,0,3,0,0,0,
-    4,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,
-    4,0,0,0,11,0,0,0,4,0,0,0,2,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    78,218,25,95,78,97,109,101,115,112,97,99,101,76,111,97,
-    100,101,114,46,95,95,105,110,105,116,95,95,114,8,2,0,
-    0,114,12,2,0,0,246,4,0,0,41,4,114,229,0,0,
-    0,114,225,0,0,0,114,90,0,0,0,114,16,2,0,0,
-    114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,114,
-    118,1,0,0,115,4,0,0,0,2,0,0,1,6,11,53,
-    2,254,57,7,4,8,1,4,9,2,4,10,3,71,8,3,
-    0,59,0,3,51,0,76,114,118,1,0,0,114,88,1,0,
-    0,99,19,0,0,0,2,0,0,0,3,0,0,0,2,0,
-    0,0,2,0,0,0,0,0,0,0,0,0,0,0,2,0,
-    0,0,8,0,0,0,5,0,0,0,2,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,115,
-    82,101,116,117,114,110,32,114,101,112,114,32,102,111,114,32,
-    116,104,101,32,109,111,100,117,108,101,46,10,10,32,32,32,
-    32,32,32,32,32,84,104,101,32,109,101,116,104,111,100,32,
-    105,115,32,100,101,112,114,101,99,97,116,101,100,46,32,32,
-    84,104,101,32,105,109,112,111,114,116,32,109,97,99,104,105,
-    110,101,114,121,32,100,111,101,115,32,116,104,101,32,106,111,
-    98,32,105,116,115,101,108,102,46,10,10,32,32,32,32,32,
-    32,32,32,218,28,95,78,97,109,101,115,112,97,99,101,76,
-    111,97,100,101,114,46,109,111,100,117,108,101,95,114,101,112,
-    114,218,25,60,109,111,100,117,108,101,32,123,33,114,125,32,
-    40,110,97,109,101,115,112,97,99,101,41,62,114,125,0,0,
-    0,114,240,0,0,0,249,4,0,0,41,2,114,93,1,0,
-    0,114,130,1,0,0,114,31,0,0,0,114,31,0,0,0,
-    114,32,0,0,0,218,11,109,111,100,117,108,101,95,114,101,
-    112,114,115,4,0,0,0,2,0,0,7,6,8,51,2,54,
-    5,3,255,52,1,4,254,57,7,73,6,2,0,76,114,52,
-    2,0,0,99,5,0,0,0,2,0,0,0,3,0,0,0,
-    2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
-    2,0,0,0,2,0,0,0,3,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    78,218,27,95,78,97,109,101,115,112,97,99,101,76,111,97,
-    100,101,114,46,105,115,95,112,97,99,107,97,103,101,84,2,
-    5,0,0,41,2,114,229,0,0,0,114,254,0,0,0,114,
-    31,0,0,0,114,31,0,0,0,114,32,0,0,0,114,74,
-    1,0,0,115,4,0,0,0,2,0,0,1,6,2,51,2,
-    76,114,74,1,0,0,99,5,0,0,0,2,0,0,0,3,
+    0,0,0,0,0,0,2,0,0,0,8,0,0,0,4,0,
+    0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,78,218,21,95,78,97,109,101,115,112,
+    97,99,101,80,97,116,104,46,97,112,112,101,110,100,114,19,
+    2,0,0,114,84,0,0,0,1,5,0,0,41,2,114,230,
+    0,0,0,114,51,2,0,0,114,31,0,0,0,114,31,0,
+    0,0,114,32,0,0,0,114,84,0,0,0,115,4,0,0,
+    0,2,0,0,1,6,8,52,0,2,255,54,5,3,254,4,
+    7,1,73,6,2,0,1,51,0,76,114,84,0,0,0,78,
+    199,4,0,0,41,12,114,114,1,0,0,114,119,1,0,0,
+    114,30,2,0,0,114,20,2,0,0,114,37,2,0,0,114,
+    39,2,0,0,114,42,2,0,0,114,44,2,0,0,114,46,
+    2,0,0,114,49,2,0,0,114,52,2,0,0,114,84,0,
+    0,0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,
+    0,114,15,2,0,0,115,28,0,0,0,2,0,9,1,2,
+    255,2,7,4,6,4,10,4,4,4,13,4,3,4,3,4,
+    3,4,3,4,3,4,3,6,12,50,0,254,58,1,51,2,
+    58,3,51,4,58,5,107,6,58,7,107,8,58,9,107,10,
+    58,11,107,12,58,13,107,14,58,15,107,16,58,17,107,18,
+    58,19,107,20,58,21,107,22,58,23,107,24,58,25,107,26,
+    58,27,51,28,76,114,15,2,0,0,99,57,0,0,0,0,
+    0,128,0,0,0,0,0,0,0,0,0,9,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,13,0,0,0,22,
+    0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,114,241,0,0,0,114,240,0,0,
+    0,218,16,95,78,97,109,101,115,112,97,99,101,76,111,97,
+    100,101,114,114,242,0,0,0,99,26,0,0,0,4,0,0,
+    0,3,0,0,0,4,0,0,0,4,0,0,0,0,0,0,
+    0,0,0,0,0,4,0,0,0,11,0,0,0,4,0,0,
+    0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,78,218,25,95,78,97,109,101,115,112,97,
+    99,101,76,111,97,100,101,114,46,95,95,105,110,105,116,95,
+    95,114,15,2,0,0,114,19,2,0,0,7,5,0,0,41,
+    4,114,230,0,0,0,114,226,0,0,0,114,90,0,0,0,
+    114,23,2,0,0,114,31,0,0,0,114,31,0,0,0,114,
+    32,0,0,0,114,119,1,0,0,115,4,0,0,0,2,0,
+    0,1,6,11,53,2,254,57,7,4,8,1,4,9,2,4,
+    10,3,71,8,3,0,59,0,3,51,0,76,114,119,1,0,
+    0,114,89,1,0,0,99,19,0,0,0,2,0,0,0,3,
     0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,
-    0,0,0,2,0,0,0,2,0,0,0,3,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,78,218,27,95,78,97,109,101,115,112,97,99,101,
-    76,111,97,100,101,114,46,103,101,116,95,115,111,117,114,99,
-    101,114,36,0,0,0,5,5,0,0,41,2,114,229,0,0,
-    0,114,254,0,0,0,114,31,0,0,0,114,31,0,0,0,
-    114,32,0,0,0,114,155,1,0,0,115,4,0,0,0,2,
-    0,0,1,6,2,51,2,76,114,155,1,0,0,99,32,0,
-    0,0,2,0,0,0,3,0,0,0,2,0,0,0,2,0,
-    0,0,0,0,0,0,0,0,0,0,2,0,0,0,11,0,
-    0,0,8,0,0,0,2,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,78,218,25,95,78,97,
-    109,101,115,112,97,99,101,76,111,97,100,101,114,46,103,101,
-    116,95,99,111,100,101,114,158,1,0,0,114,36,0,0,0,
-    218,8,60,115,116,114,105,110,103,62,114,129,1,0,0,84,
-    169,1,114,160,1,0,0,8,5,0,0,41,2,114,229,0,
-    0,0,114,254,0,0,0,114,31,0,0,0,114,31,0,0,
-    0,114,32,0,0,0,114,126,1,0,0,115,4,0,0,0,
-    2,0,0,1,6,11,53,2,254,57,7,51,3,57,8,51,
-    4,57,9,51,5,57,10,51,6,57,2,51,7,57,3,71,
-    8,3,1,76,114,126,1,0,0,99,5,0,0,0,2,0,
-    0,0,3,0,0,0,2,0,0,0,2,0,0,0,0,0,
-    0,0,0,0,0,0,2,0,0,0,2,0,0,0,3,0,
+    0,0,0,2,0,0,0,8,0,0,0,5,0,0,0,2,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,114,121,1,0,0,218,30,95,78,97,
-    109,101,115,112,97,99,101,76,111,97,100,101,114,46,99,114,
-    101,97,116,101,95,109,111,100,117,108,101,78,11,5,0,0,
-    41,2,114,229,0,0,0,114,77,1,0,0,114,31,0,0,
-    0,114,31,0,0,0,114,32,0,0,0,114,123,1,0,0,
-    115,4,0,0,0,2,0,0,1,6,2,51,2,76,114,123,
-    1,0,0,99,5,0,0,0,2,0,0,0,3,0,0,0,
-    2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
-    2,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,
+    0,0,0,218,115,82,101,116,117,114,110,32,114,101,112,114,
+    32,102,111,114,32,116,104,101,32,109,111,100,117,108,101,46,
+    10,10,32,32,32,32,32,32,32,32,84,104,101,32,109,101,
+    116,104,111,100,32,105,115,32,100,101,112,114,101,99,97,116,
+    101,100,46,32,32,84,104,101,32,105,109,112,111,114,116,32,
+    109,97,99,104,105,110,101,114,121,32,100,111,101,115,32,116,
+    104,101,32,106,111,98,32,105,116,115,101,108,102,46,10,10,
+    32,32,32,32,32,32,32,32,218,28,95,78,97,109,101,115,
+    112,97,99,101,76,111,97,100,101,114,46,109,111,100,117,108,
+    101,95,114,101,112,114,218,25,60,109,111,100,117,108,101,32,
+    123,33,114,125,32,40,110,97,109,101,115,112,97,99,101,41,
+    62,114,125,0,0,0,114,241,0,0,0,10,5,0,0,41,
+    2,114,94,1,0,0,114,131,1,0,0,114,31,0,0,0,
+    114,31,0,0,0,114,32,0,0,0,218,11,109,111,100,117,
+    108,101,95,114,101,112,114,115,4,0,0,0,2,0,0,7,
+    6,8,51,2,54,5,3,255,52,1,4,254,57,7,73,6,
+    2,0,76,114,59,2,0,0,99,5,0,0,0,2,0,0,
+    0,3,0,0,0,2,0,0,0,2,0,0,0,0,0,0,
+    0,0,0,0,0,2,0,0,0,2,0,0,0,3,0,0,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    78,218,28,95,78,97,109,101,115,112,97,99,101,76,111,97,
-    100,101,114,46,101,120,101,99,95,109,111,100,117,108,101,14,
-    5,0,0,41,2,114,229,0,0,0,114,130,1,0,0,114,
-    31,0,0,0,114,31,0,0,0,114,32,0,0,0,114,131,
-    1,0,0,115,4,0,0,0,2,0,0,1,6,2,51,0,
-    76,114,131,1,0,0,99,42,0,0,0,2,0,0,0,3,
-    0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,
-    0,0,0,2,0,0,0,9,0,0,0,7,0,0,0,5,
+    0,0,0,0,0,78,218,27,95,78,97,109,101,115,112,97,
+    99,101,76,111,97,100,101,114,46,105,115,95,112,97,99,107,
+    97,103,101,84,19,5,0,0,41,2,114,230,0,0,0,114,
+    255,0,0,0,114,31,0,0,0,114,31,0,0,0,114,32,
+    0,0,0,114,75,1,0,0,115,4,0,0,0,2,0,0,
+    1,6,2,51,2,76,114,75,1,0,0,99,5,0,0,0,
+    2,0,0,0,3,0,0,0,2,0,0,0,2,0,0,0,
+    0,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,
+    3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,78,218,27,95,78,97,109,101,
+    115,112,97,99,101,76,111,97,100,101,114,46,103,101,116,95,
+    115,111,117,114,99,101,114,36,0,0,0,22,5,0,0,41,
+    2,114,230,0,0,0,114,255,0,0,0,114,31,0,0,0,
+    114,31,0,0,0,114,32,0,0,0,114,156,1,0,0,115,
+    4,0,0,0,2,0,0,1,6,2,51,2,76,114,156,1,
+    0,0,99,32,0,0,0,2,0,0,0,3,0,0,0,2,
+    0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,2,
+    0,0,0,11,0,0,0,8,0,0,0,2,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,
+    218,25,95,78,97,109,101,115,112,97,99,101,76,111,97,100,
+    101,114,46,103,101,116,95,99,111,100,101,114,159,1,0,0,
+    114,36,0,0,0,218,8,60,115,116,114,105,110,103,62,114,
+    130,1,0,0,84,169,1,114,161,1,0,0,25,5,0,0,
+    41,2,114,230,0,0,0,114,255,0,0,0,114,31,0,0,
+    0,114,31,0,0,0,114,32,0,0,0,114,127,1,0,0,
+    115,4,0,0,0,2,0,0,1,6,11,53,2,254,121,7,
+    122,3,121,8,122,4,121,9,122,5,121,10,122,6,121,2,
+    122,7,57,3,71,8,3,1,76,114,127,1,0,0,99,5,
+    0,0,0,2,0,0,0,3,0,0,0,2,0,0,0,2,
+    0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,2,
+    0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,114,122,1,0,0,
+    218,30,95,78,97,109,101,115,112,97,99,101,76,111,97,100,
+    101,114,46,99,114,101,97,116,101,95,109,111,100,117,108,101,
+    78,28,5,0,0,41,2,114,230,0,0,0,114,78,1,0,
+    0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,
+    114,124,1,0,0,115,4,0,0,0,2,0,0,1,6,2,
+    51,2,76,114,124,1,0,0,99,5,0,0,0,2,0,0,
+    0,3,0,0,0,2,0,0,0,2,0,0,0,0,0,0,
+    0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,0,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,218,98,76,111,97,100,32,97,32,110,97,109,101,
-    115,112,97,99,101,32,109,111,100,117,108,101,46,10,10,32,
+    0,0,0,0,0,78,218,28,95,78,97,109,101,115,112,97,
+    99,101,76,111,97,100,101,114,46,101,120,101,99,95,109,111,
+    100,117,108,101,31,5,0,0,41,2,114,230,0,0,0,114,
+    131,1,0,0,114,31,0,0,0,114,31,0,0,0,114,32,
+    0,0,0,114,132,1,0,0,115,4,0,0,0,2,0,0,
+    1,6,2,51,0,76,114,132,1,0,0,99,42,0,0,0,
+    2,0,0,0,3,0,0,0,2,0,0,0,2,0,0,0,
+    0,0,0,0,0,0,0,0,2,0,0,0,9,0,0,0,
+    7,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,218,98,76,111,97,100,32,97,
+    32,110,97,109,101,115,112,97,99,101,32,109,111,100,117,108,
+    101,46,10,10,32,32,32,32,32,32,32,32,84,104,105,115,
+    32,109,101,116,104,111,100,32,105,115,32,100,101,112,114,101,
+    99,97,116,101,100,46,32,32,85,115,101,32,101,120,101,99,
+    95,109,111,100,117,108,101,40,41,32,105,110,115,116,101,97,
+    100,46,10,10,32,32,32,32,32,32,32,32,218,28,95,78,
+    97,109,101,115,112,97,99,101,76,111,97,100,101,114,46,108,
+    111,97,100,95,109,111,100,117,108,101,114,235,0,0,0,114,
+    8,1,0,0,218,38,110,97,109,101,115,112,97,99,101,32,
+    109,111,100,117,108,101,32,108,111,97,100,101,100,32,119,105,
+    116,104,32,112,97,116,104,32,123,33,114,125,114,19,2,0,
+    0,114,135,1,0,0,34,5,0,0,41,2,114,230,0,0,
+    0,114,255,0,0,0,114,31,0,0,0,114,31,0,0,0,
+    114,32,0,0,0,114,136,1,0,0,115,10,0,0,0,2,
+    0,0,7,11,1,4,255,7,2,6,9,53,2,254,54,5,
+    3,253,122,4,57,7,52,0,5,252,57,8,73,6,3,0,
+    1,53,2,254,54,5,6,251,4,7,0,4,8,1,73,6,
+    3,0,76,114,136,1,0,0,78,6,5,0,0,41,9,114,
+    114,1,0,0,114,119,1,0,0,114,59,2,0,0,114,75,
+    1,0,0,114,156,1,0,0,114,127,1,0,0,114,124,1,
+    0,0,114,132,1,0,0,114,136,1,0,0,114,31,0,0,
+    0,114,31,0,0,0,114,32,0,0,0,114,54,2,0,0,
+    115,20,0,0,0,2,0,9,1,4,3,5,1,10,8,4,
+    3,4,3,4,3,4,3,4,3,6,13,50,0,254,58,1,
+    51,2,58,3,107,4,58,5,50,6,252,57,12,107,7,57,
+    13,71,13,1,0,58,8,107,9,58,10,107,11,58,12,107,
+    13,58,14,107,15,58,16,107,17,58,18,107,19,58,20,51,
+    21,76,114,54,2,0,0,99,162,0,0,0,0,0,128,0,
+    0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,15,0,0,0,24,0,0,0,
+    4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,114,241,0,0,0,114,240,0,0,0,218,10,
+    80,97,116,104,70,105,110,100,101,114,114,242,0,0,0,218,
+    62,77,101,116,97,32,112,97,116,104,32,102,105,110,100,101,
+    114,32,102,111,114,32,115,121,115,46,112,97,116,104,32,97,
+    110,100,32,112,97,99,107,97,103,101,32,95,95,112,97,116,
+    104,95,95,32,97,116,116,114,105,98,117,116,101,115,46,114,
+    1,0,0,0,114,89,1,0,0,99,113,0,0,0,1,0,
+    0,0,3,0,0,0,1,0,0,0,3,0,0,0,0,0,
+    0,0,0,0,0,0,1,0,0,0,12,0,0,0,9,0,
+    0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,218,125,67,97,108,108,32,116,104,101,
+    32,105,110,118,97,108,105,100,97,116,101,95,99,97,99,104,
+    101,115,40,41,32,109,101,116,104,111,100,32,111,110,32,97,
+    108,108,32,112,97,116,104,32,101,110,116,114,121,32,102,105,
+    110,100,101,114,115,10,32,32,32,32,32,32,32,32,115,116,
+    111,114,101,100,32,105,110,32,115,121,115,46,112,97,116,104,
+    95,105,109,112,111,114,116,101,114,95,99,97,99,104,101,115,
+    32,40,119,104,101,114,101,32,105,109,112,108,101,109,101,110,
+    116,101,100,41,46,218,28,80,97,116,104,70,105,110,100,101,
+    114,46,105,110,118,97,108,105,100,97,116,101,95,99,97,99,
+    104,101,115,218,4,108,105,115,116,114,8,0,0,0,218,19,
+    112,97,116,104,95,105,109,112,111,114,116,101,114,95,99,97,
+    99,104,101,218,5,105,116,101,109,115,78,114,243,0,0,0,
+    218,17,105,110,118,97,108,105,100,97,116,101,95,99,97,99,
+    104,101,115,52,5,0,0,41,3,114,94,1,0,0,114,226,
+    0,0,0,218,6,102,105,110,100,101,114,114,31,0,0,0,
+    114,31,0,0,0,114,32,0,0,0,114,77,2,0,0,115,
+    14,0,0,0,2,0,0,4,45,1,7,1,22,1,19,1,
+    11,252,6,12,53,2,254,57,6,53,3,252,57,7,52,7,
+    4,251,2,7,54,10,5,250,73,11,1,0,57,7,71,7,
+    1,0,86,3,80,72,0,106,4,2,0,5,1,5,5,2,
+    4,51,6,33,2,84,25,0,53,3,252,57,4,52,4,4,
+    249,2,4,120,4,49,1,69,4,2,4,80,33,0,53,7,
+    247,57,7,4,8,2,122,8,57,9,71,8,2,0,84,14,
+    0,49,2,54,7,8,246,73,8,1,0,1,88,3,187,255,
+    51,6,76,114,77,2,0,0,99,114,0,0,0,2,0,0,
+    0,3,0,0,0,2,0,0,0,3,0,0,0,0,0,0,
+    0,0,0,0,0,2,0,0,0,10,0,0,0,10,0,0,
+    0,12,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+    0,0,0,0,0,218,46,83,101,97,114,99,104,32,115,121,
+    115,46,112,97,116,104,95,104,111,111,107,115,32,102,111,114,
+    32,97,32,102,105,110,100,101,114,32,102,111,114,32,39,112,
+    97,116,104,39,46,218,22,80,97,116,104,70,105,110,100,101,
+    114,46,95,112,97,116,104,95,104,111,111,107,115,114,8,0,
+    0,0,218,10,112,97,116,104,95,104,111,111,107,115,78,114,
+    10,0,0,0,114,158,0,0,0,218,23,115,121,115,46,112,
+    97,116,104,95,104,111,111,107,115,32,105,115,32,101,109,112,
+    116,121,114,254,0,0,0,114,227,0,0,0,80,0,0,0,
+    93,0,0,0,107,0,0,0,4,0,0,0,62,5,0,0,
+    41,3,114,94,1,0,0,114,90,0,0,0,218,4,104,111,
+    111,107,114,31,0,0,0,114,31,0,0,0,114,32,0,0,
+    0,218,11,95,112,97,116,104,95,104,111,111,107,115,115,18,
+    0,0,0,2,0,0,3,39,1,21,1,18,2,13,1,7,
+    1,7,252,4,6,6,10,53,2,254,57,3,52,3,3,253,
+    2,3,121,3,51,4,33,3,17,2,3,81,16,0,1,53,
+    2,254,57,3,52,3,3,252,2,3,16,84,24,0,53,5,
+    250,54,6,6,249,122,7,57,8,53,8,247,57,9,73,7,
+    3,0,1,53,2,254,57,3,52,3,3,246,2,3,86,3,
+    80,32,0,57,2,4,7,2,4,8,1,71,8,1,0,2,
+    3,76,53,9,244,83,4,9,0,97,4,80,5,0,99,4,
+    88,3,227,255,51,4,76,114,84,2,0,0,99,116,0,0,
+    0,2,0,0,0,3,0,0,0,2,0,0,0,3,0,0,
+    0,0,0,0,0,0,0,0,0,2,0,0,0,11,0,0,
+    0,11,0,0,0,12,0,0,0,0,0,0,0,0,0,0,
+    0,2,0,0,0,0,0,0,0,218,210,71,101,116,32,116,
+    104,101,32,102,105,110,100,101,114,32,102,111,114,32,116,104,
+    101,32,112,97,116,104,32,101,110,116,114,121,32,102,114,111,
+    109,32,115,121,115,46,112,97,116,104,95,105,109,112,111,114,
+    116,101,114,95,99,97,99,104,101,46,10,10,32,32,32,32,
+    32,32,32,32,73,102,32,116,104,101,32,112,97,116,104,32,
+    101,110,116,114,121,32,105,115,32,110,111,116,32,105,110,32,
+    116,104,101,32,99,97,99,104,101,44,32,102,105,110,100,32,
+    116,104,101,32,97,112,112,114,111,112,114,105,97,116,101,32,
+    102,105,110,100,101,114,10,32,32,32,32,32,32,32,32,97,
+    110,100,32,99,97,99,104,101,32,105,116,46,32,73,102,32,
+    110,111,32,102,105,110,100,101,114,32,105,115,32,97,118,97,
+    105,108,97,98,108,101,44,32,115,116,111,114,101,32,78,111,
+    110,101,46,10,10,32,32,32,32,32,32,32,32,218,31,80,
+    97,116,104,70,105,110,100,101,114,46,95,112,97,116,104,95,
+    105,109,112,111,114,116,101,114,95,99,97,99,104,101,114,36,
+    0,0,0,114,18,0,0,0,114,115,0,0,0,114,216,1,
+    0,0,78,114,8,0,0,0,114,75,2,0,0,218,8,75,
+    101,121,69,114,114,111,114,114,84,2,0,0,10,0,0,0,
+    26,0,0,0,40,0,0,0,3,0,0,0,40,0,0,0,
+    64,0,0,0,113,0,0,0,3,0,0,0,75,5,0,0,
+    41,3,114,94,1,0,0,114,90,0,0,0,114,78,2,0,
+    0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,
+    218,20,95,112,97,116,104,95,105,109,112,111,114,116,101,114,
+    95,99,97,99,104,101,115,20,0,0,0,2,0,0,8,8,
+    2,16,1,7,3,7,2,24,1,7,1,15,1,27,1,6,
+    11,51,2,123,2,1,84,33,0,53,3,254,54,6,4,253,
+    73,7,1,0,57,1,80,17,0,53,5,251,83,3,9,0,
+    51,6,97,3,76,99,3,53,7,249,57,3,52,3,8,248,
+    2,3,120,3,49,1,25,3,2,3,57,2,80,52,0,53,
+    9,246,83,3,44,0,49,0,54,8,10,245,4,10,1,73,
+    9,2,0,57,2,53,7,249,57,5,52,5,8,244,2,5,
+    120,5,49,1,63,2,5,2,5,97,3,80,5,0,99,3,
+    49,2,76,114,88,2,0,0,99,121,0,0,0,3,0,0,
+    0,3,0,0,0,3,0,0,0,6,0,0,0,0,0,0,
+    0,0,0,0,0,3,0,0,0,13,0,0,0,9,0,0,
+    0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,78,218,27,80,97,116,104,70,105,110,100,
+    101,114,46,95,108,101,103,97,99,121,95,103,101,116,95,115,
+    112,101,99,114,243,0,0,0,114,252,0,0,0,114,113,1,
+    0,0,114,235,0,0,0,114,108,1,0,0,114,70,1,0,
+    0,114,76,1,0,0,97,5,0,0,41,6,114,94,1,0,
+    0,114,255,0,0,0,114,78,2,0,0,114,0,1,0,0,
+    114,1,1,0,0,114,78,1,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,32,0,0,0,218,16,95,108,101,103,97,
+    99,121,95,103,101,116,95,115,112,101,99,115,20,0,0,0,
+    2,0,0,4,19,1,26,2,15,1,5,1,8,1,18,1,
+    20,1,5,1,6,13,53,2,254,57,9,4,10,2,122,3,
+    57,11,71,10,2,0,84,29,0,49,2,54,9,3,253,4,
+    11,1,73,10,2,0,106,6,2,0,5,3,7,5,4,6,
+    80,23,0,49,2,54,9,4,252,4,11,1,73,10,2,0,
+    57,3,94,6,0,121,4,51,0,33,3,17,84,21,0,53,
+    5,250,54,9,6,249,4,11,1,4,12,3,73,10,3,0,
+    76,53,5,250,54,9,7,248,4,11,1,122,0,57,12,73,
+    10,3,0,120,5,49,4,59,5,8,49,5,76,114,90,2,
+    0,0,78,99,235,0,0,0,4,0,0,0,3,0,0,0,
+    4,0,0,0,9,0,0,0,1,0,0,0,0,0,0,0,
+    4,0,0,0,17,0,0,0,17,0,0,0,19,0,0,0,
+    0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+    218,63,70,105,110,100,32,116,104,101,32,108,111,97,100,101,
+    114,32,111,114,32,110,97,109,101,115,112,97,99,101,95,112,
+    97,116,104,32,102,111,114,32,116,104,105,115,32,109,111,100,
+    117,108,101,47,112,97,99,107,97,103,101,32,110,97,109,101,
+    46,218,20,80,97,116,104,70,105,110,100,101,114,46,95,103,
+    101,116,95,115,112,101,99,114,36,1,0,0,114,171,0,0,
+    0,218,5,98,121,116,101,115,114,88,2,0,0,78,114,243,
+    0,0,0,114,110,1,0,0,114,90,2,0,0,114,0,1,
+    0,0,114,76,1,0,0,114,227,0,0,0,218,19,115,112,
+    101,99,32,109,105,115,115,105,110,103,32,108,111,97,100,101,
+    114,114,45,1,0,0,114,235,0,0,0,114,70,1,0,0,
+    13,0,0,0,3,0,0,0,112,5,0,0,41,9,114,94,
+    1,0,0,114,255,0,0,0,114,90,0,0,0,114,109,1,
+    0,0,218,14,110,97,109,101,115,112,97,99,101,95,112,97,
+    116,104,218,5,101,110,116,114,121,114,78,2,0,0,114,78,
+    1,0,0,114,1,1,0,0,114,31,0,0,0,114,31,0,
+    0,0,114,32,0,0,0,218,9,95,103,101,116,95,115,112,
+    101,99,115,44,0,0,0,2,0,0,5,5,1,9,1,31,
+    1,3,1,15,1,8,1,19,1,21,2,18,1,7,1,3,
+    1,16,1,5,1,6,1,7,1,14,5,14,236,4,22,20,
+    1,5,1,6,17,94,9,0,120,4,49,2,86,9,80,192,
+    0,57,5,53,2,254,57,13,4,14,5,53,3,252,57,15,
+    53,4,250,57,16,93,15,2,57,15,71,14,2,0,16,84,
+    6,0,80,156,0,49,0,54,13,5,249,4,15,5,73,14,
+    2,0,121,6,51,6,33,6,17,84,133,0,53,7,247,57,
+    13,4,14,6,122,8,57,15,71,14,2,0,84,24,0,49,
+    6,54,13,8,246,4,15,1,4,16,3,73,14,3,0,57,
+    7,80,21,0,49,0,54,13,9,245,4,15,1,4,16,6,
+    73,14,3,0,121,7,51,6,33,7,84,6,0,80,65,0,
+    52,7,10,244,121,10,51,6,33,10,17,2,10,84,8,0,
+    49,7,2,9,76,52,7,11,243,121,8,51,6,33,8,84,
+    17,0,53,12,241,121,13,122,13,57,14,71,14,1,0,77,
+    49,4,54,13,14,240,4,15,8,73,14,2,0,1,88,9,
+    67,255,53,15,238,54,12,16,237,4,14,1,122,6,57,15,
+    73,13,3,0,120,7,49,4,59,7,11,49,7,76,114,97,
+    2,0,0,99,117,0,0,0,4,0,0,0,3,0,0,0,
+    4,0,0,0,6,0,0,0,2,0,0,0,0,0,0,0,
+    4,0,0,0,14,0,0,0,10,0,0,0,9,0,0,0,
+    0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+    218,141,84,114,121,32,116,111,32,102,105,110,100,32,97,32,
+    115,112,101,99,32,102,111,114,32,39,102,117,108,108,110,97,
+    109,101,39,32,111,110,32,115,121,115,46,112,97,116,104,32,
+    111,114,32,39,112,97,116,104,39,46,10,10,32,32,32,32,
+    32,32,32,32,84,104,101,32,115,101,97,114,99,104,32,105,
+    115,32,98,97,115,101,100,32,111,110,32,115,121,115,46,112,
+    97,116,104,95,104,111,111,107,115,32,97,110,100,32,115,121,
+    115,46,112,97,116,104,95,105,109,112,111,114,116,101,114,95,
+    99,97,99,104,101,46,10,32,32,32,32,32,32,32,32,218,
+    20,80,97,116,104,70,105,110,100,101,114,46,102,105,110,100,
+    95,115,112,101,99,78,114,8,0,0,0,114,90,0,0,0,
+    114,97,2,0,0,114,0,1,0,0,114,76,1,0,0,114,
+    72,1,0,0,114,15,2,0,0,13,0,0,0,2,0,0,
+    0,14,0,0,0,3,0,0,0,144,5,0,0,41,6,114,
+    94,1,0,0,114,255,0,0,0,114,90,0,0,0,114,109,
+    1,0,0,114,78,1,0,0,114,95,2,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,32,0,0,0,114,110,1,0,
+    0,115,28,0,0,0,2,0,0,6,7,1,13,1,21,1,
+    7,1,3,1,15,1,6,1,5,3,5,1,24,1,3,2,
+    3,2,6,14,51,2,33,2,84,16,0,53,3,254,57,6,
+    52,6,4,253,2,6,120,2,49,0,54,9,5,252,4,11,
+    1,4,12,2,4,13,3,73,10,4,0,121,4,51,2,33,
+    4,84,6,0,51,2,76,52,4,6,251,121,6,51,2,33,
+    6,2,6,84,49,0,52,4,7,250,120,5,49,5,84,35,
+    0,51,2,59,4,8,53,9,248,57,9,4,10,1,4,11,
+    5,52,0,5,247,57,12,71,10,3,0,59,4,7,49,4,
+    76,51,2,76,49,4,76,114,110,1,0,0,99,35,0,0,
+    0,3,0,0,0,3,0,0,0,3,0,0,0,4,0,0,
+    0,1,0,0,0,0,0,0,0,3,0,0,0,11,0,0,
+    0,5,0,0,0,2,0,0,0,0,0,0,0,1,0,0,
+    0,0,0,0,0,0,0,0,0,218,170,102,105,110,100,32,
+    116,104,101,32,109,111,100,117,108,101,32,111,110,32,115,121,
+    115,46,112,97,116,104,32,111,114,32,39,112,97,116,104,39,
+    32,98,97,115,101,100,32,111,110,32,115,121,115,46,112,97,
+    116,104,95,104,111,111,107,115,32,97,110,100,10,32,32,32,
+    32,32,32,32,32,115,121,115,46,112,97,116,104,95,105,109,
+    112,111,114,116,101,114,95,99,97,99,104,101,46,10,10,32,
     32,32,32,32,32,32,32,84,104,105,115,32,109,101,116,104,
     111,100,32,105,115,32,100,101,112,114,101,99,97,116,101,100,
-    46,32,32,85,115,101,32,101,120,101,99,95,109,111,100,117,
-    108,101,40,41,32,105,110,115,116,101,97,100,46,10,10,32,
-    32,32,32,32,32,32,32,218,28,95,78,97,109,101,115,112,
-    97,99,101,76,111,97,100,101,114,46,108,111,97,100,95,109,
-    111,100,117,108,101,114,234,0,0,0,114,7,1,0,0,218,
-    38,110,97,109,101,115,112,97,99,101,32,109,111,100,117,108,
-    101,32,108,111,97,100,101,100,32,119,105,116,104,32,112,97,
-    116,104,32,123,33,114,125,114,12,2,0,0,114,134,1,0,
-    0,17,5,0,0,41,2,114,229,0,0,0,114,254,0,0,
-    0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,
-    114,135,1,0,0,115,10,0,0,0,2,0,0,7,11,1,
-    4,255,7,2,6,9,53,2,254,54,5,3,253,51,4,57,
-    7,52,0,5,252,57,8,73,6,3,0,1,53,2,254,54,
-    5,6,251,4,7,0,4,8,1,73,6,3,0,76,114,135,
-    1,0,0,78,245,4,0,0,41,9,114,113,1,0,0,114,
-    118,1,0,0,114,52,2,0,0,114,74,1,0,0,114,155,
-    1,0,0,114,126,1,0,0,114,123,1,0,0,114,131,1,
-    0,0,114,135,1,0,0,114,31,0,0,0,114,31,0,0,
-    0,114,32,0,0,0,114,47,2,0,0,115,20,0,0,0,
-    2,0,9,1,4,3,5,1,10,8,4,3,4,3,4,3,
-    4,3,4,3,6,13,50,0,254,58,1,51,2,58,3,107,
-    4,58,5,50,6,252,57,12,107,7,57,13,71,13,1,0,
-    58,8,107,9,58,10,107,11,58,12,107,13,58,14,107,15,
-    58,16,107,17,58,18,107,19,58,20,51,21,76,114,47,2,
-    0,0,99,162,0,0,0,0,0,128,0,0,0,0,0,0,
-    0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,15,0,0,0,24,0,0,0,4,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,
-    240,0,0,0,114,239,0,0,0,218,10,80,97,116,104,70,
-    105,110,100,101,114,114,241,0,0,0,218,62,77,101,116,97,
-    32,112,97,116,104,32,102,105,110,100,101,114,32,102,111,114,
-    32,115,121,115,46,112,97,116,104,32,97,110,100,32,112,97,
-    99,107,97,103,101,32,95,95,112,97,116,104,95,95,32,97,
-    116,116,114,105,98,117,116,101,115,46,114,1,0,0,0,114,
-    88,1,0,0,99,113,0,0,0,1,0,0,0,3,0,0,
-    0,1,0,0,0,3,0,0,0,0,0,0,0,0,0,0,
-    0,1,0,0,0,12,0,0,0,9,0,0,0,10,0,0,
+    46,32,32,85,115,101,32,102,105,110,100,95,115,112,101,99,
+    40,41,32,105,110,115,116,101,97,100,46,10,10,32,32,32,
+    32,32,32,32,32,218,22,80,97,116,104,70,105,110,100,101,
+    114,46,102,105,110,100,95,109,111,100,117,108,101,114,110,1,
+    0,0,78,114,0,1,0,0,13,0,0,0,2,0,0,0,
+    168,5,0,0,41,4,114,94,1,0,0,114,255,0,0,0,
+    114,90,0,0,0,114,78,1,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,32,0,0,0,114,113,1,0,0,115,10,
+    0,0,0,2,0,0,8,18,1,7,1,3,1,6,11,49,
+    0,54,7,2,255,4,9,1,4,10,2,73,8,3,0,121,
+    3,51,3,33,3,84,6,0,51,3,76,52,3,4,254,76,
+    114,113,1,0,0,99,28,0,0,0,1,0,5,0,15,0,
+    0,0,1,0,0,0,4,0,0,0,0,0,0,0,0,0,
+    0,0,1,0,0,0,10,0,0,0,5,0,0,0,1,0,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,218,125,67,97,108,108,32,116,104,101,32,105,110,118,97,
-    108,105,100,97,116,101,95,99,97,99,104,101,115,40,41,32,
-    109,101,116,104,111,100,32,111,110,32,97,108,108,32,112,97,
-    116,104,32,101,110,116,114,121,32,102,105,110,100,101,114,115,
-    10,32,32,32,32,32,32,32,32,115,116,111,114,101,100,32,
-    105,110,32,115,121,115,46,112,97,116,104,95,105,109,112,111,
-    114,116,101,114,95,99,97,99,104,101,115,32,40,119,104,101,
-    114,101,32,105,109,112,108,101,109,101,110,116,101,100,41,46,
-    218,28,80,97,116,104,70,105,110,100,101,114,46,105,110,118,
-    97,108,105,100,97,116,101,95,99,97,99,104,101,115,218,4,
-    108,105,115,116,114,8,0,0,0,218,19,112,97,116,104,95,
-    105,109,112,111,114,116,101,114,95,99,97,99,104,101,218,5,
-    105,116,101,109,115,78,114,242,0,0,0,218,17,105,110,118,
-    97,108,105,100,97,116,101,95,99,97,99,104,101,115,35,5,
-    0,0,41,3,114,93,1,0,0,114,225,0,0,0,218,6,
-    102,105,110,100,101,114,114,31,0,0,0,114,31,0,0,0,
-    114,32,0,0,0,114,70,2,0,0,115,14,0,0,0,2,
-    0,0,4,45,1,7,1,22,1,19,1,11,252,6,12,53,
-    2,254,57,6,53,3,252,57,7,52,7,4,251,2,7,54,
-    10,5,250,73,11,1,0,57,7,71,7,1,0,86,3,80,
-    72,0,106,4,2,0,5,1,5,5,2,4,51,6,33,2,
-    84,25,0,53,3,252,57,4,52,4,4,249,2,4,57,4,
-    49,1,69,4,2,4,80,33,0,53,7,247,57,7,4,8,
-    2,51,8,57,9,71,8,2,0,84,14,0,49,2,54,7,
-    8,246,73,8,1,0,1,88,3,187,255,51,6,76,114,70,
-    2,0,0,99,114,0,0,0,2,0,0,0,3,0,0,0,
-    2,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,
-    2,0,0,0,10,0,0,0,10,0,0,0,12,0,0,0,
-    0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
-    218,46,83,101,97,114,99,104,32,115,121,115,46,112,97,116,
-    104,95,104,111,111,107,115,32,102,111,114,32,97,32,102,105,
-    110,100,101,114,32,102,111,114,32,39,112,97,116,104,39,46,
-    218,22,80,97,116,104,70,105,110,100,101,114,46,95,112,97,
-    116,104,95,104,111,111,107,115,114,8,0,0,0,218,10,112,
-    97,116,104,95,104,111,111,107,115,78,114,10,0,0,0,114,
-    157,0,0,0,218,23,115,121,115,46,112,97,116,104,95,104,
-    111,111,107,115,32,105,115,32,101,109,112,116,121,114,253,0,
-    0,0,114,226,0,0,0,80,0,0,0,93,0,0,0,107,
-    0,0,0,4,0,0,0,45,5,0,0,41,3,114,93,1,
-    0,0,114,90,0,0,0,218,4,104,111,111,107,114,31,0,
-    0,0,114,31,0,0,0,114,32,0,0,0,218,11,95,112,
-    97,116,104,95,104,111,111,107,115,115,18,0,0,0,2,0,
-    0,3,39,1,21,1,18,2,13,1,7,1,7,252,4,6,
-    6,10,53,2,254,57,3,52,3,3,253,2,3,57,3,51,
-    4,33,3,17,2,3,81,16,0,1,53,2,254,57,3,52,
-    3,3,252,2,3,16,84,24,0,53,5,250,54,6,6,249,
-    51,7,57,8,53,8,247,57,9,73,7,3,0,1,53,2,
-    254,57,3,52,3,3,246,2,3,86,3,80,32,0,57,2,
-    4,7,2,4,8,1,71,8,1,0,2,3,76,53,9,244,
-    83,4,9,0,97,4,80,5,0,99,4,88,3,227,255,51,
-    4,76,114,77,2,0,0,99,116,0,0,0,2,0,0,0,
-    3,0,0,0,2,0,0,0,3,0,0,0,0,0,0,0,
-    0,0,0,0,2,0,0,0,11,0,0,0,11,0,0,0,
-    12,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
-    0,0,0,0,218,210,71,101,116,32,116,104,101,32,102,105,
-    110,100,101,114,32,102,111,114,32,116,104,101,32,112,97,116,
-    104,32,101,110,116,114,121,32,102,114,111,109,32,115,121,115,
-    46,112,97,116,104,95,105,109,112,111,114,116,101,114,95,99,
-    97,99,104,101,46,10,10,32,32,32,32,32,32,32,32,73,
-    102,32,116,104,101,32,112,97,116,104,32,101,110,116,114,121,
-    32,105,115,32,110,111,116,32,105,110,32,116,104,101,32,99,
-    97,99,104,101,44,32,102,105,110,100,32,116,104,101,32,97,
-    112,112,114,111,112,114,105,97,116,101,32,102,105,110,100,101,
-    114,10,32,32,32,32,32,32,32,32,97,110,100,32,99,97,
-    99,104,101,32,105,116,46,32,73,102,32,110,111,32,102,105,
-    110,100,101,114,32,105,115,32,97,118,97,105,108,97,98,108,
-    101,44,32,115,116,111,114,101,32,78,111,110,101,46,10,10,
-    32,32,32,32,32,32,32,32,218,31,80,97,116,104,70,105,
-    110,100,101,114,46,95,112,97,116,104,95,105,109,112,111,114,
-    116,101,114,95,99,97,99,104,101,114,36,0,0,0,114,18,
-    0,0,0,114,115,0,0,0,114,209,1,0,0,78,114,8,
-    0,0,0,114,68,2,0,0,218,8,75,101,121,69,114,114,
-    111,114,114,77,2,0,0,10,0,0,0,26,0,0,0,40,
-    0,0,0,3,0,0,0,40,0,0,0,64,0,0,0,113,
-    0,0,0,3,0,0,0,58,5,0,0,41,3,114,93,1,
-    0,0,114,90,0,0,0,114,71,2,0,0,114,31,0,0,
-    0,114,31,0,0,0,114,32,0,0,0,218,20,95,112,97,
-    116,104,95,105,109,112,111,114,116,101,114,95,99,97,99,104,
-    101,115,20,0,0,0,2,0,0,8,8,2,16,1,7,3,
-    7,2,24,1,7,1,15,1,27,1,6,11,51,2,35,2,
-    1,84,33,0,53,3,254,54,6,4,253,73,7,1,0,57,
-    1,80,17,0,53,5,251,83,3,9,0,51,6,97,3,76,
-    99,3,53,7,249,57,3,52,3,8,248,2,3,57,3,49,
-    1,25,3,2,3,57,2,80,52,0,53,9,246,83,3,44,
-    0,49,0,54,8,10,245,4,10,1,73,9,2,0,57,2,
-    53,7,249,57,5,52,5,8,244,2,5,57,5,49,1,63,
-    2,5,2,5,97,3,80,5,0,99,3,49,2,76,114,81,
-    2,0,0,99,121,0,0,0,3,0,0,0,3,0,0,0,
-    3,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,
-    3,0,0,0,13,0,0,0,9,0,0,0,8,0,0,0,
+    0,0,193,32,1,0,0,10,32,32,32,32,32,32,32,32,
+    70,105,110,100,32,100,105,115,116,114,105,98,117,116,105,111,
+    110,115,46,10,10,32,32,32,32,32,32,32,32,82,101,116,
+    117,114,110,32,97,110,32,105,116,101,114,97,98,108,101,32,
+    111,102,32,97,108,108,32,68,105,115,116,114,105,98,117,116,
+    105,111,110,32,105,110,115,116,97,110,99,101,115,32,99,97,
+    112,97,98,108,101,32,111,102,10,32,32,32,32,32,32,32,
+    32,108,111,97,100,105,110,103,32,116,104,101,32,109,101,116,
+    97,100,97,116,97,32,102,111,114,32,112,97,99,107,97,103,
+    101,115,32,109,97,116,99,104,105,110,103,32,96,96,99,111,
+    110,116,101,120,116,46,110,97,109,101,96,96,10,32,32,32,
+    32,32,32,32,32,40,111,114,32,97,108,108,32,110,97,109,
+    101,115,32,105,102,32,96,96,78,111,110,101,96,96,32,105,
+    110,100,105,99,97,116,101,100,41,32,97,108,111,110,103,32,
+    116,104,101,32,112,97,116,104,115,32,105,110,32,116,104,101,
+    32,108,105,115,116,10,32,32,32,32,32,32,32,32,111,102,
+    32,100,105,114,101,99,116,111,114,105,101,115,32,96,96,99,
+    111,110,116,101,120,116,46,112,97,116,104,96,96,46,10,32,
+    32,32,32,32,32,32,32,218,29,80,97,116,104,70,105,110,
+    100,101,114,46,102,105,110,100,95,100,105,115,116,114,105,98,
+    117,116,105,111,110,115,169,3,218,18,105,109,112,111,114,116,
+    108,105,98,46,109,101,116,97,100,97,116,97,169,1,218,18,
+    77,101,116,97,100,97,116,97,80,97,116,104,70,105,110,100,
+    101,114,114,4,0,0,0,114,107,2,0,0,218,18,102,105,
+    110,100,95,100,105,115,116,114,105,98,117,116,105,111,110,115,
+    181,5,0,0,41,4,114,94,1,0,0,114,231,0,0,0,
+    114,232,0,0,0,114,107,2,0,0,114,31,0,0,0,114,
+    31,0,0,0,114,32,0,0,0,114,108,2,0,0,115,6,
+    0,0,0,2,0,0,10,11,1,6,10,89,2,57,4,90,
+    4,3,57,3,2,4,52,3,4,255,57,9,4,4,1,4,
+    5,2,72,10,76,114,108,2,0,0,48,5,0,0,41,9,
+    114,114,1,0,0,114,77,2,0,0,114,84,2,0,0,114,
+    88,2,0,0,114,90,2,0,0,114,97,2,0,0,114,110,
+    1,0,0,114,113,1,0,0,114,108,2,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,32,0,0,0,114,70,2,0,
+    0,115,38,0,0,0,2,0,9,2,2,254,2,4,5,1,
+    10,9,5,1,10,12,5,1,10,21,5,1,10,14,5,1,
+    16,31,5,1,22,23,5,1,16,12,5,1,6,15,50,0,
+    254,58,1,51,2,58,3,51,4,58,5,50,6,252,57,12,
+    107,7,57,13,71,13,1,0,58,8,50,6,252,57,12,107,
+    9,57,13,71,13,1,0,58,10,50,6,252,57,12,107,11,
+    57,13,71,13,1,0,58,12,50,6,252,57,12,107,13,57,
+    13,71,13,1,0,58,14,50,6,252,121,12,122,15,57,13,
+    107,16,2,13,57,13,71,13,1,0,58,17,50,6,252,121,
+    12,122,15,121,13,122,15,57,14,107,18,2,14,2,13,57,
+    13,71,13,1,0,58,19,50,6,252,121,12,122,15,57,13,
+    107,20,2,13,57,13,71,13,1,0,58,21,50,6,252,57,
+    12,107,22,57,13,71,13,1,0,58,23,51,15,76,114,70,
+    2,0,0,99,72,0,0,0,0,0,128,0,0,0,0,0,
+    0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,14,0,0,0,26,0,0,0,6,0,0,0,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    78,218,27,80,97,116,104,70,105,110,100,101,114,46,95,108,
-    101,103,97,99,121,95,103,101,116,95,115,112,101,99,114,242,
-    0,0,0,114,251,0,0,0,114,112,1,0,0,114,234,0,
-    0,0,114,107,1,0,0,114,69,1,0,0,114,75,1,0,
-    0,80,5,0,0,41,6,114,93,1,0,0,114,254,0,0,
-    0,114,71,2,0,0,114,255,0,0,0,114,0,1,0,0,
-    114,77,1,0,0,114,31,0,0,0,114,31,0,0,0,114,
-    32,0,0,0,218,16,95,108,101,103,97,99,121,95,103,101,
-    116,95,115,112,101,99,115,20,0,0,0,2,0,0,4,19,
-    1,26,2,15,1,5,1,8,1,18,1,20,1,5,1,6,
-    13,53,2,254,57,9,4,10,2,51,3,57,11,71,10,2,
-    0,84,29,0,49,2,54,9,3,253,4,11,1,73,10,2,
-    0,106,6,2,0,5,3,7,5,4,6,80,23,0,49,2,
-    54,9,4,252,4,11,1,73,10,2,0,57,3,94,6,0,
-    57,4,51,0,33,3,17,84,21,0,53,5,250,54,9,6,
-    249,4,11,1,4,12,3,73,10,3,0,76,53,5,250,54,
-    9,7,248,4,11,1,51,0,57,12,73,10,3,0,57,5,
-    49,4,59,5,8,49,5,76,114,83,2,0,0,78,99,235,
-    0,0,0,4,0,0,0,3,0,0,0,4,0,0,0,9,
-    0,0,0,1,0,0,0,0,0,0,0,4,0,0,0,17,
-    0,0,0,17,0,0,0,19,0,0,0,0,0,0,0,1,
-    0,0,0,0,0,0,0,0,0,0,0,218,63,70,105,110,
-    100,32,116,104,101,32,108,111,97,100,101,114,32,111,114,32,
-    110,97,109,101,115,112,97,99,101,95,112,97,116,104,32,102,
-    111,114,32,116,104,105,115,32,109,111,100,117,108,101,47,112,
-    97,99,107,97,103,101,32,110,97,109,101,46,218,20,80,97,
-    116,104,70,105,110,100,101,114,46,95,103,101,116,95,115,112,
-    101,99,114,35,1,0,0,114,170,0,0,0,218,5,98,121,
-    116,101,115,114,81,2,0,0,78,114,242,0,0,0,114,109,
-    1,0,0,114,83,2,0,0,114,255,0,0,0,114,75,1,
-    0,0,114,226,0,0,0,218,19,115,112,101,99,32,109,105,
-    115,115,105,110,103,32,108,111,97,100,101,114,114,44,1,0,
-    0,114,234,0,0,0,114,69,1,0,0,13,0,0,0,3,
-    0,0,0,95,5,0,0,41,9,114,93,1,0,0,114,254,
-    0,0,0,114,90,0,0,0,114,108,1,0,0,218,14,110,
-    97,109,101,115,112,97,99,101,95,112,97,116,104,218,5,101,
-    110,116,114,121,114,71,2,0,0,114,77,1,0,0,114,0,
-    1,0,0,114,31,0,0,0,114,31,0,0,0,114,32,0,
-    0,0,218,9,95,103,101,116,95,115,112,101,99,115,44,0,
-    0,0,2,0,0,5,5,1,9,1,31,1,3,1,15,1,
-    8,1,19,1,21,2,18,1,7,1,3,1,16,1,5,1,
-    6,1,7,1,14,5,14,236,4,22,20,1,5,1,6,17,
-    94,9,0,57,4,49,2,86,9,80,192,0,57,5,53,2,
-    254,57,13,4,14,5,53,3,252,57,15,53,4,250,57,16,
-    93,15,2,57,15,71,14,2,0,16,84,6,0,80,156,0,
-    49,0,54,13,5,249,4,15,5,73,14,2,0,57,6,51,
-    6,33,6,17,84,133,0,53,7,247,57,13,4,14,6,51,
-    8,57,15,71,14,2,0,84,24,0,49,6,54,13,8,246,
-    4,15,1,4,16,3,73,14,3,0,57,7,80,21,0,49,
-    0,54,13,9,245,4,15,1,4,16,6,73,14,3,0,57,
-    7,51,6,33,7,84,6,0,80,65,0,52,7,10,244,57,
-    10,51,6,33,10,17,2,10,84,8,0,49,7,2,9,76,
-    52,7,11,243,57,8,51,6,33,8,84,17,0,53,12,241,
-    57,13,51,13,57,14,71,14,1,0,77,49,4,54,13,14,
-    240,4,15,8,73,14,2,0,1,88,9,67,255,53,15,238,
-    54,12,16,237,4,14,1,51,6,57,15,73,13,3,0,57,
-    7,49,4,59,7,11,49,7,76,114,90,2,0,0,99,117,
-    0,0,0,4,0,0,0,3,0,0,0,4,0,0,0,6,
-    0,0,0,2,0,0,0,0,0,0,0,4,0,0,0,14,
-    0,0,0,10,0,0,0,9,0,0,0,0,0,0,0,2,
-    0,0,0,0,0,0,0,0,0,0,0,218,141,84,114,121,
-    32,116,111,32,102,105,110,100,32,97,32,115,112,101,99,32,
-    102,111,114,32,39,102,117,108,108,110,97,109,101,39,32,111,
-    110,32,115,121,115,46,112,97,116,104,32,111,114,32,39,112,
-    97,116,104,39,46,10,10,32,32,32,32,32,32,32,32,84,
-    104,101,32,115,101,97,114,99,104,32,105,115,32,98,97,115,
-    101,100,32,111,110,32,115,121,115,46,112,97,116,104,95,104,
-    111,111,107,115,32,97,110,100,32,115,121,115,46,112,97,116,
-    104,95,105,109,112,111,114,116,101,114,95,99,97,99,104,101,
-    46,10,32,32,32,32,32,32,32,32,218,20,80,97,116,104,
-    70,105,110,100,101,114,46,102,105,110,100,95,115,112,101,99,
-    78,114,8,0,0,0,114,90,0,0,0,114,90,2,0,0,
-    114,255,0,0,0,114,75,1,0,0,114,71,1,0,0,114,
-    8,2,0,0,13,0,0,0,2,0,0,0,14,0,0,0,
-    3,0,0,0,127,5,0,0,41,6,114,93,1,0,0,114,
-    254,0,0,0,114,90,0,0,0,114,108,1,0,0,114,77,
-    1,0,0,114,88,2,0,0,114,31,0,0,0,114,31,0,
-    0,0,114,32,0,0,0,114,109,1,0,0,115,28,0,0,
-    0,2,0,0,6,7,1,13,1,21,1,7,1,3,1,15,
-    1,6,1,5,3,5,1,24,1,3,2,3,2,6,14,51,
-    2,33,2,84,16,0,53,3,254,57,6,52,6,4,253,2,
-    6,57,2,49,0,54,9,5,252,4,11,1,4,12,2,4,
-    13,3,73,10,4,0,57,4,51,2,33,4,84,6,0,51,
-    2,76,52,4,6,251,57,6,51,2,33,6,2,6,84,49,
-    0,52,4,7,250,57,5,49,5,84,35,0,51,2,59,4,
-    8,53,9,248,57,9,4,10,1,4,11,5,52,0,5,247,
-    57,12,71,10,3,0,59,4,7,49,4,76,51,2,76,49,
-    4,76,114,109,1,0,0,99,35,0,0,0,3,0,0,0,
-    3,0,0,0,3,0,0,0,4,0,0,0,1,0,0,0,
-    0,0,0,0,3,0,0,0,11,0,0,0,5,0,0,0,
-    2,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
-    0,0,0,0,218,170,102,105,110,100,32,116,104,101,32,109,
-    111,100,117,108,101,32,111,110,32,115,121,115,46,112,97,116,
-    104,32,111,114,32,39,112,97,116,104,39,32,98,97,115,101,
-    100,32,111,110,32,115,121,115,46,112,97,116,104,95,104,111,
-    111,107,115,32,97,110,100,10,32,32,32,32,32,32,32,32,
-    115,121,115,46,112,97,116,104,95,105,109,112,111,114,116,101,
-    114,95,99,97,99,104,101,46,10,10,32,32,32,32,32,32,
-    32,32,84,104,105,115,32,109,101,116,104,111,100,32,105,115,
-    32,100,101,112,114,101,99,97,116,101,100,46,32,32,85,115,
-    101,32,102,105,110,100,95,115,112,101,99,40,41,32,105,110,
-    115,116,101,97,100,46,10,10,32,32,32,32,32,32,32,32,
-    218,22,80,97,116,104,70,105,110,100,101,114,46,102,105,110,
-    100,95,109,111,100,117,108,101,114,109,1,0,0,78,114,255,
-    0,0,0,13,0,0,0,2,0,0,0,151,5,0,0,41,
-    4,114,93,1,0,0,114,254,0,0,0,114,90,0,0,0,
-    114,77,1,0,0,114,31,0,0,0,114,31,0,0,0,114,
-    32,0,0,0,114,112,1,0,0,115,10,0,0,0,2,0,
-    0,8,18,1,7,1,3,1,6,11,49,0,54,7,2,255,
-    4,9,1,4,10,2,73,8,3,0,57,3,51,3,33,3,
-    84,6,0,51,3,76,52,3,4,254,76,114,112,1,0,0,
-    99,28,0,0,0,1,0,5,0,15,0,0,0,1,0,0,
-    0,4,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
-    0,10,0,0,0,5,0,0,0,1,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,193,32,1,
-    0,0,10,32,32,32,32,32,32,32,32,70,105,110,100,32,
-    100,105,115,116,114,105,98,117,116,105,111,110,115,46,10,10,
-    32,32,32,32,32,32,32,32,82,101,116,117,114,110,32,97,
-    110,32,105,116,101,114,97,98,108,101,32,111,102,32,97,108,
-    108,32,68,105,115,116,114,105,98,117,116,105,111,110,32,105,
-    110,115,116,97,110,99,101,115,32,99,97,112,97,98,108,101,
-    32,111,102,10,32,32,32,32,32,32,32,32,108,111,97,100,
-    105,110,103,32,116,104,101,32,109,101,116,97,100,97,116,97,
-    32,102,111,114,32,112,97,99,107,97,103,101,115,32,109,97,
-    116,99,104,105,110,103,32,96,96,99,111,110,116,101,120,116,
-    46,110,97,109,101,96,96,10,32,32,32,32,32,32,32,32,
-    40,111,114,32,97,108,108,32,110,97,109,101,115,32,105,102,
-    32,96,96,78,111,110,101,96,96,32,105,110,100,105,99,97,
-    116,101,100,41,32,97,108,111,110,103,32,116,104,101,32,112,
-    97,116,104,115,32,105,110,32,116,104,101,32,108,105,115,116,
-    10,32,32,32,32,32,32,32,32,111,102,32,100,105,114,101,
-    99,116,111,114,105,101,115,32,96,96,99,111,110,116,101,120,
-    116,46,112,97,116,104,96,96,46,10,32,32,32,32,32,32,
-    32,32,218,29,80,97,116,104,70,105,110,100,101,114,46,102,
-    105,110,100,95,100,105,115,116,114,105,98,117,116,105,111,110,
-    115,169,3,218,18,105,109,112,111,114,116,108,105,98,46,109,
-    101,116,97,100,97,116,97,169,1,218,18,77,101,116,97,100,
-    97,116,97,80,97,116,104,70,105,110,100,101,114,114,4,0,
-    0,0,114,100,2,0,0,218,18,102,105,110,100,95,100,105,
-    115,116,114,105,98,117,116,105,111,110,115,164,5,0,0,41,
-    4,114,93,1,0,0,114,230,0,0,0,114,231,0,0,0,
-    114,100,2,0,0,114,31,0,0,0,114,31,0,0,0,114,
-    32,0,0,0,114,101,2,0,0,115,6,0,0,0,2,0,
-    0,10,11,1,6,10,89,2,57,4,90,4,3,57,3,2,
-    4,52,3,4,255,57,9,4,4,1,4,5,2,72,10,76,
-    114,101,2,0,0,31,5,0,0,41,9,114,113,1,0,0,
-    114,70,2,0,0,114,77,2,0,0,114,81,2,0,0,114,
-    83,2,0,0,114,90,2,0,0,114,109,1,0,0,114,112,
-    1,0,0,114,101,2,0,0,114,31,0,0,0,114,31,0,
-    0,0,114,32,0,0,0,114,63,2,0,0,115,38,0,0,
-    0,2,0,9,2,2,254,2,4,5,1,10,9,5,1,10,
-    12,5,1,10,21,5,1,10,14,5,1,16,31,5,1,22,
-    23,5,1,16,12,5,1,6,15,50,0,254,58,1,51,2,
-    58,3,51,4,58,5,50,6,252,57,12,107,7,57,13,71,
-    13,1,0,58,8,50,6,252,57,12,107,9,57,13,71,13,
-    1,0,58,10,50,6,252,57,12,107,11,57,13,71,13,1,
-    0,58,12,50,6,252,57,12,107,13,57,13,71,13,1,0,
-    58,14,50,6,252,57,12,51,15,57,13,107,16,2,13,57,
-    13,71,13,1,0,58,17,50,6,252,57,12,51,15,57,13,
-    51,15,57,14,107,18,2,14,2,13,57,13,71,13,1,0,
-    58,19,50,6,252,57,12,51,15,57,13,107,20,2,13,57,
-    13,71,13,1,0,58,21,50,6,252,57,12,107,22,57,13,
-    71,13,1,0,58,23,51,15,76,114,63,2,0,0,99,72,
-    0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,10,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,
-    0,0,0,26,0,0,0,6,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,114,240,0,0,0,
-    114,239,0,0,0,218,10,70,105,108,101,70,105,110,100,101,
-    114,114,241,0,0,0,218,172,70,105,108,101,45,98,97,115,
-    101,100,32,102,105,110,100,101,114,46,10,10,32,32,32,32,
-    73,110,116,101,114,97,99,116,105,111,110,115,32,119,105,116,
-    104,32,116,104,101,32,102,105,108,101,32,115,121,115,116,101,
-    109,32,97,114,101,32,99,97,99,104,101,100,32,102,111,114,
-    32,112,101,114,102,111,114,109,97,110,99,101,44,32,98,101,
-    105,110,103,10,32,32,32,32,114,101,102,114,101,115,104,101,
-    100,32,119,104,101,110,32,116,104,101,32,100,105,114,101,99,
-    116,111,114,121,32,116,104,101,32,102,105,110,100,101,114,32,
-    105,115,32,104,97,110,100,108,105,110,103,32,104,97,115,32,
-    98,101,101,110,32,109,111,100,105,102,105,101,100,46,10,10,
-    32,32,32,32,114,1,0,0,0,99,154,0,0,0,2,0,
-    9,0,7,0,0,0,2,0,0,0,6,0,0,0,0,0,
-    0,0,0,0,0,0,2,0,0,0,17,0,0,0,17,0,
-    0,0,12,0,0,0,1,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,218,154,73,110,105,116,105,97,108,105,
-    122,101,32,119,105,116,104,32,116,104,101,32,112,97,116,104,
-    32,116,111,32,115,101,97,114,99,104,32,111,110,32,97,110,
-    100,32,97,32,118,97,114,105,97,98,108,101,32,110,117,109,
-    98,101,114,32,111,102,10,32,32,32,32,32,32,32,32,50,
-    45,116,117,112,108,101,115,32,99,111,110,116,97,105,110,105,
-    110,103,32,116,104,101,32,108,111,97,100,101,114,32,97,110,
-    100,32,116,104,101,32,102,105,108,101,32,115,117,102,102,105,
-    120,101,115,32,116,104,101,32,108,111,97,100,101,114,10,32,
-    32,32,32,32,32,32,32,114,101,99,111,103,110,105,122,101,
-    115,46,218,19,70,105,108,101,70,105,110,100,101,114,46,95,
-    95,105,110,105,116,95,95,114,44,1,0,0,99,26,0,0,
-    0,1,0,16,1,51,0,0,0,1,0,0,0,3,0,0,
-    0,0,0,0,0,0,0,0,0,1,0,0,0,5,0,0,
-    0,2,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
-    0,0,0,0,0,0,0,0,0,78,218,38,70,105,108,101,
-    70,105,110,100,101,114,46,95,95,105,110,105,116,95,95,46,
-    60,108,111,99,97,108,115,62,46,60,103,101,110,101,120,112,
-    114,62,4,0,0,0,2,0,0,0,193,5,0,0,41,3,
-    122,2,46,48,114,1,2,0,0,114,255,0,0,0,41,1,
-    114,255,0,0,0,114,31,0,0,0,114,32,0,0,0,114,
-    27,0,0,0,115,2,0,0,0,2,0,6,5,80,17,0,
-    57,1,4,3,1,55,2,57,4,93,3,2,78,1,88,0,
-    242,255,51,0,76,218,8,95,108,111,97,100,101,114,115,114,
-    164,0,0,0,114,90,0,0,0,114,118,0,0,0,114,78,
-    0,0,0,114,18,0,0,0,114,115,0,0,0,114,211,0,
-    0,0,218,11,95,112,97,116,104,95,109,116,105,109,101,218,
-    3,115,101,116,218,11,95,112,97,116,104,95,99,97,99,104,
-    101,218,19,95,114,101,108,97,120,101,100,95,112,97,116,104,
-    95,99,97,99,104,101,78,4,0,0,0,187,5,0,0,41,
-    6,114,229,0,0,0,114,90,0,0,0,218,14,108,111,97,
-    100,101,114,95,100,101,116,97,105,108,115,218,7,108,111,97,
-    100,101,114,115,114,255,0,0,0,114,79,1,0,0,114,31,
-    0,0,0,41,1,114,255,0,0,0,114,32,0,0,0,114,
-    118,1,0,0,115,24,0,0,0,2,0,0,4,5,1,20,
-    1,25,255,4,2,5,2,11,1,19,1,31,1,5,1,12,
-    1,6,17,94,6,0,57,3,49,2,86,6,80,41,0,106,
-    7,2,0,49,8,64,4,2,8,5,5,7,49,3,54,10,
-    2,255,107,3,57,15,49,5,86,16,71,16,1,0,57,12,
-    73,11,2,0,1,88,6,218,255,49,3,59,0,4,49,1,
-    82,6,0,1,51,5,59,0,6,53,7,253,57,9,52,0,
-    6,252,57,10,71,10,1,0,16,84,34,0,53,8,250,57,
-    9,53,9,248,54,13,10,247,73,14,1,0,57,10,52,0,
-    6,246,57,11,71,10,2,0,59,0,6,51,11,59,0,12,
-    53,13,244,57,9,71,10,0,0,59,0,14,53,13,244,57,
-    9,71,10,0,0,59,0,15,51,16,76,114,118,1,0,0,
-    99,10,0,0,0,1,0,0,0,3,0,0,0,1,0,0,
-    0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
-    0,1,0,0,0,5,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,218,31,73,
-    110,118,97,108,105,100,97,116,101,32,116,104,101,32,100,105,
-    114,101,99,116,111,114,121,32,109,116,105,109,101,46,218,28,
-    70,105,108,101,70,105,110,100,101,114,46,105,110,118,97,108,
-    105,100,97,116,101,95,99,97,99,104,101,115,114,211,0,0,
-    0,114,108,2,0,0,78,203,5,0,0,41,1,114,229,0,
+    114,241,0,0,0,114,240,0,0,0,218,10,70,105,108,101,
+    70,105,110,100,101,114,114,242,0,0,0,218,172,70,105,108,
+    101,45,98,97,115,101,100,32,102,105,110,100,101,114,46,10,
+    10,32,32,32,32,73,110,116,101,114,97,99,116,105,111,110,
+    115,32,119,105,116,104,32,116,104,101,32,102,105,108,101,32,
+    115,121,115,116,101,109,32,97,114,101,32,99,97,99,104,101,
+    100,32,102,111,114,32,112,101,114,102,111,114,109,97,110,99,
+    101,44,32,98,101,105,110,103,10,32,32,32,32,114,101,102,
+    114,101,115,104,101,100,32,119,104,101,110,32,116,104,101,32,
+    100,105,114,101,99,116,111,114,121,32,116,104,101,32,102,105,
+    110,100,101,114,32,105,115,32,104,97,110,100,108,105,110,103,
+    32,104,97,115,32,98,101,101,110,32,109,111,100,105,102,105,
+    101,100,46,10,10,32,32,32,32,114,1,0,0,0,99,154,
+    0,0,0,2,0,9,0,7,0,0,0,2,0,0,0,6,
+    0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,17,
+    0,0,0,17,0,0,0,12,0,0,0,1,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,218,154,73,110,105,
+    116,105,97,108,105,122,101,32,119,105,116,104,32,116,104,101,
+    32,112,97,116,104,32,116,111,32,115,101,97,114,99,104,32,
+    111,110,32,97,110,100,32,97,32,118,97,114,105,97,98,108,
+    101,32,110,117,109,98,101,114,32,111,102,10,32,32,32,32,
+    32,32,32,32,50,45,116,117,112,108,101,115,32,99,111,110,
+    116,97,105,110,105,110,103,32,116,104,101,32,108,111,97,100,
+    101,114,32,97,110,100,32,116,104,101,32,102,105,108,101,32,
+    115,117,102,102,105,120,101,115,32,116,104,101,32,108,111,97,
+    100,101,114,10,32,32,32,32,32,32,32,32,114,101,99,111,
+    103,110,105,122,101,115,46,218,19,70,105,108,101,70,105,110,
+    100,101,114,46,95,95,105,110,105,116,95,95,114,45,1,0,
+    0,99,26,0,0,0,1,0,16,1,51,0,0,0,1,0,
+    0,0,3,0,0,0,0,0,0,0,0,0,0,0,1,0,
+    0,0,5,0,0,0,2,0,0,0,0,0,0,0,0,0,
+    0,0,1,0,0,0,0,0,0,0,0,0,0,0,78,218,
+    38,70,105,108,101,70,105,110,100,101,114,46,95,95,105,110,
+    105,116,95,95,46,60,108,111,99,97,108,115,62,46,60,103,
+    101,110,101,120,112,114,62,4,0,0,0,2,0,0,0,210,
+    5,0,0,41,3,122,2,46,48,114,8,2,0,0,114,0,
+    1,0,0,41,1,114,0,1,0,0,114,31,0,0,0,114,
+    32,0,0,0,114,27,0,0,0,115,2,0,0,0,2,0,
+    6,5,80,17,0,57,1,4,3,1,55,2,57,4,93,3,
+    2,78,1,88,0,242,255,51,0,76,218,8,95,108,111,97,
+    100,101,114,115,114,165,0,0,0,114,90,0,0,0,114,118,
+    0,0,0,114,78,0,0,0,114,18,0,0,0,114,115,0,
+    0,0,114,212,0,0,0,218,11,95,112,97,116,104,95,109,
+    116,105,109,101,218,3,115,101,116,218,11,95,112,97,116,104,
+    95,99,97,99,104,101,218,19,95,114,101,108,97,120,101,100,
+    95,112,97,116,104,95,99,97,99,104,101,78,4,0,0,0,
+    204,5,0,0,41,6,114,230,0,0,0,114,90,0,0,0,
+    218,14,108,111,97,100,101,114,95,100,101,116,97,105,108,115,
+    218,7,108,111,97,100,101,114,115,114,0,1,0,0,114,80,
+    1,0,0,114,31,0,0,0,41,1,114,0,1,0,0,114,
+    32,0,0,0,114,119,1,0,0,115,24,0,0,0,2,0,
+    0,4,5,1,20,1,25,255,4,2,5,2,11,1,19,1,
+    31,1,5,1,12,1,6,17,94,6,0,120,3,49,2,86,
+    6,80,41,0,106,7,2,0,49,8,64,4,2,8,5,5,
+    7,49,3,54,10,2,255,107,3,120,15,49,5,86,16,71,
+    16,1,0,57,12,73,11,2,0,1,88,6,218,255,49,3,
+    59,0,4,49,1,82,6,0,1,51,5,59,0,6,53,7,
+    253,57,9,52,0,6,252,57,10,71,10,1,0,16,84,34,
+    0,53,8,250,57,9,53,9,248,54,13,10,247,73,14,1,
+    0,57,10,52,0,6,246,57,11,71,10,2,0,59,0,6,
+    51,11,59,0,12,53,13,244,57,9,71,10,0,0,59,0,
+    14,53,13,244,57,9,71,10,0,0,59,0,15,51,16,76,
+    114,119,1,0,0,99,10,0,0,0,1,0,0,0,3,0,
+    0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,
+    0,0,1,0,0,0,1,0,0,0,5,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,218,31,73,110,118,97,108,105,100,97,116,101,32,116,
+    104,101,32,100,105,114,101,99,116,111,114,121,32,109,116,105,
+    109,101,46,218,28,70,105,108,101,70,105,110,100,101,114,46,
+    105,110,118,97,108,105,100,97,116,101,95,99,97,99,104,101,
+    115,114,212,0,0,0,114,115,2,0,0,78,220,5,0,0,
+    41,1,114,230,0,0,0,114,31,0,0,0,114,31,0,0,
+    0,114,32,0,0,0,114,77,2,0,0,115,4,0,0,0,
+    2,0,0,2,6,1,51,2,59,0,3,51,4,76,114,77,
+    2,0,0,114,251,0,0,0,114,113,1,0,0,99,60,0,
+    0,0,2,0,0,0,3,0,0,0,2,0,0,0,3,0,
+    0,0,0,0,0,0,0,0,0,0,2,0,0,0,9,0,
+    0,0,6,0,0,0,3,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,218,197,84,114,121,32,
+    116,111,32,102,105,110,100,32,97,32,108,111,97,100,101,114,
+    32,102,111,114,32,116,104,101,32,115,112,101,99,105,102,105,
+    101,100,32,109,111,100,117,108,101,44,32,111,114,32,116,104,
+    101,32,110,97,109,101,115,112,97,99,101,10,32,32,32,32,
+    32,32,32,32,112,97,99,107,97,103,101,32,112,111,114,116,
+    105,111,110,115,46,32,82,101,116,117,114,110,115,32,40,108,
+    111,97,100,101,114,44,32,108,105,115,116,45,111,102,45,112,
+    111,114,116,105,111,110,115,41,46,10,10,32,32,32,32,32,
+    32,32,32,84,104,105,115,32,109,101,116,104,111,100,32,105,
+    115,32,100,101,112,114,101,99,97,116,101,100,46,32,32,85,
+    115,101,32,102,105,110,100,95,115,112,101,99,40,41,32,105,
+    110,115,116,101,97,100,46,10,10,32,32,32,32,32,32,32,
+    32,218,22,70,105,108,101,70,105,110,100,101,114,46,102,105,
+    110,100,95,108,111,97,100,101,114,114,110,1,0,0,78,114,
+    0,1,0,0,114,76,1,0,0,226,5,0,0,41,3,114,
+    230,0,0,0,114,255,0,0,0,114,78,1,0,0,114,31,
+    0,0,0,114,31,0,0,0,114,32,0,0,0,114,252,0,
+    0,0,115,10,0,0,0,2,0,0,7,15,1,7,1,13,
+    1,6,9,49,0,54,6,2,255,4,8,1,73,7,2,0,
+    121,2,51,3,33,2,84,16,0,122,3,57,3,94,4,0,
+    57,4,93,3,2,76,52,2,4,254,57,3,52,2,5,253,
+    82,7,0,1,94,4,0,57,4,93,3,2,76,114,252,0,
+    0,0,99,43,0,0,0,6,0,0,0,3,0,0,0,6,
+    0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,6,
+    0,0,0,16,0,0,0,4,0,0,0,2,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,
+    218,20,70,105,108,101,70,105,110,100,101,114,46,95,103,101,
+    116,95,115,112,101,99,114,67,1,0,0,169,2,114,0,1,
+    0,0,114,76,1,0,0,238,5,0,0,41,7,114,230,0,
+    0,0,114,79,1,0,0,114,255,0,0,0,114,90,0,0,
+    0,218,4,115,109,115,108,114,109,1,0,0,114,0,1,0,
+    0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,
+    114,97,2,0,0,115,6,0,0,0,2,0,0,1,15,1,
+    6,16,4,10,1,4,11,2,4,12,3,71,11,2,0,57,
+    6,53,2,254,57,13,4,14,2,4,15,3,4,7,6,4,
+    8,4,122,3,57,9,71,14,2,2,76,114,97,2,0,0,
+    78,99,5,2,0,0,3,0,0,0,3,0,0,0,3,0,
+    0,0,14,0,0,0,1,0,0,0,0,0,0,0,3,0,
+    0,0,25,0,0,0,34,0,0,0,36,0,0,0,0,0,
+    0,0,1,0,0,0,2,0,0,0,0,0,0,0,218,111,
+    84,114,121,32,116,111,32,102,105,110,100,32,97,32,115,112,
+    101,99,32,102,111,114,32,116,104,101,32,115,112,101,99,105,
+    102,105,101,100,32,109,111,100,117,108,101,46,10,10,32,32,
+    32,32,32,32,32,32,82,101,116,117,114,110,115,32,116,104,
+    101,32,109,97,116,99,104,105,110,103,32,115,112,101,99,44,
+    32,111,114,32,78,111,110,101,32,105,102,32,110,111,116,32,
+    102,111,117,110,100,46,10,32,32,32,32,32,32,32,32,218,
+    20,70,105,108,101,70,105,110,100,101,114,46,102,105,110,100,
+    95,115,112,101,99,70,114,164,0,0,0,114,165,0,0,0,
+    114,76,0,0,0,114,101,0,0,0,114,90,0,0,0,114,
+    18,0,0,0,114,115,0,0,0,114,228,1,0,0,114,105,
+    0,0,0,114,212,0,0,0,114,115,2,0,0,218,11,95,
+    102,105,108,108,95,99,97,99,104,101,114,60,0,0,0,114,
+    118,2,0,0,114,209,0,0,0,114,117,2,0,0,114,78,
+    0,0,0,114,114,2,0,0,114,119,1,0,0,114,111,0,
+    0,0,114,97,2,0,0,114,114,0,0,0,114,173,0,0,
+    0,78,114,235,0,0,0,114,8,1,0,0,218,9,116,114,
+    121,105,110,103,32,123,125,169,1,218,9,118,101,114,98,111,
+    115,105,116,121,218,25,112,111,115,115,105,98,108,101,32,110,
+    97,109,101,115,112,97,99,101,32,102,111,114,32,123,125,114,
+    70,1,0,0,114,76,1,0,0,10,0,0,0,2,0,0,
+    0,30,0,0,0,73,0,0,0,91,0,0,0,14,0,0,
+    0,64,1,0,0,90,1,0,0,106,1,0,0,15,0,0,
+    0,243,5,0,0,41,14,114,230,0,0,0,114,255,0,0,
+    0,114,109,1,0,0,218,12,105,115,95,110,97,109,101,115,
+    112,97,99,101,218,11,116,97,105,108,95,109,111,100,117,108,
+    101,114,47,1,0,0,218,5,99,97,99,104,101,218,12,99,
+    97,99,104,101,95,109,111,100,117,108,101,218,9,98,97,115,
+    101,95,112,97,116,104,114,8,2,0,0,114,79,1,0,0,
+    218,13,105,110,105,116,95,102,105,108,101,110,97,109,101,218,
+    9,102,117,108,108,95,112,97,116,104,114,78,1,0,0,114,
+    31,0,0,0,114,31,0,0,0,114,32,0,0,0,114,110,
+    1,0,0,115,80,0,0,0,2,0,0,5,4,1,24,2,
+    43,1,7,1,11,1,10,1,11,1,5,2,12,1,6,1,
+    15,2,6,1,4,2,7,1,20,1,19,1,12,1,17,1,
+    15,1,33,252,4,8,14,2,19,2,26,1,7,1,9,1,
+    33,1,15,1,15,1,15,1,2,255,12,248,4,10,5,1,
+    19,1,20,1,9,1,3,1,6,25,122,2,120,3,49,1,
+    54,17,3,255,122,4,57,19,73,18,2,0,121,14,51,5,
+    25,14,2,14,57,4,53,6,253,57,17,52,0,7,252,82,
+    15,0,1,53,8,250,54,21,9,249,73,22,1,0,57,18,
+    71,18,1,0,57,14,52,14,10,248,2,14,57,5,80,21,
+    0,53,11,246,83,14,13,0,122,12,57,5,97,14,80,5,
+    0,99,14,52,0,13,245,123,3,5,84,19,0,49,0,54,
+    17,14,244,73,18,1,0,1,49,5,59,0,13,53,15,242,
+    57,17,71,18,0,0,84,24,0,52,0,16,241,120,6,49,
+    4,54,17,17,240,73,18,1,0,57,7,80,13,0,52,0,
+    18,239,120,6,49,4,120,7,49,6,34,7,84,137,0,53,
+    19,237,57,17,52,0,7,236,57,18,4,19,4,71,18,2,
+    0,57,8,52,0,20,235,86,14,80,90,0,106,15,2,0,
+    5,9,16,5,10,15,122,21,120,15,49,9,23,15,2,15,
+    57,11,53,19,237,57,18,4,19,8,4,20,11,71,19,2,
+    0,57,12,53,22,233,57,18,4,19,12,71,19,1,0,84,
+    36,0,49,0,54,18,23,232,4,20,10,4,21,1,4,22,
+    12,4,23,8,94,23,1,57,23,4,24,2,73,19,6,0,
+    2,14,76,88,14,169,255,53,24,230,57,17,4,18,8,71,
+    18,1,0,57,3,52,0,20,229,86,14,80,147,0,106,15,
+    2,0,5,9,16,5,10,15,53,19,237,57,18,52,0,7,
+    228,120,19,49,9,23,4,57,20,71,19,2,0,57,12,80,
+    19,0,53,25,226,83,15,11,0,51,26,97,15,2,14,76,
+    99,15,53,27,224,57,15,52,15,28,223,2,15,121,20,122,
+    29,57,21,4,22,12,122,5,121,15,122,30,57,16,71,21,
+    2,1,1,49,9,23,7,120,15,49,6,34,15,2,15,84,
+    47,0,53,22,233,57,18,4,19,12,71,19,1,0,84,32,
+    0,49,0,54,18,23,222,4,20,10,4,21,1,4,22,12,
+    122,26,57,23,4,24,2,73,19,6,0,2,14,76,88,14,
+    112,255,49,3,84,54,0,53,27,224,54,17,28,221,122,31,
+    57,19,4,20,8,73,18,3,0,1,53,27,224,54,17,32,
+    220,4,19,1,122,26,57,20,73,18,3,0,57,13,4,14,
+    8,94,14,1,59,13,33,49,13,76,51,26,76,114,110,1,
+    0,0,99,20,1,0,0,1,0,0,0,3,0,0,0,1,
+    0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,1,
+    0,0,0,21,0,0,0,25,0,0,0,25,0,0,0,0,
+    0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,218,
+    68,70,105,108,108,32,116,104,101,32,99,97,99,104,101,32,
+    111,102,32,112,111,116,101,110,116,105,97,108,32,109,111,100,
+    117,108,101,115,32,97,110,100,32,112,97,99,107,97,103,101,
+    115,32,102,111,114,32,116,104,105,115,32,100,105,114,101,99,
+    116,111,114,121,46,218,22,70,105,108,101,70,105,110,100,101,
+    114,46,95,102,105,108,108,95,99,97,99,104,101,114,90,0,
+    0,0,114,18,0,0,0,114,221,1,0,0,114,115,0,0,
+    0,114,216,1,0,0,218,15,80,101,114,109,105,115,115,105,
+    111,110,69,114,114,111,114,218,18,78,111,116,65,68,105,114,
+    101,99,116,111,114,121,69,114,114,111,114,114,8,0,0,0,
+    114,13,0,0,0,114,51,0,0,0,114,43,0,0,0,114,
+    116,2,0,0,114,117,2,0,0,114,199,0,0,0,114,165,
+    0,0,0,114,124,0,0,0,114,125,0,0,0,114,209,0,
+    0,0,218,3,97,100,100,114,49,0,0,0,99,33,0,0,
+    0,1,0,0,0,19,0,0,0,1,0,0,0,2,0,0,
+    0,0,0,0,0,0,0,0,0,1,0,0,0,8,0,0,
+    0,3,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,78,218,41,70,105,108,101,
+    70,105,110,100,101,114,46,95,102,105,108,108,95,99,97,99,
+    104,101,46,60,108,111,99,97,108,115,62,46,60,115,101,116,
+    99,111,109,112,62,114,209,0,0,0,67,6,0,0,41,2,
+    122,2,46,48,218,2,102,110,114,31,0,0,0,114,31,0,
+    0,0,114,32,0,0,0,114,38,0,0,0,115,2,0,0,
+    0,2,0,6,8,95,0,0,57,2,80,17,0,120,1,49,
+    1,54,6,2,255,73,7,1,0,113,2,88,0,242,255,49,
+    2,2,2,76,114,118,2,0,0,78,8,0,0,0,43,0,
+    0,0,77,0,0,0,9,0,0,0,38,6,0,0,41,9,
+    114,230,0,0,0,114,90,0,0,0,114,222,1,0,0,218,
+    21,108,111,119,101,114,95,115,117,102,102,105,120,95,99,111,
+    110,116,101,110,116,115,114,51,2,0,0,114,226,0,0,0,
+    114,28,2,0,0,114,8,2,0,0,218,8,110,101,119,95,
+    110,97,109,101,114,31,0,0,0,114,31,0,0,0,114,32,
+    0,0,0,114,130,2,0,0,115,36,0,0,0,2,0,0,
+    2,6,2,35,1,22,3,12,3,27,1,18,7,11,1,9,
+    1,27,1,5,1,30,2,4,1,14,250,4,7,5,1,27,
+    1,6,21,52,0,2,255,57,1,53,3,253,54,12,4,252,
+    49,1,82,15,0,1,53,3,253,54,17,5,251,73,18,1,
+    0,57,14,73,13,2,0,57,2,80,37,0,53,6,249,57,
+    11,53,7,247,57,12,53,8,245,57,13,93,11,3,83,9,
+    14,0,94,11,0,57,2,97,9,80,5,0,99,9,53,9,
+    243,57,9,52,9,10,242,2,9,54,12,11,241,122,12,57,
+    14,73,13,2,0,16,84,21,0,53,13,239,57,12,4,13,
+    2,71,13,1,0,59,0,14,80,112,0,53,13,239,57,12,
+    71,13,0,0,120,3,49,2,86,9,80,85,0,120,4,49,
+    4,54,13,15,238,122,16,57,15,73,14,2,0,106,10,3,
+    0,5,5,12,5,6,11,5,7,10,49,6,84,33,0,51,
+    17,54,13,18,237,4,15,5,49,7,54,19,19,236,73,20,
+    1,0,57,16,73,14,3,0,57,8,80,7,0,49,5,120,
+    8,49,3,54,13,20,235,4,15,8,73,14,2,0,1,88,
+    9,174,255,49,3,59,0,14,53,9,243,57,9,52,9,10,
+    234,2,9,54,12,11,233,53,21,231,57,14,73,13,2,0,
+    84,18,0,107,22,120,12,49,2,86,13,71,13,1,0,59,
+    0,23,51,24,76,114,130,2,0,0,114,89,1,0,0,99,
+    9,0,0,0,1,0,9,0,7,0,0,0,1,0,0,0,
+    3,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+    3,0,0,0,3,0,0,0,0,0,0,0,2,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,193,20,1,0,
+    0,65,32,99,108,97,115,115,32,109,101,116,104,111,100,32,
+    119,104,105,99,104,32,114,101,116,117,114,110,115,32,97,32,
+    99,108,111,115,117,114,101,32,116,111,32,117,115,101,32,111,
+    110,32,115,121,115,46,112,97,116,104,95,104,111,111,107,10,
+    32,32,32,32,32,32,32,32,119,104,105,99,104,32,119,105,
+    108,108,32,114,101,116,117,114,110,32,97,110,32,105,110,115,
+    116,97,110,99,101,32,117,115,105,110,103,32,116,104,101,32,
+    115,112,101,99,105,102,105,101,100,32,108,111,97,100,101,114,
+    115,32,97,110,100,32,116,104,101,32,112,97,116,104,10,32,
+    32,32,32,32,32,32,32,99,97,108,108,101,100,32,111,110,
+    32,116,104,101,32,99,108,111,115,117,114,101,46,10,10,32,
+    32,32,32,32,32,32,32,73,102,32,116,104,101,32,112,97,
+    116,104,32,99,97,108,108,101,100,32,111,110,32,116,104,101,
+    32,99,108,111,115,117,114,101,32,105,115,32,110,111,116,32,
+    97,32,100,105,114,101,99,116,111,114,121,44,32,73,109,112,
+    111,114,116,69,114,114,111,114,32,105,115,10,32,32,32,32,
+    32,32,32,32,114,97,105,115,101,100,46,10,10,32,32,32,
+    32,32,32,32,32,218,20,70,105,108,101,70,105,110,100,101,
+    114,46,112,97,116,104,95,104,111,111,107,99,66,0,0,0,
+    1,0,16,0,19,0,0,0,1,0,0,0,3,0,0,0,
+    0,0,0,0,0,0,0,0,1,0,0,0,10,0,0,0,
+    6,0,0,0,4,0,0,0,0,0,0,0,2,0,0,0,
+    0,0,0,0,0,0,0,0,218,45,80,97,116,104,32,104,
+    111,111,107,32,102,111,114,32,105,109,112,111,114,116,108,105,
+    98,46,109,97,99,104,105,110,101,114,121,46,70,105,108,101,
+    70,105,110,100,101,114,46,218,54,70,105,108,101,70,105,110,
+    100,101,114,46,112,97,116,104,95,104,111,111,107,46,60,108,
+    111,99,97,108,115,62,46,112,97,116,104,95,104,111,111,107,
+    95,102,111,114,95,70,105,108,101,70,105,110,100,101,114,114,
+    114,0,0,0,114,227,0,0,0,218,30,111,110,108,121,32,
+    100,105,114,101,99,116,111,114,105,101,115,32,97,114,101,32,
+    115,117,112,112,111,114,116,101,100,169,1,114,90,0,0,0,
+    0,0,0,0,1,0,0,0,1,0,0,0,2,0,0,0,
+    79,6,0,0,41,3,114,90,0,0,0,114,94,1,0,0,
+    114,119,2,0,0,41,2,114,94,1,0,0,114,119,2,0,
+    0,114,31,0,0,0,114,32,0,0,0,218,24,112,97,116,
+    104,95,104,111,111,107,95,102,111,114,95,70,105,108,101,70,
+    105,110,100,101,114,115,8,0,0,0,2,0,0,2,16,1,
+    21,1,6,10,53,2,254,57,6,4,7,0,71,7,1,0,
+    16,84,24,0,53,3,252,121,8,122,4,57,9,4,3,0,
+    122,5,57,4,71,9,1,1,77,55,1,57,8,4,9,0,
+    94,9,1,57,9,55,2,111,9,49,9,2,9,74,7,57,
+    3,72,9,76,0,0,0,0,1,0,0,0,69,6,0,0,
+    41,3,114,94,1,0,0,114,119,2,0,0,114,157,2,0,
+    0,114,31,0,0,0,41,2,114,94,1,0,0,114,119,2,
+    0,0,114,32,0,0,0,218,9,112,97,116,104,95,104,111,
+    111,107,115,6,0,0,0,2,0,0,10,4,6,6,3,107,
+    2,120,2,49,2,76,114,158,2,0,0,99,19,0,0,0,
+    1,0,0,0,3,0,0,0,1,0,0,0,1,0,0,0,
+    0,0,0,0,0,0,0,0,1,0,0,0,7,0,0,0,
+    5,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,78,218,19,70,105,108,101,70,
+    105,110,100,101,114,46,95,95,114,101,112,114,95,95,218,16,
+    70,105,108,101,70,105,110,100,101,114,40,123,33,114,125,41,
+    114,125,0,0,0,114,90,0,0,0,87,6,0,0,41,1,
+    114,230,0,0,0,114,31,0,0,0,114,31,0,0,0,114,
+    32,0,0,0,114,49,2,0,0,115,4,0,0,0,2,0,
+    0,1,6,7,51,2,54,4,3,255,52,0,4,254,57,6,
+    73,5,2,0,76,114,49,2,0,0,195,5,0,0,41,10,
+    114,114,1,0,0,114,119,1,0,0,114,77,2,0,0,114,
+    113,1,0,0,114,252,0,0,0,114,97,2,0,0,114,110,
+    1,0,0,114,130,2,0,0,114,158,2,0,0,114,49,2,
     0,0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,
-    0,114,70,2,0,0,115,4,0,0,0,2,0,0,2,6,
-    1,51,2,59,0,3,51,4,76,114,70,2,0,0,114,250,
-    0,0,0,114,112,1,0,0,99,60,0,0,0,2,0,0,
-    0,3,0,0,0,2,0,0,0,3,0,0,0,0,0,0,
-    0,0,0,0,0,2,0,0,0,9,0,0,0,6,0,0,
-    0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,218,197,84,114,121,32,116,111,32,102,105,
-    110,100,32,97,32,108,111,97,100,101,114,32,102,111,114,32,
-    116,104,101,32,115,112,101,99,105,102,105,101,100,32,109,111,
-    100,117,108,101,44,32,111,114,32,116,104,101,32,110,97,109,
-    101,115,112,97,99,101,10,32,32,32,32,32,32,32,32,112,
-    97,99,107,97,103,101,32,112,111,114,116,105,111,110,115,46,
-    32,82,101,116,117,114,110,115,32,40,108,111,97,100,101,114,
-    44,32,108,105,115,116,45,111,102,45,112,111,114,116,105,111,
-    110,115,41,46,10,10,32,32,32,32,32,32,32,32,84,104,
-    105,115,32,109,101,116,104,111,100,32,105,115,32,100,101,112,
-    114,101,99,97,116,101,100,46,32,32,85,115,101,32,102,105,
-    110,100,95,115,112,101,99,40,41,32,105,110,115,116,101,97,
-    100,46,10,10,32,32,32,32,32,32,32,32,218,22,70,105,
-    108,101,70,105,110,100,101,114,46,102,105,110,100,95,108,111,
-    97,100,101,114,114,109,1,0,0,78,114,255,0,0,0,114,
-    75,1,0,0,209,5,0,0,41,3,114,229,0,0,0,114,
-    254,0,0,0,114,77,1,0,0,114,31,0,0,0,114,31,
-    0,0,0,114,32,0,0,0,114,251,0,0,0,115,10,0,
-    0,0,2,0,0,7,15,1,7,1,13,1,6,9,49,0,
-    54,6,2,255,4,8,1,73,7,2,0,57,2,51,3,33,
-    2,84,16,0,51,3,57,3,94,4,0,57,4,93,3,2,
-    76,52,2,4,254,57,3,52,2,5,253,82,7,0,1,94,
-    4,0,57,4,93,3,2,76,114,251,0,0,0,99,43,0,
-    0,0,6,0,0,0,3,0,0,0,6,0,0,0,7,0,
-    0,0,0,0,0,0,0,0,0,0,6,0,0,0,16,0,
-    0,0,4,0,0,0,2,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,78,218,20,70,105,108,
-    101,70,105,110,100,101,114,46,95,103,101,116,95,115,112,101,
-    99,114,66,1,0,0,169,2,114,255,0,0,0,114,75,1,
-    0,0,221,5,0,0,41,7,114,229,0,0,0,114,78,1,
-    0,0,114,254,0,0,0,114,90,0,0,0,218,4,115,109,
-    115,108,114,108,1,0,0,114,255,0,0,0,114,31,0,0,
-    0,114,31,0,0,0,114,32,0,0,0,114,90,2,0,0,
-    115,6,0,0,0,2,0,0,1,15,1,6,16,4,10,1,
-    4,11,2,4,12,3,71,11,2,0,57,6,53,2,254,57,
-    13,4,14,2,4,15,3,4,7,6,4,8,4,51,3,57,
-    9,71,14,2,2,76,114,90,2,0,0,78,99,5,2,0,
-    0,3,0,0,0,3,0,0,0,3,0,0,0,14,0,0,
-    0,1,0,0,0,0,0,0,0,3,0,0,0,25,0,0,
-    0,34,0,0,0,36,0,0,0,0,0,0,0,1,0,0,
-    0,2,0,0,0,0,0,0,0,218,111,84,114,121,32,116,
-    111,32,102,105,110,100,32,97,32,115,112,101,99,32,102,111,
-    114,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,
-    109,111,100,117,108,101,46,10,10,32,32,32,32,32,32,32,
-    32,82,101,116,117,114,110,115,32,116,104,101,32,109,97,116,
-    99,104,105,110,103,32,115,112,101,99,44,32,111,114,32,78,
-    111,110,101,32,105,102,32,110,111,116,32,102,111,117,110,100,
-    46,10,32,32,32,32,32,32,32,32,218,20,70,105,108,101,
-    70,105,110,100,101,114,46,102,105,110,100,95,115,112,101,99,
-    70,114,163,0,0,0,114,164,0,0,0,114,76,0,0,0,
-    114,101,0,0,0,114,90,0,0,0,114,18,0,0,0,114,
-    115,0,0,0,114,221,1,0,0,114,105,0,0,0,114,211,
-    0,0,0,114,108,2,0,0,218,11,95,102,105,108,108,95,
-    99,97,99,104,101,114,60,0,0,0,114,111,2,0,0,114,
-    208,0,0,0,114,110,2,0,0,114,78,0,0,0,114,107,
-    2,0,0,114,118,1,0,0,114,111,0,0,0,114,90,2,
-    0,0,114,114,0,0,0,114,172,0,0,0,78,114,234,0,
-    0,0,114,7,1,0,0,218,9,116,114,121,105,110,103,32,
-    123,125,169,1,218,9,118,101,114,98,111,115,105,116,121,218,
-    25,112,111,115,115,105,98,108,101,32,110,97,109,101,115,112,
-    97,99,101,32,102,111,114,32,123,125,114,69,1,0,0,114,
-    75,1,0,0,10,0,0,0,2,0,0,0,30,0,0,0,
-    73,0,0,0,91,0,0,0,14,0,0,0,64,1,0,0,
-    90,1,0,0,106,1,0,0,15,0,0,0,226,5,0,0,
-    41,14,114,229,0,0,0,114,254,0,0,0,114,108,1,0,
-    0,218,12,105,115,95,110,97,109,101,115,112,97,99,101,218,
-    11,116,97,105,108,95,109,111,100,117,108,101,114,46,1,0,
-    0,218,5,99,97,99,104,101,218,12,99,97,99,104,101,95,
-    109,111,100,117,108,101,218,9,98,97,115,101,95,112,97,116,
-    104,114,1,2,0,0,114,78,1,0,0,218,13,105,110,105,
-    116,95,102,105,108,101,110,97,109,101,218,9,102,117,108,108,
-    95,112,97,116,104,114,77,1,0,0,114,31,0,0,0,114,
-    31,0,0,0,114,32,0,0,0,114,109,1,0,0,115,80,
-    0,0,0,2,0,0,5,4,1,24,2,43,1,7,1,11,
-    1,10,1,11,1,5,2,12,1,6,1,15,2,6,1,4,
-    2,7,1,20,1,19,1,12,1,17,1,15,1,33,252,4,
-    8,14,2,19,2,26,1,7,1,9,1,33,1,15,1,15,
-    1,15,1,2,255,12,248,4,10,5,1,19,1,20,1,9,
-    1,3,1,6,25,51,2,57,3,49,1,54,17,3,255,51,
-    4,57,19,73,18,2,0,57,14,51,5,25,14,2,14,57,
-    4,53,6,253,57,17,52,0,7,252,82,15,0,1,53,8,
-    250,54,21,9,249,73,22,1,0,57,18,71,18,1,0,57,
-    14,52,14,10,248,2,14,57,5,80,21,0,53,11,246,83,
-    14,13,0,51,12,57,5,97,14,80,5,0,99,14,52,0,
-    13,245,35,3,5,84,19,0,49,0,54,17,14,244,73,18,
-    1,0,1,49,5,59,0,13,53,15,242,57,17,71,18,0,
-    0,84,24,0,52,0,16,241,57,6,49,4,54,17,17,240,
-    73,18,1,0,57,7,80,13,0,52,0,18,239,57,6,49,
-    4,57,7,49,6,34,7,84,137,0,53,19,237,57,17,52,
-    0,7,236,57,18,4,19,4,71,18,2,0,57,8,52,0,
-    20,235,86,14,80,90,0,106,15,2,0,5,9,16,5,10,
-    15,51,21,57,15,49,9,23,15,2,15,57,11,53,19,237,
-    57,18,4,19,8,4,20,11,71,19,2,0,57,12,53,22,
-    233,57,18,4,19,12,71,19,1,0,84,36,0,49,0,54,
-    18,23,232,4,20,10,4,21,1,4,22,12,4,23,8,94,
-    23,1,57,23,4,24,2,73,19,6,0,2,14,76,88,14,
-    169,255,53,24,230,57,17,4,18,8,71,18,1,0,57,3,
-    52,0,20,229,86,14,80,147,0,106,15,2,0,5,9,16,
-    5,10,15,53,19,237,57,18,52,0,7,228,57,19,49,9,
-    23,4,57,20,71,19,2,0,57,12,80,19,0,53,25,226,
-    83,15,11,0,51,26,97,15,2,14,76,99,15,53,27,224,
-    57,15,52,15,28,223,2,15,57,20,51,29,57,21,4,22,
-    12,51,5,57,15,51,30,57,16,71,21,2,1,1,49,9,
-    23,7,57,15,49,6,34,15,2,15,84,47,0,53,22,233,
-    57,18,4,19,12,71,19,1,0,84,32,0,49,0,54,18,
-    23,222,4,20,10,4,21,1,4,22,12,51,26,57,23,4,
-    24,2,73,19,6,0,2,14,76,88,14,112,255,49,3,84,
-    54,0,53,27,224,54,17,28,221,51,31,57,19,4,20,8,
-    73,18,3,0,1,53,27,224,54,17,32,220,4,19,1,51,
-    26,57,20,73,18,3,0,57,13,4,14,8,94,14,1,59,
-    13,33,49,13,76,51,26,76,114,109,1,0,0,99,20,1,
-    0,0,1,0,0,0,3,0,0,0,1,0,0,0,9,0,
-    0,0,0,0,0,0,0,0,0,0,1,0,0,0,21,0,
-    0,0,25,0,0,0,25,0,0,0,0,0,0,0,0,0,
-    0,0,1,0,0,0,0,0,0,0,218,68,70,105,108,108,
-    32,116,104,101,32,99,97,99,104,101,32,111,102,32,112,111,
-    116,101,110,116,105,97,108,32,109,111,100,117,108,101,115,32,
-    97,110,100,32,112,97,99,107,97,103,101,115,32,102,111,114,
-    32,116,104,105,115,32,100,105,114,101,99,116,111,114,121,46,
-    218,22,70,105,108,101,70,105,110,100,101,114,46,95,102,105,
-    108,108,95,99,97,99,104,101,114,90,0,0,0,114,18,0,
-    0,0,114,214,1,0,0,114,115,0,0,0,114,209,1,0,
-    0,218,15,80,101,114,109,105,115,115,105,111,110,69,114,114,
-    111,114,218,18,78,111,116,65,68,105,114,101,99,116,111,114,
-    121,69,114,114,111,114,114,8,0,0,0,114,13,0,0,0,
-    114,51,0,0,0,114,43,0,0,0,114,109,2,0,0,114,
-    110,2,0,0,114,198,0,0,0,114,164,0,0,0,114,124,
-    0,0,0,114,125,0,0,0,114,208,0,0,0,218,3,97,
-    100,100,114,49,0,0,0,99,33,0,0,0,1,0,0,0,
-    19,0,0,0,1,0,0,0,2,0,0,0,0,0,0,0,
-    0,0,0,0,1,0,0,0,8,0,0,0,3,0,0,0,
-    1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,78,218,41,70,105,108,101,70,105,110,100,101,
-    114,46,95,102,105,108,108,95,99,97,99,104,101,46,60,108,
-    111,99,97,108,115,62,46,60,115,101,116,99,111,109,112,62,
-    114,208,0,0,0,50,6,0,0,41,2,122,2,46,48,218,
-    2,102,110,114,31,0,0,0,114,31,0,0,0,114,32,0,
-    0,0,114,38,0,0,0,115,2,0,0,0,2,0,6,8,
-    95,0,0,57,2,80,17,0,57,1,49,1,54,6,2,255,
-    73,7,1,0,113,2,88,0,242,255,49,2,2,2,76,114,
-    111,2,0,0,78,8,0,0,0,43,0,0,0,77,0,0,
-    0,9,0,0,0,21,6,0,0,41,9,114,229,0,0,0,
-    114,90,0,0,0,114,215,1,0,0,218,21,108,111,119,101,
-    114,95,115,117,102,102,105,120,95,99,111,110,116,101,110,116,
-    115,114,44,2,0,0,114,225,0,0,0,114,21,2,0,0,
-    114,1,2,0,0,218,8,110,101,119,95,110,97,109,101,114,
-    31,0,0,0,114,31,0,0,0,114,32,0,0,0,114,123,
-    2,0,0,115,36,0,0,0,2,0,0,2,6,2,35,1,
-    22,3,12,3,27,1,18,7,11,1,9,1,27,1,5,1,
-    30,2,4,1,14,250,4,7,5,1,27,1,6,21,52,0,
-    2,255,57,1,53,3,253,54,12,4,252,49,1,82,15,0,
-    1,53,3,253,54,17,5,251,73,18,1,0,57,14,73,13,
-    2,0,57,2,80,37,0,53,6,249,57,11,53,7,247,57,
-    12,53,8,245,57,13,93,11,3,83,9,14,0,94,11,0,
-    57,2,97,9,80,5,0,99,9,53,9,243,57,9,52,9,
-    10,242,2,9,54,12,11,241,51,12,57,14,73,13,2,0,
-    16,84,21,0,53,13,239,57,12,4,13,2,71,13,1,0,
-    59,0,14,80,112,0,53,13,239,57,12,71,13,0,0,57,
-    3,49,2,86,9,80,85,0,57,4,49,4,54,13,15,238,
-    51,16,57,15,73,14,2,0,106,10,3,0,5,5,12,5,
-    6,11,5,7,10,49,6,84,33,0,51,17,54,13,18,237,
-    4,15,5,49,7,54,19,19,236,73,20,1,0,57,16,73,
-    14,3,0,57,8,80,7,0,49,5,57,8,49,3,54,13,
-    20,235,4,15,8,73,14,2,0,1,88,9,174,255,49,3,
-    59,0,14,53,9,243,57,9,52,9,10,234,2,9,54,12,
-    11,233,53,21,231,57,14,73,13,2,0,84,18,0,107,22,
-    57,12,49,2,86,13,71,13,1,0,59,0,23,51,24,76,
-    114,123,2,0,0,114,88,1,0,0,99,9,0,0,0,1,
-    0,9,0,7,0,0,0,1,0,0,0,3,0,0,0,0,
-    0,0,0,0,0,0,0,1,0,0,0,3,0,0,0,3,
-    0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,193,20,1,0,0,65,32,99,108,
-    97,115,115,32,109,101,116,104,111,100,32,119,104,105,99,104,
-    32,114,101,116,117,114,110,115,32,97,32,99,108,111,115,117,
-    114,101,32,116,111,32,117,115,101,32,111,110,32,115,121,115,
-    46,112,97,116,104,95,104,111,111,107,10,32,32,32,32,32,
-    32,32,32,119,104,105,99,104,32,119,105,108,108,32,114,101,
-    116,117,114,110,32,97,110,32,105,110,115,116,97,110,99,101,
-    32,117,115,105,110,103,32,116,104,101,32,115,112,101,99,105,
-    102,105,101,100,32,108,111,97,100,101,114,115,32,97,110,100,
-    32,116,104,101,32,112,97,116,104,10,32,32,32,32,32,32,
-    32,32,99,97,108,108,101,100,32,111,110,32,116,104,101,32,
-    99,108,111,115,117,114,101,46,10,10,32,32,32,32,32,32,
-    32,32,73,102,32,116,104,101,32,112,97,116,104,32,99,97,
-    108,108,101,100,32,111,110,32,116,104,101,32,99,108,111,115,
-    117,114,101,32,105,115,32,110,111,116,32,97,32,100,105,114,
-    101,99,116,111,114,121,44,32,73,109,112,111,114,116,69,114,
-    114,111,114,32,105,115,10,32,32,32,32,32,32,32,32,114,
-    97,105,115,101,100,46,10,10,32,32,32,32,32,32,32,32,
-    218,20,70,105,108,101,70,105,110,100,101,114,46,112,97,116,
-    104,95,104,111,111,107,99,66,0,0,0,1,0,16,0,19,
-    0,0,0,1,0,0,0,3,0,0,0,0,0,0,0,0,
-    0,0,0,1,0,0,0,10,0,0,0,6,0,0,0,4,
-    0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,
-    0,0,0,218,45,80,97,116,104,32,104,111,111,107,32,102,
-    111,114,32,105,109,112,111,114,116,108,105,98,46,109,97,99,
-    104,105,110,101,114,121,46,70,105,108,101,70,105,110,100,101,
-    114,46,218,54,70,105,108,101,70,105,110,100,101,114,46,112,
-    97,116,104,95,104,111,111,107,46,60,108,111,99,97,108,115,
-    62,46,112,97,116,104,95,104,111,111,107,95,102,111,114,95,
-    70,105,108,101,70,105,110,100,101,114,114,114,0,0,0,114,
-    226,0,0,0,218,30,111,110,108,121,32,100,105,114,101,99,
-    116,111,114,105,101,115,32,97,114,101,32,115,117,112,112,111,
-    114,116,101,100,169,1,114,90,0,0,0,0,0,0,0,1,
-    0,0,0,1,0,0,0,2,0,0,0,62,6,0,0,41,
-    3,114,90,0,0,0,114,93,1,0,0,114,112,2,0,0,
-    41,2,114,93,1,0,0,114,112,2,0,0,114,31,0,0,
-    0,114,32,0,0,0,218,24,112,97,116,104,95,104,111,111,
-    107,95,102,111,114,95,70,105,108,101,70,105,110,100,101,114,
-    115,8,0,0,0,2,0,0,2,16,1,21,1,6,10,53,
-    2,254,57,6,4,7,0,71,7,1,0,16,84,24,0,53,
-    3,252,57,8,51,4,57,9,4,3,0,51,5,57,4,71,
-    9,1,1,77,55,1,57,8,4,9,0,94,9,1,57,9,
-    55,2,111,9,49,9,2,9,74,7,57,3,72,9,76,0,
-    0,0,0,1,0,0,0,52,6,0,0,41,3,114,93,1,
-    0,0,114,112,2,0,0,114,150,2,0,0,114,31,0,0,
-    0,41,2,114,93,1,0,0,114,112,2,0,0,114,32,0,
-    0,0,218,9,112,97,116,104,95,104,111,111,107,115,6,0,
-    0,0,2,0,0,10,4,6,6,3,107,2,57,2,49,2,
-    76,114,151,2,0,0,99,19,0,0,0,1,0,0,0,3,
-    0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,0,
-    0,0,0,1,0,0,0,7,0,0,0,5,0,0,0,2,
+    0,114,109,2,0,0,115,26,0,0,0,2,0,9,2,2,
+    254,2,9,4,16,4,4,5,2,4,12,4,5,10,51,4,
+    31,5,1,10,17,6,14,50,0,254,58,1,51,2,58,3,
+    51,4,58,5,107,6,58,7,107,8,58,9,50,10,252,58,
+    11,107,12,58,13,107,14,58,15,122,16,57,10,107,17,2,
+    10,58,18,107,19,58,20,50,21,250,57,13,107,22,57,14,
+    71,14,1,0,58,23,107,24,58,25,51,16,76,114,109,2,
+    0,0,99,169,0,0,0,4,0,0,0,3,0,0,0,4,
+    0,0,0,6,0,0,0,1,0,0,0,0,0,0,0,4,
+    0,0,0,14,0,0,0,13,0,0,0,11,0,0,0,0,
+    0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,78,
+    218,14,95,102,105,120,95,117,112,95,109,111,100,117,108,101,
+    114,169,1,0,0,218,10,95,95,108,111,97,100,101,114,95,
+    95,218,8,95,95,115,112,101,99,95,95,114,0,1,0,0,
+    114,241,1,0,0,114,224,1,0,0,114,67,1,0,0,169,
+    1,114,0,1,0,0,218,8,95,95,102,105,108,101,95,95,
+    218,10,95,95,99,97,99,104,101,100,95,95,218,9,69,120,
+    99,101,112,116,105,111,110,1,0,0,0,3,0,0,0,129,
+    0,0,0,152,0,0,0,166,0,0,0,6,0,0,0,93,
+    6,0,0,41,6,218,2,110,115,114,226,0,0,0,218,8,
+    112,97,116,104,110,97,109,101,218,9,99,112,97,116,104,110,
+    97,109,101,114,0,1,0,0,114,78,1,0,0,114,31,0,
+    0,0,114,31,0,0,0,114,32,0,0,0,114,161,2,0,
+    0,115,34,0,0,0,2,0,0,2,16,1,16,1,6,1,
+    5,1,9,1,8,1,20,2,17,1,6,1,24,2,5,1,
+    5,1,5,1,8,1,7,2,6,14,49,0,54,9,2,255,
+    122,3,57,11,73,10,2,0,120,4,49,0,54,9,2,254,
+    122,4,57,11,73,10,2,0,120,5,49,4,16,84,62,0,
+    49,5,84,12,0,52,5,5,253,57,4,80,48,0,49,3,
+    123,2,2,84,23,0,53,6,251,57,9,4,10,1,4,11,
+    2,71,10,2,0,57,4,80,20,0,53,7,249,57,9,4,
+    10,1,4,11,2,71,10,2,0,120,4,49,5,16,84,27,
+    0,53,8,247,57,11,4,12,1,4,13,2,4,6,4,122,
+    9,57,7,71,12,2,1,121,5,51,4,63,5,0,51,3,
+    63,4,0,51,10,63,2,0,51,11,63,3,0,80,17,0,
+    53,12,245,83,6,9,0,97,6,80,5,0,99,6,51,0,
+    76,114,161,2,0,0,99,68,0,0,0,0,0,0,0,3,
+    0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,9,0,0,0,9,0,0,0,13,
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,78,218,19,70,105,108,101,70,105,110,100,101,114,
-    46,95,95,114,101,112,114,95,95,218,16,70,105,108,101,70,
-    105,110,100,101,114,40,123,33,114,125,41,114,125,0,0,0,
-    114,90,0,0,0,70,6,0,0,41,1,114,229,0,0,0,
-    114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,114,
-    42,2,0,0,115,4,0,0,0,2,0,0,1,6,7,51,
-    2,54,4,3,255,52,0,4,254,57,6,73,5,2,0,76,
-    114,42,2,0,0,178,5,0,0,41,10,114,113,1,0,0,
-    114,118,1,0,0,114,70,2,0,0,114,112,1,0,0,114,
-    251,0,0,0,114,90,2,0,0,114,109,1,0,0,114,123,
-    2,0,0,114,151,2,0,0,114,42,2,0,0,114,31,0,
-    0,0,114,31,0,0,0,114,32,0,0,0,114,102,2,0,
-    0,115,26,0,0,0,2,0,9,2,2,254,2,9,4,16,
-    4,4,5,2,4,12,4,5,10,51,4,31,5,1,10,17,
-    6,14,50,0,254,58,1,51,2,58,3,51,4,58,5,107,
-    6,58,7,107,8,58,9,50,10,252,58,11,107,12,58,13,
-    107,14,58,15,51,16,57,10,107,17,2,10,58,18,107,19,
-    58,20,50,21,250,57,13,107,22,57,14,71,14,1,0,58,
-    23,107,24,58,25,51,16,76,114,102,2,0,0,99,169,0,
-    0,0,4,0,0,0,3,0,0,0,4,0,0,0,6,0,
-    0,0,1,0,0,0,0,0,0,0,4,0,0,0,14,0,
-    0,0,13,0,0,0,11,0,0,0,0,0,0,0,1,0,
-    0,0,1,0,0,0,0,0,0,0,78,218,14,95,102,105,
-    120,95,117,112,95,109,111,100,117,108,101,218,3,103,101,116,
-    218,10,95,95,108,111,97,100,101,114,95,95,218,8,95,95,
-    115,112,101,99,95,95,114,255,0,0,0,114,234,1,0,0,
-    114,217,1,0,0,114,66,1,0,0,169,1,114,255,0,0,
-    0,218,8,95,95,102,105,108,101,95,95,218,10,95,95,99,
-    97,99,104,101,100,95,95,218,9,69,120,99,101,112,116,105,
-    111,110,1,0,0,0,3,0,0,0,129,0,0,0,152,0,
-    0,0,166,0,0,0,6,0,0,0,76,6,0,0,41,6,
-    218,2,110,115,114,225,0,0,0,218,8,112,97,116,104,110,
-    97,109,101,218,9,99,112,97,116,104,110,97,109,101,114,255,
-    0,0,0,114,77,1,0,0,114,31,0,0,0,114,31,0,
-    0,0,114,32,0,0,0,114,154,2,0,0,115,34,0,0,
-    0,2,0,0,2,16,1,16,1,6,1,5,1,9,1,8,
-    1,20,2,17,1,6,1,24,2,5,1,5,1,5,1,8,
-    1,7,2,6,14,49,0,54,9,2,255,51,3,57,11,73,
-    10,2,0,57,4,49,0,54,9,2,254,51,4,57,11,73,
-    10,2,0,57,5,49,4,16,84,62,0,49,5,84,12,0,
-    52,5,5,253,57,4,80,48,0,49,3,35,2,2,84,23,
-    0,53,6,251,57,9,4,10,1,4,11,2,71,10,2,0,
-    57,4,80,20,0,53,7,249,57,9,4,10,1,4,11,2,
-    71,10,2,0,57,4,49,5,16,84,27,0,53,8,247,57,
-    11,4,12,1,4,13,2,4,6,4,51,9,57,7,71,12,
-    2,1,57,5,51,4,63,5,0,51,3,63,4,0,51,10,
-    63,2,0,51,11,63,3,0,80,17,0,53,12,245,83,6,
-    9,0,97,6,80,5,0,99,6,51,0,76,114,154,2,0,
-    0,99,68,0,0,0,0,0,0,0,3,0,0,0,0,0,
-    0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,9,0,0,0,9,0,0,0,13,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,95,
-    82,101,116,117,114,110,115,32,97,32,108,105,115,116,32,111,
-    102,32,102,105,108,101,45,98,97,115,101,100,32,109,111,100,
-    117,108,101,32,108,111,97,100,101,114,115,46,10,10,32,32,
-    32,32,69,97,99,104,32,105,116,101,109,32,105,115,32,97,
-    32,116,117,112,108,101,32,40,108,111,97,100,101,114,44,32,
-    115,117,102,102,105,120,101,115,41,46,10,32,32,32,32,114,
-    73,1,0,0,114,198,1,0,0,114,3,0,0,0,218,18,
-    101,120,116,101,110,115,105,111,110,95,115,117,102,102,105,120,
-    101,115,114,217,1,0,0,114,150,0,0,0,114,234,1,0,
-    0,114,152,0,0,0,99,6,0,0,41,3,218,10,101,120,
-    116,101,110,115,105,111,110,115,218,6,115,111,117,114,99,101,
-    218,8,98,121,116,101,99,111,100,101,114,31,0,0,0,114,
-    31,0,0,0,114,32,0,0,0,114,73,1,0,0,115,10,
-    0,0,0,2,0,0,5,23,1,15,1,15,1,6,9,53,
-    2,254,57,3,53,3,252,54,7,4,251,73,8,1,0,57,
-    4,93,3,2,57,0,53,5,249,57,3,53,6,247,57,4,
-    93,3,2,57,1,53,7,245,57,3,53,8,243,57,4,93,
-    3,2,57,2,4,3,0,4,4,1,4,5,2,94,3,3,
-    76,114,73,1,0,0,99,71,2,0,0,1,0,0,0,3,
-    0,0,0,1,0,0,0,10,0,0,0,0,0,0,0,0,
-    0,0,0,1,0,0,0,22,0,0,0,42,0,0,0,36,
-    0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
-    0,0,0,218,205,83,101,116,117,112,32,116,104,101,32,112,
-    97,116,104,45,98,97,115,101,100,32,105,109,112,111,114,116,
-    101,114,115,32,102,111,114,32,105,109,112,111,114,116,108,105,
-    98,32,98,121,32,105,109,112,111,114,116,105,110,103,32,110,
-    101,101,100,101,100,10,32,32,32,32,98,117,105,108,116,45,
-    105,110,32,109,111,100,117,108,101,115,32,97,110,100,32,105,
-    110,106,101,99,116,105,110,103,32,116,104,101,109,32,105,110,
-    116,111,32,116,104,101,32,103,108,111,98,97,108,32,110,97,
-    109,101,115,112,97,99,101,46,10,10,32,32,32,32,79,116,
-    104,101,114,32,99,111,109,112,111,110,101,110,116,115,32,97,
-    114,101,32,101,120,116,114,97,99,116,101,100,32,102,114,111,
-    109,32,116,104,101,32,99,111,114,101,32,98,111,111,116,115,
-    116,114,97,112,32,109,111,100,117,108,101,46,10,10,32,32,
-    32,32,218,6,95,115,101,116,117,112,114,234,0,0,0,114,
-    8,0,0,0,114,3,0,0,0,114,25,2,0,0,114,240,
-    0,0,0,114,22,0,0,0,114,24,0,0,0,114,17,0,
-    0,0,114,23,0,0,0,114,26,0,0,0,99,37,0,0,
-    0,1,0,0,1,51,0,0,0,1,0,0,0,2,0,0,
-    0,0,0,0,0,0,0,0,0,1,0,0,0,7,0,0,
-    0,4,0,0,0,2,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,78,218,25,95,115,101,116,
-    117,112,46,60,108,111,99,97,108,115,62,46,60,103,101,110,
-    101,120,112,114,62,114,28,0,0,0,114,29,0,0,0,128,
-    6,0,0,41,2,122,2,46,48,114,30,0,0,0,114,31,
-    0,0,0,114,31,0,0,0,114,32,0,0,0,114,27,0,
-    0,0,115,2,0,0,0,2,0,6,7,80,28,0,57,1,
-    53,2,254,57,5,4,6,1,71,6,1,0,57,2,51,3,
-    35,2,2,2,2,78,1,88,0,231,255,51,0,76,114,4,
-    0,0,0,218,18,95,98,117,105,108,116,105,110,95,102,114,
-    111,109,95,110,97,109,101,114,226,0,0,0,218,30,105,109,
-    112,111,114,116,108,105,98,32,114,101,113,117,105,114,101,115,
-    32,112,111,115,105,120,32,111,114,32,110,116,114,243,0,0,
-    0,114,18,0,0,0,114,33,0,0,0,114,25,0,0,0,
-    114,36,0,0,0,114,37,0,0,0,114,41,0,0,0,99,
-    37,0,0,0,1,0,0,0,19,0,0,0,1,0,0,0,
-    2,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
-    5,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,78,218,25,95,
-    115,101,116,117,112,46,60,108,111,99,97,108,115,62,46,60,
-    115,101,116,99,111,109,112,62,114,39,0,0,0,145,6,0,
-    0,41,2,122,2,46,48,114,40,0,0,0,114,31,0,0,
-    0,114,31,0,0,0,114,32,0,0,0,114,38,0,0,0,
-    115,2,0,0,0,2,0,6,5,95,0,0,57,2,80,21,
-    0,57,1,51,2,57,3,49,1,74,4,57,4,75,6,3,
-    2,113,2,88,0,238,255,49,2,2,2,76,114,6,0,0,
-    0,114,10,0,0,0,114,12,0,0,0,114,84,0,0,0,
-    114,20,0,0,0,114,60,0,0,0,114,50,0,0,0,114,
-    240,1,0,0,114,44,1,0,0,114,166,2,0,0,114,150,
-    0,0,0,218,4,46,112,121,119,218,6,95,100,46,112,121,
-    100,114,81,1,0,0,84,114,87,1,0,0,78,192,0,0,
-    0,213,0,0,0,227,0,0,0,11,0,0,0,110,6,0,
-    0,41,10,218,17,95,98,111,111,116,115,116,114,97,112,95,
-    109,111,100,117,108,101,218,11,115,101,108,102,95,109,111,100,
-    117,108,101,218,10,111,115,95,100,101,116,97,105,108,115,218,
-    10,98,117,105,108,116,105,110,95,111,115,114,25,0,0,0,
-    114,33,0,0,0,218,9,111,115,95,109,111,100,117,108,101,
-    218,13,98,117,105,108,116,105,110,95,110,97,109,101,115,218,
-    12,98,117,105,108,116,105,110,95,110,97,109,101,218,14,98,
-    117,105,108,116,105,110,95,109,111,100,117,108,101,114,31,0,
-    0,0,114,31,0,0,0,114,32,0,0,0,114,171,2,0,
-    0,115,74,0,0,0,2,0,0,8,4,1,13,1,13,2,
-    22,3,45,1,17,2,28,1,6,1,16,1,21,1,5,3,
-    16,1,5,1,7,1,7,244,4,14,14,2,20,1,20,1,
-    32,1,31,3,17,1,8,1,15,1,9,1,17,1,19,2,
-    21,1,19,251,4,8,28,1,25,1,8,1,16,1,14,1,
-    6,22,49,0,61,2,53,2,254,57,10,52,10,3,253,2,
-    10,61,3,53,2,254,57,10,52,10,4,252,2,10,61,4,
-    53,3,250,57,10,52,10,5,249,2,10,57,10,53,6,247,
-    25,10,2,10,57,1,51,7,57,10,51,8,57,11,94,11,
-    1,57,11,93,10,2,57,10,51,9,57,11,51,10,57,12,
-    51,8,57,13,94,12,2,57,12,93,11,2,57,11,93,10,
-    2,57,2,49,2,86,10,80,124,0,106,11,2,0,5,3,
-    12,5,4,11,53,11,245,57,14,107,12,57,18,49,4,86,
-    19,71,19,1,0,57,15,71,15,1,0,85,5,0,74,8,
-    51,13,25,4,57,5,53,3,250,57,11,52,11,5,244,2,
-    11,34,3,84,29,0,53,3,250,57,11,52,11,5,243,2,
-    11,57,11,49,3,25,11,2,11,57,6,2,10,80,56,0,
-    53,2,254,54,14,14,242,4,16,3,73,15,2,0,57,6,
-    2,10,80,35,0,53,15,240,83,11,9,0,97,11,80,5,
-    0,99,11,88,10,135,255,53,15,240,57,13,51,16,57,14,
-    71,14,1,0,77,53,17,238,57,13,4,14,1,51,18,57,
-    15,4,16,6,71,14,3,0,1,53,17,238,57,13,4,14,
-    1,51,19,57,15,4,16,5,71,14,3,0,1,53,17,238,
-    57,13,4,14,1,51,20,57,15,51,21,54,19,22,237,4,
-    21,4,73,20,2,0,57,16,71,14,3,0,1,53,17,238,
-    57,13,4,14,1,51,23,57,15,107,24,57,19,49,4,86,
-    20,71,20,1,0,57,16,71,14,3,0,1,51,25,57,10,
-    51,26,57,11,51,27,57,12,94,10,3,57,7,51,9,35,
-    2,3,84,18,0,49,7,54,13,28,236,51,29,57,15,73,
-    14,2,0,1,49,7,86,10,80,81,0,57,8,53,3,250,
-    57,11,52,11,5,235,2,11,34,8,17,84,22,0,53,2,
-    254,54,14,14,234,4,16,8,73,15,2,0,57,9,80,24,
-    0,53,3,250,57,11,52,11,5,233,2,11,57,11,49,8,
-    25,11,2,11,57,9,53,17,238,57,14,4,15,1,4,16,
-    8,4,17,9,71,15,3,0,1,88,10,178,255,53,17,238,
-    57,13,4,14,1,51,30,57,15,53,31,231,57,19,71,20,
-    0,0,57,16,71,14,3,0,1,53,32,229,54,13,33,228,
-    53,4,226,54,18,34,225,73,19,1,0,57,15,73,14,2,
-    0,1,51,9,35,2,3,84,45,0,53,35,223,54,13,28,
-    222,51,36,57,15,73,14,2,0,1,51,37,57,10,53,32,
-    229,34,10,2,10,84,15,0,53,38,220,57,10,51,39,59,
-    10,40,2,10,51,41,76,114,171,2,0,0,99,99,0,0,
-    0,1,0,0,0,3,0,0,0,1,0,0,0,2,0,0,
-    0,0,0,0,0,0,0,0,0,1,0,0,0,14,0,0,
-    0,13,0,0,0,15,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,218,41,73,110,115,116,97,
-    108,108,32,116,104,101,32,112,97,116,104,45,98,97,115,101,
-    100,32,105,109,112,111,114,116,32,99,111,109,112,111,110,101,
-    110,116,115,46,218,8,95,105,110,115,116,97,108,108,114,171,
-    2,0,0,114,73,1,0,0,114,8,0,0,0,114,74,2,
-    0,0,114,44,1,0,0,114,102,2,0,0,114,151,2,0,
-    0,218,9,109,101,116,97,95,112,97,116,104,114,84,0,0,
-    0,114,63,2,0,0,78,167,6,0,0,41,2,114,178,2,
-    0,0,218,17,115,117,112,112,111,114,116,101,100,95,108,111,
-    97,100,101,114,115,114,31,0,0,0,114,31,0,0,0,114,
-    32,0,0,0,114,187,2,0,0,115,10,0,0,0,2,0,
-    0,2,13,1,11,1,45,1,6,14,53,2,254,57,5,4,
-    6,0,71,6,1,0,1,53,3,252,57,5,71,6,0,0,
-    57,1,53,4,250,57,2,52,2,5,249,2,2,54,5,6,
-    248,53,7,246,57,13,52,13,8,245,2,13,57,12,4,7,
-    1,72,13,57,7,94,7,1,57,7,73,6,2,0,1,53,
-    4,250,57,2,52,2,9,244,2,2,54,5,10,243,53,11,
-    241,57,7,73,6,2,0,1,51,12,76,114,187,2,0,0,
-    1,0,0,0,41,1,114,113,1,0,0,114,31,0,0,0,
-    114,31,0,0,0,114,32,0,0,0,218,8,60,109,111,100,
-    117,108,101,62,115,172,0,0,0,2,0,4,22,4,1,4,
-    1,4,1,4,1,4,3,22,1,6,1,4,1,7,2,4,
-    3,6,1,16,2,9,2,29,1,13,1,16,1,17,1,15,
-    4,4,1,4,1,5,1,3,255,6,4,4,17,4,5,4,
-    5,4,6,6,1,7,30,4,6,4,8,4,10,4,9,4,
-    5,4,7,6,1,7,8,4,5,10,22,24,127,0,21,28,
-    1,22,2,4,1,4,2,9,2,9,2,15,2,16,71,4,
-    40,4,19,4,12,4,12,4,28,4,17,4,33,4,28,4,
-    24,22,13,16,10,10,11,4,14,11,3,8,1,3,255,12,
-    68,17,64,17,29,22,127,0,17,17,72,27,45,27,26,5,
-    3,27,58,17,63,17,42,17,127,0,20,17,127,0,27,10,
-    23,4,11,4,57,6,10,51,0,58,1,89,2,61,3,89,
-    4,58,5,89,6,61,7,89,8,58,9,89,10,58,11,53,
-    7,254,57,1,52,1,12,253,2,1,57,1,51,13,35,2,
-    1,2,1,58,14,50,14,251,84,14,0,89,15,58,16,89,
-    17,58,18,80,7,0,89,19,58,16,50,14,251,84,19,0,
-    51,20,57,1,51,21,57,2,94,1,2,58,22,80,12,0,
-    51,21,57,1,94,1,1,58,22,50,23,249,57,4,107,24,
-    57,8,50,22,247,86,9,71,9,1,0,57,5,71,5,1,
-    0,85,5,0,74,8,50,22,247,57,1,51,25,25,1,2,
-    1,58,26,50,27,245,57,4,50,22,247,57,5,71,5,1,
-    0,58,28,51,29,54,4,30,244,50,22,247,57,6,73,5,
-    2,0,58,22,107,31,57,4,50,22,247,86,5,71,5,1,
-    0,58,32,51,33,58,34,51,35,58,36,50,36,242,57,1,
-    50,34,240,23,1,2,1,58,37,107,38,58,39,107,40,58,
-    41,107,42,58,43,107,44,58,45,50,14,251,84,10,0,107,
-    46,58,47,80,7,0,107,48,58,47,107,49,58,50,107,51,
-    58,52,107,53,58,54,107,55,58,56,107,57,58,58,50,14,
-    251,84,10,0,107,59,58,60,80,7,0,107,61,58,60,51,
-    62,57,1,107,63,2,1,58,64,50,65,238,57,4,50,64,
-    236,57,5,52,5,66,235,2,5,57,5,71,5,1,0,58,
-    67,51,68,54,4,69,234,51,70,57,6,51,71,57,7,73,
-    5,3,0,57,1,51,72,23,1,2,1,58,73,50,74,232,
-    54,4,75,231,50,73,229,57,6,51,71,57,7,73,5,3,
-    0,58,76,51,77,58,78,51,79,58,80,51,81,57,1,94,
-    1,1,58,82,51,83,57,1,94,1,1,58,84,50,84,227,
-    57,1,49,1,58,85,49,1,58,86,2,1,51,87,57,1,
-    51,87,57,2,107,88,2,2,2,1,58,89,107,90,58,91,
-    107,92,58,93,107,94,58,95,107,96,58,97,107,98,58,99,
-    107,100,58,101,107,102,58,103,107,104,58,105,107,106,58,107,
-    51,87,57,1,51,87,57,2,51,87,57,3,107,108,2,3,
-    2,2,2,1,58,109,51,25,57,1,51,25,57,2,107,110,
-    2,2,2,1,58,111,51,112,57,1,107,113,2,1,58,114,
-    107,115,58,116,50,117,225,57,4,71,5,0,0,58,118,51,
-    87,57,1,51,87,57,2,50,118,223,57,3,107,119,2,3,
-    2,2,2,1,58,120,100,57,4,107,121,57,5,51,122,57,
-    6,71,5,2,0,58,122,100,57,4,107,123,57,5,51,124,
-    57,6,71,5,2,0,58,124,100,57,4,107,125,57,5,51,
-    126,57,6,50,124,221,57,7,71,5,3,0,58,126,100,57,
-    4,107,127,57,5,51,128,57,6,71,5,2,0,58,128,100,
-    57,4,107,129,57,5,51,130,57,6,50,128,219,57,7,50,
-    126,217,57,8,71,5,4,0,58,130,100,57,4,107,131,57,
-    5,51,132,57,6,50,128,219,57,7,50,124,221,57,8,71,
-    5,4,0,58,132,94,1,0,58,133,100,57,4,107,134,57,
-    5,51,135,57,6,50,128,219,57,7,50,124,221,57,8,71,
-    5,4,0,58,135,100,57,4,107,136,57,5,51,137,57,6,
-    71,5,2,0,58,137,100,57,4,107,138,57,5,51,139,57,
-    6,71,5,2,0,58,139,100,57,4,107,140,57,5,51,141,
-    57,6,71,5,2,0,58,141,100,57,4,107,142,57,5,51,
-    143,57,6,71,5,2,0,58,143,51,87,57,1,107,144,2,
-    1,58,145,107,146,58,147,107,148,58,149,107,150,58,151,51,
-    87,76,
+    0,0,0,218,95,82,101,116,117,114,110,115,32,97,32,108,
+    105,115,116,32,111,102,32,102,105,108,101,45,98,97,115,101,
+    100,32,109,111,100,117,108,101,32,108,111,97,100,101,114,115,
+    46,10,10,32,32,32,32,69,97,99,104,32,105,116,101,109,
+    32,105,115,32,97,32,116,117,112,108,101,32,40,108,111,97,
+    100,101,114,44,32,115,117,102,102,105,120,101,115,41,46,10,
+    32,32,32,32,114,74,1,0,0,114,205,1,0,0,114,3,
+    0,0,0,218,18,101,120,116,101,110,115,105,111,110,95,115,
+    117,102,102,105,120,101,115,114,224,1,0,0,114,151,0,0,
+    0,114,241,1,0,0,114,153,0,0,0,116,6,0,0,41,
+    3,218,10,101,120,116,101,110,115,105,111,110,115,218,6,115,
+    111,117,114,99,101,218,8,98,121,116,101,99,111,100,101,114,
+    31,0,0,0,114,31,0,0,0,114,32,0,0,0,114,74,
+    1,0,0,115,10,0,0,0,2,0,0,5,23,1,15,1,
+    15,1,6,9,53,2,254,57,3,53,3,252,54,7,4,251,
+    73,8,1,0,57,4,93,3,2,57,0,53,5,249,57,3,
+    53,6,247,57,4,93,3,2,57,1,53,7,245,57,3,53,
+    8,243,57,4,93,3,2,57,2,4,3,0,4,4,1,4,
+    5,2,94,3,3,76,114,74,1,0,0,99,71,2,0,0,
+    1,0,0,0,3,0,0,0,1,0,0,0,10,0,0,0,
+    0,0,0,0,0,0,0,0,1,0,0,0,22,0,0,0,
+    42,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,
+    1,0,0,0,0,0,0,0,218,205,83,101,116,117,112,32,
+    116,104,101,32,112,97,116,104,45,98,97,115,101,100,32,105,
+    109,112,111,114,116,101,114,115,32,102,111,114,32,105,109,112,
+    111,114,116,108,105,98,32,98,121,32,105,109,112,111,114,116,
+    105,110,103,32,110,101,101,100,101,100,10,32,32,32,32,98,
+    117,105,108,116,45,105,110,32,109,111,100,117,108,101,115,32,
+    97,110,100,32,105,110,106,101,99,116,105,110,103,32,116,104,
+    101,109,32,105,110,116,111,32,116,104,101,32,103,108,111,98,
+    97,108,32,110,97,109,101,115,112,97,99,101,46,10,10,32,
+    32,32,32,79,116,104,101,114,32,99,111,109,112,111,110,101,
+    110,116,115,32,97,114,101,32,101,120,116,114,97,99,116,101,
+    100,32,102,114,111,109,32,116,104,101,32,99,111,114,101,32,
+    98,111,111,116,115,116,114,97,112,32,109,111,100,117,108,101,
+    46,10,10,32,32,32,32,218,6,95,115,101,116,117,112,114,
+    235,0,0,0,114,8,0,0,0,114,3,0,0,0,114,32,
+    2,0,0,114,241,0,0,0,114,22,0,0,0,114,24,0,
+    0,0,114,17,0,0,0,114,23,0,0,0,114,26,0,0,
+    0,99,37,0,0,0,1,0,0,1,51,0,0,0,1,0,
+    0,0,2,0,0,0,0,0,0,0,0,0,0,0,1,0,
+    0,0,7,0,0,0,4,0,0,0,2,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,218,
+    25,95,115,101,116,117,112,46,60,108,111,99,97,108,115,62,
+    46,60,103,101,110,101,120,112,114,62,114,28,0,0,0,114,
+    29,0,0,0,145,6,0,0,41,2,122,2,46,48,114,30,
+    0,0,0,114,31,0,0,0,114,31,0,0,0,114,32,0,
+    0,0,114,27,0,0,0,115,2,0,0,0,2,0,6,7,
+    80,28,0,57,1,53,2,254,57,5,4,6,1,71,6,1,
+    0,121,2,51,3,35,2,2,2,2,78,1,88,0,231,255,
+    51,0,76,114,4,0,0,0,218,18,95,98,117,105,108,116,
+    105,110,95,102,114,111,109,95,110,97,109,101,114,227,0,0,
+    0,218,30,105,109,112,111,114,116,108,105,98,32,114,101,113,
+    117,105,114,101,115,32,112,111,115,105,120,32,111,114,32,110,
+    116,114,244,0,0,0,114,18,0,0,0,114,33,0,0,0,
+    114,25,0,0,0,114,36,0,0,0,114,37,0,0,0,114,
+    41,0,0,0,99,37,0,0,0,1,0,0,0,19,0,0,
+    0,1,0,0,0,2,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,0,0,5,0,0,0,3,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,78,218,25,95,115,101,116,117,112,46,60,108,111,99,97,
+    108,115,62,46,60,115,101,116,99,111,109,112,62,114,39,0,
+    0,0,162,6,0,0,41,2,122,2,46,48,114,40,0,0,
+    0,114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,
+    114,38,0,0,0,115,2,0,0,0,2,0,6,5,95,0,
+    0,57,2,80,21,0,121,1,122,2,120,3,49,1,74,4,
+    57,4,75,6,3,2,113,2,88,0,238,255,49,2,2,2,
+    76,114,6,0,0,0,114,10,0,0,0,114,12,0,0,0,
+    114,84,0,0,0,114,20,0,0,0,114,60,0,0,0,114,
+    50,0,0,0,114,247,1,0,0,114,45,1,0,0,114,172,
+    2,0,0,114,151,0,0,0,218,4,46,112,121,119,218,6,
+    95,100,46,112,121,100,114,82,1,0,0,84,114,88,1,0,
+    0,78,192,0,0,0,213,0,0,0,227,0,0,0,11,0,
+    0,0,127,6,0,0,41,10,218,17,95,98,111,111,116,115,
+    116,114,97,112,95,109,111,100,117,108,101,218,11,115,101,108,
+    102,95,109,111,100,117,108,101,218,10,111,115,95,100,101,116,
+    97,105,108,115,218,10,98,117,105,108,116,105,110,95,111,115,
+    114,25,0,0,0,114,33,0,0,0,218,9,111,115,95,109,
+    111,100,117,108,101,218,13,98,117,105,108,116,105,110,95,110,
+    97,109,101,115,218,12,98,117,105,108,116,105,110,95,110,97,
+    109,101,218,14,98,117,105,108,116,105,110,95,109,111,100,117,
+    108,101,114,31,0,0,0,114,31,0,0,0,114,32,0,0,
+    0,114,177,2,0,0,115,74,0,0,0,2,0,0,8,4,
+    1,13,1,13,2,22,3,45,1,17,2,28,1,6,1,16,
+    1,21,1,5,3,16,1,5,1,7,1,7,244,4,14,14,
+    2,20,1,20,1,32,1,31,3,17,1,8,1,15,1,9,
+    1,17,1,19,2,21,1,19,251,4,8,28,1,25,1,8,
+    1,16,1,14,1,6,22,49,0,61,2,53,2,254,57,10,
+    52,10,3,253,2,10,61,3,53,2,254,57,10,52,10,4,
+    252,2,10,61,4,53,3,250,57,10,52,10,5,249,2,10,
+    57,10,53,6,247,25,10,2,10,121,1,122,7,121,10,122,
+    8,57,11,94,11,1,57,11,93,10,2,121,10,122,9,121,
+    11,122,10,121,12,122,8,57,13,94,12,2,57,12,93,11,
+    2,57,11,93,10,2,120,2,49,2,86,10,80,124,0,106,
+    11,2,0,5,3,12,5,4,11,53,11,245,57,14,107,12,
+    120,18,49,4,86,19,71,19,1,0,57,15,71,15,1,0,
+    85,5,0,74,8,51,13,25,4,57,5,53,3,250,57,11,
+    52,11,5,244,2,11,34,3,84,29,0,53,3,250,57,11,
+    52,11,5,243,2,11,120,11,49,3,25,11,2,11,57,6,
+    2,10,80,56,0,53,2,254,54,14,14,242,4,16,3,73,
+    15,2,0,57,6,2,10,80,35,0,53,15,240,83,11,9,
+    0,97,11,80,5,0,99,11,88,10,135,255,53,15,240,121,
+    13,122,16,57,14,71,14,1,0,77,53,17,238,57,13,4,
+    14,1,122,18,57,15,4,16,6,71,14,3,0,1,53,17,
+    238,57,13,4,14,1,122,19,57,15,4,16,5,71,14,3,
+    0,1,53,17,238,57,13,4,14,1,122,20,121,15,51,21,
+    54,19,22,237,4,21,4,73,20,2,0,57,16,71,14,3,
+    0,1,53,17,238,57,13,4,14,1,122,23,57,15,107,24,
+    120,19,49,4,86,20,71,20,1,0,57,16,71,14,3,0,
+    1,122,25,121,10,122,26,121,11,122,27,57,12,94,10,3,
+    121,7,51,9,123,2,3,84,18,0,49,7,54,13,28,236,
+    122,29,57,15,73,14,2,0,1,49,7,86,10,80,81,0,
+    57,8,53,3,250,57,11,52,11,5,235,2,11,34,8,17,
+    84,22,0,53,2,254,54,14,14,234,4,16,8,73,15,2,
+    0,57,9,80,24,0,53,3,250,57,11,52,11,5,233,2,
+    11,120,11,49,8,25,11,2,11,57,9,53,17,238,57,14,
+    4,15,1,4,16,8,4,17,9,71,15,3,0,1,88,10,
+    178,255,53,17,238,57,13,4,14,1,122,30,57,15,53,31,
+    231,57,19,71,20,0,0,57,16,71,14,3,0,1,53,32,
+    229,54,13,33,228,53,4,226,54,18,34,225,73,19,1,0,
+    57,15,73,14,2,0,1,51,9,123,2,3,84,45,0,53,
+    35,223,54,13,28,222,122,36,57,15,73,14,2,0,1,122,
+    37,57,10,53,32,229,34,10,2,10,84,15,0,53,38,220,
+    121,10,51,39,59,10,40,2,10,51,41,76,114,177,2,0,
+    0,99,99,0,0,0,1,0,0,0,3,0,0,0,1,0,
+    0,0,2,0,0,0,0,0,0,0,0,0,0,0,1,0,
+    0,0,14,0,0,0,13,0,0,0,15,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,41,
+    73,110,115,116,97,108,108,32,116,104,101,32,112,97,116,104,
+    45,98,97,115,101,100,32,105,109,112,111,114,116,32,99,111,
+    109,112,111,110,101,110,116,115,46,218,8,95,105,110,115,116,
+    97,108,108,114,177,2,0,0,114,74,1,0,0,114,8,0,
+    0,0,114,81,2,0,0,114,45,1,0,0,114,109,2,0,
+    0,114,158,2,0,0,218,9,109,101,116,97,95,112,97,116,
+    104,114,84,0,0,0,114,70,2,0,0,78,184,6,0,0,
+    41,2,114,184,2,0,0,218,17,115,117,112,112,111,114,116,
+    101,100,95,108,111,97,100,101,114,115,114,31,0,0,0,114,
+    31,0,0,0,114,32,0,0,0,114,193,2,0,0,115,10,
+    0,0,0,2,0,0,2,13,1,11,1,45,1,6,14,53,
+    2,254,57,5,4,6,0,71,6,1,0,1,53,3,252,57,
+    5,71,6,0,0,57,1,53,4,250,57,2,52,2,5,249,
+    2,2,54,5,6,248,53,7,246,57,13,52,13,8,245,2,
+    13,57,12,4,7,1,72,13,57,7,94,7,1,57,7,73,
+    6,2,0,1,53,4,250,57,2,52,2,9,244,2,2,54,
+    5,10,243,53,11,241,57,7,73,6,2,0,1,51,12,76,
+    114,193,2,0,0,1,0,0,0,41,1,114,114,1,0,0,
+    114,31,0,0,0,114,31,0,0,0,114,32,0,0,0,218,
+    8,60,109,111,100,117,108,101,62,115,174,0,0,0,2,0,
+    4,22,4,1,4,1,4,1,4,1,4,3,22,1,6,1,
+    4,1,7,2,4,3,6,1,16,2,9,2,29,1,13,1,
+    16,1,17,1,15,4,4,1,4,1,5,1,3,255,6,4,
+    4,17,4,5,4,5,4,6,6,1,7,30,4,6,4,8,
+    4,10,4,9,4,5,4,7,6,1,7,8,4,5,10,22,
+    24,127,0,22,28,1,22,5,4,2,4,1,4,2,9,2,
+    9,2,15,2,16,71,4,40,4,19,4,12,4,12,4,28,
+    4,17,4,33,4,28,4,24,22,13,16,10,10,11,4,14,
+    11,3,8,1,3,255,12,68,17,64,17,29,22,127,0,28,
+    17,72,27,45,27,26,5,3,27,58,17,63,17,42,17,127,
+    0,20,17,127,0,27,10,23,4,11,4,57,6,10,51,0,
+    58,1,89,2,61,3,89,4,58,5,89,6,61,7,89,8,
+    58,9,89,10,58,11,53,7,254,57,1,52,1,12,253,2,
+    1,121,1,51,13,35,2,1,2,1,58,14,50,14,251,84,
+    14,0,89,15,58,16,89,17,58,18,80,7,0,89,19,58,
+    16,50,14,251,84,19,0,122,20,121,1,122,21,57,2,94,
+    1,2,58,22,80,12,0,122,21,57,1,94,1,1,58,22,
+    50,23,249,57,4,107,24,57,8,50,22,247,86,9,71,9,
+    1,0,57,5,71,5,1,0,85,5,0,74,8,50,22,247,
+    121,1,51,25,25,1,2,1,58,26,50,27,245,57,4,50,
+    22,247,57,5,71,5,1,0,58,28,51,29,54,4,30,244,
+    50,22,247,57,6,73,5,2,0,58,22,107,31,57,4,50,
+    22,247,86,5,71,5,1,0,58,32,51,33,58,34,51,35,
+    58,36,50,36,242,57,1,50,34,240,23,1,2,1,58,37,
+    107,38,58,39,107,40,58,41,107,42,58,43,107,44,58,45,
+    50,14,251,84,10,0,107,46,58,47,80,7,0,107,48,58,
+    47,107,49,58,50,107,51,58,52,107,53,58,54,107,55,58,
+    56,107,57,58,58,50,14,251,84,10,0,107,59,58,60,80,
+    7,0,107,61,58,60,122,62,57,1,107,63,2,1,58,64,
+    50,65,238,57,4,50,64,236,57,5,52,5,66,235,2,5,
+    57,5,71,5,1,0,58,67,51,68,54,4,69,234,122,70,
+    121,6,122,71,57,7,73,5,3,0,121,1,51,72,23,1,
+    2,1,58,73,50,74,232,54,4,75,231,50,73,229,121,6,
+    122,71,57,7,73,5,3,0,58,76,96,0,58,77,51,78,
+    58,79,51,80,58,81,122,82,57,1,94,1,1,58,83,122,
+    84,57,1,94,1,1,58,85,50,85,227,120,1,49,1,58,
+    86,49,1,58,87,2,1,122,88,121,1,122,88,57,2,107,
+    89,2,2,2,1,58,90,107,91,58,92,107,93,58,94,107,
+    95,58,96,107,97,58,98,107,99,58,100,107,101,58,102,107,
+    103,58,104,107,105,58,106,107,107,58,108,122,88,121,1,122,
+    88,121,2,122,88,57,3,107,109,2,3,2,2,2,1,58,
+    110,122,25,121,1,122,25,57,2,107,111,2,2,2,1,58,
+    112,122,113,57,1,107,114,2,1,58,115,107,116,58,117,50,
+    118,225,57,4,71,5,0,0,58,119,122,88,121,1,122,88,
+    57,2,50,119,223,57,3,107,120,2,3,2,2,2,1,58,
+    121,100,57,4,107,122,121,5,122,123,57,6,71,5,2,0,
+    58,123,100,57,4,107,124,121,5,122,125,57,6,71,5,2,
+    0,58,125,100,57,4,107,126,121,5,122,127,57,6,50,125,
+    221,57,7,71,5,3,0,58,127,100,57,4,107,128,121,5,
+    122,129,57,6,71,5,2,0,58,129,100,57,4,107,130,121,
+    5,122,131,57,6,50,129,219,57,7,50,127,217,57,8,71,
+    5,4,0,58,131,100,57,4,107,132,121,5,122,133,57,6,
+    50,129,219,57,7,50,125,221,57,8,71,5,4,0,58,133,
+    94,1,0,58,134,100,57,4,107,135,121,5,122,136,57,6,
+    50,129,219,57,7,50,125,221,57,8,71,5,4,0,58,136,
+    100,57,4,107,137,121,5,122,138,57,6,71,5,2,0,58,
+    138,100,57,4,107,139,121,5,122,140,57,6,71,5,2,0,
+    58,140,100,57,4,107,141,121,5,122,142,57,6,71,5,2,
+    0,58,142,100,57,4,107,143,121,5,122,144,57,6,71,5,
+    2,0,58,144,122,88,57,1,107,145,2,1,58,146,107,147,
+    58,148,107,149,58,150,107,151,58,152,51,88,76,
 };
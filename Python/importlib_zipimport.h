@@ -153,27 +153,27 @@ const unsigned char _Py_M__zipimport[] = {
     1,17,3,24,1,8,1,21,1,4,1,21,3,24,2,21,
     1,3,240,3,19,16,1,7,1,14,1,19,1,5,1,5,
     2,24,1,7,1,6,17,53,2,254,57,11,4,12,1,53,
-    3,252,57,13,71,12,2,0,16,84,22,0,89,4,57,2,
-    49,2,54,11,5,251,4,13,1,73,12,2,0,57,1,49,
-    1,16,84,24,0,53,6,249,57,13,51,7,57,14,4,8,
-    1,51,8,57,9,71,14,1,1,77,53,9,247,84,25,0,
+    3,252,57,13,71,12,2,0,16,84,22,0,89,4,120,2,
+    49,2,54,11,5,251,4,13,1,73,12,2,0,120,1,49,
+    1,16,84,24,0,53,6,249,121,13,122,7,57,14,4,8,
+    1,122,8,57,9,71,14,1,1,77,53,9,247,84,25,0,
     49,1,54,11,10,246,53,9,247,57,13,53,11,244,57,14,
     73,12,3,0,57,1,94,8,0,57,3,53,12,242,54,11,
     13,241,4,13,1,73,12,2,0,57,4,80,98,0,53,14,
     239,57,10,53,15,237,57,11,93,10,2,83,8,80,0,53,
     12,242,54,13,16,236,4,15,1,73,14,2,0,106,10,2,
-    0,5,5,11,5,6,10,49,1,35,2,5,84,24,0,53,
-    6,249,57,15,51,17,57,16,4,10,1,51,8,57,11,71,
-    16,1,1,77,49,5,57,1,49,3,54,13,18,235,4,15,
+    0,5,5,11,5,6,10,49,1,123,2,5,84,24,0,53,
+    6,249,121,15,122,17,57,16,4,10,1,122,8,57,11,71,
+    16,1,1,77,49,5,120,1,49,3,54,13,18,235,4,15,
     6,73,14,2,0,1,97,8,80,53,0,99,8,52,4,19,
-    234,57,8,51,20,30,8,2,8,57,8,51,21,35,3,8,
-    2,8,84,24,0,53,6,249,57,13,51,17,57,14,4,8,
-    1,51,8,57,9,71,14,1,1,77,80,6,0,80,94,255,
-    53,22,232,57,8,49,1,25,8,2,8,57,7,80,43,0,
+    234,121,8,51,20,30,8,2,8,121,8,51,21,35,3,8,
+    2,8,84,24,0,53,6,249,121,13,122,17,57,14,4,8,
+    1,122,8,57,9,71,14,1,1,77,80,6,0,80,94,255,
+    53,22,232,120,8,49,1,25,8,2,8,57,7,80,43,0,
     53,23,230,83,8,35,0,53,24,228,57,13,4,14,1,71,
-    14,1,0,57,7,53,22,232,57,10,49,1,63,7,10,2,
+    14,1,0,57,7,53,22,232,120,10,49,1,63,7,10,2,
     10,97,8,80,5,0,99,8,49,7,59,0,25,49,1,59,
-    0,26,53,12,242,57,14,52,14,27,227,2,14,57,13,51,
+    0,26,53,12,242,57,14,52,14,27,227,2,14,121,13,51,
     28,25,3,57,8,72,14,59,0,29,52,0,29,226,84,19,
     0,52,0,29,225,57,8,53,11,244,38,8,59,0,29,2,
     8,51,0,76,114,80,0,0,0,78,99,127,0,0,0,3,
@@ -223,13 +223,13 @@ const unsigned char _Py_M__zipimport[] = {
     114,35,0,0,0,114,36,0,0,0,218,11,102,105,110,100,
     95,108,111,97,100,101,114,115,16,0,0,0,2,0,0,10,
     17,1,8,2,12,7,17,1,18,4,40,2,6,11,53,2,
-    254,57,8,4,9,0,4,10,1,71,9,2,0,57,3,51,
+    254,57,8,4,9,0,4,10,1,71,9,2,0,121,3,51,
     3,33,3,17,84,15,0,4,5,0,94,6,0,57,6,93,
     5,2,76,53,4,252,57,8,4,9,0,4,10,1,71,9,
     2,0,57,4,53,5,250,57,8,4,9,0,4,10,4,71,
-    9,2,0,84,43,0,51,3,57,5,52,0,6,249,74,4,
-    57,6,53,7,247,74,4,57,7,49,4,74,4,57,8,75,
-    6,6,3,57,6,94,6,1,57,6,93,5,2,76,51,3,
+    9,2,0,84,43,0,122,3,57,5,52,0,6,249,74,4,
+    57,6,53,7,247,74,4,120,7,49,4,74,4,57,8,75,
+    6,6,3,57,6,94,6,1,57,6,93,5,2,76,122,3,
     57,5,94,6,0,57,6,93,5,2,76,114,89,0,0,0,
     99,27,0,0,0,3,0,0,0,3,0,0,0,3,0,0,
     0,3,0,0,0,1,0,0,0,0,0,0,0,3,0,0,
@@ -267,7 +267,7 @@ const unsigned char _Py_M__zipimport[] = {
     0,0,114,35,0,0,0,114,36,0,0,0,218,11,102,105,
     110,100,95,109,111,100,117,108,101,115,4,0,0,0,2,0,
     0,9,6,10,49,0,54,6,2,255,4,8,1,4,9,2,
-    73,7,3,0,57,3,51,3,25,3,2,3,76,114,92,0,
+    73,7,3,0,121,3,51,3,25,3,2,3,76,114,92,0,
     0,0,99,33,0,0,0,2,0,0,0,3,0,0,0,2,
     0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,2,
     0,0,0,11,0,0,0,3,0,0,0,2,0,0,0,0,
@@ -319,14 +319,14 @@ const unsigned char _Py_M__zipimport[] = {
     115,20,0,0,0,2,0,0,6,6,1,22,2,4,1,28,
     1,40,3,17,1,7,1,23,1,6,13,53,2,254,84,25,
     0,49,1,54,7,3,253,53,2,254,57,9,53,4,251,57,
-    10,73,8,3,0,57,1,49,1,57,2,49,1,54,7,5,
+    10,73,8,3,0,120,1,49,1,120,2,49,1,54,7,5,
     250,52,0,6,249,57,9,53,4,251,23,9,2,9,57,9,
     73,8,2,0,84,43,0,53,7,247,57,7,52,0,6,246,
-    57,8,53,4,251,23,8,2,8,57,8,71,8,1,0,57,
-    4,51,8,57,5,51,8,57,6,92,4,25,1,57,2,52,
-    0,9,245,57,4,49,2,25,4,2,4,57,3,80,33,0,
-    53,10,243,83,4,25,0,53,11,241,57,9,51,12,57,10,
-    51,13,57,11,4,12,2,71,10,3,0,77,99,4,53,14,
+    57,8,53,4,251,23,8,2,8,57,8,71,8,1,0,121,
+    4,122,8,121,5,122,8,57,6,92,4,25,1,57,2,52,
+    0,9,245,120,4,49,2,25,4,2,4,57,3,80,33,0,
+    53,10,243,83,4,25,0,53,11,241,121,9,122,12,121,10,
+    122,13,57,11,4,12,2,71,10,3,0,77,99,4,53,14,
     239,57,7,52,0,6,238,57,8,4,9,3,71,8,2,0,
     76,114,108,0,0,0,99,33,0,0,0,2,0,0,0,3,
     0,0,0,2,0,0,0,5,0,0,0,0,0,0,0,0,
@@ -383,14 +383,14 @@ const unsigned char _Py_M__zipimport[] = {
     95,115,111,117,114,99,101,115,24,0,0,0,2,0,0,7,
     17,1,7,1,35,2,17,1,5,1,23,2,16,3,17,1,
     7,2,7,1,6,14,53,2,254,57,9,4,10,0,4,11,
-    1,71,10,2,0,57,2,51,3,33,2,84,38,0,53,4,
-    252,57,11,51,5,57,12,49,1,74,2,74,4,57,13,75,
-    6,12,2,57,12,4,6,1,51,6,57,7,71,12,1,1,
+    1,71,10,2,0,121,2,51,3,33,2,84,38,0,53,4,
+    252,121,11,122,5,120,12,49,1,74,2,74,4,57,13,75,
+    6,12,2,57,12,4,6,1,122,6,57,7,71,12,1,1,
     77,53,7,250,57,9,4,10,0,4,11,1,71,10,2,0,
-    57,3,49,2,84,26,0,53,8,248,54,9,9,247,4,11,
-    3,51,10,57,12,73,10,3,0,57,4,80,19,0,49,3,
-    74,4,57,6,51,11,57,7,75,6,6,2,57,4,52,0,
-    12,246,57,6,49,4,25,6,2,6,57,5,80,17,0,53,
+    120,3,49,2,84,26,0,53,8,248,54,9,9,247,4,11,
+    3,122,10,57,12,73,10,3,0,57,4,80,19,0,49,3,
+    74,4,121,6,122,11,57,7,75,6,6,2,57,4,52,0,
+    12,246,120,6,49,4,25,6,2,6,57,5,80,17,0,53,
     13,244,83,6,9,0,51,3,97,6,76,99,6,53,14,242,
     57,9,52,0,15,241,57,10,4,11,5,71,10,2,0,54,
     9,16,240,73,10,1,0,76,114,121,0,0,0,99,64,0,
@@ -416,9 +416,9 @@ const unsigned char _Py_M__zipimport[] = {
     0,0,0,114,36,0,0,0,218,10,105,115,95,112,97,99,
     107,97,103,101,115,10,0,0,0,2,0,0,6,17,1,7,
     1,35,1,6,11,53,2,254,57,6,4,7,0,4,8,1,
-    71,7,2,0,57,2,51,3,33,2,84,38,0,53,4,252,
-    57,8,51,5,57,9,49,1,74,2,74,4,57,10,75,6,
-    9,2,57,9,4,3,1,51,6,57,4,71,9,1,1,77,
+    71,7,2,0,121,2,51,3,33,2,84,38,0,53,4,252,
+    121,8,122,5,120,9,49,1,74,2,74,4,57,10,75,6,
+    9,2,57,9,4,3,1,122,6,57,4,71,9,1,1,77,
     49,2,76,114,124,0,0,0,99,101,1,0,0,2,0,0,
     0,3,0,0,0,2,0,0,0,8,0,0,0,0,0,0,
     0,0,0,0,0,2,0,0,0,17,0,0,0,27,0,0,
@@ -468,25 +468,25 @@ const unsigned char _Py_M__zipimport[] = {
     6,17,53,2,254,57,11,4,12,0,4,13,1,71,12,2,
     0,106,8,3,0,5,2,10,5,3,9,5,4,8,53,3,
     252,57,8,52,8,4,251,2,8,54,11,5,250,4,13,1,
-    73,12,2,0,57,5,51,6,33,5,82,22,0,1,53,7,
+    73,12,2,0,121,5,51,6,33,5,82,22,0,1,53,7,
     248,57,11,4,12,5,53,8,246,57,13,71,12,2,0,16,
     84,37,0,53,8,246,57,11,4,12,1,71,12,1,0,57,
-    5,53,3,252,57,8,52,8,4,245,2,8,57,8,49,1,
+    5,53,3,252,57,8,52,8,4,245,2,8,120,8,49,1,
     63,5,8,2,8,49,0,59,5,9,49,3,84,51,0,53,
     10,243,57,11,4,12,0,4,13,1,71,12,2,0,57,6,
     53,11,241,54,11,12,240,52,0,13,239,57,13,4,14,6,
     73,12,3,0,57,7,4,8,7,94,8,1,59,5,14,53,
-    15,237,57,11,4,12,5,51,16,57,13,71,12,2,0,16,
+    15,237,57,11,4,12,5,122,16,57,13,71,12,2,0,16,
     84,9,0,53,16,235,59,5,16,53,11,241,54,11,17,234,
     52,5,18,233,57,13,4,14,1,4,15,4,73,12,4,0,
     1,53,19,231,57,11,4,12,2,52,5,18,230,57,13,71,
     12,2,0,1,80,23,0,53,3,252,57,10,52,10,4,229,
-    2,10,57,10,49,1,69,10,2,10,77,53,3,252,57,8,
-    52,8,4,228,2,8,57,8,49,1,25,8,2,8,57,5,
-    80,44,0,53,20,226,83,8,36,0,53,21,224,57,13,51,
-    22,57,14,49,1,74,2,74,4,57,15,51,23,57,16,75,
+    2,10,120,10,49,1,69,10,2,10,77,53,3,252,57,8,
+    52,8,4,228,2,8,120,8,49,1,25,8,2,8,57,5,
+    80,44,0,53,20,226,83,8,36,0,53,21,224,121,13,122,
+    22,120,14,49,1,74,2,74,4,121,15,122,23,57,16,75,
     6,14,3,57,14,71,14,1,0,77,99,8,53,24,222,54,
-    11,25,221,51,26,57,13,4,14,1,4,15,4,73,12,4,
+    11,25,221,122,26,57,13,4,14,1,4,15,4,73,12,4,
     0,1,49,5,76,114,141,0,0,0,99,109,0,0,0,2,
     0,0,0,3,0,0,0,2,0,0,0,3,0,0,0,0,
     0,0,0,0,0,0,0,2,0,0,0,9,0,0,0,11,
@@ -524,7 +524,7 @@ const unsigned char _Py_M__zipimport[] = {
     9,0,51,3,97,3,76,99,3,53,5,251,57,3,52,3,
     6,250,2,3,16,84,42,0,89,7,57,3,90,3,8,57,
     2,2,3,49,2,54,6,9,249,53,5,251,57,8,73,7,
-    2,0,1,53,5,251,57,3,51,10,59,3,6,2,3,53,
+    2,0,1,53,5,251,121,3,51,10,59,3,6,2,3,53,
     5,251,57,6,4,7,0,4,8,1,71,7,2,0,76,114,
     151,0,0,0,99,38,0,0,0,1,0,0,0,3,0,0,
     0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
@@ -537,8 +537,8 @@ const unsigned char _Py_M__zipimport[] = {
     34,62,34,1,0,0,41,1,114,75,0,0,0,114,35,0,
     0,0,114,35,0,0,0,114,36,0,0,0,218,8,95,95,
     114,101,112,114,95,95,115,4,0,0,0,2,0,0,1,6,
-    6,51,2,57,1,52,0,3,255,74,4,57,2,53,4,253,
-    74,4,57,3,52,0,5,252,74,4,57,4,51,6,57,5,
+    6,122,2,57,1,52,0,3,255,74,4,57,2,53,4,253,
+    74,4,57,3,52,0,5,252,74,4,121,4,122,6,57,5,
     75,6,1,5,76,114,155,0,0,0,45,0,0,0,41,12,
     114,34,0,0,0,114,80,0,0,0,114,89,0,0,0,114,
     92,0,0,0,114,98,0,0,0,114,108,0,0,0,114,111,
@@ -548,7 +548,7 @@ const unsigned char _Py_M__zipimport[] = {
     115,28,0,0,0,2,0,9,1,2,255,2,18,4,46,10,
     32,10,12,4,10,4,21,4,11,4,26,4,13,4,38,4,
     18,6,13,50,0,254,58,1,51,2,58,3,51,4,58,5,
-    107,6,58,7,51,8,57,12,107,9,2,12,58,10,51,8,
+    107,6,58,7,122,8,57,12,107,9,2,12,58,10,122,8,
     57,12,107,11,2,12,58,12,107,13,58,14,107,15,58,16,
     107,17,58,18,107,19,58,20,107,21,58,22,107,23,58,24,
     107,25,58,26,107,27,58,28,51,8,76,218,12,95,95,105,
@@ -564,8 +564,8 @@ const unsigned char _Py_M__zipimport[] = {
     0,52,1,0,0,41,2,114,75,0,0,0,114,86,0,0,
     0,114,35,0,0,0,114,35,0,0,0,114,36,0,0,0,
     114,84,0,0,0,115,4,0,0,0,2,0,0,1,6,9,
-    52,0,2,255,57,2,49,1,54,6,3,254,51,4,57,8,
-    73,7,2,0,57,3,51,5,25,3,2,3,23,2,2,2,
+    52,0,2,255,120,2,49,1,54,6,3,254,122,4,57,8,
+    73,7,2,0,121,3,51,5,25,3,2,3,23,2,2,2,
     76,114,84,0,0,0,99,16,0,0,0,2,0,0,0,3,
     0,0,0,2,0,0,0,3,0,0,0,0,0,0,0,0,
     0,0,0,2,0,0,0,3,0,0,0,4,0,0,0,3,
@@ -676,106 +676,106 @@ const unsigned char _Py_M__zipimport[] = {
     19,1,7,1,36,2,21,1,19,1,29,1,5,1,6,202,
     5,55,22,1,6,38,53,2,254,54,29,3,253,4,31,0,
     73,30,2,0,57,1,80,47,0,53,4,251,83,26,39,0,
-    53,5,249,57,33,51,6,57,34,49,0,74,2,74,4,57,
-    35,75,6,34,2,57,34,4,28,0,51,7,57,29,71,34,
+    53,5,249,121,33,122,6,120,34,49,0,74,2,74,4,57,
+    35,75,6,34,2,57,34,4,28,0,122,7,57,29,71,34,
     1,1,77,99,26,49,1,108,26,1,49,1,54,31,8,248,
-    53,9,246,15,57,33,51,10,57,34,73,32,3,0,1,49,
-    1,54,31,11,245,73,32,1,0,57,2,49,1,54,31,12,
+    53,9,246,15,121,33,122,10,57,34,73,32,3,0,1,49,
+    1,54,31,11,245,73,32,1,0,120,2,49,1,54,31,12,
     244,53,9,246,57,33,73,32,2,0,57,3,80,47,0,53,
-    4,251,83,28,39,0,53,5,249,57,35,51,13,57,36,49,
+    4,251,83,28,39,0,53,5,249,121,35,122,13,120,36,49,
     0,74,2,74,4,57,37,75,6,36,2,57,36,4,30,0,
-    51,7,57,31,71,36,1,1,77,99,28,53,14,242,57,31,
+    122,7,57,31,71,36,1,1,77,99,28,53,14,242,57,31,
     4,32,3,71,32,1,0,57,28,53,9,246,35,3,28,2,
-    28,84,38,0,53,5,249,57,33,51,13,57,34,49,0,74,
-    2,74,4,57,35,75,6,34,2,57,34,4,28,0,51,7,
+    28,84,38,0,53,5,249,121,33,122,13,120,34,49,0,74,
+    2,74,4,57,35,75,6,34,2,57,34,4,28,0,122,7,
     57,29,71,34,1,1,77,51,15,25,3,57,28,53,16,240,
-    35,3,28,2,28,84,93,1,49,1,54,31,8,239,51,17,
-    57,33,51,10,57,34,73,32,3,0,1,49,1,54,31,11,
+    35,3,28,2,28,84,93,1,49,1,54,31,8,239,122,17,
+    121,33,122,10,57,34,73,32,3,0,1,49,1,54,31,11,
     238,73,32,1,0,57,4,80,47,0,53,4,251,83,28,39,
-    0,53,5,249,57,35,51,13,57,36,49,0,74,2,74,4,
-    57,37,75,6,36,2,57,36,4,30,0,51,7,57,31,71,
+    0,53,5,249,121,35,122,13,120,36,49,0,74,2,74,4,
+    57,37,75,6,36,2,57,36,4,30,0,122,7,57,31,71,
     36,1,1,77,99,28,53,18,236,57,31,53,19,234,24,4,
-    57,32,53,9,246,24,32,2,32,57,32,51,17,57,33,71,
-    32,2,0,57,5,49,1,54,31,8,233,4,33,5,73,32,
+    57,32,53,9,246,24,32,2,32,121,32,122,17,57,33,71,
+    32,2,0,120,5,49,1,54,31,8,233,4,33,5,73,32,
     2,0,1,49,1,54,31,12,232,73,32,1,0,57,6,80,
-    47,0,53,4,251,83,28,39,0,53,5,249,57,35,51,13,
-    57,36,49,0,74,2,74,4,57,37,75,6,36,2,57,36,
-    4,30,0,51,7,57,31,71,36,1,1,77,99,28,49,6,
-    54,31,20,231,53,16,240,57,33,73,32,2,0,57,7,51,
-    17,35,0,7,84,38,0,53,5,249,57,33,51,21,57,34,
+    47,0,53,4,251,83,28,39,0,53,5,249,121,35,122,13,
+    120,36,49,0,74,2,74,4,57,37,75,6,36,2,57,36,
+    4,30,0,122,7,57,31,71,36,1,1,77,99,28,49,6,
+    54,31,20,231,53,16,240,57,33,73,32,2,0,121,7,51,
+    17,123,0,7,84,38,0,53,5,249,121,33,122,21,120,34,
     49,0,74,2,74,4,57,35,75,6,34,2,57,34,4,28,
-    0,51,7,57,29,71,34,1,1,77,4,28,7,53,9,246,
-    23,7,57,29,51,0,57,30,92,28,25,6,57,3,53,14,
+    0,122,7,57,29,71,34,1,1,77,4,28,7,53,9,246,
+    23,7,121,29,122,0,57,30,92,28,25,6,57,3,53,14,
     242,57,31,4,32,3,71,32,1,0,57,28,53,9,246,35,
-    3,28,2,28,84,38,0,53,5,249,57,33,51,22,57,34,
+    3,28,2,28,84,38,0,53,5,249,121,33,122,22,120,34,
     49,0,74,2,74,4,57,35,75,6,34,2,57,34,4,28,
-    0,51,7,57,29,71,34,1,1,77,53,14,242,57,31,4,
-    32,6,71,32,1,0,24,4,57,28,49,7,23,28,2,28,
-    57,2,53,23,229,57,31,51,24,25,3,57,32,71,32,1,
-    0,57,8,53,23,229,57,31,51,25,25,3,57,32,71,32,
-    1,0,57,9,49,8,35,0,2,84,38,0,53,5,249,57,
-    33,51,26,57,34,49,0,74,2,74,4,57,35,75,6,34,
-    2,57,34,4,28,0,51,7,57,29,71,34,1,1,77,49,
-    9,35,0,2,84,38,0,53,5,249,57,33,51,27,57,34,
+    0,122,7,57,29,71,34,1,1,77,53,14,242,57,31,4,
+    32,6,71,32,1,0,24,4,120,28,49,7,23,28,2,28,
+    57,2,53,23,229,121,31,51,24,25,3,57,32,71,32,1,
+    0,57,8,53,23,229,121,31,51,25,25,3,57,32,71,32,
+    1,0,120,9,49,8,123,0,2,84,38,0,53,5,249,121,
+    33,122,26,120,34,49,0,74,2,74,4,57,35,75,6,34,
+    2,57,34,4,28,0,122,7,57,29,71,34,1,1,77,49,
+    9,123,0,2,84,38,0,53,5,249,121,33,122,27,120,34,
     49,0,74,2,74,4,57,35,75,6,34,2,57,34,4,28,
-    0,51,7,57,29,71,34,1,1,77,49,8,39,2,57,2,
-    49,9,24,2,57,10,51,17,35,0,10,84,38,0,53,5,
-    249,57,33,51,28,57,34,49,0,74,2,74,4,57,35,75,
-    6,34,2,57,34,4,28,0,51,7,57,29,71,34,1,1,
-    77,96,0,57,11,51,17,57,12,49,1,54,31,8,228,4,
+    0,122,7,57,29,71,34,1,1,77,49,8,39,2,120,2,
+    49,9,24,2,121,10,51,17,123,0,10,84,38,0,53,5,
+    249,121,33,122,28,120,34,49,0,74,2,74,4,57,35,75,
+    6,34,2,57,34,4,28,0,122,7,57,29,71,34,1,1,
+    77,96,0,121,11,122,17,120,12,49,1,54,31,8,228,4,
     33,2,73,32,2,0,1,80,47,0,53,4,251,83,28,39,
-    0,53,5,249,57,35,51,13,57,36,49,0,74,2,74,4,
-    57,37,75,6,36,2,57,36,4,30,0,51,7,57,31,71,
-    36,1,1,77,99,28,49,1,54,31,12,227,51,29,57,33,
+    0,53,5,249,121,35,122,13,120,36,49,0,74,2,74,4,
+    57,37,75,6,36,2,57,36,4,30,0,122,7,57,31,71,
+    36,1,1,77,99,28,49,1,54,31,12,227,122,29,57,33,
     73,32,2,0,57,3,53,14,242,57,31,4,32,3,71,32,
-    1,0,57,28,51,30,35,0,28,2,28,84,17,0,53,31,
-    225,57,31,51,32,57,32,71,32,1,0,77,51,15,25,3,
-    57,28,51,33,35,3,28,2,28,84,6,0,80,190,2,53,
-    14,242,57,31,4,32,3,71,32,1,0,57,28,51,29,35,
-    3,28,2,28,84,17,0,53,31,225,57,31,51,32,57,32,
-    71,32,1,0,77,53,34,223,57,31,51,35,25,3,57,32,
-    71,32,1,0,57,13,53,34,223,57,31,51,36,25,3,57,
-    32,71,32,1,0,57,14,53,34,223,57,31,51,37,25,3,
-    57,32,71,32,1,0,57,15,53,34,223,57,31,51,38,25,
-    3,57,32,71,32,1,0,57,16,53,23,229,57,31,51,25,
-    25,3,57,32,71,32,1,0,57,17,53,23,229,57,31,51,
-    39,25,3,57,32,71,32,1,0,57,18,53,23,229,57,31,
-    51,40,25,3,57,32,71,32,1,0,57,4,53,34,223,57,
+    1,0,121,28,51,30,35,0,28,2,28,84,17,0,53,31,
+    225,121,31,122,32,57,32,71,32,1,0,77,51,15,25,3,
+    121,28,51,33,35,3,28,2,28,84,6,0,80,190,2,53,
+    14,242,57,31,4,32,3,71,32,1,0,121,28,51,29,35,
+    3,28,2,28,84,17,0,53,31,225,121,31,122,32,57,32,
+    71,32,1,0,77,53,34,223,121,31,51,35,25,3,57,32,
+    71,32,1,0,57,13,53,34,223,121,31,51,36,25,3,57,
+    32,71,32,1,0,57,14,53,34,223,121,31,51,37,25,3,
+    57,32,71,32,1,0,57,15,53,34,223,121,31,51,38,25,
+    3,57,32,71,32,1,0,57,16,53,23,229,121,31,51,25,
+    25,3,57,32,71,32,1,0,57,17,53,23,229,121,31,51,
+    39,25,3,57,32,71,32,1,0,57,18,53,23,229,121,31,
+    51,40,25,3,57,32,71,32,1,0,57,4,53,34,223,121,
     31,51,41,25,3,57,32,71,32,1,0,57,19,53,34,223,
-    57,31,51,42,25,3,57,32,71,32,1,0,57,20,53,34,
-    223,57,31,51,43,25,3,57,32,71,32,1,0,57,21,53,
-    23,229,57,31,51,44,25,3,57,32,71,32,1,0,57,22,
-    49,20,23,19,57,28,49,21,23,28,2,28,57,8,49,9,
-    35,4,22,84,38,0,53,5,249,57,33,51,45,57,34,49,
+    121,31,51,42,25,3,57,32,71,32,1,0,57,20,53,34,
+    223,121,31,51,43,25,3,57,32,71,32,1,0,57,21,53,
+    23,229,121,31,51,44,25,3,57,32,71,32,1,0,120,22,
+    49,20,23,19,120,28,49,21,23,28,2,28,120,8,49,9,
+    123,4,22,84,38,0,53,5,249,121,33,122,45,120,34,49,
     0,74,2,74,4,57,35,75,6,34,2,57,34,4,28,0,
-    51,7,57,29,71,34,1,1,77,49,10,38,22,57,22,49,
+    122,7,57,29,71,34,1,1,77,49,10,38,22,120,22,49,
     1,54,31,12,222,4,33,19,73,32,2,0,57,23,80,47,
-    0,53,4,251,83,28,39,0,53,5,249,57,35,51,13,57,
+    0,53,4,251,83,28,39,0,53,5,249,121,35,122,13,120,
     36,49,0,74,2,74,4,57,37,75,6,36,2,57,36,4,
-    30,0,51,7,57,31,71,36,1,1,77,99,28,53,14,242,
-    57,31,4,32,23,71,32,1,0,57,28,49,19,35,3,28,
-    2,28,84,38,0,53,5,249,57,33,51,13,57,34,49,0,
-    74,2,74,4,57,35,75,6,34,2,57,34,4,28,0,51,
-    7,57,29,71,34,1,1,77,53,14,242,57,31,49,1,54,
+    30,0,122,7,57,31,71,36,1,1,77,99,28,53,14,242,
+    57,31,4,32,23,71,32,1,0,120,28,49,19,35,3,28,
+    2,28,84,38,0,53,5,249,121,33,122,13,120,34,49,0,
+    74,2,74,4,57,35,75,6,34,2,57,34,4,28,0,122,
+    7,57,29,71,34,1,1,77,53,14,242,120,31,49,1,54,
     35,12,221,49,19,24,8,57,37,73,36,2,0,57,32,71,
-    32,1,0,57,28,49,19,24,8,35,3,28,2,28,84,38,
-    0,53,5,249,57,33,51,13,57,34,49,0,74,2,74,4,
-    57,35,75,6,34,2,57,34,4,28,0,51,7,57,29,71,
+    32,1,0,120,28,49,19,24,8,35,3,28,2,28,84,38,
+    0,53,5,249,121,33,122,13,120,34,49,0,74,2,74,4,
+    57,35,75,6,34,2,57,34,4,28,0,122,7,57,29,71,
     34,1,1,77,80,47,0,53,4,251,83,28,39,0,53,5,
-    249,57,35,51,13,57,36,49,0,74,2,74,4,57,37,75,
-    6,36,2,57,36,4,30,0,51,7,57,31,71,36,1,1,
+    249,121,35,122,13,120,36,49,0,74,2,74,4,57,37,75,
+    6,36,2,57,36,4,30,0,122,7,57,31,71,36,1,1,
     77,99,28,51,46,30,13,84,18,0,49,23,54,31,47,220,
-    73,32,1,0,57,23,80,65,0,49,23,54,31,47,219,51,
+    73,32,1,0,57,23,80,65,0,49,23,54,31,47,219,122,
     48,57,33,73,32,2,0,57,23,80,46,0,53,49,217,83,
-    28,38,0,49,23,54,33,47,216,51,50,57,35,73,34,2,
+    28,38,0,49,23,54,33,47,216,122,50,57,35,73,34,2,
     0,54,33,51,215,53,52,213,57,35,73,34,2,0,57,23,
-    97,28,80,5,0,99,28,49,23,54,31,53,212,51,54,57,
+    97,28,80,5,0,99,28,49,23,54,31,53,212,122,54,57,
     33,53,55,210,57,34,73,32,3,0,57,23,53,56,208,54,
     31,57,207,4,33,0,4,34,23,73,32,3,0,57,24,4,
     28,24,4,29,14,4,30,18,4,31,4,4,32,22,4,33,
-    15,4,34,16,4,35,17,93,28,8,57,25,49,23,63,25,
+    15,4,34,16,4,35,17,93,28,8,120,25,49,23,63,25,
     11,51,58,38,12,57,12,80,255,252,109,26,53,59,205,54,
-    29,60,204,51,61,57,31,4,32,12,4,33,0,73,30,4,
+    29,60,204,122,61,57,31,4,32,12,4,33,0,73,30,4,
     0,1,49,11,76,114,68,0,0,0,244,190,1,0,0,0,
     1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,
     17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,
@@ -828,13 +828,13 @@ const unsigned char _Py_M__zipimport[] = {
     114,36,0,0,0,114,242,0,0,0,115,24,0,0,0,2,
     0,0,2,6,3,16,1,14,2,4,2,14,1,7,1,16,
     1,16,2,6,2,16,1,6,9,53,2,254,84,33,0,53,
-    3,252,54,4,4,251,51,5,57,6,73,5,2,0,1,53,
-    6,249,57,4,51,7,57,5,71,5,1,0,77,51,8,61,
+    3,252,54,4,4,251,122,5,57,6,73,5,2,0,1,53,
+    6,249,121,4,122,7,57,5,71,5,1,0,77,51,8,61,
     2,89,9,57,1,90,1,10,57,0,2,1,80,42,0,53,
-    11,247,83,1,34,0,53,3,252,54,6,4,246,51,5,57,
-    8,73,7,2,0,1,53,6,249,57,6,51,7,57,7,71,
+    11,247,83,1,34,0,53,3,252,54,6,4,246,122,5,57,
+    8,73,7,2,0,1,53,6,249,121,6,122,7,57,7,71,
     7,1,0,77,99,1,51,12,61,2,99,1,53,3,252,54,
-    4,4,245,51,13,57,6,73,5,2,0,1,49,0,76,114,
+    4,4,245,122,13,57,6,73,5,2,0,1,49,0,76,114,
     242,0,0,0,99,221,1,0,0,2,0,0,0,3,0,0,
     0,2,0,0,0,17,0,0,0,0,0,0,0,0,0,0,
     0,2,0,0,0,29,0,0,0,27,0,0,0,21,0,0,
@@ -869,34 +869,34 @@ const unsigned char _Py_M__zipimport[] = {
     1,15,1,24,1,16,2,8,2,3,4,14,1,7,1,16,
     1,6,29,49,1,106,17,8,0,5,2,24,5,3,23,5,
     4,22,5,5,21,5,6,20,5,7,19,5,8,18,5,9,
-    17,51,2,35,0,4,84,17,0,53,3,254,57,20,51,4,
+    17,51,2,123,0,4,84,17,0,53,3,254,121,20,122,4,
     57,21,71,21,1,0,77,53,5,252,54,20,6,251,4,22,
-    0,73,21,2,0,108,17,57,10,49,10,54,22,7,250,4,
+    0,73,21,2,0,108,17,120,10,49,10,54,22,7,250,4,
     24,6,73,23,2,0,1,80,47,0,53,8,248,83,19,39,
-    0,53,3,254,57,26,51,9,57,27,49,0,74,2,74,4,
-    57,28,75,6,27,2,57,27,4,21,0,51,10,57,22,71,
-    27,1,1,77,99,19,49,10,54,22,11,247,51,12,57,24,
+    0,53,3,254,121,26,122,9,120,27,49,0,74,2,74,4,
+    57,28,75,6,27,2,57,27,4,21,0,122,10,57,22,71,
+    27,1,1,77,99,19,49,10,54,22,11,247,122,12,57,24,
     73,23,2,0,57,11,53,13,245,57,22,4,23,11,71,23,
-    1,0,57,19,51,12,35,3,19,2,19,84,17,0,53,14,
-    243,57,22,51,15,57,23,71,23,1,0,77,51,16,25,11,
-    57,19,51,17,35,3,19,2,19,84,38,0,53,3,254,57,
-    24,51,18,57,25,49,0,74,2,74,4,57,26,75,6,25,
-    2,57,25,4,19,0,51,10,57,20,71,25,1,1,77,53,
-    19,241,57,22,51,20,25,11,57,23,71,23,1,0,57,12,
-    53,19,241,57,22,51,21,25,11,57,23,71,23,1,0,57,
-    13,51,12,57,19,49,12,23,19,2,19,57,19,49,13,23,
-    19,2,19,57,14,49,14,38,6,57,6,49,10,54,22,7,
+    1,0,121,19,51,12,35,3,19,2,19,84,17,0,53,14,
+    243,121,22,122,15,57,23,71,23,1,0,77,51,16,25,11,
+    121,19,51,17,35,3,19,2,19,84,38,0,53,3,254,121,
+    24,122,18,120,25,49,0,74,2,74,4,57,26,75,6,25,
+    2,57,25,4,19,0,122,10,57,20,71,25,1,1,77,53,
+    19,241,121,22,51,20,25,11,57,23,71,23,1,0,57,12,
+    53,19,241,121,22,51,21,25,11,57,23,71,23,1,0,121,
+    13,122,12,120,19,49,12,23,19,2,19,120,19,49,13,23,
+    19,2,19,120,14,49,14,38,6,120,6,49,10,54,22,7,
     240,4,24,6,73,23,2,0,1,80,47,0,53,8,248,83,
-    19,39,0,53,3,254,57,26,51,9,57,27,49,0,74,2,
-    74,4,57,28,75,6,27,2,57,27,4,21,0,51,10,57,
+    19,39,0,53,3,254,121,26,122,9,120,27,49,0,74,2,
+    74,4,57,28,75,6,27,2,57,27,4,21,0,122,10,57,
     22,71,27,1,1,77,99,19,49,10,54,22,11,239,4,24,
     4,73,23,2,0,57,15,53,13,245,57,22,4,23,15,71,
-    23,1,0,57,19,49,4,35,3,19,2,19,84,17,0,53,
-    8,248,57,22,51,22,57,23,71,23,1,0,77,109,17,51,
-    2,35,2,3,84,6,0,49,15,76,53,23,237,57,20,71,
+    23,1,0,120,19,49,4,35,3,19,2,19,84,17,0,53,
+    8,248,121,22,122,22,57,23,71,23,1,0,77,109,17,51,
+    2,123,2,3,84,6,0,49,15,76,53,23,237,57,20,71,
     21,0,0,57,16,80,26,0,53,24,235,83,17,18,0,53,
-    3,254,57,22,51,25,57,23,71,23,1,0,77,99,17,4,
-    20,16,4,21,15,51,26,57,22,71,21,2,0,76,114,104,
+    3,254,121,22,122,25,57,23,71,23,1,0,77,99,17,4,
+    20,16,4,21,15,122,26,57,22,71,21,2,0,76,114,104,
     0,0,0,99,27,0,0,0,2,0,0,0,3,0,0,0,
     2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
     2,0,0,0,7,0,0,0,4,0,0,0,2,0,0,0,
@@ -905,8 +905,8 @@ const unsigned char _Py_M__zipimport[] = {
     115,114,29,0,0,0,65,2,0,0,41,2,218,2,116,49,
     218,2,116,50,114,35,0,0,0,114,35,0,0,0,114,36,
     0,0,0,114,4,1,0,0,115,4,0,0,0,2,0,0,
-    2,6,7,53,2,254,57,5,49,1,24,0,57,6,71,6,
-    1,0,57,2,51,3,35,1,2,2,2,76,114,4,1,0,
+    2,6,7,53,2,254,120,5,49,1,24,0,57,6,71,6,
+    1,0,121,2,51,3,35,1,2,2,2,76,114,4,1,0,
     0,99,202,1,0,0,5,0,0,0,3,0,0,0,5,0,
     0,0,14,0,0,0,0,0,0,0,0,0,0,0,5,0,
     0,0,23,0,0,0,34,0,0,0,32,0,0,0,0,0,
@@ -950,34 +950,34 @@ const unsigned char _Py_M__zipimport[] = {
     24,1,26,255,3,2,17,1,8,1,7,1,11,255,11,6,
     27,2,7,1,10,3,15,255,10,3,5,3,34,1,24,255,
     3,2,7,1,16,255,7,2,3,2,19,1,21,1,32,1,
-    6,23,96,2,57,14,51,2,57,15,49,3,62,14,15,2,
-    15,51,3,57,15,49,2,62,14,15,2,15,49,14,2,14,
+    6,23,96,2,121,14,122,2,120,15,49,3,62,14,15,2,
+    15,122,3,120,15,49,2,62,14,15,2,15,49,14,2,14,
     57,5,53,4,254,54,17,5,253,4,19,4,4,20,3,4,
     21,5,73,18,4,0,57,6,80,17,0,53,6,251,83,14,
-    9,0,51,0,97,14,76,99,14,51,7,30,6,57,14,51,
-    8,35,3,14,2,14,57,7,49,7,84,169,0,51,9,30,
-    6,57,14,51,8,35,3,14,2,14,57,8,53,10,249,57,
-    14,52,14,11,248,2,14,57,14,51,12,35,3,14,2,14,
+    9,0,51,0,97,14,76,99,14,51,7,30,6,121,14,51,
+    8,35,3,14,2,14,120,7,49,7,84,169,0,51,9,30,
+    6,121,14,51,8,35,3,14,2,14,57,8,53,10,249,57,
+    14,52,14,11,248,2,14,121,14,51,12,35,3,14,2,14,
     81,30,0,1,49,8,82,24,0,1,53,10,249,57,14,52,
-    14,11,247,2,14,57,14,51,13,35,2,14,2,14,84,98,
+    14,11,247,2,14,121,14,51,13,35,2,14,2,14,84,98,
     0,53,14,245,57,17,4,18,0,4,19,2,71,18,2,0,
-    57,9,51,0,33,9,17,84,73,0,53,10,249,54,17,15,
+    121,9,51,0,33,9,17,84,73,0,53,10,249,54,17,15,
     244,53,4,254,57,19,52,19,16,243,2,19,57,19,4,20,
     9,73,18,3,0,57,10,53,4,254,54,17,17,242,4,19,
     4,4,20,10,4,21,3,4,22,5,73,18,5,0,1,80,
     17,0,53,6,251,83,14,9,0,51,0,97,14,76,99,14,
     80,127,0,53,18,240,57,17,4,18,0,4,19,2,71,18,
     2,0,106,14,2,0,5,11,15,5,12,14,49,11,84,97,
-    0,53,19,238,57,17,53,20,236,57,21,51,21,25,4,57,
+    0,53,19,238,57,17,53,20,236,121,21,51,21,25,4,57,
     22,71,22,1,0,57,18,4,19,11,71,18,2,0,16,82,
-    28,0,1,53,20,236,57,17,51,22,25,4,57,18,71,18,
-    1,0,57,14,49,12,35,3,14,2,14,84,36,0,53,23,
-    234,54,17,24,233,51,25,57,19,49,3,74,2,74,4,57,
+    28,0,1,53,20,236,121,17,51,22,25,4,57,18,71,18,
+    1,0,120,14,49,12,35,3,14,2,14,84,36,0,53,23,
+    234,54,17,24,233,122,25,120,19,49,3,74,2,74,4,57,
     20,75,6,19,2,57,19,73,18,2,0,1,51,0,76,53,
     26,231,54,17,27,230,51,28,25,4,57,19,73,18,2,0,
     57,13,53,29,228,57,17,4,18,13,53,30,226,57,19,71,
-    18,2,0,16,84,35,0,53,31,224,57,17,51,32,57,18,
-    49,1,74,2,74,4,57,19,51,33,57,20,75,6,18,3,
+    18,2,0,16,84,35,0,53,31,224,121,17,122,32,120,18,
+    49,1,74,2,74,4,121,19,122,33,57,20,75,6,18,3,
     57,18,71,18,1,0,77,49,13,76,114,8,1,0,0,218,
     8,95,95,99,111,100,101,95,95,114,22,1,0,0,99,45,
     0,0,0,1,0,0,0,3,0,0,0,1,0,0,0,1,
@@ -990,9 +990,9 @@ const unsigned char _Py_M__zipimport[] = {
     0,41,1,218,6,115,111,117,114,99,101,114,35,0,0,0,
     114,35,0,0,0,114,36,0,0,0,114,33,1,0,0,115,
     8,0,0,0,2,0,0,1,20,1,20,1,6,8,49,0,
-    54,4,2,255,51,3,57,6,51,4,57,7,73,5,3,0,
-    57,0,49,0,54,4,2,254,51,5,57,6,51,4,57,7,
-    73,5,3,0,57,0,49,0,76,114,33,1,0,0,99,44,
+    54,4,2,255,122,3,121,6,122,4,57,7,73,5,3,0,
+    120,0,49,0,54,4,2,254,122,5,121,6,122,4,57,7,
+    73,5,3,0,120,0,49,0,76,114,33,1,0,0,99,44,
     0,0,0,2,0,0,0,3,0,0,0,2,0,0,0,2,
     0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,11,
     0,0,0,7,0,0,0,4,0,0,0,0,0,0,0,0,
@@ -1004,8 +1004,8 @@ const unsigned char _Py_M__zipimport[] = {
     0,114,35,0,0,0,114,35,0,0,0,114,36,0,0,0,
     114,38,1,0,0,115,6,0,0,0,2,0,0,1,14,1,
     6,11,53,2,254,57,5,4,6,1,71,6,1,0,57,1,
-    53,3,252,57,7,4,8,1,4,9,0,51,4,57,10,51,
-    5,57,2,51,6,57,3,71,8,3,1,76,114,38,1,0,
+    53,3,252,57,7,4,8,1,4,9,0,122,4,121,10,122,
+    5,121,2,122,6,57,3,71,8,3,1,76,114,38,1,0,
     0,99,99,0,0,0,2,0,0,0,3,0,0,0,2,0,
     0,0,2,0,0,0,0,0,0,0,0,0,0,0,2,0,
     0,0,16,0,0,0,13,0,0,0,3,0,0,0,0,0,
@@ -1020,11 +1020,11 @@ const unsigned char _Py_M__zipimport[] = {
     2,0,0,1,7,1,12,255,2,2,12,254,2,3,4,253,
     2,4,4,252,2,5,12,251,2,6,12,250,2,7,2,249,
     2,7,2,249,2,7,2,249,6,16,53,2,254,54,5,3,
-    253,51,4,29,0,57,7,51,5,23,7,2,7,57,7,51,
-    6,29,0,57,8,51,7,30,8,2,8,57,8,51,8,30,
-    0,57,9,51,9,29,1,57,10,51,6,29,1,57,11,51,
-    10,30,11,2,11,57,11,51,8,30,1,57,12,51,11,21,
-    12,2,12,57,12,51,12,57,13,51,12,57,14,51,12,57,
+    253,51,4,29,0,121,7,51,5,23,7,2,7,121,7,51,
+    6,29,0,121,8,51,7,30,8,2,8,121,8,51,8,30,
+    0,121,9,51,9,29,1,121,10,51,6,29,1,121,11,51,
+    10,30,11,2,11,121,11,51,8,30,1,121,12,51,11,21,
+    12,2,12,121,12,122,12,121,13,122,12,121,14,122,12,57,
     15,93,7,9,57,7,73,6,2,0,76,114,42,1,0,0,
     99,113,0,0,0,2,0,0,0,3,0,0,0,2,0,0,
     0,6,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
@@ -1042,10 +1042,10 @@ const unsigned char _Py_M__zipimport[] = {
     115,101,100,95,115,105,122,101,114,35,0,0,0,114,35,0,
     0,0,114,36,0,0,0,114,17,1,0,0,115,20,0,0,
     0,2,0,0,3,17,1,6,1,14,3,6,1,6,1,6,
-    1,24,1,22,1,6,12,51,2,25,1,57,6,51,3,34,
+    1,24,1,22,1,6,12,51,2,25,1,121,6,51,3,34,
     6,2,6,85,5,0,74,8,51,4,25,1,57,1,52,0,
-    5,255,57,6,49,1,25,6,2,6,57,2,51,6,25,2,
-    57,3,51,7,25,2,57,4,51,8,25,2,57,5,53,9,
+    5,255,120,6,49,1,25,6,2,6,121,2,51,6,25,2,
+    121,3,51,7,25,2,121,4,51,8,25,2,57,5,53,9,
     253,57,9,4,10,4,4,11,3,71,10,2,0,57,6,4,
     7,5,93,6,2,76,53,10,251,57,8,53,11,249,57,9,
     53,12,247,57,10,93,8,3,83,6,9,0,51,13,97,6,
@@ -1061,8 +1061,8 @@ const unsigned char _Py_M__zipimport[] = {
     0,114,107,0,0,0,114,35,0,0,0,114,35,0,0,0,
     114,36,0,0,0,114,13,1,0,0,115,14,0,0,0,2,
     0,0,2,17,1,6,3,17,1,7,1,7,2,6,9,51,
-    2,25,1,57,3,51,3,34,3,2,3,85,5,0,74,8,
-    51,4,25,1,57,1,52,0,5,255,57,3,49,1,25,3,
+    2,25,1,121,3,51,3,34,3,2,3,85,5,0,74,8,
+    51,4,25,1,57,1,52,0,5,255,120,3,49,1,25,3,
     2,3,57,2,80,17,0,53,6,253,83,3,9,0,51,0,
     97,3,76,99,3,53,7,251,57,6,52,0,8,250,57,7,
     4,8,2,71,7,2,0,76,114,13,1,0,0,99,12,1,
@@ -1089,19 +1089,19 @@ const unsigned char _Py_M__zipimport[] = {
     15,0,4,16,1,71,15,2,0,57,2,53,3,252,86,11,
     80,205,0,106,12,3,0,5,3,14,5,4,13,5,5,12,
     49,3,23,2,57,6,53,4,250,57,12,52,12,5,249,2,
-    12,57,17,51,6,57,18,52,0,7,248,57,19,53,8,246,
-    57,20,4,21,6,51,9,57,12,51,10,57,13,71,18,4,
-    1,1,52,0,11,245,57,12,49,6,25,12,2,12,57,7,
+    12,121,17,122,6,57,18,52,0,7,248,57,19,53,8,246,
+    57,20,4,21,6,122,9,121,12,122,10,57,13,71,18,4,
+    1,1,52,0,11,245,120,12,49,6,25,12,2,12,57,7,
     80,17,0,53,12,243,83,12,9,0,97,12,80,113,0,99,
     12,51,13,25,7,57,8,53,14,241,57,15,52,0,7,240,
-    57,16,4,17,7,71,16,2,0,57,9,49,4,84,32,0,
+    57,16,4,17,7,71,16,2,0,120,9,49,4,84,32,0,
     53,15,238,57,15,4,16,0,4,17,8,4,18,6,4,19,
     1,4,20,9,71,16,5,0,57,10,80,20,0,53,16,236,
-    57,15,4,16,8,4,17,9,71,16,2,0,57,10,51,0,
+    57,15,4,16,8,4,17,9,71,16,2,0,121,10,51,0,
     33,10,84,6,0,80,24,0,51,13,25,7,57,8,4,12,
     10,4,13,5,4,14,8,93,12,3,2,11,76,88,11,54,
-    255,53,17,234,57,16,51,18,57,17,49,1,74,2,74,4,
-    57,18,75,6,17,2,57,17,4,11,1,51,19,57,12,71,
+    255,53,17,234,121,16,122,18,120,17,49,1,74,2,74,4,
+    57,18,75,6,17,2,57,17,4,11,1,122,19,57,12,71,
     17,1,1,77,114,95,0,0,0,99,42,0,0,0,0,0,
     128,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,
     0,0,0,0,0,0,0,0,0,0,7,0,0,0,19,0,
@@ -1149,8 +1149,8 @@ const unsigned char _Py_M__zipimport[] = {
     0,114,36,0,0,0,218,13,111,112,101,110,95,114,101,115,
     111,117,114,99,101,115,14,0,0,0,2,0,0,1,22,1,
     22,1,11,2,25,1,7,1,6,15,52,0,2,255,54,8,
-    3,254,51,4,57,10,51,5,57,11,73,9,3,0,57,2,
-    49,2,74,4,57,5,51,5,57,6,49,1,74,4,57,7,
+    3,254,122,4,121,10,122,5,57,11,73,9,3,0,120,2,
+    49,2,74,4,121,5,122,5,120,6,49,1,74,4,57,7,
     75,6,5,3,57,3,89,6,57,5,90,5,7,57,4,2,
     5,4,8,4,52,0,8,253,54,12,9,252,4,14,3,73,
     13,2,0,57,9,71,9,1,0,76,53,10,250,83,5,17,
@@ -1181,8 +1181,8 @@ const unsigned char _Py_M__zipimport[] = {
     0,0,114,36,0,0,0,218,11,105,115,95,114,101,115,111,
     117,114,99,101,115,14,0,0,0,2,0,0,3,22,1,22,
     2,19,1,7,1,7,1,6,11,52,0,2,255,54,7,3,
-    254,51,4,57,9,51,5,57,10,73,8,3,0,57,2,49,
-    2,74,4,57,4,51,5,57,5,49,1,74,4,57,6,75,
+    254,122,4,121,9,122,5,57,10,73,8,3,0,120,2,49,
+    2,74,4,121,4,122,5,120,5,49,1,74,4,57,6,75,
     6,4,3,57,3,52,0,6,253,54,7,7,252,4,9,3,
     73,8,2,0,1,80,17,0,53,8,250,83,4,9,0,51,
     9,97,4,76,99,4,51,10,76,114,79,1,0,0,99,242,
@@ -1213,16 +1213,16 @@ const unsigned char _Py_M__zipimport[] = {
     24,1,9,1,8,1,14,1,4,242,6,19,89,2,57,9,
     90,9,3,57,1,2,9,4,12,1,52,0,4,255,54,16,
     5,254,52,0,6,253,57,18,73,17,2,0,57,13,71,13,
-    1,0,57,2,49,2,54,12,7,252,52,0,4,251,57,14,
+    1,0,120,2,49,2,54,12,7,252,52,0,4,251,57,14,
     52,14,8,250,2,14,57,14,73,13,2,0,57,3,52,3,
-    9,249,57,9,51,10,35,2,9,2,9,85,5,0,74,8,
+    9,249,121,9,51,10,35,2,9,2,9,85,5,0,74,8,
     52,3,11,248,57,4,53,12,246,57,12,71,13,0,0,57,
     5,52,0,4,245,57,9,52,9,13,244,2,9,86,9,80,
     118,0,57,6,4,13,1,4,14,6,71,14,1,0,54,13,
     7,243,4,15,4,73,14,2,0,57,7,80,17,0,53,14,
     241,83,10,9,0,97,10,80,78,0,99,10,52,7,11,240,
     57,10,52,10,9,239,2,10,57,8,53,15,237,57,13,4,
-    14,8,71,14,1,0,57,10,51,16,35,2,10,2,10,84,
+    14,8,71,14,1,0,121,10,51,16,35,2,10,2,10,84,
     12,0,52,7,9,236,78,1,80,29,0,49,5,34,8,17,
     84,21,0,49,5,54,13,17,235,4,15,8,73,14,2,0,
     1,49,8,78,1,88,9,141,255,51,0,76,114,96,1,0,
@@ -1246,23 +1246,23 @@ const unsigned char _Py_M__zipimport[] = {
     8,51,0,58,1,89,2,58,3,89,4,57,1,90,1,5,
     58,5,90,1,6,58,6,2,1,89,7,58,8,89,9,58,
     10,89,11,58,12,89,13,58,14,89,15,58,16,89,17,58,
-    18,51,19,57,1,51,20,57,2,94,1,2,58,21,50,3,
+    18,122,19,121,1,122,20,57,2,94,1,2,58,21,50,3,
     254,57,1,52,1,22,253,2,1,58,22,50,3,254,57,1,
-    52,1,23,252,2,1,57,1,51,24,25,1,2,1,58,25,
-    100,57,4,107,26,57,5,51,19,57,6,50,27,250,57,7,
+    52,1,23,252,2,1,121,1,51,24,25,1,2,1,58,25,
+    100,57,4,107,26,121,5,122,19,57,6,50,27,250,57,7,
     71,5,3,0,58,19,96,0,58,28,50,29,248,57,4,50,
     16,246,57,5,71,5,1,0,58,30,51,31,58,32,51,33,
-    58,34,51,35,58,36,100,57,4,107,37,57,5,51,20,57,
-    6,71,5,2,0,58,20,50,22,244,57,1,51,38,23,1,
-    2,1,57,1,51,39,57,2,51,39,57,3,93,1,3,57,
-    1,50,22,244,57,2,51,40,23,2,2,2,57,2,51,41,
-    57,3,51,39,57,4,93,2,3,57,2,51,42,57,3,51,
+    58,34,51,35,58,36,100,57,4,107,37,121,5,122,20,57,
+    6,71,5,2,0,58,20,50,22,244,121,1,51,38,23,1,
+    2,1,121,1,122,39,121,2,122,39,57,3,93,1,3,57,
+    1,50,22,244,121,2,51,40,23,2,2,2,121,2,122,41,
+    121,3,122,39,57,4,93,2,3,121,2,122,42,121,3,122,
     43,57,4,93,1,4,58,44,107,45,58,46,107,47,58,48,
     107,49,58,50,107,51,58,52,51,53,58,54,51,41,61,55,
     107,56,58,57,107,58,58,59,107,60,58,61,107,62,58,63,
     50,29,248,57,4,50,63,242,57,5,52,5,64,241,2,5,
     57,5,71,5,1,0,58,65,107,66,58,67,107,68,58,69,
     107,70,58,71,107,72,58,73,107,74,58,75,107,76,58,77,
-    100,57,4,107,78,57,5,51,79,57,6,71,5,2,0,58,
+    100,57,4,107,78,121,5,122,79,57,6,71,5,2,0,58,
     79,51,80,76,
 };
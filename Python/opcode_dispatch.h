@@ -118,6 +118,14 @@ switch (opcode) {
   case SETUP_ANNOTATIONS: goto SETUP_ANNOTATIONS;
   case SET_FUNC_ANNOTATIONS: goto SET_FUNC_ANNOTATIONS;
   case WIDE: goto WIDE;
+  case STORE_FAST__LOAD_FAST: goto STORE_FAST__LOAD_FAST;
+  case STORE_FAST__LOAD_CONST: goto STORE_FAST__LOAD_CONST;
+  case LOAD_CONST__STORE_FAST: goto LOAD_CONST__STORE_FAST;
+  case COMPARE__POP_JUMP_IF_FALSE: goto COMPARE__POP_JUMP_IF_FALSE;
+  case COMPARE__POP_JUMP_IF_TRUE: goto COMPARE__POP_JUMP_IF_TRUE;
+  case CMETHOD_LIST_APPEND: goto CMETHOD_LIST_APPEND;
+  case CMETHOD_DICT_GET: goto CMETHOD_DICT_GET;
+  case CFUNC_LEN: goto CFUNC_LEN;
   case 128+CLEAR_FAST: goto WIDE_CLEAR_FAST;
   case 128+ALIAS: goto WIDE_ALIAS;
   case 128+COPY: goto WIDE_COPY;
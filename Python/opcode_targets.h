@@ -119,14 +119,14 @@ static void *opcode_targets_base[256] = {
     &&SETUP_ANNOTATIONS,
     &&SET_FUNC_ANNOTATIONS,
     &&WIDE,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
+    &&STORE_FAST__LOAD_FAST,
+    &&STORE_FAST__LOAD_CONST,
+    &&LOAD_CONST__STORE_FAST,
+    &&COMPARE__POP_JUMP_IF_FALSE,
+    &&COMPARE__POP_JUMP_IF_TRUE,
+    &&CMETHOD_LIST_APPEND,
+    &&CMETHOD_DICT_GET,
+    &&CFUNC_LEN,
     &&_unknown_opcode,
     &&_unknown_opcode,
     &&WIDE_CLEAR_FAST,
@@ -7,6 +7,7 @@
 
 #include "pycore_ceval.h"         // _PyEval_FiniGIL()
 #include "pycore_context.h"       // _PyContext_Init()
+#include "pycore_cpuinfo.h"       // _Py_InitCpuFeatures()
 #include "pycore_fileutils.h"     // _Py_ResetForceASCII()
 #include "pycore_import.h"        // _PyImport_Cleanup()
 #include "pycore_initconfig.h"    // _PyStatus_OK()
@@ -19,6 +20,7 @@
 #include "pycore_sysmodule.h"     // _PySys_ClearAuditHooks()
 #include "pycore_traceback.h"     // _Py_DumpTracebackThreads()
 
+#include "ceval_meta.h"           // vm_specialize_builtins()
 #include "grammar.h"              // PyGrammar_RemoveAccelerators()
 #include <locale.h>               // setlocale()
 
@@ -80,6 +82,7 @@ _PyRuntime_Initialize(void)
     }
     runtime_initialized = 1;
 
+    _Py_InitCpuFeatures();
     return _PyRuntimeState_Init(&_PyRuntime);
 }
 
@@ -661,6 +664,7 @@ pycore_init_builtins(PyThreadState *tstate)
     }
     Py_INCREF(builtins_dict);
     interp->builtins = builtins_dict;
+    vm_specialize_builtins(builtins_dict);
 
     PyStatus status = _PyBuiltins_AddExceptions(bimod);
     if (_PyStatus_EXCEPTION(status)) {
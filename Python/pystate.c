@@ -13,6 +13,7 @@
 #include "pycore_refcnt.h"
 
 #include "ceval_meta.h"
+#include "pycore_stackwalk.h"
 #include "lock.h"
 #include "parking_lot.h"
 #include "mimalloc.h"
@@ -154,6 +155,7 @@ _PyRuntimeState_ReInitThreads(_PyRuntimeState *runtime)
 
     // re-init stop-the-world mutex as LOCKED but with no waiters
     runtime->stoptheworld_mutex.v = LOCKED;
+    runtime->handshake_mutex.v = UNLOCKED;
 
     int interp_mutex = _PyThread_at_fork_reinit(&runtime->interpreters.mutex);
     int xidregistry_mutex = _PyThread_at_fork_reinit(&runtime->xidregistry.mutex);
@@ -212,6 +214,45 @@ _PyThreadState_Attach(PyThreadState *tstate)
     return 0;
 }
 
+// Called with HEAD_LOCK held when tstate has stopped for the pending
+// stop-the-world request. If it is the last thread to stop, remember it and
+// wake up the requesting thread. tstate is NULL if the thread is exiting.
+static void
+stop_countdown_arrive(struct _gc_runtime_state *gc, PyThreadState *tstate,
+                      unsigned long thread_id)
+{
+    gc->gc_thread_countdown--;
+    assert(gc->gc_thread_countdown >= 0);
+    if (gc->gc_thread_countdown == 0) {
+        gc->gc_stop_last = tstate;
+        gc->gc_stop_last_id = thread_id;
+        _PyRawEvent_Notify(&gc->gc_stop_event);
+    }
+}
+
+enum {
+    HANDSHAKE_PENDING = 0,
+    HANDSHAKE_RETRY,        // the target detached: try again to borrow it
+    HANDSHAKE_CLAIMED,      // func is running
+    HANDSHAKE_DONE,
+    HANDSHAKE_GONE = 8      // flag: the target exited
+};
+
+// Called with HEAD_LOCK held. Wake up the thread waiting to handshake with
+// tstate, if any, so that it tries to run the handshake on its behalf.
+static void
+wake_handshake_requester(PyThreadState *tstate)
+{
+    struct _Py_handshake *hs = ((PyThreadStateImpl *)tstate)->handshake;
+    if (hs != NULL &&
+        _Py_atomic_compare_exchange_int32(
+            &hs->state,
+            HANDSHAKE_PENDING,
+            HANDSHAKE_RETRY)) {
+        _PyParkingLot_UnparkAll(&hs->state);
+    }
+}
+
 static void
 _PyThreadState_Detach(PyThreadState *tstate)
 {
@@ -222,6 +263,35 @@ _PyThreadState_Detach(PyThreadState *tstate)
     }
 
     _Py_atomic_store_int32(&tstate->status, _Py_THREAD_DETACHED);
+
+    // If a stop-the-world is pending, the requesting thread may have seen
+    // us attached and be waiting for us: stop on its behalf instead of
+    // making it poll. This pairs with the store to runtime->stop_the_world
+    // in _PyRuntimeState_StopTheWorld(): either it sees us detached and
+    // parks us itself, or we see its request here.
+    _PyRuntimeState *runtime = &_PyRuntime;
+    if (_Py_atomic_load_int(&runtime->stop_the_world) &&
+        !tstate->cant_stop_wont_stop) {
+        struct _gc_runtime_state *gc = &tstate->interp->gc;
+        HEAD_LOCK(runtime);
+        if (gc->gc_thread_countdown > 0 &&
+            _Py_atomic_compare_exchange_int32(
+                &tstate->status,
+                _Py_THREAD_DETACHED,
+                _Py_THREAD_GC)) {
+            stop_countdown_arrive(gc, tstate, tstate->thread_id);
+        }
+        HEAD_UNLOCK(runtime);
+    }
+
+    // Same for a pending handshake. This pairs with the store to
+    // handshake in _PyRuntimeState_Handshake().
+    PyThreadStateImpl *impl = (PyThreadStateImpl *)tstate;
+    if (_Py_atomic_load_ptr(&impl->handshake) != NULL) {
+        HEAD_LOCK(runtime);
+        wake_handshake_requester(tstate);
+        HEAD_UNLOCK(runtime);
+    }
 }
 
 void
@@ -255,11 +325,7 @@ _PyThreadState_GC_Stop(PyThreadState *tstate)
     HEAD_LOCK(runtime);
     // Decrease gc_thread_countdown. If we're the last thread to stop,
     // notify the thread that requested the stop-the-world.
-    gc->gc_thread_countdown--;
-    assert(gc->gc_thread_countdown >= 0);
-    if (gc->gc_thread_countdown == 0) {
-        _PyRawEvent_Notify(&gc->gc_stop_event);
-    }
+    stop_countdown_arrive(gc, tstate, tstate->thread_id);
     HEAD_UNLOCK(runtime);
 
     _PyThreadState_GC_Park(tstate);
@@ -323,7 +389,10 @@ park_detached_threads(_PyRuntimeState *runtime, PyThreadState *this_tstate)
 
             num_parked++;
         }
-        else if (status == _Py_THREAD_ATTACHED && t != this_tstate) {
+        else if (t != this_tstate) {
+            // Attached threads stop at their next eval breaker check, or
+            // when they detach. Detached threads that can't stop yet will
+            // do so once they reattach and reach an eval breaker check.
             _PyThreadState_Signal(t, EVAL_PLEASE_STOP);
         }
     }
@@ -331,11 +400,51 @@ park_detached_threads(_PyRuntimeState *runtime, PyThreadState *this_tstate)
     return num_parked;
 }
 
+// Record the time to safepoint of the stop-the-world request that started
+// at `start`, and where the last thread to stop was. All other threads are
+// stopped, so the last thread's stack can be walked safely.
+static void
+record_time_to_safepoint(struct _gc_runtime_state *gc, _PyTime_t start,
+                         int waited)
+{
+    struct _gc_stw_stats *stats = &gc->stw_stats;
+    _PyTime_t t = _PyTime_GetMonotonicClock() - start;
+
+    stats->stops++;
+    stats->total_time += t;
+    stats->last_time = t;
+    if (t > stats->max_time) {
+        stats->max_time = t;
+    }
+
+    PyObject *code = NULL;
+    int lineno = -1;
+    PyThreadState *last = waited ? gc->gc_stop_last : NULL;
+    struct _PyThreadStack *ts = last ? vm_active(last) : NULL;
+    if (ts != NULL) {
+        struct stack_walk w;
+        vm_stack_walk_init(&w, ts);
+        if (vm_stack_walk(&w)) {
+            PyFunctionObject *func = (PyFunctionObject *)AS_OBJ(w.regs[-1]);
+            code = (PyObject *)_PyFunction_GET_CODE(func);
+            lineno = vm_stack_walk_lineno(&w);
+            Py_INCREF(code);
+        }
+    }
+    stats->last_thread_id = waited ? gc->gc_stop_last_id : 0;
+    // Don't risk running a deallocator while the world is stopped
+    assert(gc->gc_stop_stale_code == NULL);
+    gc->gc_stop_stale_code = stats->last_code;
+    stats->last_code = code;
+    stats->last_lineno = lineno;
+}
+
 void
 _PyRuntimeState_StopTheWorld(_PyRuntimeState *runtime)
 {
     PyThreadState *this_tstate = PyThreadState_Get();
     struct _gc_runtime_state *gc = &this_tstate->interp->gc;
+    _PyTime_t start = _PyTime_GetMonotonicClock();
 
     assert(_PyMutex_is_locked(&runtime->stoptheworld_mutex));
 
@@ -348,15 +457,17 @@ _PyRuntimeState_StopTheWorld(_PyRuntimeState *runtime)
         return;
     }
 
-    runtime->stop_the_world = 1;
+    // Sequentially consistent store: pairs with the load in
+    // _PyThreadState_Detach().
+    _Py_atomic_store_int(&runtime->stop_the_world, 1);
     gc->gc_thread_countdown = 0;
+    gc->gc_stop_last = NULL;
+    gc->gc_stop_last_id = 0;
 
     PyThreadState *t;
     for_each_thread(t) {
-#ifdef Py_DEBUG
-        int s = _PyThreadState_GetStatus(t);
-        assert(s == _Py_THREAD_ATTACHED || s == _Py_THREAD_DETACHED);
-#endif
+        // A thread may also be borrowed for a handshake (_Py_THREAD_GC):
+        // it is counted, and arrives when the handshake releases it.
         gc->gc_thread_countdown++;
     }
 
@@ -373,25 +484,17 @@ _PyRuntimeState_StopTheWorld(_PyRuntimeState *runtime)
     HEAD_UNLOCK(runtime);
 
     // We're done if we successfully transitioned all other threads to
-    // _Py_THREAD_GC (or if we are the only thread).
-    while (!stopped_all_threads) {
-        // Otherwise we need to wait until the remaining threads stop themselves.
-        int64_t wait_ns = 1000*1000;
-        if (_PyRawEvent_TimedWait(&gc->gc_stop_event, wait_ns)) {
-            assert(gc->gc_thread_countdown == 0);
-            assert_all_stopped(runtime, this_tstate);
-            _PyRawEvent_Reset(&gc->gc_stop_event);
-            break;
-        }
-
-        // Ask nicely: park_detached_threads sets eval_breaker to trigger this soon.
-        HEAD_LOCK(runtime);
-        int num_detached = park_detached_threads(runtime, this_tstate);
-        gc->gc_thread_countdown -= num_detached;
-        assert(gc->gc_thread_countdown >= 0);
-        stopped_all_threads = (num_detached > 0) && (gc->gc_thread_countdown == 0);
-        HEAD_UNLOCK(runtime);
+    // _Py_THREAD_GC (or if we are the only thread). Otherwise the remaining
+    // threads stop themselves, at an eval breaker check, when they detach
+    // or when they exit, and the last one notifies gc_stop_event.
+    if (!stopped_all_threads) {
+        _PyRawEvent_Wait(&gc->gc_stop_event);
+        assert(gc->gc_thread_countdown == 0);
+        assert_all_stopped(runtime, this_tstate);
+        _PyRawEvent_Reset(&gc->gc_stop_event);
     }
+
+    record_time_to_safepoint(gc, start, !stopped_all_threads);
 }
 
 void
@@ -407,7 +510,7 @@ _PyRuntimeState_StartTheWorld(_PyRuntimeState *runtime)
         return;
     }
 
-    runtime->stop_the_world = 0;
+    _Py_atomic_store_int(&runtime->stop_the_world, 0);
     PyThreadState *t;
     for_each_thread(t) {
         int status = _PyThreadState_GetStatus(t);
@@ -418,9 +521,161 @@ _PyRuntimeState_StartTheWorld(_PyRuntimeState *runtime)
                 _Py_THREAD_DETACHED)) {
 
             _PyParkingLot_UnparkAll(&t->status);
+            wake_handshake_requester(t);
+        }
+    }
+    struct _gc_runtime_state *gc = &PyThreadState_GET()->interp->gc;
+    PyObject *stale_code = gc->gc_stop_stale_code;
+    gc->gc_stop_stale_code = NULL;
+    HEAD_UNLOCK(runtime);
+
+    Py_XDECREF(stale_code);
+}
+
+static int
+claim_handshake(struct _Py_handshake *hs)
+{
+    for (;;) {
+        int32_t state = _Py_atomic_load_int32(&hs->state);
+        if (state != HANDSHAKE_PENDING && state != HANDSHAKE_RETRY) {
+            return 0;
+        }
+        if (_Py_atomic_compare_exchange_int32(
+                &hs->state, state, HANDSHAKE_CLAIMED)) {
+            return 1;
+        }
+    }
+}
+
+// Called at an eval breaker check when EVAL_HANDSHAKE is set.
+void
+_PyThreadState_HandleHandshake(PyThreadState *tstate)
+{
+    PyThreadStateImpl *impl = (PyThreadStateImpl *)tstate;
+    struct _Py_handshake *hs = _Py_atomic_load_ptr(&impl->handshake);
+    if (hs == NULL || !claim_handshake(hs)) {
+        // It already ran on our behalf while we were detached
+        return;
+    }
+    hs->func(tstate, hs->arg);
+    _Py_atomic_store_int32(&hs->state, HANDSHAKE_DONE);
+    // Only the address is used: the requester may have returned already
+    _PyParkingLot_UnparkAll(&hs->state);
+}
+
+static PyThreadState *
+find_thread(_PyRuntimeState *runtime, unsigned long thread_id)
+{
+    PyThreadState *t;
+    for_each_thread(t) {
+        if (t->thread_id == thread_id) {
+            return t;
+        }
+    }
+    return NULL;
+}
+
+// Called with HEAD_LOCK held. Keep the detached thread t from re-attaching
+// so that a handshake can run on its behalf.
+static int
+borrow_thread(PyThreadState *t)
+{
+    return (!_Py_atomic_load_int32_relaxed(&t->cant_stop_wont_stop) &&
+            _Py_atomic_compare_exchange_int32(
+                &t->status,
+                _Py_THREAD_DETACHED,
+                _Py_THREAD_GC));
+}
+
+static void
+release_thread(_PyRuntimeState *runtime, PyThreadState *t)
+{
+    struct _gc_runtime_state *gc = &t->interp->gc;
+    if (runtime->stop_the_world && gc->gc_thread_countdown > 0) {
+        // A stop-the-world started meanwhile and counted t: leave it
+        // stopped for it.
+        stop_countdown_arrive(gc, t, t->thread_id);
+    }
+    else {
+        _Py_atomic_store_int32(&t->status, _Py_THREAD_DETACHED);
+        _PyParkingLot_UnparkAll(&t->status);
+    }
+}
+
+int
+_PyRuntimeState_Handshake(_PyRuntimeState *runtime, unsigned long thread_id,
+                          _PyHandshakeFunc func, void *arg)
+{
+    PyThreadState *this_tstate = _PyThreadState_GET();
+    struct _Py_handshake hs = {func, arg, HANDSHAKE_PENDING};
+
+    // Wait detached, so that other threads can stop us or handshake with
+    // us meanwhile.
+    if (!_PyMutex_TryLock(&runtime->handshake_mutex)) {
+        Py_BEGIN_ALLOW_THREADS
+        _PyMutex_lock(&runtime->handshake_mutex);
+        Py_END_ALLOW_THREADS
+    }
+
+    HEAD_LOCK(runtime);
+    PyThreadState *t = find_thread(runtime, thread_id);
+    if (t == NULL || t == this_tstate) {
+        HEAD_UNLOCK(runtime);
+        _PyMutex_unlock(&runtime->handshake_mutex);
+        if (t == NULL) {
+            return 0;
+        }
+        func(t, arg);
+        return 1;
+    }
+
+    PyThreadStateImpl *impl = (PyThreadStateImpl *)t;
+    assert(impl->handshake == NULL);
+    _Py_atomic_store_ptr(&impl->handshake, &hs);
+    _PyThreadState_Signal(t, EVAL_HANDSHAKE);
+
+    int32_t state;
+    for (;;) {
+        state = _Py_atomic_load_int32(&hs.state);
+        if (state == HANDSHAKE_DONE || (state & HANDSHAKE_GONE)) {
+            break;
         }
+        if (state == HANDSHAKE_RETRY) {
+            // Consume the wake up before checking t's status again
+            _Py_atomic_compare_exchange_int32(
+                &hs.state, HANDSHAKE_RETRY, HANDSHAKE_PENDING);
+            continue;
+        }
+        if (state == HANDSHAKE_PENDING && borrow_thread(t)) {
+            // t can't claim the handshake while it is detached, but it may
+            // have run it before detaching.
+            if (claim_handshake(&hs)) {
+                // Don't stop for a GC while t is borrowed
+                this_tstate->cant_stop_wont_stop++;
+                func(t, arg);
+                this_tstate->cant_stop_wont_stop--;
+            }
+            state = HANDSHAKE_DONE;
+            _Py_atomic_store_ptr(&impl->handshake, NULL);
+            release_thread(runtime, t);
+            break;
+        }
+
+        // Wait until t runs the handshake, detaches or exits
+        HEAD_UNLOCK(runtime);
+        Py_BEGIN_ALLOW_THREADS
+        _PyParkingLot_ParkInt32(&hs.state, state);
+        Py_END_ALLOW_THREADS
+        HEAD_LOCK(runtime);
+    }
+
+    if (!(state & HANDSHAKE_GONE)) {
+        // Otherwise t cleared it when it exited
+        _Py_atomic_store_ptr(&impl->handshake, NULL);
     }
     HEAD_UNLOCK(runtime);
+    _PyMutex_unlock(&runtime->handshake_mutex);
+    return (state & ~HANDSHAKE_GONE) == HANDSHAKE_DONE;
 }
 
 void
@@ -589,6 +844,9 @@ PyInterpreterState_Clear(PyInterpreterState *interp)
     }
     HEAD_UNLOCK(runtime);
 
+#ifdef Py_VM_STATS
+    vm_stats_clear(interp);
+#endif
     Py_CLEAR(interp->audit_hooks);
 
     PyConfig_Clear(&interp->config);
@@ -628,6 +886,31 @@ zapthreads(PyInterpreterState *interp, int check_current)
     }
 }
 
+static void
+free_thread_stack(struct _PyThreadStack *ts)
+{
+    if (ts != NULL) {
+        vm_free_threadstate(ts);
+        PyMem_RawFree(ts);
+    }
+}
+
+/* Like zapthreads(), called when all the threads are dead: no locking */
+static void
+clear_tstate_pool(PyInterpreterState *interp)
+{
+    PyThreadState *pool = interp->tstate_pool;
+    interp->tstate_pool = NULL;
+    interp->tstate_pool_size = 0;
+
+    while (pool != NULL) {
+        PyThreadState *next = pool->next;
+        free_thread_stack(pool->active);
+        PyMem_RawFree(pool);
+        pool = next;
+    }
+}
+
 
 void
 PyInterpreterState_Delete(PyInterpreterState *interp)
@@ -639,6 +922,7 @@ PyInterpreterState_Delete(PyInterpreterState *interp)
     _PyThreadState_Swap(&runtime->gilstate, NULL);
 
     zapthreads(interp, 0);
+    clear_tstate_pool(interp);
 
     _PyEval_FiniState(&interp->ceval);
 
@@ -700,6 +984,7 @@ _PyInterpreterState_DeleteExceptMain(_PyRuntimeState *runtime)
 
         PyInterpreterState_Clear(interp);  // XXX must activate?
         zapthreads(interp, 1);
+        clear_tstate_pool(interp);
         if (interp->id_mutex != NULL) {
             PyThread_free_lock(interp->id_mutex);
         }
@@ -917,6 +1202,39 @@ _PyInterpreterState_WaitForThreads(PyInterpreterState *interp)
     }
 }
 
+/* Number of deleted thread states kept per interpreter for reuse. Starting a
+   thread then skips allocating and clearing the thread state and its stack. */
+#define TSTATE_POOL_SIZE 16
+
+/* Free a deleted thread state, or keep it for new_threadstate() */
+static void
+free_threadstate(PyThreadState *tstate)
+{
+    PyInterpreterState *interp = tstate->interp;
+    _PyRuntimeState *runtime = interp->runtime;
+    struct _PyThreadStack *ts = tstate->active;
+
+    if (ts != NULL && ts->prev == NULL && ts->regs == ts->stack) {
+        if (vm_reset_threadstate(ts) == 0) {
+            HEAD_LOCK(runtime);
+            if (interp->tstate_pool_size < TSTATE_POOL_SIZE) {
+                tstate->next = interp->tstate_pool;
+                interp->tstate_pool = tstate;
+                interp->tstate_pool_size++;
+                tstate = NULL;
+            }
+            HEAD_UNLOCK(runtime);
+            if (tstate == NULL) {
+                return;
+            }
+        }
+        free_thread_stack(ts);
+    }
+    // Otherwise, the thread was still running code (e.g. in a child
+    // process after fork()): its stack is leaked along with its frames.
+    PyMem_RawFree(tstate);
+}
+
 static PyThreadState *
 new_threadstate(PyInterpreterState *interp, int init, _PyEventRc *done_event)
 {
@@ -932,10 +1250,23 @@ new_threadstate(PyInterpreterState *interp, int init, _PyEventRc *done_event)
         _PyEventRc_Incref(done_event);
     }
 
-    PyThreadStateImpl *tstate_impl = PyMem_RawMalloc(sizeof(PyThreadStateImpl));
+    // Reuse a deleted thread state and its stack if there is one
+    struct _PyThreadStack *ts = NULL;
+    HEAD_LOCK(runtime);
+    PyThreadStateImpl *tstate_impl = (PyThreadStateImpl *)interp->tstate_pool;
+    if (tstate_impl != NULL) {
+        interp->tstate_pool = tstate_impl->tstate.next;
+        interp->tstate_pool_size--;
+        ts = tstate_impl->tstate.active;
+    }
+    HEAD_UNLOCK(runtime);
+
     if (tstate_impl == NULL) {
-        _PyEventRc_Decref(done_event);
-        return NULL;
+        tstate_impl = PyMem_RawMalloc(sizeof(PyThreadStateImpl));
+        if (tstate_impl == NULL) {
+            _PyEventRc_Decref(done_event);
+            return NULL;
+        }
     }
 
     memset(tstate_impl, 0, sizeof(PyThreadStateImpl));
@@ -991,15 +1322,21 @@ new_threadstate(PyInterpreterState *interp, int init, _PyEventRc *done_event)
 
     tstate_impl->qsbr = _Py_qsbr_register(&_PyRuntime.qsbr_shared, tstate);
     if (tstate_impl->qsbr == NULL) {
+        free_thread_stack(ts);
         PyMem_RawFree(tstate);
         return NULL;
     }
 
-    // FIXME: leaks thread-state
-    struct _PyThreadStack *ts = vm_new_threadstate(tstate);
     if (ts == NULL) {
-        PyMem_RawFree(tstate);
-        return NULL;
+        ts = vm_new_threadstate(tstate);
+        if (ts == NULL) {
+            _Py_qsbr_unregister(tstate_impl->qsbr);
+            PyMem_RawFree(tstate);
+            return NULL;
+        }
+    }
+    else {
+        ts->ts = tstate;
     }
     vm_push_thread_stack(tstate, ts);
 
@@ -1227,6 +1564,9 @@ PyThreadState_Clear(PyThreadState *tstate)
     Py_CLEAR(tstate->context);
 
     _PyTypeId_MergeRefcounts(&_PyRuntime.typeids, tstate);
+#ifdef Py_VM_STATS
+    vm_stats_merge(tstate);
+#endif
 }
 
 /* Common code for PyThreadState_Delete() and PyThreadState_DeleteCurrent() */
@@ -1281,6 +1621,20 @@ tstate_delete_common(PyThreadState *tstate,
     }
     done_event = tstate->done_event;
     tstate->done_event = NULL;
+
+    // Let a thread waiting to handshake with us know we are gone
+    struct _Py_handshake *hs = ((PyThreadStateImpl *)tstate)->handshake;
+    if (hs != NULL) {
+        ((PyThreadStateImpl *)tstate)->handshake = NULL;
+        for (;;) {
+            int32_t state = _Py_atomic_load_int32(&hs->state);
+            if (_Py_atomic_compare_exchange_int32(
+                    &hs->state, state, state | HANDSHAKE_GONE)) {
+                break;
+            }
+        }
+        _PyParkingLot_UnparkAll(&hs->state);
+    }
 #ifdef Py_REF_DEBUG
     runtime->ref_total += tstate->ref_total;
     tstate->ref_total = 0;
@@ -1291,12 +1645,7 @@ tstate_delete_common(PyThreadState *tstate,
         tstate != _PyRuntimeState_GetFinalizing(&_PyRuntime)) {
         // If another thread is waiting for us to stop, decrease gc_thread_countdown
         // and potentially notify them.
-        struct _gc_runtime_state *gc = &tstate->interp->gc;
-        gc->gc_thread_countdown--;
-        assert(gc->gc_thread_countdown >= 0);
-        if (gc->gc_thread_countdown == 0) {
-            _PyRawEvent_Notify(&gc->gc_stop_event);
-        }
+        stop_countdown_arrive(&tstate->interp->gc, NULL, tstate->thread_id);
     }
 
     HEAD_UNLOCK(runtime);
@@ -1326,7 +1675,7 @@ _PyThreadState_Delete(PyThreadState *tstate, int check_current)
         }
     }
     tstate_delete_common(tstate, gilstate, 0);
-    PyMem_RawFree(tstate);
+    free_threadstate(tstate);
 }
 
 
@@ -1345,7 +1694,7 @@ _PyThreadState_DeleteCurrent(PyThreadState *tstate)
     tstate_delete_common(tstate, gilstate, 1);
     _PyRuntimeGILState_SetThreadState(gilstate, NULL);
     _PyEval_ReleaseLock(tstate);
-    PyMem_RawFree(tstate);
+    free_threadstate(tstate);
 }
 
 void
@@ -1627,10 +1976,57 @@ PyThreadState_Next(PyThreadState *tstate) {
     return tstate->next;
 }
 
-/* The implementation of sys._current_frames().  This is intended to be
-   called with the GIL held, as it will be when called via
-   sys._current_frames().  It's possible it would work fine even without
-   the GIL held, but haven't thought enough about that.
+unsigned long *
+_PyRuntimeState_GetThreadIds(_PyRuntimeState *runtime, Py_ssize_t *count)
+{
+    Py_ssize_t n = 0;
+    PyThreadState *t;
+    HEAD_LOCK(runtime);
+    for_each_thread(t) {
+        n++;
+    }
+    unsigned long *ids = PyMem_RawMalloc(n * sizeof(unsigned long));
+    if (ids == NULL) {
+        HEAD_UNLOCK(runtime);
+        PyErr_NoMemory();
+        return NULL;
+    }
+    n = 0;
+    for_each_thread(t) {
+        ids[n++] = t->thread_id;
+    }
+    HEAD_UNLOCK(runtime);
+    *count = n;
+    return ids;
+}
+
+struct frame_capture {
+    PyFrameObject *frame;
+    PyObject *exc_type, *exc_value, *exc_tb;
+};
+
+// Handshake function: runs in the target thread, or on its behalf
+static void
+capture_frame(PyThreadState *t, void *arg)
+{
+    struct frame_capture *fc = (struct frame_capture *)arg;
+    PyObject *type, *value, *tb;
+
+    PyErr_Fetch(&type, &value, &tb);
+    fc->frame = vm_frame(t);
+    if (fc->frame != NULL) {
+        // Keep it alive once the thread resumes
+        Py_INCREF(fc->frame);
+    }
+    else {
+        PyErr_Fetch(&fc->exc_type, &fc->exc_value, &fc->exc_tb);
+    }
+    PyErr_Restore(type, value, tb);
+}
+
+/* The implementation of sys._current_frames().  Each thread is paused in
+   turn with a handshake while its frame is captured, instead of stopping
+   all threads at once.
 */
 PyObject *
 _PyThread_CurrentFrames(void)
@@ -1640,38 +2036,42 @@ _PyThread_CurrentFrames(void)
         return NULL;
     }
 
-    PyObject *result = PyDict_New();
-    if (result == NULL) {
+    /* Collect the thread ids first: handshakes release head_mutex while
+     * they wait, so threads may come and go meanwhile.
+     */
+    _PyRuntimeState *runtime = tstate->interp->runtime;
+    Py_ssize_t n, k;
+    unsigned long *ids = _PyRuntimeState_GetThreadIds(runtime, &n);
+    if (ids == NULL) {
         return NULL;
     }
 
-    _PyMutex_lock(&_PyRuntime.stoptheworld_mutex);
-    _PyRuntimeState_StopTheWorld(&_PyRuntime);
-    tstate->cant_stop_wont_stop++;
+    PyObject *result = PyDict_New();
+    if (result == NULL) {
+        goto done;
+    }
 
-    /* for i in all interpreters:
-     *     for t in all of i's thread states:
-     *          if t's frame isn't NULL, map t's id to its frame
-     * Because these lists can mutate even when the GIL is held, we
-     * need to grab head_mutex for the duration.
-     */
-    _PyRuntimeState *runtime = tstate->interp->runtime;
-    HEAD_LOCK(runtime);
-    PyThreadState *t;
-    for_each_thread(t) {
-        PyFrameObject *frame = vm_frame(t);
-        if (frame == NULL) {
-            if (_PyErr_Occurred(tstate)) {
+    for (k = 0; k < n; k++) {
+        struct frame_capture fc = {NULL, NULL, NULL, NULL};
+        if (!_PyRuntimeState_Handshake(runtime, ids[k], capture_frame, &fc)) {
+            // The thread exited
+            continue;
+        }
+        if (fc.frame == NULL) {
+            if (fc.exc_type != NULL) {
+                PyErr_Restore(fc.exc_type, fc.exc_value, fc.exc_tb);
                 goto fail;
             }
             continue;
         }
-        PyObject *id = PyLong_FromUnsignedLong(t->thread_id);
+        PyObject *id = PyLong_FromUnsignedLong(ids[k]);
         if (id == NULL) {
+            Py_DECREF(fc.frame);
             goto fail;
         }
-        int stat = PyDict_SetItem(result, id, (PyObject *)frame);
+        int stat = PyDict_SetItem(result, id, (PyObject *)fc.frame);
         Py_DECREF(id);
+        Py_DECREF(fc.frame);
         if (stat < 0) {
             goto fail;
         }
@@ -1682,10 +2082,7 @@ fail:
     Py_CLEAR(result);
 
 done:
-    HEAD_UNLOCK(runtime);
-    tstate->cant_stop_wont_stop--;
-    _PyRuntimeState_StartTheWorld(&_PyRuntime);
-    _PyMutex_unlock(&_PyRuntime.stoptheworld_mutex);
+    PyMem_RawFree(ids);
     return result;
 }
 
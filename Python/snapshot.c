@@ -0,0 +1,1116 @@
+/* Bytecode snapshots.
+
+   A snapshot holds the code objects of a set of modules in the form they
+   have in memory, so that importing one of them needs neither its .pyc
+   file nor unmarshalling.  The file is mapped into memory (copy on write)
+   and the objects of a module are relocated in place the first time the
+   module is imported.  They are immortal and never freed.
+
+   The file is written in native byte order for the build that reads it:
+
+     snapshot_header
+     snapshot_module[nmodules]   sorted by source path
+     snapshot_range[nstrings]    UTF-8 data of the strings
+     snapshot_range[nblobs]      marshal data of the blobs
+     data                        paths, strings, blobs, and for each
+                                 module a segment and its relocations
+
+   A segment holds a module code object with its nested code objects and
+   their constants of the types tuple, bytes, int, float and complex,
+   each preceded by a zeroed GC header when its type has one.  Every
+   pointer in a segment has a relocation, which gives its target: another
+   object of the segment, a type, a singleton or a small int, a string,
+   which is decoded and interned when first needed, or a blob, a
+   marshalled constant of any other type like a frozenset. */
+
+#include "Python.h"
+#include "longintrepr.h"
+#include "code.h"
+#include "marshal.h"
+#include "pycore_code.h"
+#include "pycore_gc.h"            // PyGC_Head
+#include "pycore_snapshot.h"
+
+#include <stddef.h>               // offsetof()
+
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+#ifdef MS_WINDOWS
+#include <io.h>                   // _read()
+#endif
+
+static const char SNAPSHOT_MAGIC[8] = {'P', 'y', 'S', 'n', 'a', 'p', '0', '1'};
+
+/* Objects in a segment are aligned like the ones of the allocator */
+#define SNAPSHOT_ALIGN 16
+
+typedef struct {
+    char magic[8];
+    uint32_t pyc_magic;         /* importlib.util.MAGIC_NUMBER */
+    uint16_t object_size;       /* sizeof(PyObject) */
+    uint16_t code_size;         /* sizeof(PyCodeObject) */
+    uint16_t gc_head_size;      /* sizeof(PyGC_Head) */
+    uint8_t pointer_size;
+    int8_t optimize;            /* sys.flags.optimize */
+    uint32_t nmodules;
+    uint32_t nstrings;
+    uint32_t nblobs;
+    uint32_t reserved;
+    uint64_t size;              /* of the file */
+} snapshot_header;
+
+typedef struct {
+    uint64_t offset;            /* in the file */
+    uint64_t size;
+} snapshot_range;
+
+typedef struct {
+    snapshot_range path;        /* UTF-8 encoded source path */
+    int64_t mtime;
+    int64_t size;
+    snapshot_range segment;
+    snapshot_range relocs;
+    uint64_t root;              /* offset of the module code in the segment */
+} snapshot_module;
+
+typedef struct {
+    uint32_t slot;              /* offset of the pointer in the segment */
+    uint32_t target;
+} snapshot_reloc;
+
+enum {
+    RELOC_SEGMENT,              /* index: offset in the segment */
+    RELOC_TYPE,                 /* index: see snapshot_type() */
+    RELOC_CONST,                /* index: see snapshot_const() */
+    RELOC_SMALLINT,             /* index: value - SMALLINT_MIN */
+    RELOC_STRING,               /* index: in the string table */
+    RELOC_BLOB,                 /* index: in the blob table */
+};
+
+#define RELOC_SHIFT 28
+#define RELOC_INDEX_MAX ((1u << RELOC_SHIFT) - 1)
+#define RELOC_TARGET(kind, index) (((uint32_t)(kind) << RELOC_SHIFT) | (index))
+#define RELOC_KIND(target) ((target) >> RELOC_SHIFT)
+#define RELOC_INDEX(target) ((target) & RELOC_INDEX_MAX)
+
+#define SMALLINT_MIN (-5)
+#define SMALLINT_MAX 256
+
+struct _PySnapshot {
+    _PyRecursiveMutex mutex;
+    char *base;
+    size_t size;
+    int mapped;
+    const snapshot_header *header;
+    const snapshot_module *modules;
+    const snapshot_range *strings;
+    const snapshot_range *blobs;
+    PyObject **string_objects;  /* decoded and interned when first needed */
+    PyObject **blob_objects;    /* unmarshalled when first needed */
+    int *relocated;             /* per module */
+};
+
+static PyTypeObject *
+snapshot_type(uint32_t index)
+{
+    switch (index) {
+    case 0: return &PyCode_Type;
+    case 1: return &PyTuple_Type;
+    case 2: return &PyBytes_Type;
+    case 3: return &PyLong_Type;
+    case 4: return &PyFloat_Type;
+    case 5: return &PyComplex_Type;
+    }
+    return NULL;
+}
+
+/* Return a new reference */
+static PyObject *
+snapshot_const(uint32_t index)
+{
+    switch (index) {
+    case 0: Py_RETURN_NONE;
+    case 1: Py_RETURN_TRUE;
+    case 2: Py_RETURN_FALSE;
+    case 3: Py_INCREF(Py_Ellipsis); return Py_Ellipsis;
+    case 4: return PyTuple_New(0);
+    case 5: return PyBytes_FromStringAndSize(NULL, 0);
+    }
+    return NULL;
+}
+
+static size_t
+align_up(size_t n, size_t align)
+{
+    return (n + align - 1) & ~(align - 1);
+}
+
+
+/*********************** Writer **************************/
+
+typedef struct {
+    char *data;
+    size_t size;
+    size_t allocated;
+} snapshot_buffer;
+
+typedef struct {
+    snapshot_buffer data;       /* the data area of the file */
+    snapshot_buffer segment;    /* segment of the current module */
+    snapshot_buffer relocs;     /* relocations of the current module */
+    PyObject *memo;             /* {id(object): offset in the segment} */
+    PyObject *strings;          /* {str: index} */
+    PyObject *string_list;      /* [str] */
+    PyObject *blobs;            /* {id(object): index} */
+    PyObject *blob_data;        /* [marshal data] */
+    PyObject *blob_objects;     /* keeps the blob objects alive */
+} snapshot_writer;
+
+/* Grow the buffer by size zeroed bytes, after padding it to align.
+   Return the offset of the new bytes, or -1 on error. */
+static Py_ssize_t
+buffer_reserve(snapshot_buffer *buf, size_t size, size_t align)
+{
+    size_t start = align_up(buf->size, align);
+    size_t end = start + size;
+    if (end > (size_t)PY_SSIZE_T_MAX) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    if (end > buf->allocated) {
+        size_t allocated = Py_MAX(end, buf->allocated * 2);
+        char *data = PyMem_Realloc(buf->data, allocated);
+        if (data == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        buf->data = data;
+        buf->allocated = allocated;
+    }
+    memset(buf->data + buf->size, 0, end - buf->size);
+    buf->size = end;
+    return (Py_ssize_t)start;
+}
+
+static Py_ssize_t
+buffer_append(snapshot_buffer *buf, const void *data, size_t size,
+              size_t align)
+{
+    Py_ssize_t offset = buffer_reserve(buf, size, align);
+    if (offset >= 0 && size > 0) {
+        memcpy(buf->data + offset, data, size);
+    }
+    return offset;
+}
+
+static void
+buffer_clear(snapshot_buffer *buf)
+{
+    PyMem_Free(buf->data);
+    buf->data = NULL;
+    buf->size = buf->allocated = 0;
+}
+
+static int
+w_reloc(snapshot_writer *w, size_t slot, int kind, size_t index)
+{
+    if (slot > UINT32_MAX || index > RELOC_INDEX_MAX) {
+        PyErr_SetString(PyExc_ValueError,
+                        "code object too large for a snapshot");
+        return -1;
+    }
+    snapshot_reloc reloc = {(uint32_t)slot, RELOC_TARGET(kind, index)};
+    return buffer_append(&w->relocs, &reloc, sizeof(reloc), 1) < 0 ? -1 : 0;
+}
+
+/* Add a relocation for a pointer into the segment itself */
+static int
+w_internal(snapshot_writer *w, size_t slot, size_t offset)
+{
+    return w_reloc(w, slot, RELOC_SEGMENT, offset);
+}
+
+static Py_ssize_t
+w_index(PyObject *dict, PyObject *key, PyObject *list, PyObject *value)
+{
+    PyObject *index = PyDict_GetItemWithError(dict, key);
+    if (index != NULL) {
+        return PyLong_AsSsize_t(index);
+    }
+    if (PyErr_Occurred()) {
+        return -1;
+    }
+    Py_ssize_t n = PyList_GET_SIZE(list);
+    index = PyLong_FromSsize_t(n);
+    if (index == NULL) {
+        return -1;
+    }
+    int err = PyDict_SetItem(dict, key, index);
+    Py_DECREF(index);
+    if (err < 0 || PyList_Append(list, value) < 0) {
+        return -1;
+    }
+    return n;
+}
+
+/* Marshal a constant of a type that has no layout in the segment */
+static Py_ssize_t
+w_blob(snapshot_writer *w, PyObject *op)
+{
+    PyObject *key = PyLong_FromVoidPtr(op);
+    if (key == NULL) {
+        return -1;
+    }
+    Py_ssize_t index = -1;
+    PyObject *value = PyDict_GetItemWithError(w->blobs, key);
+    if (value != NULL) {
+        index = PyLong_AsSsize_t(value);
+    }
+    else if (!PyErr_Occurred()) {
+        PyObject *data = PyMarshal_WriteObjectToString(op, Py_MARSHAL_VERSION);
+        /* The id is only unique while the object is alive */
+        if (data != NULL && PyList_Append(w->blob_objects, op) == 0) {
+            index = w_index(w->blobs, key, w->blob_data, data);
+        }
+        Py_XDECREF(data);
+    }
+    Py_DECREF(key);
+    return index;
+}
+
+static Py_ssize_t w_object(snapshot_writer *w, PyObject *op);
+
+/* Fill the pointer at offset slot of the segment with a reference to op */
+static int
+w_ref(snapshot_writer *w, size_t slot, PyObject *op)
+{
+    Py_ssize_t index;
+    int kind;
+
+    if (op == Py_None || op == Py_True || op == Py_False ||
+            op == Py_Ellipsis) {
+        kind = RELOC_CONST;
+        index = (op == Py_None ? 0 : op == Py_True ? 1 :
+                 op == Py_False ? 2 : 3);
+    }
+    else if (PyTuple_CheckExact(op) && PyTuple_GET_SIZE(op) == 0) {
+        kind = RELOC_CONST;
+        index = 4;
+    }
+    else if (PyBytes_CheckExact(op) && PyBytes_GET_SIZE(op) == 0) {
+        kind = RELOC_CONST;
+        index = 5;
+    }
+    else if (PyUnicode_CheckExact(op)) {
+        kind = RELOC_STRING;
+        index = w_index(w->strings, op, w->string_list, op);
+    }
+    else if (PyLong_CheckExact(op) && Py_ABS(Py_SIZE(op)) <= 1 &&
+             PyLong_AsLong(op) >= SMALLINT_MIN &&
+             PyLong_AsLong(op) <= SMALLINT_MAX) {
+        kind = RELOC_SMALLINT;
+        index = PyLong_AsLong(op) - SMALLINT_MIN;
+    }
+    else if (PyCode_Check(op) || PyTuple_CheckExact(op) ||
+             PyBytes_CheckExact(op) || PyLong_CheckExact(op) ||
+             PyFloat_CheckExact(op) || PyComplex_CheckExact(op)) {
+        kind = RELOC_SEGMENT;
+        index = w_object(w, op);
+    }
+    else {
+        kind = RELOC_BLOB;
+        index = w_blob(w, op);
+    }
+    if (index < 0) {
+        return -1;
+    }
+    return w_reloc(w, slot, kind, (size_t)index);
+}
+
+static size_t
+object_size(PyObject *op)
+{
+    if (PyTuple_CheckExact(op)) {
+        return (offsetof(PyTupleObject, ob_item) +
+                PyTuple_GET_SIZE(op) * sizeof(PyObject *));
+    }
+    if (PyBytes_CheckExact(op)) {
+        return offsetof(PyBytesObject, ob_sval) + PyBytes_GET_SIZE(op) + 1;
+    }
+    if (PyLong_CheckExact(op)) {
+        return (offsetof(PyLongObject, ob_digit) +
+                Py_ABS(Py_SIZE(op)) * sizeof(digit));
+    }
+    if (PyFloat_CheckExact(op)) {
+        return sizeof(PyFloatObject);
+    }
+    assert(PyComplex_CheckExact(op));
+    return sizeof(PyComplexObject);
+}
+
+static size_t
+code_size(PyCodeObject *co)
+{
+    return (sizeof(PyCodeObject) +
+            align_up(co->co_size, sizeof(void *)) +
+            co->co_nmeta * sizeof(intptr_t) +
+            co->co_nconsts * sizeof(PyObject *) +
+            co->co_ncells * sizeof(Py_ssize_t) +
+            co->co_nfreevars * 2 * sizeof(Py_ssize_t) +
+            sizeof(struct _PyHandlerTable) +
+            co->co_exc_handlers->size * sizeof(ExceptionHandler) +
+            sizeof(struct _PyJumpSideTable) +
+            co->co_jump_table->size * sizeof(JumpEntry));
+}
+
+#define CODE_FIELD(off, field) ((off) + offsetof(PyCodeObject, field))
+
+/* Add a relocation for a pointer into the trailing arrays of the code
+   object at offset off, which were laid out by PyCode_New2(). */
+static int
+w_code_array(snapshot_writer *w, PyCodeObject *co, size_t off,
+             size_t slot, const void *ptr)
+{
+    if (ptr == NULL) {
+        return 0;
+    }
+    size_t delta = (const char *)ptr - (const char *)co;
+    if ((const char *)ptr < (const char *)co || delta >= code_size(co)) {
+        PyErr_SetString(PyExc_ValueError,
+                        "code object not laid out by PyCode_New2()");
+        return -1;
+    }
+    return w_internal(w, slot, off + delta);
+}
+
+static int
+w_code(snapshot_writer *w, PyCodeObject *co, size_t off)
+{
+    char *p = w->segment.data + off;
+    PyCodeObject *copy = (PyCodeObject *)p;
+
+    /* Runtime state is not saved */
+    memset(copy->co_kwmaps, 0, sizeof(copy->co_kwmaps));
+    copy->co_weakreflist = NULL;
+    copy->co_extra = NULL;
+    memset(p + sizeof(PyCodeObject) + align_up(co->co_size, sizeof(void *)),
+           -1, co->co_nmeta * sizeof(intptr_t));
+
+    size_t consts = CODE_FIELD(off, co_constants);
+    size_t cell2reg = CODE_FIELD(off, co_cell2reg);
+    size_t free2reg = CODE_FIELD(off, co_free2reg);
+    size_t handlers = CODE_FIELD(off, co_exc_handlers);
+    size_t jumps = CODE_FIELD(off, co_jump_table);
+    size_t fields[] = {
+        CODE_FIELD(off, co_varnames),
+        CODE_FIELD(off, co_freevars),
+        CODE_FIELD(off, co_cellvars),
+        CODE_FIELD(off, co_filename),
+        CODE_FIELD(off, co_name),
+        CODE_FIELD(off, co_lnotab),
+    };
+    PyObject *values[] = {
+        co->co_varnames, co->co_freevars, co->co_cellvars,
+        co->co_filename, co->co_name, co->co_lnotab,
+    };
+    size_t consts_off = off + ((char *)co->co_constants - (char *)co);
+
+    /* Clear the pointers: the file doesn't depend on addresses */
+    memset(p + offsetof(PyCodeObject, co_constants), 0,
+           offsetof(PyCodeObject, co_exc_handlers) -
+           offsetof(PyCodeObject, co_constants) + 2 * sizeof(void *));
+    for (size_t i = 0; i < Py_ARRAY_LENGTH(fields); i++) {
+        memset(w->segment.data + fields[i], 0, sizeof(PyObject *));
+    }
+    memset(w->segment.data + consts_off, 0,
+           co->co_nconsts * sizeof(PyObject *));
+
+    if (w_code_array(w, co, off, consts, co->co_constants) < 0 ||
+        w_code_array(w, co, off, cell2reg, co->co_cell2reg) < 0 ||
+        w_code_array(w, co, off, free2reg, co->co_free2reg) < 0 ||
+        w_code_array(w, co, off, handlers, co->co_exc_handlers) < 0 ||
+        w_code_array(w, co, off, jumps, co->co_jump_table) < 0) {
+        return -1;
+    }
+    /* w_ref() may grow the segment: no pointer into it from here on */
+    for (size_t i = 0; i < Py_ARRAY_LENGTH(fields); i++) {
+        if (values[i] == NULL) {
+            PyErr_SetString(PyExc_ValueError, "incomplete code object");
+            return -1;
+        }
+        if (w_ref(w, fields[i], values[i]) < 0) {
+            return -1;
+        }
+    }
+    for (Py_ssize_t i = 0; i < co->co_nconsts; i++) {
+        if (w_ref(w, consts_off + i * sizeof(PyObject *),
+                  co->co_constants[i]) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* Copy op into the segment.  Return its offset, or -1 on error. */
+static Py_ssize_t
+w_object(snapshot_writer *w, PyObject *op)
+{
+    PyObject *key = PyLong_FromVoidPtr(op);
+    if (key == NULL) {
+        return -1;
+    }
+    PyObject *memo = PyDict_GetItemWithError(w->memo, key);
+    if (memo != NULL || PyErr_Occurred()) {
+        Py_DECREF(key);
+        return memo != NULL ? PyLong_AsSsize_t(memo) : -1;
+    }
+
+    if (Py_EnterRecursiveCall(" while writing a snapshot")) {
+        Py_DECREF(key);
+        return -1;
+    }
+    size_t header = PyType_IS_GC(Py_TYPE(op)) ? sizeof(PyGC_Head) : 0;
+    size_t size = (PyCode_Check(op) ? code_size((PyCodeObject *)op)
+                                     : object_size(op));
+    Py_ssize_t start = buffer_reserve(&w->segment, header + size,
+                                      SNAPSHOT_ALIGN);
+    Py_ssize_t off = start + header;
+    PyObject *offset = start < 0 ? NULL : PyLong_FromSsize_t(off);
+    int err = (offset == NULL || PyDict_SetItem(w->memo, key, offset) < 0);
+    Py_XDECREF(offset);
+    Py_DECREF(key);
+    if (err) {
+        goto error;
+    }
+
+    memcpy(w->segment.data + off, op, size);
+    PyObject *copy = (PyObject *)(w->segment.data + off);
+    copy->ob_tid = 0;
+    copy->ob_ref_local = _Py_REF_IMMORTAL_MASK;
+    copy->ob_ref_shared = 0;
+    copy->ob_type = NULL;
+    if (PyBytes_CheckExact(op)) {
+        ((PyBytesObject *)copy)->ob_shash = -1;
+    }
+    else if (PyTuple_CheckExact(op)) {
+        memset(((PyTupleObject *)copy)->ob_item, 0,
+               PyTuple_GET_SIZE(op) * sizeof(PyObject *));
+    }
+
+    int type = (PyCode_Check(op) ? 0 : PyTuple_CheckExact(op) ? 1 :
+                PyBytes_CheckExact(op) ? 2 : PyLong_CheckExact(op) ? 3 :
+                PyFloat_CheckExact(op) ? 4 : 5);
+    if (w_reloc(w, off + offsetof(PyObject, ob_type), RELOC_TYPE, type) < 0) {
+        goto error;
+    }
+    if (PyCode_Check(op)) {
+        if (w_code(w, (PyCodeObject *)op, off) < 0) {
+            goto error;
+        }
+    }
+    else if (PyTuple_CheckExact(op)) {
+        for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(op); i++) {
+            size_t slot = (off + offsetof(PyTupleObject, ob_item) +
+                           i * sizeof(PyObject *));
+            if (w_ref(w, slot, PyTuple_GET_ITEM(op, i)) < 0) {
+                goto error;
+            }
+        }
+    }
+    Py_LeaveRecursiveCall();
+    return off;
+
+error:
+    Py_LeaveRecursiveCall();
+    return -1;
+}
+
+static int
+w_data(snapshot_writer *w, snapshot_range *range, const void *data,
+       size_t size, size_t align)
+{
+    Py_ssize_t offset = buffer_append(&w->data, data, size, align);
+    if (offset < 0) {
+        return -1;
+    }
+    range->offset = (uint64_t)offset;
+    range->size = size;
+    return 0;
+}
+
+static int
+w_module(snapshot_writer *w, snapshot_module *m, PyObject *entry)
+{
+    PyObject *path, *code;
+    long long mtime, size;
+    Py_ssize_t len;
+
+    if (!PyArg_ParseTuple(entry, "ULLO!;snapshot entries must be (path, "
+                          "mtime, size, code) tuples",
+                          &path, &mtime, &size, &PyCode_Type, &code)) {
+        return -1;
+    }
+    const char *s = PyUnicode_AsUTF8AndSize(path, &len);
+    if (s == NULL || w_data(w, &m->path, s, len, 1) < 0) {
+        return -1;
+    }
+    m->mtime = mtime;
+    m->size = size;
+
+    PyDict_Clear(w->memo);
+    w->segment.size = 0;
+    w->relocs.size = 0;
+    Py_ssize_t root = w_object(w, code);
+    if (root < 0) {
+        return -1;
+    }
+    m->root = (uint64_t)root;
+    if (w_data(w, &m->segment, w->segment.data, w->segment.size,
+               SNAPSHOT_ALIGN) < 0 ||
+        w_data(w, &m->relocs, w->relocs.data, w->relocs.size,
+               sizeof(uint32_t)) < 0) {
+        return -1;
+    }
+    return 0;
+}
+
+static int
+compare_paths(const snapshot_range *a, const snapshot_range *b,
+              const char *data)
+{
+    size_t n = Py_MIN(a->size, b->size);
+    int cmp = memcmp(data + a->offset, data + b->offset, n);
+    if (cmp != 0) {
+        return cmp;
+    }
+    return (a->size > b->size) - (a->size < b->size);
+}
+
+/* Sort the modules by path for the binary search of the reader */
+static int
+sort_modules(snapshot_module *modules, Py_ssize_t n, const char *data)
+{
+    for (Py_ssize_t i = 1; i < n; i++) {
+        snapshot_module m = modules[i];
+        Py_ssize_t j = i;
+        while (j > 0) {
+            int cmp = compare_paths(&modules[j - 1].path, &m.path, data);
+            if (cmp == 0) {
+                PyErr_SetString(PyExc_ValueError,
+                                "duplicate path in snapshot entries");
+                return -1;
+            }
+            if (cmp < 0) {
+                break;
+            }
+            modules[j] = modules[j - 1];
+            j--;
+        }
+        modules[j] = m;
+    }
+    return 0;
+}
+
+static int
+w_strings(snapshot_writer *w, snapshot_range *ranges, PyObject *list)
+{
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(list); i++) {
+        PyObject *bytes = PyUnicode_AsEncodedString(
+            PyList_GET_ITEM(list, i), "utf-8", "surrogatepass");
+        if (bytes == NULL) {
+            return -1;
+        }
+        int err = w_data(w, &ranges[i], PyBytes_AS_STRING(bytes),
+                         PyBytes_GET_SIZE(bytes), 1);
+        Py_DECREF(bytes);
+        if (err < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int
+w_blobs(snapshot_writer *w, snapshot_range *ranges, PyObject *list)
+{
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(list); i++) {
+        PyObject *bytes = PyList_GET_ITEM(list, i);
+        if (w_data(w, &ranges[i], PyBytes_AS_STRING(bytes),
+                   PyBytes_GET_SIZE(bytes), 1) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+PyObject *
+_PySnapshot_Dumps(PyObject *entries, long magic, int optimize)
+{
+    snapshot_writer w;
+    snapshot_module *modules = NULL;
+    snapshot_range *strings = NULL, *blobs = NULL;
+    PyObject *seq = NULL, *result = NULL;
+
+#ifdef Py_TRACE_REFS
+    PyErr_SetString(PyExc_NotImplementedError,
+                    "snapshots are not supported with Py_TRACE_REFS");
+    return NULL;
+#endif
+    memset(&w, 0, sizeof(w));
+    seq = PySequence_Fast(entries, "snapshot entries must be a sequence");
+    if (seq == NULL) {
+        return NULL;
+    }
+    Py_ssize_t nmodules = PySequence_Fast_GET_SIZE(seq);
+    w.memo = PyDict_New();
+    w.strings = PyDict_New();
+    w.blobs = PyDict_New();
+    w.blob_data = PyList_New(0);
+    w.blob_objects = PyList_New(0);
+    w.string_list = PyList_New(0);
+    modules = PyMem_Calloc(Py_MAX(nmodules, 1), sizeof(snapshot_module));
+    if (w.memo == NULL || w.strings == NULL || w.blobs == NULL ||
+        w.blob_data == NULL || w.blob_objects == NULL ||
+        w.string_list == NULL || modules == NULL) {
+        goto done;
+    }
+
+    for (Py_ssize_t i = 0; i < nmodules; i++) {
+        if (w_module(&w, &modules[i], PySequence_Fast_GET_ITEM(seq, i)) < 0) {
+            goto done;
+        }
+    }
+    if (sort_modules(modules, nmodules, w.data.data) < 0) {
+        goto done;
+    }
+
+    Py_ssize_t nstrings = PyList_GET_SIZE(w.string_list);
+    Py_ssize_t nblobs = PyList_GET_SIZE(w.blob_data);
+    strings = PyMem_Calloc(Py_MAX(nstrings, 1), sizeof(snapshot_range));
+    blobs = PyMem_Calloc(Py_MAX(nblobs, 1), sizeof(snapshot_range));
+    if (strings == NULL || blobs == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    if (w_strings(&w, strings, w.string_list) < 0 ||
+        w_blobs(&w, blobs, w.blob_data) < 0) {
+        goto done;
+    }
+
+    /* The tables go before the data: move all offsets past them */
+    size_t tables = (sizeof(snapshot_header) +
+                     nmodules * sizeof(snapshot_module) +
+                     nstrings * sizeof(snapshot_range) +
+                     nblobs * sizeof(snapshot_range));
+    uint64_t start = align_up(tables, SNAPSHOT_ALIGN);
+    for (Py_ssize_t i = 0; i < nmodules; i++) {
+        modules[i].path.offset += start;
+        modules[i].segment.offset += start;
+        modules[i].relocs.offset += start;
+    }
+    for (Py_ssize_t i = 0; i < nstrings; i++) {
+        strings[i].offset += start;
+    }
+    for (Py_ssize_t i = 0; i < nblobs; i++) {
+        blobs[i].offset += start;
+    }
+
+    snapshot_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.pyc_magic = (uint32_t)magic;
+    header.object_size = sizeof(PyObject);
+    header.code_size = sizeof(PyCodeObject);
+    header.gc_head_size = sizeof(PyGC_Head);
+    header.pointer_size = sizeof(void *);
+    header.optimize = (int8_t)optimize;
+    header.nmodules = (uint32_t)nmodules;
+    header.nstrings = (uint32_t)nstrings;
+    header.nblobs = (uint32_t)nblobs;
+    header.size = start + w.data.size;
+
+    result = PyBytes_FromStringAndSize(NULL, (Py_ssize_t)header.size);
+    if (result == NULL) {
+        goto done;
+    }
+    char *p = PyBytes_AS_STRING(result);
+    memset(p, 0, start);
+    memcpy(p, &header, sizeof(header));
+    p += sizeof(header);
+    memcpy(p, modules, nmodules * sizeof(snapshot_module));
+    p += nmodules * sizeof(snapshot_module);
+    memcpy(p, strings, nstrings * sizeof(snapshot_range));
+    p += nstrings * sizeof(snapshot_range);
+    memcpy(p, blobs, nblobs * sizeof(snapshot_range));
+    if (w.data.size > 0) {
+        memcpy(PyBytes_AS_STRING(result) + start, w.data.data, w.data.size);
+    }
+
+done:
+    buffer_clear(&w.data);
+    buffer_clear(&w.segment);
+    buffer_clear(&w.relocs);
+    Py_XDECREF(w.memo);
+    Py_XDECREF(w.strings);
+    Py_XDECREF(w.blobs);
+    Py_XDECREF(w.blob_data);
+    Py_XDECREF(w.blob_objects);
+    Py_XDECREF(w.string_list);
+    Py_XDECREF(seq);
+    PyMem_Free(modules);
+    PyMem_Free(strings);
+    PyMem_Free(blobs);
+    return result;
+}
+
+
+/*********************** Reader **************************/
+
+static int
+range_valid(const _PySnapshot *snap, const snapshot_range *range)
+{
+    return (range->offset <= snap->size &&
+            range->size <= snap->size - range->offset);
+}
+
+static const char *
+snapshot_check(_PySnapshot *snap, long magic, int optimize)
+{
+    const snapshot_header *h = (const snapshot_header *)snap->base;
+    if (snap->size < sizeof(*h) ||
+        memcmp(h->magic, SNAPSHOT_MAGIC, sizeof(h->magic)) != 0) {
+        return "not a snapshot file";
+    }
+    if (h->pyc_magic != (uint32_t)magic ||
+        h->object_size != sizeof(PyObject) ||
+        h->code_size != sizeof(PyCodeObject) ||
+        h->gc_head_size != sizeof(PyGC_Head) ||
+        h->pointer_size != sizeof(void *)) {
+        return "snapshot written by another build";
+    }
+    if (h->optimize != optimize) {
+        return "snapshot written for another optimization level";
+    }
+    size_t tables = (sizeof(*h) +
+                     (size_t)h->nmodules * sizeof(snapshot_module) +
+                     (size_t)h->nstrings * sizeof(snapshot_range) +
+                     (size_t)h->nblobs * sizeof(snapshot_range));
+    if (h->size != snap->size || tables > snap->size) {
+        return "truncated snapshot";
+    }
+
+    snap->header = h;
+    snap->modules = (const snapshot_module *)(h + 1);
+    snap->strings = (const snapshot_range *)(snap->modules + h->nmodules);
+    snap->blobs = snap->strings + h->nstrings;
+    for (uint32_t i = 0; i < h->nmodules; i++) {
+        const snapshot_module *m = &snap->modules[i];
+        if (!range_valid(snap, &m->path) ||
+            !range_valid(snap, &m->segment) ||
+            !range_valid(snap, &m->relocs) ||
+            m->segment.offset % SNAPSHOT_ALIGN != 0 ||
+            m->relocs.offset % sizeof(uint32_t) != 0 ||
+            m->relocs.size % sizeof(snapshot_reloc) != 0 ||
+            m->root >= m->segment.size) {
+            return "corrupt snapshot";
+        }
+    }
+    for (uint32_t i = 0; i < h->nstrings; i++) {
+        if (!range_valid(snap, &snap->strings[i])) {
+            return "corrupt snapshot";
+        }
+    }
+    for (uint32_t i = 0; i < h->nblobs; i++) {
+        if (!range_valid(snap, &snap->blobs[i])) {
+            return "corrupt snapshot";
+        }
+    }
+    return NULL;
+}
+
+/* Read the whole file into memory, mapped copy on write if possible */
+static const char *
+snapshot_map(_PySnapshot *snap, int fd)
+{
+    struct _Py_stat_struct st;
+    if (_Py_fstat_noraise(fd, &st) != 0) {
+        return "can't stat the snapshot";
+    }
+    if (st.st_size <= 0 || (uint64_t)st.st_size > PY_SSIZE_T_MAX) {
+        return "not a snapshot file";
+    }
+    snap->size = (size_t)st.st_size;
+#ifdef HAVE_MMAP
+    void *base = mmap(NULL, snap->size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                      fd, 0);
+    if (base != MAP_FAILED) {
+        snap->base = base;
+        snap->mapped = 1;
+        return NULL;
+    }
+#endif
+    /* The snapshot is never freed: use the raw allocator, which has no
+       per-interpreter state */
+    snap->base = PyMem_RawMalloc(snap->size);
+    if (snap->base == NULL) {
+        return "out of memory";
+    }
+    size_t done = 0;
+    while (done < snap->size) {
+        size_t chunk = Py_MIN(snap->size - done, (size_t)INT_MAX);
+#ifdef MS_WINDOWS
+        int n = _read(fd, snap->base + done, (unsigned int)chunk);
+#else
+        ssize_t n = read(fd, snap->base + done, chunk);
+#endif
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return "can't read the snapshot";
+        }
+        done += (size_t)n;
+    }
+    return NULL;
+}
+
+_PySnapshot *
+_PySnapshot_Open(const char *path, long magic, int optimize,
+                 const char **reason)
+{
+#ifdef Py_TRACE_REFS
+    *reason = "snapshots are not supported with Py_TRACE_REFS";
+    return NULL;
+#endif
+    _PySnapshot *snap = PyMem_RawCalloc(1, sizeof(_PySnapshot));
+    if (snap == NULL) {
+        *reason = "out of memory";
+        return NULL;
+    }
+    int fd = _Py_open_noraise(path, O_RDONLY);
+    if (fd < 0) {
+        *reason = "can't open the snapshot";
+        PyMem_RawFree(snap);
+        return NULL;
+    }
+    *reason = snapshot_map(snap, fd);
+    close(fd);
+    if (*reason == NULL) {
+        *reason = snapshot_check(snap, magic, optimize);
+    }
+    if (*reason == NULL) {
+        uint32_t n = snap->header->nmodules;
+        snap->string_objects = PyMem_RawCalloc(
+            Py_MAX(snap->header->nstrings, 1), sizeof(PyObject *));
+        snap->blob_objects = PyMem_RawCalloc(
+            Py_MAX(snap->header->nblobs, 1), sizeof(PyObject *));
+        snap->relocated = PyMem_RawCalloc(Py_MAX(n, 1), sizeof(int));
+        if (snap->string_objects == NULL || snap->blob_objects == NULL ||
+            snap->relocated == NULL) {
+            *reason = "out of memory";
+        }
+    }
+    if (*reason != NULL) {
+        _PySnapshot_Close(snap);
+        return NULL;
+    }
+    return snap;
+}
+
+/* Only for a snapshot none of whose modules were relocated yet */
+void
+_PySnapshot_Close(_PySnapshot *snap)
+{
+    if (snap->base != NULL) {
+#ifdef HAVE_MMAP
+        if (snap->mapped) {
+            munmap(snap->base, snap->size);
+        }
+        else
+#endif
+        {
+            PyMem_RawFree(snap->base);
+        }
+    }
+    PyMem_RawFree(snap->string_objects);
+    PyMem_RawFree(snap->blob_objects);
+    PyMem_RawFree(snap->relocated);
+    PyMem_RawFree(snap);
+}
+
+static PyObject *
+corrupt_snapshot(void)
+{
+    PyErr_SetString(PyExc_ImportError, "corrupt snapshot");
+    return NULL;
+}
+
+static PyObject *
+snapshot_string(_PySnapshot *snap, uint32_t index)
+{
+    if (index >= snap->header->nstrings) {
+        return corrupt_snapshot();
+    }
+    PyObject *s = snap->string_objects[index];
+    if (s == NULL) {
+        const snapshot_range *r = &snap->strings[index];
+        s = PyUnicode_DecodeUTF8(snap->base + r->offset, r->size,
+                                 "surrogatepass");
+        if (s == NULL) {
+            return NULL;
+        }
+        PyUnicode_InternInPlace(&s);
+        snap->string_objects[index] = s;
+    }
+    return s;
+}
+
+static PyObject *
+snapshot_blob(_PySnapshot *snap, uint32_t index)
+{
+    if (index >= snap->header->nblobs) {
+        return corrupt_snapshot();
+    }
+    PyObject *op = snap->blob_objects[index];
+    if (op == NULL) {
+        const snapshot_range *r = &snap->blobs[index];
+        op = PyMarshal_ReadObjectFromString(snap->base + r->offset,
+                                            (Py_ssize_t)r->size);
+        /* Constants are immortal, like those of other code objects */
+        if (op != NULL && _PyCode_InternConstant(&op) < 0) {
+            Py_CLEAR(op);
+        }
+        snap->blob_objects[index] = op;
+    }
+    return op;
+}
+
+/* Patch all pointers of the segment of a module.  This only stores
+   absolute values, so it can be retried after an error. */
+static int
+snapshot_relocate(_PySnapshot *snap, const snapshot_module *m)
+{
+    char *segment = snap->base + m->segment.offset;
+    const snapshot_reloc *relocs =
+        (const snapshot_reloc *)(snap->base + m->relocs.offset);
+    size_t n = m->relocs.size / sizeof(snapshot_reloc);
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t slot = relocs[i].slot;
+        uint32_t index = RELOC_INDEX(relocs[i].target);
+        PyObject *value;
+
+        if (slot % sizeof(void *) != 0 ||
+            slot > m->segment.size - sizeof(void *)) {
+            corrupt_snapshot();
+            return -1;
+        }
+        switch (RELOC_KIND(relocs[i].target)) {
+        case RELOC_SEGMENT:
+            value = (index < m->segment.size ? (PyObject *)(segment + index)
+                                             : corrupt_snapshot());
+            break;
+        case RELOC_TYPE:
+            value = (PyObject *)snapshot_type(index);
+            if (value == NULL) {
+                corrupt_snapshot();
+            }
+            break;
+        case RELOC_CONST:
+            /* The references are kept by the immortal segment */
+            value = snapshot_const(index);
+            if (value == NULL && !PyErr_Occurred()) {
+                corrupt_snapshot();
+            }
+            break;
+        case RELOC_SMALLINT:
+            value = (index <= SMALLINT_MAX - SMALLINT_MIN
+                     ? PyLong_FromLong((long)index + SMALLINT_MIN)
+                     : corrupt_snapshot());
+            break;
+        case RELOC_STRING:
+            value = snapshot_string(snap, index);
+            break;
+        case RELOC_BLOB:
+            value = snapshot_blob(snap, index);
+            break;
+        default:
+            value = corrupt_snapshot();
+        }
+        if (value == NULL) {
+            return -1;
+        }
+        memcpy(segment + slot, &value, sizeof(value));
+    }
+    return 0;
+}
+
+static const snapshot_module *
+snapshot_find(_PySnapshot *snap, const char *path, size_t len)
+{
+    size_t lo = 0, hi = snap->header->nmodules;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        const snapshot_range *r = &snap->modules[mid].path;
+        size_t n = Py_MIN(r->size, len);
+        int cmp = memcmp(snap->base + r->offset, path, n);
+        if (cmp == 0) {
+            cmp = (r->size > len) - (r->size < len);
+        }
+        if (cmp == 0) {
+            return &snap->modules[mid];
+        }
+        if (cmp < 0) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return NULL;
+}
+
+PyObject *
+_PySnapshot_GetCode(_PySnapshot *snap, PyObject *path,
+                    long long mtime, long long size)
+{
+    Py_ssize_t len;
+    const char *s = PyUnicode_AsUTF8AndSize(path, &len);
+    if (s == NULL) {
+        /* Paths with lone surrogates are never in a snapshot */
+        if (!PyErr_ExceptionMatches(PyExc_UnicodeEncodeError)) {
+            return NULL;
+        }
+        PyErr_Clear();
+        Py_RETURN_NONE;
+    }
+    const snapshot_module *m = snapshot_find(snap, s, (size_t)len);
+    if (m == NULL || m->mtime != mtime || m->size != size) {
+        Py_RETURN_NONE;
+    }
+
+    size_t i = m - snap->modules;
+    if (!_Py_atomic_load_int(&snap->relocated[i])) {
+        /* Decoding strings can run arbitrary code through the GC, which
+           may import another module of the snapshot */
+        _PyRecursiveMutex_lock(&snap->mutex);
+        int err = 0;
+        if (!snap->relocated[i]) {
+            err = snapshot_relocate(snap, m);
+            if (err == 0) {
+                _Py_atomic_store_int(&snap->relocated[i], 1);
+            }
+        }
+        _PyRecursiveMutex_unlock(&snap->mutex);
+        if (err < 0) {
+            return NULL;
+        }
+    }
+    PyObject *code = (PyObject *)(snap->base + m->segment.offset + m->root);
+    Py_INCREF(code);
+    return code;
+}
@@ -55,6 +55,7 @@ _PyTypeId_Allocate(PyTypeIdPool *pool, PyTypeObject *type)
     _PyMutex_lock(&pool->mutex);
     if (pool->next == NULL) {
         if (resize_typeids(pool) < 0) {
+            _PyMutex_unlock(&pool->mutex);
             PyErr_NoMemory();
             return -1;
         }
@@ -0,0 +1,114 @@
+"""Event loop core benchmark for asyncio.
+
+Runs the same workloads on the C loop core (the _asyncio Handle and
+TimerHandle types and _asyncio._run_once()) and on the pure Python
+implementation:
+
+  chain   a callback that reschedules itself with call_soon()
+  tasks   100 tasks looping on "await asyncio.sleep(0)"
+  timers  a burst of already expired call_at() timers, in random order
+
+Example:
+
+    ./python Tools/asynciobench/asynciobench.py -n 100000
+"""
+
+import argparse
+import asyncio
+import contextlib
+import random
+import time
+from asyncio import base_events, events
+
+
+def bench_chain(n):
+    loop = asyncio.new_event_loop()
+    count = 0
+
+    def callback():
+        nonlocal count
+        count += 1
+        if count < n:
+            loop.call_soon(callback)
+        else:
+            loop.stop()
+
+    loop.call_soon(callback)
+    t0 = time.perf_counter()
+    loop.run_forever()
+    dt = time.perf_counter() - t0
+    loop.close()
+    return dt
+
+def bench_tasks(n, ntasks=100):
+    async def worker(k):
+        for _ in range(k):
+            await asyncio.sleep(0)
+
+    async def main():
+        await asyncio.gather(*[worker(n // ntasks) for _ in range(ntasks)])
+
+    t0 = time.perf_counter()
+    asyncio.run(main())
+    return time.perf_counter() - t0
+
+def bench_timers(n):
+    loop = asyncio.new_event_loop()
+    rand = random.Random(n)
+    now = loop.time()
+    t0 = time.perf_counter()
+    for _ in range(n):
+        loop.call_at(now - rand.random(), int)
+    loop.call_soon(loop.stop)
+    loop.run_forever()
+    loop.run_until_complete(asyncio.sleep(0))
+    dt = time.perf_counter() - t0
+    loop.close()
+    return dt
+
+
+@contextlib.contextmanager
+def python_loop_core():
+    saved = events.Handle, events.TimerHandle, base_events._c_run_once
+    events.Handle = events._PyHandle
+    events.TimerHandle = events._PyTimerHandle
+    base_events._c_run_once = None
+    try:
+        yield
+    finally:
+        events.Handle, events.TimerHandle, base_events._c_run_once = saved
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--number', type=int, default=200000,
+                        help='callbacks run per benchmark (default: 200000)')
+    parser.add_argument('-r', '--repeat', type=int, default=3,
+                        help='runs per benchmark, the best one is reported '
+                             '(default: 3)')
+    args = parser.parse_args()
+
+    cores = [('python', python_loop_core)]
+    if base_events._c_run_once is not None:
+        cores.append(('c', contextlib.nullcontext))
+    else:
+        print('_asyncio is not available, only the Python core is measured')
+
+    benchmarks = [
+        ('chain', bench_chain),
+        ('tasks', bench_tasks),
+        ('timers', bench_timers),
+    ]
+    print('%-8s' % '' + ''.join('%12s' % name for name, _ in cores))
+    for name, func in benchmarks:
+        line = '%-8s' % name
+        for _, core in cores:
+            with core():
+                func(args.number // 10)     # warm up
+                best = min(func(args.number) for _ in range(args.repeat))
+            line += '%9.0f ns' % (best / args.number * 1e9)
+        print(line)
+
+
+if __name__ == '__main__':
+    main()
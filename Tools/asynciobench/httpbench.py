@@ -0,0 +1,173 @@
+"""Local HTTP echo benchmark for asyncio.Runtime.
+
+Starts an HTTP/1.1 echo server on asyncio.Runtime with 1, 2, 4, ... worker
+threads, each accepting connections on the same port (SO_REUSEPORT), and
+measures the requests per second served to keep-alive clients running in
+separate processes.
+
+With --work, every request also computes a small sum in a task started
+with Runtime.spawn(); workers with nothing to do take those tasks from
+busier ones.
+
+Example:
+
+    ./python Tools/asynciobench/httpbench.py --max-workers 32 --clients 8
+"""
+
+import argparse
+import asyncio
+import multiprocessing
+import os
+import socket
+import threading
+import time
+
+
+HOST = '127.0.0.1'
+BODY = b'x' * 64
+REQUEST = (b'POST /echo HTTP/1.1\r\n'
+           b'Host: localhost\r\n'
+           b'Content-Length: %d\r\n'
+           b'\r\n' % len(BODY)) + BODY
+RESPONSE_HEAD = (b'HTTP/1.1 200 OK\r\n'
+                 b'Content-Length: %d\r\n'
+                 b'\r\n')
+
+
+def compute(n):
+    total = 0
+    for i in range(n):
+        total += i
+    return total
+
+async def spawned_compute(n):
+    return compute(n)
+
+async def handle(runtime, work, reader, writer):
+    try:
+        while True:
+            head = await reader.readuntil(b'\r\n\r\n')
+            length = 0
+            for line in head.split(b'\r\n'):
+                if line[:15].lower() == b'content-length:':
+                    length = int(line[15:])
+            body = await reader.readexactly(length)
+            if work:
+                await runtime.spawn(spawned_compute(work))
+            writer.write(RESPONSE_HEAD % len(body) + body)
+            await writer.drain()
+    except (asyncio.IncompleteReadError, ConnectionError):
+        pass
+    finally:
+        writer.close()
+
+async def serve_on_worker(runtime, port, work, started):
+    server = await asyncio.start_server(
+        lambda r, w: handle(runtime, work, r, w),
+        HOST, port, reuse_port=True, backlog=1024)
+    started.release()
+    async with server:
+        await server.serve_forever()
+
+async def serve_main(runtime, port, work, ready):
+    started = threading.Semaphore(0)
+    servers = [runtime.spawn(serve_on_worker(runtime, port, work, started),
+                             worker=i)
+               for i in range(runtime.workers)]
+    for _ in servers:
+        while not started.acquire(block=False):
+            await asyncio.sleep(0.01)
+    ready.set()
+    await asyncio.gather(*servers)
+
+def server_process(workers, port, work, ready):
+    runtime = asyncio.Runtime(workers)
+    try:
+        runtime.run(serve_main(runtime, port, work, ready))
+    except KeyboardInterrupt:
+        pass
+
+
+async def client_connection(port, deadline, counts):
+    reader, writer = await asyncio.open_connection(HOST, port)
+    expected = len(RESPONSE_HEAD % len(BODY)) + len(BODY)
+    n = 0
+    while time.monotonic() < deadline:
+        writer.write(REQUEST)
+        await reader.readexactly(expected)
+        n += 1
+    writer.close()
+    counts.append(n)
+
+async def client_main(port, connections, duration):
+    counts = []
+    deadline = time.monotonic() + duration
+    await asyncio.gather(*[client_connection(port, deadline, counts)
+                           for _ in range(connections)])
+    return sum(counts)
+
+def client_process(port, connections, duration, queue):
+    queue.put(asyncio.run(client_main(port, connections, duration)))
+
+
+def free_port():
+    with socket.socket() as sock:
+        sock.bind((HOST, 0))
+        return sock.getsockname()[1]
+
+def bench(workers, args):
+    port = free_port()
+    ready = multiprocessing.Event()
+    server = multiprocessing.Process(
+        target=server_process, args=(workers, port, args.work, ready))
+    server.start()
+    try:
+        if not ready.wait(30):
+            raise RuntimeError('the server did not start')
+        queue = multiprocessing.Queue()
+        clients = [multiprocessing.Process(
+                        target=client_process,
+                        args=(port, args.connections, args.duration, queue))
+                   for _ in range(args.clients)]
+        for client in clients:
+            client.start()
+        total = sum(queue.get() for _ in clients)
+        for client in clients:
+            client.join()
+    finally:
+        server.terminate()
+        server.join()
+    return total / args.duration
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--max-workers', type=int,
+                        default=min(32, os.cpu_count() or 1),
+                        help='largest number of server workers, the '
+                             'benchmark doubles them from 1 '
+                             '(default: the number of CPUs, at most 32)')
+    parser.add_argument('-c', '--clients', type=int, default=4,
+                        help='client processes (default: 4)')
+    parser.add_argument('--connections', type=int, default=32,
+                        help='connections per client process (default: 32)')
+    parser.add_argument('-d', '--duration', type=float, default=5.0,
+                        help='seconds per measurement (default: 5)')
+    parser.add_argument('--work', type=int, default=0,
+                        help='loop iterations of the task spawned for '
+                             'every request (default: 0, no task)')
+    args = parser.parse_args()
+
+    workers = 1
+    baseline = None
+    while workers <= args.max_workers:
+        rate = bench(workers, args)
+        if baseline is None:
+            baseline = rate
+        print('%3d workers %10.0f requests/s %6.2fx'
+              % (workers, rate, rate / baseline))
+        workers *= 2
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,89 @@
+"""Task spawn throughput benchmark for asyncio.
+
+Every thread runs its own event loop, which creates tasks in batches and
+waits for them:
+
+  empty    tasks whose coroutine returns at once
+  sleep0   tasks that suspend once with "await asyncio.sleep(0)"
+
+The result is the number of tasks created and finished per second, for
+all the threads together.  Creating a task registers it for
+asyncio.all_tasks(), so this measures the task registry as well as the
+task itself.
+
+Example:
+
+    ./python Tools/asynciobench/spawnbench.py -n 200000 --threads 1 4
+"""
+
+import argparse
+import asyncio
+import threading
+import time
+
+
+async def empty():
+    pass
+
+async def sleep0():
+    await asyncio.sleep(0)
+
+
+async def spawn(coro_func, n, batch):
+    loop = asyncio.get_running_loop()
+    for _ in range(n // batch):
+        tasks = [loop.create_task(coro_func()) for _ in range(batch)]
+        for task in tasks:
+            await task
+
+def bench(coro_func, n, batch, nthreads):
+    barrier = threading.Barrier(nthreads + 1)
+
+    def worker():
+        loop = asyncio.new_event_loop()
+        barrier.wait()
+        loop.run_until_complete(spawn(coro_func, n, batch))
+        loop.close()
+
+    threads = [threading.Thread(target=worker) for _ in range(nthreads)]
+    for thread in threads:
+        thread.start()
+    barrier.wait()
+    t0 = time.perf_counter()
+    for thread in threads:
+        thread.join()
+    return time.perf_counter() - t0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--number', type=int, default=200000,
+                        help='tasks created per thread (default: 200000)')
+    parser.add_argument('-b', '--batch', type=int, default=100,
+                        help='tasks created before waiting for them '
+                             '(default: 100)')
+    parser.add_argument('-r', '--repeat', type=int, default=3,
+                        help='runs per benchmark, the best one is reported '
+                             '(default: 3)')
+    parser.add_argument('--threads', type=int, nargs='+', default=[1],
+                        help='numbers of threads to measure (default: 1)')
+    args = parser.parse_args()
+
+    benchmarks = [
+        ('empty', empty),
+        ('sleep0', sleep0),
+    ]
+    print('%-8s' % '' + ''.join('%14s' % ('%d threads' % n)
+                                for n in args.threads))
+    for name, coro_func in benchmarks:
+        line = '%-8s' % name
+        for nthreads in args.threads:
+            bench(coro_func, args.number // 10, args.batch, nthreads)
+            best = min(bench(coro_func, args.number, args.batch, nthreads)
+                       for _ in range(args.repeat))
+            line += '%12.0f/s' % (args.number * nthreads / best)
+        print(line)
+
+
+if __name__ == '__main__':
+    main()
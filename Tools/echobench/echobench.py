@@ -0,0 +1,113 @@
+"""Local TCP echo server benchmark for select.epoll.
+
+Runs a single-threaded epoll echo server on the loopback interface and
+drives it with client threads that each send a message on their
+connection and wait for the echo.  The server either converts every
+wakeup to a list of tuples with epoll.poll() or reuses one array with
+epoll.poll_into(); the round trips per second are reported for both.
+
+Example:
+
+    ./python Tools/echobench/echobench.py -c 16 -d 5
+"""
+
+import argparse
+import array
+import select
+import socket
+import threading
+import time
+
+
+def serve(listener, mode, stop):
+    ep = select.epoll()
+    conns = {}
+    ep.register(listener.fileno(), select.EPOLLIN)
+    buf = array.array('I', [0] * 512)
+    try:
+        while not stop.is_set():
+            if mode == 'poll_into':
+                n = ep.poll_into(buf, 0.1)
+                events = zip(buf[0:2*n:2], buf[1:2*n:2])
+            else:
+                events = ep.poll(0.1)
+            for fd, mask in events:
+                if fd == listener.fileno():
+                    conn, _ = listener.accept()
+                    conn.setblocking(False)
+                    conns[conn.fileno()] = conn
+                    ep.register(conn.fileno(), select.EPOLLIN)
+                    continue
+                conn = conns[fd]
+                data = conn.recv(65536)
+                if data:
+                    conn.sendall(data)
+                else:
+                    ep.unregister(fd)
+                    del conns[fd]
+                    conn.close()
+    finally:
+        for conn in conns.values():
+            conn.close()
+        ep.close()
+
+
+def client(address, size, deadline, counts, index):
+    message = b'x' * size
+    n = 0
+    with socket.create_connection(address) as sock:
+        sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        while time.monotonic() < deadline:
+            sock.sendall(message)
+            received = 0
+            while received < size:
+                chunk = sock.recv(size - received)
+                if not chunk:
+                    raise ConnectionError('server closed the connection')
+                received += len(chunk)
+            n += 1
+    counts[index] = n
+
+
+def bench(mode, clients, size, duration):
+    listener = socket.create_server(('127.0.0.1', 0), backlog=clients)
+    listener.setblocking(False)
+    stop = threading.Event()
+    server = threading.Thread(target=serve, args=(listener, mode, stop))
+    server.start()
+    counts = [0] * clients
+    deadline = time.monotonic() + duration
+    threads = [threading.Thread(target=client,
+                                args=(listener.getsockname(), size,
+                                      deadline, counts, i))
+               for i in range(clients)]
+    t0 = time.monotonic()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    dt = time.monotonic() - t0
+    stop.set()
+    server.join()
+    listener.close()
+    return sum(counts) / dt
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-c', '--clients', type=int, default=8,
+                        help='number of client connections '
+                             '(default: %(default)s)')
+    parser.add_argument('-s', '--size', type=int, default=64,
+                        help='message size in bytes (default: %(default)s)')
+    parser.add_argument('-d', '--duration', type=float, default=3.0,
+                        help='seconds per run (default: %(default)s)')
+    args = parser.parse_args()
+
+    for mode in ('poll', 'poll_into'):
+        rate = bench(mode, args.clients, args.size, args.duration)
+        print('%-10s %10.0f round trips/s' % (mode, rate))
+
+
+if __name__ == '__main__':
+    main()
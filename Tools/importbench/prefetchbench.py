@@ -0,0 +1,134 @@
+"""Time to first request of an application that imports a lot of modules.
+
+The application is an HTTP server that imports some 70 standard library
+modules before it serves.  The benchmark starts it in a new process and
+measures the time until the first response arrives, with the modules
+imported one after the other by the main thread, and with
+importlib.util.prefetch() importing them first on a pool of threads: with
+the imports found in the code of the modules ("static"), and from an
+import trace recorded by "python -X importtime" ("trace").
+
+Example:
+
+    ./python Tools/importbench/prefetchbench.py --workers 1 4 16
+"""
+
+import argparse
+import os
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+
+
+APP_MODULES = [
+    'argparse', 'asyncio', 'bz2', 'calendar', 'cgi', 'concurrent.futures',
+    'configparser', 'contextvars', 'cProfile', 'csv', 'dataclasses',
+    'decimal', 'difflib', 'doctest', 'email.message', 'email.policy',
+    'fractions', 'ftplib', 'gettext', 'glob', 'gzip', 'hashlib', 'hmac',
+    'html.parser', 'http.client', 'http.cookiejar', 'http.cookies',
+    'http.server', 'imaplib', 'inspect', 'ipaddress', 'json', 'locale',
+    'logging.handlers', 'lzma', 'mailbox', 'multiprocessing', 'optparse',
+    'pdb', 'pickle', 'plistlib', 'pprint', 'pstats', 'pydoc', 'queue',
+    'sched', 'secrets', 'selectors', 'shelve', 'shutil', 'smtplib',
+    'socketserver', 'sqlite3', 'ssl', 'statistics', 'tarfile', 'tempfile',
+    'timeit', 'trace', 'typing', 'unittest', 'urllib.request', 'uuid',
+    'wsgiref.simple_server', 'xml.dom.minidom', 'xml.etree.ElementTree',
+    'xmlrpc.client', 'zipfile',
+]
+
+APP = '''
+import importlib, importlib.util, sys
+mode, port, workers, trace = sys.argv[1], int(sys.argv[2]), int(sys.argv[3]), sys.argv[4]
+modules = %r
+if mode == 'static':
+    importlib.util.prefetch(modules, max_workers=workers)
+elif mode == 'trace':
+    importlib.util.prefetch(trace=trace, max_workers=workers)
+for name in modules:
+    importlib.import_module(name)
+
+import http.server
+
+class Handler(http.server.BaseHTTPRequestHandler):
+    def do_GET(self):
+        self.send_response(200)
+        self.send_header('Content-Length', '2')
+        self.end_headers()
+        self.wfile.write(b'ok')
+    def log_message(self, *args):
+        pass
+
+server = http.server.HTTPServer(('127.0.0.1', port), Handler)
+server.handle_request()
+''' % APP_MODULES
+
+
+def free_port():
+    with socket.socket() as sock:
+        sock.bind(('127.0.0.1', 0))
+        return sock.getsockname()[1]
+
+def first_request(mode, workers, trace):
+    """Return the seconds from starting the application to its first
+    response."""
+    port = free_port()
+    t0 = time.perf_counter()
+    proc = subprocess.Popen([sys.executable, '-c', APP, mode, str(port),
+                             str(workers), trace])
+    try:
+        while True:
+            try:
+                sock = socket.create_connection(('127.0.0.1', port))
+                break
+            except ConnectionRefusedError:
+                if proc.poll() is not None:
+                    raise RuntimeError('the application exited')
+                time.sleep(0.001)
+        with sock:
+            sock.sendall(b'GET / HTTP/1.0\r\n\r\n')
+            while sock.recv(4096):
+                pass
+        elapsed = time.perf_counter() - t0
+    finally:
+        proc.wait()
+    return elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-r', '--repeat', type=int, default=10,
+                        help='runs per measurement, the best one is '
+                             'reported (default: 10)')
+    parser.add_argument('--workers', type=int, nargs='+',
+                        default=[os.cpu_count() or 1],
+                        help='numbers of prefetch threads to measure '
+                             '(default: the number of CPUs)')
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        trace = os.path.join(tmpdir, 'app.imports')
+        code = ';'.join(['import importlib'] +
+                        ['importlib.import_module(%r)' % name
+                         for name in APP_MODULES])
+        with open(trace, 'wb') as f:
+            subprocess.run([sys.executable, '-X', 'importtime', '-c', code],
+                           stderr=f, check=True)
+
+        def best(mode, workers):
+            first_request(mode, workers, trace)
+            return min(first_request(mode, workers, trace)
+                       for _ in range(args.repeat))
+
+        serial = best('serial', 1)
+        print('%-8s %10s %8.1f ms' % ('serial', '', serial * 1e3))
+        for mode in ('static', 'trace'):
+            for workers in args.workers:
+                t = best(mode, workers)
+                print('%-8s %2d threads %8.1f ms %6.2fx'
+                      % (mode, workers, t * 1e3, serial / t))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,73 @@
+"""Benchmark multiplication, division and decimal conversions of big ints.
+
+Each operation is timed on ints of a growing number of decimal digits.
+With Karatsuba multiplication, recursive division and recursive base
+conversion, the time of all the operations should grow like the time of
+the multiplication, about 3x when the size doubles, instead of 4x.
+
+Example:
+
+    ./python Tools/intbench/intbench.py --max-digits 1000000
+"""
+
+import argparse
+import random
+import sys
+import timeit
+
+
+# (name, statement) of the operations on ints x and y of n digits and on
+# the int xy of 2n digits, and on s = str(x).
+OPERATIONS = [
+    ('x * y', 'x * y'),
+    ('divmod(xy, y)', 'divmod(xy, y)'),
+    ('str(x)', 'str(x)'),
+    ('int(s)', 'int(s)'),
+]
+
+
+def bench(stmt, namespace, min_time):
+    timer = timeit.Timer(stmt, globals=namespace)
+    number, _ = timer.autorange()
+    number = max(1, int(number * min_time / 0.2))
+    return min(timer.repeat(3, number)) / number
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--min-digits', type=int, default=1000,
+                        help='smallest number of decimal digits '
+                             '(default: %(default)s)')
+    parser.add_argument('--max-digits', type=int, default=100000,
+                        help='largest number of decimal digits '
+                             '(default: %(default)s)')
+    parser.add_argument('--min-time', type=float, default=0.2,
+                        help='minimum time of a measure in seconds '
+                             '(default: %(default)s)')
+    args = parser.parse_args()
+
+    print(sys.version)
+    print('%-8s' % 'digits'
+          + ''.join(' %14s %5s' % (name, 'x') for name, _ in OPERATIONS))
+    rng = random.Random(0)
+    previous = None
+    ndigits = args.min_digits
+    while ndigits <= args.max_digits:
+        bits = int(ndigits * 3.3219280948873626)
+        x = rng.getrandbits(bits) | (1 << (bits - 1))
+        y = rng.getrandbits(bits) | (1 << (bits - 1))
+        namespace = {'x': x, 'y': y, 'xy': x * y + x, 's': str(x)}
+        times = [bench(stmt, namespace, args.min_time)
+                 for _, stmt in OPERATIONS]
+        line = '%-8d' % ndigits
+        for i, t in enumerate(times):
+            # growth of the time since the previous size
+            growth = '%5.1f' % (t / previous[i]) if previous else ' ' * 5
+            line += ' %11.3f ms %s' % (t * 1e3, growth)
+        print(line)
+        previous = times
+        ndigits *= 2
+
+
+if __name__ == '__main__':
+    main()
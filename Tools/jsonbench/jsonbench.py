@@ -0,0 +1,128 @@
+"""Throughput benchmark for json.dumps() and json.loads().
+
+Builds a few documents shaped like the usual real-world JSON corpora --
+an API response of social media posts, an event catalog keyed by id and
+a GeoJSON feature collection of coordinates -- and reports encoding and
+decoding throughput for each.  A JSON file given on the command line is
+benchmarked as well.
+
+Example:
+
+    ./python Tools/jsonbench/jsonbench.py -s 4 data/*.json
+"""
+
+import argparse
+import json
+import random
+import time
+
+
+WORDS = ('the quick brown fox jumps over lazy dog lorem ipsum dolor sit '
+         'amet caf\xe9 na\xefve r\xe9sum\xe9 日本 αβγ '
+         'http://example.com/a?b=c&d="e" line\nbreak tab\there').split(' ')
+
+
+def make_text(rnd, n):
+    return ' '.join(rnd.choice(WORDS) for _ in range(n))
+
+def make_posts(rnd, scale):
+    users = [{'id': i, 'screen_name': 'user%d' % i,
+              'name': make_text(rnd, 2),
+              'description': make_text(rnd, 12),
+              'followers_count': rnd.randrange(100000),
+              'verified': rnd.random() < 0.1,
+              'profile_image_url': 'https://img.example.com/%d.png' % i}
+             for i in range(50)]
+    posts = [{'id': 10**17 + i, 'id_str': str(10**17 + i),
+              'created_at': 'Mon Oct 18 12:%02d:%02d +0000 2026'
+                            % (i // 60 % 60, i % 60),
+              'text': make_text(rnd, rnd.randrange(5, 30)),
+              'user': rnd.choice(users),
+              'retweet_count': rnd.randrange(1000),
+              'favorited': False,
+              'entities': {'hashtags': [make_text(rnd, 1)
+                                        for _ in range(rnd.randrange(3))],
+                           'urls': []},
+              'lang': 'en', 'geo': None}
+             for i in range(500 * scale)]
+    return {'statuses': posts,
+            'search_metadata': {'count': len(posts), 'query': 'json'}}
+
+def make_catalog(rnd, scale):
+    events = {}
+    for i in range(1000 * scale):
+        events[str(138586341 + i)] = {
+            'id': 138586341 + i, 'name': make_text(rnd, 4),
+            'description': None, 'logo': '/images/%d.jpg' % i,
+            'subjectCode': None, 'subtitle': None,
+            'topicIds': [rnd.randrange(100000) for _ in range(4)],
+            'prices': [{'amount': rnd.randrange(10, 200) * 500,
+                        'audienceSubCategoryId': 337100890,
+                        'seatCategoryId': rnd.randrange(340000000)}
+                       for _ in range(3)]}
+    return {'events': events, 'venueNames': {'PLEYEL_PLEYEL': 'Salle Pleyel'}}
+
+def make_geojson(rnd, scale):
+    features = []
+    for i in range(20 * scale):
+        ring = [[rnd.uniform(-180, 180), rnd.uniform(-90, 90)]
+                for _ in range(500)]
+        features.append({'type': 'Feature',
+                         'properties': {'name': 'region %d' % i},
+                         'geometry': {'type': 'Polygon',
+                                      'coordinates': [ring]}})
+    return {'type': 'FeatureCollection', 'features': features}
+
+DATASETS = [
+    ('posts', make_posts),
+    ('catalog', make_catalog),
+    ('geojson', make_geojson),
+]
+
+
+def best_of(repeat, func, arg):
+    best = None
+    for _ in range(repeat):
+        t0 = time.perf_counter()
+        result = func(arg)
+        dt = time.perf_counter() - t0
+        if best is None or dt < best:
+            best = dt
+    return best, result
+
+
+def bench(name, obj, repeat):
+    for ensure_ascii in (True, False):
+        dumps = lambda o: json.dumps(o, ensure_ascii=ensure_ascii)
+        dt_dump, text = best_of(repeat, dumps, obj)
+        dt_load, result = best_of(repeat, json.loads, text)
+        if result != obj:
+            raise AssertionError('round trip failed for %s' % name)
+        size = len(text.encode('utf-8'))
+        print('%-10s %-14s %7.2f MB  dumps %8.1f MB/s  loads %8.1f MB/s'
+              % (name, 'ascii' if ensure_ascii else 'unicode', size / 1e6,
+                 size / dt_dump / 1e6, size / dt_load / 1e6))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('files', nargs='*',
+                        help='additional JSON documents to benchmark')
+    parser.add_argument('-s', '--scale', type=int, default=2,
+                        help='size multiplier for the generated documents '
+                             '(default: %(default)s)')
+    parser.add_argument('-r', '--repeat', type=int, default=5,
+                        help='number of runs, the best is reported '
+                             '(default: %(default)s)')
+    args = parser.parse_args()
+
+    rnd = random.Random(1)
+    for name, make in DATASETS:
+        bench(name, make(rnd, args.scale), args.repeat)
+    for filename in args.files:
+        with open(filename, encoding='utf-8') as f:
+            bench(filename, json.load(f), args.repeat)
+
+
+if __name__ == '__main__':
+    main()
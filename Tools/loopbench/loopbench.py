@@ -0,0 +1,109 @@
+"""Benchmark for tight Python loops and their time to safepoint.
+
+Runs small loops whose cost is dominated by the loop overhead itself (the
+backward jump and its eval breaker check), then measures how long a
+stop-the-world request waits for threads spinning in such loops (see
+gc.get_safepoint_stats()).
+
+Example:
+
+    ./python Tools/loopbench/loopbench.py -n 2000000
+"""
+
+import argparse
+import gc
+import threading
+import time
+
+
+def while_loop(n):
+    i = 0
+    while i < n:
+        i += 1
+
+def for_range(n):
+    for i in range(n):
+        pass
+
+def for_sum(n):
+    total = 0
+    for i in range(n):
+        total += i
+    return total
+
+def nested(n):
+    total = 0
+    for i in range(n // 100):
+        for j in range(100):
+            total += j
+    return total
+
+def while_break(n):
+    i = 0
+    while True:
+        i += 1
+        if i & 1:
+            continue
+        if i >= n:
+            break
+
+def listcomp(n):
+    return [i for i in range(n)]
+
+
+def time_to_safepoint(nthreads, nstops):
+    done = []
+    def spin():
+        while not done:
+            pass
+    threads = [threading.Thread(target=spin) for _ in range(nthreads)]
+    for t in threads:
+        t.start()
+    try:
+        time.sleep(0.1)
+        before = gc.get_safepoint_stats()
+        worst = 0.0
+        for _ in range(nstops):
+            gc.collect(0)
+            worst = max(worst, gc.get_safepoint_stats()['last_time'])
+        after = gc.get_safepoint_stats()
+    finally:
+        done.append(True)
+        for t in threads:
+            t.join()
+    stops = after['stops'] - before['stops']
+    mean = (after['total_time'] - before['total_time']) / max(stops, 1)
+    return mean, worst
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--number', type=int, default=1000000,
+                        help='loop iterations per run (default: 1000000)')
+    parser.add_argument('-r', '--repeat', type=int, default=5,
+                        help='runs per benchmark, the best one is reported '
+                             '(default: 5)')
+    parser.add_argument('-t', '--threads', type=int, default=4,
+                        help='spinning threads for the time to safepoint '
+                             '(default: 4)')
+    args = parser.parse_args()
+
+    n = args.number
+    for func in (while_loop, for_range, for_sum, nested, while_break,
+                 listcomp):
+        best = float('inf')
+        for _ in range(args.repeat):
+            t0 = time.perf_counter()
+            func(n)
+            best = min(best, time.perf_counter() - t0)
+        print('%-12s %8.2f ns per iteration' % (func.__name__, best / n * 1e9))
+
+    if hasattr(gc, 'get_safepoint_stats'):
+        mean, worst = time_to_safepoint(args.threads, 200)
+        print('time to safepoint with %d spinning threads: '
+              'mean %.1f us, max %.1f us' % (args.threads, mean * 1e6,
+                                             worst * 1e6))
+
+
+if __name__ == '__main__':
+    main()
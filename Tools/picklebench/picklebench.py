@@ -0,0 +1,82 @@
+"""Throughput benchmark for pickling large containers.
+
+Pickles a few large lists and dicts of independent records with
+pickle.dumps() and reports the throughput for each number of threads
+given with -t.  With threads > 1 the C pickler splits large exact lists
+and dicts between several threads (see the *threads* argument of
+pickle.Pickler).
+
+Example:
+
+    ./python Tools/picklebench/picklebench.py -n 500000 -t 1,2,4,8
+"""
+
+import argparse
+import pickle
+import time
+
+
+def make_records(n):
+    return [{'id': i, 'name': 'user%d' % i, 'score': i * 0.25,
+             'active': bool(i & 1), 'tags': ['red', 'green'][:i % 3]}
+            for i in range(n)]
+
+def make_table(n):
+    return {'key%d' % i: (i, float(i), 'value%d' % i) for i in range(n)}
+
+def make_rows(n):
+    return [(i, -i, i * 1.5, b'%08d' % i) for i in range(n)]
+
+DATASETS = [
+    ('list of dicts', make_records),
+    ('dict of tuples', make_table),
+    ('list of tuples', make_rows),
+]
+
+
+def bench(obj, protocol, threads, repeat):
+    best = None
+    for _ in range(repeat):
+        t0 = time.perf_counter()
+        data = pickle.dumps(obj, protocol, threads=threads)
+        dt = time.perf_counter() - t0
+        if best is None or dt < best:
+            best = dt
+    return best, data
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--items', type=int, default=200000,
+                        help='number of items per container '
+                             '(default: %(default)s)')
+    parser.add_argument('-t', '--threads', default='1,2,4',
+                        help='comma-separated thread counts '
+                             '(default: %(default)s)')
+    parser.add_argument('-p', '--protocol', type=int,
+                        default=pickle.HIGHEST_PROTOCOL,
+                        help='pickle protocol (default: %(default)s)')
+    parser.add_argument('-r', '--repeat', type=int, default=5,
+                        help='number of runs, the best is reported '
+                             '(default: %(default)s)')
+    args = parser.parse_args()
+    thread_counts = [int(t) for t in args.threads.split(',')]
+
+    for name, make in DATASETS:
+        obj = make(args.items)
+        print('%s, %d items:' % (name, args.items))
+        base = None
+        for threads in thread_counts:
+            dt, data = bench(obj, args.protocol, threads, args.repeat)
+            if pickle.loads(data) != obj:
+                raise AssertionError('round trip failed with threads=%d'
+                                     % threads)
+            if base is None:
+                base = dt
+            print('  threads=%-3d %8.1f ms  %8.1f MB/s  x%.2f'
+                  % (threads, dt * 1e3, len(data) / dt / 1e6, base / dt))
+        print()
+
+
+if __name__ == '__main__':
+    main()
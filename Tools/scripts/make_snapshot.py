@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""Write a bytecode snapshot of Python modules.
+
+A snapshot holds the code objects of source modules in their in-memory
+form.  An interpreter started with "-X snapshot=FILE" (or with the
+PYTHONSNAPSHOT environment variable) maps it and takes the code of these
+modules from it instead of reading and unmarshalling their .pyc files.
+A module whose source file changed since is loaded the usual way.
+
+The snapshot is only valid for the interpreter that wrote it and for its
+optimization level: write it with the same -O options that the
+interpreter using it will get.
+
+Example:
+
+    ./python Tools/scripts/make_snapshot.py -o python.snapshot --startup \\
+        asyncio json
+"""
+
+import argparse
+import importlib.machinery
+import importlib.util
+import os
+import pkgutil
+import subprocess
+import sys
+import _imp
+
+
+STARTUP_MODULES = 'import sys; print("\\n".join(sys.modules))'
+
+
+def startup_modules():
+    """Return the modules imported by a bare interpreter."""
+    output = subprocess.check_output([sys.executable, '-c', STARTUP_MODULES],
+                                     text=True)
+    return [name for name in output.split() if name != '__main__']
+
+
+def find_sources(names, recursive):
+    """Yield the (name, spec) pairs of the source modules among names."""
+    seen = set()
+    origins = set()
+    names = list(names)
+    while names:
+        name = names.pop()
+        if name in seen:
+            continue
+        seen.add(name)
+        try:
+            spec = importlib.util.find_spec(name)
+        except (ImportError, ValueError):
+            spec = None
+        if spec is None:
+            print('%s: not found' % name, file=sys.stderr)
+            continue
+        # Aliases like os.path find the spec of another module
+        if (isinstance(spec.loader, importlib.machinery.SourceFileLoader)
+                and spec.origin not in origins):
+            origins.add(spec.origin)
+            yield spec.name, spec
+        if recursive and spec.submodule_search_locations is not None:
+            for info in pkgutil.iter_modules(spec.submodule_search_locations,
+                                             name + '.'):
+                names.append(info.name)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-o', '--output', required=True,
+                        help='snapshot file to write')
+    parser.add_argument('--startup', action='store_true',
+                        help='add the modules imported at startup')
+    parser.add_argument('-r', '--recursive', action='store_true',
+                        help='add the submodules of packages')
+    parser.add_argument('modules', nargs='*',
+                        help='names of modules to add')
+    args = parser.parse_args()
+
+    names = list(args.modules)
+    if args.startup:
+        names += startup_modules()
+    entries = []
+    for name, spec in find_sources(names, args.recursive):
+        try:
+            code = spec.loader.get_code(name)
+            st = os.stat(spec.origin)
+        except (SyntaxError, OSError) as exc:
+            print('%s: %s' % (name, exc), file=sys.stderr)
+            continue
+        entries.append((spec.origin, int(st.st_mtime), st.st_size, code))
+
+    data = _imp._snapshot_dumps(entries)
+    tmp = args.output + '.tmp'
+    with open(tmp, 'wb') as f:
+        f.write(data)
+    os.replace(tmp, args.output)
+    print('%s: %d modules, %d bytes' % (args.output, len(entries), len(data)))
+
+
+if __name__ == '__main__':
+    main()
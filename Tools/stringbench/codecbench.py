@@ -0,0 +1,102 @@
+"""Benchmark UTF-8 decoding and encoding of texts in several scripts.
+
+Each text is decoded from (and encoded to) UTF-8 at several sizes.  With
+--compare, decoding is also timed with the vectorized decoders disabled
+(this needs the _testinternalcapi module of a CPython build).
+
+Example:
+
+    ./python Tools/stringbench/codecbench.py --compare
+"""
+
+import argparse
+import itertools
+import sys
+import timeit
+
+
+# Samples of text that are repeated up to the size of the benchmarks
+TEXTS = {
+    'ascii': 'The quick brown fox jumps over the lazy dog. ',
+    'latin1': 'Le cœur déçu mais l\'âme plutôt naïve, Louÿs rêva de crapaüter '
+              'en canoë au delà des îles. ',
+    'german': 'Falsches Üben von Xylophonmusik quält jeden größeren Zwerg. ',
+    'cyrillic': 'Съешь же ещё этих мягких французских булок, да выпей чаю. ',
+    'greek': 'Ξεσκεπάζω την ψυχοφθόρα βδελυγμία. ',
+    'cjk': '天地玄黄，宇宙洪荒。日月盈昃，辰宿列张。',
+    'japanese': 'いろはにほへと ちりぬるを わかよたれそ つねならむ、'
+                'Unicode 文字列。',
+    'emoji': 'Hello 👋 world 🌍! ',
+}
+
+SIZES = (16, 64, 1024, 65536)
+
+
+def make_text(sample, size):
+    """Return sample repeated to size bytes of UTF-8, or a little more."""
+    chars = []
+    nbytes = 0
+    for ch in itertools.cycle(sample):
+        if nbytes >= size:
+            break
+        chars.append(ch)
+        nbytes += len(ch.encode('utf-8'))
+    return ''.join(chars)
+
+
+def bench(stmt, namespace, min_time):
+    timer = timeit.Timer(stmt, globals=namespace)
+    number, _ = timer.autorange()
+    number = max(1, int(number * min_time / 0.2))
+    return min(timer.repeat(3, number)) / number
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--compare', action='store_true',
+                        help='also decode without the vectorized decoders')
+    parser.add_argument('--min-time', type=float, default=0.2,
+                        help='minimum time of a measure in seconds '
+                             '(default: %(default)s)')
+    parser.add_argument('texts', nargs='*', metavar='TEXT',
+                        help='texts to use among %s (default: all)'
+                             % ', '.join(TEXTS))
+    args = parser.parse_args()
+    for name in args.texts:
+        if name not in TEXTS:
+            parser.error('unknown text: %r' % name)
+
+    set_cpu_features = None
+    if args.compare:
+        import _testinternalcapi
+        set_cpu_features = _testinternalcapi.set_cpu_features
+
+    print(sys.version)
+    header = '%-10s %7s %12s %12s' % ('text', 'bytes', 'decode MB/s',
+                                       'encode MB/s')
+    if set_cpu_features:
+        header += ' %12s %7s' % ('scalar MB/s', 'speedup')
+    print(header)
+    for name in args.texts or TEXTS:
+        for size in SIZES:
+            text = make_text(TEXTS[name], size)
+            data = text.encode('utf-8')
+            namespace = {'data': data, 'text': text}
+            decode = bench('data.decode("utf-8")', namespace, args.min_time)
+            encode = bench('text.encode("utf-8")', namespace, args.min_time)
+            mb = len(data) / 1e6
+            line = '%-10s %7d %12.1f %12.1f' % (name, len(data), mb / decode,
+                                                mb / encode)
+            if set_cpu_features:
+                old = set_cpu_features(0)
+                try:
+                    scalar = bench('data.decode("utf-8")', namespace,
+                                   args.min_time)
+                finally:
+                    set_cpu_features(old)
+                line += ' %12.1f %6.2fx' % (mb / scalar, scalar / decode)
+            print(line)
+
+
+if __name__ == '__main__':
+    main()
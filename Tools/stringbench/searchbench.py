@@ -0,0 +1,125 @@
+"""Benchmark searching, counting, splitting and replacing in long texts.
+
+The texts are log files of several kinds of strings: ASCII, Latin-1 and
+UCS-2 str, and bytes.  With --compare, each operation is also timed with
+the vectorized search kernels disabled (this needs the _testinternalcapi
+module of a CPython build).
+
+Example:
+
+    ./python Tools/stringbench/searchbench.py --compare
+"""
+
+import argparse
+import random
+import sys
+import timeit
+
+
+# Words of the log messages of each kind of text
+WORDS = {
+    'ascii': ['request', 'user', 'session', 'cache', 'miss', 'timeout'],
+    'latin1': ['requête', 'utilisateur', 'reçu', 'café', 'délai'],
+    'ucs2': ['запрос', 'пользователь', 'сеанс', '請求', '超時'],
+}
+WORDS['bytes'] = WORDS['ascii']
+
+# (description, statement) of the operations on text, the log.  The
+# arguments are variables of the kind of the text, set in main().
+OPERATIONS = [
+    ('count("\\n")', 'text.count(nl)'),
+    ('count("ERROR")', 'text.count(error)'),
+    ('"FATAL" in text', 'fatal in text'),
+    ('find("|")', 'text.find(bar)'),
+    ('rfind("|")', 'text.rfind(bar)'),
+    ('find("not there")', 'text.find(absent)'),
+    ('split("\\n")', 'text.split(nl)'),
+    ('split(" ")', 'text.split(space)'),
+    ('rsplit(" ", 10)', 'text.rsplit(space, 10)'),
+    ('split(" id=")', 'text.split(id_)'),
+    ('replace("ERROR", "E")', 'text.replace(error, e)'),
+]
+
+
+def make_log(kind, size):
+    """Return a log of about size characters of the given kind."""
+    rng = random.Random(size)
+    words = WORDS[kind]
+    lines = []
+    length = 0
+    while length < size:
+        level = 'ERROR' if rng.random() < 0.05 else 'INFO'
+        message = ' '.join(rng.choice(words)
+                           for _ in range(rng.randint(2, 8)))
+        line = ('2024-05-%02d 12:%02d:%02d %s worker-%d id=%d %s'
+                % (rng.randint(1, 31), rng.randrange(60), rng.randrange(60),
+                   level, rng.randrange(8), rng.randrange(10**6), message))
+        lines.append(line)
+        length += len(line) + 1
+    text = '\n'.join(lines) + '\n'
+    if kind == 'bytes':
+        return text.encode('ascii')
+    return text
+
+
+def bench(stmt, namespace, min_time):
+    timer = timeit.Timer(stmt, globals=namespace)
+    number, _ = timer.autorange()
+    number = max(1, int(number * min_time / 0.2))
+    return min(timer.repeat(3, number)) / number
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--compare', action='store_true',
+                        help='also time without the vectorized kernels')
+    parser.add_argument('--size', type=int, default=65536,
+                        help='size of the texts in characters '
+                             '(default: %(default)s)')
+    parser.add_argument('--min-time', type=float, default=0.2,
+                        help='minimum time of a measure in seconds '
+                             '(default: %(default)s)')
+    parser.add_argument('kinds', nargs='*', metavar='KIND',
+                        help='kinds of text among %s (default: all)'
+                             % ', '.join(WORDS))
+    args = parser.parse_args()
+    for kind in args.kinds:
+        if kind not in WORDS:
+            parser.error('unknown kind of text: %r' % kind)
+
+    set_cpu_features = None
+    if args.compare:
+        import _testinternalcapi
+        set_cpu_features = _testinternalcapi.set_cpu_features
+
+    print(sys.version)
+    header = '%-7s %-24s %10s' % ('kind', 'operation', 'time (us)')
+    if set_cpu_features:
+        header += ' %12s %7s' % ('scalar (us)', 'speedup')
+    print(header)
+    for kind in args.kinds or WORDS:
+        text = make_log(kind, args.size)
+        if kind == 'bytes':
+            S = lambda s: s.encode('ascii')
+        else:
+            S = str
+        namespace = {
+            'text': text, 'nl': S('\n'), 'space': S(' '), 'bar': S('|'),
+            'error': S('ERROR'), 'e': S('E'), 'fatal': S('FATAL'),
+            'absent': S('not there'), 'id_': S(' id='),
+        }
+        for description, stmt in OPERATIONS:
+            t = bench(stmt, namespace, args.min_time)
+            line = '%-7s %-24s %10.1f' % (kind, description, t * 1e6)
+            if set_cpu_features:
+                old = set_cpu_features(0)
+                try:
+                    scalar = bench(stmt, namespace, args.min_time)
+                finally:
+                    set_cpu_features(old)
+                line += ' %12.1f %6.2fx' % (scalar * 1e6, scalar / t)
+            print(line)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,78 @@
+"""Latency benchmark for starting and joining threads.
+
+Measures a full spawn+join round trip, one thread at a time, with the
+low-level _thread.start_new_thread() and with threading.Thread, and the
+aggregate rate when several threads are started concurrently.  This is
+dominated by per-thread setup and teardown: the OS thread, the thread
+state and the allocator heaps.
+
+Example:
+
+    ./python Tools/threadbench/threadbench.py -n 5000
+"""
+
+import _thread
+import argparse
+import threading
+import time
+
+
+def noop():
+    pass
+
+def bench_start_new_thread(n):
+    lock = _thread.allocate_lock()
+    t0 = time.perf_counter()
+    for _ in range(n):
+        lock.acquire()
+        _thread.start_new_thread(lock.release, ())
+        # wait for the thread to run; its exit overlaps the next spawn
+        lock.acquire()
+        lock.release()
+    return time.perf_counter() - t0
+
+def bench_thread(n):
+    t0 = time.perf_counter()
+    for _ in range(n):
+        t = threading.Thread(target=noop)
+        t.start()
+        t.join()
+    return time.perf_counter() - t0
+
+def bench_concurrent(n, nthreads):
+    t0 = time.perf_counter()
+    for _ in range(n // nthreads):
+        threads = [threading.Thread(target=noop) for _ in range(nthreads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+    return time.perf_counter() - t0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--number', type=int, default=2000,
+                        help='threads started per run (default: 2000)')
+    parser.add_argument('-r', '--repeat', type=int, default=5,
+                        help='runs per benchmark, the best one is reported '
+                             '(default: 5)')
+    parser.add_argument('-t', '--threads', type=int, default=8,
+                        help='threads started at once by the concurrent '
+                             'benchmark (default: 8)')
+    args = parser.parse_args()
+
+    benchmarks = [
+        ('_thread.start_new_thread', bench_start_new_thread),
+        ('threading.Thread', bench_thread),
+        ('threading.Thread x %d' % args.threads,
+         lambda n: bench_concurrent(n, args.threads)),
+    ]
+    for name, func in benchmarks:
+        func(args.number // 10)     # warm up
+        best = min(func(args.number) for _ in range(args.repeat))
+        print('%-28s %8.1f us per thread' % (name, best / args.number * 1e6))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,422 @@
+"""Interpreter dispatch benchmark.
+
+Small pure-Python kernels modelled on pyperformance benchmarks (nbody,
+spectral_norm, fannkuch, richards, float, nqueens, ...), on keyword
+argument calls and on building collections with list.append(), dict.get()
+and len(), whose run time is dominated by bytecode dispatch rather than by
+C library code.  Reports the best time of each kernel.
+
+With a Python built with -DDYNAMIC_EXECUTION_PROFILE -DDXPAIRS, --pairs
+prints the most frequently executed opcodes and opcode pairs instead,
+which is how candidates for superinstructions are picked.
+
+Example:
+
+    ./python Tools/vmbench/vmbench.py -r 5
+    ./python Tools/vmbench/vmbench.py --pairs 30
+"""
+
+import argparse
+import math
+import sys
+import time
+
+
+# nbody
+
+SOLAR_MASS = 4 * math.pi * math.pi
+DAYS_PER_YEAR = 365.24
+
+def make_bodies():
+    return [
+        ([0.0, 0.0, 0.0], [0.0, 0.0, 0.0], SOLAR_MASS),
+        ([4.84143144246472090e+00, -1.16032004402742839e+00,
+          -1.03622044471123109e-01],
+         [1.66007664274403694e-03 * DAYS_PER_YEAR,
+          7.69901118419740425e-03 * DAYS_PER_YEAR,
+          -6.90460016972063023e-05 * DAYS_PER_YEAR],
+         9.54791938424326609e-04 * SOLAR_MASS),
+        ([8.34336671824457987e+00, 4.12479856412430479e+00,
+          -4.03523417114321381e-01],
+         [-2.76742510726862411e-03 * DAYS_PER_YEAR,
+          4.99852801234917238e-03 * DAYS_PER_YEAR,
+          2.30417297573763929e-05 * DAYS_PER_YEAR],
+         2.85885980666130812e-04 * SOLAR_MASS),
+        ([1.28943695621391310e+01, -1.51111514016986312e+01,
+          -2.23307578892655734e-01],
+         [2.96460137564761618e-03 * DAYS_PER_YEAR,
+          2.37847173959480950e-03 * DAYS_PER_YEAR,
+          -2.96589568540237556e-05 * DAYS_PER_YEAR],
+         4.36624404335156298e-05 * SOLAR_MASS),
+        ([1.53796971148509165e+01, -2.59193146099879641e+01,
+          1.79258772950371181e-01],
+         [2.68067772490389322e-03 * DAYS_PER_YEAR,
+          1.62824170038242295e-03 * DAYS_PER_YEAR,
+          -9.51592254519715870e-05 * DAYS_PER_YEAR],
+         5.15138902046611451e-05 * SOLAR_MASS),
+    ]
+
+def nbody(n):
+    bodies = make_bodies()
+    pairs = [(bodies[i], bodies[j])
+             for i in range(len(bodies)) for j in range(i + 1, len(bodies))]
+    dt = 0.01
+    for _ in range(n * 150):
+        for (([x1, y1, z1], v1, m1), ([x2, y2, z2], v2, m2)) in pairs:
+            dx = x1 - x2
+            dy = y1 - y2
+            dz = z1 - z2
+            mag = dt * ((dx * dx + dy * dy + dz * dz) ** (-1.5))
+            b1m = m1 * mag
+            b2m = m2 * mag
+            v1[0] -= dx * b2m
+            v1[1] -= dy * b2m
+            v1[2] -= dz * b2m
+            v2[0] += dx * b1m
+            v2[1] += dy * b1m
+            v2[2] += dz * b1m
+        for (r, [vx, vy, vz], m) in bodies:
+            r[0] += dt * vx
+            r[1] += dt * vy
+            r[2] += dt * vz
+
+
+# spectral_norm
+
+def eval_A(i, j):
+    return 1.0 / ((i + j) * (i + j + 1) // 2 + i + 1)
+
+def eval_times_u(func, u):
+    return [func((i, u)) for i in range(len(list(u)))]
+
+def part_A_times_u(i_u):
+    i, u = i_u
+    partial_sum = 0
+    for j, u_j in enumerate(u):
+        partial_sum += eval_A(i, j) * u_j
+    return partial_sum
+
+def part_At_times_u(i_u):
+    i, u = i_u
+    partial_sum = 0
+    for j, u_j in enumerate(u):
+        partial_sum += eval_A(j, i) * u_j
+    return partial_sum
+
+def spectral_norm(n):
+    u = [1] * 60
+    for _ in range(n // 2):
+        v = eval_times_u(part_At_times_u, eval_times_u(part_A_times_u, u))
+        u = eval_times_u(part_At_times_u, eval_times_u(part_A_times_u, v))
+    return u
+
+
+# fannkuch
+
+def fannkuch(n):
+    size = 7
+    for _ in range(n // 4):
+        count = list(range(1, size + 1))
+        max_flips = 0
+        m = size - 1
+        r = size
+        perm1 = list(range(size))
+        while True:
+            while r != 1:
+                count[r - 1] = r
+                r -= 1
+            if perm1[0] != 0 and perm1[m] != m:
+                perm = perm1[:]
+                flips = 0
+                k = perm[0]
+                while k:
+                    perm[:k + 1] = perm[k::-1]
+                    flips += 1
+                    k = perm[0]
+                if flips > max_flips:
+                    max_flips = flips
+            while r != size:
+                perm1.insert(r, perm1.pop(0))
+                count[r] -= 1
+                if count[r] > 0:
+                    break
+                r += 1
+            else:
+                break
+    return max_flips
+
+
+# richards (task scheduling with objects and method calls)
+
+class Packet:
+    def __init__(self, link, ident, kind):
+        self.link = link
+        self.ident = ident
+        self.kind = kind
+        self.datum = 0
+        self.data = [0] * 4
+
+    def append_to(self, lst):
+        self.link = None
+        if lst is None:
+            return self
+        p = lst
+        nxt = p.link
+        while nxt is not None:
+            p = nxt
+            nxt = p.link
+        p.link = self
+        return lst
+
+class Task:
+    def __init__(self, ident, prio, wkq):
+        self.ident = ident
+        self.prio = prio
+        self.wkq = wkq
+        self.count = 0
+
+    def run(self, scheduler):
+        pkt = self.wkq
+        if pkt is not None:
+            self.wkq = pkt.link
+            self.count += pkt.datum + 1
+            pkt.datum = (pkt.datum + self.ident) % 26
+            target = scheduler.tasks[(self.ident + self.count) % 4]
+            target.wkq = pkt.append_to(target.wkq)
+            return True
+        return False
+
+class Scheduler:
+    def __init__(self):
+        self.tasks = []
+        for i in range(4):
+            wkq = None
+            for j in range(3):
+                wkq = Packet(wkq, i, j)
+            self.tasks.append(Task(i, i * 10, wkq))
+
+    def schedule(self, steps):
+        ran = 0
+        for _ in range(steps):
+            for task in self.tasks:
+                if task.run(self):
+                    ran += 1
+        return ran
+
+def richards(n):
+    return Scheduler().schedule(n * 2000)
+
+
+# float
+
+class Point:
+    def __init__(self, i):
+        self.x = x = math.sin(i)
+        self.y = math.cos(i) * 3
+        self.z = (x * x) / 2
+
+    def normalize(self):
+        x = self.x
+        y = self.y
+        z = self.z
+        norm = math.sqrt(x * x + y * y + z * z)
+        self.x /= norm
+        self.y /= norm
+        self.z /= norm
+
+    def maximize(self, other):
+        self.x = self.x if self.x > other.x else other.x
+        self.y = self.y if self.y > other.y else other.y
+        self.z = self.z if self.z > other.z else other.z
+        return self
+
+def float_(n):
+    points = [Point(i) for i in range(n * 1000)]
+    for p in points:
+        p.normalize()
+    nxt = points[0]
+    for p in points[1:]:
+        nxt = nxt.maximize(p)
+    return nxt
+
+
+# nqueens
+
+def permutations(iterable, r=None):
+    pool = tuple(iterable)
+    n = len(pool)
+    r = n if r is None else r
+    indices = list(range(n))
+    cycles = list(range(n - r + 1, n + 1))[::-1]
+    yield tuple(pool[i] for i in indices[:r])
+    while n:
+        for i in reversed(range(r)):
+            cycles[i] -= 1
+            if cycles[i] == 0:
+                indices[i:] = indices[i + 1:] + indices[i:i + 1]
+                cycles[i] = n - i
+            else:
+                j = cycles[i]
+                indices[i], indices[-j] = indices[-j], indices[i]
+                yield tuple(pool[i] for i in indices[:r])
+                break
+        else:
+            return
+
+def nqueens(n):
+    size = 6
+    cols = range(size)
+    count = 0
+    for _ in range(n // 2):
+        for vec in permutations(cols):
+            if (size == len(set(vec[i] + i for i in cols))
+                     == len(set(vec[i] - i for i in cols))):
+                count += 1
+    return count
+
+
+# integer loops and calls
+
+def fib(n):
+    if n < 2:
+        return n
+    return fib(n - 1) + fib(n - 2)
+
+def calls(n):
+    return fib(22 + n // 10)
+
+def sieve(n):
+    limit = n * 10000
+    flags = [True] * limit
+    count = 0
+    for i in range(2, limit):
+        if flags[i]:
+            count += 1
+            j = i * i
+            while j < limit:
+                flags[j] = False
+                j += i
+    return count
+
+def strings(n):
+    words = []
+    for i in range(n * 2000):
+        s = str(i)
+        if len(s) % 2 == 0 and s[0] != '1':
+            words.append(s + s)
+        elif s.endswith('7'):
+            words.append(s.upper())
+    return ' '.join(words).count('1')
+
+# keyword calls (constructors and logging-style calls)
+
+class Record:
+    def __init__(self, name, level, msg, args=None, exc_info=None,
+                 func=None, extra=None):
+        self.name = name
+        self.level = level
+        self.msg = msg
+        self.args = args
+        self.exc_info = exc_info
+        self.func = func
+        self.extra = extra
+
+def log(msg, *args, level=0, exc_info=None, stack_info=False,
+        stacklevel=1):
+    return level + stacklevel
+
+def kwcalls(n):
+    total = 0
+    for i in range(n * 1000):
+        r = Record(name='root', level=i, msg='message', exc_info=None)
+        total += log(r.msg, level=r.level, stacklevel=2)
+        total += log('message', 1, 2, stack_info=False, level=3)
+        r = Record('root', 10, msg='message', extra=None, func=log)
+    return total
+
+# collection building with builtin methods (list.append, dict.get, len)
+
+def collections_(n):
+    words = ['alpha', 'beta', 'gamma', 'delta', 'epsilon', 'zeta', 'eta']
+    total = 0
+    for i in range(n * 100):
+        counts = {}
+        groups = {}
+        out = []
+        for j, w in enumerate(words * 5):
+            counts[w] = counts.get(w, 0) + 1
+            key = len(w)
+            group = groups.get(key)
+            if group is None:
+                group = groups[key] = []
+            group.append(w)
+            if len(out) < 20:
+                out.append(j)
+        total += len(counts) + len(groups) + len(out)
+    return total
+
+
+KERNELS = [nbody, spectral_norm, fannkuch, richards, float_, nqueens,
+           calls, kwcalls, sieve, strings, collections_]
+
+
+def print_pairs(top):
+    import opcode
+    def name(op):
+        return opcode.opname[op] if op < 256 else '<start>'
+    profile = sys.getdxp()
+    counts = profile[256]
+    total = sum(counts)
+    print('%d instructions executed' % total)
+    print()
+    print('Top %d opcodes:' % top)
+    ops = sorted(range(256), key=counts.__getitem__, reverse=True)
+    for op in ops[:top]:
+        print('  %-28s %6.2f%%' % (name(op), counts[op] * 100 / total))
+    print()
+    print('Top %d pairs:' % top)
+    pairs = [(profile[a][b], a, b) for a in range(256) for b in range(256)
+             if profile[a][b]]
+    pairs.sort(reverse=True)
+    for count, a, b in pairs[:top]:
+        print('  %-28s %-28s %6.2f%%' % (name(a), name(b),
+                                         count * 100 / total))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--number', type=int, default=20,
+                        help='size of each kernel (default: 20)')
+    parser.add_argument('-r', '--repeat', type=int, default=5,
+                        help='runs per kernel, the best one is reported '
+                             '(default: 5)')
+    parser.add_argument('--pairs', type=int, metavar='N',
+                        help='run each kernel once and print the N most '
+                             'executed opcodes and opcode pairs')
+    args = parser.parse_args()
+
+    if args.pairs:
+        if not hasattr(sys, 'getdxp'):
+            parser.error('--pairs requires a Python built with '
+                         '-DDYNAMIC_EXECUTION_PROFILE -DDXPAIRS')
+        sys.getdxp()    # reset the counts
+        for kernel in KERNELS:
+            kernel(args.number)
+        print_pairs(args.pairs)
+        return
+
+    total = 0.0
+    for kernel in KERNELS:
+        kernel(args.number)     # warm up
+        best = float('inf')
+        for _ in range(args.repeat):
+            t0 = time.perf_counter()
+            kernel(args.number)
+            best = min(best, time.perf_counter() - t0)
+        total += best
+        print('%-16s %8.2f ms' % (kernel.__name__.rstrip('_'), best * 1e3))
+    print('%-16s %8.2f ms' % ('total', total * 1e3))
+
+
+if __name__ == '__main__':
+    main()